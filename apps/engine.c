@@ -436,6 +436,11 @@ int MAIN(int argc, char **argv)
                 if (ENGINE_get_RAND(e) != NULL
                     && !append_buf(&cap_buf, "RAND", &cap_size, 256))
                     goto end;
+#ifndef OPENSSL_NO_RINGLWE
+                if (ENGINE_get_RLWE(e) != NULL
+                    && !append_buf(&cap_buf, "RLWE", &cap_size, 256))
+                    goto end;
+#endif
 
                 fn_c = ENGINE_get_ciphers(e);
                 if (!fn_c)
@@ -79,6 +79,7 @@
 # define DSA_SECONDS     10
 # define ECDSA_SECONDS   10
 # define ECDH_SECONDS    10
+# define RLWE_SECONDS    10
 
 /* 11-Sep-92 Andrew Daviel   Support for Silicon Graphics IRIX added */
 /* 06-Apr-92 Luke Brennan    Support for VMS and add extra signal calls */
@@ -191,6 +192,9 @@
 # ifndef OPENSSL_NO_ECDH
 #  include <openssl/ecdh.h>
 # endif
+# ifndef OPENSSL_NO_RINGLWE
+#  include <openssl/ringlwe.h>
+# endif
 # include <openssl/modes.h>
 
 # ifdef OPENSSL_FIPS
@@ -249,6 +253,9 @@ static int do_multi(int multi);
 # define EC_NUM       16
 # define MAX_ECDH_SIZE 256
 
+# define RLWE_NUM     9
+# define MAX_RLWE_SIZE 128
+
 static const char *names[ALGOR_NUM] = {
     "md2", "mdc2", "md4", "md5", "hmac(md5)", "sha1", "rmd160", "rc4",
     "des cbc", "des ede3", "idea cbc", "seed cbc",
@@ -274,8 +281,27 @@ static double ecdsa_results[EC_NUM][2];
 # ifndef OPENSSL_NO_ECDH
 static double ecdh_results[EC_NUM][1];
 # endif
+# ifndef OPENSSL_NO_RINGLWE
+/* keygen, encapsulate (Bob), decapsulate (Alice) */
+static double rlwe_results[RLWE_NUM][3];
+static const int test_rlwe_nids[RLWE_NUM] = {
+    NID_ringLearningWithErrors_1024_40961,
+    NID_ringLearningWithErrors_821_49261,
+    NID_ringLearningWithErrors_739_47297,
+    NID_ringLearningWithErrors_631_44171,
+    NID_ringLearningWithErrors_541_41117,
+    NID_ringLearningWithErrors_512_25601,
+    NID_ringLearningWithErrors_433_35507,
+    NID_ringLearningWithErrors_337_32353,
+    NID_ringLearningWithErrors_256_15361
+};
+static const char *test_rlwe_names[RLWE_NUM] = {
+    "rlwe1024", "rlwe821", "rlwe739", "rlwe631", "rlwe541",
+    "rlwe512", "rlwe433", "rlwe337", "rlwe256"
+};
+# endif
 
-# if defined(OPENSSL_NO_DSA) && !(defined(OPENSSL_NO_ECDSA) && defined(OPENSSL_NO_ECDH))
+# if defined(OPENSSL_NO_DSA) && !(defined(OPENSSL_NO_ECDSA) && defined(OPENSSL_NO_ECDH) && defined(OPENSSL_NO_RINGLWE))
 static const char rnd_seed[] =
     "string to make the random number generator think it has entropy";
 static int rnd_fake = 0;
@@ -543,6 +569,16 @@ int MAIN(int argc, char **argv)
 # define R_EC_B409    14
 # define R_EC_B571    15
 
+# define R_RLWE_1024  0
+# define R_RLWE_821   1
+# define R_RLWE_739   2
+# define R_RLWE_631   3
+# define R_RLWE_541   4
+# define R_RLWE_512   5
+# define R_RLWE_433   6
+# define R_RLWE_337   7
+# define R_RLWE_256   8
+
 # ifndef OPENSSL_NO_RSA
     RSA *rsa_key[RSA_NUM];
     long rsa_c[RSA_NUM][2];
@@ -632,6 +668,16 @@ int MAIN(int argc, char **argv)
     long ecdh_c[EC_NUM][2];
 # endif
 
+# ifndef OPENSSL_NO_RINGLWE
+    RLWE_PAIR *rlwe_a[RLWE_NUM];
+    RLWE_PUB *rlwe_b[RLWE_NUM];
+    RLWE_REC *rlwe_rec[RLWE_NUM];
+    RLWE_WORKSPACE *rlwe_ws[RLWE_NUM];
+    unsigned char rlwe_secret_a[MAX_RLWE_SIZE], rlwe_secret_b[MAX_RLWE_SIZE];
+    long rlwe_c[RLWE_NUM][3];
+    int rlwe_doit[RLWE_NUM];
+# endif
+
     int rsa_doit[RSA_NUM];
     int dsa_doit[DSA_NUM];
 # ifndef OPENSSL_NO_ECDSA
@@ -669,6 +715,14 @@ int MAIN(int argc, char **argv)
         ecdh_b[i] = NULL;
     }
 # endif
+# ifndef OPENSSL_NO_RINGLWE
+    for (i = 0; i < RLWE_NUM; i++) {
+        rlwe_a[i] = NULL;
+        rlwe_b[i] = NULL;
+        rlwe_rec[i] = NULL;
+        rlwe_ws[i] = NULL;
+    }
+# endif
 
     if (bio_err == NULL)
         if ((bio_err = BIO_new(BIO_s_file())) != NULL)
@@ -710,6 +764,10 @@ int MAIN(int argc, char **argv)
     for (i = 0; i < EC_NUM; i++)
         ecdh_doit[i] = 0;
 # endif
+# ifndef OPENSSL_NO_RINGLWE
+    for (i = 0; i < RLWE_NUM; i++)
+        rlwe_doit[i] = 0;
+# endif
 
     j = 0;
     argc--;
@@ -1062,6 +1120,30 @@ int MAIN(int argc, char **argv)
             for (i = 0; i < EC_NUM; i++)
                 ecdh_doit[i] = 1;
         } else
+# endif
+# ifndef OPENSSL_NO_RINGLWE
+        if (strcmp(*argv, "rlwe1024") == 0)
+            rlwe_doit[R_RLWE_1024] = 2;
+        else if (strcmp(*argv, "rlwe821") == 0)
+            rlwe_doit[R_RLWE_821] = 2;
+        else if (strcmp(*argv, "rlwe739") == 0)
+            rlwe_doit[R_RLWE_739] = 2;
+        else if (strcmp(*argv, "rlwe631") == 0)
+            rlwe_doit[R_RLWE_631] = 2;
+        else if (strcmp(*argv, "rlwe541") == 0)
+            rlwe_doit[R_RLWE_541] = 2;
+        else if (strcmp(*argv, "rlwe512") == 0)
+            rlwe_doit[R_RLWE_512] = 2;
+        else if (strcmp(*argv, "rlwe433") == 0)
+            rlwe_doit[R_RLWE_433] = 2;
+        else if (strcmp(*argv, "rlwe337") == 0)
+            rlwe_doit[R_RLWE_337] = 2;
+        else if (strcmp(*argv, "rlwe256") == 0)
+            rlwe_doit[R_RLWE_256] = 2;
+        else if (strcmp(*argv, "rlwe") == 0) {
+            for (i = 0; i < RLWE_NUM; i++)
+                rlwe_doit[i] = 1;
+        } else
 # endif
         {
             BIO_printf(bio_err, "Error: bad option or value\n");
@@ -1165,6 +1247,12 @@ int MAIN(int argc, char **argv)
                        "ecdhb163  ecdhb233  ecdhb283  ecdhb409  ecdhb571\n");
             BIO_printf(bio_err, "ecdh\n");
 # endif
+# ifndef OPENSSL_NO_RINGLWE
+            BIO_printf(bio_err, "rlwe1024  rlwe821   rlwe739   rlwe631   "
+                       "rlwe541\n");
+            BIO_printf(bio_err, "rlwe512   rlwe433   rlwe337   rlwe256\n");
+            BIO_printf(bio_err, "rlwe\n");
+# endif
 
 # ifndef OPENSSL_NO_IDEA
             BIO_printf(bio_err, "idea     ");
@@ -1247,6 +1335,10 @@ int MAIN(int argc, char **argv)
 # ifndef OPENSSL_NO_ECDH
         for (i = 0; i < EC_NUM; i++)
             ecdh_doit[i] = 1;
+# endif
+# ifndef OPENSSL_NO_RINGLWE
+        for (i = 0; i < RLWE_NUM; i++)
+            rlwe_doit[i] = 1;
 # endif
     }
     for (i = 0; i < ALGOR_NUM; i++)
@@ -1531,6 +1623,21 @@ int MAIN(int argc, char **argv)
     }
 #   endif
 
+#   ifndef OPENSSL_NO_RINGLWE
+    for (i = 0; i < RLWE_NUM; i++) {
+        rlwe_c[i][0] = count / 1000;
+        rlwe_c[i][1] = count / 1000;
+        rlwe_c[i][2] = count / 1000;
+        if ((rlwe_doit[i] <= 1) && (rlwe_c[i][0] == 0))
+            rlwe_doit[i] = 0;
+        else if (rlwe_c[i][0] == 0) {
+            rlwe_c[i][0] = 1;
+            rlwe_c[i][1] = 1;
+            rlwe_c[i][2] = 1;
+        }
+    }
+#   endif
+
 #   define COND(d) (count < (d))
 #   define COUNT(d) (d)
 #  else
@@ -2354,6 +2461,108 @@ int MAIN(int argc, char **argv)
     if (rnd_fake)
         RAND_cleanup();
 # endif
+# ifndef OPENSSL_NO_RINGLWE
+    if (RAND_status() != 1) {
+        RAND_seed(rnd_seed, sizeof rnd_seed);
+        rnd_fake = 1;
+    }
+    for (j = 0; j < RLWE_NUM; j++) {
+        RLWE_CTX *rlwe_ctx;
+        int rlwe_m;
+        size_t outlen;
+
+        if (!rlwe_doit[j])
+            continue;
+        rlwe_ctx = RLWE_CTX_new(test_rlwe_nids[j]);
+        rlwe_m = RLWE_CTX_get_m(rlwe_ctx);
+        outlen = (rlwe_m + 7) / 8;
+        rlwe_a[j] = RLWE_PAIR_new(rlwe_ctx);
+        rlwe_b[j] = RLWE_PUB_new(rlwe_ctx);
+        rlwe_rec[j] = RLWE_REC_new(RLWE_CTX_get_muwords(rlwe_ctx));
+        rlwe_ws[j] = RLWE_WORKSPACE_new(rlwe_ctx);
+        RLWE_CTX_free(rlwe_ctx);
+        if ((rlwe_a[j] == NULL) || (rlwe_b[j] == NULL)
+            || (rlwe_rec[j] == NULL) || (rlwe_ws[j] == NULL)
+            || (outlen > MAX_RLWE_SIZE)) {
+            BIO_printf(bio_err, "RLWE failure.\n");
+            ERR_print_errors(bio_err);
+            rsa_count = 1;
+        } else if (!RLWE_PAIR_generate_key(rlwe_a[j])) {
+            BIO_printf(bio_err, "RLWE key generation failure.\n");
+            ERR_print_errors(bio_err);
+            rsa_count = 1;
+        } else if ((RINGLWE_compute_key_bob_ex(rlwe_secret_b, outlen,
+                                               rlwe_rec[j],
+                                               RLWE_PAIR_get_publickey
+                                               (rlwe_a[j]), rlwe_b[j],
+                                               rlwe_ws[j], NULL) != outlen)
+                   || (RINGLWE_compute_key_alice_ex(rlwe_secret_a, outlen,
+                                                    rlwe_b[j], rlwe_rec[j],
+                                                    rlwe_a[j], rlwe_ws[j],
+                                                    NULL) != outlen)
+                   || memcmp(rlwe_secret_a, rlwe_secret_b, outlen)) {
+            BIO_printf(bio_err, "RLWE computations don't match.\n");
+            ERR_print_errors(bio_err);
+            rsa_count = 1;
+        } else {
+            pkey_print_message("keygen", "rlwe",
+                               rlwe_c[j][0], rlwe_m, RLWE_SECONDS);
+            Time_F(START);
+            for (count = 0, run = 1; COND(rlwe_c[j][0]); count++)
+                RLWE_PAIR_generate_key(rlwe_a[j]);
+            d = Time_F(STOP);
+            BIO_printf(bio_err,
+                       mr ? "+R8:%ld:%d:%.2f\n" :
+                       "%ld %d RLWE keygen ops in %.2fs\n", count,
+                       rlwe_m, d);
+            rlwe_results[j][0] = d / (double)count;
+            rsa_count = count;
+
+            /* Bob's side, against the last key Alice generated */
+            pkey_print_message("encapsulate", "rlwe",
+                               rlwe_c[j][1], rlwe_m, RLWE_SECONDS);
+            Time_F(START);
+            for (count = 0, run = 1; COND(rlwe_c[j][1]); count++)
+                RINGLWE_compute_key_bob_ex(rlwe_secret_b, outlen,
+                                           rlwe_rec[j],
+                                           RLWE_PAIR_get_publickey(rlwe_a
+                                                                   [j]),
+                                           rlwe_b[j], rlwe_ws[j], NULL);
+            d = Time_F(STOP);
+            BIO_printf(bio_err,
+                       mr ? "+R9:%ld:%d:%.2f\n" :
+                       "%ld %d RLWE encapsulate ops in %.2fs\n", count,
+                       rlwe_m, d);
+            rlwe_results[j][1] = d / (double)count;
+
+            /* Alice's side, with Bob's last public key and reconciliation
+             * data */
+            pkey_print_message("decapsulate", "rlwe",
+                               rlwe_c[j][2], rlwe_m, RLWE_SECONDS);
+            Time_F(START);
+            for (count = 0, run = 1; COND(rlwe_c[j][2]); count++)
+                RINGLWE_compute_key_alice_ex(rlwe_secret_a, outlen,
+                                             rlwe_b[j], rlwe_rec[j],
+                                             rlwe_a[j], rlwe_ws[j], NULL);
+            d = Time_F(STOP);
+            BIO_printf(bio_err,
+                       mr ? "+R10:%ld:%d:%.2f\n" :
+                       "%ld %d RLWE decapsulate ops in %.2fs\n", count,
+                       rlwe_m, d);
+            rlwe_results[j][2] = d / (double)count;
+            if (count < rsa_count)
+                rsa_count = count;
+        }
+
+        if (rsa_count <= 1) {
+            /* if longer than 10s, don't do any more */
+            for (j++; j < RLWE_NUM; j++)
+                rlwe_doit[j] = 0;
+        }
+    }
+    if (rnd_fake)
+        RAND_cleanup();
+# endif
 # ifndef NO_FORK
  show_res:
 # endif
@@ -2493,6 +2702,47 @@ int MAIN(int argc, char **argv)
     }
 # endif
 
+# ifndef OPENSSL_NO_RINGLWE
+    j = 1;
+    for (k = 0; k < RLWE_NUM; k++) {
+        RLWE_CTX *rlwe_ctx;
+        RLWE_PUB *pub;
+        RLWE_REC *rec;
+        size_t publen = 0, reclen = 0;
+
+        if (!rlwe_doit[k])
+            continue;
+        if (j && !mr) {
+            printf("%19skeygen    encaps    decaps keygen/s encaps/s decaps/s"
+                   "  pub rec\n", " ");
+            j = 0;
+        }
+        rlwe_ctx = RLWE_CTX_new(test_rlwe_nids[k]);
+        pub = RLWE_PUB_new(rlwe_ctx);
+        rec = RLWE_REC_new(RLWE_CTX_get_muwords(rlwe_ctx));
+        if (pub != NULL)
+            publen = RLWE_PUB_encode(pub, NULL, 0);
+        if (rec != NULL)
+            reclen = RLWE_REC_encode(rec, NULL, 0);
+        if (mr)
+            fprintf(stdout, "+F6:%u:%u:%g:%g:%g\n",
+                    k, RLWE_CTX_get_m(rlwe_ctx), rlwe_results[k][0],
+                    rlwe_results[k][1], rlwe_results[k][2]);
+        else
+            fprintf(stdout,
+                    "rlwe (%-8s) %7.1fus %7.1fus %7.1fus %8.1f %8.1f %8.1f"
+                    " %4u %3u\n",
+                    test_rlwe_names[k], 1e6 * rlwe_results[k][0],
+                    1e6 * rlwe_results[k][1], 1e6 * rlwe_results[k][2],
+                    1.0 / rlwe_results[k][0], 1.0 / rlwe_results[k][1],
+                    1.0 / rlwe_results[k][2], (unsigned)publen,
+                    (unsigned)reclen);
+        RLWE_REC_free(rec);
+        RLWE_PUB_free(pub);
+        RLWE_CTX_free(rlwe_ctx);
+    }
+# endif
+
     mret = 0;
 
  end:
@@ -2525,6 +2775,18 @@ int MAIN(int argc, char **argv)
             EC_KEY_free(ecdh_b[i]);
     }
 # endif
+# ifndef OPENSSL_NO_RINGLWE
+    for (i = 0; i < RLWE_NUM; i++) {
+        if (rlwe_a[i] != NULL)
+            RLWE_PAIR_free(rlwe_a[i]);
+        if (rlwe_b[i] != NULL)
+            RLWE_PUB_free(rlwe_b[i]);
+        if (rlwe_rec[i] != NULL)
+            RLWE_REC_free(rlwe_rec[i]);
+        if (rlwe_ws[i] != NULL)
+            RLWE_WORKSPACE_free(rlwe_ws[i]);
+    }
+# endif
 
     apps_shutdown();
     OPENSSL_EXIT(mret);
@@ -2751,6 +3013,26 @@ static int do_multi(int multi)
             }
 #  endif
 
+#  ifndef OPENSSL_NO_RINGLWE
+            else if (!strncmp(buf, "+F6:", 4)) {
+                int k, op;
+                double d;
+
+                p = buf + 4;
+                k = atoi(sstrsep(&p, sep));
+                sstrsep(&p, sep);
+
+                for (op = 0; op < 3; op++) {
+                    d = atof(sstrsep(&p, sep));
+                    if (n)
+                        rlwe_results[k][op] =
+                            1 / (1 / rlwe_results[k][op] + 1 / d);
+                    else
+                        rlwe_results[k][op] = d;
+                }
+            }
+#  endif
+
             else if (!strncmp(buf, "+H:", 3)) {
             } else
                 fprintf(stderr, "Unknown type '%s' from child %d\n", buf, n);
@@ -89,6 +89,10 @@ int ENGINE_set_default(ENGINE *e, unsigned int flags)
 #endif
     if ((flags & ENGINE_METHOD_RAND) && !ENGINE_set_default_RAND(e))
         return 0;
+#ifndef OPENSSL_NO_RINGLWE
+    if ((flags & ENGINE_METHOD_RLWE) && !ENGINE_set_default_RLWE(e))
+        return 0;
+#endif
     if ((flags & ENGINE_METHOD_PKEY_METHS)
         && !ENGINE_set_default_pkey_meths(e))
         return 0;
@@ -119,6 +123,8 @@ static int int_def_cb(const char *alg, int len, void *arg)
         *pflags |= ENGINE_METHOD_DH;
     else if (!strncmp(alg, "RAND", len))
         *pflags |= ENGINE_METHOD_RAND;
+    else if (!strncmp(alg, "RLWE", len))
+        *pflags |= ENGINE_METHOD_RLWE;
     else if (!strncmp(alg, "CIPHERS", len))
         *pflags |= ENGINE_METHOD_CIPHERS;
     else if (!strncmp(alg, "DIGESTS", len))
@@ -166,6 +172,9 @@ int ENGINE_register_complete(ENGINE *e)
     ENGINE_register_ECDSA(e);
 #endif
     ENGINE_register_RAND(e);
+#ifndef OPENSSL_NO_RINGLWE
+    ENGINE_register_RLWE(e);
+#endif
     ENGINE_register_pkey_meths(e);
     return 1;
 }
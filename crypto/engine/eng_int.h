@@ -183,6 +183,7 @@ struct engine_st {
     const ECDSA_METHOD *ecdsa_meth;
     const RAND_METHOD *rand_meth;
     const STORE_METHOD *store_meth;
+    const RLWE_METHOD *rlwe_meth;
     /* Cipher handling is via this callback */
     ENGINE_CIPHERS_PTR ciphers;
     /* Digest handling is via this callback */
@@ -59,6 +59,9 @@
 
 #include "eng_int.h"
 #include <openssl/rand.h>
+#ifndef OPENSSL_NO_RINGLWE
+# include <openssl/ringlwe.h>
+#endif
 
 /* The "new"/"free" stuff first */
 
@@ -92,6 +95,7 @@ void engine_set_all_null(ENGINE *e)
     e->dh_meth = NULL;
     e->rand_meth = NULL;
     e->store_meth = NULL;
+    e->rlwe_meth = NULL;
     e->ciphers = NULL;
     e->digests = NULL;
     e->destroy = NULL;
@@ -211,6 +215,9 @@ void ENGINE_cleanup(void)
      * registering a cleanup callback.
      */
     RAND_set_rand_method(NULL);
+#ifndef OPENSSL_NO_RINGLWE
+    RLWE_set_default_method(NULL);
+#endif
 }
 
 /* Now the "ex_data" support */
@@ -309,6 +309,9 @@ static void engine_cpy(ENGINE *dest, const ENGINE *src)
 #endif
     dest->rand_meth = src->rand_meth;
     dest->store_meth = src->store_meth;
+#ifndef OPENSSL_NO_RINGLWE
+    dest->rlwe_meth = src->rlwe_meth;
+#endif
     dest->ciphers = src->ciphers;
     dest->digests = src->digests;
     dest->pkey_meths = src->pkey_meths;
@@ -0,0 +1,85 @@
+/* crypto/engine/tb_rlwe.c */
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+#include "eng_int.h"
+
+#ifndef OPENSSL_NO_RINGLWE
+
+/*
+ * If this symbol is defined then ENGINE_get_default_RLWE(), the function
+ * that is used by RLWE to hook in implementation code and cache defaults
+ * (etc), will display brief debugging summaries to stderr with the 'nid'.
+ */
+/* #define ENGINE_RLWE_DEBUG */
+
+static ENGINE_TABLE *rlwe_table = NULL;
+static const int dummy_nid = 1;
+
+void ENGINE_unregister_RLWE(ENGINE *e)
+{
+    engine_table_unregister(&rlwe_table, e);
+}
+
+static void engine_unregister_all_RLWE(void)
+{
+    engine_table_cleanup(&rlwe_table);
+}
+
+int ENGINE_register_RLWE(ENGINE *e)
+{
+    if (e->rlwe_meth)
+        return engine_table_register(&rlwe_table,
+                                     engine_unregister_all_RLWE, e,
+                                     &dummy_nid, 1, 0);
+    return 1;
+}
+
+void ENGINE_register_all_RLWE()
+{
+    ENGINE *e;
+
+    for (e = ENGINE_get_first(); e; e = ENGINE_get_next(e))
+        ENGINE_register_RLWE(e);
+}
+
+int ENGINE_set_default_RLWE(ENGINE *e)
+{
+    if (e->rlwe_meth)
+        return engine_table_register(&rlwe_table,
+                                     engine_unregister_all_RLWE, e,
+                                     &dummy_nid, 1, 1);
+    return 1;
+}
+
+/*
+ * Exposed API function to get a functional reference from the implementation
+ * table (ie. try to get a functional reference from the tabled structural
+ * references).
+ */
+ENGINE *ENGINE_get_default_RLWE(void)
+{
+    return engine_table_select(&rlwe_table, dummy_nid);
+}
+
+/* Obtains an RLWE implementation from an ENGINE functional reference */
+const RLWE_METHOD *ENGINE_get_RLWE(const ENGINE *e)
+{
+    return e->rlwe_meth;
+}
+
+/* Sets an RLWE implementation in an ENGINE structure */
+int ENGINE_set_RLWE(ENGINE *e, const RLWE_METHOD *rlwe_meth)
+{
+    e->rlwe_meth = rlwe_meth;
+    return 1;
+}
+
+#endif
@@ -117,6 +117,7 @@
 # define EVP_PKEY_EC     NID_X9_62_id_ecPublicKey
 # define EVP_PKEY_HMAC   NID_hmac
 # define EVP_PKEY_CMAC   NID_cmac
+# define EVP_PKEY_RLWE   NID_ringLearningWithErrors
 
 #ifdef  __cplusplus
 extern "C" {
@@ -145,6 +146,9 @@ struct evp_pkey_st {
 # endif
 # ifndef OPENSSL_NO_EC
         struct ec_key_st *ec;   /* ECC */
+# endif
+# ifndef OPENSSL_NO_RINGLWE
+        struct rlwe_pair_st *rlwe; /* Ring-LWE */
 # endif
     } pkey;
     int save_parameters;
@@ -507,6 +511,11 @@ typedef int (EVP_PBE_KEYGEN) (EVP_CIPHER_CTX *ctx, const char *pass,
                                         (char *)(eckey))
 # endif
 
+# ifndef OPENSSL_NO_RINGLWE
+#  define EVP_PKEY_assign_RLWE(pkey,rlwe) EVP_PKEY_assign((pkey),EVP_PKEY_RLWE,\
+                                        (char *)(rlwe))
+# endif
+
 /* Add some extra combinations */
 # define EVP_get_digestbynid(a) EVP_get_digestbyname(OBJ_nid2sn(a))
 # define EVP_get_digestbyobj(a) EVP_get_digestbynid(OBJ_obj2nid(a))
@@ -976,6 +985,11 @@ struct ec_key_st;
 int EVP_PKEY_set1_EC_KEY(EVP_PKEY *pkey, struct ec_key_st *key);
 struct ec_key_st *EVP_PKEY_get1_EC_KEY(EVP_PKEY *pkey);
 # endif
+# ifndef OPENSSL_NO_RINGLWE
+struct rlwe_pair_st;
+int EVP_PKEY_set1_RLWE(EVP_PKEY *pkey, struct rlwe_pair_st *key);
+struct rlwe_pair_st *EVP_PKEY_get1_RLWE(EVP_PKEY *pkey);
+# endif
 
 EVP_PKEY *EVP_PKEY_new(void);
 void EVP_PKEY_free(EVP_PKEY *pkey);
@@ -1424,6 +1438,7 @@ void ERR_load_EVP_strings(void);
 # define EVP_F_EVP_PKEY_GET1_DSA                          120
 # define EVP_F_EVP_PKEY_GET1_ECDSA                        130
 # define EVP_F_EVP_PKEY_GET1_EC_KEY                       131
+# define EVP_F_EVP_PKEY_GET1_RLWE                         180
 # define EVP_F_EVP_PKEY_GET1_RSA                          121
 # define EVP_F_EVP_PKEY_KEYGEN                            146
 # define EVP_F_EVP_PKEY_KEYGEN_INIT                       147
@@ -1484,6 +1499,7 @@ void ERR_load_EVP_strings(void);
 # define EVP_R_EXPECTING_A_DSA_KEY                        129
 # define EVP_R_EXPECTING_A_ECDSA_KEY                      141
 # define EVP_R_EXPECTING_A_EC_KEY                         142
+# define EVP_R_EXPECTING_A_RLWE_KEY                       171
 # define EVP_R_FIPS_MODE_NOT_SUPPORTED                    167
 # define EVP_R_INITIALIZATION_ERROR                       134
 # define EVP_R_INPUT_NOT_INITIALIZED                      111
@@ -73,6 +73,9 @@
 #ifndef OPENSSL_NO_DH
 # include <openssl/dh.h>
 #endif
+#ifndef OPENSSL_NO_RINGLWE
+# include <openssl/ringlwe.h>
+#endif
 
 #ifndef OPENSSL_NO_ENGINE
 # include <openssl/engine.h>
@@ -325,6 +328,27 @@ EC_KEY *EVP_PKEY_get1_EC_KEY(EVP_PKEY *pkey)
 }
 #endif
 
+#ifndef OPENSSL_NO_RINGLWE
+
+int EVP_PKEY_set1_RLWE(EVP_PKEY *pkey, RLWE_PAIR *key)
+{
+    int ret = EVP_PKEY_assign_RLWE(pkey, key);
+    if (ret)
+        RLWE_PAIR_up_ref(key);
+    return ret;
+}
+
+RLWE_PAIR *EVP_PKEY_get1_RLWE(EVP_PKEY *pkey)
+{
+    if (pkey->type != EVP_PKEY_RLWE) {
+        EVPerr(EVP_F_EVP_PKEY_GET1_RLWE, EVP_R_EXPECTING_A_RLWE_KEY);
+        return NULL;
+    }
+    RLWE_PAIR_up_ref(pkey->pkey.rlwe);
+    return pkey->pkey.rlwe;
+}
+#endif
+
 #ifndef OPENSSL_NO_DH
 
 int EVP_PKEY_set1_DH(EVP_PKEY *pkey, DH *key)
@@ -62,12 +62,12 @@
  * [including the GNU Public Licence.]
  */
 
-#define NUM_NID 967
-#define NUM_SN 960
-#define NUM_LN 960
-#define NUM_OBJ 899
+#define NUM_NID 968
+#define NUM_SN 961
+#define NUM_LN 961
+#define NUM_OBJ 900
 
-static const unsigned char lvalues[6282]={
+static const unsigned char lvalues[6285]={
 0x2A,0x86,0x48,0x86,0xF7,0x0D,               /* [  0] OBJ_rsadsi */
 0x2A,0x86,0x48,0x86,0xF7,0x0D,0x01,          /* [  6] OBJ_pkcs */
 0x2A,0x86,0x48,0x86,0xF7,0x0D,0x02,0x02,     /* [ 13] OBJ_md2 */
@@ -961,6 +961,7 @@ static const unsigned char lvalues[6282]={
 0x69,0xFF,0x07,                              /* [6272] OBJ_ringLearningWithErrors_433_35507 */
 0x69,0xFF,0x08,                              /* [6275] OBJ_ringLearningWithErrors_337_32353 */
 0x69,0xFF,0x09,                              /* [6278] OBJ_ringLearningWithErrors_256_15361 */
+0x69,0xFF,0x00,                              /* [6281] OBJ_ringLearningWithErrors */
 };
 
 static const ASN1_OBJECT nid_objs[NUM_NID]={
@@ -2541,6 +2542,8 @@ static const ASN1_OBJECT nid_objs[NUM_NID]={
 	NID_ringLearningWithErrors_337_32353,3,&(lvalues[6275]),0},
 {"ringlwe_256","ringLearningWithErrors_256_15361",
 	NID_ringLearningWithErrors_256_15361,3,&(lvalues[6278]),0},
+{"RLWE","ringLearningWithErrors",NID_ringLearningWithErrors,3,
+	&(lvalues[6281]),0},
 };
 
 static const unsigned int sn_objs[NUM_SN]={
@@ -2698,6 +2701,7 @@ static const unsigned int sn_objs[NUM_SN]={
 123,	/* "RC5-OFB" */
 117,	/* "RIPEMD160" */
 124,	/* "RLE" */
+967,	/* "RLWE" */
 19,	/* "RSA" */
  7,	/* "RSA-MD2" */
 396,	/* "RSA-MD4" */
@@ -4222,6 +4226,7 @@ static const unsigned int ln_objs[NUM_LN]={
 123,	/* "rc5-ofb" */
 870,	/* "registeredAddress" */
 460,	/* "rfc822Mailbox" */
+967,	/* "ringLearningWithErrors" */
 958,	/* "ringLearningWithErrors_1024_40961" */
 966,	/* "ringLearningWithErrors_256_15361" */
 965,	/* "ringLearningWithErrors_337_32353" */
@@ -4579,6 +4584,7 @@ static const unsigned int obj_objs[NUM_OBJ]={
 517,	/* OBJ_set_certExt                  2 23 42 7 */
 518,	/* OBJ_set_brand                    2 23 42 8 */
 679,	/* OBJ_wap_wsg                      2 23 43 1 */
+967,	/* OBJ_ringLearningWithErrors       2 25 21142102459391919581620496280350751738U 0 */
 958,	/* OBJ_ringLearningWithErrors_1024_40961 2 25 21142102459391919581620496280350751738U 1 */
 959,	/* OBJ_ringLearningWithErrors_821_49261 2 25 21142102459391919581620496280350751738U 2 */
 960,	/* OBJ_ringLearningWithErrors_739_47297 2 25 21142102459391919581620496280350751738U 3 */
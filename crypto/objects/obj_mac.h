@@ -4195,6 +4195,11 @@
 
 #define OBJ_ringlwe             2L,25L,21142102459391919581620496280350751738ULL
 
+#define SN_ringLearningWithErrors               "RLWE"
+#define LN_ringLearningWithErrors               "ringLearningWithErrors"
+#define NID_ringLearningWithErrors              967
+#define OBJ_ringLearningWithErrors              OBJ_ringlwe,0L
+
 #define SN_ringLearningWithErrors_1024_40961            "ringlwe_1024"
 #define LN_ringLearningWithErrors_1024_40961            "ringLearningWithErrors_1024_40961"
 #define NID_ringLearningWithErrors_1024_40961           958
@@ -8,68 +8,435 @@
  * See LICENSE for complete information.
  */
 
+/* Generated by util/ringlwe_fft.pl: do not edit. */
+
+/* Cyclic Number Theoretic Transform mod q, for the Bluestein and Rader
+convolutions of the prime-m parameter sets.
+	n = 1024, q = 17633281	*/
+
 #include "FFT_includes.h"
-#include "FFT_constants.h"
+
+#define GS(a, b, w) BFLY_GS(a, b, w, q, q2, qinv, MUL_MONT)
+#define GS1(a, b) BFLY_GS_1(a, b, q2)
+#define CT(a, b, w) BFLY_CT(a, b, w, q, q2, qinv, MUL_MONT)
+#define CT1(a, b) BFLY_CT_1(a, b, q2)
+
+/* The twiddle factors w^k in Montgomery form, in the order the stages
+read them */
+static const FFTSHORT W_fwd_1024_17633281[1020] = {
+	10080013, 1771462, 10080013, 1693007, 10982346, 16026167, 16026167, 8255857,
+	9402382, 14776544, 8668397, 7588149, 9402382, 2610559, 15729293, 332885,
+	13913582, 11036209, 7588149, 13116377, 11116619, 9324258, 14233956, 2866891,
+	15729293, 11260847, 10340382, 9811399, 8592681, 15335046, 11036209, 10855035,
+	15330476, 13276029, 4744039, 7060547, 11116619, 15230590, 7993219, 13761399,
+	16096927, 4099805, 2866891, 3618461, 7273222, 744155, 397138, 14045689,
+	10340382, 1901600, 11782217, 464283, 4838252, 5955417, 15335046, 8727106,
+	3204956, 8139963, 13390086, 1102994, 15330476, 6132001, 3060532, 14156069,
+	3957823, 9830108, 7060547, 83815, 16067398, 9496915, 11784118, 906584,
+	7993219, 14985803, 6705253, 15376693, 6312560, 16693031, 4099805, 15575927,
+	2766552, 11662038, 11892148, 16562048, 7273222, 1451884, 10123009, 13894610,
+	7954659, 14447774, 14045689, 1431600, 11631912, 12459893, 185504, 6119924,
+	11782217, 709661, 1005768, 6777188, 9509380, 2001169, 5955417, 12535441,
+	15272682, 14540727, 4036713, 1044687, 3204956, 12640814, 16863420, 10580615,
+	2172834, 7785169, 1102994, 7865784, 2886278, 8857381, 14752204, 653326,
+	3060532, 1084636, 1747654, 16331467, 5444029, 3263577, 9830108, 4342248,
+	5864303, 14666586, 3217851, 17457996, 16067398, 8807626, 1918162, 17010016,
+	11029708, 6950285, 906584, 8653582, 10291414, 5272757, 7567045, 7294847,
+	6705253, 11547682, 9982808, 4229573, 6848291, 4359243, 16693031, 2595240,
+	6629812, 11589343, 2733703, 8001839, 2766552, 832726, 14605463, 15366136,
+	2960760, 8986640, 16562048, 2819496, 17453847, 13945547, 11780123, 9384864,
+	10123009, 2920357, 7766169, 17577104, 645845, 3500109, 14447774, 43287,
+	3913598, 5966150, 11241246, 8595755, 11631912, 12649688, 14643726, 11102229,
+	8563942, 6741672, 6119924, 11824073, 7970330, 10858414, 856765, 15197438,
+	1005768, 3355857, 9559997, 2897849, 14561572, 16291820, 2001169, 10567421,
+	8989736, 10136507, 15099715, 15401171, 15272682, 13094283, 14934309, 6956527,
+	6802550, 1282347, 1044687, 11237750, 14438225, 9479086, 10437857, 16117642,
+	16863420, 1905707, 3407688, 10589391, 16571050, 12494752, 7785169, 4842245,
+	15218449, 3540018, 646171, 2441337, 2886278, 4113124, 8075835, 9917944,
+	13667819, 9241354, 653326, 11268880, 4040644, 1755064, 16222099, 5740472,
+	1747654, 17261822, 16928694, 1084522, 13774901, 5652239, 3263577, 5588669,
+	862430, 16583428, 5506981, 13835634, 5864303, 3779282, 9004707, 504279,
+	2624428, 1944050, 17457996, 1690623, 812803, 2946221, 435456, 10355903,
+	1918162, 11527370, 2834627, 8547772, 16795579, 3527569, 6950285, 4261195,
+	17374373, 4469632, 5901757, 10862871, 10291414, 100990, 4430875, 9874573,
+	9894424, 6387051, 7294847, 17609563, 10915727, 13902339, 15025271, 3332074,
+	9982808, 15041788, 7221653, 4487744, 15106401, 12445854, 4359243, 3312546,
+	1208515, 4381810, 8429688, 10854178, 6629812, 12559700, 3929358, 5359679,
+	16373595, 9719997, 8001839, 10658946, 9266582, 2369878, 16579783, 3808432,
+	14605463, 10392613, 17129267, 4900503, 255451, 10980150, 8986640, 8340007,
+	17095662, 3305691, 564740, 8952157, 17453847, 7919717, 14732183, 8971447,
+	1931190, 3704784, 9384864, 15196404, 12080658, 12057954, 14351143, 13010576,
+	7766169, 7056066, 9712860, 4552492, 3913004, 14613592, 3500109, 3468879,
+	9725402, 4283492, 13910498, 5523544, 3913598, 17237997, 17136086, 9261777,
+	149008, 10081432, 8595755, 5824742, 12146477, 11801196, 15982149, 925077,
+	14643726, 1927860, 208077, 15949147, 9972501, 170435, 6741672, 13688429,
+	13690849, 8159828, 5474591, 9473475, 7970330, 1737330, 9229145, 14085054,
+	6557138, 6143651, 15197438, 9607278, 9127324, 8761049, 16499085, 12801128,
+	9559997, 686463, 1771462, 12082224, 7875973, 8255857, 16291820, 15978148,
+	2610559, 5411083, 17589676, 13116377, 8989736, 12374598, 11260847, 14262671,
+	9431885, 10855035, 15401171, 7170873, 15230590, 9488641, 6776993, 3618461,
+	14934309, 7794101, 1901600, 15668130, 12277902, 8727106, 1282347, 17012456,
+	6132001, 3905070, 16330971, 83815, 14438225, 3746143, 14985803, 15434561,
+	11623700, 15575927, 16117642, 7783014, 1451884, 6328955, 11200042, 1431600,
+	3407688, 9076504, 709661, 5464608, 16016648, 12535441, 12494752, 9041612,
+	12640814, 12788663, 8810614, 7865784, 15218449, 9712255, 1084636, 13111442,
+	10773274, 4342248, 2441337, 17087876, 8807626, 111780, 6446596, 8653582,
+	8075835, 5411615, 11547682, 1752965, 7409658, 2595240, 9241354, 4159247,
+	832726, 2498960, 8928822, 2819496, 4040644, 1215511, 2920357, 14820184,
+	8446673, 43287, 5740472, 1158159, 12649688, 14366054, 10010520, 11824073,
+	16928694, 271369, 3355857, 610879, 13962253, 10567421, 5652239, 809638,
+	13094283, 5627551, 16114886, 11237750, 862430, 17033512, 1905707, 15499364,
+	6692990, 4842245, 13835634, 6644517, 4113124, 2799651, 3248941, 11268880,
+	9004707, 17229711, 17261822, 11361894, 9644779, 5588669, 1944050, 4620522,
+	3779282, 4710727, 450321, 1690623, 812803, 16498541, 11527370, 7974130,
+	4821222, 4261195, 10355903, 16483740, 100990, 968047, 9736127, 17609563,
+	2834627, 12923893, 15041788, 15961255, 6545952, 3312546, 3527569, 7563935,
+	12559700, 815575, 632283, 10658946, 17374373, 10094914, 10392613, 3187050,
+	16633416, 8340007, 10862871, 8538781, 7919717, 11699041, 12242356, 15196404,
+	4430875, 16786929, 7056066, 13305186, 14838072, 3468879, 6387051, 473597,
+	17237997, 2153148, 10343162, 5824742, 10915727, 2283645, 1927860, 3336314,
+	15041058, 13688429, 3332074, 14755513, 1737330, 810936, 15187551, 9607278,
+	7221653, 16714304, 686463, 17175335, 10123497, 15978148, 12445854, 13608669,
+	12374598, 4357767, 10615795, 7170873, 1208515, 17529808, 7794101, 16630092,
+	8815944, 17012456, 10854178, 6476975, 3746143, 3510830, 2090700, 7783014,
+	3929358, 9981777, 9076504, 10315214, 13847488, 9041612, 9719997, 15454187,
+	9712255, 5412262, 8207823, 17087876, 9266582, 10266560, 5411615, 15736403,
+	8121524, 4159247, 3808432, 15936260, 1215511, 6732291, 933780, 1158159,
+	17129267, 5107979, 271369, 15761977, 4894855, 809638, 10980150, 571202,
+	17033512, 17297174, 16436557, 6644517, 17095662, 5028199, 17229711, 3473941,
+	2538340, 4620522, 8952157, 7993158, 16498541, 16296739, 9260267, 16483740,
+	14732183, 15599603, 12923893, 6389073, 14624901, 7563935, 3704784, 7625218,
+	10094914, 7251357, 1247806, 8538781, 12080658, 14549342, 16786929, 5828711,
+	1548672, 473597, 13010576, 10177002, 2283645, 7292865, 9615966, 14755513,
+	9712860, 771265, 16714304, 12754941, 7911990, 13608669, 14613592, 8507171,
+	17529808, 9725754, 2845668, 6476975, 9725402, 12137658, 9981777, 8251827,
+	2791289, 15454187, 5523544, 11169083, 10266560, 8745352, 6562940, 15936260,
+	17136086, 17565325, 5107979, 14401861, 7868083, 571202, 10081432, 11702570,
+	5028199, 3776076, 12842294, 7993158, 12146477, 10851517, 15599603, 10605271,
+	10154670, 7625218, 925077, 2891437, 14549342, 1987549, 3411986, 10177002,
+	208077, 10332522, 771265, 10496963, 16251924, 8507171, 170435, 5510166,
+	12137658, 3901505, 3136245, 11169083, 13690849, 4317341, 17565325, 13401259,
+	5400776, 11702570, 9473475, 557140, 10851517, 2040489, 15378019, 2891437,
+	9229145, 12756691, 10332522, 2234480, 9415967, 5510166, 6143651, 1548627,
+	4317341, 7142093, 6532095, 557140, 9127324, 17232213, 12756691, 6143866,
+	14808861, 1548627, 12801128, 7882589, 17232213, 2127390, 6404316, 7882589,
+	10080013, 1771462, 10080013, 9402382, 2610559, 15729293, 15729293, 11260847,
+	10340382, 11116619, 15230590, 7993219, 10340382, 1901600, 11782217, 15330476,
+	6132001, 3060532, 7993219, 14985803, 6705253, 7273222, 1451884, 10123009,
+	11782217, 709661, 1005768, 3204956, 12640814, 16863420, 3060532, 1084636,
+	1747654, 16067398, 8807626, 1918162, 6705253, 11547682, 9982808, 2766552,
+	832726, 14605463, 10123009, 2920357, 7766169, 11631912, 12649688, 14643726,
+	1005768, 3355857, 9559997, 15272682, 13094283, 14934309, 16863420, 1905707,
+	3407688, 2886278, 4113124, 8075835, 1747654, 17261822, 16928694, 5864303,
+	3779282, 9004707, 1918162, 11527370, 2834627, 10291414, 100990, 4430875,
+	9982808, 15041788, 7221653, 6629812, 12559700, 3929358, 14605463, 10392613,
+	17129267, 17453847, 7919717, 14732183, 7766169, 7056066, 9712860, 3913598,
+	17237997, 17136086, 14643726, 1927860, 208077, 7970330, 1737330, 9229145,
+	9559997, 686463, 1771462, 8989736, 12374598, 11260847, 14934309, 7794101,
+	1901600, 14438225, 3746143, 14985803, 3407688, 9076504, 709661, 15218449,
+	9712255, 1084636, 8075835, 5411615, 11547682, 4040644, 1215511, 2920357,
+	16928694, 271369, 3355857, 862430, 17033512, 1905707, 9004707, 17229711,
+	17261822, 812803, 16498541, 11527370, 2834627, 12923893, 15041788, 17374373,
+	10094914, 10392613, 4430875, 16786929, 7056066, 10915727, 2283645, 1927860,
+	7221653, 16714304, 686463, 1208515, 17529808, 7794101, 3929358, 9981777,
+	9076504, 9266582, 10266560, 5411615, 17129267, 5107979, 271369, 17095662,
+	5028199, 17229711, 14732183, 15599603, 12923893, 12080658, 14549342, 16786929,
+	9712860, 771265, 16714304, 9725402, 12137658, 9981777, 17136086, 17565325,
+	5107979, 12146477, 10851517, 15599603, 208077, 10332522, 771265, 13690849,
+	4317341, 17565325, 9229145, 12756691, 10332522, 9127324, 17232213, 12756691,
+	10080013, 1771462, 10080013, 10340382, 1901600, 11782217, 11782217, 709661,
+	1005768, 6705253, 11547682, 9982808, 1005768, 3355857, 9559997, 1747654,
+	17261822, 16928694, 9982808, 15041788, 7221653, 7766169, 7056066, 9712860,
+	9559997, 686463, 1771462, 3407688, 9076504, 709661, 16928694, 271369,
+	3355857, 2834627, 12923893, 15041788, 7221653, 16714304, 686463, 17129267,
+	5107979, 271369, 9712860, 771265, 16714304, 208077, 10332522, 771265,
+	10080013, 1771462, 10080013, 1005768, 3355857, 9559997, 9559997, 686463,
+	1771462, 7221653, 16714304, 686463
+};
+
+static const FFTSHORT W_bwd_1024_17633281[1020] = {
+	10080013, 10080013, 15861819, 16946818, 918977, 10411628, 15861819, 16946818,
+	8073284, 8073284, 14277424, 16627513, 10080013, 10080013, 15861819, 16862016,
+	7300759, 17425204, 918977, 16862016, 7920421, 17361912, 12525302, 504014,
+	16946818, 918977, 10411628, 2591493, 4709388, 14798654, 14277424, 17361912,
+	704587, 16923620, 8556777, 14225593, 15861819, 16946818, 8073284, 7920421,
+	10577215, 9867112, 10411628, 2591493, 7650473, 704587, 371459, 15885627,
+	8073284, 14277424, 16627513, 7650473, 6085599, 10928028, 16627513, 16923620,
+	5851064, 5851064, 15731681, 7292899, 10080013, 10080013, 15861819, 4876590,
+	401068, 8505957, 7300759, 4876590, 8404136, 67956, 13315940, 3942432,
+	16862016, 7300759, 17425204, 2033678, 6781764, 5486804, 12525302, 67956,
+	497195, 7651504, 5495623, 7907879, 918977, 16862016, 7920421, 846352,
+	3083939, 5552623, 4709388, 2033678, 2901098, 403570, 12605082, 537619,
+	17361912, 12525302, 504014, 12221666, 7366721, 8366699, 8556777, 7651504,
+	13703923, 9839180, 103473, 16424766, 16946818, 918977, 10411628, 15705421,
+	15349636, 6717554, 10577215, 846352, 13202406, 7240668, 7538367, 258908,
+	2591493, 4709388, 14798654, 6105911, 1134740, 16820478, 371459, 403570,
+	8628574, 15727574, 599769, 16770851, 14277424, 17361912, 704587, 14712924,
+	16417770, 13592637, 6085599, 12221666, 9557446, 16548645, 7921026, 2414832,
+	16923620, 8556777, 14225593, 2647478, 13887138, 3195056, 15731681, 9839180,
+	2698972, 6372434, 5258683, 8643545, 15861819, 16946818, 8073284, 8404136,
+	15895951, 9662951, 17425204, 15705421, 2989555, 497195, 395284, 13719683,
+	7920421, 10577215, 9867112, 2901098, 9713564, 179434, 504014, 7240668,
+	3027818, 13703923, 5073581, 11003469, 10411628, 2591493, 7650473, 13202406,
+	17532291, 7341867, 14798654, 6105911, 15715119, 8628574, 13853999, 11768978,
+	704587, 371459, 15885627, 9557446, 13520157, 14747003, 14225593, 15727574,
+	769861, 2698972, 4538998, 2360599, 8073284, 14277424, 16627513, 2989555,
+	4983593, 6001369, 9867112, 14712924, 7510272, 3027818, 16800555, 14866729,
+	7650473, 6085599, 10928028, 15715119, 8825655, 1565883, 15885627, 16548645,
+	14572749, 769861, 4992467, 14428325, 16627513, 16923620, 5851064, 7510272,
+	16181397, 10360059, 10928028, 2647478, 9640062, 14572749, 11501280, 2302805,
+	5851064, 15731681, 7292899, 9640062, 2402691, 6516662, 7292899, 6372434,
+	1903988, 1903988, 15022722, 8230899, 10080013, 10080013, 15861819, 9750692,
+	11228965, 15505891, 401068, 9750692, 4832153, 16084654, 2824420, 11489415,
+	4876590, 401068, 8505957, 17076141, 11101186, 10491188, 13315940, 16084654,
+	11489630, 12123115, 8217314, 15398801, 7300759, 4876590, 8404136, 14741844,
+	2255262, 15592792, 6781764, 17076141, 8159806, 5930711, 12232505, 4232022,
+	67956, 13315940, 3942432, 6464198, 14497036, 13731776, 5495623, 12123115,
+	17462846, 9126110, 1381357, 7136318, 16862016, 7300759, 17425204, 7456279,
+	14221295, 15645732, 3083939, 14741844, 16708204, 10008063, 7478611, 7028010,
+	2033678, 6781764, 5486804, 9640123, 4790987, 13857205, 12605082, 5930711,
+	7551849, 17062079, 9765198, 3231420, 12525302, 67956, 497195, 1697021,
+	11070341, 8887929, 7366721, 6464198, 12109737, 2179094, 14841992, 9381454,
+	7651504, 5495623, 7907879, 11156306, 14787613, 7907527, 103473, 9126110,
+	3019689, 4024612, 9721291, 4878340, 918977, 16862016, 7920421, 2877768,
+	8017315, 10340416, 15349636, 7456279, 4622705, 17159684, 16084609, 11804570,
+	846352, 3083939, 5552623, 9094500, 16385475, 10381924, 7538367, 10008063,
+	13928497, 10069346, 3008380, 11244208, 4709388, 2033678, 2901098, 1149541,
+	8373014, 1336542, 1134740, 9640123, 8681124, 13012759, 15094941, 14159340,
+	403570, 12605082, 537619, 10988764, 1196724, 336107, 599769, 17062079,
+	6653131, 16823643, 12738426, 1871304, 17361912, 12525302, 504014, 16475122,
+	16699501, 10900990, 16417770, 1697021, 13824849, 13474034, 9511757, 1896878,
+	12221666, 7366721, 8366699, 545405, 9425458, 12221019, 7921026, 2179094,
+	7913284, 8591669, 3785793, 7318067, 8556777, 7651504, 13703923, 9850267,
+	15542581, 14122451, 13887138, 11156306, 6779103, 620825, 8817337, 1003189,
+	9839180, 103473, 16424766, 10462408, 7017486, 13275514, 5258683, 4024612,
+	5187427, 1655133, 7509784, 457946, 16946818, 918977, 10411628, 8026003,
+	2445730, 16822345, 15895951, 2877768, 14301207, 3944852, 2592223, 14296967,
+	15705421, 15349636, 6717554, 11808539, 7290119, 15480133, 395284, 17159684,
+	11246230, 14164402, 2795209, 4328095, 10577215, 846352, 13202406, 2436877,
+	5390925, 5934240, 9713564, 9094500, 6770410, 9293274, 999865, 14446231,
+	7240668, 7538367, 258908, 6974335, 17000998, 16817706, 5073581, 10069346,
+	14105712, 14320735, 11087329, 1672026, 2591493, 4709388, 14798654, 23718,
+	7897154, 16665234, 17532291, 1149541, 7277378, 13372086, 12812059, 9659151,
+	6105911, 1134740, 16820478, 15942658, 17182960, 12922554, 13853999, 13012759,
+	15689231, 12044612, 7988502, 6271387, 371459, 403570, 8628574, 6364401,
+	14384340, 14833630, 13520157, 10988764, 3797647, 12791036, 10940291, 2133917,
+	15727574, 599769, 16770851, 6395531, 1518395, 12005730, 4538998, 16823643,
+	11981042, 7065860, 3671028, 17022402, 14277424, 17361912, 704587, 5809208,
+	7622761, 3267227, 4983593, 16475122, 11892809, 17589994, 9186608, 2813097,
+	14712924, 16417770, 13592637, 14813785, 8704459, 15134321, 16800555, 13474034,
+	8391927, 15038041, 10223623, 15880316, 6085599, 12221666, 9557446, 8979699,
+	11186685, 17521501, 8825655, 545405, 15191944, 13291033, 6860007, 4521839,
+	16548645, 7921026, 2414832, 9767497, 8822667, 4844618, 4992467, 8591669,
+	5138529, 5097840, 1616633, 12168673, 16923620, 8556777, 14225593, 16201681,
+	6433239, 11304326, 16181397, 9850267, 1515639, 2057354, 6009581, 2198720,
+	2647478, 13887138, 3195056, 17549466, 1302310, 13728211, 11501280, 620825,
+	16350934, 8906175, 5355379, 1965151, 15731681, 9839180, 2698972, 14014820,
+	10856288, 8144640, 2402691, 10462408, 2232110, 6778246, 8201396, 3370610,
+	6372434, 5258683, 8643545, 4516904, 43605, 12222198, 15022722, 1655133,
+	1341461, 9377424, 9757308, 5551057, 15861819, 16946818, 8073284, 4832153,
+	1134196, 8872232, 8505957, 8026003, 2435843, 11489630, 11076143, 3548227,
+	8404136, 15895951, 9662951, 8159806, 12158690, 9473453, 3942432, 3944852,
+	10891609, 17462846, 7660780, 1684134, 17425204, 15705421, 2989555, 16708204,
+	1651132, 5832085, 5486804, 11808539, 9037526, 7551849, 17484273, 8371504,
+	497195, 395284, 13719683, 12109737, 3722783, 13349789, 7907879, 14164402,
+	14133172, 3019689, 13720277, 13080789, 7920421, 10577215, 9867112, 4622705,
+	3282138, 5575327, 5552623, 2436877, 8248417, 13928497, 15702091, 8661834,
+	2901098, 9713564, 179434, 8681124, 17068541, 14327590, 537619, 9293274,
+	8646641, 6653131, 17377830, 12732778, 504014, 7240668, 3027818, 13824849,
+	1053498, 15263403, 8366699, 6974335, 9631442, 7913284, 1259686, 12273602,
+	13703923, 5073581, 11003469, 6779103, 9203593, 13251471, 16424766, 14320735,
+	13274038, 5187427, 2526880, 13145537, 10411628, 2591493, 7650473, 14301207,
+	2608010, 3730942, 6717554, 23718, 10338434, 11246230, 7738857, 7758708,
+	13202406, 17532291, 7341867, 6770410, 11731524, 13163649, 258908, 13372086,
+	10682996, 14105712, 837702, 9085509, 14798654, 6105911, 15715119, 7277378,
+	17197825, 14687060, 16820478, 15942658, 175285, 15689231, 15008853, 17129002,
+	8628574, 13853999, 11768978, 3797647, 12126300, 1049853, 16770851, 12044612,
+	14369704, 11981042, 3858380, 16548759, 704587, 371459, 15885627, 11892809,
+	1411182, 15878217, 13592637, 6364401, 16979955, 8391927, 3965462, 7715337,
+	9557446, 13520157, 14747003, 15191944, 16987110, 14093263, 2414832, 12791036,
+	9848112, 5138529, 1062231, 7043890, 14225593, 15727574, 769861, 1515639,
+	7195424, 8154195, 3195056, 6395531, 16588594, 16350934, 10830731, 10676754,
+	2698972, 4538998, 2360599, 2232110, 2533566, 7496774, 8643545, 7065860,
+	15632112, 1341461, 3071709, 14735432, 8073284, 14277424, 16627513, 2435843,
+	16776516, 6774867, 9662951, 5809208, 11513357, 10891609, 9069339, 6531052,
+	2989555, 4983593, 6001369, 9037526, 6392035, 11667131, 13719683, 17589994,
+	3185507, 14133172, 16987436, 56177, 9867112, 14712924, 7510272, 8248417,
+	5853158, 3687734, 179434, 14813785, 1071233, 8646641, 14672521, 2267145,
+	3027818, 16800555, 14866729, 9631442, 14899578, 6043938, 11003469, 15038041,
+	940250, 13274038, 10784990, 13403708, 7650473, 6085599, 10928028, 10338434,
+	10066236, 12360524, 7341867, 8979699, 16726697, 10682996, 6603573, 623265,
+	15715119, 8825655, 1565883, 175285, 14415430, 2966695, 11768978, 13291033,
+	7803173, 14369704, 12189252, 1301814, 15885627, 16548645, 14572749, 16979955,
+	2881077, 8775900, 14747003, 9767497, 16530287, 9848112, 15460447, 7052666,
+	769861, 4992467, 14428325, 16588594, 13596568, 3092554, 2360599, 5097840,
+	11677864, 15632112, 8123901, 10856093, 16627513, 16923620, 5851064, 11513357,
+	17447777, 5173388, 6001369, 16201681, 3587592, 3185507, 9678622, 3738671,
+	7510272, 16181397, 10360059, 1071233, 5741133, 5971243, 14866729, 2057354,
+	13533476, 940250, 11320721, 2256588, 10928028, 2647478, 9640062, 16726697,
+	5849163, 8136366, 1565883, 17549466, 10572734, 7803173, 13675458, 3477212,
+	14572749, 11501280, 2302805, 16530287, 4243195, 9493318, 14428325, 8906175,
+	2298235, 11677864, 12795029, 17168998, 5851064, 15731681, 7292899, 3587592,
+	17236143, 16889126, 10360059, 14014820, 14766390, 13533476, 1536354, 3871882,
+	9640062, 2402691, 6516662, 10572734, 12889242, 4357252, 2302805, 6778246,
+	6597072, 2298235, 9040600, 7821882, 7292899, 6372434, 1903988, 14766390,
+	3399325, 8309023, 6516662, 4516904, 10045132, 6597072, 3719699, 17300396,
+	1903988, 15022722, 8230899, 10045132, 8964884, 2856737, 8230899, 9377424,
+	1607114, 1607114, 6650935, 15940274
+};
 
 /*
-We use Gentleman-Sande, decimation-in-frequency FFT, for the forward FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will invert 
-the fourier transform using decimation-in-time.
+Gentleman-Sande, decimation-in-frequency FFT, leaving the output in
+bit-reversed order for FFT_backward_1024_17633281.
+Coefficients are kept lazily reduced in [0, 2q), both on input and on output.
 */
 void FFT_forward_1024_17633281(FFTSHORT x[1024]) {
-        const FFTSHORT n = 1024;
-        const FFTSHORT q = 17633281;
-
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = 1;
-	for (m = n>>1; m >= 1; m=m>>1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {
-				ADD_MOD(t0, x[i], x[i+m], q);
-				ADD(t1, x[i], q - x[i+m]);
-				MUL_MOD(x[i+m], t1, W_1024_17633281[index], q);				
-				x[i] = t0;				
-			}
-                        SUB_MODn(index, index, step, n);
+	const FFTSHORT q = 17633281, q2 = 2*17633281, qinv = 1611468799U;
+	const FFTSHORT *w = W_fwd_1024_17633281;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_forward_1024_17633281_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layers m = 512, 256 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		a0 = x[j]; a1 = x[j+256]; a2 = x[j+512]; a3 = x[j+768];
+		GS(a0, a2, w[0]);
+		GS(a1, a3, w[1]);
+		GS(a0, a1, w[2]);
+		GS(a2, a3, w[2]);
+		x[j] = a0; x[j+256] = a1; x[j+512] = a2; x[j+768] = a3;
+	}
+
+	/* Layers m = 128, 64 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 32, 16 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 8, 4 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
 		}
-		step = step << 1;
-	}	 
+	}
+
+	/* Layers m = 2, 1 */
+	for (i = 0; i < 1024; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		GS1(a0, a2);
+		GS(a1, a3, 1771462);
+		GS1(a0, a1);
+		GS1(a2, a3);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
 }
 
 /*
-We use Cooley-Tukey, decimation-in-time FFT, for the inverse FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will the forward
-fourier transform is using decimation-in-frequency.
+Cooley-Tukey, decimation-in-time FFT, inverting FFT_forward_1024_17633281 up to
+the factor n.
+The output is lazily reduced to [0, 2q); callers finish the reduction.
 */
 void FFT_backward_1024_17633281(FFTSHORT x[1024]) {
-        const FFTSHORT n = 1024;
-        const FFTSHORT q = 17633281;
-
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = n>>1;
-	for (m = 1; m < n; m=m<<1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {							
-				t0 = x[i];
-				t0 -= (t0 >= q) ? q : 0;
-				MUL_MOD(t1, x[i+m], W_rev_1024_17633281[index], q);				
-				ADD(x[i], t0, t1);
-				ADD(x[i+m], t0, q - t1);
-				
-			}
-                        SUB_MODn(index, index, step, n);
+	const FFTSHORT q = 17633281, q2 = 2*17633281, qinv = 1611468799U;
+	const FFTSHORT *w = W_bwd_1024_17633281;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_backward_1024_17633281_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 1024; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 15861819);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
 		}
-		step = step >> 1;
-	}	
-	for (i = 0; i < n; ++i) {
-		x[i] -= (x[i] >= q) ? q : 0;
+	}
+
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 256, 512 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		a0 = x[j]; a1 = x[j+256]; a2 = x[j+512]; a3 = x[j+768];
+		CT(a0, a1, w[0]);
+		CT(a2, a3, w[0]);
+		CT(a0, a2, w[1]);
+		CT(a1, a3, w[2]);
+		x[j] = a0; x[j+256] = a1; x[j+512] = a2; x[j+768] = a3;
 	}
 }
@@ -8,164 +8,792 @@
  * See LICENSE for complete information.
  */
 
-/* Code to compute a Number Theoretic Transform for multiplication in the ring 
+/* Generated by util/ringlwe_fft.pl: do not edit. */
+
+/* Code to compute a Number Theoretic Transform for multiplication in the ring
 F_q[x] / <x^n+1>.
 	n = 1024, q = 40961	*/
 
 #include "FFT_includes.h"
-#include "FFT_constants.h"
+
+#define GS(a, b, w) BFLY_GS(a, b, w, q, q, qinv, MUL_MONT_RED)
+#define GS1(a, b) BFLY_GS_1(a, b, q)
+#define CT(a, b, w) BFLY_CT(a, b, w, q, q, qinv, MUL_MONT_RED)
+#define CT1(a, b) BFLY_CT_1(a, b, q)
+
+/* The twiddle factors w^k in Montgomery form, in the order the stages
+read them, with the twist psi^k by the 2n'th root interleaved into the
+first forward stage and psi^-k * n^-1 into the last backward stage */
+static const RINGELT W_fwd_1024_40961[2044] = {
+	1641, 35705, 18482, 35231, 1641, 22479, 1641, 18498,
+	2381, 11469, 30885, 39978, 1586, 23528, 24679, 35526,
+	1982, 16566, 23528, 14376, 3906, 2622, 13318, 8189,
+	6570, 33357, 24936, 6505, 4096, 28366, 38319, 7264,
+	3906, 25200, 38277, 22958, 227, 40833, 17034, 14434,
+	630, 11365, 40957, 28693, 17203, 3833, 6505, 10256,
+	36744, 17178, 9080, 35841, 25984, 15523, 24833, 17841,
+	40801, 812, 32744, 30437, 38277, 7789, 18418, 31744,
+	35512, 5, 15335, 4029, 11459, 11839, 34561, 32480,
+	39969, 29611, 11365, 21791, 33, 40930, 27806, 200,
+	39946, 36125, 9761, 31924, 30727, 29409, 1281, 37532,
+	36744, 40181, 18350, 39721, 6293, 8000, 361, 17303,
+	20461, 21772, 250, 29452, 10279, 26684, 17841, 19968,
+	24283, 32322, 5954, 33273, 14440, 40383, 33268, 25539,
+	10000, 31172, 1550, 2374, 18418, 13120, 17962, 23089,
+	33355, 20168, 4146, 22989, 328, 39897, 31351, 18050,
+	21039, 13038, 11839, 32777, 10854, 22418, 23448, 28461,
+	1996, 1320, 24372, 25249, 25210, 25663, 22340, 29988,
+	33, 29282, 25386, 36539, 36778, 32493, 38879, 7169,
+	39645, 30071, 25336, 2495, 33419, 11651, 31924, 36832,
+	33018, 27925, 37485, 29929, 39603, 37663, 9113, 6728,
+	30376, 17878, 26008, 15469, 18350, 7396, 24376, 11053,
+	24804, 9291, 27602, 10699, 4281, 14966, 27171, 18783,
+	16295, 4345, 21772, 40044, 10096, 32510, 9096, 2991,
+	39094, 29217, 37866, 11885, 21854, 14022, 37385, 9956,
+	24283, 15283, 23432, 30609, 36152, 37718, 7242, 38496,
+	38271, 22748, 13979, 28387, 20804, 29591, 25539, 10173,
+	23874, 36491, 12445, 34124, 2953, 22143, 27903, 19625,
+	26667, 29533, 12940, 36732, 17962, 18106, 30093, 26005,
+	6268, 13247, 36198, 39362, 14789, 40647, 1694, 34412,
+	26068, 35645, 39897, 11634, 32615, 16175, 4954, 38348,
+	14285, 24550, 6435, 25237, 26799, 24767, 18695, 33126,
+	10854, 5281, 17501, 32585, 34316, 18363, 38907, 26896,
+	40069, 27122, 6974, 7616, 10502, 14288, 25249, 12266,
+	10206, 33609, 20927, 38183, 40723, 32376, 14643, 9069,
+	33194, 17913, 10470, 39027, 25386, 38255, 29984, 33608,
+	17860, 11763, 31441, 14971, 26557, 27053, 17008, 20183,
+	9190, 4562, 30071, 3736, 36549, 33568, 18063, 19949,
+	28810, 9968, 24670, 22833, 24944, 29061, 39912, 18636,
+	33018, 10857, 21698, 31968, 26183, 19701, 5492, 23354,
+	23824, 9793, 14696, 15532, 39962, 8142, 6728, 16980,
+	27834, 8929, 23295, 9781, 14875, 32937, 20905, 171,
+	14386, 6865, 1001, 38953, 24376, 15883, 20199, 29472,
+	30658, 22591, 21546, 25186, 38286, 31783, 1986, 28834,
+	40040, 1602, 14966, 35774, 38344, 31972, 38451, 2498,
+	1659, 35191, 27519, 17842, 38479, 6452, 4121, 23119,
+	10096, 1712, 2008, 9089, 22483, 17998, 25399, 24829,
+	8235, 22325, 23603, 12314, 996, 23618, 11885, 5326,
+	1934, 35872, 39139, 23583, 32896, 36138, 34950, 7835,
+	2017, 1028, 39840, 2617, 23432, 11114, 4229, 1245,
+	9042, 1217, 5088, 8778, 6422, 31005, 39719, 159,
+	37082, 22758, 22748, 18593, 25492, 8839, 33992, 7719,
+	39676, 12857, 7633, 10973, 32242, 6360, 8684, 9178,
+	23874, 7359, 38587, 25872, 7967, 22033, 30522, 6741,
+	1208, 3429, 19889, 8634, 19672, 39432, 19625, 32799,
+	10524, 10855, 31953, 21139, 33011, 15851, 1844, 33697,
+	17301, 17672, 8621, 20762, 30093, 36911, 5730, 24590,
+	8329, 26340, 9688, 28401, 10139, 17156, 36664, 10543,
+	17152, 11260, 40647, 21758, 35954, 536, 5472, 29575,
+	18871, 34809, 2592, 38065, 32925, 12110, 30704, 40790,
+	32615, 8257, 8600, 21440, 14075, 36092, 17542, 26416,
+	23759, 25606, 6248, 33829, 40291, 34121, 25237, 1618,
+	24439, 38380, 30507, 10045, 5343, 3703, 22569, 5161,
+	4154, 1447, 14161, 13127, 17501, 32309, 15338, 19643,
+	32411, 33151, 8915, 19894, 12072, 8765, 2316, 16919,
+	33947, 33548, 27122, 8494, 21382, 7461, 26649, 15288,
+	28912, 39591, 26837, 34267, 10718, 21384, 6167, 31168,
+	10206, 3743, 32099, 11713, 974, 38066, 9572, 35072,
+	17502, 13870, 19110, 36140, 914, 17890, 9069, 18870,
+	13577, 17949, 38960, 7083, 14231, 11491, 10712, 29270,
+	27102, 11965, 36560, 19263, 29984, 8460, 28947, 21623,
+	1882, 37554, 36747, 17134, 20692, 4447, 19094, 28029,
+	28765, 33222, 27053, 29190, 17232, 4739, 34319, 27564,
+	36245, 28325, 10970, 17624, 26462, 15213, 3692, 18128,
+	36549, 30995, 15781, 25716, 21047, 37574, 16165, 12178,
+	5895, 30193, 34455, 35066, 24797, 28783, 22833, 25748,
+	38087, 4615, 22660, 28364, 32185, 7739, 12932, 16229,
+	26487, 9966, 8816, 4412, 21698, 28996, 10532, 20756,
+	5258, 28613, 17609, 23071, 4821, 25300, 35455, 29991,
+	24952, 12636, 9793, 19577, 7696, 11020, 5515, 38573,
+	8023, 7413, 24042, 32364, 25526, 11771, 15016, 13908,
+	27834, 39514, 7086, 31190, 15795, 27363, 34193, 6840,
+	7132, 7019, 37976, 20269, 27186, 23827, 171, 28851,
+	542, 18770, 17385, 29534, 16007, 29701, 30418, 35278,
+	3483, 32501, 22454, 10977, 20199, 23289, 30794, 13502,
+	40024, 34452, 25865, 1529, 32327, 6317, 16437, 30249,
+	37979, 29470, 31783, 34601, 10321, 7587, 3481, 26367,
+	10575, 18203, 40802, 6125, 2104, 22091, 3603, 31892,
+	38344, 39933, 7044, 16753, 16357, 30655, 13390, 17343,
+	28647, 40863, 2238, 23459, 21237, 5889, 17842, 34509,
+	10701, 14744, 39865, 38331, 3107, 39359, 12127, 37358,
+	7598, 37218, 30260, 30755, 2008, 34096, 18507, 16306,
+	38082, 17683, 1397, 32819, 25429, 25945, 17193, 14124,
+	22531, 1370, 22325, 11900, 32145, 37825, 7723, 10983,
+	14919, 36399, 20778, 37269, 32344, 32467, 98, 13839,
+	1934, 23048, 4401, 38404, 22193, 29710, 23306, 26673,
+	33345, 34794, 23969, 28889, 3920, 21067, 7835, 16194,
+	26800, 20603, 27539, 531, 31098, 5316, 6549, 10257,
+	16657, 8652, 33917, 23460, 4229, 11428, 32340, 4900,
+	36574, 21240, 15090, 11370, 12574, 32277, 10904, 18392,
+	4967, 37258, 31005, 26939, 1121, 32156, 29325, 30380,
+	30146, 36616, 22178, 36840, 26550, 39343, 34836, 15724,
+	25492, 23083, 39960, 16449, 26092, 27331, 17971, 29310,
+	38466, 1049, 37975, 17202, 766, 14545, 10973, 15298,
+	30491, 2584, 19655, 28254, 22503, 27923, 22911, 22266,
+	3443, 32704, 30640, 8346, 38587, 9789, 28021, 21438,
+	7941, 24213, 39939, 14277, 11509, 3576, 14837, 38369,
+	37731, 6152, 3429, 11552, 14953, 38300, 30913, 26417,
+	81, 11350, 8481, 18621, 20026, 19203, 34644, 314,
+	10524, 40149, 39411, 16443, 7690, 32655, 3240, 37128,
+	12268, 39680, 22781, 30822, 34047, 12560, 33697, 12595,
+	8217, 2344, 20873, 36409, 6717, 24395, 5435, 2642,
+	10098, 4050, 10167, 10868, 5730, 5256, 22479, 11838,
+	15700, 22725, 22914, 30864, 24708, 14376, 35271, 39117,
+	38031, 25110, 17156, 12906, 25200, 22949, 13585, 7858,
+	15418, 4525, 14659, 10256, 18166, 8162, 5683, 21336,
+	35954, 21871, 7789, 16818, 10907, 27593, 2305, 7043,
+	9763, 21791, 30303, 39753, 22515, 34220, 38065, 38133,
+	40181, 17344, 26670, 38734, 10278, 16312, 28602, 19968,
+	24251, 33602, 40419, 17087, 8600, 39628, 13120, 38384,
+	1814, 33803, 1510, 215, 13279, 32777, 27937, 33328,
+	19281, 28104, 25606, 1356, 29282, 19803, 31599, 407,
+	19439, 35457, 4130, 36832, 11533, 22368, 33942, 18213,
+	24439, 30824, 7396, 13861, 35130, 16280, 40262, 1635,
+	17155, 40044, 10749, 34539, 5967, 32183, 5161, 5549,
+	15283, 21947, 12526, 36785, 13001, 40066, 11403, 10173,
+	20350, 29847, 33875, 17529, 15338, 38174, 18106, 17699,
+	9508, 37765, 28508, 22912, 27579, 11634, 35741, 6011,
+	3287, 4823, 8765, 22194, 5281, 11623, 11671, 36004,
+	34373, 36060, 6699, 12266, 36966, 35635, 8597, 29076,
+	21382, 21672, 38255, 14349, 16269, 6525, 23207, 18967,
+	8734, 3736, 4044, 32726, 16192, 16132, 34267, 26843,
+	10857, 506, 36345, 15234, 27138, 14169, 38560, 16980,
+	38877, 39249, 33265, 30865, 32099, 964, 15883, 20240,
+	20165, 35906, 20534, 22307, 36889, 35774, 39523, 13442,
+	19848, 5770, 13870, 32667, 1712, 31341, 28341, 2605,
+	2140, 10587, 14129, 5326, 24402, 5187, 15661, 25995,
+	13577, 32098, 11114, 24810, 27693, 22278, 3678, 23892,
+	23331, 18593, 33977, 2675, 12025, 15775, 29270, 30280,
+	7359, 9336, 1773, 30939, 24237, 10972, 757, 32799,
+	7367, 25078, 30429, 16585, 28947, 3091, 36911, 4791,
+	29959, 8730, 27377, 14036, 29774, 21758, 7953, 20056,
+	29291, 8024, 4447, 27369, 8257, 27796, 10491, 21512,
+	30094, 33904, 32429, 1618, 31393, 23981, 24732, 34233,
+	17232, 12075, 32309, 5893, 10030, 299, 15891, 8623,
+	5422, 8494, 26890, 17137, 6216, 17607, 17624, 18568,
+	3743, 30915, 32551, 11960, 21225, 16825, 33233, 18870,
+	10614, 30104, 2874, 7943, 15781, 7999, 8460, 7770,
+	32249, 27829, 29780, 19851, 1224, 29190, 14950, 16291,
+	33038, 30993, 30193, 16415, 30995, 24073, 20169, 7213,
+	3331, 7923, 26011, 25748, 24546, 37225, 10768, 10890,
+	38087, 30347, 28996, 20817, 28501, 1793, 10357, 34745,
+	14071, 19577, 39737, 14404, 21110, 25990, 16229, 9568,
+	39514, 13460, 34093, 30759, 4670, 11670, 33008, 28851,
+	32962, 2706, 25180, 15575, 10532, 33594, 23289, 5907,
+	12007, 1530, 22956, 28936, 6984, 34601, 7728, 26318,
+	24136, 8585, 25300, 16559, 39933, 31475, 29709, 20239,
+	17098, 21113, 1438, 34509, 22393, 28695, 23337, 15712,
+	7696, 2084, 34096, 30170, 491, 31301, 28544, 24769,
+	36917, 11900, 35539, 892, 32338, 14065, 32364, 3995,
+	23048, 18931, 19640, 23210, 35813, 37674, 5220, 16194,
+	28886, 35680, 23729, 30107, 7086, 20611, 11428, 19942,
+	7341, 27258, 39846, 34994, 30212, 26939, 8532, 34526,
+	7057, 16411, 7019, 29428, 23083, 19421, 6913, 25334,
+	37322, 21680, 13024, 15298, 13592, 29327, 36514, 1064,
+	542, 16710, 9789, 39542, 30754, 30296, 18284, 18446,
+	10658, 11552, 11187, 26172, 26925, 1599, 35278, 22795,
+	40149, 25162, 1330, 23971, 35023, 2930, 5690, 12595,
+	37870, 22855, 12014, 22999, 30794, 30863, 5256, 23416,
+	12239, 16737, 8246, 6914, 18180, 12906, 40204, 13058,
+	29989, 18818, 6317, 20935, 21871, 35498, 38989, 14104,
+	2152, 3230, 26124, 38133, 10681, 30788, 11691, 15422,
+	10321, 37518, 39628, 27246, 3042, 31667, 4158, 40195,
+	2986, 1356, 17630, 2690, 17069, 2465, 6125, 14411,
+	30824, 24854, 39758, 37850, 2476, 35994, 30057, 5549,
+	8863, 25678, 27384, 16678, 7044, 24304, 38174, 11096,
+	33802, 39404, 17118, 37041, 16992, 22194, 26832, 3095,
+	30374, 11744, 40863, 8617, 21672, 34230, 367, 19642,
+	29344, 18430, 23768, 26843, 8294, 917, 27091, 19189,
+	10701, 33363, 964, 17487, 14680, 7421, 26852, 19724,
+	38723, 32667, 4072, 36680, 18654, 30262, 37358, 38857,
+	32098, 3143, 13746, 10113, 9094, 2982, 24524, 30280,
+	39997, 33565, 8862, 22611, 18507, 37478, 3091, 2837,
+	17347, 35871, 36072, 13775, 2985, 27369, 2401, 31848,
+	26792, 3298, 25945, 15435, 12075, 31558, 38504, 1205,
+	9245, 16009, 5506, 18568, 14118, 4129, 6694, 9037,
+	32145, 14474, 7999, 33490, 24603, 7239, 1151, 16164,
+	6506, 16415, 32227, 1316, 21994, 33792, 37269, 14499,
+	30347, 28848, 1056, 2833, 5079, 12196, 21867, 9568,
+	19289, 11679, 19579, 40928, 4401, 13859, 33594, 7012,
+	1279, 31398, 39316, 40047, 21851, 16559, 34262, 16589,
+	4901, 39641, 34794, 30243, 2084, 34714, 10199, 27090,
+	16122, 7014, 38645, 3995, 18767, 8184, 32196, 29122,
+	26800, 36807, 20611, 36847, 39311, 18614, 30465, 670,
+	34713, 29428, 13382, 40633, 18049, 17972, 10257, 8036,
+	16710, 40245, 15922, 7262, 30731, 23809, 4297, 22795,
+	2787, 27841, 25623, 22543, 32340, 23660, 30863, 12321,
+	22465, 3753, 410, 21289, 21072, 20935, 29558, 7693,
+	895, 578, 32277, 8719, 37518, 1308, 38419, 27237,
+	16400, 3879, 1242, 14411, 35412, 20993, 35800, 23120,
+	1121, 38944, 24304, 11359, 21203, 24494, 624, 39965,
+	17358, 8617, 23806, 20500, 39326, 23658, 36840, 2482,
+	33363, 3789, 28900, 37657, 24960, 921, 38975, 38857,
+	10137, 780, 16522, 4217, 39960, 26575, 37478, 28677,
+	9092, 31684, 15336, 999, 26265, 15435, 36831, 31200,
+	5504, 4836, 1049, 16017, 14474, 172, 35992, 38530,
+	39986, 31771, 23953, 14499, 39605, 19170, 15355, 29596,
+	30491, 7767, 13859, 6880, 6045, 25643, 1961, 30459,
+	33987, 30243, 27682, 29502, 40746, 36932, 22266, 14162,
+	36807, 29434, 36995, 1695, 37479, 14893, 39267, 8036,
+	1333, 33172, 32361, 2684, 28021, 14294, 23660, 30452,
+	5204, 26839, 24564, 20157, 26982, 8719, 12359, 16128,
+	24649, 25438, 3576, 19107, 38944, 30211, 3355, 8574,
+	40457, 24666, 13790, 2482, 2828, 30705, 2896, 34456,
+	14953, 10585, 26575, 20571, 11317, 15272, 20801, 7542,
+	15625, 16017, 31198, 40331, 33918, 26527, 18621, 15751,
+	7767, 3620, 2109, 37426, 12820, 19922, 9610, 14162,
+	19090, 15761, 5007, 37055, 39411, 30961, 14294, 21917,
+	2438, 22444, 21268, 30682, 40711, 19107, 26302, 16025,
+	36436, 7604, 39680, 10234, 10585, 16499, 15598, 37579,
+	31500, 992, 6400, 15751, 28055, 26585, 23805, 17433,
+	8217, 160, 30961, 4584, 9505, 28564, 31170, 23758,
+	4, 10234, 16253, 39375, 10097, 983, 2642, 36865,
+	160, 19516, 11551, 36613, 17970, 38979, 16282, 36865,
+	1641, 22479, 1641, 3906, 25200, 38277, 38277, 7789,
+	18418, 36744, 40181, 18350, 18418, 13120, 17962, 33,
+	29282, 25386, 18350, 7396, 24376, 24283, 15283, 23432,
+	17962, 18106, 30093, 10854, 5281, 17501, 25386, 38255,
+	29984, 33018, 10857, 21698, 24376, 15883, 20199, 10096,
+	1712, 2008, 23432, 11114, 4229, 23874, 7359, 38587,
+	30093, 36911, 5730, 32615, 8257, 8600, 17501, 32309,
+	15338, 10206, 3743, 32099, 29984, 8460, 28947, 36549,
+	30995, 15781, 21698, 28996, 10532, 27834, 39514, 7086,
+	20199, 23289, 30794, 38344, 39933, 7044, 2008, 34096,
+	18507, 1934, 23048, 4401, 4229, 11428, 32340, 25492,
+	23083, 39960, 38587, 9789, 28021, 10524, 40149, 39411,
+	5730, 5256, 22479, 35954, 21871, 7789, 8600, 39628,
+	13120, 24439, 30824, 7396, 15338, 38174, 18106, 21382,
+	21672, 38255, 32099, 964, 15883, 13577, 32098, 11114,
+	28947, 3091, 36911, 17232, 12075, 32309, 15781, 7999,
+	8460, 38087, 30347, 28996, 10532, 33594, 23289, 7696,
+	2084, 34096, 7086, 20611, 11428, 542, 16710, 9789,
+	30794, 30863, 5256, 10321, 37518, 39628, 7044, 24304,
+	38174, 10701, 33363, 964, 18507, 37478, 3091, 32145,
+	14474, 7999, 4401, 13859, 33594, 26800, 36807, 20611,
+	32340, 23660, 30863, 1121, 38944, 24304, 39960, 26575,
+	37478, 30491, 7767, 13859, 28021, 14294, 23660, 14953,
+	10585, 26575, 39411, 30961, 14294, 8217, 160, 30961,
+	1641, 22479, 1641, 18418, 13120, 17962, 17962, 18106,
+	30093, 24376, 15883, 20199, 30093, 36911, 5730, 29984,
+	8460, 28947, 20199, 23289, 30794, 4229, 11428, 32340,
+	5730, 5256, 22479, 15338, 38174, 18106, 28947, 3091,
+	36911, 10532, 33594, 23289, 30794, 30863, 5256, 18507,
+	37478, 3091, 32340, 23660, 30863, 28021, 14294, 23660,
+	1641, 22479, 1641, 30093, 36911, 5730, 5730, 5256,
+	22479, 30794, 30863, 5256
+};
+
+static const RINGELT W_bwd_1024_40961[2044] = {
+	1641, 1641, 18482, 35705, 10098, 10167, 18482, 35705,
+	35231, 35231, 4050, 10868, 1641, 1641, 18482, 17301,
+	26667, 12940, 10098, 17301, 8621, 37870, 3483, 22454,
+	35705, 10098, 10167, 17672, 7367, 30429, 4050, 37870,
+	12014, 22855, 2787, 25623, 18482, 35705, 35231, 8621,
+	29533, 36732, 10167, 17672, 20762, 12014, 32501, 10977,
+	35231, 4050, 10868, 20762, 25078, 16585, 10868, 22855,
+	22999, 22999, 27841, 22543, 1641, 1641, 18482, 10000,
+	40801, 32744, 26667, 10000, 1550, 14386, 30376, 26008,
+	17301, 26667, 12940, 27102, 33194, 10470, 3483, 14386,
+	1001, 16657, 2017, 39840, 10098, 17301, 8621, 20350,
+	4154, 14161, 7367, 27102, 36560, 32962, 26487, 8816,
+	37870, 3483, 22454, 39997, 7598, 30260, 2787, 16657,
+	33917, 1333, 3443, 30640, 35705, 10098, 10167, 31172,
+	24251, 40419, 29533, 20350, 33875, 6865, 38877, 33265,
+	17672, 7367, 30429, 11965, 10614, 2874, 32501, 32962,
+	25180, 8652, 28886, 23729, 4050, 37870, 12014, 29847,
+	8863, 27384, 25078, 39997, 8862, 2706, 19289, 19579,
+	22855, 2787, 25623, 33565, 10137, 16522, 27841, 1333,
+	32361, 33172, 19090, 5007, 18482, 35705, 35231, 1550,
+	812, 30437, 12940, 31172, 2374, 1001, 17878, 15469,
+	8621, 29533, 36732, 36560, 17913, 39027, 22454, 6865,
+	38953, 33917, 1028, 2617, 10167, 17672, 20762, 33875,
+	1447, 13127, 30429, 11965, 19263, 25180, 9966, 4412,
+	12014, 32501, 10977, 8862, 37218, 30755, 25623, 8652,
+	23460, 32361, 32704, 8346, 35231, 4050, 10868, 2374,
+	33602, 17087, 36732, 29847, 17529, 38953, 39249, 30865,
+	20762, 25078, 16585, 19263, 30104, 7943, 10977, 2706,
+	15575, 23460, 35680, 30107, 10868, 22855, 22999, 17529,
+	25678, 16678, 16585, 33565, 22611, 15575, 11679, 40928,
+	22999, 27841, 22543, 22611, 780, 4217, 22543, 33172,
+	2684, 2684, 15761, 37055, 1641, 1641, 18482, 16282,
+	16566, 1982, 35526, 4096, 24679, 1982, 22463, 30885,
+	11469, 2381, 40801, 4096, 38319, 39320, 35231, 18482,
+	35705, 30727, 40957, 17203, 17970, 36613, 11551, 19516,
+	10000, 40801, 32744, 983, 10097, 39375, 16253, 25210,
+	34561, 39969, 31170, 28564, 9505, 4584, 30376, 30727,
+	1281, 17433, 23805, 26585, 28055, 21854, 250, 10279,
+	31500, 37579, 15598, 16499, 26667, 10000, 1550, 7604,
+	36436, 16025, 26302, 26799, 31351, 21039, 21268, 22444,
+	2438, 21917, 33194, 25210, 22340, 37055, 5007, 15761,
+	19090, 24944, 25336, 33419, 12820, 37426, 2109, 3620,
+	14386, 30376, 26008, 26527, 33918, 40331, 31198, 38479,
+	27171, 16295, 20801, 15272, 11317, 20571, 2017, 21854,
+	37385, 34456, 2896, 30705, 2828, 32242, 13979, 20804,
+	40457, 8574, 3355, 30211, 17301, 26667, 12940, 25438,
+	24649, 16128, 12359, 32925, 1694, 26068, 24564, 26839,
+	5204, 30452, 4154, 26799, 18695, 2684, 32361, 33172,
+	1333, 10718, 6974, 10502, 37479, 1695, 36995, 29434,
+	27102, 33194, 10470, 36932, 40746, 29502, 27682, 26462,
+	17008, 9190, 1961, 25643, 6045, 6880, 26487, 24944,
+	39912, 29596, 15355, 19170, 39605, 25526, 14696, 39962,
+	39986, 38530, 35992, 172, 3483, 14386, 1001, 4836,
+	5504, 31200, 36831, 2104, 1986, 40040, 15336, 31684,
+	9092, 28677, 7598, 38479, 4121, 4217, 16522, 780,
+	10137, 32344, 23603, 996, 24960, 37657, 28900, 3789,
+	16657, 2017, 39840, 23658, 39326, 20500, 23806, 26550,
+	39719, 37082, 624, 24494, 21203, 11359, 3443, 32242,
+	8684, 23120, 35800, 20993, 35412, 20026, 19889, 19672,
+	16400, 27237, 38419, 1308, 10098, 17301, 8621, 578,
+	895, 7693, 29558, 18166, 36664, 17152, 410, 3753,
+	22465, 12321, 24251, 32925, 30704, 22543, 25623, 27841,
+	2787, 11533, 6248, 40291, 30731, 7262, 15922, 40245,
+	20350, 4154, 14161, 17972, 18049, 40633, 13382, 36966,
+	2316, 33947, 30465, 18614, 39311, 36847, 38877, 10718,
+	6167, 29122, 32196, 8184, 18767, 24402, 19110, 914,
+	16122, 27090, 10199, 34714, 7367, 27102, 36560, 39641,
+	4901, 16589, 34262, 31393, 19094, 28765, 39316, 31398,
+	1279, 7012, 10614, 26462, 3692, 40928, 19579, 11679,
+	19289, 24546, 34455, 24797, 5079, 2833, 1056, 28848,
+	32962, 26487, 8816, 33792, 21994, 1316, 32227, 22393,
+	35455, 24952, 1151, 7239, 24603, 33490, 28886, 25526,
+	15016, 9037, 6694, 4129, 14118, 13592, 37976, 27186,
+	9245, 1205, 38504, 31558, 37870, 3483, 22454, 3298,
+	26792, 31848, 2401, 10681, 16437, 37979, 36072, 35871,
+	17347, 2837, 8863, 2104, 3603, 22611, 8862, 33565,
+	39997, 8294, 2238, 21237, 9094, 10113, 13746, 3143,
+	39997, 7598, 30260, 30262, 18654, 36680, 4072, 14118,
+	17193, 22531, 26852, 7421, 14680, 17487, 19289, 32344,
+	98, 19189, 27091, 917, 8294, 18767, 23969, 3920,
+	29344, 19642, 367, 34230, 2787, 16657, 33917, 11744,
+	30374, 3095, 26832, 35412, 10904, 4967, 17118, 39404,
+	33802, 11096, 10137, 26550, 34836, 16678, 27384, 25678,
+	8863, 39605, 37975, 766, 2476, 37850, 39758, 24854,
+	1333, 3443, 30640, 2465, 17069, 2690, 17630, 2828,
+	14837, 37731, 4158, 31667, 3042, 27246, 19090, 20026,
+	34644, 15422, 11691, 30788, 10681, 28055, 22781, 34047,
+	2152, 14104, 38989, 35498, 35705, 10098, 10167, 18818,
+	29989, 13058, 40204, 28366, 35271, 38031, 8246, 16737,
+	12239, 23416, 812, 18166, 5683, 22999, 12014, 22855,
+	37870, 29409, 30303, 22515, 35023, 23971, 1330, 25162,
+	31172, 24251, 40419, 1599, 26925, 26172, 11187, 25663,
+	27937, 19281, 18284, 30296, 30754, 39542, 17878, 11533,
+	33942, 1064, 36514, 29327, 13592, 14022, 10749, 5967,
+	37322, 25334, 6913, 19421, 29533, 20350, 33875, 16411,
+	7057, 34526, 8532, 24767, 35741, 3287, 39846, 27258,
+	7341, 19942, 17913, 36966, 8597, 30107, 23729, 35680,
+	28886, 29061, 4044, 16192, 35813, 23210, 19640, 18931,
+	6865, 38877, 33265, 14065, 32338, 892, 35539, 6452,
+	39523, 19848, 28544, 31301, 491, 30170, 1028, 24402,
+	15661, 15712, 23337, 28695, 22393, 6360, 33977, 12025,
+	17098, 20239, 29709, 31475, 17672, 7367, 30429, 8585,
+	24136, 26318, 7728, 12110, 7953, 29291, 22956, 1530,
+	12007, 5907, 1447, 31393, 24732, 15575, 25180, 2706,
+	32962, 21384, 26890, 6216, 4670, 30759, 34093, 13460,
+	11965, 10614, 2874, 25990, 21110, 14404, 39737, 15213,
+	14950, 33038, 10357, 1793, 28501, 20817, 9966, 24546,
+	10768, 10890, 10768, 37225, 24546, 11771, 39737, 21110,
+	3331, 7213, 20169, 24073, 32501, 32962, 25180, 30993,
+	33038, 16291, 14950, 22091, 7728, 24136, 29780, 27829,
+	32249, 7770, 37218, 22393, 23337, 7943, 2874, 30104,
+	10614, 32467, 35539, 32338, 21225, 11960, 32551, 30915,
+	8652, 28886, 23729, 17607, 6216, 17137, 26890, 39343,
+	8532, 7057, 15891, 299, 10030, 5893, 32704, 13592,
+	36514, 34233, 24732, 23981, 31393, 19203, 11187, 26925,
+	30094, 21512, 10491, 27796, 4050, 37870, 12014, 8024,
+	29291, 20056, 7953, 8162, 40204, 29989, 27377, 8730,
+	29959, 4791, 33602, 10681, 11691, 16585, 30429, 25078,
+	7367, 22368, 17630, 17069, 24237, 30939, 1773, 9336,
+	29847, 8863, 27384, 15775, 12025, 2675, 33977, 35635,
+	26832, 30374, 3678, 22278, 27693, 24810, 39249, 8294,
+	27091, 25995, 15661, 5187, 24402, 5187, 4072, 18654,
+	2140, 2605, 28341, 31341, 25078, 39997, 8862, 5770,
+	19848, 13442, 39523, 23981, 2401, 26792, 20534, 35906,
+	20165, 20240, 30104, 14118, 6694, 30865, 33265, 39249,
+	38877, 37225, 32227, 21994, 27138, 15234, 36345, 506,
+	2706, 19289, 19579, 16132, 16192, 32726, 4044, 28695,
+	34262, 4901, 23207, 6525, 16269, 14349, 35680, 18767,
+	32196, 29076, 8597, 35635, 36966, 29327, 13382, 18049,
+	34373, 36004, 11671, 11623, 22855, 2787, 25623, 4823,
+	3287, 6011, 35741, 30788, 29558, 895, 28508, 37765,
+	9508, 17699, 25678, 35412, 35800, 17529, 33875, 29847,
+	20350, 917, 23806, 39326, 13001, 36785, 12526, 21947,
+	33565, 10137, 16522, 32183, 5967, 34539, 10749, 4129,
+	36831, 5504, 40262, 16280, 35130, 13861, 11679, 39605,
+	15355, 18213, 33942, 22368, 11533, 8184, 27682, 40746,
+	19439, 407, 31599, 19803, 27841, 1333, 32361, 28104,
+	19281, 33328, 27937, 20993, 12359, 24649, 1510, 33803,
+	1814, 38384, 780, 2828, 2896, 17087, 40419, 33602,
+	24251, 19170, 31198, 33918, 10278, 38734, 26670, 17344,
+	33172, 19090, 5007, 34220, 22515, 39753, 30303, 30705,
+	26302, 36436, 2305, 27593, 10907, 16818, 15761, 28055,
+	23805, 21336, 5683, 8162, 18166, 26585, 16253, 10097,
+	15418, 7858, 13585, 22949, 18482, 35705, 35231, 25110,
+	38031, 39117, 35271, 38319, 35526, 16566, 22914, 22725,
+	15700, 11838, 32744, 28366, 7264, 10868, 10167, 4050,
+	10098, 1281, 28693, 3833, 6717, 36409, 20873, 2344,
+	1550, 812, 30437, 12560, 34047, 30822, 22781, 22340,
+	32480, 29611, 3240, 32655, 7690, 16443, 26008, 29409,
+	37532, 314, 34644, 19203, 20026, 37385, 29452, 26684,
+	81, 26417, 30913, 38300, 12940, 31172, 2374, 6152,
+	37731, 38369, 14837, 18695, 18050, 13038, 39939, 24213,
+	7941, 21438, 10470, 25663, 29988, 8346, 30640, 32704,
+	3443, 39912, 2495, 11651, 22503, 28254, 19655, 2584,
+	1001, 17878, 15469, 14545, 766, 17202, 37975, 4121,
+	18783, 4345, 17971, 27331, 26092, 16449, 39840, 14022,
+	9956, 15724, 34836, 39343, 26550, 8684, 28387, 29591,
+	30146, 30380, 29325, 32156, 8621, 29533, 36732, 37258,
+	4967, 18392, 10904, 30704, 34412, 35645, 15090, 21240,
+	36574, 4900, 14161, 24767, 33126, 23460, 33917, 8652,
+	16657, 6167, 7616, 14288, 31098, 531, 27539, 20603,
+	36560, 17913, 39027, 21067, 3920, 28889, 23969, 3692,
+	20183, 4562, 23306, 29710, 22193, 38404, 8816, 29061,
+	18636, 13839, 98, 32467, 32344, 15016, 15532, 8142,
+	14919, 10983, 7723, 37825, 22454, 6865, 38953, 1370,
+	22531, 14124, 17193, 3603, 28834, 1602, 1397, 17683,
+	38082, 16306, 30260, 6452, 23119, 30755, 30260, 37218,
+	7598, 98, 12314, 23618, 3107, 38331, 39865, 14744,
+	33917, 1028, 2617, 5889, 21237, 23459, 2238, 34836,
+	159, 22758, 13390, 30655, 16357, 16753, 30640, 6360,
+	9178, 31892, 3603, 22091, 2104, 34644, 8634, 39432,
+	10575, 26367, 3481, 7587, 10167, 17672, 20762, 29470,
+	37979, 30249, 16437, 5683, 10543, 11260, 25865, 34452,
+	40024, 13502, 40419, 12110, 40790, 10977, 22454, 32501,
+	3483, 33942, 33829, 34121, 16007, 29534, 17385, 18770,
+	33875, 1447, 13127, 23827, 27186, 20269, 37976, 8597,
+	16919, 33548, 34193, 27363, 15795, 31190, 33265, 21384,
+	31168, 13908, 15016, 11771, 25526, 15661, 36140, 17890,
+	8023, 38573, 5515, 11020, 30429, 11965, 19263, 12636,
+	24952, 29991, 35455, 24732, 28029, 33222, 17609, 28613,
+	5258, 20756, 2874, 15213, 18128, 4412, 8816, 9966,
+	26487, 10768, 35066, 28783, 32185, 28364, 22660, 4615,
+	25180, 9966, 4412, 28783, 24797, 35066, 34455, 23337,
+	29991, 12636, 16165, 37574, 21047, 25716, 23729, 11771,
+	13908, 18128, 3692, 15213, 26462, 36514, 20269, 23827,
+	36245, 27564, 34319, 4739, 12014, 32501, 10977, 33222,
+	28765, 28029, 19094, 11691, 30249, 29470, 36747, 37554,
+	1882, 21623, 27384, 22091, 31892, 19263, 36560, 11965,
+	27102, 27091, 23459, 5889, 14231, 7083, 38960, 17949,
+	8862, 37218, 30755, 17890, 914, 36140, 19110, 6694,
+	14124, 1370, 9572, 38066, 974, 11713, 19579, 32467,
+	13839, 31168, 6167, 21384, 10718, 32196, 28889, 21067,
+	28912, 15288, 26649, 7461, 25623, 8652, 23460, 33548,
+	33947, 16919, 2316, 35800, 18392, 37258, 8915, 33151,
+	32411, 19643, 16522, 39343, 15724, 13127, 14161, 1447,
+	4154, 15355, 17202, 14545, 5343, 10045, 30507, 38380,
+	32361, 32704, 8346, 34121, 40291, 33829, 6248, 2896,
+	38369, 6152, 17542, 36092, 14075, 21440, 5007, 19203,
+	314, 40790, 30704, 12110, 32925, 23805, 30822, 12560,
+	18871, 29575, 5472, 536, 35231, 4050, 10868, 11260,
+	17152, 10543, 36664, 7264, 39117, 25110, 9688, 26340,
+	8329, 24590, 30437, 8162, 21336, 20762, 8621, 17672,
+	17301, 37532, 39753, 34220, 33011, 21139, 31953, 10855,
+	2374, 33602, 17087, 39432, 19672, 8634, 19889, 29988,
+	33328, 28104, 30522, 22033, 7967, 25872, 15469, 22368,
+	18213, 9178, 8684, 6360, 32242, 9956, 34539, 32183,
+	39676, 7719, 33992, 8839, 36732, 29847, 17529, 22758,
+	37082, 159, 39719, 33126, 6011, 4823, 5088, 1217,
+	9042, 1245, 39027, 35635, 29076, 2617, 39840, 1028,
+	2017, 18636, 32726, 16132, 32896, 23583, 39139, 35872,
+	38953, 39249, 30865, 23618, 996, 12314, 23603, 23119,
+	13442, 5770, 25399, 17998, 22483, 9089, 2617, 5187,
+	25995, 23119, 4121, 6452, 38479, 9178, 2675, 15775,
+	1659, 2498, 38451, 31972, 20762, 25078, 16585, 1602,
+	40040, 28834, 1986, 40790, 20056, 8024, 21546, 22591,
+	30658, 29472, 13127, 23981, 34233, 38953, 1001, 6865,
+	14386, 31168, 17137, 17607, 14875, 9781, 23295, 8929,
+	19263, 30104, 7943, 8142, 39962, 15532, 14696, 18128,
+	16291, 30993, 5492, 19701, 26183, 31968, 4412, 37225,
+	10890, 18636, 39912, 29061, 24944, 13908, 14404, 25990,
+	28810, 19949, 18063, 33568, 10977, 2706, 15575, 4562,
+	9190, 20183, 17008, 31892, 26318, 8585, 31441, 11763,
+	17860, 33608, 30755, 28695, 15712, 39027, 10470, 17913,
+	33194, 13839, 892, 14065, 40723, 38183, 20927, 33609,
+	23460, 35680, 30107, 14288, 10502, 7616, 6974, 15724,
+	34526, 16411, 38907, 18363, 34316, 32585, 8346, 29327,
+	1064, 33126, 18695, 24767, 26799, 314, 26172, 1599,
+	14285, 38348, 4954, 16175, 10868, 22855, 22999, 35645,
+	26068, 34412, 1694, 21336, 13058, 18818, 36198, 13247,
+	6268, 26005, 17087, 30788, 15422, 36732, 12940, 29533,
+	26667, 18213, 2690, 2465, 2953, 34124, 12445, 36491,
+	17529, 25678, 16678, 29591, 20804, 28387, 13979, 29076,
+	3095, 11744, 7242, 37718, 36152, 30609, 30865, 917,
+	19189, 9956, 37385, 14022, 21854, 25995, 36680, 30262,
+	39094, 2991, 9096, 32510, 16585, 33565, 22611, 4345,
+	16295, 18783, 27171, 34233, 31848, 3298, 27602, 9291,
+	24804, 11053, 7943, 4129, 9037, 15469, 26008, 17878,
+	30376, 10890, 1316, 33792, 39603, 29929, 37485, 27925,
+	15575, 11679, 40928, 11651, 33419, 2495, 25336, 15712,
+	16589, 39641, 38879, 32493, 36778, 36539, 30107, 8184,
+	29122, 29988, 22340, 25663, 25210, 1064, 40633, 17972,
+	1996, 28461, 23448, 22418, 22999, 27841, 22543, 13038,
+	21039, 18050, 31351, 15422, 7693, 578, 4146, 20168,
+	33355, 23089, 16678, 20993, 23120, 2374, 1550, 31172,
+	10000, 19189, 20500, 23658, 14440, 33273, 5954, 32322,
+	22611, 780, 4217, 26684, 10279, 29452, 250, 9037,
+	31200, 4836, 361, 8000, 6293, 39721, 40928, 19170,
+	29596, 37532, 1281, 29409, 30727, 29122, 29502, 36932,
+	39946, 200, 27806, 40930, 22543, 33172, 2684, 29611,
+	39969, 32480, 34561, 23120, 16128, 25438, 15335, 5,
+	35512, 31744, 4217, 30705, 34456, 30437, 32744, 812,
+	40801, 29596, 40331, 26527, 25984, 35841, 9080, 17178,
+	2684, 15761, 37055, 3833, 17203, 28693, 40957, 34456,
+	16025, 7604, 17034, 40833, 227, 22958, 37055, 26585,
+	17433, 7264, 38319, 28366, 4096, 17433, 39375, 983,
+	6570, 8189, 13318, 2622
+};
 
 /*
-We use Gentleman-Sande, decimation-in-frequency FFT, for the forward FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will invert 
-the fourier transform using decimation-in-time.
+Gentleman-Sande, decimation-in-frequency FFT, premultiplying x by the
+powers of the 2n'th root of unity so that point-wise multiplication gives
+the negacyclic convolution, i.e. multiplication modulo x^n+1.  The output
+is left in bit-reversed order for FFT_twisted_backward_1024_40961.
 */
-void FFT_forward_1024_40961(FFTSHORT x[1024]) {
-        const FFTSHORT n = 1024;
-        const FFTSHORT q= 40961;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = 1;
-	for (m = n>>1; m >= 1; m=m>>1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {
-				ADD_MOD(t0, x[i], x[i+m], q);
-				ADD(t1, x[i], q - x[i+m]);
-				MUL_MOD(x[i+m], t1, W_1024_40961[index], q);				
-				x[i] = t0;				
-			}
-			SUB_MODn(index, index, step, n);
+void FFT_twisted_forward_1024_40961(RINGELT x[1024]) {
+	const FFTSHORT q = 40961, qinv = 2617286655U;
+	const RINGELT *w = W_fwd_1024_40961;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	/* Layers m = 512, 256 */
+	for (j = 0; j < 256; ++j, w += 7) {
+		MUL_MONT_RED(a0, x[j], w[0], q, qinv);
+		MUL_MONT_RED(a1, x[j+256], w[1], q, qinv);
+		MUL_MONT_RED(a2, x[j+512], w[2], q, qinv);
+		MUL_MONT_RED(a3, x[j+768], w[3], q, qinv);
+		GS(a0, a2, w[4]);
+		GS(a1, a3, w[5]);
+		GS(a0, a1, w[6]);
+		GS(a2, a3, w[6]);
+		x[j] = a0; x[j+256] = a1; x[j+512] = a2; x[j+768] = a3;
+	}
+
+	/* Layers m = 128, 64 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
 		}
-		step = step << 1;
-	}	 
-}
+	}
 
-/*
-We use Cooley-Tukey, decimation-in-time FFT, for the inverse FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will the forward
-fourier transform is using decimation-in-frequency.
-*/
-void FFT_backward_1024_40961(FFTSHORT x[1024]) {
-        const FFTSHORT n = 1024;
-        const FFTSHORT q= 40961;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = n>>1;
-	for (m = 1; m < n; m=m<<1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {							
-				t0 = x[i];
-				t0 -= (t0 >= q) ? q : 0;
-				MUL_MOD(t1, x[i+m], W_rev_1024_40961[index], q);				
-				ADD(x[i], t0, t1);
-				ADD(x[i+m], t0, q - t1);
-				
-			}
-			SUB_MODn(index, index, step, n);
+	/* Layers m = 32, 16 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 8, 4 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
 		}
-		step = step >> 1;
-	}	
-	for (i = 0; i < n; ++i) {
-		x[i] -= (x[i] >= q) ? q : 0;
 	}
-}
 
+	/* Layers m = 2, 1 */
+	for (i = 0; i < 1024; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		GS1(a0, a2);
+		GS(a1, a3, 22479);
+		GS1(a0, a1);
+		GS1(a2, a3);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+}
 
 /*
-We use Gentleman-Sande, decimation-in-frequency FFT, for the forward FFT.
-We premultiply x by the 2n'th roots of unity to affect a Discrete Weighted Fourier Transform, 
-so when we apply pointwise multiplication we obtain the negacyclic convolution, i.e. multiplication 
-modulo x^n+1.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will invert 
-the fourier transform using decimation-in-time.
+Cooley-Tukey, decimation-in-time FFT, inverting FFT_twisted_forward_1024_40961:
+postmultiplies x by the inverse powers of the 2n'th root of unity and by
+n^-1.
 */
-void FFT_twisted_forward_1024_40961(FFTSHORT x[1024]) {
-        const FFTSHORT n = 1024;
-        const FFTSHORT q= 40961;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	//Pre multiplication for twisted FFT
-	j = 0;
-	for (i = 0; i < n>>1; ++i) {
-		MUL_MOD(x[j], x[j], W_1024_40961[i], q);
-		j++;	
-		MUL_MOD(x[j], x[j], W_sqrt_1024_40961[i], q);	
-		j++;
+void FFT_twisted_backward_1024_40961(RINGELT x[1024]) {
+	const FFTSHORT q = 40961, qinv = 2617286655U;
+	const RINGELT *w = W_bwd_1024_40961;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 1024; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 18482);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
 	}
 
-	step = 1;
-	for (m = n>>1; m >= 1; m=m>>1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {				
-				ADD_MOD(t0, x[i], x[i+m], q);
-				ADD(t1, x[i], q - x[i+m]);
-				MUL_MOD(x[i+m], t1, W_1024_40961[index], q);				
-				x[i] = t0;						
-			}
-			SUB_MODn(index, index, step, n);
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
 		}
-		step = step << 1;
-	}	 
+	}
+
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 256, 512 */
+	for (j = 0; j < 256; ++j, w += 7) {
+		a0 = x[j]; a1 = x[j+256]; a2 = x[j+512]; a3 = x[j+768];
+		CT(a0, a1, w[0]);
+		CT(a2, a3, w[0]);
+		CT(a0, a2, w[1]);
+		CT(a1, a3, w[2]);
+		MUL_MONT_RED(x[j], a0, w[3], q, qinv);
+		MUL_MONT_RED(x[j+256], a1, w[4], q, qinv);
+		MUL_MONT_RED(x[j+512], a2, w[5], q, qinv);
+		MUL_MONT_RED(x[j+768], a3, w[6], q, qinv);
+	}
 }
 
 /*
-We use Cooley-Tukey, decimation-in-time FFT, for the inverse FFT.
-We postmultiply x by the inverse of the 2n'th roots of unity * n^-1 to affect a Discrete Weighted Fourier Transform, 
-so when we apply pointwise multiplication we obtain the negacyclic convolution, i.e. multiplication 
-modulo x^n+1.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will the forward
-fourier transform is using decimation-in-frequency.
+x = FFT_twisted_backward_1024_40961 of the point-wise product a*b, formed as the
+first stage loads it.  x may alias a or b.
 */
-void FFT_twisted_backward_1024_40961(FFTSHORT x[1024]) {
-        const FFTSHORT n = 1024;
-        const FFTSHORT q= 40961;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = n>>1;
-	for (m = 1; m < n; m=m<<1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {							
-				t0 = x[i];
-				t0 -= (t0 >= q) ? q : 0;
-				MUL_MOD(t1, x[i+m], W_rev_1024_40961[index], q);				
-				ADD(x[i], t0, t1);
-				ADD(x[i+m], t0, q - t1);
-			}
-			SUB_MODn(index, index, step, n);
+void FFT_twisted_backward_mul_1024_40961(RINGELT x[1024], const RINGELT a[1024], const RINGELT b[1024]) {
+	const FFTSHORT q = 40961, qinv = 2617286655U;
+	const FFTSHORT mu = BARRETT_MU(40961);
+	const RINGELT *w = W_bwd_1024_40961;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 1024; i += 4) {
+		MUL_BARRETT(a0, a[i], b[i], q, mu);
+		MUL_BARRETT(a1, a[i+1], b[i+1], q, mu);
+		MUL_BARRETT(a2, a[i+2], b[i+2], q, mu);
+		MUL_BARRETT(a3, a[i+3], b[i+3], q, mu);
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 18482);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
 		}
-		step = step >> 1;
 	}
 
-	//Post multiplication for twisted FFT
-	j = 0;
-	for (i = 0; i < n>>1; ++i) {
-		MUL_MOD(x[j], x[j], W_rev_1024_40961[i], q);
-		j++;	
-		MUL_MOD(x[j], x[j], W_sqrt_rev_1024_40961[i], q);
-		j++;
-	} 
-}
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
 
+	/* Layers m = 256, 512 */
+	for (j = 0; j < 256; ++j, w += 7) {
+		a0 = x[j]; a1 = x[j+256]; a2 = x[j+512]; a3 = x[j+768];
+		CT(a0, a1, w[0]);
+		CT(a2, a3, w[0]);
+		CT(a0, a2, w[1]);
+		CT(a1, a3, w[2]);
+		MUL_MONT_RED(x[j], a0, w[3], q, qinv);
+		MUL_MONT_RED(x[j+256], a1, w[4], q, qinv);
+		MUL_MONT_RED(x[j+512], a2, w[5], q, qinv);
+		MUL_MONT_RED(x[j+768], a3, w[6], q, qinv);
+	}
+}
 
-void _FFT_forward_1024_40961(FFTSHORT *x) {
+void _FFT_forward_1024_40961(RINGELT *x) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_forward_1024_40961_avx2(x);
+    return;
+  }
+#endif
   FFT_twisted_forward_1024_40961(x);
 }
 
-void _FFT_backward_1024_40961(FFTSHORT *x) {
-  int i;
+void _FFT_backward_1024_40961(RINGELT *x) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_backward_1024_40961_avx2(x);
+    return;
+  }
+#endif
   FFT_twisted_backward_1024_40961(x);
-  for (i=0; i<1024; ++i)
-    MUL_MOD(x[i], x[i], 40921, 40961);
+}
+
+void _FFT_backward_mul_1024_40961(RINGELT *x, const RINGELT *a, const RINGELT *b) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_backward_mul_1024_40961_avx2(x, a, b);
+    return;
+  }
+#endif
+  FFT_twisted_backward_mul_1024_40961(x, a, b);
 }
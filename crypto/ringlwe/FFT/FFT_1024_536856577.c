@@ -0,0 +1,442 @@
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/* Generated by util/ringlwe_fft.pl: do not edit. */
+
+/* Cyclic Number Theoretic Transform mod q, for the Bluestein and Rader
+convolutions of the prime-m parameter sets.
+	n = 1024, q = 536856577	*/
+
+#include "FFT_includes.h"
+
+#define GS(a, b, w) BFLY_GS(a, b, w, q, q2, qinv, MUL_MONT)
+#define GS1(a, b) BFLY_GS_1(a, b, q2)
+#define CT(a, b, w) BFLY_CT(a, b, w, q, q2, qinv, MUL_MONT)
+#define CT1(a, b) BFLY_CT_1(a, b, q2)
+
+/* The twiddle factors w^k in Montgomery form, in the order the stages
+read them */
+static const FFTSHORT W_fwd_1024_536856577[1020] = {
+	114680, 87108556, 114680, 387611442, 292502658, 514790428, 514790428, 148830830,
+	175929383, 98839989, 45290408, 375036682, 175929383, 466029624, 503748703, 330418969,
+	222770551, 267016799, 375036682, 104412890, 435104051, 375660926, 36326235, 82117768,
+	503748703, 9825620, 284299004, 34350342, 288725762, 453095016, 267016799, 193069999,
+	368575362, 393462172, 33530303, 267511323, 435104051, 513182133, 184286165, 488001804,
+	189648867, 44764762, 82117768, 123825785, 317817601, 350222834, 227494139, 503423075,
+	284299004, 92387811, 440170955, 217883618, 410855840, 331659471, 453095016, 158775907,
+	228415150, 322937697, 174504860, 339657941, 368575362, 37974251, 27458441, 338374036,
+	228231878, 411894407, 267511323, 114459990, 403756367, 109507002, 397842080, 93167013,
+	184286165, 218889983, 94954425, 63208146, 430003780, 386962145, 44764762, 282026865,
+	75520957, 255737151, 490363318, 107243270, 317817601, 434030708, 500637888, 258363471,
+	418354484, 517315563, 503423075, 356941165, 524809531, 341371547, 29640486, 403633674,
+	440170955, 23639568, 353646329, 313341143, 167048340, 516744329, 331659471, 280181217,
+	32431096, 43189001, 522040706, 158757419, 228415150, 40258263, 262977935, 159451095,
+	146911731, 91677906, 339657941, 214478740, 194044558, 383289330, 260316240, 82995540,
+	27458441, 175114921, 505283617, 33046600, 310611868, 469855674, 411894407, 372707370,
+	428126774, 284728863, 172792178, 434784733, 403756367, 168922815, 342020247, 399328461,
+	201274435, 394219824, 93167013, 224538394, 333810521, 158499945, 179257837, 481003928,
+	94954425, 40671590, 350869882, 434150478, 409445546, 535375709, 386962145, 431834618,
+	215676003, 381879404, 18188278, 320051657, 75520957, 344464425, 304965469, 416774002,
+	503067809, 215664544, 107243270, 162980916, 309790120, 225731545, 417889262, 51919395,
+	500637888, 374734277, 515125391, 430091601, 332934438, 163866412, 517315563, 304719484,
+	143269407, 79562880, 264436528, 311252229, 524809531, 534490310, 37017087, 108075839,
+	402281255, 396248068, 403633674, 426098291, 400950808, 465772781, 399546002, 34708710,
+	353646329, 203642081, 19545303, 337945923, 65975609, 470803403, 516744329, 306336786,
+	422036186, 321363658, 287670212, 42592984, 32431096, 32925639, 410880441, 442926913,
+	300534278, 494080756, 158757419, 496020406, 28913414, 285825497, 268592015, 428550481,
+	262977935, 259448702, 409428614, 529018544, 423900095, 425895680, 91677906, 216198435,
+	311691345, 430785617, 531801316, 216608595, 194044558, 36693331, 531517977, 325362511,
+	30741826, 34781555, 82995540, 445566883, 62571016, 400411566, 410441592, 371355299,
+	505283617, 69831194, 305367630, 461320543, 356190784, 82467077, 469855674, 48784982,
+	154323938, 385097010, 227678479, 386519389, 428126774, 493924609, 226196486, 378060876,
+	519477845, 414674816, 434784733, 119258832, 527396436, 254495470, 34386263, 181722640,
+	342020247, 180266939, 148233211, 52567811, 122508565, 467249754, 394219824, 90259229,
+	358420780, 225914178, 68236937, 46574037, 333810521, 13261221, 272545579, 344490066,
+	150365254, 232745000, 481003928, 494666549, 160279721, 234807208, 393278410, 257377070,
+	350869882, 412518886, 152556776, 48929683, 270595854, 494568475, 535375709, 115831918,
+	108667271, 202320982, 389071837, 511624979, 215676003, 185869303, 428604370, 448450584,
+	322931781, 37346125, 320051657, 58411189, 92155962, 522094339, 409676353, 471660930,
+	304965469, 516384759, 86910415, 356151673, 230216921, 327691382, 215664544, 19553780,
+	111406770, 205491528, 322756894, 283843561, 309790120, 353117092, 51851590, 346418922,
+	215163185, 469070115, 51919395, 56961244, 476276466, 100505011, 216931486, 523407948,
+	515125391, 12257186, 449686724, 230507041, 99782729, 369162083, 163866412, 290247928,
+	355713930, 92974704, 238809864, 336856292, 143269407, 85105459, 338401698, 32558570,
+	172109057, 346181837, 311252229, 432254870, 198812246, 355460487, 281798160, 28374036,
+	37017087, 243958727, 375481758, 214701954, 435694214, 419850877, 396248068, 114715043,
+	49093824, 401614027, 436466626, 359194678, 400950808, 19453866, 65191066, 181529898,
+	235056153, 192899582, 34708710, 33328442, 389480253, 500776732, 222573562, 382502264,
+	19545303, 511350819, 87108556, 173523079, 15090444, 148830830, 470803403, 201412463,
+	466029624, 260330248, 289555112, 104412890, 422036186, 178521479, 9825620, 326904052,
+	503264075, 193069999, 42592984, 161615907, 513182133, 244877674, 241753567, 123825785,
+	410880441, 384528990, 92387811, 469130164, 260012716, 158775907, 494080756, 73993717,
+	37974251, 40840447, 33324585, 114459990, 28913414, 475634115, 218889983, 390304327,
+	313093694, 282026865, 428550481, 493144151, 434030708, 275517141, 314322045, 356941165,
+	409428614, 300580302, 23639568, 99492237, 495109478, 280181217, 425895680, 25332031,
+	40258263, 482876194, 445697959, 214478740, 311691345, 442748086, 175114921, 172825159,
+	370675210, 372707370, 216608595, 121375660, 168922815, 424206602, 27016577, 224538394,
+	531517977, 396119381, 40671590, 261597839, 424410994, 431834618, 34781555, 268142742,
+	344464425, 369063478, 292976784, 162980916, 62571016, 184052560, 374734277, 89569727,
+	40862955, 304719484, 371355299, 511666840, 534490310, 182942438, 322662949, 426098291,
+	305367630, 518375741, 203642081, 241809771, 532073230, 306336786, 82467077, 443775603,
+	32925639, 110761508, 136360699, 496020406, 154323938, 30255536, 259448702, 486582678,
+	57191878, 216198435, 386519389, 397042349, 36693331, 117408484, 40431227, 445566883,
+	226196486, 104481561, 69831194, 451868870, 84518752, 48784982, 414674816, 299715298,
+	493924609, 85801887, 14473560, 119258832, 527396436, 405109979, 180266939, 342986623,
+	285845036, 90259229, 181722640, 70730073, 13261221, 139702280, 142432646, 494666549,
+	148233211, 13472774, 412518886, 332219258, 403174974, 115831918, 467249754, 251075799,
+	185869303, 121260830, 354553190, 58411189, 358420780, 230318632, 516384759, 268083677,
+	244209299, 19553780, 46574037, 175230988, 353117092, 79484056, 295156825, 56961244,
+	272545579, 332018790, 12257186, 277315164, 496413280, 290247928, 232745000, 129704742,
+	85105459, 347733419, 292358063, 432254870, 160279721, 263580611, 243958727, 73352667,
+	142326328, 114715043, 257377070, 415816571, 19453866, 533957859, 138791067, 33328442,
+	152556776, 465818087, 511350819, 314860507, 286960652, 201412463, 494568475, 278117452,
+	178521479, 254309848, 305237587, 161615907, 108667271, 107486614, 384528990, 443439138,
+	503947674, 73993717, 511624979, 40770479, 475634115, 429033770, 489234572, 493144151,
+	428604370, 531212138, 300580302, 243655713, 430677120, 25332031, 37346125, 71519568,
+	442748086, 25660114, 317827879, 121375660, 92155962, 489587875, 396119381, 417777643,
+	437807238, 268142742, 471660930, 303201127, 184052560, 272099526, 88349801, 511666840,
+	86910415, 353974266, 518375741, 423429709, 111598805, 443775603, 327691382, 324200486,
+	30255536, 306029634, 200898943, 397042349, 111406770, 149290844, 104481561, 33490752,
+	188946633, 299715298, 283843561, 362713632, 405109979, 478762355, 176025449, 70730073,
+	51851590, 144868405, 13472774, 231838558, 323043082, 251075799, 469070115, 304713234,
+	230318632, 347454078, 517357809, 175230988, 476276466, 185668782, 332018790, 62419922,
+	409300090, 129704742, 523407948, 432567243, 263580611, 267674482, 252192795, 415816571,
+	449686724, 389275559, 465818087, 67143745, 270862205, 278117452, 369162083, 328083675,
+	107486614, 286821422, 500484591, 40770479, 355713930, 131989592, 531212138, 456036337,
+	238456726, 71519568, 336856292, 192878015, 489587875, 392082008, 518382746, 303201127,
+	338401698, 507578671, 353974266, 525547098, 313339664, 324200486, 346181837, 388332572,
+	149290844, 68183281, 463657013, 362713632, 198812246, 290633509, 144868405, 444229140,
+	323842719, 304713234, 28374036, 432688989, 185668782, 435414164, 448176517, 432567243,
+	375481758, 372974812, 389275559, 435440269, 291331397, 328083675, 419850877, 480894462,
+	131989592, 91136840, 408585011, 192878015, 49093824, 415179039, 507578671, 534833168,
+	70502968, 388332572, 359194678, 458328689, 290633509, 422604501, 5652981, 432688989,
+	65191066, 33315922, 372974812, 266060850, 466380492, 480894462, 192899582, 437922075,
+	415179039, 375833065, 278252026, 458328689, 389480253, 320024442, 33315922, 420971605,
+	429875223, 437922075, 382502264, 397485709, 320024442, 431237933, 58158263, 397485709,
+	114680, 87108556, 114680, 175929383, 466029624, 503748703, 503748703, 9825620,
+	284299004, 435104051, 513182133, 184286165, 284299004, 92387811, 440170955, 368575362,
+	37974251, 27458441, 184286165, 218889983, 94954425, 317817601, 434030708, 500637888,
+	440170955, 23639568, 353646329, 228415150, 40258263, 262977935, 27458441, 175114921,
+	505283617, 403756367, 168922815, 342020247, 94954425, 40671590, 350869882, 75520957,
+	344464425, 304965469, 500637888, 374734277, 515125391, 524809531, 534490310, 37017087,
+	353646329, 203642081, 19545303, 32431096, 32925639, 410880441, 262977935, 259448702,
+	409428614, 194044558, 36693331, 531517977, 505283617, 69831194, 305367630, 428126774,
+	493924609, 226196486, 342020247, 180266939, 148233211, 333810521, 13261221, 272545579,
+	350869882, 412518886, 152556776, 215676003, 185869303, 428604370, 304965469, 516384759,
+	86910415, 309790120, 353117092, 51851590, 515125391, 12257186, 449686724, 143269407,
+	85105459, 338401698, 37017087, 243958727, 375481758, 400950808, 19453866, 65191066,
+	19545303, 511350819, 87108556, 422036186, 178521479, 9825620, 410880441, 384528990,
+	92387811, 28913414, 475634115, 218889983, 409428614, 300580302, 23639568, 311691345,
+	442748086, 175114921, 531517977, 396119381, 40671590, 62571016, 184052560, 374734277,
+	305367630, 518375741, 203642081, 154323938, 30255536, 259448702, 226196486, 104481561,
+	69831194, 527396436, 405109979, 180266939, 148233211, 13472774, 412518886, 358420780,
+	230318632, 516384759, 272545579, 332018790, 12257186, 160279721, 263580611, 243958727,
+	152556776, 465818087, 511350819, 108667271, 107486614, 384528990, 428604370, 531212138,
+	300580302, 92155962, 489587875, 396119381, 86910415, 353974266, 518375741, 111406770,
+	149290844, 104481561, 51851590, 144868405, 13472774, 476276466, 185668782, 332018790,
+	449686724, 389275559, 465818087, 355713930, 131989592, 531212138, 338401698, 507578671,
+	353974266, 198812246, 290633509, 144868405, 375481758, 372974812, 389275559, 49093824,
+	415179039, 507578671, 65191066, 33315922, 372974812, 389480253, 320024442, 33315922,
+	114680, 87108556, 114680, 284299004, 92387811, 440170955, 440170955, 23639568,
+	353646329, 94954425, 40671590, 350869882, 353646329, 203642081, 19545303, 505283617,
+	69831194, 305367630, 350869882, 412518886, 152556776, 515125391, 12257186, 449686724,
+	19545303, 511350819, 87108556, 409428614, 300580302, 23639568, 305367630, 518375741,
+	203642081, 148233211, 13472774, 412518886, 152556776, 465818087, 511350819, 86910415,
+	353974266, 518375741, 449686724, 389275559, 465818087, 375481758, 372974812, 389275559,
+	114680, 87108556, 114680, 353646329, 203642081, 19545303, 19545303, 511350819,
+	87108556, 152556776, 465818087, 511350819
+};
+
+static const FFTSHORT W_bwd_1024_536856577[1020] = {
+	114680, 114680, 449748021, 25505758, 71038490, 384299801, 449748021, 25505758,
+	517311274, 517311274, 333214496, 183210248, 114680, 114680, 449748021, 147581018,
+	163881765, 161374819, 71038490, 147581018, 87169853, 18480836, 182882311, 449946162,
+	25505758, 71038490, 384299801, 124337691, 523383803, 388623366, 333214496, 18480836,
+	231488947, 513217009, 236276275, 127427963, 449748021, 25505758, 517311274, 87169853,
+	524599391, 21731186, 384299801, 124337691, 185986695, 231488947, 467025383, 31572960,
+	517311274, 333214496, 183210248, 185986695, 496184987, 441902152, 183210248, 513217009,
+	96685622, 96685622, 444468766, 252557573, 114680, 114680, 449748021, 503540655,
+	216832135, 147376324, 163881765, 503540655, 471665511, 29277906, 121677538, 487762753,
+	147581018, 163881765, 161374819, 391988172, 246223068, 338044331, 182882311, 29277906,
+	198454879, 5644439, 404866985, 181142647, 71038490, 147581018, 87169853, 204837787,
+	351187795, 60580111, 523383803, 391988172, 485004987, 432375016, 387565733, 425449807,
+	18480836, 182882311, 449946162, 140737196, 47268702, 444700615, 236276275, 5644439,
+	108252207, 152327587, 429369963, 428189306, 25505758, 71038490, 384299801, 292897850,
+	273275966, 376576856, 524599391, 204837787, 264310998, 20471818, 306537945, 178435797,
+	124337691, 523383803, 388623366, 356589638, 131746598, 9460141, 467025383, 432375016,
+	310660091, 277407875, 506601041, 382532639, 333214496, 18480836, 231488947, 162122300,
+	352804017, 474285561, 496184987, 140737196, 5338600, 361741656, 94108491, 225165232,
+	513217009, 236276275, 127427963, 317966594, 61222462, 507943163, 444468766, 152327587,
+	125976136, 527030957, 358335098, 114820391, 449748021, 25505758, 517311274, 471665511,
+	517402711, 135905769, 161374819, 292897850, 499839490, 198454879, 451751118, 393587170,
+	87169853, 524599391, 21731186, 485004987, 183739485, 227066457, 449946162, 20471818,
+	231891108, 108252207, 350987274, 321180574, 384299801, 124337691, 185986695, 264310998,
+	523595356, 203046056, 388623366, 356589638, 194836330, 310660091, 42931968, 108729803,
+	231488947, 467025383, 31572960, 5338600, 500163246, 342812019, 127427963, 277407875,
+	273878642, 125976136, 503930938, 504425481, 517311274, 333214496, 183210248, 499839490,
+	2366267, 12047046, 21731186, 162122300, 36218689, 231891108, 192392152, 461335620,
+	185986695, 496184987, 441902152, 194836330, 367933762, 133100210, 31572960, 361741656,
+	509398136, 273878642, 496598314, 308441427, 183210248, 513217009, 96685622, 36218689,
+	102825869, 219038976, 441902152, 317966594, 352570412, 509398136, 498882326, 168281215,
+	96685622, 444468766, 252557573, 352570412, 23674444, 101752526, 252557573, 527030957,
+	33107874, 33107874, 70826953, 360927194, 114680, 114680, 449748021, 139370868,
+	478698314, 105618644, 216832135, 139370868, 154354313, 98934502, 106981354, 115884972,
+	503540655, 216832135, 147376324, 78527888, 258604551, 161023512, 121677538, 98934502,
+	343956995, 55962115, 70476085, 270795727, 163881765, 503540655, 471665511, 104167588,
+	531203596, 114252076, 246223068, 78527888, 177661899, 148524005, 466353609, 2023409,
+	29277906, 121677538, 487762753, 343978562, 128271566, 445719737, 404866985, 55962115,
+	117005700, 208772902, 245525180, 101416308, 147581018, 163881765, 161374819, 104289334,
+	88680060, 101442413, 351187795, 104167588, 508482541, 232143343, 213013858, 92627437,
+	391988172, 246223068, 338044331, 174142945, 73199564, 468673296, 387565733, 148524005,
+	190674740, 212656091, 223516913, 11309479, 182882311, 29277906, 198454879, 233655450,
+	18473831, 144774569, 47268702, 343978562, 200000285, 465337009, 298399851, 80820240,
+	5644439, 404866985, 181142647, 496086098, 36371986, 250035155, 429369963, 208772902,
+	167694494, 258739125, 265994372, 469712832, 71038490, 147581018, 87169853, 121040006,
+	284663782, 269182095, 273275966, 104289334, 13448629, 407151835, 127556487, 474436655,
+	204837787, 351187795, 60580111, 361625589, 19498768, 189402499, 306537945, 232143343,
+	67786462, 285780778, 213813495, 305018019, 523383803, 391988172, 485004987, 466126504,
+	360831128, 58094222, 131746598, 174142945, 253013016, 237141279, 347909944, 503365825,
+	432375016, 387565733, 425449807, 139814228, 335957634, 230826943, 506601041, 212656091,
+	209165195, 93080974, 425257772, 113426868, 18480836, 182882311, 449946162, 25189737,
+	448506776, 264757051, 352804017, 233655450, 65195647, 268713835, 99049339, 119078934,
+	140737196, 47268702, 444700615, 415480917, 219028698, 511196463, 94108491, 465337009,
+	499510452, 511524546, 106179457, 293200864, 236276275, 5644439, 108252207, 43712426,
+	47622005, 107822807, 61222462, 496086098, 25231598, 462862860, 32908903, 93417439,
+	152327587, 429369963, 428189306, 375240670, 231618990, 282546729, 358335098, 258739125,
+	42288102, 335444114, 249895925, 221996070, 25505758, 71038490, 384299801, 503528135,
+	398065510, 2898718, 517402711, 121040006, 279479507, 422141534, 394530249, 463503910,
+	292897850, 273275966, 376576856, 104601707, 244498514, 189123158, 451751118, 407151835,
+	304111577, 246608649, 40443297, 259541413, 524599391, 204837787, 264310998, 479895333,
+	241699752, 457372521, 183739485, 361625589, 490282540, 517302797, 292647278, 268772900,
+	20471818, 306537945, 178435797, 478445388, 182303387, 415595747, 350987274, 285780778,
+	69606823, 421024659, 133681603, 204637319, 124337691, 523383803, 388623366, 42190028,
+	394423931, 397154297, 523595356, 466126504, 355133937, 446597348, 251011541, 193869954,
+	356589638, 131746598, 9460141, 417597745, 522383017, 451054690, 42931968, 237141279,
+	122181761, 488071595, 452337825, 84987707, 467025383, 432375016, 310660091, 91289694,
+	496425350, 419448093, 500163246, 139814228, 150337188, 320658142, 479664699, 50273899,
+	277407875, 506601041, 382532639, 40836171, 400495878, 426095069, 503930938, 93080974,
+	454389500, 230519791, 4783347, 295046806, 333214496, 18480836, 231488947, 110758286,
+	214193628, 353914139, 2366267, 25189737, 165501278, 232137093, 495993622, 447286850,
+	162122300, 352804017, 474285561, 373875661, 243879793, 167793099, 192392152, 268713835,
+	502075022, 105021959, 112445583, 275258738, 496184987, 140737196, 5338600, 312318183,
+	509840000, 112649975, 367933762, 415480917, 320247982, 164149207, 166181367, 364031418,
+	361741656, 94108491, 225165232, 322377837, 91158618, 53980383, 496598314, 511524546,
+	110960897, 256675360, 41747099, 437364340, 513217009, 236276275, 127427963, 179915412,
+	222534532, 261339436, 102825869, 43712426, 108306096, 254829712, 223762883, 146552250,
+	317966594, 61222462, 507943163, 422396587, 503531992, 496016130, 498882326, 462862860,
+	42775821, 378080670, 276843861, 67726413, 444468766, 152327587, 125976136, 413030792,
+	295103010, 291978903, 23674444, 375240670, 494263593, 343786578, 33592502, 209952525,
+	527030957, 358335098, 114820391, 432443687, 247301465, 276526329, 70826953, 335444114,
+	66053174, 388025747, 521766133, 363333498, 449748021, 25505758, 517311274, 154354313,
+	314283015, 36079845, 147376324, 503528135, 502147867, 343956995, 301800424, 355326679,
+	471665511, 517402711, 135905769, 177661899, 100389951, 135242550, 487762753, 422141534,
+	140608509, 117005700, 101162363, 322154623, 161374819, 292897850, 499839490, 508482541,
+	255058417, 181396090, 338044331, 104601707, 225604348, 190674740, 364747520, 504298007,
+	198454879, 451751118, 393587170, 200000285, 298046713, 443881873, 181142647, 246608649,
+	372990165, 167694494, 437073848, 306349536, 87169853, 524599391, 21731186, 13448629,
+	319925091, 436351566, 60580111, 479895333, 484937182, 67786462, 321693392, 190437655,
+	485004987, 183739485, 227066457, 253013016, 214099683, 331365049, 425449807, 517302797,
+	321192033, 209165195, 306639656, 180704904, 449946162, 20471818, 231891108, 65195647,
+	127180224, 14762238, 444700615, 478445388, 216804920, 499510452, 213924796, 88405993,
+	108252207, 350987274, 321180574, 25231598, 147784740, 334535595, 428189306, 421024659,
+	1480868, 42288102, 266260723, 487926894, 384299801, 124337691, 185986695, 279479507,
+	143578167, 302049369, 376576856, 42190028, 55852649, 304111577, 386491323, 192366511,
+	264310998, 523595356, 203046056, 490282540, 468619640, 310942399, 178435797, 446597348,
+	142636753, 69606823, 414348012, 484288766, 388623366, 356589638, 194836330, 355133937,
+	502470314, 282361107, 9460141, 417597745, 102071844, 122181761, 17378732, 158795701,
+	310660091, 42931968, 108729803, 150337188, 309178098, 151759567, 382532639, 488071595,
+	67000903, 454389500, 180665793, 75536034, 231488947, 467025383, 31572960, 165501278,
+	126414985, 136445011, 474285561, 91289694, 453861037, 502075022, 506114751, 211494066,
+	5338600, 500163246, 342812019, 320247982, 5055261, 106070960, 225165232, 320658142,
+	445178671, 110960897, 112956482, 7838033, 127427963, 277407875, 273878642, 108306096,
+	268264562, 251031080, 507943163, 40836171, 378099158, 42775821, 236322299, 93929664,
+	125976136, 503930938, 504425481, 494263593, 249186365, 215492919, 114820391, 230519791,
+	20112248, 66053174, 470880968, 198910654, 517311274, 333214496, 183210248, 502147867,
+	137310575, 71083796, 135905769, 110758286, 133222903, 140608509, 134575322, 428780738,
+	499839490, 2366267, 12047046, 225604348, 272420049, 457293697, 393587170, 232137093,
+	19541014, 372990165, 203922139, 106764976, 21731186, 162122300, 36218689, 484937182,
+	118967315, 311125032, 227066457, 373875661, 429613307, 321192033, 33788768, 120082575,
+	231891108, 192392152, 461335620, 216804920, 518668299, 154977173, 321180574, 105021959,
+	149894432, 1480868, 127411031, 102706099, 185986695, 496184987, 441902152, 55852649,
+	357598740, 378356632, 203046056, 312318183, 443689564, 142636753, 335582142, 137528116,
+	194836330, 367933762, 133100210, 102071844, 364064399, 252127714, 108729803, 164149207,
+	124962170, 67000903, 226244709, 503809977, 31572960, 361741656, 509398136, 453861037,
+	276540337, 153567247, 342812019, 322377837, 197198636, 445178671, 389944846, 377405482,
+	273878642, 496598314, 308441427, 378099158, 14815871, 493667576, 504425481, 256675360,
+	205197106, 20112248, 369808237, 223515434, 183210248, 513217009, 96685622, 133222903,
+	507216091, 195485030, 12047046, 179915412, 33433502, 19541014, 118502093, 278493106,
+	36218689, 102825869, 219038976, 429613307, 46493259, 281119426, 461335620, 254829712,
+	492091815, 149894432, 106852797, 473648431, 441902152, 317966594, 352570412, 443689564,
+	139014497, 427349575, 133100210, 422396587, 269345254, 124962170, 308624699, 198482541,
+	509398136, 498882326, 168281215, 197198636, 362351717, 213918880, 308441427, 378080670,
+	83761561, 205197106, 126000737, 318972959, 96685622, 444468766, 252557573, 33433502,
+	309362438, 186633743, 219038976, 413030792, 454738809, 492091815, 347207710, 48854773,
+	352570412, 23674444, 101752526, 269345254, 503326274, 143394405, 168281215, 343786578,
+	269839778, 83761561, 248130815, 502506235, 252557573, 527030957, 33107874, 454738809,
+	500530342, 161195651, 101752526, 432443687, 161819895, 269839778, 314086026, 206437608,
+	33107874, 70826953, 360927194, 161819895, 491566169, 438016588, 360927194, 388025747,
+	22066149, 22066149, 244353919, 149245135
+};
+
+/*
+Gentleman-Sande, decimation-in-frequency FFT, leaving the output in
+bit-reversed order for FFT_backward_1024_536856577.
+Coefficients are kept lazily reduced in [0, 2q), both on input and on output.
+*/
+void FFT_forward_1024_536856577(FFTSHORT x[1024]) {
+	const FFTSHORT q = 536856577, q2 = 2*536856577, qinv = 331335679U;
+	const FFTSHORT *w = W_fwd_1024_536856577;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_forward_1024_536856577_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layers m = 512, 256 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		a0 = x[j]; a1 = x[j+256]; a2 = x[j+512]; a3 = x[j+768];
+		GS(a0, a2, w[0]);
+		GS(a1, a3, w[1]);
+		GS(a0, a1, w[2]);
+		GS(a2, a3, w[2]);
+		x[j] = a0; x[j+256] = a1; x[j+512] = a2; x[j+768] = a3;
+	}
+
+	/* Layers m = 128, 64 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 32, 16 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 8, 4 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
+	}
+
+	/* Layers m = 2, 1 */
+	for (i = 0; i < 1024; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		GS1(a0, a2);
+		GS(a1, a3, 87108556);
+		GS1(a0, a1);
+		GS1(a2, a3);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+}
+
+/*
+Cooley-Tukey, decimation-in-time FFT, inverting FFT_forward_1024_536856577 up to
+the factor n.
+The output is lazily reduced to [0, 2q); callers finish the reduction.
+*/
+void FFT_backward_1024_536856577(FFTSHORT x[1024]) {
+	const FFTSHORT q = 536856577, q2 = 2*536856577, qinv = 331335679U;
+	const FFTSHORT *w = W_bwd_1024_536856577;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_backward_1024_536856577_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 1024; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 449748021);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
+	}
+
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 256, 512 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		a0 = x[j]; a1 = x[j+256]; a2 = x[j+512]; a3 = x[j+768];
+		CT(a0, a1, w[0]);
+		CT(a2, a3, w[0]);
+		CT(a0, a2, w[1]);
+		CT(a1, a3, w[2]);
+		x[j] = a0; x[j+256] = a1; x[j+512] = a2; x[j+768] = a3;
+	}
+}
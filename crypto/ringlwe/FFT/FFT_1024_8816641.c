@@ -8,72 +8,435 @@
  * See LICENSE for complete information.
  */
 
-/* Code to compute a Number Theoretic Transform for multiplication in the ring 
-F_q[x] / <x^n+1>.
-        n = 1024, q = 17633281  */
+/* Generated by util/ringlwe_fft.pl: do not edit. */
+
+/* Cyclic Number Theoretic Transform mod q, for the Bluestein and Rader
+convolutions of the prime-m parameter sets.
+	n = 1024, q = 8816641	*/
 
 #include "FFT_includes.h"
-#include "FFT_constants.h"
+
+#define GS(a, b, w) BFLY_GS(a, b, w, q, q2, qinv, MUL_MONT)
+#define GS1(a, b) BFLY_GS_1(a, b, q2)
+#define CT(a, b, w) BFLY_CT(a, b, w, q, q2, qinv, MUL_MONT)
+#define CT1(a, b) BFLY_CT_1(a, b, q2)
+
+/* The twiddle factors w^k in Montgomery form, in the order the stages
+read them */
+static const FFTSHORT W_fwd_1024_8816641[1020] = {
+	1263129, 6542401, 1263129, 242608, 6549234, 8094545, 8094545, 6430630,
+	3136587, 3207492, 3957758, 7487634, 3136587, 5628427, 6611447, 7025347,
+	1315819, 2032155, 7487634, 6655671, 6849771, 133141, 2277375, 1219794,
+	6611447, 7793552, 6235870, 1085024, 3493997, 4544385, 2032155, 2186733,
+	540546, 677234, 4185016, 4779091, 6849771, 3384409, 5038774, 1332758,
+	4357293, 4381604, 1219794, 658618, 6613300, 1643819, 3465858, 4295701,
+	6235870, 1744848, 2177088, 5595111, 705539, 3687899, 4544385, 3590766,
+	4130559, 16285, 1127698, 2496649, 540546, 4851386, 8477809, 2197927,
+	477096, 4052650, 4779091, 7078560, 1844716, 5824800, 2771787, 4145911,
+	5038774, 1987223, 281334, 4814066, 1991328, 4489043, 4381604, 6499361,
+	7647796, 6881700, 7640813, 2211663, 6613300, 1582657, 5698811, 6193428,
+	6951690, 4957440, 4295701, 3684924, 4065971, 1825766, 6335825, 6521749,
+	2177088, 6482035, 6463439, 5491767, 2902916, 3179179, 3687899, 130496,
+	7939098, 3213265, 570998, 5335820, 4130559, 7265400, 1214160, 5879302,
+	630625, 4987130, 2496649, 8160716, 7907996, 1586243, 760882, 7553103,
+	8477809, 5455912, 7197760, 1209099, 6054743, 4827241, 4052650, 8793221,
+	246581, 4776163, 6948350, 2817384, 1844716, 7190588, 8454526, 8737091,
+	6856844, 2413145, 4145911, 962250, 8632668, 345812, 3936115, 5450680,
+	281334, 3658325, 4995162, 8004284, 4277556, 1713512, 4489043, 3237476,
+	2291498, 3440074, 1641960, 5453725, 7647796, 4660420, 7463441, 1306613,
+	1658923, 4031614, 2211663, 2726009, 628129, 4468411, 7715935, 1456449,
+	5698811, 3847703, 4493352, 1500557, 6525822, 3942589, 4957440, 2790614,
+	1646869, 7305807, 1623014, 6518378, 4065971, 1622875, 4220235, 4901067,
+	7058754, 6626746, 6521749, 636898, 5613998, 12322, 8629888, 7557611,
+	6463439, 3813175, 190906, 8314652, 446534, 5259413, 3179179, 2126543,
+	1959267, 8167317, 5643953, 1135619, 7939098, 7942996, 7421940, 5901797,
+	47128, 5017546, 5335820, 1670969, 2540319, 6907004, 4189153, 3803731,
+	1214160, 805542, 5563694, 4030609, 2663981, 2586273, 4987130, 4050724,
+	3989436, 2593106, 1507708, 972630, 7907996, 2741735, 5470737, 1516564,
+	5316551, 3669320, 7553103, 5971808, 162873, 5476663, 7675387, 7818902,
+	7197760, 4087007, 6969742, 1092441, 5744948, 7394925, 4827241, 7738336,
+	3358355, 8186406, 3258880, 5340571, 246581, 336260, 232820, 2161156,
+	8543785, 1851792, 2817384, 7783802, 7698553, 8791786, 4910956, 1217857,
+	8454526, 8485552, 7005259, 960341, 135359, 7511401, 2413145, 2520106,
+	5050031, 6355616, 5179027, 6751454, 8632668, 5724086, 1027197, 895287,
+	1421840, 8607681, 5450680, 6465706, 4879461, 966281, 7698537, 7410924,
+	4995162, 6238690, 2237902, 4742688, 2635239, 5567901, 1713512, 6005076,
+	5712716, 1855897, 6260530, 1983235, 2291498, 6161898, 2707864, 23364,
+	2123025, 3312575, 5453725, 2283133, 761638, 6586890, 8803268, 5208251,
+	7463441, 6982988, 4666071, 839519, 4337779, 5775021, 4031614, 8797215,
+	5132647, 3932282, 6282904, 5911527, 628129, 3838086, 6788233, 5490533,
+	6039856, 6168161, 1456449, 5022006, 8425450, 116679, 6543805, 8099733,
+	4493352, 8602252, 6424126, 2444004, 1080013, 8712545, 3942589, 2001716,
+	8097447, 389871, 2649429, 3945676, 1646869, 8744534, 7007001, 3034590,
+	3387051, 5280993, 6518378, 3347578, 7884712, 7077180, 2458562, 2695944,
+	4220235, 4532466, 1265245, 5211767, 183170, 1386916, 6626746, 1710870,
+	2439786, 6187132, 2865612, 5952439, 5613998, 491554, 6181910, 4117200,
+	7773397, 6045758, 7557611, 7015403, 6092999, 7798379, 5581559, 3578132,
+	190906, 8188595, 6542401, 7697790, 1475663, 6430630, 5259413, 1109603,
+	5628427, 5990694, 6210616, 6655671, 1959267, 2125130, 7793552, 8410679,
+	73725, 2186733, 1135619, 1968009, 3384409, 1827489, 998404, 658618,
+	7421940, 4782097, 1744848, 3842420, 7959687, 3590766, 5017546, 5451521,
+	4851386, 2408380, 5373552, 7078560, 2540319, 4333389, 1987223, 8650057,
+	4588318, 6499361, 3803731, 5040726, 1582657, 6832300, 4528575, 3684924,
+	5563694, 7793820, 6482035, 489776, 1449376, 130496, 2586273, 487187,
+	7265400, 8026600, 1777031, 8160716, 3989436, 429498, 5455912, 5882434,
+	5900903, 8793221, 972630, 2747506, 7190588, 1857908, 4549294, 962250,
+	5470737, 7207096, 3658325, 8127705, 5400001, 3237476, 3669320, 6549098,
+	4660420, 1553845, 1283391, 2726009, 162873, 7188864, 3847703, 3617991,
+	5139698, 2790614, 7818902, 8210584, 1622875, 3336560, 8372588, 636898,
+	6969742, 559384, 3813175, 4134155, 7112157, 2126543, 7394925, 4538268,
+	7942996, 5747441, 4673360, 1670969, 3358355, 5710381, 805542, 1726992,
+	6989967, 4050724, 5340571, 539277, 2741735, 7210339, 3213, 5971808,
+	232820, 3680948, 4087007, 2498076, 5219050, 7738336, 1851792, 6035822,
+	336260, 6600106, 5729436, 7783802, 7698553, 4623121, 8485552, 2695240,
+	2014733, 2520106, 1217857, 8383396, 5724086, 1913566, 5085261, 6465706,
+	7005259, 1867844, 6238690, 3885404, 331896, 6005076, 7511401, 780942,
+	6161898, 3400549, 2034218, 2283133, 5050031, 5565222, 6982988, 3578688,
+	5939300, 8797215, 6751454, 8292548, 3838086, 5779902, 5219599, 5022006,
+	1027197, 169607, 8602252, 8064200, 76641, 2001716, 8607681, 4197360,
+	8744534, 7725032, 2771444, 3347578, 4879461, 4110564, 4532466, 6276140,
+	416131, 1710870, 7410924, 534296, 491554, 1298188, 8757927, 7015403,
+	2237902, 5199712, 8188595, 6904536, 1646392, 1109603, 5567901, 1771921,
+	2125130, 6654078, 5792954, 1968009, 5712716, 6724428, 4782097, 4539151,
+	2406484, 5451521, 1983235, 8057017, 4333389, 7940461, 277004, 5040726,
+	2707864, 3732411, 7793820, 311004, 2340003, 487187, 3312575, 2012362,
+	429498, 5694475, 5582013, 2747506, 761638, 2422092, 7207096, 1135758,
+	7544814, 6549098, 5208251, 1833500, 7188864, 5027155, 6402779, 8210584,
+	4666071, 1450260, 559384, 1017618, 3085997, 4538268, 5775021, 7224765,
+	5710381, 860310, 8014557, 539277, 5132647, 759815, 3680948, 1504688,
+	4812507, 6035822, 5911527, 2491274, 4623121, 3939853, 7227843, 8383396,
+	6788233, 3020560, 1867844, 5969884, 3610984, 780942, 6168161, 4593480,
+	5565222, 2602693, 1386019, 8292548, 8425450, 3506879, 169607, 8555244,
+	8062396, 4197360, 8099733, 6974503, 4110564, 4815480, 4426994, 534296,
+	6424126, 3323561, 5199712, 7257700, 8270195, 1771921, 8712545, 3994713,
+	6724428, 6986126, 2107023, 8057017, 8097447, 8498863, 3732411, 1924881,
+	270759, 2012362, 3945676, 1470522, 2422092, 7729725, 1215612, 1833500,
+	7007001, 4269918, 1450260, 3820329, 4201008, 7224765, 5280993, 5995816,
+	759815, 973608, 7163185, 2491274, 7884712, 2115797, 3020560, 4795512,
+	2816329, 4593480, 2695944, 1082473, 3506879, 4005595, 8236341, 6974503,
+	1265245, 734651, 3323561, 3311639, 1248062, 3994713, 1386916, 5476962,
+	8498863, 4328716, 1593945, 1470522, 2439786, 2157118, 4269918, 1316489,
+	2356, 5995816, 5952439, 2817127, 2115797, 6845151, 7298205, 1082473,
+	6181910, 1465061, 734651, 515040, 1657493, 5476962, 6045758, 4226937,
+	2157118, 590595, 8757317, 2817127, 6092999, 5839968, 1465061, 379631,
+	4988395, 4226937, 3578132, 1265362, 5839968, 2045047, 4952164, 1265362,
+	1263129, 6542401, 1263129, 3136587, 5628427, 6611447, 6611447, 7793552,
+	6235870, 6849771, 3384409, 5038774, 6235870, 1744848, 2177088, 540546,
+	4851386, 8477809, 5038774, 1987223, 281334, 6613300, 1582657, 5698811,
+	2177088, 6482035, 6463439, 4130559, 7265400, 1214160, 8477809, 5455912,
+	7197760, 1844716, 7190588, 8454526, 281334, 3658325, 4995162, 7647796,
+	4660420, 7463441, 5698811, 3847703, 4493352, 4065971, 1622875, 4220235,
+	6463439, 3813175, 190906, 7939098, 7942996, 7421940, 1214160, 805542,
+	5563694, 7907996, 2741735, 5470737, 7197760, 4087007, 6969742, 246581,
+	336260, 232820, 8454526, 8485552, 7005259, 8632668, 5724086, 1027197,
+	4995162, 6238690, 2237902, 2291498, 6161898, 2707864, 7463441, 6982988,
+	4666071, 628129, 3838086, 6788233, 4493352, 8602252, 6424126, 1646869,
+	8744534, 7007001, 4220235, 4532466, 1265245, 5613998, 491554, 6181910,
+	190906, 8188595, 6542401, 1959267, 2125130, 7793552, 7421940, 4782097,
+	1744848, 2540319, 4333389, 1987223, 5563694, 7793820, 6482035, 3989436,
+	429498, 5455912, 5470737, 7207096, 3658325, 162873, 7188864, 3847703,
+	6969742, 559384, 3813175, 3358355, 5710381, 805542, 232820, 3680948,
+	4087007, 7698553, 4623121, 8485552, 7005259, 1867844, 6238690, 5050031,
+	5565222, 6982988, 1027197, 169607, 8602252, 4879461, 4110564, 4532466,
+	2237902, 5199712, 8188595, 5712716, 6724428, 4782097, 2707864, 3732411,
+	7793820, 761638, 2422092, 7207096, 4666071, 1450260, 559384, 5132647,
+	759815, 3680948, 6788233, 3020560, 1867844, 8425450, 3506879, 169607,
+	6424126, 3323561, 5199712, 8097447, 8498863, 3732411, 7007001, 4269918,
+	1450260, 7884712, 2115797, 3020560, 1265245, 734651, 3323561, 2439786,
+	2157118, 4269918, 6181910, 1465061, 734651, 6092999, 5839968, 1465061,
+	1263129, 6542401, 1263129, 6235870, 1744848, 2177088, 2177088, 6482035,
+	6463439, 281334, 3658325, 4995162, 6463439, 3813175, 190906, 7197760,
+	4087007, 6969742, 4995162, 6238690, 2237902, 4493352, 8602252, 6424126,
+	190906, 8188595, 6542401, 5563694, 7793820, 6482035, 6969742, 559384,
+	3813175, 7005259, 1867844, 6238690, 2237902, 5199712, 8188595, 4666071,
+	1450260, 559384, 6424126, 3323561, 5199712, 1265245, 734651, 3323561,
+	1263129, 6542401, 1263129, 6463439, 3813175, 190906, 190906, 8188595,
+	6542401, 2237902, 5199712, 8188595
+};
+
+static const FFTSHORT W_bwd_1024_8816641[1020] = {
+	1263129, 1263129, 2274240, 628046, 3616929, 6578739, 2274240, 628046,
+	8625735, 8625735, 5003466, 2353202, 1263129, 1263129, 2274240, 5493080,
+	8081990, 7551396, 3616929, 5493080, 2392515, 8257257, 7366381, 4150570,
+	628046, 3616929, 6578739, 2577951, 6948797, 1811382, 5003466, 8257257,
+	1846899, 2334606, 1022821, 3252947, 2274240, 628046, 8625735, 2392515,
+	214389, 4323289, 6578739, 2577951, 3821479, 1846899, 4729634, 1618881,
+	8625735, 5003466, 2353202, 3821479, 5158316, 8535307, 2353202, 2334606,
+	6639553, 6639553, 7071793, 2580771, 1263129, 1263129, 2274240, 7351580,
+	2976673, 2723642, 8081990, 7351580, 2634731, 4546723, 6659523, 6376855,
+	5493080, 8081990, 7551396, 5796081, 6700844, 931929, 7366381, 4546723,
+	1809640, 5084230, 317778, 719194, 3616929, 5493080, 2392515, 8647034,
+	5309762, 391191, 6948797, 5796081, 2028408, 5135693, 8056826, 3683994,
+	8257257, 7366381, 4150570, 1609545, 6394549, 8055003, 1022821, 5084230,
+	6108777, 4034544, 2092213, 3103925, 628046, 3616929, 6578739, 4284175,
+	4706077, 3937180, 214389, 8647034, 7789444, 1833653, 3251419, 3766610,
+	2577951, 6948797, 1811382, 331089, 4193520, 1118088, 4729634, 5135693,
+	8583821, 8011099, 3106260, 5458286, 5003466, 8257257, 1846899, 4968938,
+	1627777, 8653768, 5158316, 1609545, 3345904, 3360729, 8387143, 4827205,
+	2334606, 1022821, 3252947, 6829418, 4483252, 6276322, 7071793, 4034544,
+	1394701, 1023089, 6691511, 6857374, 2274240, 628046, 8625735, 2634731,
+	8325087, 3202643, 7551396, 4284175, 4596406, 1809640, 72107, 7169772,
+	2392515, 214389, 4323289, 2028408, 4978555, 8188512, 4150570, 1833653,
+	1353200, 6108777, 2654743, 6525143, 6578739, 2577951, 3821479, 7789444,
+	3092555, 183973, 1811382, 331089, 362115, 8583821, 8480381, 8570060,
+	1846899, 4729634, 1618881, 3345904, 6074906, 908645, 3252947, 8011099,
+	7602481, 1394701, 873645, 877543, 8625735, 5003466, 2353202, 4596406,
+	7193766, 4750670, 4323289, 4968938, 3117830, 1353200, 4156221, 1168845,
+	3821479, 5158316, 8535307, 362115, 1626053, 6971925, 1618881, 3360729,
+	338832, 7602481, 1551241, 4686082, 2353202, 2334606, 6639553, 3117830,
+	7233984, 2203341, 8535307, 6829418, 3777867, 338832, 3965255, 8276095,
+	6639553, 7071793, 2580771, 3777867, 5432232, 1966870, 2580771, 1023089,
+	2205194, 2205194, 3188214, 5680054, 1263129, 1263129, 2274240, 7551279,
+	3864477, 6771594, 2976673, 7551279, 5238509, 4589704, 3828246, 8437010,
+	7351580, 2976673, 2723642, 5999514, 59324, 8226046, 6659523, 4589704,
+	2770883, 3339679, 7159148, 8301601, 8081990, 7351580, 2634731, 7734168,
+	1518436, 1971490, 6700844, 5999514, 2864202, 2820825, 8814285, 7500152,
+	4546723, 6659523, 6376855, 7346119, 7222696, 4487925, 317778, 3339679,
+	7429725, 4821928, 7568579, 5505002, 5493080, 8081990, 7551396, 1842138,
+	580300, 4811046, 5309762, 7734168, 6120697, 4223161, 6000312, 4021129,
+	5796081, 6700844, 931929, 6325367, 1653456, 7843033, 8056826, 2820825,
+	3535648, 1591876, 4615633, 4996312, 7366381, 4546723, 1809640, 6983141,
+	7601029, 1086916, 6394549, 7346119, 4870965, 6804279, 8545882, 6891760,
+	5084230, 317778, 719194, 759624, 6709618, 1830515, 2092213, 4821928,
+	104096, 7044720, 546446, 1558941, 3616929, 5493080, 2392515, 8282345,
+	4389647, 4001161, 4706077, 1842138, 716908, 4619281, 754245, 261397,
+	8647034, 5309762, 391191, 524093, 7430622, 6213948, 3251419, 4223161,
+	2648480, 8035699, 5205657, 2846757, 6948797, 5796081, 2028408, 433245,
+	1588798, 4876788, 4193520, 6325367, 2905114, 2780819, 4004134, 7311953,
+	5135693, 8056826, 3683994, 8277364, 802084, 7956331, 3106260, 1591876,
+	3041620, 4278373, 5730644, 7799023, 8257257, 7366381, 4150570, 606057,
+	2413862, 3789486, 1627777, 6983141, 3608390, 2267543, 1271827, 7680883,
+	1609545, 6394549, 8055003, 6069135, 3234628, 3122166, 8387143, 6804279,
+	5504066, 8329454, 6476638, 8505637, 1022821, 5084230, 6108777, 3775915,
+	8539637, 876180, 4483252, 759624, 6833406, 3365120, 6410157, 4277490,
+	4034544, 2092213, 3103925, 6848632, 3023687, 2162563, 6691511, 7044720,
+	3248740, 7707038, 7170249, 1912105, 628046, 3616929, 6578739, 1801238,
+	58714, 7518453, 8325087, 8282345, 1405717, 7105771, 8400510, 2540501,
+	4284175, 4706077, 3937180, 5469063, 6045197, 1091609, 72107, 4619281,
+	208960, 6814925, 8740000, 752441, 214389, 8647034, 7789444, 3794635,
+	3597042, 3036739, 4978555, 524093, 2065187, 19426, 2877341, 5237953,
+	1833653, 3251419, 3766610, 6533508, 6782423, 5416092, 2654743, 8035699,
+	1305240, 2811565, 8484745, 4931237, 2577951, 6948797, 1811382, 2350935,
+	3731380, 6903075, 3092555, 433245, 7598784, 6296535, 6801908, 6121401,
+	331089, 4193520, 1118088, 1032839, 3087205, 2216535, 8480381, 2780819,
+	6964849, 1078305, 3597591, 6318565, 4729634, 5135693, 8583821, 2844833,
+	8813428, 1606302, 6074906, 8277364, 3476070, 4765917, 1826674, 7089649,
+	8011099, 3106260, 5458286, 7145672, 4143281, 3069200, 873645, 4278373,
+	1421716, 6690098, 1704484, 4682486, 5003466, 8257257, 1846899, 8179743,
+	444053, 5480081, 7193766, 606057, 997739, 6026027, 3676943, 5198650,
+	4968938, 1627777, 8653768, 6090632, 7533250, 7262796, 4156221, 2267543,
+	5147321, 5579165, 3416640, 688936, 5158316, 1609545, 3345904, 7854391,
+	4267347, 6958733, 1626053, 6069135, 7844011, 23420, 2915738, 2934207,
+	3360729, 8387143, 4827205, 655925, 7039610, 790041, 1551241, 8329454,
+	6230368, 8686145, 7367265, 8326865, 2334606, 1022821, 3252947, 5131717,
+	4288066, 1984341, 7233984, 3775915, 5012910, 2317280, 4228323, 166584,
+	6829418, 4483252, 6276322, 1738081, 3443089, 6408261, 3965255, 3365120,
+	3799095, 5225875, 856954, 4974221, 7071793, 4034544, 1394701, 8158023,
+	7818237, 6989152, 5432232, 6848632, 7681022, 6629908, 8742916, 405962,
+	1023089, 6691511, 6857374, 2160970, 2606025, 2825947, 3188214, 7707038,
+	3557228, 2386011, 7340978, 1118851, 2274240, 628046, 8625735, 5238509,
+	3235082, 1018262, 2723642, 1801238, 1259030, 2770883, 1043244, 4699441,
+	2634731, 8325087, 3202643, 2864202, 5951029, 2629509, 6376855, 7105771,
+	2189895, 7429725, 8633471, 3604874, 7551396, 4284175, 4596406, 6120697,
+	6358079, 1739461, 931929, 5469063, 2298263, 3535648, 5429590, 5782051,
+	1809640, 72107, 7169772, 4870965, 6167212, 8426770, 719194, 6814925,
+	4874052, 104096, 7736628, 6372637, 2392515, 214389, 4323289, 716908,
+	2272836, 8699962, 391191, 3794635, 7360192, 2648480, 2776785, 3326108,
+	2028408, 4978555, 8188512, 2905114, 2533737, 4884359, 3683994, 19426,
+	4785027, 3041620, 4478862, 7977122, 4150570, 1833653, 1353200, 3608390,
+	13373, 2229751, 8055003, 6533508, 3362916, 5504066, 6693616, 8793277,
+	6108777, 2654743, 6525143, 6833406, 2556111, 6960744, 3103925, 2811565,
+	7103129, 3248740, 6181402, 4073953, 6578739, 2577951, 3821479, 1405717,
+	1118104, 7850360, 3937180, 2350935, 3365961, 208960, 7394801, 7921354,
+	7789444, 3092555, 183973, 2065187, 3637614, 2461025, 3766610, 6296535,
+	6403496, 1305240, 8681282, 7856300, 1811382, 331089, 362115, 7598784,
+	3905685, 24855, 1118088, 1032839, 5999257, 6964849, 272856, 6655485,
+	8583821, 8480381, 8570060, 3476070, 5557761, 630235, 5458286, 1078305,
+	3989400, 1421716, 3071693, 7724200, 1846899, 4729634, 1618881, 997739,
+	1141254, 3339978, 8653768, 2844833, 1263538, 5147321, 3500090, 7300077,
+	3345904, 6074906, 908645, 7844011, 7308933, 6223535, 4827205, 4765917,
+	3829511, 6230368, 6152660, 4786032, 3252947, 8011099, 7602481, 5012910,
+	4627488, 1909637, 6276322, 7145672, 3480821, 3799095, 8769513, 2914844,
+	1394701, 873645, 877543, 7681022, 3172688, 649324, 6857374, 6690098,
+	5637462, 3557228, 8370107, 501989, 8625735, 5003466, 2353202, 1259030,
+	186753, 8804319, 3202643, 8179743, 2294892, 2189895, 1757887, 3915574,
+	4596406, 7193766, 4750670, 2298263, 7193627, 1510834, 7169772, 6026027,
+	3859201, 4874052, 2290819, 7316084, 4323289, 4968938, 3117830, 7360192,
+	1100706, 4348230, 8188512, 6090632, 6604978, 4785027, 7157718, 7510028,
+	1353200, 4156221, 1168845, 3362916, 7174681, 5376567, 6525143, 5579165,
+	4327598, 7103129, 4539085, 812357, 3821479, 5158316, 8535307, 3365961,
+	4880526, 8470829, 183973, 7854391, 4670730, 6403496, 1959797, 79550,
+	362115, 1626053, 6971925, 5999257, 1868291, 4040478, 8570060, 23420,
+	4763991, 3989400, 2761898, 7607542, 1618881, 3360729, 338832, 1263538,
+	8055759, 7230398, 908645, 655925, 6319992, 3829511, 8186016, 2937339,
+	7602481, 1551241, 4686082, 3480821, 8245643, 5603376, 877543, 8686145,
+	5128742, 5637462, 5913725, 3324874, 2353202, 2334606, 6639553, 2294892,
+	2480816, 6990875, 4750670, 5131717, 4520940, 3859201, 1864951, 2623213,
+	3117830, 7233984, 2203341, 6604978, 1175828, 1934941, 1168845, 2317280,
+	4435037, 4327598, 6825313, 4002575, 8535307, 6829418, 3777867, 4670730,
+	6044854, 2991841, 6971925, 1738081, 4037550, 4763991, 8339545, 6618714,
+	338832, 3965255, 8276095, 6319992, 7688943, 8800356, 4686082, 5225875,
+	4272256, 5128742, 8111102, 3221530, 6639553, 7071793, 2580771, 4520940,
+	5350783, 7172822, 2203341, 8158023, 7596847, 4435037, 4459348, 7483883,
+	3777867, 5432232, 1966870, 4037550, 4631625, 8139407, 8276095, 6629908,
+	6784486, 4272256, 5322644, 7731617, 2580771, 1023089, 2205194, 7596847,
+	6539266, 8683500, 1966870, 2160970, 1329007, 6784486, 7500822, 1791294,
+	2205194, 3188214, 5680054, 1329007, 4858883, 5609149, 5680054, 2386011,
+	722096, 722096, 2267407, 8574033
+};
 
 /*
-We use Gentleman-Sande, decimation-in-frequency FFT, for the forward FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will invert 
-the fourier transform using decimation-in-time.
+Gentleman-Sande, decimation-in-frequency FFT, leaving the output in
+bit-reversed order for FFT_backward_1024_8816641.
+Coefficients are kept lazily reduced in [0, 2q), both on input and on output.
 */
 void FFT_forward_1024_8816641(FFTSHORT x[1024]) {
-        const FFTSHORT n = 1024;
-        const FFTSHORT q = 8816641;
-
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = 1;
-	for (m = n>>1; m >= 1; m=m>>1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {
-				ADD_MOD(t0, x[i], x[i+m], q);
-				ADD(t1, x[i], q - x[i+m]);
-				MUL_MOD(x[i+m], t1, W_1024_8816641[index], q);				
-				x[i] = t0;				
-			}
-                        SUB_MODn(index, index, step, n);
+	const FFTSHORT q = 8816641, q2 = 2*8816641, qinv = 1481017343U;
+	const FFTSHORT *w = W_fwd_1024_8816641;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_forward_1024_8816641_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layers m = 512, 256 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		a0 = x[j]; a1 = x[j+256]; a2 = x[j+512]; a3 = x[j+768];
+		GS(a0, a2, w[0]);
+		GS(a1, a3, w[1]);
+		GS(a0, a1, w[2]);
+		GS(a2, a3, w[2]);
+		x[j] = a0; x[j+256] = a1; x[j+512] = a2; x[j+768] = a3;
+	}
+
+	/* Layers m = 128, 64 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 32, 16 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
 		}
-		step = step << 1;
-	}	 
+	}
+
+	/* Layers m = 8, 4 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
+	}
+
+	/* Layers m = 2, 1 */
+	for (i = 0; i < 1024; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		GS1(a0, a2);
+		GS(a1, a3, 6542401);
+		GS1(a0, a1);
+		GS1(a2, a3);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
 }
 
 /*
-We use Cooley-Tukey, decimation-in-time FFT, for the inverse FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will the forward
-fourier transform is using decimation-in-frequency.
+Cooley-Tukey, decimation-in-time FFT, inverting FFT_forward_1024_8816641 up to
+the factor n.
+The output is lazily reduced to [0, 2q); callers finish the reduction.
 */
 void FFT_backward_1024_8816641(FFTSHORT x[1024]) {
-        const FFTSHORT n = 1024;
-        const FFTSHORT q = 8816641;
-
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = n>>1;
-	for (m = 1; m < n; m=m<<1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {							
-				t0 = x[i];
-				t0 -= (t0 >= q) ? q : 0;
-				MUL_MOD(t1, x[i+m], W_rev_1024_8816641[index], q);				
-				ADD(x[i], t0, t1);
-				ADD(x[i+m], t0, q - t1);
-				
-			}
-                        SUB_MODn(index, index, step, n);
+	const FFTSHORT q = 8816641, q2 = 2*8816641, qinv = 1481017343U;
+	const FFTSHORT *w = W_bwd_1024_8816641;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_backward_1024_8816641_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 1024; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 2274240);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
 		}
-		step = step >> 1;
-	}	
-	for (i = 0; i < n; ++i) {
-		x[i] -= (x[i] >= q) ? q : 0;
+	}
+
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 1024; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 256, 512 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		a0 = x[j]; a1 = x[j+256]; a2 = x[j+512]; a3 = x[j+768];
+		CT(a0, a1, w[0]);
+		CT(a2, a3, w[0]);
+		CT(a0, a2, w[1]);
+		CT(a1, a3, w[2]);
+		x[j] = a0; x[j+256] = a1; x[j+512] = a2; x[j+768] = a3;
 	}
 }
@@ -8,72 +8,711 @@
  * See LICENSE for complete information.
  */
 
-/* Code to compute a Number Theoretic Transform for multiplication in the ring 
-F_q[x] / <x^n+1>.
+/* Generated by util/ringlwe_fft.pl: do not edit. */
+
+/* Cyclic Number Theoretic Transform mod q, for the Bluestein and Rader
+convolutions of the prime-m parameter sets.
 	n = 2048, q = 17633281	*/
 
 #include "FFT_includes.h"
-#include "FFT_constants.h"
+
+#define GS(a, b, w) BFLY_GS(a, b, w, q, q2, qinv, MUL_MONT)
+#define GS1(a, b) BFLY_GS_1(a, b, q2)
+#define CT(a, b, w) BFLY_CT(a, b, w, q, q2, qinv, MUL_MONT)
+#define CT1(a, b) BFLY_CT_1(a, b, q2)
+
+/* The twiddle factors w^k in Montgomery form, in the order the stages
+read them */
+static const FFTSHORT W_fwd_2048_17633281[2044] = {
+	10080013, 2530145, 7052666, 13180170, 7785169, 10468608, 5575327, 3949520,
+	15218449, 16706421, 4328095, 11977081, 13010576, 16402942, 8964884, 3495343,
+	1084636, 7761256, 3965462, 7798359, 3468879, 16404043, 11186685, 16690400,
+	2283645, 3671654, 9721291, 5539070, 10045132, 17232217, 14666586, 4743086,
+	15885627, 5795173, 9261777, 12922916, 8391927, 9375846, 810936, 6074517,
+	7907879, 13087380, 8592681, 9889797, 8979699, 559608, 5506981, 8584055,
+	15705421, 4833693, 8446673, 14405088, 4024612, 4081524, 6562940, 1573805,
+	11116619, 10566860, 13403708, 13020448, 17457996, 14286233, 9473453, 6809199,
+	16928694, 4880536, 1003189, 7291082, 10081432, 13609717, 17236143, 7134047,
+	832726, 17598601, 837702, 2383340, 9607278, 16771084, 1518395, 6445099,
+	9981777, 9564586, 7478611, 4920130, 2298235, 9939337, 13945547, 6164887,
+	7341867, 9968231, 12082224, 1352163, 3797647, 9243579, 5412262, 5066451,
+	17425204, 5608831, 3957823, 11329543, 17589994, 4465486, 15025271, 426287,
+	5258683, 14563436, 9644779, 11279977, 1697021, 12081870, 3136245, 7482864,
+	7993219, 17249487, 6531052, 3881639, 4359243, 1145048, 8144640, 98458,
+	812803, 10114361, 1871304, 14800263, 9473475, 5203978, 5741133, 12031479,
+	3355857, 2617401, 1259686, 6614138, 17012456, 2350826, 7897154, 10951613,
+	5028199, 6378082, 8217314, 13102487, 3587592, 6888944, 10136507, 244198,
+	3027818, 10288034, 15434561, 13938990, 14105712, 236821, 16296739, 14608435,
+	8505957, 7323100, 9509380, 7158621, 6395531, 5455912, 564740, 2954627,
+	8556777, 2251600, 16633416, 3452654, 10008063, 820774, 6404316, 12885814,
+	3204956, 9078277, 7043890, 7498125, 9384864, 6468831, 4844618, 2401624,
+	4430875, 11629929, 11804570, 7637946, 8255857, 10130528, 2881077, 1760810,
+	4113124, 1223525, 13720277, 5474338, 17087876, 13769256, 7290119, 17026824,
+	771265, 1581104, 332885, 10644886, 7803173, 9692035, 1755064, 4977996,
+	13719683, 13548743, 1752965, 14659886, 14301207, 2149963, 9725754, 14128927,
+	6372434, 16358886, 11029708, 12827901, 12044612, 2919648, 15982149, 6801176,
+	16417770, 2676071, 10123497, 6934505, 6464198, 10261767, 4357252, 14167941,
+	6705253, 14186154, 17129002, 1067107, 6741672, 4285406, 3267227, 6070094,
+	1208515, 14052339, 3231420, 11392151, 3618461, 12406468, 14899578, 6266056,
+	11527370, 8049239, 11076143, 14314638, 809638, 12616151, 15542581, 14380487,
+	10851517, 3504480, 464283, 7733306, 1071233, 8661598, 4469632, 9073803,
+	8073284, 7947963, 15499364, 8929375, 7913284, 10653512, 1987549, 13838041,
+	11501280, 13713170, 645845, 7539359, 23718, 3899473, 17589676, 13240996,
+	403570, 7671419, 8121524, 13189272, 12123115, 1789129, 8136366, 15497108,
+	11631912, 8983547, 13145537, 5995048, 15401171, 803647, 12922554, 2744598,
+	17129267, 11387463, 4232022, 15881077, 15575927, 13092991, 16776516, 4328098,
+	12559700, 2668359, 5355379, 14094779, 16483740, 12705875, 1196724, 4736472,
+	12756691, 1226159, 13894610, 6147527, 15632112, 3697130, 2369878, 10804967,
+	3195056, 8463206, 15961255, 16464198, 8681124, 11264842, 7142093, 11688156,
+	16923620, 12819097, 6802550, 1124776, 9293274, 11091290, 11200042, 12734327,
+	7538367, 13092647, 14624901, 2928060, 9750692, 13971953, 3092554, 15777636,
+	16863420, 6585373, 8661834, 3280244, 12494752, 3029097, 5934240, 8645203,
+	12080658, 14624103, 6650935, 9988578, 7865784, 13936402, 16987110, 11438021,
+	7056066, 15172546, 6860007, 9526718, 473597, 6220912, 8017315, 6392549,
+	8230899, 525615, 16331467, 5459356, 16979955, 14920905, 4283492, 1855206,
+	9557446, 13874590, 3336314, 4276204, 3019689, 12702280, 14233956, 7841061,
+	8825655, 7917053, 13774901, 16199209, 11808539, 2578519, 8928822, 12194628,
+	918977, 10594347, 2791289, 9555222, 11036209, 5767042, 12360524, 8846225,
+	5864303, 9940999, 1684134, 7392994, 5740472, 12971820, 13275514, 3371004,
+	17136086, 13184375, 1536354, 14562522, 2595240, 17606978, 17197825, 902588,
+	1737330, 5290436, 3671028, 5703333, 6476975, 5343467, 4790987, 8190832,
+	7292899, 16166480, 15366136, 9108985, 10682996, 14784037, 8761049, 4163233,
+	16770851, 3290402, 10315214, 3978401, 16708204, 9687888, 13390086, 6656165,
+	14712924, 10902850, 9894424, 2397312, 1655133, 231760, 3248941, 4980324,
+	7366721, 11131206, 16251924, 10336900, 7060547, 9624836, 11667131, 12901133,
+	9982808, 4069704, 3370610, 17029675, 1944050, 6520586, 10900990, 1336264,
+	13690849, 9431165, 11320721, 8852218, 11824073, 4088650, 9203593, 10276978,
+	7794101, 11180279, 12812059, 15374294, 571202, 5953002, 2255262, 10730248,
+	10360059, 14076126, 2897849, 2710208, 9631442, 7364656, 3905070, 17176862,
+	14798654, 2639022, 3473941, 6135006, 11489630, 14147115, 185504, 7136336,
+	4538998, 8563637, 255451, 1904843, 9850267, 14236098, 632283, 12827456,
+	2033678, 8797483, 14808861, 4097834, 5955417, 12798251, 8154195, 4245468,
+	17453847, 2021801, 12168673, 15167482, 10862871, 10240824, 10381924, 4899123,
+	1771462, 15582870, 15460447, 3923529, 4842245, 15301, 3282138, 4144886,
+	9712255, 14018742, 2795209, 857445, 10177002, 11941861, 14776544, 11257556,
+	14572749, 13815939, 9917944, 3110493, 14133172, 2014112, 111780, 1815029,
+	6717554, 16747565, 12754941, 2275175, 4516904, 14411712, 3217851, 3565283,
+	371459, 7815563, 149008, 13838717, 13474034, 4982271, 15187551, 17312434,
+	5495623, 6948646, 7821882, 4764679, 906584, 1921474, 1049853, 12106747,
+	14643726, 8773118, 2813097, 6941739, 12445854, 16944029, 8887929, 5491489,
+	15230590, 11705860, 10784990, 2856955, 1690623, 15634940, 12158690, 10188806,
+	271369, 7457082, 8817337, 8892864, 11702570, 766509, 744155, 3120666,
+	14866729, 4152174, 8547772, 10873908, 2435843, 13985979, 5627551, 7044497,
+	13703923, 9292303, 10605271, 2429794, 8906175, 4690766, 11780123, 3228304,
+	17532291, 1188629, 7875973, 11899500, 10988764, 13853520, 8207823, 15506922,
+	7300759, 8532813, 3477212, 708046, 14447774, 12151847, 3730942, 15171649,
+	8989736, 16025426, 6271387, 6477754, 3808432, 5398445, 13731776, 16859559,
+	14985803, 5967958, 9069339, 5166981, 3312546, 2421935, 10856288, 7254524,
+	16498541, 1173491, 12738426, 4214722, 557140, 14059858, 11662038, 5394253,
+	16627513, 14971454, 5359679, 14540045, 16350934, 12551913, 968047, 6571863,
+	537619, 14113440, 2234480, 1000057, 16201681, 15788008, 15099715, 4509906,
+	7240668, 17589819, 11623700, 7034188, 10069346, 5780585, 9260267, 7681609,
+	401068, 15499041, 10856093, 4650851, 1044687, 13933846, 14327590, 6366405,
+	3407688, 17555694, 14446231, 501731, 3704784, 1751789, 15505891, 12795641,
+	12640814, 9000948, 1062231, 233244, 15196404, 8559565, 8822667, 9526802,
+	16786929, 16404613, 16084609, 8963361, 1607114, 8521249, 8857381, 9414355,
+	14747003, 5024588, 4552492, 1825030, 15191944, 552327, 2153148, 16985851,
+	7920421, 3674914, 13913582, 5274354, 13291033, 1968040, 16222099, 13604697,
+	395284, 3106312, 7409658, 3348867, 2877768, 11563450, 2845668, 2088343,
+	15729293, 15129900, 623265, 7169561, 3263577, 14303738, 5832085, 1060586,
+	4040644, 14140004, 457946, 17255202, 5523544, 15966412, 12889242, 4757349,
+	11547682, 8791098, 15008853, 15326088, 13688429, 9672665, 7622761, 15746133,
+	17529808, 6828411, 9765198, 3926304, 14766390, 8336159, 11589343, 5945172,
+	15715119, 7363407, 14085054, 8710455, 11981042, 519738, 3510830, 5222590,
+	5486804, 16426770, 4838252, 413776, 14813785, 2294885, 5901757, 7077715,
+	16946818, 9775442, 6692990, 7249063, 2179094, 989489, 3411986, 11734787,
+	15330476, 7712811, 56177, 806009, 7294847, 670475, 12222198, 12303444,
+	9004707, 8119317, 1896878, 14725550, 170435, 7765745, 5849163, 8537279,
+	12649688, 4326412, 2526880, 13644864, 7170873, 5318592, 17182960, 5883527,
+	5107979, 12260877, 12232505, 9671848, 13533476, 16829363, 10858414, 2816205,
+	11003469, 1310609, 15668130, 15841568, 7277378, 11303271, 17297174, 16053705,
+	8404136, 5825795, 7954659, 11042178, 7065860, 1079506, 16579783, 2975689,
+	13887138, 12722367, 6545952, 11575682, 9640123, 6352620, 6532095, 717233,
+	11782217, 4330903, 10676754, 13366733, 8986640, 14294172, 11304326, 16463244,
+	17374373, 2666301, 11244208, 2643398, 12801128, 2620824, 13596568, 2809530,
+	1905707, 1311729, 15702091, 10558000, 9041612, 4436442, 5390925, 10984712,
+	14549342, 5659272, 1693007, 8402012, 16530287, 12432680, 3540018, 7556086,
+	9867112, 5851517, 13111442, 14643769, 11246230, 7396422, 7292865, 15441225,
+	15022722, 10881732, 5444029, 2770692, 6364401, 2150378, 13910498, 5873576,
+	12221666, 3029840, 15041058, 9926298, 9126110, 15531866, 8309023, 2201780,
+	16067398, 16801548, 16548759, 14378266, 8595755, 13226272, 15134321, 1056456,
+	7221653, 15989880, 9381454, 8412152, 10855035, 4902162, 10066236, 13085963,
+	3779282, 16322550, 7660780, 10931981, 1158159, 9313652, 7017486, 16836631,
+	17565325, 9841881, 13761399, 15506405, 940250, 15757922, 2946221, 15953472,
+	9662951, 7863506, 610879, 11611653, 6779103, 8710897, 3776076, 4984120,
+	15731681, 2796037, 2960760, 12316632, 13372086, 2331803, 16499085, 12777571,
+	599769, 11117332, 13847488, 12307287, 14741844, 2333371, 9493318, 8907232,
+	10123009, 12083740, 7758708, 8737353, 16291820, 5626895, 14833630, 12264312,
+	9266582, 17398215, 7136318, 1043284, 83815, 13640986, 6392035, 2453009,
+	15041788, 4752913, 8201396, 7550248, 4620522, 12232178, 16699501, 12305145,
+	4317341, 15964851, 15376693, 13884650, 11513357, 2161164, 4381810, 4867924,
+	2698972, 2300404, 7974130, 13033800, 6653131, 13266942, 2040489, 3162984,
+	16181397, 14606166, 14561572, 6187554, 6974335, 6569856, 16330971, 3177180,
+	4709388, 7590097, 2538340, 17456038, 16084654, 69365, 5173388, 1507333,
+	15272682, 10274219, 12732778, 12356294, 16117642, 5666886, 16817706, 15810675,
+	14732183, 1111531, 11489415, 1781555, 12535441, 5380706, 7195424, 536891,
+	7919717, 2142143, 1616633, 5676831, 8538781, 10459584, 16385475, 8230572,
+	10080013, 1771462, 10080013, 7052666, 15460447, 7785169, 7785169, 4842245,
+	15218449, 5575327, 3282138, 13010576, 15218449, 9712255, 1084636, 4328095,
+	2795209, 3468879, 13010576, 10177002, 2283645, 8964884, 14776544, 10045132,
+	1084636, 14572749, 15885627, 3965462, 9917944, 8391927, 3468879, 14133172,
+	7907879, 11186685, 111780, 8979699, 2283645, 6717554, 15705421, 9721291,
+	12754941, 4024612, 10045132, 4516904, 11116619, 14666586, 3217851, 17457996,
+	15885627, 371459, 16928694, 9261777, 149008, 10081432, 8391927, 13474034,
+	832726, 810936, 15187551, 9607278, 7907879, 5495623, 9981777, 8592681,
+	7821882, 2298235, 8979699, 906584, 7341867, 5506981, 1049853, 3797647,
+	15705421, 14643726, 17425204, 8446673, 2813097, 17589994, 4024612, 12445854,
+	5258683, 6562940, 8887929, 1697021, 11116619, 15230590, 7993219, 13403708,
+	10784990, 4359243, 17457996, 1690623, 812803, 9473453, 12158690, 9473475,
+	16928694, 271369, 3355857, 1003189, 8817337, 17012456, 10081432, 11702570,
+	5028199, 17236143, 744155, 3587592, 832726, 14866729, 3027818, 837702,
+	8547772, 14105712, 9607278, 2435843, 8505957, 1518395, 5627551, 6395531,
+	9981777, 13703923, 8556777, 7478611, 10605271, 10008063, 2298235, 8906175,
+	3204956, 13945547, 11780123, 9384864, 7341867, 17532291, 4430875, 12082224,
+	7875973, 8255857, 3797647, 10988764, 4113124, 5412262, 8207823, 17087876,
+	17425204, 7300759, 771265, 3957823, 3477212, 7803173, 17589994, 14447774,
+	13719683, 15025271, 3730942, 14301207, 5258683, 8989736, 6372434, 9644779,
+	6271387, 12044612, 1697021, 3808432, 16417770, 3136245, 13731776, 6464198,
+	7993219, 14985803, 6705253, 6531052, 9069339, 6741672, 4359243, 3312546,
+	1208515, 8144640, 10856288, 3618461, 812803, 16498541, 11527370, 1871304,
+	12738426, 809638, 9473475, 557140, 10851517, 5741133, 11662038, 1071233,
+	3355857, 16627513, 8073284, 1259686, 5359679, 7913284, 17012456, 16350934,
+	11501280, 7897154, 968047, 23718, 5028199, 537619, 403570, 8217314,
+	2234480, 12123115, 3587592, 16201681, 11631912, 10136507, 15099715, 15401171,
+	3027818, 7240668, 17129267, 15434561, 11623700, 15575927, 14105712, 10069346,
+	12559700, 16296739, 9260267, 16483740, 8505957, 401068, 12756691, 9509380,
+	10856093, 15632112, 6395531, 1044687, 3195056, 564740, 14327590, 8681124,
+	8556777, 3407688, 16923620, 16633416, 14446231, 9293274, 10008063, 3704784,
+	7538367, 6404316, 15505891, 9750692, 3204956, 12640814, 16863420, 7043890,
+	1062231, 12494752, 9384864, 15196404, 12080658, 4844618, 8822667, 7865784,
+	4430875, 16786929, 7056066, 11804570, 16084609, 473597, 8255857, 1607114,
+	8230899, 2881077, 8857381, 16979955, 4113124, 14747003, 9557446, 13720277,
+	4552492, 3019689, 17087876, 15191944, 8825655, 7290119, 2153148, 11808539,
+	771265, 7920421, 918977, 332885, 13913582, 11036209, 7803173, 13291033,
+	5864303, 1755064, 16222099, 5740472, 13719683, 395284, 17136086, 1752965,
+	7409658, 2595240, 14301207, 2877768, 1737330, 9725754, 2845668, 6476975,
+	6372434, 15729293, 7292899, 11029708, 623265, 10682996, 12044612, 3263577,
+	16770851, 15982149, 5832085, 16708204, 16417770, 4040644, 14712924, 10123497,
+	457946, 1655133, 6464198, 5523544, 7366721, 4357252, 12889242, 7060547,
+	6705253, 11547682, 9982808, 17129002, 15008853, 1944050, 6741672, 13688429,
+	13690849, 3267227, 7622761, 11824073, 1208515, 17529808, 7794101, 3231420,
+	9765198, 571202, 3618461, 14766390, 10360059, 14899578, 11589343, 9631442,
+	11527370, 15715119, 14798654, 11076143, 14085054, 11489630, 809638, 11981042,
+	4538998, 15542581, 3510830, 9850267, 10851517, 5486804, 2033678, 464283,
+	4838252, 5955417, 1071233, 14813785, 17453847, 4469632, 5901757, 10862871,
+	8073284, 16946818, 1771462, 15499364, 6692990, 4842245, 7913284, 2179094,
+	9712255, 1987549, 3411986, 10177002, 11501280, 15330476, 14572749, 645845,
+	56177, 14133172, 23718, 7294847, 6717554, 17589676, 12222198, 4516904,
+	403570, 9004707, 371459, 8121524, 1896878, 13474034, 12123115, 170435,
+	5495623, 8136366, 5849163, 906584, 11631912, 12649688, 14643726, 13145537,
+	2526880, 12445854, 15401171, 7170873, 15230590, 12922554, 17182960, 1690623,
+	17129267, 5107979, 271369, 4232022, 12232505, 11702570, 15575927, 13533476,
+	14866729, 16776516, 10858414, 2435843, 12559700, 11003469, 13703923, 5355379,
+	15668130, 8906175, 16483740, 7277378, 17532291, 1196724, 17297174, 10988764,
+	12756691, 8404136, 7300759, 13894610, 7954659, 14447774, 15632112, 7065860,
+	8989736, 2369878, 16579783, 3808432, 3195056, 13887138, 14985803, 15961255,
+	6545952, 3312546, 8681124, 9640123, 16498541, 7142093, 6532095, 557140,
+	16923620, 11782217, 16627513, 6802550, 10676754, 16350934, 9293274, 8986640,
+	537619, 11200042, 11304326, 16201681, 7538367, 17374373, 7240668, 14624901,
+	11244208, 10069346, 9750692, 12801128, 401068, 3092554, 13596568, 1044687,
+	16863420, 1905707, 3407688, 8661834, 15702091, 3704784, 12494752, 9041612,
+	12640814, 5934240, 5390925, 15196404, 12080658, 14549342, 16786929, 6650935,
+	1693007, 1607114, 7865784, 16530287, 14747003, 16987110, 3540018, 15191944,
+	7056066, 9867112, 7920421, 6860007, 13111442, 13291033, 473597, 11246230,
+	395284, 8017315, 7292865, 2877768, 8230899, 15022722, 15729293, 16331467,
+	5444029, 3263577, 16979955, 6364401, 4040644, 4283492, 13910498, 5523544,
+	9557446, 12221666, 11547682, 3336314, 15041058, 13688429, 3019689, 9126110,
+	17529808, 14233956, 8309023, 14766390, 8825655, 16067398, 15715119, 13774901,
+	16548759, 11981042, 11808539, 8595755, 5486804, 8928822, 15134321, 14813785,
+	918977, 7221653, 16946818, 2791289, 9381454, 2179094, 11036209, 10855035,
+	15330476, 12360524, 10066236, 7294847, 5864303, 3779282, 9004707, 1684134,
+	7660780, 170435, 5740472, 1158159, 12649688, 13275514, 7017486, 7170873,
+	17136086, 17565325, 5107979, 1536354, 13761399, 13533476, 2595240, 940250,
+	11003469, 17197825, 2946221, 7277378, 1737330, 9662951, 8404136, 3671028,
+	610879, 7065860, 6476975, 6779103, 13887138, 4790987, 3776076, 9640123,
+	7292899, 15731681, 11782217, 15366136, 2960760, 8986640, 10682996, 13372086,
+	17374373, 8761049, 16499085, 12801128, 16770851, 599769, 1905707, 10315214,
+	13847488, 9041612, 16708204, 14741844, 14549342, 13390086, 9493318, 16530287,
+	14712924, 10123009, 9867112, 9894424, 7758708, 11246230, 1655133, 16291820,
+	15022722, 3248941, 14833630, 6364401, 7366721, 9266582, 12221666, 16251924,
+	7136318, 9126110, 7060547, 83815, 16067398, 11667131, 6392035, 8595755,
+	9982808, 15041788, 7221653, 3370610, 8201396, 10855035, 1944050, 4620522,
+	3779282, 10900990, 16699501, 1158159, 13690849, 4317341, 17565325, 11320721,
+	15376693, 940250, 11824073, 11513357, 9662951, 9203593, 4381810, 6779103,
+	7794101, 2698972, 15731681, 12812059, 7974130, 13372086, 571202, 6653131,
+	599769, 2255262, 2040489, 14741844, 10360059, 16181397, 10123009, 2897849,
+	14561572, 16291820, 9631442, 6974335, 9266582, 3905070, 16330971, 83815,
+	14798654, 4709388, 15041788, 3473941, 2538340, 4620522, 11489630, 16084654,
+	4317341, 185504, 5173388, 11513357, 4538998, 15272682, 2698972, 255451,
+	12732778, 6653131, 9850267, 16117642, 16181397, 632283, 16817706, 6974335,
+	2033678, 14732183, 4709388, 14808861, 11489415, 16084654, 5955417, 12535441,
+	15272682, 8154195, 7195424, 16117642, 17453847, 7919717, 14732183, 12168673,
+	1616633, 12535441, 10862871, 8538781, 7919717, 10381924, 16385475, 8538781,
+	10080013, 1771462, 10080013, 15218449, 9712255, 1084636, 1084636, 14572749,
+	15885627, 2283645, 6717554, 15705421, 15885627, 371459, 16928694, 7907879,
+	5495623, 9981777, 15705421, 14643726, 17425204, 11116619, 15230590, 7993219,
+	16928694, 271369, 3355857, 832726, 14866729, 3027818, 9981777, 13703923,
+	8556777, 7341867, 17532291, 4430875, 17425204, 7300759, 771265, 5258683,
+	8989736, 6372434, 7993219, 14985803, 6705253, 812803, 16498541, 11527370,
+	3355857, 16627513, 8073284, 5028199, 537619, 403570, 3027818, 7240668,
+	17129267, 8505957, 401068, 12756691, 8556777, 3407688, 16923620, 3204956,
+	12640814, 16863420, 4430875, 16786929, 7056066, 4113124, 14747003, 9557446,
+	771265, 7920421, 918977, 13719683, 395284, 17136086, 6372434, 15729293,
+	7292899, 16417770, 4040644, 14712924, 6705253, 11547682, 9982808, 1208515,
+	17529808, 7794101, 11527370, 15715119, 14798654, 10851517, 5486804, 2033678,
+	8073284, 16946818, 1771462, 11501280, 15330476, 14572749, 403570, 9004707,
+	371459, 11631912, 12649688, 14643726, 17129267, 5107979, 271369, 12559700,
+	11003469, 13703923, 12756691, 8404136, 7300759, 3195056, 13887138, 14985803,
+	16923620, 11782217, 16627513, 7538367, 17374373, 7240668, 16863420, 1905707,
+	3407688, 12080658, 14549342, 16786929, 7056066, 9867112, 7920421, 8230899,
+	15022722, 15729293, 9557446, 12221666, 11547682, 8825655, 16067398, 15715119,
+	918977, 7221653, 16946818, 5864303, 3779282, 9004707, 17136086, 17565325,
+	5107979, 1737330, 9662951, 8404136, 7292899, 15731681, 11782217, 16770851,
+	599769, 1905707, 14712924, 10123009, 9867112, 7366721, 9266582, 12221666,
+	9982808, 15041788, 7221653, 13690849, 4317341, 17565325, 7794101, 2698972,
+	15731681, 10360059, 16181397, 10123009, 14798654, 4709388, 15041788, 4538998,
+	15272682, 2698972, 2033678, 14732183, 4709388, 17453847, 7919717, 14732183,
+	10080013, 1771462, 10080013, 15885627, 371459, 16928694, 16928694, 271369,
+	3355857, 17425204, 7300759, 771265, 3355857, 16627513, 8073284, 8556777,
+	3407688, 16923620, 771265, 7920421, 918977, 6705253, 11547682, 9982808,
+	8073284, 16946818, 1771462, 17129267, 5107979, 271369, 16923620, 11782217,
+	16627513, 7056066, 9867112, 7920421, 918977, 7221653, 16946818, 7292899,
+	15731681, 11782217, 9982808, 15041788, 7221653, 14798654, 4709388, 15041788,
+	10080013, 1771462, 10080013, 3355857, 16627513, 8073284, 8073284, 16946818,
+	1771462, 918977, 7221653, 16946818
+};
+
+static const FFTSHORT W_bwd_2048_17633281[2044] = {
+	10080013, 10080013, 15861819, 686463, 10411628, 16714304, 15861819, 686463,
+	9559997, 9559997, 1005768, 14277424, 10080013, 10080013, 15861819, 2591493,
+	12923893, 2834627, 10411628, 2591493, 7650473, 5851064, 1901600, 10340382,
+	686463, 10411628, 16714304, 9712860, 7766169, 10577215, 1005768, 5851064,
+	709661, 17361912, 12525302, 504014, 15861819, 686463, 9559997, 7650473,
+	6085599, 10928028, 16714304, 9712860, 16862016, 709661, 14225593, 9076504,
+	9559997, 1005768, 14277424, 16862016, 10332522, 208077, 14277424, 17361912,
+	704587, 704587, 17261822, 1747654, 10080013, 10080013, 15861819, 2901098,
+	9713564, 179434, 12923893, 2901098, 15599603, 14934309, 2360599, 13094283,
+	2591493, 12923893, 2834627, 7510272, 1451884, 7273222, 1901600, 14934309,
+	9839180, 67956, 13315940, 3942432, 10411628, 2591493, 7650473, 5411615,
+	8366699, 10266560, 7766169, 7510272, 2920357, 15727574, 17033512, 862430,
+	5851064, 1901600, 10340382, 9229145, 7970330, 15895951, 12525302, 67956,
+	497195, 8628574, 13853999, 11768978, 686463, 10411628, 16714304, 1918162,
+	1565883, 8807626, 6085599, 5411615, 8075835, 1903988, 2610559, 9402382,
+	9712860, 7766169, 10577215, 846352, 3083939, 5552623, 14225593, 15727574,
+	769861, 10392613, 258908, 10094914, 1005768, 5851064, 709661, 2647478,
+	3746143, 14438225, 10332522, 9229145, 4876590, 3929358, 6629812, 5073581,
+	17361912, 12525302, 504014, 2989555, 4983593, 6001369, 17261822, 8628574,
+	17229711, 3060532, 2302805, 6132001, 15861819, 686463, 9559997, 15599603,
+	12146477, 6781764, 2834627, 1918162, 6105911, 9839180, 103473, 16424766,
+	7650473, 6085599, 10928028, 2920357, 13592637, 1215511, 10340382, 1903988,
+	11260847, 497195, 17237997, 3913598, 16714304, 9712860, 16862016, 8075835,
+	2886278, 13520157, 10577215, 846352, 13202406, 769861, 4992467, 14428325,
+	709661, 14225593, 9076504, 4876590, 17232213, 9127324, 504014, 10392613,
+	14605463, 17229711, 17095662, 12605082, 9559997, 1005768, 14277424, 6105911,
+	1134740, 16820478, 10928028, 2647478, 9640062, 11260847, 8643545, 12374598,
+	16862016, 10332522, 208077, 13202406, 100990, 10291414, 9076504, 3929358,
+	7651504, 14605463, 2766552, 16800555, 14277424, 17361912, 704587, 9640062,
+	2402691, 6516662, 208077, 2989555, 1927860, 7651504, 12137658, 9725402,
+	704587, 17261822, 1747654, 1927860, 10915727, 15349636, 1747654, 3060532,
+	16548645, 16548645, 7921026, 2414832, 10080013, 10080013, 15861819, 9094500,
+	1247806, 7251357, 9713564, 9094500, 6770410, 5097840, 16016648, 5464608,
+	2901098, 9713564, 179434, 1515639, 10437857, 9479086, 2360599, 5097840,
+	11677864, 1548627, 6143866, 2824420, 12923893, 2901098, 15599603, 10658946,
+	815575, 17000998, 1451884, 1515639, 7783014, 10980150, 4900503, 17377830,
+	14934309, 2360599, 13094283, 6119924, 12459893, 17447777, 13315940, 1548627,
+	6143651, 13012759, 15094941, 14159340, 2591493, 12923893, 2834627, 17549466,
+	1302310, 13728211, 8366699, 10658946, 8001839, 1341461, 3071709, 14735432,
+	7510272, 1451884, 7273222, 2891437, 15592792, 15378019, 17033512, 10980150,
+	17062079, 4261195, 9659151, 4821222, 1901600, 14934309, 9839180, 10854178,
+	13251471, 8429688, 7970330, 6119924, 5809208, 16693031, 2256588, 6312560,
+	67956, 13315940, 3942432, 16475122, 933780, 6732291, 13853999, 13012759,
+	15689231, 6778246, 9431885, 14262671, 10411628, 2591493, 7650473, 9037526,
+	11241246, 5966150, 1565883, 17549466, 10572734, 8507171, 10496963, 1381357,
+	5411615, 8366699, 10266560, 11268880, 2799651, 14384340, 2610559, 1341461,
+	15978148, 6387051, 9874573, 7738857, 7766169, 7510272, 2920357, 1102994,
+	8139963, 4243195, 3083939, 2891437, 925077, 8591669, 3785793, 7318067,
+	15727574, 17033512, 862430, 4832153, 1134196, 8872232, 258908, 4261195,
+	6950285, 8646641, 14672521, 2267145, 5851064, 1901600, 10340382, 7993158,
+	13857205, 12842294, 3746143, 10854178, 11156306, 10567421, 17022402, 13962253,
+	9229145, 7970330, 15895951, 10355903, 14687060, 435456, 6629812, 16693031,
+	15038041, 4099805, 3871882, 16096927, 12525302, 67956, 497195, 10462408,
+	10615795, 4357767, 4983593, 16475122, 11892809, 17462846, 9972501, 15949147,
+	8628574, 13853999, 11768978, 10338434, 7567045, 5272757, 2302805, 6778246,
+	6597072, 15454187, 8251827, 14841992, 686463, 10411628, 16714304, 2819496,
+	2498960, 8704459, 12146477, 9037526, 5824742, 5652239, 1084522, 3858380,
+	1918162, 1565883, 8807626, 2866891, 9324258, 3399325, 103473, 8507171,
+	14613592, 3944852, 2592223, 14296967, 6085599, 5411615, 8075835, 12109737,
+	3722783, 13349789, 13592637, 11268880, 653326, 14369704, 12189252, 1301814,
+	1903988, 2610559, 9402382, 14755513, 10340416, 9615966, 17237997, 6387051,
+	17159684, 4342248, 4521839, 10773274, 9712860, 7766169, 10577215, 2441337,
+	14093263, 646171, 2886278, 1102994, 9767497, 16026167, 15940274, 10982346,
+	846352, 3083939, 5552623, 2436877, 12242356, 11699041, 4992467, 8591669,
+	5138529, 13928497, 1931190, 8971447, 14225593, 15727574, 769861, 16588594,
+	4036713, 14540727, 17232213, 4832153, 7882589, 7563935, 6389073, 3008380,
+	10392613, 258908, 10094914, 1431600, 6328955, 6433239, 17095662, 8646641,
+	8340007, 1282347, 6956527, 10830731, 1005768, 5851064, 709661, 17076141,
+	11101186, 10491188, 1134740, 7993158, 8952157, 14320735, 11087329, 1672026,
+	2647478, 3746143, 14438225, 13824849, 1053498, 15263403, 8643545, 10567421,
+	2001169, 3185507, 9678622, 3738671, 10332522, 9229145, 4876590, 6644517,
+	336107, 16436557, 100990, 10355903, 1149541, 8727106, 1965151, 12277902,
+	3929358, 6629812, 5073581, 15197438, 6774867, 856765, 2766552, 4099805,
+	2057354, 5930711, 5400776, 13401259, 17361912, 12525302, 504014, 15942658,
+	450321, 4710727, 2402691, 10462408, 2232110, 5187427, 15106401, 4487744,
+	2989555, 4983593, 6001369, 16726697, 11784118, 9496915, 12137658, 17462846,
+	5510166, 4159247, 15736403, 9511757, 17261822, 8628574, 17229711, 13116377,
+	5411083, 43605, 10915727, 10338434, 17609563, 3500109, 17577104, 16987436,
+	3060532, 2302805, 6132001, 7456279, 14221295, 15645732, 7921026, 15454187,
+	9719997, 12791036, 10940291, 2133917, 15861819, 686463, 9559997, 6770410,
+	11731524, 13163649, 179434, 2819496, 16562048, 11677864, 12795029, 17168998,
+	15599603, 12146477, 6781764, 7783014, 14122451, 2090700, 13094283, 5652239,
+	16823643, 6143651, 3548227, 6557138, 2834627, 1918162, 6105911, 8001839,
+	6043938, 2733703, 7273222, 2866891, 14014820, 17062079, 7868083, 14401861,
+	9839180, 103473, 16424766, 5809208, 10010520, 14366054, 3942432, 3944852,
+	10891609, 15689231, 2624428, 504279, 7650473, 6085599, 10928028, 10572734,
+	4744039, 13276029, 10266560, 12109737, 11169083, 15978148, 17175335, 7509784,
+	2920357, 13592637, 1215511, 925077, 11801196, 1651132, 862430, 14369704,
+	5588669, 6950285, 17010016, 6603573, 10340382, 1903988, 11260847, 11156306,
+	14787613, 7907527, 15895951, 14755513, 3332074, 15038041, 10223623, 15880316,
+	497195, 17237997, 3913598, 11892809, 1411182, 15878217, 11768978, 4342248,
+	9830108, 6597072, 3719699, 17300396, 16714304, 9712860, 16862016, 5824742,
+	15480133, 10343162, 8807626, 2441337, 545405, 14613592, 13080789, 3913004,
+	8075835, 2886278, 13520157, 653326, 8775900, 14752204, 9402382, 16026167,
+	9377424, 17159684, 1548672, 5828711, 10577215, 846352, 13202406, 9767497,
+	8810614, 12788663, 5552623, 2436877, 8248417, 5138529, 16571050, 10589391,
+	769861, 4992467, 14428325, 7882589, 2127390, 11228965, 10094914, 13928497,
+	7625218, 8340007, 3187050, 999865, 709661, 14225593, 9076504, 8952157,
+	3305691, 17068541, 14438225, 16588594, 11237750, 2001169, 6777188, 8123901,
+	4876590, 17232213, 9127324, 1149541, 8373014, 1336542, 5073581, 7563935,
+	3527569, 2057354, 6009581, 2198720, 504014, 10392613, 14605463, 2232110,
+	2533566, 7496774, 6001369, 1431600, 14045689, 5510166, 15398801, 9415967,
+	17229711, 17095662, 12605082, 17609563, 16665234, 9736127, 6132001, 1282347,
+	620825, 9719997, 12273602, 16373595, 9559997, 1005768, 14277424, 16562048,
+	5971243, 11892148, 6781764, 17076141, 8159806, 16823643, 4894855, 15761977,
+	6105911, 1134740, 16820478, 14014820, 6776993, 9488641, 16424766, 14320735,
+	13274038, 10891609, 8563942, 11102229, 10928028, 2647478, 9640062, 11169083,
+	3901505, 14497036, 1215511, 13824849, 15936260, 5588669, 11361894, 7988502,
+	11260847, 8643545, 12374598, 3332074, 13902339, 2608010, 3913598, 3185507,
+	43287, 9830108, 14156069, 13675458, 16862016, 10332522, 208077, 545405,
+	9425458, 12221019, 13520157, 6644517, 13835634, 9377424, 9757308, 5551057,
+	13202406, 100990, 10291414, 8248417, 5853158, 3687734, 14428325, 8727106,
+	15335046, 7625218, 7028010, 10154670, 9076504, 3929358, 7651504, 11237750,
+	12005730, 16114886, 9127324, 15197438, 8026003, 3527569, 9085509, 16795579,
+	14605463, 2766552, 16800555, 14045689, 16889126, 397138, 12605082, 5930711,
+	7551849, 620825, 8815944, 16630092, 14277424, 17361912, 704587, 8159806,
+	5474591, 8159828, 16820478, 15942658, 175285, 13274038, 6848291, 4229573,
+	9640062, 2402691, 6516662, 15936260, 8745352, 11070341, 12374598, 5187427,
+	13608669, 43287, 14820184, 9186608, 208077, 2989555, 1927860, 13835634,
+	16583428, 12126300, 10291414, 16726697, 8653582, 15335046, 9811399, 9040600,
+	7651504, 12137658, 9725402, 8026003, 2445730, 16822345, 16800555, 4159247,
+	9241354, 7551849, 17484273, 8371504, 704587, 17261822, 1747654, 175285,
+	14415430, 2966695, 6516662, 13116377, 7588149, 13608669, 4878340, 7911990,
+	1927860, 10915727, 15349636, 8653582, 17521501, 6446596, 9725402, 3500109,
+	14164402, 9241354, 7715337, 13667819, 1747654, 3060532, 16548645, 7588149,
+	2856737, 8668397, 15349636, 7456279, 4622705, 14164402, 14838072, 13305186,
+	16548645, 7921026, 2414832, 4622705, 14351143, 12057954, 2414832, 12791036,
+	9848112, 9848112, 2172834, 10580615, 10080013, 9402709, 1247806, 7173697,
+	9094500, 11956450, 16016648, 15491138, 9713564, 17096390, 10437857, 12252575,
+	5097840, 15851726, 6143866, 16521750, 2901098, 1822606, 815575, 11966395,
+	1515639, 5276987, 4900503, 7359062, 2360599, 16125948, 12459893, 17563916,
+	1548627, 177243, 15094941, 10043184, 12923893, 14456101, 1302310, 11063425,
+	10658946, 11445727, 3071709, 3027115, 1451884, 14470297, 15592792, 4366339,
+	10980150, 4599481, 9659151, 15332877, 14934309, 12765357, 13251471, 15472117,
+	6119924, 3748631, 2256588, 1668430, 13315940, 5328136, 933780, 5401103,
+	13012759, 10083033, 9431885, 12880368, 2591493, 15180272, 11241246, 3992295,
+	17549466, 16589997, 10496963, 235066, 8366699, 5368969, 2799651, 12006386,
+	1341461, 8895928, 9874573, 5549541, 7510272, 8726049, 8139963, 15299910,
+	2891437, 5325994, 3785793, 6515949, 17033512, 4855710, 1134196, 15301478,
+	4261195, 5316649, 14672521, 14837244, 1901600, 12649161, 13857205, 8922384,
+	10854178, 6021628, 17022402, 9769775, 7970330, 1679809, 14687060, 1875359,
+	16693031, 2126876, 3871882, 7791400, 67956, 796650, 10615795, 8319629,
+	16475122, 6701300, 9972501, 1310731, 13853999, 4547318, 7567045, 12731119,
+	6778246, 9221129, 8251827, 1643401, 10411628, 16576825, 2498960, 4407009,
+	9037526, 3255015, 1084522, 831733, 1565883, 15431501, 9324258, 2101415,
+	8507171, 7706983, 2592223, 14603441, 5411615, 11759705, 3722783, 15482903,
+	11268880, 14862589, 12189252, 6751549, 2610559, 2192056, 10340416, 10236859,
+	6387051, 2989512, 4521839, 11781764, 7766169, 10077195, 14093263, 5200601,
+	1102994, 9231269, 15940274, 11974009, 3083939, 6648569, 12242356, 13196839,
+	8591669, 7075281, 1931190, 16321552, 15727574, 14823751, 4036713, 15012457,
+	4832153, 14989883, 6389073, 14966980, 258908, 1170037, 6328955, 3339109,
+	8646641, 4266548, 6956527, 13302378, 5851064, 16916048, 11101186, 11280661,
+	7993158, 6057599, 11087329, 4910914, 3746143, 14657592, 1053498, 16553775,
+	10567421, 6591103, 9678622, 11807486, 9229145, 1579576, 336107, 6330010,
+	10355903, 1791713, 1965151, 16322672, 6629812, 14817076, 6774867, 803918,
+	4099805, 7961433, 5400776, 5372404, 12525302, 11749754, 450321, 12314689,
+	10462408, 3988417, 15106401, 13306869, 4983593, 9096002, 11784118, 9867536,
+	17462846, 2907731, 15736403, 9513964, 8628574, 5329837, 5411083, 16962806,
+	10338434, 16827272, 17577104, 9920470, 2302805, 5898494, 14221295, 16643792,
+	15454187, 10384218, 10940291, 7857839, 686463, 10555566, 11731524, 15338396,
+	2819496, 17219505, 12795029, 1206511, 12146477, 12410691, 14122451, 17113543,
+	5652239, 8922826, 3548227, 10269874, 1918162, 11688109, 6043938, 9297122,
+	2866891, 13706977, 7868083, 10804870, 103473, 1887148, 10010520, 7960616,
+	3944852, 2307193, 2624428, 8842183, 6085599, 12875932, 4744039, 1666869,
+	12109737, 378079, 17175335, 3493277, 13592637, 16572695, 11801196, 3329543,
+	14369704, 10463720, 17010016, 2503381, 1903988, 15544938, 14787613, 6069831,
+	14755513, 14284414, 10223623, 14526969, 17237997, 4028584, 1411182, 15665241,
+	4342248, 12358927, 3719699, 13958367, 9712860, 647430, 15480133, 17080954,
+	2441337, 15808251, 13080789, 12608693, 2886278, 8218926, 8775900, 9112032,
+	16026167, 8669920, 1548672, 1228668, 846352, 8106479, 8810614, 9073716,
+	2436877, 17400037, 16571050, 8632333, 4992467, 4837640, 2127390, 15881492,
+	13928497, 17131550, 3187050, 77587, 14225593, 11266876, 3305691, 3699435,
+	16588594, 12982430, 6777188, 2134240, 17232213, 9951672, 8373014, 11852696,
+	7563935, 10599093, 6009581, 43462, 10392613, 13123375, 2533566, 1845273,
+	1431600, 16633224, 15398801, 3519841, 17095662, 11061418, 16665234, 5081368,
+	1282347, 3093236, 12273602, 2661827, 1005768, 12239028, 5971243, 3573423,
+	17076141, 13418559, 4894855, 16459790, 1134740, 10378757, 6776993, 15211346,
+	14320735, 12466300, 8563942, 11665323, 2647478, 773722, 3901505, 12234836,
+	13824849, 11155527, 11361894, 1607855, 8643545, 2461632, 13902339, 5481434,
+	3185507, 16925235, 14156069, 9100468, 10332522, 2126359, 9425458, 3779761,
+	6644517, 5733781, 9757308, 16444652, 100990, 14404977, 5853158, 12942515,
+	8727106, 15203487, 7028010, 8340978, 3929358, 10588784, 12005730, 3647302,
+	15197438, 6759373, 9085509, 13481107, 2766552, 14512615, 16889126, 16866772,
+	5930711, 8740417, 8815944, 10176199, 17361912, 7444475, 5474591, 1998341,
+	15942658, 14776326, 6848291, 5927421, 2402691, 12141792, 8745352, 689252,
+	5187427, 10691542, 14820184, 8860163, 2989555, 5526534, 16583428, 15711807,
+	16726697, 12868602, 9811399, 10684635, 12137658, 320847, 2445730, 12651010,
+	4159247, 3794564, 17484273, 9817718, 17261822, 14067998, 14415430, 3221569,
+	13116377, 15358106, 4878340, 885716, 10915727, 15818252, 17521501, 15619169,
+	3500109, 14522788, 7715337, 3817342, 3060532, 6375725, 2856737, 5691420,
+	7456279, 16775836, 14838072, 3614539, 7921026, 13488395, 14351143, 17617980,
+	12791036, 13709752, 2172834, 2050411, 15861819, 12734158, 7251357, 7392457,
+	6770410, 2465799, 5464608, 15611480, 179434, 13387813, 9479086, 4835030,
+	11677864, 13535447, 2824420, 8835798, 15599603, 4805825, 17000998, 3397183,
+	7783014, 15728438, 17377830, 9069644, 13094283, 10496945, 17447777, 3486166,
+	6143651, 11498275, 14159340, 14994259, 2834627, 456419, 13728211, 10268625,
+	8001839, 14923073, 14735432, 3557155, 7273222, 6903033, 15378019, 11680279,
+	17062079, 2258987, 4821222, 6453002, 9839180, 7356303, 8429688, 13544631,
+	5809208, 8781063, 6312560, 8202116, 3942432, 16297017, 6732291, 11112695,
+	15689231, 603606, 14262671, 13563577, 7650473, 4732148, 5966150, 8008445,
+	10572734, 7296381, 1381357, 6502075, 10266560, 12652957, 14384340, 17401521,
+	15978148, 15235969, 7738857, 6730431, 2920357, 10977116, 4243195, 7945393,
+	925077, 13654880, 7318067, 14342879, 862430, 13470048, 8872232, 2849244,
+	6950285, 8524296, 2267145, 1466801, 10340382, 9442449, 12842294, 12289814,
+	11156306, 11929948, 13962253, 12342845, 15895951, 16730693, 435456, 26303,
+	15038041, 3070759, 16096927, 4448906, 497195, 14262277, 4357767, 4661461,
+	11892809, 10240287, 15949147, 7692282, 11768978, 8787056, 5272757, 11866239,
+	6597072, 8078059, 14841992, 7038934, 16714304, 5438653, 8704459, 15054762,
+	5824742, 1434072, 3858380, 9716228, 8807626, 9792220, 3399325, 4931001,
+	14613592, 13357077, 14296967, 3758691, 8075835, 15778075, 13349789, 2712376,
+	653326, 12173925, 1301814, 17107666, 9402382, 11240732, 9615966, 11412369,
+	17159684, 8106563, 10773274, 2460735, 10577215, 6195260, 646171, 3696879,
+	9767497, 7644703, 10982346, 3009178, 5552623, 8988078, 11699041, 14604184,
+	5138529, 14353037, 8971447, 11047908, 769861, 1855645, 14540727, 3661328,
+	7882589, 14705221, 3008380, 4540634, 10094914, 4898954, 6433239, 6541991,
+	8340007, 16508505, 10830731, 4814184, 709661, 5945125, 10491188, 6368439,
+	8952157, 1169083, 1672026, 9170075, 14438225, 6828314, 15263403, 13936151,
+	2001169, 11485754, 3738671, 16407122, 4876590, 12896809, 16436557, 4927406,
+	1149541, 3538502, 12277902, 14964922, 5073581, 13305183, 856765, 4540290,
+	2057354, 1752204, 13401259, 6245818, 504014, 14888683, 4710727, 16829634,
+	2232110, 11638233, 4487744, 8649734, 6001369, 2136173, 9496915, 15844152,
+	5510166, 4444009, 9511757, 9961862, 17229711, 4392285, 43605, 13733808,
+	17609563, 10093922, 16987436, 3920111, 6132001, 3795240, 15645732, 6979769,
+	9719997, 8703906, 2133917, 9685318, 9559997, 8559478, 13163649, 8971683,
+	16562048, 9899975, 17168998, 14128801, 6781764, 3252794, 2090700, 5017130,
+	16823643, 3318643, 6557138, 9584042, 6105911, 11367225, 2733703, 5226813,
+	14014820, 6241130, 14401861, 3580942, 16424766, 11563187, 14366054, 13347875,
+	10891609, 16566174, 504279, 3447127, 10928028, 3465340, 13276029, 7371514,
+	11169083, 10698776, 7509784, 14957210, 1215511, 10832105, 1651132, 14713633,
+	5588669, 4805380, 6603573, 1274395, 11260847, 3504354, 7907527, 15483318,
+	3332074, 2973395, 15880316, 4084538, 3913598, 12655285, 15878217, 7941246,
+	9830108, 6988395, 17300396, 16052177, 16862016, 606457, 10343162, 3864025,
+	545405, 12158943, 3913004, 16409756, 13520157, 15872471, 14752204, 7502753,
+	9377424, 9995335, 5828711, 6003352, 13202406, 15231657, 12788663, 11164450,
+	8248417, 10135156, 10589391, 8555004, 14428325, 4747467, 11228965, 16812507,
+	7625218, 14180627, 999865, 15381681, 9076504, 14678654, 17068541, 12177369,
+	11237750, 10474660, 8123901, 10310181, 9127324, 3024846, 1336542, 17396460,
+	3527569, 3694291, 2198720, 7345247, 14605463, 17389083, 7496774, 10744337,
+	14045689, 4530794, 9415967, 11255199, 12605082, 6681668, 9736127, 15282455,
+	620825, 11019143, 16373595, 15015880, 14277424, 5601802, 11892148, 12429303,
+	8159806, 2833018, 15761977, 7518920, 16820478, 17534823, 9488641, 16488233,
+	13274038, 13751642, 11102229, 383794, 9640062, 10150417, 14497036, 5551411,
+	15936260, 6353304, 7988502, 3069845, 12374598, 17206994, 2608010, 13167795,
+	43287, 6303738, 13675458, 12024450, 208077, 12566830, 12221019, 8389702,
+	13835634, 16281118, 5551057, 7665050, 10291414, 11468394, 3687734, 7693944,
+	15335046, 12713151, 10154670, 8068695, 7651504, 11188182, 16114886, 862197,
+	8026003, 15249941, 16795579, 34680, 16800555, 10499234, 397138, 4023564,
+	7551849, 10342199, 16630092, 12752745, 704587, 10824082, 8159828, 3347048,
+	175285, 4612833, 4229573, 7066421, 6516662, 16059476, 11070341, 13551757,
+	13608669, 3228193, 9186608, 12799588, 1927860, 9049226, 12126300, 17073673,
+	8653582, 7743484, 9040600, 4545901, 9725402, 11558764, 16822345, 8257435,
+	9241354, 4710365, 8371504, 11838108, 1747654, 12890195, 2966695, 401064,
+	7588149, 12094211, 7911990, 13961627, 15349636, 942881, 6446596, 1229238,
+	14164402, 9834922, 13667819, 9872025, 16548645, 14137938, 8668397, 1230339,
+	4622705, 5656200, 13305186, 926860, 2414832, 13683761, 12057954, 7164673,
+	9848112, 4453111, 10580615, 15103136
+};
 
 /*
-We use Gentleman-Sande, decimation-in-frequency FFT, for the forward FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will invert 
-the fourier transform using decimation-in-time.
+Gentleman-Sande, decimation-in-frequency FFT, leaving the output in
+bit-reversed order for FFT_backward_2048_17633281.
+Coefficients are kept lazily reduced in [0, 2q), both on input and on output.
 */
 void FFT_forward_2048_17633281(FFTSHORT x[2048]) {
-        const FFTSHORT n = 2048;
-        const FFTSHORT q = 17633281;
-
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = 1;
-	for (m = n>>1; m >= 1; m=m>>1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {
-				ADD_MOD(t0, x[i], x[i+m], q);
-				ADD(t1, x[i], q - x[i+m]);
-				MUL_MOD(x[i+m], t1, W_2048_17633281[index], q);				
-				x[i] = t0;				
-			}
-			SUB_MODn(index, index, step, n);
+	const FFTSHORT q = 17633281, q2 = 2*17633281, qinv = 1611468799U;
+	const FFTSHORT *w = W_fwd_2048_17633281;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_forward_2048_17633281_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layer m = 1024 */
+	for (j = 0; j < 1024; ++j, w += 1) {
+		a0 = x[j]; a1 = x[j+1024];
+		GS(a0, a1, w[0]);
+		x[j] = a0; x[j+1024] = a1;
+	}
+
+	/* Layers m = 512, 256 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 1024) {
+			a0 = x[i]; a1 = x[i+256]; a2 = x[i+512]; a3 = x[i+768];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+256] = a1; x[i+512] = a2; x[i+768] = a3;
 		}
-		step = step << 1;
-	}	 
+	}
+
+	/* Layers m = 128, 64 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 32, 16 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 8, 4 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
+	}
+
+	/* Layers m = 2, 1 */
+	for (i = 0; i < 2048; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		GS1(a0, a2);
+		GS(a1, a3, 1771462);
+		GS1(a0, a1);
+		GS1(a2, a3);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
 }
 
 /*
-We use Cooley-Tukey, decimation-in-time FFT, for the inverse FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will the forward
-fourier transform is using decimation-in-frequency.
+Cooley-Tukey, decimation-in-time FFT, inverting FFT_forward_2048_17633281 up to
+the factor n.
+The output is lazily reduced to [0, 2q); callers finish the reduction.
 */
 void FFT_backward_2048_17633281(FFTSHORT x[2048]) {
-        const FFTSHORT n = 2048;
-        const FFTSHORT q = 17633281;
-
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = n>>1;
-	for (m = 1; m < n; m=m<<1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {							
-				t0 = x[i];
-				t0 -= (t0 >= q) ? q : 0;
-				MUL_MOD(t1, x[i+m], W_rev_2048_17633281[index], q);				
-				ADD(x[i], t0, t1);
-				ADD(x[i+m], t0, q - t1);
-				
-			}
-			SUB_MODn(index, index, step, n);
+	const FFTSHORT q = 17633281, q2 = 2*17633281, qinv = 1611468799U;
+	const FFTSHORT *w = W_bwd_2048_17633281;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_backward_2048_17633281_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 2048; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 15861819);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
+	}
+
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
 		}
-		step = step >> 1;
-	}	
-	for (i = 0; i < n; ++i) {
-		x[i] -= (x[i] >= q) ? q : 0;
+	}
+
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 256, 512 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 1024) {
+			a0 = x[i]; a1 = x[i+256]; a2 = x[i+512]; a3 = x[i+768];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+256] = a1; x[i+512] = a2; x[i+768] = a3;
+		}
+	}
+
+	/* Layer m = 1024 */
+	for (j = 0; j < 1024; ++j, w += 1) {
+		a0 = x[j]; a1 = x[j+1024];
+		CT(a0, a1, w[0]);
+		x[j] = a0; x[j+1024] = a1;
 	}
 }
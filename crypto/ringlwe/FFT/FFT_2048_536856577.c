@@ -0,0 +1,718 @@
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/* Generated by util/ringlwe_fft.pl: do not edit. */
+
+/* Cyclic Number Theoretic Transform mod q, for the Bluestein and Rader
+convolutions of the prime-m parameter sets.
+	n = 2048, q = 536856577	*/
+
+#include "FFT_includes.h"
+
+#define GS(a, b, w) BFLY_GS(a, b, w, q, q2, qinv, MUL_MONT)
+#define GS1(a, b) BFLY_GS_1(a, b, q2)
+#define CT(a, b, w) BFLY_CT(a, b, w, q, q2, qinv, MUL_MONT)
+#define CT1(a, b) BFLY_CT_1(a, b, q2)
+
+/* The twiddle factors w^k in Montgomery form, in the order the stages
+read them */
+static const FFTSHORT W_fwd_2048_536856577[2044] = {
+	114680, 497318421, 387611442, 34989333, 514790428, 16596165, 98839989, 67841293,
+	175929383, 366460698, 330418969, 137229208, 375036682, 262970340, 375660926, 339454037,
+	503748703, 383312431, 34350342, 11977070, 267016799, 462173697, 393462172, 309073808,
+	435104051, 494973946, 488001804, 21482305, 82117768, 281320529, 350222834, 456658111,
+	284299004, 314938137, 217883618, 242660668, 453095016, 200189821, 322937697, 12898020,
+	368575362, 159513565, 338374036, 101674568, 267511323, 512973462, 109507002, 330955959,
+	184286165, 395296481, 63208146, 122111668, 44764762, 347366302, 255737151, 293711363,
+	317817601, 142451312, 258363471, 408956900, 503423075, 205972314, 341371547, 95255255,
+	440170955, 242120872, 313341143, 352063350, 331659471, 443464516, 43189001, 479674630,
+	228415150, 441686979, 159451095, 201682340, 339657941, 99537907, 383289330, 189177997,
+	27458441, 443706677, 33046600, 505209913, 411894407, 183106258, 284728863, 286634496,
+	403756367, 324419527, 399328461, 100353062, 93167013, 484071884, 158499945, 506015789,
+	94954425, 343526396, 434150478, 480107342, 386962145, 212239612, 381879404, 436678591,
+	75520957, 516374466, 416774002, 339322370, 107243270, 16473774, 225731545, 10913671,
+	500637888, 113123081, 430091601, 98157523, 517315563, 431223154, 79562880, 368473902,
+	524809531, 288497552, 108075839, 526624953, 403633674, 154730320, 465772781, 486004794,
+	353646329, 472238001, 337945923, 486506644, 516744329, 181978865, 321363658, 179516759,
+	32431096, 198199593, 442926913, 355851913, 158757419, 468329460, 285825497, 130032405,
+	262977935, 341490141, 529018544, 462552872, 91677906, 106348430, 430785617, 101413127,
+	194044558, 207680121, 325362511, 515910631, 82995540, 490905574, 400411566, 301145295,
+	505283617, 516774700, 461320543, 532220390, 469855674, 113131275, 385097010, 512325815,
+	428126774, 341721495, 378060876, 412528101, 434784733, 210783473, 254495470, 264212936,
+	342020247, 492536861, 52567811, 484701898, 394219824, 534606041, 225914178, 172108895,
+	333810521, 242449928, 344490066, 184110948, 481003928, 329178737, 234807208, 486369356,
+	350869882, 148862145, 48929683, 169156384, 535375709, 181440750, 202320982, 451736816,
+	215676003, 131269819, 448450584, 30326785, 320051657, 381926955, 522094339, 432079814,
+	304965469, 80244019, 356151673, 384975987, 215664544, 363426709, 205491528, 54876532,
+	309790120, 212933985, 346418922, 173777055, 51919395, 142337537, 100505011, 67613112,
+	515125391, 435739426, 230507041, 534402942, 163866412, 518791221, 92974704, 334601618,
+	143269407, 249418973, 32558570, 133615091, 311252229, 500421416, 355460487, 259778746,
+	37017087, 101207435, 214701954, 81293163, 396248068, 257362114, 401614027, 428991539,
+	400950808, 519025192, 181529898, 427860997, 34708710, 62868364, 500776732, 232059581,
+	19545303, 245025723, 173523079, 346360523, 470803403, 48969277, 260330248, 39635105,
+	422036186, 396459085, 326904052, 503632995, 42592984, 351121048, 244877674, 484417911,
+	410880441, 290781, 469130164, 322256353, 494080756, 506826563, 40840447, 38940940,
+	28913414, 485505678, 390304327, 506006057, 428550481, 394110560, 275517141, 39855033,
+	409428614, 321091420, 99492237, 319452094, 425895680, 141933616, 482876194, 207652209,
+	311691345, 203568918, 172825159, 4060984, 216608595, 310157617, 424206602, 359955095,
+	531517977, 470450093, 261597839, 47280046, 34781555, 445873242, 369063478, 75153242,
+	62571016, 446074956, 89569727, 372483595, 371355299, 95381635, 182942438, 379596012,
+	305367630, 227097041, 241809771, 292948352, 82467077, 37919916, 110761508, 214749744,
+	154323938, 18765373, 486582678, 229086409, 386519389, 493306977, 117408484, 264347164,
+	226196486, 161588583, 451868870, 439381303, 414674816, 13649876, 85801887, 138660157,
+	527396436, 31495769, 342986623, 66332301, 181722640, 485259099, 139702280, 255196035,
+	148233211, 354749882, 332219258, 12261553, 467249754, 86351868, 121260830, 139880830,
+	358420780, 387231902, 268083677, 230218138, 46574037, 73467308, 79484056, 241390345,
+	272545579, 11168572, 277315164, 92960501, 232745000, 25783615, 347733419, 196933581,
+	160279721, 386041872, 73352667, 105769924, 257377070, 412786185, 533957859, 340892666,
+	152556776, 381340649, 314860507, 15449445, 494568475, 461008863, 254309848, 237691248,
+	108667271, 299759978, 443439138, 228406518, 511624979, 126867440, 429033770, 463295977,
+	428604370, 211740403, 243655713, 3580166, 37346125, 427549417, 25660114, 67168944,
+	92155962, 246790451, 417777643, 410255638, 471660930, 103653289, 272099526, 49774204,
+	86910415, 221537091, 423429709, 37561408, 327691382, 294166695, 306029634, 467329810,
+	111406770, 87108457, 33490752, 176510749, 283843561, 447037474, 478762355, 97369303,
+	51851590, 318045574, 231838558, 362939686, 469070115, 477913208, 347454078, 314270412,
+	476276466, 470320600, 62419922, 139801268, 523407948, 344014146, 267674482, 133390134,
+	449686724, 290803124, 67143745, 533156600, 369162083, 33011715, 286821422, 221190318,
+	355713930, 325404413, 456036337, 84312503, 336856292, 176885436, 392082008, 175625799,
+	338401698, 516904023, 525547098, 359822604, 346181837, 152246253, 68183281, 424215867,
+	198812246, 53081522, 444229140, 460012808, 28374036, 52293376, 435414164, 135282597,
+	375481758, 528820406, 435440269, 47167671, 419850877, 193900076, 91136840, 95301251,
+	49093824, 89102690, 534833168, 231104195, 359194678, 226888042, 422604501, 109609749,
+	65191066, 131487735, 266060850, 222260760, 192899582, 396228963, 375833065, 267241441,
+	389480253, 234015299, 420971605, 329683225, 382502264, 185046522, 431237933, 398659996,
+	87108556, 288926947, 292502658, 109208125, 148830830, 517093486, 45290408, 23115206,
+	466029624, 29518239, 222770551, 135427450, 104412890, 358448185, 36326235, 165358412,
+	9825620, 466296757, 288725762, 158226610, 193069999, 289705956, 33530303, 227233897,
+	513182133, 356775137, 189648867, 324637636, 123825785, 458761947, 227494139, 58014182,
+	92387811, 299300604, 410855840, 417041862, 158775907, 119018797, 174504860, 54067973,
+	37974251, 10853950, 228231878, 291142098, 114459990, 174639842, 397842080, 351836175,
+	218889983, 379092424, 430003780, 509178621, 282026865, 406905042, 490363318, 518418007,
+	434030708, 363358187, 418354484, 240908427, 356941165, 211728191, 29640486, 309997159,
+	23639568, 82524708, 167048340, 466560951, 280181217, 348591406, 522040706, 293446188,
+	40258263, 413281876, 146911731, 529475098, 214478740, 535978840, 260316240, 408373624,
+	175114921, 297210072, 310611868, 394309383, 372707370, 469380432, 172792178, 116043278,
+	168922815, 475406647, 201274435, 382638263, 224538394, 326083373, 179257837, 493323326,
+	40671590, 152229004, 409445546, 18718704, 431834618, 369053437, 18188278, 466928597,
+	344464425, 59495414, 503067809, 463804193, 162980916, 222024813, 417889262, 75593523,
+	374734277, 495031036, 332934438, 160982088, 304719484, 288545988, 264436528, 130559255,
+	534490310, 113259035, 402281255, 477135945, 426098291, 94493818, 399546002, 251872473,
+	203642081, 530366239, 65975609, 84413788, 306336786, 81376448, 287670212, 9821629,
+	32925639, 504088627, 300534278, 311681410, 496020406, 462773174, 268592015, 528823152,
+	259448702, 162640601, 423900095, 278956043, 216198435, 142037746, 531801316, 343608060,
+	36693331, 361470648, 30741826, 522759765, 445566883, 127649266, 410441592, 123822757,
+	69831194, 497428783, 356190784, 433791042, 48784982, 333513096, 227678479, 52133552,
+	493924609, 4161774, 519477845, 171545661, 119258832, 74614414, 34386263, 181172595,
+	180266939, 332931756, 122508565, 383532684, 90259229, 436692386, 68236937, 334785189,
+	13261221, 346475422, 150365254, 514216689, 494666549, 268929056, 393278410, 22189861,
+	412518886, 193501978, 270595854, 78638040, 115831918, 326057477, 389071837, 395572361,
+	185869303, 523143112, 322931781, 40928500, 58411189, 297418612, 409676353, 39867317,
+	516384759, 99032179, 230216921, 349988957, 19553780, 241522626, 322756894, 262281161,
+	353117092, 364852609, 215163185, 350093526, 56961244, 116366937, 216931486, 247464483,
+	12257186, 354362030, 99782729, 129679681, 290247928, 397463194, 238809864, 342662889,
+	85105459, 500744338, 172109057, 361355875, 432254870, 205138419, 281798160, 153286450,
+	243958727, 431809751, 435694214, 410241416, 114715043, 381461539, 436466626, 162924919,
+	19453866, 425623135, 235056153, 290903649, 33328442, 143711982, 222573562, 502518590,
+	511350819, 11665192, 15090444, 534882030, 201412463, 283293487, 289555112, 399411480,
+	178521479, 11177346, 503264075, 53313466, 161615907, 87190526, 241753567, 532386410,
+	384528990, 464919080, 260012716, 112146530, 73993717, 335662587, 33324585, 435678344,
+	475634115, 489792927, 313093694, 231902627, 493144151, 136057702, 314322045, 69380365,
+	300580302, 296525307, 495109478, 163090306, 25332031, 214717896, 445697959, 105527936,
+	442748086, 291690180, 370675210, 246471412, 121375660, 503635593, 27016577, 352842663,
+	396119381, 142207963, 424410994, 65231863, 268142742, 285036724, 292976784, 98393262,
+	184052560, 388856960, 40862955, 512348174, 511666840, 53393932, 322662949, 56202839,
+	518375741, 438640831, 532073230, 368541874, 443775603, 412477855, 136360699, 514313863,
+	30255536, 427138872, 57191878, 499143512, 397042349, 494103194, 40431227, 143325738,
+	104481561, 535452397, 84518752, 278350125, 299715298, 249680967, 14473560, 490315525,
+	405109979, 450094112, 285845036, 469771618, 70730073, 87210952, 142432646, 365316764,
+	13472774, 96227818, 403174974, 44541387, 251075799, 50473478, 354553190, 391905829,
+	230318632, 133417030, 244209299, 68921264, 175230988, 89208358, 295156825, 439164167,
+	332018790, 377687163, 496413280, 475402523, 129704742, 143919960, 292358063, 86124712,
+	263580611, 217071273, 142326328, 467960189, 415816571, 66139800, 138791067, 424026748,
+	465818087, 494577859, 286960652, 153900934, 278117452, 458374438, 305237587, 159748152,
+	107486614, 320154073, 503947674, 320087500, 40770479, 165004722, 489234572, 106278740,
+	531212138, 231290900, 430677120, 476456858, 71519568, 491096986, 317827879, 160179801,
+	489587875, 336526498, 437807238, 232224029, 303201127, 186620148, 88349801, 370220285,
+	353974266, 511955711, 111598805, 315918988, 324200486, 509732476, 200898943, 203801801,
+	149290844, 15595615, 188946633, 44158599, 362713632, 374583342, 176025449, 58301733,
+	144868405, 177615395, 323043082, 268586760, 304713234, 127228250, 517357809, 158098011,
+	185668782, 177003919, 409300090, 246908374, 432567243, 123676018, 252192795, 9015556,
+	389275559, 232157768, 270862205, 39183244, 328083675, 22426791, 500484591, 293888252,
+	131989592, 523139107, 238456726, 180237738, 192878015, 208752149, 518382746, 536125611,
+	507578671, 457073339, 313339664, 359070970, 388332572, 75298345, 463657013, 330008673,
+	290633509, 203987514, 323842719, 474868878, 432688989, 463736876, 448176517, 90006226,
+	372974812, 45435821, 291331397, 116663021, 480894462, 42371020, 408585011, 380475536,
+	415179039, 361516956, 70502968, 377387457, 458328689, 254479176, 5652981, 101023241,
+	33315922, 89418063, 466380492, 316313509, 437922075, 153102472, 278252026, 156151330,
+	320024442, 62585850, 429875223, 528802369, 397485709, 269340778, 58158263, 193770711,
+	114680, 87108556, 114680, 387611442, 292502658, 514790428, 514790428, 148830830,
+	175929383, 98839989, 45290408, 375036682, 175929383, 466029624, 503748703, 330418969,
+	222770551, 267016799, 375036682, 104412890, 435104051, 375660926, 36326235, 82117768,
+	503748703, 9825620, 284299004, 34350342, 288725762, 453095016, 267016799, 193069999,
+	368575362, 393462172, 33530303, 267511323, 435104051, 513182133, 184286165, 488001804,
+	189648867, 44764762, 82117768, 123825785, 317817601, 350222834, 227494139, 503423075,
+	284299004, 92387811, 440170955, 217883618, 410855840, 331659471, 453095016, 158775907,
+	228415150, 322937697, 174504860, 339657941, 368575362, 37974251, 27458441, 338374036,
+	228231878, 411894407, 267511323, 114459990, 403756367, 109507002, 397842080, 93167013,
+	184286165, 218889983, 94954425, 63208146, 430003780, 386962145, 44764762, 282026865,
+	75520957, 255737151, 490363318, 107243270, 317817601, 434030708, 500637888, 258363471,
+	418354484, 517315563, 503423075, 356941165, 524809531, 341371547, 29640486, 403633674,
+	440170955, 23639568, 353646329, 313341143, 167048340, 516744329, 331659471, 280181217,
+	32431096, 43189001, 522040706, 158757419, 228415150, 40258263, 262977935, 159451095,
+	146911731, 91677906, 339657941, 214478740, 194044558, 383289330, 260316240, 82995540,
+	27458441, 175114921, 505283617, 33046600, 310611868, 469855674, 411894407, 372707370,
+	428126774, 284728863, 172792178, 434784733, 403756367, 168922815, 342020247, 399328461,
+	201274435, 394219824, 93167013, 224538394, 333810521, 158499945, 179257837, 481003928,
+	94954425, 40671590, 350869882, 434150478, 409445546, 535375709, 386962145, 431834618,
+	215676003, 381879404, 18188278, 320051657, 75520957, 344464425, 304965469, 416774002,
+	503067809, 215664544, 107243270, 162980916, 309790120, 225731545, 417889262, 51919395,
+	500637888, 374734277, 515125391, 430091601, 332934438, 163866412, 517315563, 304719484,
+	143269407, 79562880, 264436528, 311252229, 524809531, 534490310, 37017087, 108075839,
+	402281255, 396248068, 403633674, 426098291, 400950808, 465772781, 399546002, 34708710,
+	353646329, 203642081, 19545303, 337945923, 65975609, 470803403, 516744329, 306336786,
+	422036186, 321363658, 287670212, 42592984, 32431096, 32925639, 410880441, 442926913,
+	300534278, 494080756, 158757419, 496020406, 28913414, 285825497, 268592015, 428550481,
+	262977935, 259448702, 409428614, 529018544, 423900095, 425895680, 91677906, 216198435,
+	311691345, 430785617, 531801316, 216608595, 194044558, 36693331, 531517977, 325362511,
+	30741826, 34781555, 82995540, 445566883, 62571016, 400411566, 410441592, 371355299,
+	505283617, 69831194, 305367630, 461320543, 356190784, 82467077, 469855674, 48784982,
+	154323938, 385097010, 227678479, 386519389, 428126774, 493924609, 226196486, 378060876,
+	519477845, 414674816, 434784733, 119258832, 527396436, 254495470, 34386263, 181722640,
+	342020247, 180266939, 148233211, 52567811, 122508565, 467249754, 394219824, 90259229,
+	358420780, 225914178, 68236937, 46574037, 333810521, 13261221, 272545579, 344490066,
+	150365254, 232745000, 481003928, 494666549, 160279721, 234807208, 393278410, 257377070,
+	350869882, 412518886, 152556776, 48929683, 270595854, 494568475, 535375709, 115831918,
+	108667271, 202320982, 389071837, 511624979, 215676003, 185869303, 428604370, 448450584,
+	322931781, 37346125, 320051657, 58411189, 92155962, 522094339, 409676353, 471660930,
+	304965469, 516384759, 86910415, 356151673, 230216921, 327691382, 215664544, 19553780,
+	111406770, 205491528, 322756894, 283843561, 309790120, 353117092, 51851590, 346418922,
+	215163185, 469070115, 51919395, 56961244, 476276466, 100505011, 216931486, 523407948,
+	515125391, 12257186, 449686724, 230507041, 99782729, 369162083, 163866412, 290247928,
+	355713930, 92974704, 238809864, 336856292, 143269407, 85105459, 338401698, 32558570,
+	172109057, 346181837, 311252229, 432254870, 198812246, 355460487, 281798160, 28374036,
+	37017087, 243958727, 375481758, 214701954, 435694214, 419850877, 396248068, 114715043,
+	49093824, 401614027, 436466626, 359194678, 400950808, 19453866, 65191066, 181529898,
+	235056153, 192899582, 34708710, 33328442, 389480253, 500776732, 222573562, 382502264,
+	19545303, 511350819, 87108556, 173523079, 15090444, 148830830, 470803403, 201412463,
+	466029624, 260330248, 289555112, 104412890, 422036186, 178521479, 9825620, 326904052,
+	503264075, 193069999, 42592984, 161615907, 513182133, 244877674, 241753567, 123825785,
+	410880441, 384528990, 92387811, 469130164, 260012716, 158775907, 494080756, 73993717,
+	37974251, 40840447, 33324585, 114459990, 28913414, 475634115, 218889983, 390304327,
+	313093694, 282026865, 428550481, 493144151, 434030708, 275517141, 314322045, 356941165,
+	409428614, 300580302, 23639568, 99492237, 495109478, 280181217, 425895680, 25332031,
+	40258263, 482876194, 445697959, 214478740, 311691345, 442748086, 175114921, 172825159,
+	370675210, 372707370, 216608595, 121375660, 168922815, 424206602, 27016577, 224538394,
+	531517977, 396119381, 40671590, 261597839, 424410994, 431834618, 34781555, 268142742,
+	344464425, 369063478, 292976784, 162980916, 62571016, 184052560, 374734277, 89569727,
+	40862955, 304719484, 371355299, 511666840, 534490310, 182942438, 322662949, 426098291,
+	305367630, 518375741, 203642081, 241809771, 532073230, 306336786, 82467077, 443775603,
+	32925639, 110761508, 136360699, 496020406, 154323938, 30255536, 259448702, 486582678,
+	57191878, 216198435, 386519389, 397042349, 36693331, 117408484, 40431227, 445566883,
+	226196486, 104481561, 69831194, 451868870, 84518752, 48784982, 414674816, 299715298,
+	493924609, 85801887, 14473560, 119258832, 527396436, 405109979, 180266939, 342986623,
+	285845036, 90259229, 181722640, 70730073, 13261221, 139702280, 142432646, 494666549,
+	148233211, 13472774, 412518886, 332219258, 403174974, 115831918, 467249754, 251075799,
+	185869303, 121260830, 354553190, 58411189, 358420780, 230318632, 516384759, 268083677,
+	244209299, 19553780, 46574037, 175230988, 353117092, 79484056, 295156825, 56961244,
+	272545579, 332018790, 12257186, 277315164, 496413280, 290247928, 232745000, 129704742,
+	85105459, 347733419, 292358063, 432254870, 160279721, 263580611, 243958727, 73352667,
+	142326328, 114715043, 257377070, 415816571, 19453866, 533957859, 138791067, 33328442,
+	152556776, 465818087, 511350819, 314860507, 286960652, 201412463, 494568475, 278117452,
+	178521479, 254309848, 305237587, 161615907, 108667271, 107486614, 384528990, 443439138,
+	503947674, 73993717, 511624979, 40770479, 475634115, 429033770, 489234572, 493144151,
+	428604370, 531212138, 300580302, 243655713, 430677120, 25332031, 37346125, 71519568,
+	442748086, 25660114, 317827879, 121375660, 92155962, 489587875, 396119381, 417777643,
+	437807238, 268142742, 471660930, 303201127, 184052560, 272099526, 88349801, 511666840,
+	86910415, 353974266, 518375741, 423429709, 111598805, 443775603, 327691382, 324200486,
+	30255536, 306029634, 200898943, 397042349, 111406770, 149290844, 104481561, 33490752,
+	188946633, 299715298, 283843561, 362713632, 405109979, 478762355, 176025449, 70730073,
+	51851590, 144868405, 13472774, 231838558, 323043082, 251075799, 469070115, 304713234,
+	230318632, 347454078, 517357809, 175230988, 476276466, 185668782, 332018790, 62419922,
+	409300090, 129704742, 523407948, 432567243, 263580611, 267674482, 252192795, 415816571,
+	449686724, 389275559, 465818087, 67143745, 270862205, 278117452, 369162083, 328083675,
+	107486614, 286821422, 500484591, 40770479, 355713930, 131989592, 531212138, 456036337,
+	238456726, 71519568, 336856292, 192878015, 489587875, 392082008, 518382746, 303201127,
+	338401698, 507578671, 353974266, 525547098, 313339664, 324200486, 346181837, 388332572,
+	149290844, 68183281, 463657013, 362713632, 198812246, 290633509, 144868405, 444229140,
+	323842719, 304713234, 28374036, 432688989, 185668782, 435414164, 448176517, 432567243,
+	375481758, 372974812, 389275559, 435440269, 291331397, 328083675, 419850877, 480894462,
+	131989592, 91136840, 408585011, 192878015, 49093824, 415179039, 507578671, 534833168,
+	70502968, 388332572, 359194678, 458328689, 290633509, 422604501, 5652981, 432688989,
+	65191066, 33315922, 372974812, 266060850, 466380492, 480894462, 192899582, 437922075,
+	415179039, 375833065, 278252026, 458328689, 389480253, 320024442, 33315922, 420971605,
+	429875223, 437922075, 382502264, 397485709, 320024442, 431237933, 58158263, 397485709,
+	114680, 87108556, 114680, 175929383, 466029624, 503748703, 503748703, 9825620,
+	284299004, 435104051, 513182133, 184286165, 284299004, 92387811, 440170955, 368575362,
+	37974251, 27458441, 184286165, 218889983, 94954425, 317817601, 434030708, 500637888,
+	440170955, 23639568, 353646329, 228415150, 40258263, 262977935, 27458441, 175114921,
+	505283617, 403756367, 168922815, 342020247, 94954425, 40671590, 350869882, 75520957,
+	344464425, 304965469, 500637888, 374734277, 515125391, 524809531, 534490310, 37017087,
+	353646329, 203642081, 19545303, 32431096, 32925639, 410880441, 262977935, 259448702,
+	409428614, 194044558, 36693331, 531517977, 505283617, 69831194, 305367630, 428126774,
+	493924609, 226196486, 342020247, 180266939, 148233211, 333810521, 13261221, 272545579,
+	350869882, 412518886, 152556776, 215676003, 185869303, 428604370, 304965469, 516384759,
+	86910415, 309790120, 353117092, 51851590, 515125391, 12257186, 449686724, 143269407,
+	85105459, 338401698, 37017087, 243958727, 375481758, 400950808, 19453866, 65191066,
+	19545303, 511350819, 87108556, 422036186, 178521479, 9825620, 410880441, 384528990,
+	92387811, 28913414, 475634115, 218889983, 409428614, 300580302, 23639568, 311691345,
+	442748086, 175114921, 531517977, 396119381, 40671590, 62571016, 184052560, 374734277,
+	305367630, 518375741, 203642081, 154323938, 30255536, 259448702, 226196486, 104481561,
+	69831194, 527396436, 405109979, 180266939, 148233211, 13472774, 412518886, 358420780,
+	230318632, 516384759, 272545579, 332018790, 12257186, 160279721, 263580611, 243958727,
+	152556776, 465818087, 511350819, 108667271, 107486614, 384528990, 428604370, 531212138,
+	300580302, 92155962, 489587875, 396119381, 86910415, 353974266, 518375741, 111406770,
+	149290844, 104481561, 51851590, 144868405, 13472774, 476276466, 185668782, 332018790,
+	449686724, 389275559, 465818087, 355713930, 131989592, 531212138, 338401698, 507578671,
+	353974266, 198812246, 290633509, 144868405, 375481758, 372974812, 389275559, 49093824,
+	415179039, 507578671, 65191066, 33315922, 372974812, 389480253, 320024442, 33315922,
+	114680, 87108556, 114680, 284299004, 92387811, 440170955, 440170955, 23639568,
+	353646329, 94954425, 40671590, 350869882, 353646329, 203642081, 19545303, 505283617,
+	69831194, 305367630, 350869882, 412518886, 152556776, 515125391, 12257186, 449686724,
+	19545303, 511350819, 87108556, 409428614, 300580302, 23639568, 305367630, 518375741,
+	203642081, 148233211, 13472774, 412518886, 152556776, 465818087, 511350819, 86910415,
+	353974266, 518375741, 449686724, 389275559, 465818087, 375481758, 372974812, 389275559,
+	114680, 87108556, 114680, 353646329, 203642081, 19545303, 19545303, 511350819,
+	87108556, 152556776, 465818087, 511350819
+};
+
+static const FFTSHORT W_bwd_2048_536856577[2044] = {
+	114680, 114680, 449748021, 25505758, 71038490, 384299801, 449748021, 25505758,
+	517311274, 517311274, 333214496, 183210248, 114680, 114680, 449748021, 147581018,
+	163881765, 161374819, 71038490, 147581018, 87169853, 18480836, 182882311, 449946162,
+	25505758, 71038490, 384299801, 124337691, 523383803, 388623366, 333214496, 18480836,
+	231488947, 513217009, 236276275, 127427963, 449748021, 25505758, 517311274, 87169853,
+	524599391, 21731186, 384299801, 124337691, 185986695, 231488947, 467025383, 31572960,
+	517311274, 333214496, 183210248, 185986695, 496184987, 441902152, 183210248, 513217009,
+	96685622, 96685622, 444468766, 252557573, 114680, 114680, 449748021, 503540655,
+	216832135, 147376324, 163881765, 503540655, 471665511, 29277906, 121677538, 487762753,
+	147581018, 163881765, 161374819, 391988172, 246223068, 338044331, 182882311, 29277906,
+	198454879, 5644439, 404866985, 181142647, 71038490, 147581018, 87169853, 204837787,
+	351187795, 60580111, 523383803, 391988172, 485004987, 432375016, 387565733, 425449807,
+	18480836, 182882311, 449946162, 140737196, 47268702, 444700615, 236276275, 5644439,
+	108252207, 152327587, 429369963, 428189306, 25505758, 71038490, 384299801, 292897850,
+	273275966, 376576856, 524599391, 204837787, 264310998, 20471818, 306537945, 178435797,
+	124337691, 523383803, 388623366, 356589638, 131746598, 9460141, 467025383, 432375016,
+	310660091, 277407875, 506601041, 382532639, 333214496, 18480836, 231488947, 162122300,
+	352804017, 474285561, 496184987, 140737196, 5338600, 361741656, 94108491, 225165232,
+	513217009, 236276275, 127427963, 317966594, 61222462, 507943163, 444468766, 152327587,
+	125976136, 527030957, 358335098, 114820391, 449748021, 25505758, 517311274, 471665511,
+	517402711, 135905769, 161374819, 292897850, 499839490, 198454879, 451751118, 393587170,
+	87169853, 524599391, 21731186, 485004987, 183739485, 227066457, 449946162, 20471818,
+	231891108, 108252207, 350987274, 321180574, 384299801, 124337691, 185986695, 264310998,
+	523595356, 203046056, 388623366, 356589638, 194836330, 310660091, 42931968, 108729803,
+	231488947, 467025383, 31572960, 5338600, 500163246, 342812019, 127427963, 277407875,
+	273878642, 125976136, 503930938, 504425481, 517311274, 333214496, 183210248, 499839490,
+	2366267, 12047046, 21731186, 162122300, 36218689, 231891108, 192392152, 461335620,
+	185986695, 496184987, 441902152, 194836330, 367933762, 133100210, 31572960, 361741656,
+	509398136, 273878642, 496598314, 308441427, 183210248, 513217009, 96685622, 36218689,
+	102825869, 219038976, 441902152, 317966594, 352570412, 509398136, 498882326, 168281215,
+	96685622, 444468766, 252557573, 352570412, 23674444, 101752526, 252557573, 527030957,
+	33107874, 33107874, 70826953, 360927194, 114680, 114680, 449748021, 139370868,
+	478698314, 105618644, 216832135, 139370868, 154354313, 98934502, 106981354, 115884972,
+	503540655, 216832135, 147376324, 78527888, 258604551, 161023512, 121677538, 98934502,
+	343956995, 55962115, 70476085, 270795727, 163881765, 503540655, 471665511, 104167588,
+	531203596, 114252076, 246223068, 78527888, 177661899, 148524005, 466353609, 2023409,
+	29277906, 121677538, 487762753, 343978562, 128271566, 445719737, 404866985, 55962115,
+	117005700, 208772902, 245525180, 101416308, 147581018, 163881765, 161374819, 104289334,
+	88680060, 101442413, 351187795, 104167588, 508482541, 232143343, 213013858, 92627437,
+	391988172, 246223068, 338044331, 174142945, 73199564, 468673296, 387565733, 148524005,
+	190674740, 212656091, 223516913, 11309479, 182882311, 29277906, 198454879, 233655450,
+	18473831, 144774569, 47268702, 343978562, 200000285, 465337009, 298399851, 80820240,
+	5644439, 404866985, 181142647, 496086098, 36371986, 250035155, 429369963, 208772902,
+	167694494, 258739125, 265994372, 469712832, 71038490, 147581018, 87169853, 121040006,
+	284663782, 269182095, 273275966, 104289334, 13448629, 407151835, 127556487, 474436655,
+	204837787, 351187795, 60580111, 361625589, 19498768, 189402499, 306537945, 232143343,
+	67786462, 285780778, 213813495, 305018019, 523383803, 391988172, 485004987, 466126504,
+	360831128, 58094222, 131746598, 174142945, 253013016, 237141279, 347909944, 503365825,
+	432375016, 387565733, 425449807, 139814228, 335957634, 230826943, 506601041, 212656091,
+	209165195, 93080974, 425257772, 113426868, 18480836, 182882311, 449946162, 25189737,
+	448506776, 264757051, 352804017, 233655450, 65195647, 268713835, 99049339, 119078934,
+	140737196, 47268702, 444700615, 415480917, 219028698, 511196463, 94108491, 465337009,
+	499510452, 511524546, 106179457, 293200864, 236276275, 5644439, 108252207, 43712426,
+	47622005, 107822807, 61222462, 496086098, 25231598, 462862860, 32908903, 93417439,
+	152327587, 429369963, 428189306, 375240670, 231618990, 282546729, 358335098, 258739125,
+	42288102, 335444114, 249895925, 221996070, 25505758, 71038490, 384299801, 503528135,
+	398065510, 2898718, 517402711, 121040006, 279479507, 422141534, 394530249, 463503910,
+	292897850, 273275966, 376576856, 104601707, 244498514, 189123158, 451751118, 407151835,
+	304111577, 246608649, 40443297, 259541413, 524599391, 204837787, 264310998, 479895333,
+	241699752, 457372521, 183739485, 361625589, 490282540, 517302797, 292647278, 268772900,
+	20471818, 306537945, 178435797, 478445388, 182303387, 415595747, 350987274, 285780778,
+	69606823, 421024659, 133681603, 204637319, 124337691, 523383803, 388623366, 42190028,
+	394423931, 397154297, 523595356, 466126504, 355133937, 446597348, 251011541, 193869954,
+	356589638, 131746598, 9460141, 417597745, 522383017, 451054690, 42931968, 237141279,
+	122181761, 488071595, 452337825, 84987707, 467025383, 432375016, 310660091, 91289694,
+	496425350, 419448093, 500163246, 139814228, 150337188, 320658142, 479664699, 50273899,
+	277407875, 506601041, 382532639, 40836171, 400495878, 426095069, 503930938, 93080974,
+	454389500, 230519791, 4783347, 295046806, 333214496, 18480836, 231488947, 110758286,
+	214193628, 353914139, 2366267, 25189737, 165501278, 232137093, 495993622, 447286850,
+	162122300, 352804017, 474285561, 373875661, 243879793, 167793099, 192392152, 268713835,
+	502075022, 105021959, 112445583, 275258738, 496184987, 140737196, 5338600, 312318183,
+	509840000, 112649975, 367933762, 415480917, 320247982, 164149207, 166181367, 364031418,
+	361741656, 94108491, 225165232, 322377837, 91158618, 53980383, 496598314, 511524546,
+	110960897, 256675360, 41747099, 437364340, 513217009, 236276275, 127427963, 179915412,
+	222534532, 261339436, 102825869, 43712426, 108306096, 254829712, 223762883, 146552250,
+	317966594, 61222462, 507943163, 422396587, 503531992, 496016130, 498882326, 462862860,
+	42775821, 378080670, 276843861, 67726413, 444468766, 152327587, 125976136, 413030792,
+	295103010, 291978903, 23674444, 375240670, 494263593, 343786578, 33592502, 209952525,
+	527030957, 358335098, 114820391, 432443687, 247301465, 276526329, 70826953, 335444114,
+	66053174, 388025747, 521766133, 363333498, 449748021, 25505758, 517311274, 154354313,
+	314283015, 36079845, 147376324, 503528135, 502147867, 343956995, 301800424, 355326679,
+	471665511, 517402711, 135905769, 177661899, 100389951, 135242550, 487762753, 422141534,
+	140608509, 117005700, 101162363, 322154623, 161374819, 292897850, 499839490, 508482541,
+	255058417, 181396090, 338044331, 104601707, 225604348, 190674740, 364747520, 504298007,
+	198454879, 451751118, 393587170, 200000285, 298046713, 443881873, 181142647, 246608649,
+	372990165, 167694494, 437073848, 306349536, 87169853, 524599391, 21731186, 13448629,
+	319925091, 436351566, 60580111, 479895333, 484937182, 67786462, 321693392, 190437655,
+	485004987, 183739485, 227066457, 253013016, 214099683, 331365049, 425449807, 517302797,
+	321192033, 209165195, 306639656, 180704904, 449946162, 20471818, 231891108, 65195647,
+	127180224, 14762238, 444700615, 478445388, 216804920, 499510452, 213924796, 88405993,
+	108252207, 350987274, 321180574, 25231598, 147784740, 334535595, 428189306, 421024659,
+	1480868, 42288102, 266260723, 487926894, 384299801, 124337691, 185986695, 279479507,
+	143578167, 302049369, 376576856, 42190028, 55852649, 304111577, 386491323, 192366511,
+	264310998, 523595356, 203046056, 490282540, 468619640, 310942399, 178435797, 446597348,
+	142636753, 69606823, 414348012, 484288766, 388623366, 356589638, 194836330, 355133937,
+	502470314, 282361107, 9460141, 417597745, 102071844, 122181761, 17378732, 158795701,
+	310660091, 42931968, 108729803, 150337188, 309178098, 151759567, 382532639, 488071595,
+	67000903, 454389500, 180665793, 75536034, 231488947, 467025383, 31572960, 165501278,
+	126414985, 136445011, 474285561, 91289694, 453861037, 502075022, 506114751, 211494066,
+	5338600, 500163246, 342812019, 320247982, 5055261, 106070960, 225165232, 320658142,
+	445178671, 110960897, 112956482, 7838033, 127427963, 277407875, 273878642, 108306096,
+	268264562, 251031080, 507943163, 40836171, 378099158, 42775821, 236322299, 93929664,
+	125976136, 503930938, 504425481, 494263593, 249186365, 215492919, 114820391, 230519791,
+	20112248, 66053174, 470880968, 198910654, 517311274, 333214496, 183210248, 502147867,
+	137310575, 71083796, 135905769, 110758286, 133222903, 140608509, 134575322, 428780738,
+	499839490, 2366267, 12047046, 225604348, 272420049, 457293697, 393587170, 232137093,
+	19541014, 372990165, 203922139, 106764976, 21731186, 162122300, 36218689, 484937182,
+	118967315, 311125032, 227066457, 373875661, 429613307, 321192033, 33788768, 120082575,
+	231891108, 192392152, 461335620, 216804920, 518668299, 154977173, 321180574, 105021959,
+	149894432, 1480868, 127411031, 102706099, 185986695, 496184987, 441902152, 55852649,
+	357598740, 378356632, 203046056, 312318183, 443689564, 142636753, 335582142, 137528116,
+	194836330, 367933762, 133100210, 102071844, 364064399, 252127714, 108729803, 164149207,
+	124962170, 67000903, 226244709, 503809977, 31572960, 361741656, 509398136, 453861037,
+	276540337, 153567247, 342812019, 322377837, 197198636, 445178671, 389944846, 377405482,
+	273878642, 496598314, 308441427, 378099158, 14815871, 493667576, 504425481, 256675360,
+	205197106, 20112248, 369808237, 223515434, 183210248, 513217009, 96685622, 133222903,
+	507216091, 195485030, 12047046, 179915412, 33433502, 19541014, 118502093, 278493106,
+	36218689, 102825869, 219038976, 429613307, 46493259, 281119426, 461335620, 254829712,
+	492091815, 149894432, 106852797, 473648431, 441902152, 317966594, 352570412, 443689564,
+	139014497, 427349575, 133100210, 422396587, 269345254, 124962170, 308624699, 198482541,
+	509398136, 498882326, 168281215, 197198636, 362351717, 213918880, 308441427, 378080670,
+	83761561, 205197106, 126000737, 318972959, 96685622, 444468766, 252557573, 33433502,
+	309362438, 186633743, 219038976, 413030792, 454738809, 492091815, 347207710, 48854773,
+	352570412, 23674444, 101752526, 269345254, 503326274, 143394405, 168281215, 343786578,
+	269839778, 83761561, 248130815, 502506235, 252557573, 527030957, 33107874, 454738809,
+	500530342, 161195651, 101752526, 432443687, 161819895, 269839778, 314086026, 206437608,
+	33107874, 70826953, 360927194, 161819895, 491566169, 438016588, 360927194, 388025747,
+	22066149, 22066149, 244353919, 149245135, 114680, 343085866, 478698314, 267515799,
+	139370868, 8054208, 106981354, 474270727, 216832135, 380705247, 258604551, 383754105,
+	98934502, 220543068, 70476085, 447438514, 503540655, 435833336, 531203596, 282377401,
+	78527888, 159469120, 466353609, 175339621, 121677538, 156381041, 128271566, 494485557,
+	55962115, 420193556, 245525180, 491420756, 163881765, 446850351, 88680060, 73119701,
+	104167588, 61987699, 213013858, 332869063, 246223068, 206847904, 73199564, 461558232,
+	148524005, 177785607, 223516913, 79783238, 29277906, 730966, 18473831, 328104428,
+	343978562, 356618839, 298399851, 13717470, 404866985, 242968325, 36371986, 514429786,
+	208772902, 497673333, 265994372, 304698809, 147581018, 527841021, 284663782, 413180559,
+	104289334, 289948203, 127556487, 359852658, 351187795, 378758566, 19498768, 409628327,
+	232143343, 268269817, 213813495, 359241182, 391988172, 478554844, 360831128, 162273235,
+	174142945, 492697978, 347909944, 521260962, 387565733, 333054776, 335957634, 27124101,
+	212656091, 220937589, 425257772, 24900866, 182882311, 166636292, 448506776, 350236429,
+	233655450, 304632548, 99049339, 200330079, 47268702, 376676776, 219028698, 45759591,
+	465337009, 60399719, 106179457, 305565677, 5644439, 430577837, 47622005, 371851855,
+	496086098, 216769077, 32908903, 216702504, 429369963, 377108425, 231618990, 78482139,
+	258739125, 382955643, 249895925, 42278718, 71038490, 112829829, 398065510, 470716777,
+	121040006, 68896388, 394530249, 319785304, 273275966, 450731865, 244498514, 392936617,
+	407151835, 61454054, 40443297, 159169414, 204837787, 97692410, 241699752, 447648219,
+	361625589, 467935313, 292647278, 403439547, 306537945, 144950748, 182303387, 486383099,
+	285780778, 492315190, 133681603, 440628759, 523383803, 171539813, 394423931, 449645625,
+	466126504, 67084959, 251011541, 86762465, 131746598, 46541052, 522383017, 287175610,
+	237141279, 258506452, 452337825, 1404180, 432375016, 393530839, 496425350, 42753383,
+	139814228, 37713065, 479664699, 109717705, 506601041, 22542714, 400495878, 124378722,
+	93080974, 168314703, 4783347, 98215746, 18480836, 480653738, 214193628, 483462645,
+	25189737, 24508403, 495993622, 147999617, 352804017, 438463315, 243879793, 251819853,
+	268713835, 471624714, 112445583, 394648614, 140737196, 184013914, 509840000, 33220984,
+	415480917, 290385165, 166181367, 245166397, 94108491, 431328641, 91158618, 322138681,
+	511524546, 373766271, 41747099, 240331270, 236276275, 467476212, 222534532, 400798875,
+	43712426, 304953950, 223762883, 47063650, 61222462, 101178233, 503531992, 201193990,
+	462862860, 424710047, 276843861, 71937497, 152327587, 4470167, 295103010, 449666051,
+	375240670, 483543111, 33592502, 525679231, 358335098, 137445097, 247301465, 253563090,
+	335444114, 1974547, 521766133, 525191385, 25505758, 34337987, 314283015, 393144595,
+	503528135, 245952928, 301800424, 111233442, 517402711, 373931658, 100389951, 155395038,
+	422141534, 126615161, 101162363, 105046826, 292897850, 383570127, 255058417, 331718158,
+	104601707, 175500702, 364747520, 36112239, 451751118, 194193688, 298046713, 139393383,
+	246608649, 407176896, 437073848, 182494547, 524599391, 289392094, 319925091, 420489640,
+	479895333, 186763051, 321693392, 172003968, 183739485, 274575416, 214099683, 295333951,
+	517302797, 186867620, 306639656, 437824398, 20471818, 496989260, 127180224, 239437965,
+	478445388, 495928077, 213924796, 13713465, 350987274, 141284216, 147784740, 210799100,
+	421024659, 458218537, 266260723, 343354599, 124337691, 514666716, 143578167, 267927521,
+	42190028, 22639888, 386491323, 190381155, 523595356, 202071388, 468619640, 100164191,
+	446597348, 153323893, 414348012, 203924821, 356589638, 355683982, 502470314, 462242163,
+	417597745, 365310916, 17378732, 532694803, 42931968, 484723025, 309178098, 203343481,
+	488071595, 103065535, 180665793, 39427794, 467025383, 413033820, 126414985, 409207311,
+	91289694, 14096812, 506114751, 175385929, 500163246, 193248517, 5055261, 394818831,
+	320658142, 257900534, 112956482, 374215976, 277407875, 8033425, 268264562, 74083403,
+	40836171, 225175167, 236322299, 32767950, 503930938, 527034948, 249186365, 455480129,
+	230519791, 452442789, 470880968, 6490338, 333214496, 284984104, 137310575, 442362759,
+	110758286, 59720632, 134575322, 423597542, 2366267, 406297322, 272420049, 248310589,
+	232137093, 375874489, 203922139, 41825541, 162122300, 461263054, 118967315, 314831764,
+	373875661, 73052384, 33788768, 477361163, 192392152, 69927980, 518668299, 167803140,
+	105021959, 518137873, 127411031, 384627573, 496184987, 43533251, 357598740, 210773204,
+	312318183, 154218314, 335582142, 61449930, 367933762, 420813299, 364064399, 67476145,
+	164149207, 142547194, 226244709, 239646505, 361741656, 128482953, 276540337, 877737,
+	322377837, 7381479, 389944846, 123574701, 496598314, 243410389, 14815871, 188265171,
+	256675360, 70295626, 369808237, 454331869, 513217009, 226859418, 507216091, 325128386,
+	179915412, 295948150, 118502093, 173498390, 102825869, 18438570, 46493259, 129951535,
+	254829712, 27677956, 106852797, 157764153, 317966594, 185020402, 139014497, 362216735,
+	422396587, 245714479, 308624699, 526002627, 498882326, 482788604, 362351717, 417837780,
+	378080670, 119814715, 126000737, 237555973, 444468766, 478842395, 309362438, 78094630,
+	413030792, 212218941, 347207710, 180081440, 23674444, 309622680, 503326274, 247150621,
+	343786578, 378629967, 248130815, 70559820, 527030957, 371498165, 500530342, 178408392,
+	432443687, 401429127, 314086026, 507338338, 70826953, 513741371, 491566169, 19763091,
+	388025747, 427648452, 244353919, 247929630, 449748021, 138196581, 105618644, 351810055,
+	154354313, 207173352, 115884972, 302841278, 147376324, 269615136, 161023512, 140627614,
+	343956995, 314595817, 270795727, 405368842, 471665511, 427246828, 114252076, 309968535,
+	177661899, 305752382, 2023409, 447753887, 487762753, 441555326, 445719737, 342956501,
+	117005700, 489688906, 101416308, 8036171, 161374819, 401573980, 101442413, 484563201,
+	508482541, 76843769, 92627437, 483775055, 338044331, 112640710, 468673296, 384610324,
+	190674740, 177033973, 11309479, 19952554, 198454879, 361230778, 144774569, 359971141,
+	200000285, 452544074, 80820240, 211452164, 181142647, 315666259, 250035155, 503844862,
+	167694494, 3699977, 469712832, 246053453, 87169853, 403466443, 269182095, 192842431,
+	13448629, 397055309, 474436655, 66535977, 60580111, 222586165, 189402499, 58943369,
+	67786462, 173916891, 305018019, 218811003, 485004987, 439487274, 58094222, 89819103,
+	253013016, 360345828, 503365825, 449748120, 425449807, 69526767, 230826943, 242689882,
+	209165195, 499295169, 113426868, 315319486, 449946162, 487082373, 264757051, 433203288,
+	65195647, 126600939, 119078934, 290066126, 444700615, 469687633, 511196463, 109307160,
+	499510452, 533276411, 293200864, 325116174, 108252207, 73560600, 107822807, 409989137,
+	25231598, 308450059, 93417439, 237096599, 428189306, 299165329, 282546729, 75847714,
+	42288102, 521407132, 221996070, 155515928, 384299801, 195963911, 2898718, 124070392,
+	279479507, 431086653, 463503910, 150814705, 376576856, 339922996, 189123158, 511072962,
+	304111577, 443896076, 259541413, 525688005, 264310998, 295466232, 457372521, 463389269,
+	490282540, 306638439, 268772900, 149624675, 178435797, 396975747, 415595747, 450504709,
+	69606823, 524595024, 204637319, 182106695, 388623366, 281660542, 397154297, 51597478,
+	355133937, 470524276, 193869954, 505360808, 9460141, 398196420, 451054690, 523206701,
+	122181761, 97475274, 84987707, 375267994, 310660091, 272509413, 419448093, 43549600,
+	150337188, 307770168, 50273899, 518091204, 382532639, 322106833, 426095069, 498936661,
+	454389500, 243908225, 295046806, 309759536, 231488947, 157260565, 353914139, 441474942,
+	165501278, 164372982, 447286850, 90781621, 474285561, 461703335, 167793099, 90983335,
+	502075022, 489576531, 275258738, 66406484, 5338600, 176901482, 112649975, 226698960,
+	320247982, 532795593, 364031418, 333287659, 225165232, 329204368, 53980383, 394922961,
+	110960897, 217404483, 437364340, 215765157, 127427963, 497001544, 261339436, 142746017,
+	108306096, 30850520, 146552250, 51350899, 507943163, 497915637, 496016130, 30030014,
+	42775821, 214600224, 67726413, 536565796, 125976136, 52438666, 291978903, 185735529,
+	494263593, 33223582, 209952525, 140397492, 114820391, 497221472, 276526329, 487887300,
+	66053174, 190496054, 363333498, 291830854, 517311274, 304796996, 36079845, 473988213,
+	502147867, 108995580, 355326679, 17831385, 135905769, 107865038, 135242550, 279494463,
+	140608509, 455563414, 322154623, 435649142, 499839490, 277077831, 181396090, 36435161,
+	225604348, 403241486, 504298007, 287437604, 393587170, 202254959, 443881873, 18065356,
+	372990165, 2453635, 306349536, 101117151, 21731186, 469243465, 436351566, 394519040,
+	484937182, 363079522, 190437655, 323922592, 227066457, 481980045, 331365049, 173429868,
+	321192033, 151880590, 180704904, 456612558, 231891108, 104776763, 14762238, 154929622,
+	216804920, 506529792, 88405993, 405586758, 321180574, 85119761, 334535595, 355415827,
+	1480868, 367700193, 487926894, 387994432, 185986695, 50487221, 302049369, 207677840,
+	55852649, 352745629, 192366511, 294406649, 203046056, 364747682, 310942399, 2250536,
+	142636753, 52154679, 484288766, 44319716, 194836330, 272643641, 282361107, 326073104,
+	102071844, 124328476, 158795701, 195135082, 108729803, 24530762, 151759567, 423725302,
+	67000903, 4636187, 75536034, 20081877, 31572960, 235711282, 136445011, 45951003,
+	453861037, 20945946, 211494066, 329176456, 342812019, 435443450, 106070960, 430508147,
+	445178671, 74303705, 7838033, 195366436, 273878642, 406824172, 251031080, 68527117,
+	378099158, 181004664, 93929664, 338656984, 504425481, 357339818, 215492919, 354877712,
+	20112248, 50349933, 198910654, 64618576, 183210248, 50851783, 71083796, 382126257,
+	133222903, 10231624, 428780738, 248359025, 12047046, 168382675, 457293697, 105633423,
+	19541014, 438699054, 106764976, 423733496, 36218689, 525942906, 311125032, 520382803,
+	429613307, 197534207, 120082575, 20482111, 461335620, 100177986, 154977173, 324616965,
+	149894432, 56749235, 102706099, 193330181, 441902152, 30840788, 378356632, 52784693,
+	443689564, 436503515, 137528116, 212437050, 133100210, 250222081, 252127714, 353750319,
+	124962170, 31646664, 503809977, 93149900, 509398136, 347678580, 153567247, 437318670,
+	197198636, 335174237, 377405482, 95169598, 308441427, 57181947, 493667576, 93392061,
+	205197106, 184793227, 223515434, 294735705, 96685622, 441601322, 195485030, 330884263,
+	33433502, 127899677, 278493106, 394405265, 219038976, 243145214, 281119426, 189490275,
+	492091815, 414744909, 473648431, 141560096, 352570412, 205900618, 427349575, 23883115,
+	269345254, 435182009, 198482541, 377343012, 168281215, 523958557, 213918880, 336666756,
+	83761561, 294195909, 318972959, 221918440, 252557573, 80198466, 186633743, 255536048,
+	454738809, 515374272, 48854773, 41882631, 101752526, 227782769, 143394405, 74682880,
+	269839778, 524879507, 502506235, 153544146, 33107874, 197402540, 161195651, 273886237,
+	161819895, 399627369, 206437608, 170395879, 360927194, 469015284, 438016588, 520260412,
+	22066149, 501867244, 149245135, 39538156
+};
+
+/*
+Gentleman-Sande, decimation-in-frequency FFT, leaving the output in
+bit-reversed order for FFT_backward_2048_536856577.
+Coefficients are kept lazily reduced in [0, 2q), both on input and on output.
+*/
+void FFT_forward_2048_536856577(FFTSHORT x[2048]) {
+	const FFTSHORT q = 536856577, q2 = 2*536856577, qinv = 331335679U;
+	const FFTSHORT *w = W_fwd_2048_536856577;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_forward_2048_536856577_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layer m = 1024 */
+	for (j = 0; j < 1024; ++j, w += 1) {
+		a0 = x[j]; a1 = x[j+1024];
+		GS(a0, a1, w[0]);
+		x[j] = a0; x[j+1024] = a1;
+	}
+
+	/* Layers m = 512, 256 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 1024) {
+			a0 = x[i]; a1 = x[i+256]; a2 = x[i+512]; a3 = x[i+768];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+256] = a1; x[i+512] = a2; x[i+768] = a3;
+		}
+	}
+
+	/* Layers m = 128, 64 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 32, 16 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 8, 4 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
+	}
+
+	/* Layers m = 2, 1 */
+	for (i = 0; i < 2048; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		GS1(a0, a2);
+		GS(a1, a3, 87108556);
+		GS1(a0, a1);
+		GS1(a2, a3);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+}
+
+/*
+Cooley-Tukey, decimation-in-time FFT, inverting FFT_forward_2048_536856577 up to
+the factor n.
+The output is lazily reduced to [0, 2q); callers finish the reduction.
+*/
+void FFT_backward_2048_536856577(FFTSHORT x[2048]) {
+	const FFTSHORT q = 536856577, q2 = 2*536856577, qinv = 331335679U;
+	const FFTSHORT *w = W_bwd_2048_536856577;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_backward_2048_536856577_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 2048; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 449748021);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
+	}
+
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 256, 512 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 1024) {
+			a0 = x[i]; a1 = x[i+256]; a2 = x[i+512]; a3 = x[i+768];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+256] = a1; x[i+512] = a2; x[i+768] = a3;
+		}
+	}
+
+	/* Layer m = 1024 */
+	for (j = 0; j < 1024; ++j, w += 1) {
+		a0 = x[j]; a1 = x[j+1024];
+		CT(a0, a1, w[0]);
+		x[j] = a0; x[j+1024] = a1;
+	}
+}
@@ -8,74 +8,711 @@
  * See LICENSE for complete information.
  */
 
-/* Code to compute a Number Theoretic Transform for multiplication in the ring 
-F_q[x] / <x^n+1>.
+/* Generated by util/ringlwe_fft.pl: do not edit. */
+
+/* Cyclic Number Theoretic Transform mod q, for the Bluestein and Rader
+convolutions of the prime-m parameter sets.
 	n = 2048, q = 8816641	*/
 
 #include "FFT_includes.h"
-#include "FFT_constants.h"
+
+#define GS(a, b, w) BFLY_GS(a, b, w, q, q2, qinv, MUL_MONT)
+#define GS1(a, b) BFLY_GS_1(a, b, q2)
+#define CT(a, b, w) BFLY_CT(a, b, w, q, q2, qinv, MUL_MONT)
+#define CT1(a, b) BFLY_CT_1(a, b, q2)
+
+/* The twiddle factors w^k in Montgomery form, in the order the stages
+read them */
+static const FFTSHORT W_fwd_2048_8816641[2044] = {
+	1263129, 8510572, 6903075, 7476818, 6465706, 1870218, 1332758, 2636363,
+	3937180, 8571546, 6282904, 3688445, 4381604, 6549041, 8505637, 2029606,
+	4532466, 1291536, 1586243, 3683044, 2905114, 8127130, 73725, 2674622,
+	7647796, 4111851, 1830515, 2245416, 487187, 4803185, 8314652, 8347770,
+	7551396, 8692801, 8372588, 3802043, 7553103, 2360466, 8437010, 8432391,
+	4623121, 5347509, 6355616, 3928095, 6629908, 6606321, 76641, 8700385,
+	7463441, 3685393, 6044854, 3815208, 8057017, 1416279, 3034590, 1882942,
+	1551241, 3379980, 8014557, 4622954, 5259413, 957062, 4539085, 1457159,
+	3323561, 7764342, 6832300, 2293225, 8179743, 1958999, 2816329, 1942760,
+	162873, 1236932, 7308933, 4643815, 4226937, 8004324, 2498076, 8437065,
+	331089, 1913576, 8683500, 8270393, 6751454, 4625973, 6693616, 5316622,
+	8276095, 2684948, 6654078, 8375297, 6814925, 4742285, 3324874, 1276958,
+	4666071, 498726, 3235082, 4117135, 4670730, 7232781, 8555244, 2329152,
+	4483252, 6584320, 1510834, 5716268, 5280993, 5108151, 3416640, 3912825,
+	7602481, 4650980, 6845151, 8491660, 8277364, 6205262, 6655485, 2148677,
+	5628427, 6405062, 6782423, 6497143, 7103129, 1930378, 705539, 3682692,
+	3616929, 7834936, 8699962, 6290003, 3684924, 8120394, 1271827, 7502758,
+	3202643, 7172289, 6948350, 4012904, 4223161, 5220491, 4974221, 7997575,
+	3847703, 279921, 7601029, 8689297, 7844011, 3297923, 47128, 7491697,
+	6659523, 8660730, 3069200, 8789677, 7738336, 7473628, 242608, 324290,
+	1811382, 6195630, 7698537, 1366802, 1219794, 8351982, 2540501, 1569123,
+	3838086, 7930168, 6881700, 8396531, 5504066, 8642649, 183170, 7456513,
+	8477809, 8309073, 4876788, 4272840, 1968009, 6988556, 1306613, 828624,
+	719194, 2544498, 1777031, 1695676, 3179179, 1921762, 5505002, 6549490,
+	559384, 1550712, 5476663, 5220992, 5238509, 6559955, 2014733, 6981527,
+	8632668, 3259476, 4631625, 1175289, 4197360, 2115980, 839519, 553578,
+	6829418, 5366010, 277004, 7012547, 6518378, 354989, 8186016, 5479315,
+	759815, 426688, 5990694, 2328127, 5579165, 8188104, 8270195, 7702890,
+	5563694, 8790674, 186753, 1638659, 1082473, 6339816, 3617991, 8342369,
+	6074906, 1454249, 8757317, 4447059, 1851792, 5180781, 8681282, 6994763,
+	2205194, 2023564, 5779902, 784602, 6533508, 2370630, 6618714, 1440371,
+	5712716, 1242674, 6167212, 3899829, 5128742, 6887628, 1017618, 2008994,
+	628046, 7625835, 8470829, 4890948, 8099733, 8111587, 4228323, 1344272,
+	4750670, 2574300, 973608, 4292423, 2267543, 1653586, 4786032, 2750506,
+	6181910, 777715, 8813428, 4218032, 5999257, 3572045, 1315819, 6107336,
+	3251419, 2915513, 6960744, 8755994, 3590766, 6915204, 7170249, 7667212,
+	4323289, 8730273, 6335825, 6052961, 6983141, 5418929, 4699441, 4903536,
+	7190588, 5937016, 7430622, 996692, 3799095, 8004153, 6525822, 2434056,
+	4546723, 6700632, 6958733, 1676604, 1670969, 2921929, 8814285, 8471304,
+	5458286, 7141476, 3258880, 727213, 8094545, 3474215, 4931237, 3747810,
+	6238690, 4280432, 1643819, 8080816, 1405717, 8813679, 6039856, 6458084,
+	6613300, 115406, 3122166, 4525855, 1710870, 1057835, 1209099, 5508241,
+	2028408, 2897405, 998404, 5546919, 2211663, 6650365, 6891760, 7790435,
+	429498, 6469937, 8167317, 3692722, 7429725, 2635276, 7112157, 5214598,
+	7197760, 5760827, 6771594, 467853, 8383396, 581260, 895287, 5000683,
+	5432232, 4273062, 2771444, 860924, 4031614, 7916150, 6825313, 1669503,
+	3732411, 3289232, 7077180, 1229124, 655925, 6177549, 4812507, 33638,
+	1959267, 370786, 7174681, 5517673, 3994713, 8723094, 489776, 7858353,
+	5003466, 2835165, 8236341, 7583066, 7818902, 2300667, 3500090, 2425799,
+	5839968, 8713260, 6600106, 7409744, 6296535, 795380, 7731617, 4404363,
+	1027197, 7009323, 13373, 6896155, 4037550, 1122194, 4539151, 4078894,
+	72107, 1187562, 5603376, 7444584, 5775021, 2063753, 7340978, 1433612,
+	8535307, 4799354, 4815480, 4716819, 3775915, 1477997, 3915574, 4723507,
+	7884712, 7029683, 7533250, 6564396, 3829511, 1400494, 515040, 3657949,
+	5135693, 470723, 24855, 6670634, 6655671, 4728126, 2877341, 6305295,
+	6525143, 175276, 1127698, 1424081, 7044720, 3850846, 6372637, 4248771,
+	6482035, 83639, 2413862, 2552223, 1259030, 7456943, 6856844, 7163178,
+	5309762, 4815684, 6408261, 8153197, 2790614, 7330697, 4615633, 4459499,
+	3345904, 7091298, 4189153, 4861046, 5999514, 8036747, 7089649, 3741625,
+	336260, 2001674, 3207492, 3553310, 1305240, 7337151, 2635239, 5508811,
+	6235870, 5274153, 7518453, 1345587, 5022006, 5118619, 6193428, 7592821,
+	8055003, 1832091, 2865612, 593150, 4052650, 7556727, 2846757, 624857,
+	4782097, 463534, 4468411, 2556568, 4870965, 5002272, 5900903, 8547664,
+	7939098, 5204357, 4487925, 7729569, 4538268, 128672, 1092441, 3415035,
+	2274240, 910059, 5085261, 7074374, 5450680, 4237831, 4459348, 4427722,
+	4110564, 8014849, 3932282, 5301423, 2317280, 437882, 2340003, 5508693,
+	4220235, 667692, 8055759, 8619002, 2491274, 7013432, 8410679, 4045203,
+	4156221, 8236869, 2107023, 8257193, 2586273, 2485339, 8370107, 4235474,
+	734651, 7530734, 3336560, 2742879, 2844833, 5417275, 4988395, 6235662,
+	7698553, 2536716, 3637614, 2750047, 6784486, 4153792, 8064200, 3146486,
+	1833653, 257973, 2991841, 7101728, 1983235, 7207040, 5429590, 7261275,
+	4686082, 1235216, 860310, 1015209, 7707038, 4689784, 812357, 426709,
+	6424126, 7705676, 4288066, 2186493, 2294892, 7739264, 4795512, 8226553,
+	1627777, 1096564, 6223535, 5947201, 6045758, 8198862, 3597591, 6714348,
+	362115, 2442164, 2277375, 6417818, 524093, 3259759, 8793277, 6469756,
+	4851386, 586896, 3023687, 1463601, 4874052, 7000289, 2902916, 3905572,
+	7366381, 8498916, 1018262, 606507, 962250, 359816, 754245, 920023,
+	6276322, 5126168, 1623014, 4391350, 2820825, 4472877, 688936, 5271936,
+	805542, 7971242, 1518436, 3919114, 3476070, 5012286, 8543785, 930184,
+	3136587, 8701608, 5416092, 1143888, 6005076, 6958455, 5595111, 8152872,
+	6578739, 97773, 6543805, 358523, 4295701, 6108527, 7680883, 4355009,
+	491554, 3411271, 4776163, 5199569, 2648480, 7161496, 7959687, 1916625,
+	5698811, 3938404, 1086916, 6096673, 2747506, 7239060, 5901797, 5587641,
+	6376855, 1880754, 4673360, 7775453, 4827241, 3952151, 2267407, 525958,
+	1867844, 1875428, 966281, 849631, 8158023, 796124, 416131, 2216660,
+	628129, 5980203, 1175828, 627713, 2012362, 28995, 5211767, 6285085,
+	3360729, 1132495, 7227843, 2360336, 1135619, 2012565, 7157718, 7233775,
+	8498863, 7061643, 8026600, 4640578, 6690098, 1560210, 1248062, 7795227,
+	6969742, 7642465, 1141254, 761605, 1265362, 7576756, 2695240, 5378453,
+	3092555, 7172245, 8139407, 6180540, 8607681, 162013, 4478862, 784082,
+	3777867, 3141249, 7940461, 168794, 5469063, 4960225, 2937339, 4853498,
+	5132647, 4776851, 2606025, 815048, 4327598, 5301581, 7257700, 2272252,
+	1022821, 4436920, 8804319, 521523, 2695944, 3954823, 3676943, 7553053,
+	908645, 5289643, 590595, 1279389, 2780819, 4169811, 7856300, 5873853,
+	7793552, 6825264, 3597042, 2940318, 3362916, 3447657, 477096, 6448813,
+	2092213, 3189909, 8426770, 285275, 130496, 2213022, 5730644, 7268443,
+	8625735, 8788374, 3936115, 6742674, 1842138, 2411041, 166584, 4778390,
+	1622875, 1942283, 1653456, 6301282, 5147321, 8716507, 2663981, 2140034,
+	7351580, 7395949, 1606302, 7929276, 7783802, 5852681, 7025347, 7885632,
+	3766610, 5491644, 6260530, 5401021, 4544385, 5467288, 1912105, 1413823,
+	8602252, 1046494, 1825766, 8768037, 3608390, 8345889, 7773397, 4376189,
+	1844716, 3559813, 6213948, 361915, 5451521, 7321189, 1500557, 4782447,
+	1809640, 50057, 4549294, 1827166, 5335820, 3568256, 7500152, 4414842,
+	5710381, 1330769, 8186406, 933565, 2386011, 1639538, 331896, 4715027,
+	4995162, 3998028, 5350783, 5495801, 534296, 986888, 5490533, 7680636,
+	7233984, 637182, 5582013, 4833412, 6626746, 6838893, 2761898, 1579783,
+	3020560, 5357440, 1827489, 3605616, 6090632, 7374302, 270759, 1131260,
+	3989436, 3088476, 3172688, 2298810, 5476962, 1735917, 4134155, 1612046,
+	4729634, 2933723, 4952164, 5337069, 1217857, 4479284, 7394801, 1423062,
+	1966870, 1952992, 7725032, 4520647, 19426, 7555115, 4002575, 3895440,
+	2707864, 2693294, 6358079, 4382671, 6319992, 23669, 1504688, 8175904,
+	6691511, 6793109, 5376567, 4051038, 8712545, 6117340, 7367265, 7011857,
+	2353202, 6294514, 4005595, 8709003, 606057, 5529143, 7300077, 711209,
+	6092999, 809394, 3087205, 1710295, 6403496, 4689263, 3493997, 7658695,
+	8647034, 6719890, 2229751, 6741992, 7078560, 742835, 6410157, 5721750,
+	7169772, 341154, 570998, 6568661, 1591876, 4490005, 1118851, 1455792,
+	3658325, 6178749, 4389647, 5037318, 5012910, 1270585, 7058754, 5077147,
+	6700844, 418491, 7262796, 4590939, 4050724, 5590425, 7159148, 8199307,
+	8583821, 5630999, 4910956, 7514784, 7487634, 3829880, 5237953, 5580328,
+	6161898, 5478506, 16285, 8221119, 3248740, 4300380, 1080013, 7206679,
+	2177088, 3404897, 3789486, 7422716, 7015403, 3748643, 8737091, 112731,
+	391191, 8066220, 5373552, 7317634, 4957440, 7592327, 4996312, 2123347,
+	7207096, 707648, 6907004, 7120912, 2864202, 5498331, 6989967, 8597433,
+	246581, 7593968, 4858883, 5439223, 780942, 7823231, 4742688, 7444240,
+	7071793, 2980469, 8757927, 2762665, 1456449, 2104313, 1864951, 3041817,
+	2422092, 6999309, 6187132, 5696994, 23420, 6441584, 3610984, 1847934,
+	7421940, 3174420, 1100706, 2706747, 1470522, 2876039, 5882434, 8149463,
+	873645, 2928658, 1593945, 4789532, 7394925, 6081575, 3071693, 4825361,
+	1263129, 2274240, 1263129, 6903075, 5085261, 6465706, 6465706, 5450680,
+	3937180, 1332758, 4459348, 4381604, 3937180, 4110564, 4532466, 6282904,
+	3932282, 2905114, 4381604, 2317280, 7647796, 8505637, 2340003, 487187,
+	4532466, 4220235, 7551396, 1586243, 8055759, 7553103, 2905114, 2491274,
+	4623121, 73725, 8410679, 6629908, 7647796, 4156221, 7463441, 1830515,
+	2107023, 8057017, 487187, 2586273, 1551241, 8314652, 8370107, 5259413,
+	7551396, 734651, 3323561, 8372588, 3336560, 8179743, 7553103, 2844833,
+	162873, 8437010, 4988395, 4226937, 4623121, 7698553, 331089, 6355616,
+	3637614, 6751454, 6629908, 6784486, 8276095, 76641, 8064200, 6814925,
+	7463441, 1833653, 4666071, 6044854, 2991841, 4670730, 8057017, 1983235,
+	4483252, 3034590, 5429590, 5280993, 1551241, 4686082, 7602481, 8014557,
+	860310, 8277364, 5259413, 7707038, 5628427, 4539085, 812357, 7103129,
+	3323561, 6424126, 3616929, 6832300, 4288066, 3684924, 8179743, 2294892,
+	3202643, 2816329, 4795512, 4223161, 162873, 1627777, 3847703, 7308933,
+	6223535, 7844011, 4226937, 6045758, 6659523, 2498076, 3597591, 7738336,
+	331089, 362115, 1811382, 8683500, 2277375, 1219794, 6751454, 524093,
+	3838086, 6693616, 8793277, 5504066, 8276095, 4851386, 8477809, 6654078,
+	3023687, 1968009, 6814925, 4874052, 719194, 3324874, 2902916, 3179179,
+	4666071, 7366381, 559384, 3235082, 1018262, 5238509, 4670730, 962250,
+	8632668, 8555244, 754245, 4197360, 4483252, 6276322, 6829418, 1510834,
+	1623014, 6518378, 5280993, 2820825, 759815, 3416640, 688936, 5579165,
+	7602481, 805542, 5563694, 6845151, 1518436, 1082473, 8277364, 3476070,
+	6074906, 6655485, 8543785, 1851792, 5628427, 3136587, 2205194, 6782423,
+	5416092, 6533508, 7103129, 6005076, 5712716, 705539, 5595111, 5128742,
+	3616929, 6578739, 628046, 8699962, 6543805, 8099733, 3684924, 4295701,
+	4750670, 1271827, 7680883, 2267543, 3202643, 491554, 6181910, 6948350,
+	4776163, 5999257, 4223161, 2648480, 3251419, 4974221, 7959687, 3590766,
+	3847703, 5698811, 4323289, 7601029, 1086916, 6983141, 7844011, 2747506,
+	7190588, 47128, 5901797, 3799095, 6659523, 6376855, 4546723, 3069200,
+	4673360, 1670969, 7738336, 4827241, 5458286, 242608, 2267407, 8094545,
+	1811382, 1867844, 6238690, 7698537, 966281, 1405717, 1219794, 8158023,
+	6613300, 2540501, 416131, 1710870, 3838086, 628129, 2028408, 6881700,
+	1175828, 2211663, 5504066, 2012362, 429498, 183170, 5211767, 7429725,
+	8477809, 3360729, 7197760, 4876788, 7227843, 8383396, 1968009, 1135619,
+	5432232, 1306613, 7157718, 4031614, 719194, 8498863, 3732411, 1777031,
+	8026600, 655925, 3179179, 6690098, 1959267, 5505002, 1248062, 3994713,
+	559384, 6969742, 5003466, 5476663, 1141254, 7818902, 5238509, 1265362,
+	5839968, 2014733, 2695240, 6296535, 8632668, 3092555, 1027197, 4631625,
+	8139407, 4037550, 4197360, 8607681, 72107, 839519, 4478862, 5775021,
+	6829418, 3777867, 8535307, 277004, 7940461, 3775915, 6518378, 5469063,
+	7884712, 8186016, 2937339, 3829511, 759815, 5132647, 5135693, 5990694,
+	2606025, 6655671, 5579165, 4327598, 6525143, 8270195, 7257700, 7044720,
+	5563694, 1022821, 6482035, 186753, 8804319, 1259030, 1082473, 2695944,
+	5309762, 3617991, 3676943, 2790614, 6074906, 908645, 3345904, 8757317,
+	590595, 5999514, 1851792, 2780819, 336260, 8681282, 7856300, 1305240,
+	2205194, 7793552, 6235870, 5779902, 3597042, 5022006, 6533508, 3362916,
+	8055003, 6618714, 477096, 4052650, 5712716, 2092213, 4782097, 6167212,
+	8426770, 4870965, 5128742, 130496, 7939098, 1017618, 5730644, 4538268,
+	628046, 8625735, 2274240, 8470829, 3936115, 5450680, 8099733, 1842138,
+	4110564, 4228323, 166584, 2317280, 4750670, 1622875, 4220235, 973608,
+	1653456, 2491274, 2267543, 5147321, 4156221, 4786032, 2663981, 2586273,
+	6181910, 7351580, 734651, 8813428, 1606302, 2844833, 5999257, 7783802,
+	7698553, 1315819, 7025347, 6784486, 3251419, 3766610, 1833653, 6960744,
+	6260530, 1983235, 3590766, 4544385, 4686082, 7170249, 1912105, 7707038,
+	4323289, 8602252, 6424126, 6335825, 1825766, 2294892, 6983141, 3608390,
+	1627777, 4699441, 7773397, 6045758, 7190588, 1844716, 362115, 7430622,
+	6213948, 524093, 3799095, 5451521, 4851386, 6525822, 1500557, 4874052,
+	4546723, 1809640, 7366381, 6958733, 4549294, 962250, 1670969, 5335820,
+	6276322, 8814285, 7500152, 2820825, 5458286, 5710381, 805542, 3258880,
+	8186406, 3476070, 8094545, 2386011, 3136587, 4931237, 331896, 6005076,
+	6238690, 4995162, 6578739, 1643819, 5350783, 4295701, 1405717, 534296,
+	491554, 6039856, 5490533, 2648480, 6613300, 7233984, 5698811, 3122166,
+	5582013, 2747506, 1710870, 6626746, 6376855, 1209099, 2761898, 4827241,
+	2028408, 3020560, 1867844, 998404, 1827489, 8158023, 2211663, 6090632,
+	628129, 6891760, 270759, 2012362, 429498, 3989436, 3360729, 8167317,
+	3172688, 1135619, 7429725, 5476962, 8498863, 7112157, 4134155, 6690098,
+	7197760, 4729634, 6969742, 6771594, 4952164, 1265362, 8383396, 1217857,
+	3092555, 895287, 7394801, 8607681, 5432232, 1966870, 3777867, 2771444,
+	7725032, 5469063, 4031614, 19426, 5132647, 6825313, 4002575, 4327598,
+	3732411, 2707864, 1022821, 7077180, 6358079, 2695944, 655925, 6319992,
+	908645, 4812507, 1504688, 2780819, 1959267, 6691511, 7793552, 7174681,
+	5376567, 3362916, 3994713, 8712545, 2092213, 489776, 7367265, 130496,
+	5003466, 2353202, 8625735, 8236341, 4005595, 1842138, 7818902, 606057,
+	1622875, 3500090, 7300077, 5147321, 5839968, 6092999, 7351580, 6600106,
+	3087205, 7783802, 6296535, 6403496, 3766610, 7731617, 3493997, 4544385,
+	1027197, 8647034, 8602252, 13373, 2229751, 3608390, 4037550, 7078560,
+	1844716, 4539151, 6410157, 5451521, 72107, 7169772, 1809640, 5603376,
+	570998, 5335820, 5775021, 1591876, 5710381, 7340978, 1118851, 2386011,
+	8535307, 3658325, 4995162, 4815480, 4389647, 534296, 3775915, 5012910,
+	7233984, 3915574, 7058754, 6626746, 7884712, 6700844, 3020560, 7533250,
+	7262796, 6090632, 3829511, 4050724, 3989436, 515040, 7159148, 5476962,
+	5135693, 8583821, 4729634, 24855, 4910956, 1217857, 6655671, 7487634,
+	1966870, 2877341, 5237953, 19426, 6525143, 6161898, 2707864, 1127698,
+	16285, 6319992, 7044720, 3248740, 6691511, 6372637, 1080013, 8712545,
+	6482035, 2177088, 2353202, 2413862, 3789486, 606057, 1259030, 7015403,
+	6092999, 6856844, 8737091, 6403496, 5309762, 391191, 8647034, 6408261,
+	5373552, 7078560, 2790614, 4957440, 7169772, 4615633, 4996312, 1591876,
+	3345904, 7207096, 3658325, 4189153, 6907004, 5012910, 5999514, 2864202,
+	6700844, 7089649, 6989967, 4050724, 336260, 246581, 8583821, 3207492,
+	4858883, 7487634, 1305240, 780942, 6161898, 2635239, 4742688, 3248740,
+	6235870, 7071793, 2177088, 7518453, 8757927, 7015403, 5022006, 1456449,
+	391191, 6193428, 1864951, 4957440, 8055003, 2422092, 7207096, 2865612,
+	6187132, 2864202, 4052650, 23420, 246581, 2846757, 3610984, 780942,
+	4782097, 7421940, 7071793, 4468411, 1100706, 1456449, 4870965, 1470522,
+	2422092, 5900903, 5882434, 23420, 7939098, 873645, 7421940, 4487925,
+	1593945, 1470522, 4538268, 7394925, 873645, 1092441, 3071693, 7394925,
+	1263129, 2274240, 1263129, 3937180, 4110564, 4532466, 4532466, 4220235,
+	7551396, 7647796, 4156221, 7463441, 7551396, 734651, 3323561, 4623121,
+	7698553, 331089, 7463441, 1833653, 4666071, 1551241, 4686082, 7602481,
+	3323561, 6424126, 3616929, 162873, 1627777, 3847703, 331089, 362115,
+	1811382, 8276095, 4851386, 8477809, 4666071, 7366381, 559384, 4483252,
+	6276322, 6829418, 7602481, 805542, 5563694, 5628427, 3136587, 2205194,
+	3616929, 6578739, 628046, 3202643, 491554, 6181910, 3847703, 5698811,
+	4323289, 6659523, 6376855, 4546723, 1811382, 1867844, 6238690, 3838086,
+	628129, 2028408, 8477809, 3360729, 7197760, 719194, 8498863, 3732411,
+	559384, 6969742, 5003466, 8632668, 3092555, 1027197, 6829418, 3777867,
+	8535307, 759815, 5132647, 5135693, 5563694, 1022821, 6482035, 6074906,
+	908645, 3345904, 2205194, 7793552, 6235870, 5712716, 2092213, 4782097,
+	628046, 8625735, 2274240, 4750670, 1622875, 4220235, 6181910, 7351580,
+	734651, 3251419, 3766610, 1833653, 4323289, 8602252, 6424126, 7190588,
+	1844716, 362115, 4546723, 1809640, 7366381, 5458286, 5710381, 805542,
+	6238690, 4995162, 6578739, 6613300, 7233984, 5698811, 2028408, 3020560,
+	1867844, 429498, 3989436, 3360729, 7197760, 4729634, 6969742, 5432232,
+	1966870, 3777867, 3732411, 2707864, 1022821, 1959267, 6691511, 7793552,
+	5003466, 2353202, 8625735, 5839968, 6092999, 7351580, 1027197, 8647034,
+	8602252, 72107, 7169772, 1809640, 8535307, 3658325, 4995162, 7884712,
+	6700844, 3020560, 5135693, 8583821, 4729634, 6525143, 6161898, 2707864,
+	6482035, 2177088, 2353202, 5309762, 391191, 8647034, 3345904, 7207096,
+	3658325, 336260, 246581, 8583821, 6235870, 7071793, 2177088, 8055003,
+	2422092, 7207096, 4782097, 7421940, 7071793, 7939098, 873645, 7421940,
+	1263129, 2274240, 1263129, 7551396, 734651, 3323561, 3323561, 6424126,
+	3616929, 4666071, 7366381, 559384, 3616929, 6578739, 628046, 1811382,
+	1867844, 6238690, 559384, 6969742, 5003466, 5563694, 1022821, 6482035,
+	628046, 8625735, 2274240, 4323289, 8602252, 6424126, 6238690, 4995162,
+	6578739, 7197760, 4729634, 6969742, 5003466, 2353202, 8625735, 8535307,
+	3658325, 4995162, 6482035, 2177088, 2353202, 6235870, 7071793, 2177088,
+	1263129, 2274240, 1263129, 3616929, 6578739, 628046, 628046, 8625735,
+	2274240, 5003466, 2353202, 8625735
+};
+
+static const FFTSHORT W_bwd_2048_8816641[2044] = {
+	1263129, 1263129, 6542401, 190906, 6463439, 3813175, 6542401, 190906,
+	8188595, 8188595, 2237902, 5199712, 1263129, 1263129, 6542401, 6639553,
+	1744848, 2580771, 6463439, 6639553, 2334606, 3821479, 5158316, 281334,
+	190906, 6463439, 3813175, 1846899, 4087007, 1618881, 2237902, 3821479,
+	2577951, 2392515, 214389, 4493352, 6542401, 190906, 8188595, 2334606,
+	7793820, 3252947, 3813175, 1846899, 8257257, 2577951, 6948797, 7005259,
+	8188595, 2237902, 5199712, 8257257, 1450260, 4150570, 5199712, 2392515,
+	5493080, 5493080, 8081990, 1265245, 1263129, 1263129, 6542401, 1394701,
+	7942996, 877543, 1744848, 1394701, 4034544, 1609545, 6394549, 761638,
+	6639553, 1744848, 2580771, 232820, 8570060, 8480381, 5158316, 1609545,
+	5470737, 169607, 8425450, 3506879, 6463439, 6639553, 2334606, 6108777,
+	2654743, 2291498, 4087007, 232820, 3680948, 5796081, 2115797, 931929,
+	3821479, 5158316, 281334, 7007001, 1646869, 8744534, 214389, 169607,
+	7789444, 1465061, 2723642, 2976673, 190906, 6463439, 3813175, 1023089,
+	2125130, 6857374, 7793820, 6108777, 5084230, 5038774, 6849771, 3384409,
+	1846899, 4087007, 1618881, 5455912, 4827205, 8387143, 6948797, 5796081,
+	6788233, 3117830, 1582657, 2203341, 2237902, 3821479, 2577951, 8011099,
+	3106260, 3358355, 1450260, 7007001, 4269918, 8454526, 6971925, 1626053,
+	2392515, 214389, 4493352, 6982988, 5050031, 5565222, 8081990, 1465061,
+	2634731, 4596406, 7193766, 4065971, 6542401, 190906, 8188595, 4034544,
+	6724428, 3103925, 2580771, 1023089, 6611447, 5470737, 7907996, 2741735,
+	2334606, 7793820, 3252947, 3680948, 3683994, 8056826, 281334, 5038774,
+	1987223, 7789444, 5724086, 183973, 3813175, 1846899, 8257257, 5084230,
+	317778, 8097447, 1618881, 5455912, 338832, 6788233, 8188512, 4978555,
+	2577951, 6948797, 7005259, 4269918, 2439786, 2157118, 4493352, 3117830,
+	4968938, 2634731, 8325087, 5613998, 8188595, 2237902, 5199712, 6611447,
+	5680054, 3188214, 3252947, 8011099, 1214160, 1987223, 2540319, 4333389,
+	8257257, 1450260, 4150570, 338832, 3965255, 540546, 7005259, 8454526,
+	8485552, 4968938, 7188864, 8653768, 5199712, 2392515, 5493080, 1214160,
+	4130559, 7265400, 4150570, 6982988, 1353200, 8485552, 1118088, 4193520,
+	5493080, 8081990, 1265245, 1353200, 4660420, 1168845, 1265245, 4596406,
+	4284175, 4284175, 4706077, 4879461, 1263129, 1263129, 6542401, 1421716,
+	5744948, 7724200, 7942996, 1421716, 4278373, 7346119, 7222696, 4328716,
+	1394701, 7942996, 877543, 8793221, 2934207, 2915738, 6394549, 7346119,
+	3945676, 7360192, 7715935, 4348230, 1744848, 1394701, 4034544, 8035699,
+	5205657, 5969884, 8570060, 8793221, 4763991, 5952439, 2629509, 5951029,
+	1609545, 6394549, 761638, 3859201, 6951690, 2623213, 8425450, 7360192,
+	3794635, 1801238, 58714, 1298188, 6639553, 1744848, 2580771, 5567901,
+	4073953, 6181402, 2654743, 8035699, 7511401, 1329007, 3957758, 5609149,
+	232820, 8570060, 8480381, 4765917, 1826674, 1726992, 2115797, 5952439,
+	2817127, 3803731, 1909637, 4627488, 5158316, 1609545, 5470737, 7224765,
+	3820329, 4201008, 1646869, 3859201, 6026027, 1738081, 3443089, 2408380,
+	169607, 8425450, 3506879, 2413145, 79550, 1959797, 2723642, 1801238,
+	7557611, 8210584, 5027155, 6402779, 6463439, 6639553, 2334606, 104096,
+	7736628, 2444004, 2125130, 5567901, 1771921, 2496649, 8800356, 7688943,
+	6108777, 2654743, 2291498, 8797215, 3578688, 5939300, 6849771, 1329007,
+	2160970, 7598784, 3905685, 8791786, 4087007, 232820, 3680948, 3339679,
+	1657493, 8301601, 4827205, 4765917, 4987130, 2726009, 1553845, 1283391,
+	5796081, 2115797, 931929, 2189895, 1757887, 4901067, 1582657, 3803731,
+	5040726, 8282345, 4426994, 4001161, 3821479, 5158316, 281334, 6430630,
+	7697790, 1475663, 3106260, 7224765, 3041620, 3480821, 8245643, 3213265,
+	7007001, 1646869, 8744534, 3365120, 2406484, 4277490, 6971925, 1738081,
+	4779091, 5208251, 6586890, 8803268, 214389, 169607, 7789444, 4272256,
+	5322644, 1085024, 5050031, 2413145, 2520106, 1032839, 5729436, 2216535,
+	1465061, 2723642, 2976673, 3669320, 1516564, 5316551, 7193766, 8210584,
+	997739, 6974503, 4811046, 580300, 190906, 6463439, 3813175, 8686145,
+	1449376, 8326865, 6724428, 104096, 4821928, 5453725, 3440074, 1641960,
+	1023089, 2125130, 6857374, 6035822, 7311953, 4004134, 7907996, 2496649,
+	8160716, 6120697, 2458562, 1739461, 7793820, 6108777, 5084230, 4489043,
+	4814066, 1991328, 3683994, 8797215, 4785027, 3347578, 1091609, 6045197,
+	5038774, 6849771, 3384409, 208960, 1421840, 7921354, 5724086, 7598784,
+	433245, 7551279, 3864477, 2045047, 1846899, 4087007, 1618881, 2126543,
+	4682486, 1704484, 317778, 3339679, 1386916, 7681022, 5643953, 649324,
+	5455912, 4827205, 8387143, 6804279, 8545882, 1924881, 8188512, 2726009,
+	6604978, 658618, 6989152, 7818237, 6948797, 5796081, 6788233, 3989400,
+	6054743, 7607542, 2439786, 2189895, 7105771, 6069135, 3234628, 5694475,
+	3117830, 1582657, 2203341, 6168161, 3326108, 2776785, 8325087, 8282345,
+	7410924, 4520940, 3465858, 7172822, 2237902, 3821479, 2577951, 2811565,
+	8484745, 3885404, 5680054, 6430630, 722096, 5340571, 630235, 5557761,
+	8011099, 3106260, 3358355, 5995816, 1316489, 2356, 2540319, 3480821,
+	7145672, 7854391, 4267347, 1857908, 1450260, 7007001, 4269918, 3942589,
+	7316084, 2290819, 3965255, 3365120, 5017546, 8292548, 2602693, 1386019,
+	8454526, 6971925, 1626053, 2770883, 1043244, 4117200, 7188864, 5208251,
+	1833500, 6521749, 6990875, 2480816, 2392515, 214389, 4493352, 1109603,
+	6904536, 1646392, 4130559, 4272256, 5225875, 6833406, 2556111, 1855897,
+	6982988, 5050031, 5565222, 2032155, 1791294, 7500822, 1118088, 1032839,
+	2817384, 5971808, 7210339, 3213, 8081990, 1465061, 2634731, 6230368,
+	6152660, 4030609, 4660420, 3669320, 6549098, 6325367, 7163185, 7843033,
+	4596406, 7193766, 4065971, 6499361, 8650057, 4588318, 4706077, 6974503,
+	716908, 3365961, 4880526, 345812, 6542401, 190906, 8188595, 4278373,
+	3085997, 7799023, 877543, 8686145, 3687899, 3945676, 389871, 2649429,
+	4034544, 6724428, 3103925, 4763991, 8339545, 2197927, 761638, 5453725,
+	2283133, 3794635, 5219599, 3036739, 2580771, 1023089, 6611447, 7511401,
+	960341, 135359, 8480381, 6035822, 6964849, 2817127, 8226046, 59324,
+	5470737, 7907996, 2741735, 6026027, 5139698, 5198650, 3506879, 6120697,
+	7734168, 7557611, 12322, 8629888, 2334606, 7793820, 3252947, 1771921,
+	1558941, 546446, 2291498, 4489043, 3237476, 2160970, 6210616, 2825947,
+	3680948, 3683994, 8056826, 4987130, 5879302, 630625, 931929, 3347578,
+	2298263, 5040726, 876180, 8539637, 281334, 5038774, 1987223, 3041620,
+	4337779, 7977122, 8744534, 208960, 4619281, 4779091, 677234, 4185016,
+	7789444, 5724086, 183973, 2520106, 6121401, 6801908, 2976673, 7551279,
+	3578132, 997739, 7675387, 3339978, 3813175, 1846899, 8257257, 4821928,
+	7568579, 3311639, 6857374, 2126543, 5637462, 8160716, 790041, 7039610,
+	5084230, 317778, 8097447, 4785027, 1658923, 7510028, 3384409, 7681022,
+	6848632, 433245, 1588798, 3939853, 1618881, 5455912, 338832, 1386916,
+	3604874, 8633471, 8387143, 6804279, 3312575, 6604978, 7640813, 1934941,
+	6788233, 8188512, 4978555, 7105771, 8400510, 6276140, 2203341, 658618,
+	7596847, 7410924, 7850360, 1118104, 2577951, 6948797, 7005259, 722096,
+	6549234, 8574033, 3358355, 3989400, 1078305, 7145672, 4143281, 5747441,
+	4269918, 2439786, 2157118, 5017546, 2914844, 8769513, 1626053, 6069135,
+	972630, 1833500, 7729725, 1215612, 4493352, 3117830, 4968938, 5225875,
+	856954, 3842420, 5565222, 6168161, 4593480, 2817384, 4040478, 1868291,
+	2634731, 8325087, 5613998, 6549098, 1135758, 7544814, 4065971, 4520940,
+	5131717, 716908, 2272836, 116679, 8188595, 2237902, 5199712, 3687899,
+	3221530, 8111102, 3103925, 2811565, 1713512, 2283133, 3400549, 2034218,
+	6611447, 5680054, 3188214, 6964849, 272856, 2161156, 2741735, 5340571,
+	539277, 7734168, 7298205, 1971490, 3252947, 8011099, 1214160, 3237476,
+	8127705, 5400001, 8056826, 5995816, 3535648, 2298263, 7193627, 7305807,
+	1987223, 2540319, 4333389, 4619281, 8062396, 261397, 183973, 7854391,
+	4145911, 3578132, 7798379, 5581559, 8257257, 1450260, 4150570, 5637462,
+	5913725, 5491767, 8097447, 3942589, 2001716, 6848632, 5792954, 2162563,
+	338832, 3965255, 540546, 3312575, 23364, 2123025, 4978555, 8292548,
+	2065187, 7596847, 6539266, 133141, 7005259, 8454526, 8485552, 1078305,
+	5219050, 6318565, 2157118, 2770883, 4589704, 972630, 2593106, 1507708,
+	4968938, 7188864, 8653768, 4593480, 4021129, 6000312, 5613998, 6521749,
+	636898, 5131717, 4528575, 1984341, 5199712, 2392515, 5493080, 1713512,
+	8004284, 4277556, 3188214, 1109603, 3557228, 539277, 7956331, 802084,
+	1214160, 4130559, 7265400, 3535648, 3387051, 5782051, 4333389, 6833406,
+	759624, 4145911, 5824800, 2771787, 4150570, 6982988, 1353200, 2001716,
+	752441, 8740000, 540546, 2032155, 2186733, 2065187, 5179027, 2461025,
+	8485552, 1118088, 4193520, 4589704, 3828246, 379631, 8653768, 5971808,
+	1263538, 636898, 5480081, 444053, 5493080, 8081990, 1265245, 3557228,
+	446534, 501989, 7265400, 6230368, 8329454, 759624, 6709618, 6986126,
+	1353200, 4660420, 1168845, 2186733, 405962, 8742916, 4193520, 6325367,
+	5911527, 1263538, 760882, 7230398, 1265245, 4596406, 4284175, 8329454,
+	6476638, 311004, 1168845, 6499361, 4435037, 5911527, 4884359, 2533737,
+	4284175, 4706077, 4879461, 4435037, 4357293, 7483883, 4879461, 3365961,
+	2350935, 2350935, 3731380, 1913566, 1263129, 3991280, 5744948, 2735066,
+	1421716, 4027109, 7222696, 5887983, 7942996, 667178, 2934207, 5940602,
+	7346119, 6109894, 7715935, 5642221, 1394701, 6968707, 5205657, 2375057,
+	8793221, 3119647, 2629509, 1817332, 6394549, 5774824, 6951690, 6712328,
+	7360192, 6053976, 58714, 5836172, 1744848, 1372401, 4073953, 993410,
+	8035699, 3377418, 3957758, 1222673, 8570060, 219208, 1826674, 3318310,
+	5952439, 1695729, 1909637, 8108993, 1609545, 6693294, 3820329, 1224314,
+	3859201, 1499007, 3443089, 750421, 8425450, 8703910, 79550, 5067998,
+	1801238, 1393925, 5027155, 5411744, 6639553, 1609962, 7736628, 4516261,
+	5567901, 595522, 8800356, 3338135, 2654743, 3236313, 3578688, 4986761,
+	1329007, 1301857, 3905685, 3185642, 232820, 617334, 1657493, 3226216,
+	4765917, 4225702, 1553845, 8398150, 2115797, 3739494, 1757887, 7546056,
+	3803731, 3779323, 4426994, 2637892, 5158316, 7360849, 7697790, 4326636,
+	7224765, 2247980, 8245643, 8475487, 1646869, 3094891, 2406484, 8073806,
+	1738081, 2074649, 6586890, 2096751, 169607, 1157946, 5322644, 4127378,
+	2413145, 7106346, 5729436, 8007247, 2723642, 8105432, 1516564, 3287498,
+	8210584, 107638, 4811046, 2522127, 6463439, 1804784, 1449376, 2699301,
+	104096, 4765603, 3440074, 2023532, 2125130, 640737, 7311953, 8792972,
+	2496649, 4433970, 2458562, 6123347, 6108777, 4921201, 4814066, 1261526,
+	8797215, 4295994, 1091609, 6863649, 6849771, 7393579, 1421840, 4337357,
+	7598784, 3479572, 3864477, 5882918, 4087007, 7204595, 4682486, 7080724,
+	3339679, 6517831, 5643953, 5728165, 4827205, 7685381, 8545882, 1442339,
+	2726009, 5211025, 6989152, 3459201, 5796081, 7236858, 6054743, 1977748,
+	2189895, 3983229, 3234628, 8179459, 1582657, 1136005, 3326108, 7829753,
+	8282345, 3320840, 3465858, 4818613, 3821479, 4101614, 8484745, 7177103,
+	6430630, 7883076, 630235, 7485872, 3106260, 4401799, 1316489, 5248385,
+	3480821, 6989475, 4267347, 8766584, 7007001, 4034194, 7316084, 1495452,
+	3365120, 8454726, 2602693, 5256828, 6971925, 4440452, 1043244, 470752,
+	5208251, 48604, 6990875, 7770147, 214389, 7402818, 6904536, 3349353,
+	4272256, 3415620, 2556111, 3324997, 5050031, 931009, 1791294, 2963960,
+	1032839, 887365, 7210339, 1420692, 1465061, 6676607, 6152660, 100134,
+	3669320, 2515359, 7163185, 6874358, 7193766, 4038251, 8650057, 6405600,
+	6974503, 2073967, 4880526, 28267, 190906, 1548198, 3085997, 6603619,
+	8686145, 8531366, 389871, 5626732, 6724428, 2367828, 8339545, 5368984,
+	5453725, 5876323, 5219599, 1991377, 1023089, 2942788, 960341, 4646830,
+	6035822, 7537252, 8226046, 3526998, 7907996, 1263588, 5139698, 4861818,
+	6120697, 8295118, 12322, 4379721, 7793820, 6544389, 1558941, 3515060,
+	4489043, 8001593, 6210616, 4039790, 3683994, 3963143, 5879302, 3856416,
+	3347578, 8647847, 876180, 5675392, 5038774, 8032559, 4337779, 8654628,
+	208960, 2636101, 677234, 1644396, 5724086, 3438188, 6121401, 1239885,
+	7551279, 8055036, 7675387, 1174176, 1846899, 1021414, 7568579, 7256431,
+	2126543, 4176063, 790041, 1754998, 317778, 1582866, 1658923, 6804076,
+	7681022, 6456305, 1588798, 7684146, 5455912, 2531556, 3604874, 8787646,
+	6804279, 8188928, 7640813, 2836438, 8188512, 6599981, 8400510, 8020517,
+	658618, 7967010, 7850360, 6941213, 6948797, 8290683, 6549234, 4864490,
+	3989400, 1041188, 4143281, 6935887, 2439786, 3229000, 2914844, 1577581,
+	6069135, 2719968, 7729725, 4878237, 3117830, 6900016, 856954, 1655145,
+	6168161, 3617072, 4040478, 5405370, 8325087, 4461632, 1135758, 2708114,
+	4520940, 8458118, 2272836, 8718868, 2237902, 663769, 3221530, 1858186,
+	2811565, 7672753, 3400549, 115033, 5680054, 7886457, 272856, 3804355,
+	5340571, 4897527, 7298205, 845399, 8011099, 3544705, 8127705, 4343764,
+	5995816, 4425291, 7193627, 3690473, 2540319, 7896618, 8062396, 8456825,
+	7854391, 8210134, 7798379, 317725, 1450260, 4911069, 5913725, 1816352,
+	3942589, 7353040, 5792954, 8229745, 3965255, 2346885, 23364, 5556882,
+	8292548, 2398823, 6539266, 6374477, 8454526, 2102293, 5219050, 617779,
+	2770883, 2869440, 2593106, 7720077, 7188864, 590088, 4021129, 1077377,
+	6521749, 6630148, 4528575, 1110965, 2392515, 8389932, 8004284, 4126857,
+	1109603, 7801432, 7956331, 7581425, 4130559, 1555366, 3387051, 1609601,
+	6833406, 1714913, 5824800, 8558668, 6982988, 5670155, 752441, 4662849,
+	2032155, 6066594, 5179027, 6279925, 1118088, 2580979, 3828246, 3399366,
+	5971808, 6073762, 5480081, 1285907, 8081990, 4581167, 446534, 6331302,
+	6230368, 559448, 6709618, 579772, 4660420, 4771438, 405962, 1803209,
+	6325367, 197639, 760882, 8148949, 4596406, 3307948, 6476638, 8378759,
+	6499361, 3515218, 4884359, 801792, 4706077, 4388919, 4357293, 4578810,
+	3365961, 1742267, 3731380, 7906582, 6542401, 5401606, 7724200, 8687969,
+	4278373, 1087072, 4328716, 3612284, 877543, 268977, 2915738, 3814369,
+	3945676, 6260073, 4348230, 8353107, 4034544, 8191784, 5969884, 1259914,
+	4763991, 8223491, 5951029, 6984550, 761638, 1223820, 2623213, 3698022,
+	3794635, 7471054, 1298188, 3542488, 2580771, 3307830, 6181402, 1479490,
+	7511401, 5263331, 5609149, 6814967, 8480381, 5075016, 1726992, 779894,
+	2817127, 3955595, 4627488, 1725343, 5470737, 4357142, 4201008, 1485944,
+	6026027, 663444, 2408380, 4000957, 3506879, 1653463, 1959797, 1359698,
+	7557611, 6264418, 6402779, 8733002, 2334606, 4567870, 2444004, 4965795,
+	1771921, 7392560, 7688943, 8641365, 2291498, 2511346, 5939300, 4088515,
+	2160970, 2146007, 8791786, 8345918, 3680948, 5158692, 8301601, 7416147,
+	4987130, 2252245, 1283391, 1786958, 931929, 4093134, 4901067, 7338644,
+	5040726, 4099822, 4001161, 4017287, 281334, 7383029, 1475663, 6752888,
+	3041620, 1372057, 3213265, 7629079, 8744534, 4737747, 4277490, 7694447,
+	4779091, 1920486, 8803268, 1807318, 7789444, 4412278, 1085024, 8021261,
+	2520106, 1406897, 2216535, 103381, 2976673, 6390842, 5316551, 6515974,
+	997739, 1233575, 580300, 5981476, 3813175, 958288, 8326865, 93547,
+	4821928, 3298968, 1641960, 8445855, 6857374, 8783003, 4004134, 2639092,
+	8160716, 7587517, 1739461, 5527409, 5084230, 7147138, 1991328, 900491,
+	4785027, 7955717, 6045197, 4543579, 3384409, 3815958, 7921354, 8235381,
+	433245, 8348788, 2045047, 3055814, 1618881, 3602043, 1704484, 6181365,
+	1386916, 5123919, 649324, 2346704, 8387143, 1026206, 1924881, 2166276,
+	6604978, 3269722, 7818237, 5919236, 6788233, 3308400, 7607542, 7758806,
+	7105771, 4290786, 5694475, 8701235, 2203341, 2358557, 2776785, 2962,
+	7410924, 735825, 7172822, 4536209, 2577951, 5068831, 3885404, 5342426,
+	722096, 8089428, 5557761, 1675165, 3358355, 345337, 2356, 5894712,
+	7145672, 7140037, 1857908, 2116009, 4269918, 6382585, 2290819, 812488,
+	5017546, 7819949, 1386019, 2879625, 1626053, 3913105, 4117200, 3397712,
+	1833500, 2763680, 2480816, 86368, 4493352, 1149429, 1646392, 1901437,
+	5225875, 60647, 1855897, 5901128, 5565222, 2709305, 7500822, 5244596,
+	2817384, 4598609, 3213, 8038926, 2634731, 6066135, 4030609, 7163055,
+	6549098, 4524218, 7843033, 6242341, 4065971, 7472369, 4588318, 705054,
+	716908, 3925693, 345812, 1190806, 8188595, 6807647, 7799023, 1929013,
+	3687899, 4916812, 2649429, 7573967, 3103925, 7376270, 2197927, 6446011,
+	2283133, 8032039, 3036739, 6793077, 6611447, 1821878, 135359, 3635860,
+	6964849, 4369582, 59324, 7362392, 2741735, 474272, 5198650, 2476825,
+	7734168, 7177982, 8629888, 25967, 3252947, 1113751, 546446, 628537,
+	3237476, 6488514, 2825947, 8389953, 8056826, 3337326, 630625, 8461652,
+	2298263, 1804094, 8539637, 3450631, 1987223, 8263063, 7977122, 6700661,
+	4619281, 7641352, 4185016, 5557165, 183973, 1835114, 6801908, 2256686,
+	3578132, 3595649, 3339978, 7265929, 8257257, 2267151, 3311639, 6894879,
+	5637462, 7120965, 7039610, 6272143, 8097447, 7988017, 7510028, 1828085,
+	6848632, 4543801, 3939853, 507568, 338832, 1360128, 8633471, 173992,
+	3312575, 420110, 1934941, 886473, 4978555, 7247518, 6276140, 464659,
+	7596847, 7449839, 1118104, 2621011, 7005259, 8492351, 8574033, 1343013,
+	1078305, 26964, 5747441, 155911, 2157118, 1324944, 8769513, 5518718,
+	972630, 127344, 1215612, 8536720, 4968938, 819066, 3842420, 3596150,
+	4593480, 4803737, 1868291, 1644352, 5613998, 1313883, 7544814, 696247,
+	5131717, 2526638, 116679, 981705, 5199712, 5133949, 8111102, 6886263,
+	1713512, 2319498, 2034218, 2411579, 3188214, 6667964, 2161156, 2611379,
+	539277, 324981, 1971490, 4165661, 1214160, 4903816, 5400001, 3708490,
+	3535648, 3100373, 7305807, 2232321, 4333389, 6487489, 261397, 1583860,
+	4145911, 4699506, 5581559, 8317915, 4150570, 7539683, 5491767, 4074356,
+	2001716, 441344, 2162563, 6131693, 540546, 3500019, 2123025, 4190668,
+	2065187, 546248, 133141, 6903065, 8485552, 379576, 6318565, 812317,
+	4589704, 4172826, 1507708, 7579709, 8653768, 6873881, 6000312, 6857642,
+	636898, 6523416, 1984341, 1052299, 5493080, 7359482, 4277556, 7859579,
+	3557228, 4193687, 802084, 5436661, 7265400, 6933699, 5782051, 7400362,
+	759624, 5001433, 2771787, 5131248, 1353200, 116256, 8740000, 2210320,
+	2186733, 4888546, 2461025, 3469132, 4193520, 384250, 379631, 6456175,
+	1263538, 5014598, 444053, 123840, 1265245, 468871, 501989, 4013456,
+	8329454, 6571225, 6986126, 4704790, 1168845, 6142019, 8742916, 689511,
+	5911527, 5133597, 7230398, 7525105, 4284175, 6787035, 311004, 2267600,
+	4435037, 5128196, 2533737, 245095, 4879461, 6180278, 7483883, 6946423,
+	2350935, 1339823, 1913566, 306069
+};
 
 /*
-We use Gentleman-Sande, decimation-in-frequency FFT, for the forward FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will invert 
-the fourier transform using decimation-in-time.
+Gentleman-Sande, decimation-in-frequency FFT, leaving the output in
+bit-reversed order for FFT_backward_2048_8816641.
+Coefficients are kept lazily reduced in [0, 2q), both on input and on output.
 */
 void FFT_forward_2048_8816641(FFTSHORT x[2048]) {
-        const FFTSHORT n = 2048;
-        const FFTSHORT q = 8816641;
-
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = 1;
-	for (m = n>>1; m >= 1; m=m>>1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {
-				ADD_MOD(t0, x[i], x[i+m], q);
-				ADD(t1, x[i], q - x[i+m]);
-				MUL_MOD(x[i+m], t1, W_2048_8816641[index], q);				
-				x[i] = t0;				
-			}
-			SUB_MODn(index, index, step, n);
+	const FFTSHORT q = 8816641, q2 = 2*8816641, qinv = 1481017343U;
+	const FFTSHORT *w = W_fwd_2048_8816641;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_forward_2048_8816641_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layer m = 1024 */
+	for (j = 0; j < 1024; ++j, w += 1) {
+		a0 = x[j]; a1 = x[j+1024];
+		GS(a0, a1, w[0]);
+		x[j] = a0; x[j+1024] = a1;
+	}
+
+	/* Layers m = 512, 256 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 1024) {
+			a0 = x[i]; a1 = x[i+256]; a2 = x[i+512]; a3 = x[i+768];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+256] = a1; x[i+512] = a2; x[i+768] = a3;
 		}
-		step = step << 1;
-	}	 
+	}
+
+	/* Layers m = 128, 64 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layers m = 32, 16 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 8, 4 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
+	}
+
+	/* Layers m = 2, 1 */
+	for (i = 0; i < 2048; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		GS1(a0, a2);
+		GS(a1, a3, 2274240);
+		GS1(a0, a1);
+		GS1(a2, a3);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
 }
 
 /*
-We use Cooley-Tukey, decimation-in-time FFT, for the inverse FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will the forward
-fourier transform is using decimation-in-frequency.
+Cooley-Tukey, decimation-in-time FFT, inverting FFT_forward_2048_8816641 up to
+the factor n.
+The output is lazily reduced to [0, 2q); callers finish the reduction.
 */
 void FFT_backward_2048_8816641(FFTSHORT x[2048]) {
-        const FFTSHORT n = 2048;
-        const FFTSHORT q = 8816641;
-
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = n>>1;
-	for (m = 1; m < n; m=m<<1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {							
-				t0 = x[i];
-				t0 -= (t0 >= q) ? q : 0;
-				MUL_MOD(t1, x[i+m], W_rev_2048_8816641[index], q);				
-				ADD(x[i], t0, t1);
-				ADD(x[i+m], t0, q - t1);
-				
-			}
-			SUB_MODn(index, index, step, n);
+	const FFTSHORT q = 8816641, q2 = 2*8816641, qinv = 1481017343U;
+	const FFTSHORT *w = W_bwd_2048_8816641;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+#ifdef FFT_AVX2
+	if (FFT_AVX2_CAPABLE) {
+		FFT_backward_2048_8816641_avx2(x);
+		return;
+	}
+#endif
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 2048; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 6542401);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
+	}
+
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
 		}
-		step = step >> 1;
-	}	
-	for (i = 0; i < n; ++i) {
-		x[i] -= (x[i] >= q) ? q : 0;
 	}
-}
 
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
 
+	/* Layers m = 256, 512 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 2048; i += 1024) {
+			a0 = x[i]; a1 = x[i+256]; a2 = x[i+512]; a3 = x[i+768];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+256] = a1; x[i+512] = a2; x[i+768] = a3;
+		}
+	}
+
+	/* Layer m = 1024 */
+	for (j = 0; j < 1024; ++j, w += 1) {
+		a0 = x[j]; a1 = x[j+1024];
+		CT(a0, a1, w[0]);
+		x[j] = a0; x[j+1024] = a1;
+	}
+}
@@ -8,164 +8,369 @@
  * See LICENSE for complete information.
  */
 
-/* Code to compute a Number Theoretic Transform for multiplication in the ring 
+/* Generated by util/ringlwe_fft.pl: do not edit. */
+
+/* Code to compute a Number Theoretic Transform for multiplication in the ring
 F_q[x] / <x^n+1>.
 	n = 256, q = 15361	*/
 
 #include "FFT_includes.h"
-#include "FFT_constants.h"
+
+#define GS(a, b, w) BFLY_GS(a, b, w, q, q, qinv, MUL_MONT_RED)
+#define GS1(a, b) BFLY_GS_1(a, b, q)
+#define CT(a, b, w) BFLY_CT(a, b, w, q, q, qinv, MUL_MONT_RED)
+#define CT1(a, b) BFLY_CT_1(a, b, q)
+
+/* The twiddle factors w^k in Montgomery form, in the order the stages
+read them, with the twist psi^k by the 2n'th root interleaved into the
+first forward stage and psi^-k * n^-1 into the last backward stage */
+static const RINGELT W_fwd_256_15361[508] = {
+	974, 3413, 6140, 5618, 974, 9221, 974, 5297,
+	13688, 10713, 2512, 9314, 14747, 10148, 9740, 3408,
+	15317, 10097, 10148, 6083, 5017, 6887, 13992, 14964,
+	9759, 4087, 11361, 511, 5234, 3358, 14921, 8804,
+	5017, 14961, 7532, 7426, 1671, 11391, 5424, 5110,
+	15321, 13593, 6257, 2858, 10961, 11235, 511, 15357,
+	13500, 12816, 1349, 6383, 8157, 13876, 6144, 135,
+	1126, 13219, 2083, 4823, 7532, 9831, 9986, 5272,
+	13490, 2386, 4765, 13042, 14808, 11467, 11260, 9302,
+	5469, 2147, 13593, 4553, 8256, 6637, 12012, 8499,
+	1567, 12112, 11208, 697, 5073, 854, 8607, 6109,
+	13500, 4193, 3540, 4926, 12593, 8185, 309, 1350,
+	11172, 9252, 4647, 8540, 9265, 15007, 135, 13406,
+	10538, 3177, 3042, 5045, 3090, 7694, 7485, 6557,
+	387, 8595, 484, 11821, 9986, 8429, 9743, 1048,
+	15059, 4367, 178, 7143, 2379, 5781, 3870, 9145,
+	4840, 10683, 11467, 1774, 12193, 10480, 12341, 12948,
+	1780, 5755, 9394, 13486, 7978, 14645, 2317, 14664,
+	8256, 10156, 11502, 12634, 522, 6592, 2439, 6970,
+	7160, 2880, 2975, 8201, 7809, 8391, 697, 716,
+	3101, 3452, 5220, 4476, 9029, 4678, 6216, 9094,
+	14389, 5205, 1285, 7105, 3540, 6766, 7157, 3798,
+	6117, 14038, 13485, 354, 6821, 9749, 5641, 5967,
+	12850, 9606, 9252, 14507, 14076, 7258, 15087, 2131,
+	11962, 13214, 6059, 13044, 10327, 13587, 5612, 3894,
+	10538, 2142, 14877, 11136, 12621, 5949, 12093, 4126,
+	12503, 6754, 11104, 12982, 10037, 8218, 6557, 12003,
+	13278, 3833, 3322, 13407, 13403, 5264, 11953, 440,
+	3513, 6932, 8204, 5375, 9743, 11948, 9221, 7608,
+	2498, 11182, 11142, 11727, 4267, 6083, 4408, 7876,
+	5235, 7667, 5781, 5035, 14961, 14636, 9619, 4293,
+	3893, 14403, 8184, 15357, 13358, 1955, 6267, 15226,
+	12193, 10035, 9831, 8111, 4024, 12208, 8208, 11972,
+	8684, 4553, 10692, 4189, 1226, 14011, 13486, 10085,
+	4193, 4305, 9518, 14553, 5275, 7493, 8689, 13406,
+	14754, 11168, 12260, 1861, 11502, 2405, 8429, 12328,
+	3014, 7281, 6667, 13439, 7921, 1774, 9291, 4153,
+	15073, 3249, 2880, 14617, 10156, 392, 14779, 11366,
+	5226, 288, 6070, 716, 744, 10808, 12481, 1768,
+	3101, 607, 6766, 3920, 9541, 6133, 6177, 14135,
+	4669, 14507, 7440, 553, 1922, 2319, 9094, 2003,
+	2142, 8478, 3244, 15247, 326, 10126, 10953, 12003,
+	12956, 5530, 3859, 7829, 7157, 11848, 11948, 7975,
+	1718, 14221, 3260, 5324, 4257, 5035, 6672, 9217,
+	7868, 1485, 9749, 5034, 10035, 2945, 1819, 3961,
+	1878, 2511, 9720, 10085, 5276, 4, 1875, 14850,
+	14076, 972, 2405, 14089, 2829, 8888, 3419, 7552,
+	12386, 14617, 6677, 40, 3389, 10251, 13044, 7383,
+	607, 2641, 12929, 12075, 3468, 10521, 11491, 2003,
+	5326, 400, 3168, 10344, 14877, 14974, 11848, 11049,
+	6402, 13223, 3958, 6096, 10714, 5034, 7177, 4000,
+	958, 11274, 6754, 10288, 972, 2963, 2576, 9342,
+	8858, 9892, 4101, 7383, 10326, 9278, 9580, 5213,
+	13278, 14235, 14974, 14269, 10399, 1254, 11775, 4400,
+	9104, 10288, 11094, 614, 3634, 6047, 440, 10127,
+	14235, 4441, 11824, 12540, 10223, 44, 5621, 10127,
+	974, 9221, 974, 5017, 14961, 7532, 7532, 9831,
+	9986, 13500, 4193, 3540, 9986, 8429, 9743, 8256,
+	10156, 11502, 3540, 6766, 7157, 10538, 2142, 14877,
+	9743, 11948, 9221, 12193, 10035, 9831, 11502, 2405,
+	8429, 3101, 607, 6766, 7157, 11848, 11948, 14076,
+	972, 2405, 14877, 14974, 11848, 13278, 14235, 14974,
+	974, 9221, 974, 9986, 8429, 9743, 9743, 11948,
+	9221, 7157, 11848, 11948
+};
+
+static const RINGELT W_bwd_256_15361[508] = {
+	974, 974, 6140, 3413, 3513, 8204, 6140, 3413,
+	5618, 5618, 6932, 5375, 974, 974, 6140, 387,
+	1126, 2083, 3513, 387, 484, 12956, 14389, 1285,
+	3413, 3513, 8204, 8595, 14754, 12260, 6932, 12956,
+	3859, 5530, 5326, 3168, 6140, 3413, 5618, 484,
+	13219, 4823, 8204, 8595, 11821, 3859, 5205, 7105,
+	5618, 6932, 5375, 11821, 11168, 1861, 5375, 5530,
+	7829, 7829, 400, 10344, 974, 974, 6140, 3004,
+	14499, 15097, 5087, 5234, 9740, 15317, 14301, 15072,
+	2834, 5323, 1126, 5234, 14921, 9517, 2986, 6118,
+	5117, 5073, 6257, 10961, 15255, 13796, 9500, 11285,
+	387, 1126, 2083, 5560, 6443, 3684, 5120, 7978,
+	11260, 5469, 9206, 7524, 950, 8809, 14389, 5073,
+	8607, 556, 11397, 9585, 512, 10327, 4647, 9265,
+	7065, 9969, 95, 2417, 3513, 387, 484, 6200,
+	5748, 8639, 12340, 13358, 3870, 4840, 8387, 2533,
+	7690, 4850, 14754, 7978, 2317, 620, 3647, 2400,
+	1234, 744, 2975, 7809, 5447, 11006, 769, 485,
+	12956, 14389, 1285, 62, 4973, 240, 9340, 5276,
+	5641, 12850, 5153, 7245, 1613, 7729, 5326, 10327,
+	5612, 12295, 11250, 24, 934, 10326, 11104, 10037,
+	11268, 8405, 10914, 2309, 3413, 3513, 8204, 8910,
+	1125, 9219, 9310, 3358, 4408, 5235, 4199, 8521,
+	10308, 1767, 13219, 13358, 6267, 891, 7793, 2458,
+	931, 854, 10692, 1226, 1956, 14677, 4103, 4785,
+	8595, 14754, 12260, 13914, 11532, 3318, 13918, 14645,
+	9291, 15073, 6340, 6076, 11163, 8159, 5205, 744,
+	12481, 10608, 13442, 3404, 4464, 13587, 7440, 1922,
+	634, 6752, 11869, 2352, 6932, 12956, 3859, 4133,
+	13633, 9557, 9663, 1955, 6672, 7868, 9280, 12964,
+	2723, 12524, 11168, 5276, 1875, 11166, 12116, 5564,
+	11719, 10808, 6677, 3389, 928, 10513, 11025, 10469,
+	5530, 5326, 3168, 7261, 7356, 9773, 2708, 4,
+	7177, 958, 3165, 11804, 8783, 2583, 400, 10326,
+	9580, 14551, 6880, 11730, 3343, 9278, 11094, 3634,
+	7997, 10397, 11631, 11011, 6140, 3413, 5618, 15280,
+	688, 1173, 11087, 14921, 3408, 10097, 5408, 5648,
+	14988, 14926, 2083, 3358, 8804, 1528, 3141, 10870,
+	5717, 8607, 2858, 11235, 3613, 3637, 4571, 7637,
+	484, 13219, 4823, 3225, 14139, 1087, 5180, 2317,
+	9302, 2147, 11114, 4972, 14282, 5372, 1285, 854,
+	6109, 8003, 2950, 4717, 518, 5612, 8540, 15007,
+	10328, 12786, 13717, 12826, 8204, 8595, 11821, 11553,
+	295, 5080, 3124, 6267, 9145, 10683, 4105, 7423,
+	5980, 7427, 12260, 14645, 14664, 11908, 7710, 508,
+	9529, 12481, 8201, 8391, 8091, 11495, 598, 5351,
+	3859, 5205, 7105, 4263, 771, 3123, 2489, 1875,
+	5967, 9606, 14634, 8830, 3132, 14360, 3168, 13587,
+	3894, 11179, 13902, 11065, 1785, 9580, 12982, 8218,
+	10680, 883, 12602, 1436, 5618, 6932, 5375, 2654,
+	13679, 8787, 7859, 8804, 7876, 7667, 1068, 10841,
+	13549, 6288, 4823, 1955, 15226, 9482, 2904, 5487,
+	2322, 6109, 4189, 14011, 3179, 14909, 2891, 3701,
+	11821, 11168, 1861, 13237, 9507, 5157, 12521, 14664,
+	4153, 3249, 1854, 3027, 14114, 14195, 7105, 10808,
+	1768, 5932, 5559, 5124, 15077, 3894, 553, 2319,
+	9402, 4911, 10628, 9100, 5375, 5530, 7829, 12882,
+	2092, 9729, 6116, 15226, 9217, 1485, 13229, 14316,
+	4135, 910, 1861, 4, 14850, 13577, 12498, 2509,
+	6756, 1768, 40, 10251, 2859, 7576, 8094, 91,
+	7829, 400, 10344, 5966, 4322, 1787, 6820, 14850,
+	4000, 11274, 1822, 6902, 10026, 13834, 10344, 9278,
+	5213, 6741, 12721, 4787, 682, 5213, 614, 6047,
+	12471, 12979, 7147, 10600
+};
 
 /*
-We use Gentleman-Sande, decimation-in-frequency FFT, for the forward FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will invert 
-the fourier transform using decimation-in-time.
+Gentleman-Sande, decimation-in-frequency FFT, premultiplying x by the
+powers of the 2n'th root of unity so that point-wise multiplication gives
+the negacyclic convolution, i.e. multiplication modulo x^n+1.  The output
+is left in bit-reversed order for FFT_twisted_backward_256_15361.
 */
-void FFT_forward_256_15361(FFTSHORT x[256]) {
-        const FFTSHORT n = 256;
-	const FFTSHORT q = 15361;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = 1;
-	for (m = n>>1; m >= 1; m=m>>1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {
-				ADD_MOD(t0, x[i], x[i+m], q);
-				ADD(t1, x[i], q - x[i+m]);
-				MUL_MOD(x[i+m], t1, W_256_15361[index], q);				
-				x[i] = t0;				
-			}
-			SUB_MODn(index, index, step, n);
+void FFT_twisted_forward_256_15361(RINGELT x[256]) {
+	const FFTSHORT q = 15361, qinv = 2985311231U;
+	const RINGELT *w = W_fwd_256_15361;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	/* Layers m = 128, 64 */
+	for (j = 0; j < 64; ++j, w += 7) {
+		MUL_MONT_RED(a0, x[j], w[0], q, qinv);
+		MUL_MONT_RED(a1, x[j+64], w[1], q, qinv);
+		MUL_MONT_RED(a2, x[j+128], w[2], q, qinv);
+		MUL_MONT_RED(a3, x[j+192], w[3], q, qinv);
+		GS(a0, a2, w[4]);
+		GS(a1, a3, w[5]);
+		GS(a0, a1, w[6]);
+		GS(a2, a3, w[6]);
+		x[j] = a0; x[j+64] = a1; x[j+128] = a2; x[j+192] = a3;
+	}
+
+	/* Layers m = 32, 16 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 256; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
 		}
-		step = step << 1;
-	}	 
-}
+	}
 
-/*
-We use Cooley-Tukey, decimation-in-time FFT, for the inverse FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will the forward
-fourier transform is using decimation-in-frequency.
-*/
-void FFT_backward_256_15361(FFTSHORT x[256]) {
-        const FFTSHORT n = 256;
-	const FFTSHORT q = 15361;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = n>>1;
-	for (m = 1; m < n; m=m<<1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {							
-				t0 = x[i];
-				t0 -= (t0 >= q) ? q : 0;
-				MUL_MOD(t1, x[i+m], W_rev_256_15361[index], q);				
-				ADD(x[i], t0, t1);
-				ADD(x[i+m], t0, q - t1);
-				
-			}
-			SUB_MODn(index, index, step, n);
+	/* Layers m = 8, 4 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 256; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
 		}
-		step = step >> 1;
-	}	
-	for (i = 0; i < n; ++i) {
-		x[i] -= (x[i] >= q) ? q : 0;
 	}
-}
 
+	/* Layers m = 2, 1 */
+	for (i = 0; i < 256; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		GS1(a0, a2);
+		GS(a1, a3, 9221);
+		GS1(a0, a1);
+		GS1(a2, a3);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+}
 
 /*
-We use Gentleman-Sande, decimation-in-frequency FFT, for the forward FFT.
-We premultiply x by the 2n'th roots of unity to affect a Discrete Weighted Fourier Transform, 
-so when we apply pointwise multiplication we obtain the negacyclic convolution, i.e. multiplication 
-modulo x^n+1.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will invert 
-the fourier transform using decimation-in-time.
+Cooley-Tukey, decimation-in-time FFT, inverting FFT_twisted_forward_256_15361:
+postmultiplies x by the inverse powers of the 2n'th root of unity and by
+n^-1.
 */
-void FFT_twisted_forward_256_15361(FFTSHORT x[256]) {
-        const FFTSHORT n = 256;
-	const FFTSHORT q = 15361;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	//Pre multiplication for twisted FFT
-	j = 0;
-	for (i = 0; i < n>>1; ++i) {
-		MUL_MOD(x[j], x[j], W_256_15361[i], q);
-		j++;	
-		MUL_MOD(x[j], x[j], W_sqrt_256_15361[i], q);	
-		j++;
+void FFT_twisted_backward_256_15361(RINGELT x[256]) {
+	const FFTSHORT q = 15361, qinv = 2985311231U;
+	const RINGELT *w = W_bwd_256_15361;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 256; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 6140);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
 	}
 
-	step = 1;
-	for (m = n>>1; m >= 1; m=m>>1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {				
-				ADD_MOD(t0, x[i], x[i+m], q);
-				ADD(t1, x[i], q - x[i+m]);
-				MUL_MOD(x[i+m], t1, W_256_15361[index], q);				
-				x[i] = t0;						
-			}
-			SUB_MODn(index, index, step, n);
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 256; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
 		}
-		step = step << 1;
-	}	 
+	}
+
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 256; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 7) {
+		a0 = x[j]; a1 = x[j+64]; a2 = x[j+128]; a3 = x[j+192];
+		CT(a0, a1, w[0]);
+		CT(a2, a3, w[0]);
+		CT(a0, a2, w[1]);
+		CT(a1, a3, w[2]);
+		MUL_MONT_RED(x[j], a0, w[3], q, qinv);
+		MUL_MONT_RED(x[j+64], a1, w[4], q, qinv);
+		MUL_MONT_RED(x[j+128], a2, w[5], q, qinv);
+		MUL_MONT_RED(x[j+192], a3, w[6], q, qinv);
+	}
 }
 
 /*
-We use Cooley-Tukey, decimation-in-time FFT, for the inverse FFT.
-We postmultiply x by the inverse of the 2n'th roots of unity * n^-1 to affect a Discrete Weighted Fourier Transform, 
-so when we apply pointwise multiplication we obtain the negacyclic convolution, i.e. multiplication 
-modulo x^n+1.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will the forward
-fourier transform is using decimation-in-frequency.
+x = FFT_twisted_backward_256_15361 of the point-wise product a*b, formed as the
+first stage loads it.  x may alias a or b.
 */
-void FFT_twisted_backward_256_15361(FFTSHORT x[256]) {
-        const FFTSHORT n = 256;
-	const FFTSHORT q = 15361;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = n>>1;
-	for (m = 1; m < n; m=m<<1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {							
-				t0 = x[i];
-				t0 -= (t0 >= q) ? q : 0;
-				MUL_MOD(t1, x[i+m], W_rev_256_15361[index], q);				
-				ADD(x[i], t0, t1);
-				ADD(x[i+m], t0, q - t1);
-			}
-			SUB_MODn(index, index, step, n);
+void FFT_twisted_backward_mul_256_15361(RINGELT x[256], const RINGELT a[256], const RINGELT b[256]) {
+	const FFTSHORT q = 15361, qinv = 2985311231U;
+	const FFTSHORT mu = BARRETT_MU(15361);
+	const RINGELT *w = W_bwd_256_15361;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 256; i += 4) {
+		MUL_BARRETT(a0, a[i], b[i], q, mu);
+		MUL_BARRETT(a1, a[i+1], b[i+1], q, mu);
+		MUL_BARRETT(a2, a[i+2], b[i+2], q, mu);
+		MUL_BARRETT(a3, a[i+3], b[i+3], q, mu);
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 6140);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 256; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
 		}
-		step = step >> 1;
 	}
 
-	//Post multiplication for twisted FFT
-	j = 0;
-	for (i = 0; i < n>>1; ++i) {
-		MUL_MOD(x[j], x[j], W_rev_256_15361[i], q);
-		j++;	
-		MUL_MOD(x[j], x[j], W_sqrt_rev_256_15361[i], q);
-		j++;
-	} 
-}
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 256; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
 
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 7) {
+		a0 = x[j]; a1 = x[j+64]; a2 = x[j+128]; a3 = x[j+192];
+		CT(a0, a1, w[0]);
+		CT(a2, a3, w[0]);
+		CT(a0, a2, w[1]);
+		CT(a1, a3, w[2]);
+		MUL_MONT_RED(x[j], a0, w[3], q, qinv);
+		MUL_MONT_RED(x[j+64], a1, w[4], q, qinv);
+		MUL_MONT_RED(x[j+128], a2, w[5], q, qinv);
+		MUL_MONT_RED(x[j+192], a3, w[6], q, qinv);
+	}
+}
 
-void _FFT_forward_256_15361(FFTSHORT *x) {
+void _FFT_forward_256_15361(RINGELT *x) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_forward_256_15361_avx2(x);
+    return;
+  }
+#endif
   FFT_twisted_forward_256_15361(x);
 }
 
-void _FFT_backward_256_15361(FFTSHORT *x) {
-  int i;
+void _FFT_backward_256_15361(RINGELT *x) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_backward_256_15361_avx2(x);
+    return;
+  }
+#endif
   FFT_twisted_backward_256_15361(x);
-  for (i=0; i<256; ++i)
-    MUL_MOD(x[i], x[i], 15301, 15361);
+}
+
+void _FFT_backward_mul_256_15361(RINGELT *x, const RINGELT *a, const RINGELT *b) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_backward_mul_256_15361_avx2(x, a, b);
+    return;
+  }
+#endif
+  FFT_twisted_backward_mul_256_15361(x, a, b);
 }
@@ -18,113 +18,221 @@ F_q[x] / <x^n+1>.
 /*
 We use Bluestein's trick and integer convoution by CRT.
 */
-void FFT_forward_433_35507(FFTSHORT x[433]) {
+void FFT_forward_433_35507(RINGELT x[433]) {
         const FFTSHORT n = 433;
-        const FFTSHORT q = 35507;
+        const FFTSHORT q = 35507, qinv = 894749573U;
         const FFTSHORT N = 1024;
 
 	FFTSHORT x0[1024], x1[1024];
-	FFTSHORT i;
-	FFTLONG x_crt[1024];
-	const FFTSHORT q0 = 8816641, Ninvq0 = 8808031;	
-	const FFTSHORT q1 = 17633281, Ninvq1 = 17616061;
-	const FFTLONG h0 = 17633282UL, h1 = 17633281UL;
-	const FFTLONG q0q1 = 155466308229121UL;
+	FFTSHORT i, t;
+	const FFTSHORT q0 = 8816641, q0inv = 1481017343U;
+	const FFTSHORT q1 = 17633281, q1inv = 1611468799U;
+	const FFTSHORT q0invq1 = 2526745; /* q0^-1 * 2^32 mod q1 */
+	const FFTSHORT rq = 5069, q0q = 28553; /* 2^32 mod q, q0 * 2^32 mod q */
 	
 	/*Setup Bluestein's method*/
 	for (i = 0; i < n; ++i) {
-		MUL_MOD(x0[i], x[i], Bluestein_mul_433_35507[i], q);
+		MUL_MONT_RED(x0[i], x[i], Bluestein_mul_433_35507[i], q, qinv);
 	}
 	memset((void *) (x0+n), 0, (N-n)*sizeof(FFTSHORT)); /*Pad with 0's*/
 	memcpy((void *) x1, (void *) x0, N*sizeof(FFTSHORT)); /*Copy x0 into x1*/
 	
-	/*Cyclic convolution*/
+	/*Cyclic convolution; the N^-1 scaling is folded into the filter tables*/
 	FFT_forward_1024_8816641(x0);
 	FFT_forward_1024_17633281(x1);
-	
-	for (i = 0; i < N; ++i) {
-		MUL_MOD(x0[i], x0[i], Bluestein_roots_fft_433_8816641[i], q0);
-		MUL_MOD(x1[i], x1[i], Bluestein_roots_fft_433_17633281[i], q1);		
-	}
+	POINTWISE_MUL_MONT(x0, Bluestein_roots_fft_433_8816641, N, q0, q0inv);
+	POINTWISE_MUL_MONT(x1, Bluestein_roots_fft_433_17633281, N, q1, q1inv);
 	FFT_backward_1024_8816641(x0);
 	FFT_backward_1024_17633281(x1);
 	
-	/*Apply the CRT*/
-	for (i = 0; i < N; ++i) {
-		MUL_MOD(x0[i], x0[i], Ninvq0, q0); /*Scaling for the convolution*/
-		MUL_MOD(x1[i], x1[i], Ninvq1, q1); /*Scaling for the convolution*/
-		x_crt[i] = h1*x0[i] % q0q1;
-		x_crt[i] = q0q1 - x_crt[i];
-		x_crt[i] += h0*x1[i];
-		x_crt[i] = x_crt[i] % q0q1; //Will now be the integer convolution
-		x_crt[i] = x_crt[i] % q; 
+	/*Apply the CRT (Garner) to the n outputs Bluestein needs: the integer
+	  convolution is x0 + q0*t with t = (x1 - x0) * q0^-1 mod q1, and is
+	  reduced mod q straight away*/
+	for (i = (N>>1)-1; i < (N>>1)+n-1; ++i) {
+		CSUB(x0[i], q0);
+		CSUB(x1[i], q1);
+		MUL_MONT(t, x1[i] + q1 - x0[i], q0invq1, q1, q1inv);
+		CSUB(t, q1);
+		MONT_REDUCE(x0[i], (FFTLONG) x0[i]*rq + (FFTLONG) t*q0q, q, qinv);
 	}
 		
 	/*Complete Bluestein's trick*/
-	x[0] = (FFTSHORT) x_crt[(N>>1)-1];
+	t = x0[(N>>1)-1];
+	CSUB(t, q);
+	x[0] = (RINGELT) t;
 	for (i = 0; i < n-1; ++i) {
-		MUL_MOD(x[i+1], x_crt[(N>>1)+i], Bluestein_mul_433_35507[i], q);
+		MUL_MONT_RED(x[i+1], x0[(N>>1)+i], Bluestein_mul_433_35507[i], q, qinv);
 	}		
 	
 }
 
-void FFT_backward_433_35507(FFTSHORT x[433]) {
+void FFT_backward_433_35507(RINGELT x[433]) {
         const FFTSHORT n = 433;
-        const FFTSHORT q = 35507;
+        const FFTSHORT q = 35507, qinv = 894749573U;
         const FFTSHORT N = 1024;
 
 	FFTSHORT x0[1024], x1[1024];
-	FFTSHORT i;
-	FFTLONG x_crt[1024];
-	const FFTSHORT q0 = 8816641, Ninvq0 = 8808031;	
-	const FFTSHORT q1 = 17633281, Ninvq1 = 17616061;
-	const FFTLONG h0 = 17633282UL, h1 = 17633281UL;
-	const FFTLONG q0q1 = 155466308229121UL;
+	FFTSHORT i, t;
+	const FFTSHORT q0 = 8816641, q0inv = 1481017343U;
+	const FFTSHORT q1 = 17633281, q1inv = 1611468799U;
+	const FFTSHORT q0invq1 = 2526745; /* q0^-1 * 2^32 mod q1 */
+	const FFTSHORT rq = 5069, q0q = 28553; /* 2^32 mod q, q0 * 2^32 mod q */
 	
 	/*Setup Bluestein's method*/
 	for (i = 0; i < n; ++i) {
-		MUL_MOD(x0[i], x[i], Bluestein_mul_inv_433_35507[i], q);
+		MUL_MONT_RED(x0[i], x[i], Bluestein_mul_inv_433_35507[i], q, qinv);
 	}
 	memset((void *) (x0+n), 0, (N-n)*sizeof(FFTSHORT)); /*Pad with 0's*/
 	memcpy((void *) x1, (void *) x0, N*sizeof(FFTSHORT)); /*Copy x0 into x1*/
-		
-	/*Cyclic convolution*/
+	
+	/*Cyclic convolution; the N^-1 scaling is folded into the filter tables*/
 	FFT_forward_1024_8816641(x0);
 	FFT_forward_1024_17633281(x1);
-	for (i = 0; i < N; ++i) {
-		MUL_MOD(x0[i], x0[i], Bluestein_roots_inv_fft_433_8816641[i], q0);
-		MUL_MOD(x1[i], x1[i], Bluestein_roots_inv_fft_433_17633281[i], q1);		
-	}
+	POINTWISE_MUL_MONT(x0, Bluestein_roots_inv_fft_433_8816641, N, q0, q0inv);
+	POINTWISE_MUL_MONT(x1, Bluestein_roots_inv_fft_433_17633281, N, q1, q1inv);
 	FFT_backward_1024_8816641(x0);
 	FFT_backward_1024_17633281(x1);
 	
-	/*Apply the CRT*/
-	for (i = 0; i < N; ++i) {
-		MUL_MOD(x0[i], x0[i], Ninvq0, q0); /*Scaling for the convolution*/
-		MUL_MOD(x1[i], x1[i], Ninvq1, q1); /*Scaling for the convolution*/
-		x_crt[i] = h1*x0[i] % q0q1;
-		x_crt[i] = q0q1 - x_crt[i];
-		x_crt[i] += h0*x1[i];
-		x_crt[i] = x_crt[i] % q0q1; //Will now be the integer convolution
-		x_crt[i] = x_crt[i] % q; 
+	/*Apply the CRT (Garner) to the n outputs Bluestein needs: the integer
+	  convolution is x0 + q0*t with t = (x1 - x0) * q0^-1 mod q1, and is
+	  reduced mod q straight away*/
+	for (i = (N>>1)-1; i < (N>>1)+n-1; ++i) {
+		CSUB(x0[i], q0);
+		CSUB(x1[i], q1);
+		MUL_MONT(t, x1[i] + q1 - x0[i], q0invq1, q1, q1inv);
+		CSUB(t, q1);
+		MONT_REDUCE(x0[i], (FFTLONG) x0[i]*rq + (FFTLONG) t*q0q, q, qinv);
 	}
-			
+		
 	/*Complete Bluestein's trick*/
-	x[0] = (FFTSHORT) x_crt[(N>>1)-1];	
+	t = x0[(N>>1)-1];
+	CSUB(t, q);
+	x[0] = (RINGELT) t;
 	for (i = 0; i < n-1; ++i) {
-		MUL_MOD(x[i+1], x_crt[(N>>1)+i], Bluestein_mul_inv_433_35507[i], q);		
+		MUL_MONT_RED(x[i+1], x0[(N>>1)+i], Bluestein_mul_inv_433_35507[i], q, qinv);
+	}		
+	
+}
+
+/*
+x = FFT_backward of the point-wise product a*b, scaled by n^-1 and mapped
+to F_q[x]/<1+x+...+x^{n-1}>: POINTWISE_MUL, _FFT_backward_433_35507 and
+MAPTOCYCLOTOMIC in one pass in and one out.  The products and the scaling
+go into the setup of Bluestein's method and the map into its completion.
+x may alias a or b.
+*/
+void FFT_backward_mul_433_35507(RINGELT x[433], const RINGELT a[433], const RINGELT b[433]) {
+        const FFTSHORT n = 433;
+        const FFTSHORT q = 35507, qinv = 894749573U, mu = BARRETT_MU(35507);
+        const FFTSHORT scale = 10426; /* 35425 in Montgomery form */
+        const FFTSHORT N = 1024;
+
+	FFTSHORT x0[1024], x1[1024];
+	FFTSHORT i, t, last;
+	const FFTSHORT q0 = 8816641, q0inv = 1481017343U;
+	const FFTSHORT q1 = 17633281, q1inv = 1611468799U;
+	const FFTSHORT q0invq1 = 2526745; /* q0^-1 * 2^32 mod q1 */
+	const FFTSHORT rq = 5069, q0q = 28553; /* 2^32 mod q, q0 * 2^32 mod q */
+	
+	/*Setup Bluestein's method on the scaled point-wise products*/
+	for (i = 0; i < n; ++i) {
+		MUL_BARRETT(t, a[i], b[i], q, mu);
+		MUL_MONT_RED(t, t, scale, q, qinv);
+		MUL_MONT_RED(x0[i], t, Bluestein_mul_inv_433_35507[i], q, qinv);
+	}
+	memset((void *) (x0+n), 0, (N-n)*sizeof(FFTSHORT)); /*Pad with 0's*/
+	memcpy((void *) x1, (void *) x0, N*sizeof(FFTSHORT)); /*Copy x0 into x1*/
+	
+	/*Cyclic convolution; the N^-1 scaling is folded into the filter tables*/
+	FFT_forward_1024_8816641(x0);
+	FFT_forward_1024_17633281(x1);
+	POINTWISE_MUL_MONT(x0, Bluestein_roots_inv_fft_433_8816641, N, q0, q0inv);
+	POINTWISE_MUL_MONT(x1, Bluestein_roots_inv_fft_433_17633281, N, q1, q1inv);
+	FFT_backward_1024_8816641(x0);
+	FFT_backward_1024_17633281(x1);
+	
+	/*Apply the CRT (Garner) to the n outputs Bluestein needs: the integer
+	  convolution is x0 + q0*t with t = (x1 - x0) * q0^-1 mod q1, and is
+	  reduced mod q straight away*/
+	for (i = (N>>1)-1; i < (N>>1)+n-1; ++i) {
+		CSUB(x0[i], q0);
+		CSUB(x1[i], q1);
+		MUL_MONT(t, x1[i] + q1 - x0[i], q0invq1, q1, q1inv);
+		CSUB(t, q1);
+		MONT_REDUCE(x0[i], (FFTLONG) x0[i]*rq + (FFTLONG) t*q0q, q, qinv);
+	}
+		
+	/*Complete Bluestein's trick and map to the cyclotomic ring, subtracting
+	  the last coefficient from the others*/
+	MUL_MONT_RED(last, x0[(N>>1)+n-2], Bluestein_mul_inv_433_35507[n-2], q, qinv);
+	t = x0[(N>>1)-1];
+	CSUB(t, q);
+	SUB_MOD(x[0], t, last, q);
+	for (i = 0; i < n-2; ++i) {
+		MUL_MONT_RED(t, x0[(N>>1)+i], Bluestein_mul_inv_433_35507[i], q, qinv);
+		SUB_MOD(x[i+1], t, last, q);
 	}
+	x[n-1] = 0;
+}
+
+/*
+Transform of a sampled secret by Rader's algorithm.  With g a generator
+of (Z/nZ)^* and k = g^b, X_k = x_0 + sum_a x_{g^-a} w^(g^(b-a)): a cyclic
+convolution of length n-1 between the input permuted by Rader_in and a
+fixed sequence of powers of w, scattered back by Rader_out.  With every
+input coefficient in [-8, 8] the convolution stays below p/2 in absolute
+value, so it is computed exactly under the single prime p, with no CRT.
+*/
+void FFT_forward_small_433_35507(RINGELT x[433]) {
+        const FFTSHORT n = 433;
+        const FFTSHORT q = 35507, qinv = 894749573U;
+        const FFTSHORT N = 1024;
 
+	FFTSHORT y[1024];
+	FFTSHORT i, s, t;
+	const FFTSHORT p = 536856577, pinv = 331335679U;
+	const FFTSHORT rq = 5069, pq = 9263; /* 2^32 mod q, -p mod q */
+	
+	/*Permute the input by powers of g^-1, centred: residues above q/2 become negative mod p*/
+	s = x[0];
+	for (i = 0; i < n-1; ++i) {
+		t = x[Rader_in_433_35507[i]];
+		s += t;
+		y[i] = t + ((p - q) & (0 - (((q>>1) - t) >> 31)));
+	}
+	memset((void *) (y+n-1), 0, (N-n+1)*sizeof(FFTSHORT)); /*Pad with 0's*/
+	
+	/*Cyclic convolution; the N^-1 scaling is folded into the filter table*/
+	FFT_forward_1024_536856577(y);
+	POINTWISE_MUL_MONT(y, Rader_roots_fft_433_536856577, N, p, pinv);
+	FFT_backward_1024_536856577(y);
+	
+	/*Add x_0 and reduce mod q, adding -p mod q to the outputs above p/2, which are negative*/
+	for (i = 0; i < n-1; ++i) {
+		t = y[i];
+		CSUB(t, p);
+		t += x[0] + (pq & (0 - (((p>>1) - t) >> 31)));
+		MUL_MONT_RED(x[Rader_out_433_35507[i]], t, rq, q, qinv);
+	}
+	MUL_MONT_RED(x[0], s, rq, q, qinv); /*X_0 is the sum of the coefficients*/
 }
 
 
-void _FFT_forward_433_35507(FFTSHORT *x) {
+void _FFT_forward_433_35507(RINGELT *x) {
   FFT_forward_433_35507(x);
 }
 
-void _FFT_backward_433_35507(FFTSHORT *x) {
+void _FFT_forward_small_433_35507(RINGELT *x) {
+  FFT_forward_small_433_35507(x);
+}
+
+void _FFT_backward_433_35507(RINGELT *x) {
   int i;
   FFT_backward_433_35507(x);
   for (i=0; i<433; ++i)
-    MUL_MOD(x[i], x[i], 35425, 35507);
+    MUL_MONT_RED(x[i], x[i], 10426, 35507, 894749573U); /* 35425 in Montgomery form */
+}
+
+void _FFT_backward_mul_433_35507(RINGELT *x, const RINGELT *a, const RINGELT *b) {
+  FFT_backward_mul_433_35507(x, a, b);
 }
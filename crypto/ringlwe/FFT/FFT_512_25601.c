@@ -8,164 +8,521 @@
  * See LICENSE for complete information.
  */
 
-/* Code to compute a Number Theoretic Transform for multiplication in the ring 
+/* Generated by util/ringlwe_fft.pl: do not edit. */
+
+/* Code to compute a Number Theoretic Transform for multiplication in the ring
 F_q[x] / <x^n+1>.
 	n = 512, q = 25601	*/
 
 #include "FFT_includes.h"
-#include "FFT_constants.h"
+
+#define GS(a, b, w) BFLY_GS(a, b, w, q, q, qinv, MUL_MONT_RED)
+#define GS1(a, b) BFLY_GS_1(a, b, q)
+#define CT(a, b, w) BFLY_CT(a, b, w, q, q, qinv, MUL_MONT_RED)
+#define CT1(a, b) BFLY_CT_1(a, b, q)
+
+/* The twiddle factors w^k in Montgomery form, in the order the stages
+read them, with the twist psi^k by the 2n'th root interleaved into the
+first forward stage and psi^-k * n^-1 into the last backward stage */
+static const RINGELT W_fwd_512_25601[1020] = {
+	15531, 23938, 15531, 12368, 17998, 16979, 4065, 15226,
+	14746, 1897, 3692, 11807, 2592, 20497, 25480, 11450,
+	11272, 14596, 13877, 6967, 6416, 25250, 4958, 24759,
+	20317, 607, 7628, 11188, 1990, 9948, 12048, 17996,
+	21646, 20983, 22052, 3783, 16619, 3464, 7444, 11169,
+	5030, 2311, 92, 10881, 23151, 18817, 10198, 14351,
+	10488, 11586, 5291, 20255, 10527, 22728, 17986, 15153,
+	15021, 4980, 22432, 8890, 2324, 12175, 22535, 4498,
+	22749, 18837, 8926, 5496, 17008, 752, 7685, 9132,
+	19125, 12120, 18944, 8925, 5656, 6005, 4165, 24827,
+	18692, 19011, 4759, 19477, 13992, 14168, 24649, 16770,
+	4905, 13915, 7826, 2289, 11126, 17306, 21549, 4589,
+	21730, 4936, 20027, 1607, 24491, 18815, 19524, 25083,
+	8025, 3991, 1465, 19608, 24050, 17751, 172, 19757,
+	13404, 14374, 2393, 1135, 15846, 25011, 17597, 139,
+	16792, 1385, 13700, 9543, 9180, 5959, 19814, 4284,
+	23183, 12660, 22480, 13453, 5908, 1957, 1690, 9584,
+	2620, 19777, 7886, 18290, 9830, 17334, 17069, 15357,
+	2969, 11379, 25062, 4799, 190, 23126, 5653, 17156,
+	652, 9465, 21660, 904, 4417, 10108, 13033, 3768,
+	11544, 7076, 17119, 267, 12638, 19936, 10365, 560,
+	5890, 4837, 9886, 19816, 3964, 985, 5834, 13797,
+	12360, 6136, 16679, 24362, 25051, 11197, 23569, 8277,
+	6932, 5821, 14103, 22009, 11055, 21942, 22218, 20982,
+	20480, 128, 9616, 18091, 23954, 11762, 5029, 14592,
+	5942, 14294, 17050, 22060, 10084, 25024, 14566, 16653,
+	23625, 10458, 23132, 11025, 4134, 3968, 5145, 21595,
+	145, 2401, 414, 17135, 23308, 10783, 16530, 17704,
+	3014, 7714, 20209, 1823, 15547, 21378, 24045, 8962,
+	25337, 11664, 5889, 4997, 5492, 23229, 21106, 5887,
+	5720, 6436, 12403, 11203, 25191, 15155, 12055, 16876,
+	14730, 22693, 4462, 12256, 17417, 3789, 14480, 1301,
+	22249, 3271, 14261, 22330, 21812, 20309, 1887, 8725,
+	12891, 11121, 19165, 11136, 10310, 20604, 10317, 13345,
+	4223, 15055, 23295, 7897, 24093, 10871, 23200, 1003,
+	18727, 14576, 7295, 10446, 577, 11938, 9995, 11009,
+	12398, 13198, 25473, 4079, 12986, 3592, 5317, 19714,
+	14404, 4188, 21147, 11804, 17315, 20109, 20764, 16614,
+	4264, 25334, 2633, 13937, 15493, 25123, 25278, 8445,
+	18551, 1556, 14222, 22311, 14380, 7311, 15532, 23778,
+	23644, 8955, 856, 21317, 4179, 22587, 24216, 22431,
+	20781, 24466, 15588, 14818, 7850, 22635, 13742, 518,
+	10563, 25187, 20665, 20290, 4927, 23312, 935, 4006,
+	11433, 8970, 24057, 774, 4186, 21467, 13481, 24141,
+	3191, 20105, 16386, 15143, 13426, 12767, 5360, 10448,
+	24732, 11035, 14015, 21782, 22217, 14720, 3338, 3541,
+	22137, 25452, 23840, 7605, 22118, 19659, 24994, 8615,
+	4054, 18634, 12554, 13839, 5104, 9272, 1338, 10375,
+	23101, 15985, 1663, 7367, 24527, 2934, 22212, 4619,
+	4068, 20606, 5569, 20247, 23270, 14546, 6241, 19393,
+	20442, 5669, 15877, 19780, 2520, 9116, 697, 18886,
+	17908, 2032, 17233, 15184, 2655, 4418, 19033, 1239,
+	7225, 15709, 21059, 16457, 19278, 13241, 13394, 24357,
+	19833, 11346, 21607, 24616, 17616, 11790, 8074, 17671,
+	5502, 15715, 1727, 12808, 24401, 1138, 12804, 25041,
+	22467, 855, 16806, 14345, 399, 12963, 21460, 20667,
+	21410, 18603, 19885, 18525, 7574, 746, 8645, 1863,
+	14002, 12568, 10122, 8241, 12692, 13563, 8966, 24697,
+	21004, 17838, 13232, 18599, 23685, 24949, 1286, 11053,
+	23590, 24714, 11985, 2475, 13691, 5593, 1155, 17412,
+	9437, 539, 4195, 23178, 3665, 15083, 576, 10244,
+	3950, 5389, 8194, 13958, 14462, 15771, 1919, 25523,
+	12480, 21351, 10204, 5824, 861, 16709, 14665, 22240,
+	11211, 23911, 15915, 10352, 7745, 6203, 23605, 12148,
+	22736, 2482, 12496, 1996, 2865, 2418, 14390, 1337,
+	16489, 15397, 19398, 19642, 11139, 24413, 10873, 25025,
+	9686, 11901, 16164, 18174, 10674, 13616, 3361, 25462,
+	1916, 23756, 13589, 16635, 24740, 9755, 11599, 20079,
+	13086, 5716, 4250, 11227, 25202, 10517, 6946, 12797,
+	23682, 25429, 20099, 21292, 23814, 3994, 11643, 5993,
+	6323, 20794, 1090, 6568, 21651, 17576, 7693, 15224,
+	21856, 9724, 10518, 6786, 2331, 20269, 8287, 3389,
+	21406, 5574, 2500, 6576, 23082, 13047, 8189, 21012,
+	3483, 7235, 20046, 22263, 11910, 14475, 869, 5558,
+	6755, 9215, 887, 11686, 21415, 19188, 2040, 24666,
+	24315, 952, 15038, 11347, 2151, 10013, 7002, 6124,
+	21422, 13508, 14805, 10069, 4597, 6909, 7050, 3852,
+	23705, 22968, 12038, 19596, 8286, 3911, 14265, 20284,
+	15479, 6657, 13203, 10637, 13347, 18306, 23738, 16469,
+	1508, 9371, 11099, 15284, 18027, 8593, 12710, 18653,
+	10837, 11340, 6998, 6764, 8184, 1559, 6570, 13546,
+	4141, 3066, 19881, 24120, 6551, 19712, 11256, 16711,
+	10054, 10373, 4385, 9071, 3134, 10580, 25456, 4876,
+	13471, 2469, 24463, 2873, 15517, 18243, 25235, 20572,
+	23874, 20310, 5121, 6021, 9478, 11498, 7930, 11250,
+	550, 20768, 5250, 19767, 7985, 2450, 19711, 12260,
+	9677, 8482, 14255, 23290, 21184, 15186, 2335, 19948,
+	12207, 18157, 22632, 15937, 10180, 17715, 9144, 21818,
+	19693, 24748, 8475, 5787, 18376, 3955, 8809, 5162,
+	18913, 23208, 21183, 15653, 1551, 25246, 5598, 6077,
+	8368, 17973, 3871, 10732, 23748, 17775, 6715, 842,
+	11609, 20201, 19167, 21436, 23081, 19185, 6476, 24425,
+	8953, 16675, 19932, 11005, 23277, 19542, 22203, 7615,
+	19360, 121, 15113, 501, 22244, 25509, 5354, 13794,
+	8982, 5912, 1317, 13553, 21533, 10855, 5284, 8342,
+	22133, 11724, 22667, 8622, 23009, 3751, 14264, 21536,
+	15531, 1663, 15531, 14746, 4068, 25480, 25480, 6241,
+	7628, 6416, 2520, 7444, 7628, 17233, 5291, 21646,
+	7225, 22535, 7444, 13394, 18944, 23151, 17616, 24649,
+	5291, 1727, 20027, 15021, 22467, 172, 22535, 21460,
+	13700, 17008, 7574, 1690, 18944, 10122, 25062, 18692,
+	21004, 13033, 24649, 1286, 9886, 11126, 13691, 23569,
+	20027, 4195, 9616, 8025, 3950, 14566, 172, 1919,
+	414, 15846, 861, 24045, 13700, 15915, 12403, 23183,
+	22736, 14480, 1690, 14390, 19165, 9830, 11139, 23200,
+	25062, 16164, 25473, 652, 1916, 20764, 13033, 11599,
+	14222, 12638, 25202, 24216, 9886, 20099, 20665, 12360,
+	6323, 13481, 23569, 7693, 14015, 11055, 2331, 24994,
+	9616, 2500, 1663, 5942, 3483, 6241, 14566, 869,
+	17233, 4134, 21415, 13394, 414, 15038, 1727, 3014,
+	21422, 21460, 24045, 7050, 10122, 5492, 8286, 1286,
+	12403, 13203, 4195, 14730, 1508, 1919, 14480, 12710,
+	15915, 21812, 8184, 14390, 19165, 19881, 16164, 4223,
+	10054, 11599, 23200, 25456, 20099, 577, 15517, 7693,
+	25473, 5121, 2500, 14404, 550, 869, 20764, 19711,
+	15038, 15493, 21184, 7050, 14222, 22632, 13203, 23644,
+	19693, 12710, 24216, 8809, 19881, 7850, 1551, 25456,
+	20665, 3871, 5121, 11433, 11609, 19711, 13481, 6476,
+	22632, 13426, 23277, 8809, 14015, 15113, 3871, 22137,
+	8982, 6476, 24994, 5284, 15113, 5104, 23009, 5284,
+	15531, 1663, 15531, 7628, 17233, 5291, 5291, 1727,
+	20027, 18944, 10122, 25062, 20027, 4195, 9616, 13700,
+	15915, 12403, 25062, 16164, 25473, 9886, 20099, 20665,
+	9616, 2500, 1663, 414, 15038, 1727, 12403, 13203,
+	4195, 19165, 19881, 16164, 25473, 5121, 2500, 14222,
+	22632, 13203, 20665, 3871, 5121, 14015, 15113, 3871,
+	15531, 1663, 15531, 20027, 4195, 9616, 9616, 2500,
+	1663, 25473, 5121, 2500
+};
+
+static const RINGELT W_bwd_512_25601[1020] = {
+	15531, 15531, 23938, 23101, 20480, 128, 23938, 23101,
+	15985, 15985, 21406, 5574, 15531, 15531, 23938, 21730,
+	10488, 11586, 20480, 21730, 4936, 12398, 2969, 11379,
+	23101, 20480, 128, 9437, 5720, 6436, 21406, 12398,
+	13198, 23874, 10563, 25187, 23938, 23101, 15985, 4936,
+	5502, 15715, 128, 9437, 539, 13198, 9686, 11901,
+	15985, 21406, 5574, 539, 15479, 6657, 5574, 23874,
+	20310, 20310, 8368, 17973, 15531, 15531, 23938, 20317,
+	2592, 20497, 10488, 20317, 607, 19125, 16619, 3464,
+	21730, 10488, 11586, 16792, 2324, 12175, 2969, 19125,
+	12120, 5890, 13992, 14168, 20480, 21730, 4936, 145,
+	24050, 17751, 5720, 16792, 1385, 12891, 5908, 1957,
+	12398, 2969, 11379, 18551, 4417, 10108, 10563, 5890,
+	4837, 24732, 25051, 11197, 23101, 20480, 128, 17908,
+	10084, 25024, 5502, 145, 2401, 14002, 15547, 21378,
+	9437, 5720, 6436, 11211, 17417, 3789, 9686, 12891,
+	11121, 23682, 24093, 10871, 21406, 12398, 13198, 24315,
+	17315, 20109, 15479, 18551, 1556, 4141, 4179, 22587,
+	23874, 10563, 25187, 12207, 4186, 21467, 8368, 24732,
+	11035, 19360, 22118, 19659, 23938, 23101, 15985, 607,
+	23270, 14546, 11586, 17908, 2032, 12120, 19278, 13241,
+	4936, 5502, 15715, 1385, 399, 12963, 11379, 14002,
+	12568, 4837, 23685, 24949, 128, 9437, 539, 2401,
+	14462, 15771, 6436, 11211, 23911, 11121, 2865, 2418,
+	13198, 9686, 11901, 1556, 24740, 9755, 25187, 23682,
+	25429, 11035, 21651, 17576, 15985, 21406, 5574, 2032,
+	11910, 14475, 15715, 24315, 952, 12568, 4597, 6909,
+	539, 15479, 6657, 23911, 18027, 8593, 11901, 4141,
+	3066, 25429, 3134, 10580, 5574, 23874, 20310, 952,
+	7985, 2450, 6657, 12207, 18157, 3066, 18376, 3955,
+	20310, 8368, 17973, 18157, 23081, 19185, 17973, 19360,
+	121, 121, 21533, 10855, 15531, 17081, 19254, 4065,
+	21973, 8343, 2592, 21484, 6906, 13877, 5807, 7484,
+	20317, 5129, 1408, 12048, 14648, 13989, 16619, 24074,
+	11690, 92, 11357, 25050, 10488, 6050, 20763, 17986,
+	9307, 4262, 2324, 12629, 23762, 8926, 12433, 18003,
+	19125, 12013, 2005, 4165, 11113, 11611, 13992, 16499,
+	2937, 7826, 9754, 24580, 21730, 2615, 8784, 19524,
+	23890, 7851, 24050, 14620, 9509, 2393, 24014, 2090,
+	16792, 18543, 22765, 19814, 14134, 8552, 5908, 15658,
+	21983, 7886, 22581, 3219, 2969, 11815, 21527, 5653,
+	14346, 16871, 4417, 12455, 21523, 17119, 23032, 24177,
+	5890, 20096, 15235, 5834, 6490, 14360, 25051, 24879,
+	12485, 14103, 13082, 19439, 20480, 17061, 16054, 5029,
+	7301, 16115, 10084, 15645, 19903, 23132, 7924, 13391,
+	145, 16980, 3094, 16530, 14442, 6630, 15547, 16318,
+	25179, 5889, 20338, 2753, 5720, 25295, 2242, 12055,
+	21288, 1147, 17417, 5387, 17087, 14261, 4229, 11014,
+	12891, 20034, 5315, 10317, 17329, 7732, 24093, 4218,
+	9254, 7295, 1724, 19830, 12398, 37, 5920, 5317,
+	22023, 16343, 17315, 6962, 13077, 2633, 7604, 13393,
+	18551, 12637, 25042, 15532, 23422, 9774, 4179, 24589,
+	17287, 15588, 5146, 4128, 10563, 21999, 12503, 935,
+	25197, 12163, 4186, 21078, 18749, 16386, 4937, 21890,
+	24732, 6922, 6677, 3338, 3861, 3336, 22118, 959,
+	25435, 12554, 2055, 21588, 23101, 22690, 20659, 22212,
+	4734, 15011, 23270, 6487, 13880, 15877, 17558, 18771,
+	17908, 8366, 7308, 19033, 3298, 15660, 19278, 18039,
+	18928, 21607, 13054, 14959, 5502, 17001, 6454, 12804,
+	14487, 13830, 399, 23729, 7692, 19885, 14275, 5511,
+	14002, 1331, 8152, 8966, 13824, 10154, 23685, 18651,
+	14444, 11985, 21680, 12665, 9437, 6227, 23482, 576,
+	6029, 17403, 14462, 9262, 22663, 10204, 5218, 15648,
+	11211, 18496, 15245, 23605, 10376, 21696, 2865, 18577,
+	2604, 19398, 3235, 5580, 9686, 17904, 22929, 3361,
+	16422, 16218, 24740, 9589, 23781, 4250, 9576, 21701,
+	23682, 20520, 6272, 11643, 84, 13440, 21651, 180,
+	3199, 10518, 4043, 6855, 21406, 1349, 11032, 8189,
+	6548, 23640, 11910, 21346, 10427, 887, 1854, 15029,
+	24315, 18602, 6604, 7002, 21575, 21466, 4597, 6002,
+	13083, 12038, 20176, 2434, 15479, 13976, 8873, 23738,
+	22634, 11699, 18027, 4614, 21412, 6998, 20859, 9310,
+	4141, 8125, 19950, 11256, 21068, 17149, 3134, 23202,
+	175, 24463, 16803, 375, 23874, 17720, 19090, 7930,
+	19685, 677, 7985, 1952, 5108, 14255, 18812, 14603,
+	12207, 22025, 16663, 9144, 3309, 17420, 18376, 10748,
+	4413, 21183, 4745, 16771, 8368, 24797, 24966, 6715,
+	9249, 20583, 23081, 16162, 219, 19932, 23661, 22413,
+	19360, 10472, 11455, 5354, 22440, 6260, 21533, 541,
+	9757, 22667, 23103, 9936, 23938, 5619, 3005, 15226,
+	15698, 2782, 20497, 723, 13276, 6967, 23493, 21134,
+	607, 10112, 5057, 17996, 14354, 18151, 3464, 23444,
+	13294, 10881, 10007, 13858, 11586, 14129, 7752, 15153,
+	11990, 23926, 12175, 14721, 68, 5496, 5944, 3803,
+	12120, 23709, 4492, 24827, 25204, 13283, 14168, 21093,
+	21149, 2289, 15941, 16061, 4936, 4901, 16130, 25083,
+	21474, 5306, 17751, 24072, 11370, 1135, 15010, 20707,
+	1385, 2906, 4142, 4284, 17199, 12533, 1957, 11254,
+	8570, 18290, 2172, 14707, 11379, 997, 5914, 17156,
+	9451, 1701, 10108, 5623, 3645, 267, 8392, 11468,
+	4837, 7011, 20917, 13797, 7709, 4592, 11197, 12862,
+	9840, 22009, 9275, 24743, 128, 19875, 5476, 14592,
+	13331, 8077, 25024, 10280, 6336, 11025, 14714, 24549,
+	2401, 5929, 1403, 17704, 12705, 10321, 21378, 1624,
+	3830, 4997, 3480, 19179, 6436, 18429, 4525, 16876,
+	17547, 17011, 3789, 15657, 21823, 22330, 11607, 13848,
+	11121, 10243, 416, 13345, 18292, 8206, 10871, 24568,
+	13927, 10446, 5101, 22529, 13198, 14588, 4389, 19714,
+	5659, 9405, 20109, 19441, 12839, 13937, 12401, 12883,
+	1556, 19259, 9320, 23778, 12011, 1685, 22587, 14766,
+	7268, 14818, 13355, 11917, 25187, 17646, 7250, 4006,
+	1240, 19193, 21467, 13629, 4555, 15143, 3604, 13418,
+	11035, 22352, 17781, 3541, 7667, 23473, 19659, 12772,
+	21041, 13839, 20054, 8515, 15985, 6400, 25561, 4619,
+	10057, 21858, 14546, 25208, 13923, 19780, 13787, 4234,
+	2032, 22229, 23702, 1239, 14718, 25189, 13241, 24224,
+	10089, 24616, 18993, 17962, 15715, 11441, 12889, 25041,
+	6230, 23962, 12963, 13350, 11117, 18525, 13978, 9193,
+	12568, 18981, 16042, 24697, 7758, 12432, 24949, 12967,
+	1039, 2475, 9500, 9541, 539, 5728, 20445, 10244,
+	8617, 21867, 15771, 18465, 10285, 5824, 2995, 18382,
+	23911, 21047, 13789, 12148, 23157, 18576, 2418, 9392,
+	17862, 19642, 23783, 16332, 11901, 18048, 20368, 25462,
+	9416, 21702, 9755, 5548, 17246, 11227, 4574, 15012,
+	25429, 17116, 24854, 5993, 22048, 20343, 17576, 25302,
+	3362, 6786, 21303, 3547, 5574, 16391, 11258, 21012,
+	2208, 20467, 14475, 12046, 7285, 11686, 14841, 19268,
+	952, 17173, 8373, 6124, 7541, 3313, 6909, 12502,
+	3442, 19596, 1189, 11033, 6657, 17177, 9013, 16469,
+	235, 11999, 8593, 18790, 11083, 6764, 11006, 20092,
+	3066, 19927, 13796, 16711, 20757, 18591, 10580, 15221,
+	3265, 2873, 14330, 14311, 20310, 16078, 12380, 11250,
+	23481, 19214, 2450, 6429, 4600, 23290, 21091, 20829,
+	18157, 19594, 11718, 21818, 1757, 25110, 3955, 3765,
+	13577, 15653, 22697, 21779, 17973, 4749, 17411, 842,
+	17491, 8051, 19185, 15537, 2623, 11005, 378, 9278,
+	121, 810, 1595, 13794, 5393, 18047, 10855, 18871,
+	24043, 8622, 3865, 3976
+};
 
 /*
-We use Gentleman-Sande, decimation-in-frequency FFT, for the forward FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will invert 
-the fourier transform using decimation-in-time.
+Gentleman-Sande, decimation-in-frequency FFT, premultiplying x by the
+powers of the 2n'th root of unity so that point-wise multiplication gives
+the negacyclic convolution, i.e. multiplication modulo x^n+1.  The output
+is left in bit-reversed order for FFT_twisted_backward_512_25601.
 */
-void FFT_forward_512_25601(FFTSHORT x[512]) {
-        const FFTSHORT n = 512;
-        const FFTSHORT q = 25601;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = 1;
-	for (m = n>>1; m >= 1; m=m>>1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {
-				ADD_MOD(t0, x[i], x[i+m], q);
-				ADD(t1, x[i], q - x[i+m]);
-				MUL_MOD(x[i+m], t1, W_512_25601[index], q);				
-				x[i] = t0;				
-			}
-			SUB_MODn(index, index, step, n);
+void FFT_twisted_forward_512_25601(RINGELT x[512]) {
+	const FFTSHORT q = 25601, qinv = 418407423U;
+	const RINGELT *w = W_fwd_512_25601;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	/* Layer m = 256 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		MUL_MONT_RED(a0, x[j], w[0], q, qinv);
+		MUL_MONT_RED(a1, x[j+256], w[1], q, qinv);
+		GS(a0, a1, w[2]);
+		x[j] = a0; x[j+256] = a1;
+	}
+
+	/* Layers m = 128, 64 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 512; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
 		}
-		step = step << 1;
-	}	 
-}
+	}
 
-/*
-We use Cooley-Tukey, decimation-in-time FFT, for the inverse FFT.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will the forward
-fourier transform is using decimation-in-frequency.
-*/
-void FFT_backward_512_25601(FFTSHORT x[512]) {
-        const FFTSHORT n = 512;
-        const FFTSHORT q = 25601;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = n>>1;
-	for (m = 1; m < n; m=m<<1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {							
-				t0 = x[i];
-				t0 -= (t0 >= q) ? q : 0;
-				MUL_MOD(t1, x[i+m], W_rev_512_25601[index], q);				
-				ADD(x[i], t0, t1);
-				ADD(x[i+m], t0, q - t1);
-				
-			}
-			SUB_MODn(index, index, step, n);
+	/* Layers m = 32, 16 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 512; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 8, 4 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 512; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			GS(a0, a2, w1);
+			GS(a1, a3, w2);
+			GS(a0, a1, w3);
+			GS(a2, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
 		}
-		step = step >> 1;
-	}	
-	for (i = 0; i < n; ++i) {
-		x[i] -= (x[i] >= q) ? q : 0;
 	}
-}
 
+	/* Layers m = 2, 1 */
+	for (i = 0; i < 512; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		GS1(a0, a2);
+		GS(a1, a3, 1663);
+		GS1(a0, a1);
+		GS1(a2, a3);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+}
 
 /*
-We use Gentleman-Sande, decimation-in-frequency FFT, for the forward FFT.
-We premultiply x by the 2n'th roots of unity to affect a Discrete Weighted Fourier Transform, 
-so when we apply pointwise multiplication we obtain the negacyclic convolution, i.e. multiplication 
-modulo x^n+1.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will invert 
-the fourier transform using decimation-in-time.
+Cooley-Tukey, decimation-in-time FFT, inverting FFT_twisted_forward_512_25601:
+postmultiplies x by the inverse powers of the 2n'th root of unity and by
+n^-1.
 */
-void FFT_twisted_forward_512_25601(FFTSHORT x[512]) {
-        const FFTSHORT n = 512;
-        const FFTSHORT q = 25601;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	//Pre multiplication for twisted FFT
-	j = 0;
-	for (i = 0; i < n>>1; ++i) {
-		MUL_MOD(x[j], x[j], W_512_25601[i], q);
-		j++;	
-		MUL_MOD(x[j], x[j], W_sqrt_512_25601[i], q);	
-		j++;
+void FFT_twisted_backward_512_25601(RINGELT x[512]) {
+	const FFTSHORT q = 25601, qinv = 418407423U;
+	const RINGELT *w = W_bwd_512_25601;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 512; i += 4) {
+		a0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 23938);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 512; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
+		}
 	}
 
-	step = 1;
-	for (m = n>>1; m >= 1; m=m>>1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {				
-				ADD_MOD(t0, x[i], x[i+m], q);
-				ADD(t1, x[i], q - x[i+m]);
-				MUL_MOD(x[i+m], t1, W_512_25601[index], q);				
-				x[i] = t0;						
-			}
-			SUB_MODn(index, index, step, n);
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 512; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
 		}
-		step = step << 1;
-	}	 
+	}
+
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 512; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
+
+	/* Layer m = 256 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		a0 = x[j]; a1 = x[j+256];
+		CT(a0, a1, w[0]);
+		MUL_MONT_RED(x[j], a0, w[1], q, qinv);
+		MUL_MONT_RED(x[j+256], a1, w[2], q, qinv);
+	}
 }
 
 /*
-We use Cooley-Tukey, decimation-in-time FFT, for the inverse FFT.
-We postmultiply x by the inverse of the 2n'th roots of unity * n^-1 to affect a Discrete Weighted Fourier Transform, 
-so when we apply pointwise multiplication we obtain the negacyclic convolution, i.e. multiplication 
-modulo x^n+1.
-Note that we will not perform the usual scambling / bit-reversal procedure here because we will the forward
-fourier transform is using decimation-in-frequency.
+x = FFT_twisted_backward_512_25601 of the point-wise product a*b, formed as the
+first stage loads it.  x may alias a or b.
 */
-void FFT_twisted_backward_512_25601(FFTSHORT x[512]) {
-        const FFTSHORT n = 512;
-        const FFTSHORT q = 25601;
-	FFTSHORT index, step;
-	FFTSHORT i,j,m;
-	FFTSHORT t0,t1;
-
-	step = n>>1;
-	for (m = 1; m < n; m=m<<1) {
-		index = 0;
-		for (j = 0 ; j < m; ++j) {
-			for (i = j; i < n; i += (m<<1)) {							
-				t0 = x[i];
-				t0 -= (t0 >= q) ? q : 0;
-				MUL_MOD(t1, x[i+m], W_rev_512_25601[index], q);				
-				ADD(x[i], t0, t1);
-				ADD(x[i+m], t0, q - t1);
-			}
-			SUB_MODn(index, index, step, n);
+void FFT_twisted_backward_mul_512_25601(RINGELT x[512], const RINGELT a[512], const RINGELT b[512]) {
+	const FFTSHORT q = 25601, qinv = 418407423U;
+	const FFTSHORT mu = BARRETT_MU(25601);
+	const RINGELT *w = W_bwd_512_25601;
+	FFTSHORT i, j;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	/* Layers m = 1, 2 */
+	for (i = 0; i < 512; i += 4) {
+		MUL_BARRETT(a0, a[i], b[i], q, mu);
+		MUL_BARRETT(a1, a[i+1], b[i+1], q, mu);
+		MUL_BARRETT(a2, a[i+2], b[i+2], q, mu);
+		MUL_BARRETT(a3, a[i+3], b[i+3], q, mu);
+		CT1(a0, a1);
+		CT1(a2, a3);
+		CT1(a0, a2);
+		CT(a1, a3, 23938);
+		x[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;
+	}
+
+	/* Layers m = 4, 8 */
+	for (j = 0; j < 4; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 512; i += 16) {
+			a0 = x[i]; a1 = x[i+4]; a2 = x[i+8]; a3 = x[i+12];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+4] = a1; x[i+8] = a2; x[i+12] = a3;
 		}
-		step = step >> 1;
 	}
 
-	//Post multiplication for twisted FFT
-	j = 0;
-	for (i = 0; i < n>>1; ++i) {
-		MUL_MOD(x[j], x[j], W_rev_512_25601[i], q);
-		j++;	
-		MUL_MOD(x[j], x[j], W_sqrt_rev_512_25601[i], q);
-		j++;
-	} 
-}
+	/* Layers m = 16, 32 */
+	for (j = 0; j < 16; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 512; i += 64) {
+			a0 = x[i]; a1 = x[i+16]; a2 = x[i+32]; a3 = x[i+48];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+16] = a1; x[i+32] = a2; x[i+48] = a3;
+		}
+	}
+
+	/* Layers m = 64, 128 */
+	for (j = 0; j < 64; ++j, w += 3) {
+		w1 = w[0]; w2 = w[1]; w3 = w[2];
+		for (i = j; i < 512; i += 256) {
+			a0 = x[i]; a1 = x[i+64]; a2 = x[i+128]; a3 = x[i+192];
+			CT(a0, a1, w1);
+			CT(a2, a3, w1);
+			CT(a0, a2, w2);
+			CT(a1, a3, w3);
+			x[i] = a0; x[i+64] = a1; x[i+128] = a2; x[i+192] = a3;
+		}
+	}
 
+	/* Layer m = 256 */
+	for (j = 0; j < 256; ++j, w += 3) {
+		a0 = x[j]; a1 = x[j+256];
+		CT(a0, a1, w[0]);
+		MUL_MONT_RED(x[j], a0, w[1], q, qinv);
+		MUL_MONT_RED(x[j+256], a1, w[2], q, qinv);
+	}
+}
 
-void _FFT_forward_512_25601(FFTSHORT *x) {
+void _FFT_forward_512_25601(RINGELT *x) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_forward_512_25601_avx2(x);
+    return;
+  }
+#endif
   FFT_twisted_forward_512_25601(x);
 }
 
-void _FFT_backward_512_25601(FFTSHORT *x) {
-  int i;
+void _FFT_backward_512_25601(RINGELT *x) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_backward_512_25601_avx2(x);
+    return;
+  }
+#endif
   FFT_twisted_backward_512_25601(x);
-  for (i=0; i<512; ++i)
-    MUL_MOD(x[i], x[i], 25551, 25601);
+}
+
+void _FFT_backward_mul_512_25601(RINGELT *x, const RINGELT *a, const RINGELT *b) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_backward_mul_512_25601_avx2(x, a, b);
+    return;
+  }
+#endif
+  FFT_twisted_backward_mul_512_25601(x, a, b);
 }
@@ -0,0 +1,623 @@
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/* AVX2 versions of the power-of-two transforms, the CRT transforms used
+by Bluestein's and Rader's methods, the point-wise products and the
+small-coefficient sampler.  These are
+selected at run time when OPENSSL_ia32cap_P reports AVX2 (see
+FFT_AVX2_CAPABLE); the portable code in the other FFT_*.c files is used
+otherwise.
+
+Each vector holds eight coefficients in 32-bit lanes.  Products use the
+same Montgomery arithmetic (R = 2^32) as the scalar code, with two
+_mm256_mul_epu32 per half vector, and coefficients are lazily reduced to
+[0, 2q) between layers.  The ring transforms widen the 16-bit input on
+the first pass and narrow it again, fully reduced, on the last one. */
+
+#include "FFT_includes.h"
+
+#ifdef FFT_AVX2
+
+# include <immintrin.h>
+# include "FFT_avx2_constants.h"
+
+# define AVX2 __attribute__((target("avx2")))
+# define AVX2_POPCNT __attribute__((target("avx2,popcnt")))
+
+/* min(x, x - q) as unsigned is the conditional subtraction of q */
+static inline AVX2 __m256i csub_avx2(__m256i x, __m256i q)
+{
+    return _mm256_min_epu32(x, _mm256_sub_epi32(x, q));
+}
+
+/* a*b*2^-32 mod q in [0, 2q), for a*b < q*2^32 */
+static inline AVX2 __m256i mul_mont_avx2(__m256i a, __m256i b, __m256i q,
+                                         __m256i qinv)
+{
+    __m256i te, to, ue, uo;
+
+    te = _mm256_mul_epu32(a, b);
+    to = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    ue = _mm256_mul_epu32(te, qinv);
+    uo = _mm256_mul_epu32(to, qinv);
+    te = _mm256_add_epi64(te, _mm256_mul_epu32(ue, q));
+    to = _mm256_add_epi64(to, _mm256_mul_epu32(uo, q));
+    return _mm256_blend_epi32(_mm256_srli_epi64(te, 32), to, 0xAA);
+}
+
+/* a*b mod q in [0, q), for a, b < q, by Barrett reduction with mu = BARRETT_MU(q) */
+static inline AVX2 __m256i mul_barrett_avx2(__m256i a, __m256i b, __m256i q,
+                                            __m256i mu)
+{
+    __m256i t = _mm256_mullo_epi32(a, b), he, ho;
+
+    he = _mm256_srli_epi64(_mm256_mul_epu32(t, mu), 32);
+    ho = _mm256_mul_epu32(_mm256_srli_epi64(t, 32), mu);
+    he = _mm256_blend_epi32(he, ho, 0xAA);
+    return csub_avx2(_mm256_sub_epi32(t, _mm256_mullo_epi32(he, q)), q);
+}
+
+/* Gentleman-Sande butterfly: (a, b) <- (a + b, (a - b)*w) */
+static inline AVX2 void bfly_fwd_avx2(__m256i *a, __m256i *b, __m256i w,
+                                      __m256i q, __m256i q2, __m256i qinv)
+{
+    __m256i t = _mm256_sub_epi32(_mm256_add_epi32(*a, q2), *b);
+
+    *a = csub_avx2(_mm256_add_epi32(*a, *b), q2);
+    *b = mul_mont_avx2(t, w, q, qinv);
+}
+
+/* Cooley-Tukey butterfly: (a, b) <- (a + b*w, a - b*w) */
+static inline AVX2 void bfly_bwd_avx2(__m256i *a, __m256i *b, __m256i w,
+                                      __m256i q, __m256i q2, __m256i qinv)
+{
+    __m256i t = mul_mont_avx2(*b, w, q, qinv);
+
+    *b = csub_avx2(_mm256_sub_epi32(_mm256_add_epi32(*a, q2), t), q2);
+    *a = csub_avx2(_mm256_add_epi32(*a, t), q2);
+}
+
+static inline AVX2 __m256i load16_avx2(const RINGELT *x)
+{
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)x));
+}
+
+static inline AVX2 void store16_avx2(RINGELT *x, __m256i a, __m256i b)
+{
+    __m256i t = _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8);
+
+    _mm256_storeu_si256((__m256i *)x, t);
+}
+
+/*
+The layers with at least eight butterflies per block: x[i+j] against
+x[i+j+m], with the twiddle for j taken from the layered table.
+*/
+static AVX2 void ntt_layers_fwd_avx2(FFTSHORT *x, int n, const FFTSHORT *w,
+                                     __m256i q, __m256i q2, __m256i qinv)
+{
+    int i, j, m;
+    __m256i a, b;
+
+    for (m = n >> 1; m >= 8; m >>= 1) {
+        for (i = 0; i < n; i += m << 1) {
+            for (j = 0; j < m; j += 8) {
+                a = _mm256_loadu_si256((__m256i *)(x + i + j));
+                b = _mm256_loadu_si256((__m256i *)(x + i + j + m));
+                bfly_fwd_avx2(&a, &b,
+                              _mm256_loadu_si256((__m256i *)(w + j)),
+                              q, q2, qinv);
+                _mm256_storeu_si256((__m256i *)(x + i + j), a);
+                _mm256_storeu_si256((__m256i *)(x + i + j + m), b);
+            }
+        }
+        w += m;
+    }
+}
+
+static AVX2 void ntt_layers_bwd_avx2(FFTSHORT *x, int n, const FFTSHORT *w,
+                                     __m256i q, __m256i q2, __m256i qinv)
+{
+    int i, j, m;
+    __m256i a, b;
+
+    for (m = 8; m < n; m <<= 1) {
+        for (i = 0; i < n; i += m << 1) {
+            for (j = 0; j < m; j += 8) {
+                a = _mm256_loadu_si256((__m256i *)(x + i + j));
+                b = _mm256_loadu_si256((__m256i *)(x + i + j + m));
+                bfly_bwd_avx2(&a, &b,
+                              _mm256_loadu_si256((__m256i *)(w + j)),
+                              q, q2, qinv);
+                _mm256_storeu_si256((__m256i *)(x + i + j), a);
+                _mm256_storeu_si256((__m256i *)(x + i + j + m), b);
+            }
+        }
+        w += m;
+    }
+}
+
+/*
+The last three forward layers (m = 4, 2, 1) stay within groups of eight,
+so they are done in registers on sixteen coefficients at a time.  w
+points at the three eight-lane twiddle patterns.
+*/
+static inline AVX2 void ntt_tail_fwd_avx2(__m256i *v0, __m256i *v1,
+                                          const FFTSHORT *w, __m256i q,
+                                          __m256i q2, __m256i qinv)
+{
+    __m256i lo, hi;
+
+    lo = _mm256_permute2x128_si256(*v0, *v1, 0x20);
+    hi = _mm256_permute2x128_si256(*v0, *v1, 0x31);
+    bfly_fwd_avx2(&lo, &hi, _mm256_loadu_si256((__m256i *)w), q, q2, qinv);
+    *v0 = _mm256_permute2x128_si256(lo, hi, 0x20);
+    *v1 = _mm256_permute2x128_si256(lo, hi, 0x31);
+
+    lo = _mm256_unpacklo_epi64(*v0, *v1);
+    hi = _mm256_unpackhi_epi64(*v0, *v1);
+    bfly_fwd_avx2(&lo, &hi, _mm256_loadu_si256((__m256i *)(w + 8)),
+                  q, q2, qinv);
+    *v0 = _mm256_unpacklo_epi64(lo, hi);
+    *v1 = _mm256_unpackhi_epi64(lo, hi);
+
+    lo = _mm256_blend_epi32(*v0, _mm256_slli_epi64(*v1, 32), 0xAA);
+    hi = _mm256_blend_epi32(_mm256_srli_epi64(*v0, 32), *v1, 0xAA);
+    bfly_fwd_avx2(&lo, &hi, _mm256_loadu_si256((__m256i *)(w + 16)),
+                  q, q2, qinv);
+    *v0 = _mm256_blend_epi32(lo, _mm256_slli_epi64(hi, 32), 0xAA);
+    *v1 = _mm256_blend_epi32(_mm256_srli_epi64(lo, 32), hi, 0xAA);
+}
+
+/* The first three backward layers (m = 1, 2, 4), as above */
+static inline AVX2 void ntt_head_bwd_avx2(__m256i *v0, __m256i *v1,
+                                          const FFTSHORT *w, __m256i q,
+                                          __m256i q2, __m256i qinv)
+{
+    __m256i lo, hi;
+
+    lo = _mm256_blend_epi32(*v0, _mm256_slli_epi64(*v1, 32), 0xAA);
+    hi = _mm256_blend_epi32(_mm256_srli_epi64(*v0, 32), *v1, 0xAA);
+    bfly_bwd_avx2(&lo, &hi, _mm256_loadu_si256((__m256i *)w), q, q2, qinv);
+    *v0 = _mm256_blend_epi32(lo, _mm256_slli_epi64(hi, 32), 0xAA);
+    *v1 = _mm256_blend_epi32(_mm256_srli_epi64(lo, 32), hi, 0xAA);
+
+    lo = _mm256_unpacklo_epi64(*v0, *v1);
+    hi = _mm256_unpackhi_epi64(*v0, *v1);
+    bfly_bwd_avx2(&lo, &hi, _mm256_loadu_si256((__m256i *)(w + 8)),
+                  q, q2, qinv);
+    *v0 = _mm256_unpacklo_epi64(lo, hi);
+    *v1 = _mm256_unpackhi_epi64(lo, hi);
+
+    lo = _mm256_permute2x128_si256(*v0, *v1, 0x20);
+    hi = _mm256_permute2x128_si256(*v0, *v1, 0x31);
+    bfly_bwd_avx2(&lo, &hi, _mm256_loadu_si256((__m256i *)(w + 16)),
+                  q, q2, qinv);
+    *v0 = _mm256_permute2x128_si256(lo, hi, 0x20);
+    *v1 = _mm256_permute2x128_si256(lo, hi, 0x31);
+}
+
+/*
+Twisted forward transform of a ring element: widen and premultiply by
+the twist, run the layers on a 32-bit copy, then narrow fully reduced.
+*/
+static AVX2 void ntt_twisted_fwd_avx2(RINGELT *x, int n, FFTSHORT q_,
+                                      FFTSHORT qinv_, const FFTSHORT *pre,
+                                      const FFTSHORT *w)
+{
+    FFTSHORT y[1024];
+    const __m256i q = _mm256_set1_epi32(q_), q2 = _mm256_set1_epi32(2 * q_);
+    const __m256i qinv = _mm256_set1_epi32(qinv_);
+    __m256i v0, v1;
+    int i;
+
+    for (i = 0; i < n; i += 8) {
+        v0 = mul_mont_avx2(load16_avx2(x + i),
+                           _mm256_loadu_si256((__m256i *)(pre + i)), q, qinv);
+        _mm256_storeu_si256((__m256i *)(y + i), v0);
+    }
+    ntt_layers_fwd_avx2(y, n, w, q, q2, qinv);
+    w += n - 8;
+    for (i = 0; i < n; i += 16) {
+        v0 = _mm256_loadu_si256((__m256i *)(y + i));
+        v1 = _mm256_loadu_si256((__m256i *)(y + i + 8));
+        ntt_tail_fwd_avx2(&v0, &v1, w, q, q2, qinv);
+        store16_avx2(x + i, csub_avx2(v0, q), csub_avx2(v1, q));
+    }
+}
+
+/*
+Twisted backward transform of a, or of the point-wise product a*b when b
+is not NULL: widen (multiplying by b), run the layers on a 32-bit copy,
+then postmultiply by the twist and the scaling and narrow into x.
+*/
+static AVX2 void ntt_twisted_bwd_avx2(RINGELT *x, const RINGELT *a,
+                                      const RINGELT *b, int n, FFTSHORT q_,
+                                      FFTSHORT qinv_, const FFTSHORT *post,
+                                      const FFTSHORT *w)
+{
+    FFTSHORT y[1024];
+    const __m256i q = _mm256_set1_epi32(q_), q2 = _mm256_set1_epi32(2 * q_);
+    const __m256i qinv = _mm256_set1_epi32(qinv_);
+    __m256i mu = _mm256_setzero_si256(), v0, v1;
+    int i;
+
+    if (b != NULL)
+        mu = _mm256_set1_epi32(BARRETT_MU(q_));
+    for (i = 0; i < n; i += 16) {
+        v0 = load16_avx2(a + i);
+        v1 = load16_avx2(a + i + 8);
+        if (b != NULL) {
+            v0 = mul_barrett_avx2(v0, load16_avx2(b + i), q, mu);
+            v1 = mul_barrett_avx2(v1, load16_avx2(b + i + 8), q, mu);
+        }
+        ntt_head_bwd_avx2(&v0, &v1, w, q, q2, qinv);
+        _mm256_storeu_si256((__m256i *)(y + i), v0);
+        _mm256_storeu_si256((__m256i *)(y + i + 8), v1);
+    }
+    ntt_layers_bwd_avx2(y, n, w + 24, q, q2, qinv);
+    for (i = 0; i < n; i += 16) {
+        v0 = mul_mont_avx2(_mm256_loadu_si256((__m256i *)(y + i)),
+                           _mm256_loadu_si256((__m256i *)(post + i)),
+                           q, qinv);
+        v1 = mul_mont_avx2(_mm256_loadu_si256((__m256i *)(y + i + 8)),
+                           _mm256_loadu_si256((__m256i *)(post + i + 8)),
+                           q, qinv);
+        store16_avx2(x + i, csub_avx2(v0, q), csub_avx2(v1, q));
+    }
+}
+
+/* In-place CRT transforms; input and output in [0, 2q) */
+static AVX2 void ntt_fwd_avx2(FFTSHORT *x, int n, FFTSHORT q_,
+                              FFTSHORT qinv_, const FFTSHORT *w)
+{
+    const __m256i q = _mm256_set1_epi32(q_), q2 = _mm256_set1_epi32(2 * q_);
+    const __m256i qinv = _mm256_set1_epi32(qinv_);
+    __m256i v0, v1;
+    int i;
+
+    ntt_layers_fwd_avx2(x, n, w, q, q2, qinv);
+    w += n - 8;
+    for (i = 0; i < n; i += 16) {
+        v0 = _mm256_loadu_si256((__m256i *)(x + i));
+        v1 = _mm256_loadu_si256((__m256i *)(x + i + 8));
+        ntt_tail_fwd_avx2(&v0, &v1, w, q, q2, qinv);
+        _mm256_storeu_si256((__m256i *)(x + i), v0);
+        _mm256_storeu_si256((__m256i *)(x + i + 8), v1);
+    }
+}
+
+static AVX2 void ntt_bwd_avx2(FFTSHORT *x, int n, FFTSHORT q_,
+                              FFTSHORT qinv_, const FFTSHORT *w)
+{
+    const __m256i q = _mm256_set1_epi32(q_), q2 = _mm256_set1_epi32(2 * q_);
+    const __m256i qinv = _mm256_set1_epi32(qinv_);
+    __m256i v0, v1;
+    int i;
+
+    for (i = 0; i < n; i += 16) {
+        v0 = _mm256_loadu_si256((__m256i *)(x + i));
+        v1 = _mm256_loadu_si256((__m256i *)(x + i + 8));
+        ntt_head_bwd_avx2(&v0, &v1, w, q, q2, qinv);
+        _mm256_storeu_si256((__m256i *)(x + i), v0);
+        _mm256_storeu_si256((__m256i *)(x + i + 8), v1);
+    }
+    ntt_layers_bwd_avx2(x, n, w + 24, q, q2, qinv);
+}
+
+void FFT_twisted_forward_1024_40961_avx2(RINGELT x[1024]) {
+  ntt_twisted_fwd_avx2(x, 1024, 40961, 2617286655U, W_pre_avx2_1024_40961,
+                       W_fwd_avx2_1024_40961);
+}
+
+void FFT_twisted_backward_1024_40961_avx2(RINGELT x[1024]) {
+  ntt_twisted_bwd_avx2(x, x, NULL, 1024, 40961, 2617286655U, W_post_avx2_1024_40961,
+                       W_bwd_avx2_1024_40961);
+}
+
+void FFT_twisted_backward_mul_1024_40961_avx2(RINGELT x[1024], const RINGELT a[1024],
+                                      const RINGELT b[1024]) {
+  ntt_twisted_bwd_avx2(x, a, b, 1024, 40961, 2617286655U, W_post_avx2_1024_40961,
+                       W_bwd_avx2_1024_40961);
+}
+
+void FFT_twisted_forward_512_25601_avx2(RINGELT x[512]) {
+  ntt_twisted_fwd_avx2(x, 512, 25601, 418407423U, W_pre_avx2_512_25601,
+                       W_fwd_avx2_512_25601);
+}
+
+void FFT_twisted_backward_512_25601_avx2(RINGELT x[512]) {
+  ntt_twisted_bwd_avx2(x, x, NULL, 512, 25601, 418407423U, W_post_avx2_512_25601,
+                       W_bwd_avx2_512_25601);
+}
+
+void FFT_twisted_backward_mul_512_25601_avx2(RINGELT x[512], const RINGELT a[512],
+                                      const RINGELT b[512]) {
+  ntt_twisted_bwd_avx2(x, a, b, 512, 25601, 418407423U, W_post_avx2_512_25601,
+                       W_bwd_avx2_512_25601);
+}
+
+void FFT_twisted_forward_256_15361_avx2(RINGELT x[256]) {
+  ntt_twisted_fwd_avx2(x, 256, 15361, 2985311231U, W_pre_avx2_256_15361,
+                       W_fwd_avx2_256_15361);
+}
+
+void FFT_twisted_backward_256_15361_avx2(RINGELT x[256]) {
+  ntt_twisted_bwd_avx2(x, x, NULL, 256, 15361, 2985311231U, W_post_avx2_256_15361,
+                       W_bwd_avx2_256_15361);
+}
+
+void FFT_twisted_backward_mul_256_15361_avx2(RINGELT x[256], const RINGELT a[256],
+                                      const RINGELT b[256]) {
+  ntt_twisted_bwd_avx2(x, a, b, 256, 15361, 2985311231U, W_post_avx2_256_15361,
+                       W_bwd_avx2_256_15361);
+}
+
+void FFT_forward_2048_8816641_avx2(FFTSHORT x[2048]) {
+  ntt_fwd_avx2(x, 2048, 8816641, 1481017343U, W_fwd_avx2_2048_8816641);
+}
+
+void FFT_backward_2048_8816641_avx2(FFTSHORT x[2048]) {
+  ntt_bwd_avx2(x, 2048, 8816641, 1481017343U, W_bwd_avx2_2048_8816641);
+}
+
+void FFT_forward_2048_17633281_avx2(FFTSHORT x[2048]) {
+  ntt_fwd_avx2(x, 2048, 17633281, 1611468799U, W_fwd_avx2_2048_17633281);
+}
+
+void FFT_backward_2048_17633281_avx2(FFTSHORT x[2048]) {
+  ntt_bwd_avx2(x, 2048, 17633281, 1611468799U, W_bwd_avx2_2048_17633281);
+}
+
+void FFT_forward_1024_8816641_avx2(FFTSHORT x[1024]) {
+  ntt_fwd_avx2(x, 1024, 8816641, 1481017343U, W_fwd_avx2_1024_8816641);
+}
+
+void FFT_backward_1024_8816641_avx2(FFTSHORT x[1024]) {
+  ntt_bwd_avx2(x, 1024, 8816641, 1481017343U, W_bwd_avx2_1024_8816641);
+}
+
+void FFT_forward_1024_17633281_avx2(FFTSHORT x[1024]) {
+  ntt_fwd_avx2(x, 1024, 17633281, 1611468799U, W_fwd_avx2_1024_17633281);
+}
+
+void FFT_backward_1024_17633281_avx2(FFTSHORT x[1024]) {
+  ntt_bwd_avx2(x, 1024, 17633281, 1611468799U, W_bwd_avx2_1024_17633281);
+}
+
+void FFT_forward_2048_536856577_avx2(FFTSHORT x[2048]) {
+  ntt_fwd_avx2(x, 2048, 536856577, 331335679U, W_fwd_avx2_2048_536856577);
+}
+
+void FFT_backward_2048_536856577_avx2(FFTSHORT x[2048]) {
+  ntt_bwd_avx2(x, 2048, 536856577, 331335679U, W_bwd_avx2_2048_536856577);
+}
+
+void FFT_forward_1024_536856577_avx2(FFTSHORT x[1024]) {
+  ntt_fwd_avx2(x, 1024, 536856577, 331335679U, W_fwd_avx2_1024_536856577);
+}
+
+void FFT_backward_1024_536856577_avx2(FFTSHORT x[1024]) {
+  ntt_bwd_avx2(x, 1024, 536856577, 331335679U, W_bwd_avx2_1024_536856577);
+}
+
+/*
+v = e0*b + e1 for the first m rounded down to a multiple of sixteen
+coefficients, returning how many were done.  q is only known at run time
+here, so the products use Barrett reduction with mu = BARRETT_MU(q).
+*/
+AVX2 int FFT_pointwise_mul_add_avx2(RINGELT *v, const RINGELT *b,
+                                    const RINGELT *e0, const RINGELT *e1,
+                                    int m, FFTSHORT q_, FFTSHORT mu_)
+{
+    const __m256i q = _mm256_set1_epi32(q_), mu = _mm256_set1_epi32(mu_);
+    __m256i t[2];
+    int i, k;
+
+    for (i = 0; i + 16 <= m; i += 16) {
+        for (k = 0; k < 2; ++k) {
+            t[k] = mul_barrett_avx2(load16_avx2(e0 + i + 8 * k),
+                                    load16_avx2(b + i + 8 * k), q, mu);
+            t[k] = csub_avx2(_mm256_add_epi32(t[k],
+                                              load16_avx2(e1 + i + 8 * k)),
+                             q);
+        }
+        store16_avx2(v + i, t[0], t[1]);
+    }
+    return i;
+}
+
+/*
+x = x*w*2^-32 mod q in [0, 2q) for the first n rounded down to a multiple
+of eight coefficients, returning how many were done.
+*/
+AVX2 int FFT_pointwise_mul_mont_avx2(FFTSHORT *x, const FFTSHORT *w, int n,
+                                     FFTSHORT q_, FFTSHORT qinv_)
+{
+    const __m256i q = _mm256_set1_epi32(q_), qinv = _mm256_set1_epi32(qinv_);
+    int i;
+
+    for (i = 0; i + 8 <= n; i += 8)
+        _mm256_storeu_si256((__m256i *)(x + i),
+                            mul_mont_avx2(_mm256_loadu_si256((__m256i *)(x + i)),
+                                          _mm256_loadu_si256((__m256i *)(w + i)),
+                                          q, qinv));
+    return i;
+}
+
+/*
+Rejection-sample coefficients in [-B, B] from the 4-bit chunks of the
+random words r, writing l - B mod q for every chunk l < BB to s[i], s[i+1],
+... with the same chunk order and results as sample_small_word.  Works two
+words at a time while at least 32 coefficients remain to be filled, with
+no data-dependent branches: the accepted lanes are compacted with a byte
+shuffle chosen by the compare mask.  Returns the number of words consumed
+and advances *i.
+*/
+AVX2_POPCNT int FFT_sample_small_avx2(RINGELT *s, int *i_, int n,
+                                      const uint64_t *r, int nwords,
+                                      RINGELT q_, RINGELT B_, RINGELT BB_)
+{
+    const __m128i m4 = _mm_set1_epi8(0x0f);
+    const __m256i q = _mm256_set1_epi16(q_), B = _mm256_set1_epi16(B_);
+    const __m256i BB = _mm256_set1_epi16(BB_), zero = _mm256_setzero_si256();
+    __m128i b, lo, hi, sh;
+    __m256i x[2], acc, c;
+    unsigned int mask;
+    int i = *i_, k, h;
+
+    for (k = 0; k + 2 <= nwords && n - i >= 32; k += 2) {
+        b = _mm_loadu_si128((const __m128i *)(r + k));
+        lo = _mm_and_si128(b, m4);
+        hi = _mm_and_si128(_mm_srli_epi16(b, 4), m4);
+        x[0] = _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(lo, hi));
+        x[1] = _mm256_cvtepu8_epi16(_mm_unpackhi_epi8(lo, hi));
+        for (h = 0; h < 2; ++h) {
+            acc = _mm256_cmpgt_epi16(BB, x[h]);
+            c = _mm256_sub_epi16(x[h], B);
+            c = _mm256_add_epi16(c, _mm256_and_si256(q,
+                                         _mm256_cmpgt_epi16(zero, c)));
+            mask = _mm256_movemask_epi8(_mm256_packs_epi16(acc, zero));
+
+            sh = _mm_loadu_si128((const __m128i *)
+                                 sample_compress_avx2[mask & 0xff]);
+            _mm_storeu_si128((__m128i *)(s + i),
+                             _mm_shuffle_epi8(_mm256_castsi256_si128(c), sh));
+            i += _mm_popcnt_u32(mask & 0xff);
+
+            sh = _mm_loadu_si128((const __m128i *)
+                                 sample_compress_avx2[(mask >> 16) & 0xff]);
+            _mm_storeu_si128((__m128i *)(s + i),
+                             _mm_shuffle_epi8(_mm256_extracti128_si256(c, 1),
+                                              sh));
+            i += _mm_popcnt_u32((mask >> 16) & 0xff);
+        }
+    }
+    *i_ = i;
+    return k;
+}
+
+
+/* The bits 16k..16k+15 of r as 16-bit lane masks */
+static inline AVX2 __m256i bits16_avx2(uint64_t r, int k)
+{
+    const __m256i sel = _mm256_setr_epi16(0x1, 0x2, 0x4, 0x8, 0x10, 0x20,
+                                          0x40, 0x80, 0x100, 0x200, 0x400,
+                                          0x800, 0x1000, 0x2000, 0x4000,
+                                          (short)0x8000);
+    __m256i t = _mm256_set1_epi16((short)(r >> (16 * k)));
+
+    return _mm256_cmpeq_epi16(_mm256_and_si256(t, sel), sel);
+}
+
+/* Four vectors of 16-bit lane masks as the 64 bits of a word */
+static inline AVX2 uint64_t movemask64_avx2(const __m256i m[4])
+{
+    __m256i lo = _mm256_permute4x64_epi64(_mm256_packs_epi16(m[0], m[1]),
+                                          0xD8);
+    __m256i hi = _mm256_permute4x64_epi64(_mm256_packs_epi16(m[2], m[3]),
+                                          0xD8);
+
+    return (uint64_t)(uint32_t)_mm256_movemask_epi8(lo) |
+           ((uint64_t)(uint32_t)_mm256_movemask_epi8(hi) << 32);
+}
+
+/*
+Round and cross-round the first n rounded down to a multiple of 64
+coefficients of v + e2 (or v if e2 is NULL), one output word per 64,
+returning how many were done.  Bit i of rnd nudges coefficient i up from
+0 to q-1 or from hi-1 to hi, as the scalar loop in ringlwe_kex.c does.
+The 16-bit compares are signed, so values and thresholds are compared
+with their top bit flipped.
+*/
+AVX2 int FFT_round_avx2(uint64_t *modular_rnd, uint64_t *cross_rnd,
+                        const RINGELT *v, const RINGELT *e2,
+                        const uint64_t *rnd, int n, RINGELT q_,
+                        RINGELT q_1_4, RINGELT q_2_4, RINGELT q_3_4,
+                        RINGELT hi)
+{
+    const __m256i q = _mm256_set1_epi16((short)q_);
+    const __m256i qm1 = _mm256_set1_epi16((short)(q_ - 1));
+    const __m256i him1 = _mm256_set1_epi16((short)(hi - 1));
+    const __m256i one = _mm256_set1_epi16(1), zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_cmpeq_epi16(zero, zero);
+    const __m256i flip = _mm256_set1_epi16((short)0x8000);
+    const __m256i t14 = _mm256_set1_epi16((short)(q_1_4 ^ 0x8000));
+    const __m256i t24 = _mm256_set1_epi16((short)(q_2_4 ^ 0x8000));
+    const __m256i t34 = _mm256_set1_epi16((short)(q_3_4 ^ 0x8000));
+    __m256i x, e, c, r, gt14, lt34, md[4], cr[4];
+    int i, k;
+
+    for (i = 0; i + 64 <= n; i += 64) {
+        for (k = 0; k < 4; ++k) {
+            x = _mm256_loadu_si256((const __m256i *)(v + i + 16 * k));
+            if (e2 != NULL) {
+                /* x + e - q if x >= q - e, else x + e */
+                e = _mm256_loadu_si256((const __m256i *)(e2 + i + 16 * k));
+                c = _mm256_sub_epi16(q, e);
+                c = _mm256_cmpeq_epi16(_mm256_max_epu16(x, c), x);
+                x = _mm256_sub_epi16(_mm256_add_epi16(x, e),
+                                     _mm256_and_si256(q, c));
+            }
+
+            r = bits16_avx2(rnd[i >> 6], k);
+            c = _mm256_or_si256(
+                    _mm256_and_si256(_mm256_cmpeq_epi16(x, zero), qm1),
+                    _mm256_and_si256(_mm256_cmpeq_epi16(x, him1), one));
+            x = _mm256_xor_si256(_mm256_add_epi16(x, _mm256_and_si256(r, c)),
+                                 flip);
+
+            gt14 = _mm256_cmpgt_epi16(x, t14);
+            lt34 = _mm256_cmpgt_epi16(t34, x);
+            md[k] = _mm256_and_si256(gt14, lt34);
+            cr[k] = _mm256_or_si256(
+                        _mm256_andnot_si256(_mm256_cmpgt_epi16(x, t24), gt14),
+                        _mm256_xor_si256(lt34, ones));
+        }
+        modular_rnd[i >> 6] = movemask64_avx2(md);
+        cross_rnd[i >> 6] = movemask64_avx2(cr);
+    }
+    return i;
+}
+
+/*
+Reconcile the first n rounded down to a multiple of 64 coefficients of
+w against the bits of b, one output word per 64, returning how many
+were done.
+*/
+AVX2 int FFT_rec_avx2(uint64_t *r, const RINGELT *w, const uint64_t *b,
+                      int n, RINGELT r0_l, RINGELT r0_u, RINGELT r1_l,
+                      RINGELT r1_u)
+{
+    const __m256i flip = _mm256_set1_epi16((short)0x8000);
+    const __m256i l0 = _mm256_set1_epi16((short)(r0_l ^ 0x8000));
+    const __m256i u0 = _mm256_set1_epi16((short)(r0_u ^ 0x8000));
+    const __m256i l1 = _mm256_set1_epi16((short)(r1_l ^ 0x8000));
+    const __m256i u1 = _mm256_set1_epi16((short)(r1_u ^ 0x8000));
+    __m256i x, in0, in1, m[4];
+    int i, k;
+
+    for (i = 0; i + 64 <= n; i += 64) {
+        for (k = 0; k < 4; ++k) {
+            x = _mm256_xor_si256(
+                    _mm256_loadu_si256((const __m256i *)(w + i + 16 * k)),
+                    flip);
+            in0 = _mm256_and_si256(_mm256_cmpgt_epi16(x, l0),
+                                   _mm256_cmpgt_epi16(u0, x));
+            in1 = _mm256_and_si256(_mm256_cmpgt_epi16(x, l1),
+                                   _mm256_cmpgt_epi16(u1, x));
+            m[k] = _mm256_blendv_epi8(in0, in1, bits16_avx2(b[i >> 6], k));
+        }
+        r[i >> 6] = movemask64_avx2(m);
+    }
+    return i;
+}
+
+#endif
@@ -0,0 +1,345 @@
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/* Twiddle factors for the AVX2 transforms in FFT_avx2.c, in Montgomery
+   form and widened to 32 bits.  The _fwd and _bwd tables hold the
+   butterfly twiddles one layer after another, in the order the layers
+   are applied, so that each vector of eight is a single load; the three
+   layers with fewer than eight butterflies per block store eight-lane
+   patterns instead.  The _pre and _post tables interleave the 2n'th root
+   twist, and _post also absorbs the final scaling of _FFT_backward. */
+
+/* M = 1024, Q = 40961 */
+
+static const FFTSHORT W_pre_avx2_1024_40961[1024] = {1641, 18498, 24679, 2622, 4096, 22958, 40957, 17178, 40801, 31744, 34561, 40930, 30727, 39721, 250, 32322, 10000, 23089, 31351, 22418, 25210, 36539, 25336, 27925, 30376, 11053, 27171, 32510, 21854, 30609, 13979, 36491, 26667, 26005, 1694, 16175, 26799, 32585, 6974, 33609, 33194, 33608, 17008, 33568, 24944, 31968, 14696, 8929, 14386, 29472, 1986, 31972, 38479, 9089, 23603, 35872, 2017, 1245, 39719, 8839, 32242, 25872, 19889, 10855, 17301, 24590, 36664, 536, 32925, 21440, 6248, 38380, 4154, 19643, 2316, 7461, 10718, 11713, 19110, 17949, 27102, 21623, 19094, 4739, 26462, 25716, 34455, 4615, 26487, 20756, 35455, 11020, 25526, 31190, 37976, 18770, 3483, 13502, 16437, 7587, 2104, 16753, 2238, 14744, 7598, 16306, 17193, 37825, 32344, 38404, 23969, 20603, 16657, 4900, 10904, 32156, 26550, 16449, 37975, 2584, 3443, 21438, 14837, 38300, 20026, 16443, 22781, 2344, 10098, 11838, 35271, 22949, 18166, 16818, 30303, 17344, 24251, 38384, 27937, 19803, 11533, 13861, 10749, 21947, 20350, 17699, 35741, 11623, 36966, 14349, 4044, 506, 38877, 20240, 39523, 31341, 24402, 24810, 33977, 9336, 7367, 4791, 7953, 27796, 31393, 5893, 26890, 30915, 10614, 7770, 14950, 24073, 24546, 20817, 39737, 13460, 32962, 5907, 7728, 31475, 22393, 30170, 35539, 18931, 28886, 19942, 8532, 19421, 13592, 39542, 11187, 25162, 37870, 23416, 40204, 35498, 10681, 27246, 17630, 24854, 8863, 11096, 26832, 34230, 8294, 17487, 4072, 3143, 39997, 2837, 2401, 31558, 14118, 33490, 32227, 28848, 19289, 7012, 34262, 34714, 18767, 36847, 13382, 40245, 2787, 12321, 29558, 1308, 35412, 11359, 23806, 3789, 10137, 28677, 36831, 172, 39605, 6880, 27682, 29434, 1333, 30452, 12359, 30211, 2828, 20571, 31198, 3620, 19090, 21917, 26302, 16499, 28055, 4584, 16253, 19516, 35705, 2381, 35526, 13318, 28366, 227, 28693, 9080, 812, 35512, 32480, 27806, 29409, 6293, 29452, 5954, 31172, 33355, 18050, 23448, 25663, 36778, 2495, 37485, 17878, 24804, 18783, 9096, 14022, 36152, 28387, 12445, 29533, 6268, 34412, 4954, 24767, 34316, 7616, 20927, 17913, 17860, 20183, 18063, 29061, 26183, 15532, 23295, 6865, 30658, 28834, 38451, 6452, 22483, 12314, 39139, 1028, 9042, 159, 33992, 6360, 7967, 8634, 31953, 17672, 8329, 10543, 5472, 12110, 14075, 33829, 30507, 1447, 32411, 16919, 26649, 21384, 974, 36140, 38960, 11965, 1882, 28029, 34319, 15213, 21047, 35066, 22660, 9966, 5258, 29991, 5515, 11771, 15795, 20269, 17385, 32501, 40024, 30249, 3481, 22091, 16357, 23459, 39865, 37218, 38082, 14124, 7723, 32467, 22193, 28889, 27539, 8652, 36574, 18392, 29325, 39343, 26092, 17202, 19655, 32704, 7941, 38369, 30913, 19203, 7690, 30822, 20873, 4050, 15700, 39117, 13585, 8162, 10907, 39753, 26670, 33602, 1814, 33328, 31599, 22368, 35130, 34539, 12526, 29847, 9508, 6011, 11671, 35635, 16269, 32726, 36345, 39249, 20165, 13442, 28341, 5187, 27693, 2675, 1773, 25078, 29959, 20056, 10491, 23981, 10030, 17137, 32551, 30104, 32249, 16291, 20169, 37225, 28501, 14404, 34093, 2706, 12007, 26318, 29709, 28695, 491, 892, 19640, 35680, 7341, 34526, 6913, 29327, 30754, 26172, 1330, 22855, 12239, 13058, 38989, 30788, 3042, 2690, 39758, 25678, 33802, 3095, 367, 917, 14680, 36680, 13746, 33565, 17347, 31848, 38504, 4129, 24603, 1316, 1056, 11679, 1279, 16589, 10199, 8184, 39311, 40633, 15922, 27841, 22465, 7693, 38419, 20993, 21203, 20500, 28900, 780, 9092, 31200, 35992, 19170, 6045, 29502, 36995, 33172, 5204, 16128, 3355, 30705, 11317, 40331, 2109, 15761, 2438, 16025, 15598, 26585, 9505, 39375, 11551, 18482, 11469, 1982, 8189, 38319, 40833, 17203, 35841, 32744, 5, 39969, 200, 1281, 8000, 10279, 33273, 1550, 20168, 21039, 28461, 22340, 32493, 33419, 29929, 26008, 9291, 16295, 2991, 37385, 37718, 20804, 34124, 12940, 13247, 26068, 38348, 18695, 18363, 10502, 38183, 10470, 11763, 9190, 19949, 39912, 19701, 39962, 9781, 1001, 22591, 40040, 2498, 4121, 17998, 996, 23583, 39840, 1217, 37082, 7719, 8684, 22033, 19672, 21139, 8621, 26340, 17152, 29575, 30704, 36092, 40291, 10045, 14161, 33151, 33947, 15288, 6167, 38066, 914, 7083, 36560, 37554, 28765, 27564, 3692, 37574, 24797, 28364, 8816, 28613, 24952, 38573, 15016, 27363, 27186, 29534, 22454, 34452, 37979, 26367, 3603, 30655, 21237, 38331, 30260, 17683, 22531, 10983, 98, 29710, 3920, 531, 33917, 21240, 4967, 30380, 34836, 27331, 766, 28254, 30640, 24213, 37731, 26417, 34644, 32655, 34047, 36409, 10167, 22725, 38031, 7858, 5683, 27593, 22515, 38734, 40419, 33803, 19281, 407, 33942, 16280, 5967, 36785, 33875, 37765, 3287, 36004, 8597, 6525, 16192, 15234, 33265, 35906, 19848, 2605, 15661, 22278, 12025, 30939, 30429, 8730, 29291, 21512, 24732, 299, 6216, 11960, 2874, 27829, 33038, 7213, 10768, 1793, 21110, 30759, 25180, 1530, 24136, 20239, 23337, 31301, 32338, 23210, 23729, 27258, 7057, 25334, 36514, 30296, 26925, 23971, 12014, 16737, 29989, 14104, 11691, 31667, 17069, 37850, 27384, 39404, 30374, 19642, 27091, 7421, 18654, 10113, 8862, 35871, 26792, 1205, 6694, 7239, 21994, 2833, 19579, 31398, 4901, 27090, 32196, 18614, 18049, 7262, 25623, 3753, 895, 27237, 35800, 24494, 39326, 37657, 16522, 31684, 5504, 38530, 15355, 25643, 40746, 1695, 32361, 26839, 24649, 8574, 2896, 15272, 33918, 37426, 5007, 22444, 36436, 37579, 23805, 28564, 10097, 36613, 35231, 30885, 16566, 6570, 7264, 17034, 3833, 25984, 30437, 15335, 29611, 39946, 37532, 361, 26684, 14440, 2374, 4146, 13038, 1996, 29988, 38879, 11651, 39603, 15469, 27602, 4345, 39094, 9956, 7242, 29591, 2953, 36732, 36198, 35645, 14285, 33126, 38907, 14288, 40723, 39027, 31441, 4562, 28810, 18636, 5492, 8142, 14875, 38953, 21546, 1602, 1659, 23119, 25399, 23618, 32896, 2617, 5088, 22758, 39676, 9178, 30522, 39432, 33011, 20762, 9688, 11260, 18871, 40790, 17542, 34121, 5343, 13127, 8915, 33548, 28912, 31168, 9572, 17890, 14231, 19263, 36747, 33222, 36245, 18128, 16165, 28783, 32185, 4412, 17609, 12636, 8023, 13908, 34193, 23827, 16007, 10977, 25865, 29470, 10575, 31892, 13390, 5889, 3107, 30755, 1397, 1370, 14919, 13839, 23306, 21067, 31098, 23460, 15090, 37258, 30146, 15724, 17971, 14545, 22503, 8346, 39939, 6152, 81, 314, 3240, 12560, 6717, 10868, 22914, 25110, 15418, 21336, 2305, 34220, 10278, 17087, 1510, 28104, 19439, 18213, 40262, 32183, 13001, 17529, 28508, 4823, 34373, 29076, 23207, 16132, 27138, 30865, 20534, 5770, 2140, 25995, 3678, 15775, 24237, 16585, 27377, 8024, 30094, 34233, 15891, 17607, 21225, 7943, 29780, 30993, 3331, 10890, 10357, 25990, 4670, 15575, 22956, 8585, 17098, 15712, 28544, 14065, 35813, 30107, 39846, 16411, 37322, 1064, 18284, 1599, 35023, 22999, 8246, 18818, 2152, 15422, 4158, 2465, 2476, 16678, 17118, 11744, 29344, 19189, 26852, 30262, 9094, 22611, 36072, 3298, 9245, 9037, 1151, 33792, 5079, 40928, 39316, 39641, 16122, 29122, 30465, 17972, 30731, 22543, 410, 578, 16400, 23120, 624, 23658, 24960, 4217, 15336, 4836, 39986, 29596, 1961, 36932, 37479, 2684, 24564, 25438, 40457, 34456, 20801, 26527, 12820, 37055, 21268, 7604, 31500, 17433, 31170, 983, 17970};
+
+static const FFTSHORT W_post_avx2_1024_40961[1024] = {16282, 22463, 39320, 17970, 983, 31170, 17433, 31500, 7604, 21268, 37055, 12820, 26527, 20801, 34456, 40457, 25438, 24564, 2684, 37479, 36932, 1961, 29596, 39986, 4836, 15336, 4217, 24960, 23658, 624, 23120, 16400, 578, 410, 22543, 30731, 17972, 30465, 29122, 16122, 39641, 39316, 40928, 5079, 33792, 1151, 9037, 9245, 3298, 36072, 22611, 9094, 30262, 26852, 19189, 29344, 11744, 17118, 16678, 2476, 2465, 4158, 15422, 2152, 18818, 8246, 22999, 35023, 1599, 18284, 1064, 37322, 16411, 39846, 30107, 35813, 14065, 28544, 15712, 17098, 8585, 22956, 15575, 4670, 25990, 10357, 10890, 3331, 30993, 29780, 7943, 21225, 17607, 15891, 34233, 30094, 8024, 27377, 16585, 24237, 15775, 3678, 25995, 2140, 5770, 20534, 30865, 27138, 16132, 23207, 29076, 34373, 4823, 28508, 17529, 13001, 32183, 40262, 18213, 19439, 28104, 1510, 17087, 10278, 34220, 2305, 21336, 15418, 25110, 22914, 10868, 6717, 12560, 3240, 314, 81, 6152, 39939, 8346, 22503, 14545, 17971, 15724, 30146, 37258, 15090, 23460, 31098, 21067, 23306, 13839, 14919, 1370, 1397, 30755, 3107, 5889, 13390, 31892, 10575, 29470, 25865, 10977, 16007, 23827, 34193, 13908, 8023, 12636, 17609, 4412, 32185, 28783, 16165, 18128, 36245, 33222, 36747, 19263, 14231, 17890, 9572, 31168, 28912, 33548, 8915, 13127, 5343, 34121, 17542, 40790, 18871, 11260, 9688, 20762, 33011, 39432, 30522, 9178, 39676, 22758, 5088, 2617, 32896, 23618, 25399, 23119, 1659, 1602, 21546, 38953, 14875, 8142, 5492, 18636, 28810, 4562, 31441, 39027, 40723, 14288, 38907, 33126, 14285, 35645, 36198, 36732, 2953, 29591, 7242, 9956, 39094, 4345, 27602, 15469, 39603, 11651, 38879, 29988, 1996, 13038, 4146, 2374, 14440, 26684, 361, 37532, 39946, 29611, 15335, 30437, 25984, 3833, 17034, 7264, 6570, 16566, 30885, 35231, 36613, 10097, 28564, 23805, 37579, 36436, 22444, 5007, 37426, 33918, 15272, 2896, 8574, 24649, 26839, 32361, 1695, 40746, 25643, 15355, 38530, 5504, 31684, 16522, 37657, 39326, 24494, 35800, 27237, 895, 3753, 25623, 7262, 18049, 18614, 32196, 27090, 4901, 31398, 19579, 2833, 21994, 7239, 6694, 1205, 26792, 35871, 8862, 10113, 18654, 7421, 27091, 19642, 30374, 39404, 27384, 37850, 17069, 31667, 11691, 14104, 29989, 16737, 12014, 23971, 26925, 30296, 36514, 25334, 7057, 27258, 23729, 23210, 32338, 31301, 23337, 20239, 24136, 1530, 25180, 30759, 21110, 1793, 10768, 7213, 33038, 27829, 2874, 11960, 6216, 299, 24732, 21512, 29291, 8730, 30429, 30939, 12025, 22278, 15661, 2605, 19848, 35906, 33265, 15234, 16192, 6525, 8597, 36004, 3287, 37765, 33875, 36785, 5967, 16280, 33942, 407, 19281, 33803, 40419, 38734, 22515, 27593, 5683, 7858, 38031, 22725, 10167, 36409, 34047, 32655, 34644, 26417, 37731, 24213, 30640, 28254, 766, 27331, 34836, 30380, 4967, 21240, 33917, 531, 3920, 29710, 98, 10983, 22531, 17683, 30260, 38331, 21237, 30655, 3603, 26367, 37979, 34452, 22454, 29534, 27186, 27363, 15016, 38573, 24952, 28613, 8816, 28364, 24797, 37574, 3692, 27564, 28765, 37554, 36560, 7083, 914, 38066, 6167, 15288, 33947, 33151, 14161, 10045, 40291, 36092, 30704, 29575, 17152, 26340, 8621, 21139, 19672, 22033, 8684, 7719, 37082, 1217, 39840, 23583, 996, 17998, 4121, 2498, 40040, 22591, 1001, 9781, 39962, 19701, 39912, 19949, 9190, 11763, 10470, 38183, 10502, 18363, 18695, 38348, 26068, 13247, 12940, 34124, 20804, 37718, 37385, 2991, 16295, 9291, 26008, 29929, 33419, 32493, 22340, 28461, 21039, 20168, 1550, 33273, 10279, 8000, 1281, 200, 39969, 5, 32744, 35841, 17203, 40833, 38319, 8189, 1982, 11469, 18482, 11551, 39375, 9505, 26585, 15598, 16025, 2438, 15761, 2109, 40331, 11317, 30705, 3355, 16128, 5204, 33172, 36995, 29502, 6045, 19170, 35992, 31200, 9092, 780, 28900, 20500, 21203, 20993, 38419, 7693, 22465, 27841, 15922, 40633, 39311, 8184, 10199, 16589, 1279, 11679, 1056, 1316, 24603, 4129, 38504, 31848, 17347, 33565, 13746, 36680, 14680, 917, 367, 3095, 33802, 25678, 39758, 2690, 3042, 30788, 38989, 13058, 12239, 22855, 1330, 26172, 30754, 29327, 6913, 34526, 7341, 35680, 19640, 892, 491, 28695, 29709, 26318, 12007, 2706, 34093, 14404, 28501, 37225, 20169, 16291, 32249, 30104, 32551, 17137, 10030, 23981, 10491, 20056, 29959, 25078, 1773, 2675, 27693, 5187, 28341, 13442, 20165, 39249, 36345, 32726, 16269, 35635, 11671, 6011, 9508, 29847, 12526, 34539, 35130, 22368, 31599, 33328, 1814, 33602, 26670, 39753, 10907, 8162, 13585, 39117, 15700, 4050, 20873, 30822, 7690, 19203, 30913, 38369, 7941, 32704, 19655, 17202, 26092, 39343, 29325, 18392, 36574, 8652, 27539, 28889, 22193, 32467, 7723, 14124, 38082, 37218, 39865, 23459, 16357, 22091, 3481, 30249, 40024, 32501, 17385, 20269, 15795, 11771, 5515, 29991, 5258, 9966, 22660, 35066, 21047, 15213, 34319, 28029, 1882, 11965, 38960, 36140, 974, 21384, 26649, 16919, 32411, 1447, 30507, 33829, 14075, 12110, 5472, 10543, 8329, 17672, 31953, 8634, 7967, 6360, 33992, 159, 9042, 1028, 39139, 12314, 22483, 6452, 38451, 28834, 30658, 6865, 23295, 15532, 26183, 29061, 18063, 20183, 17860, 17913, 20927, 7616, 34316, 24767, 4954, 34412, 6268, 29533, 12445, 28387, 36152, 14022, 9096, 18783, 24804, 17878, 37485, 2495, 36778, 25663, 23448, 18050, 33355, 31172, 5954, 29452, 6293, 29409, 27806, 32480, 35512, 812, 9080, 28693, 227, 28366, 13318, 35526, 2381, 35705, 19516, 16253, 4584, 28055, 16499, 26302, 21917, 19090, 3620, 31198, 20571, 2828, 30211, 12359, 30452, 1333, 29434, 27682, 6880, 39605, 172, 36831, 28677, 10137, 3789, 23806, 11359, 35412, 1308, 29558, 12321, 2787, 40245, 13382, 36847, 18767, 34714, 34262, 7012, 19289, 28848, 32227, 33490, 14118, 31558, 2401, 2837, 39997, 3143, 4072, 17487, 8294, 34230, 26832, 11096, 8863, 24854, 17630, 27246, 10681, 35498, 40204, 23416, 37870, 25162, 11187, 39542, 13592, 19421, 8532, 19942, 28886, 18931, 35539, 30170, 22393, 31475, 7728, 5907, 32962, 13460, 39737, 20817, 24546, 24073, 14950, 7770, 10614, 30915, 26890, 5893, 31393, 27796, 7953, 4791, 7367, 9336, 33977, 24810, 24402, 31341, 39523, 20240, 38877, 506, 4044, 14349, 36966, 11623, 35741, 17699, 20350, 21947, 10749, 13861, 11533, 19803, 27937, 38384, 24251, 17344, 30303, 16818, 18166, 22949, 35271, 11838, 10098, 2344, 22781, 16443, 20026, 38300, 14837, 21438, 3443, 2584, 37975, 16449, 26550, 32156, 10904, 4900, 16657, 20603, 23969, 38404, 32344, 37825, 17193, 16306, 7598, 14744, 2238, 16753, 2104, 7587, 16437, 13502, 3483, 18770, 37976, 31190, 25526, 11020, 35455, 20756, 26487, 4615, 34455, 25716, 26462, 4739, 19094, 21623, 27102, 17949, 19110, 11713, 10718, 7461, 2316, 19643, 4154, 38380, 6248, 21440, 32925, 536, 36664, 24590, 17301, 10855, 19889, 25872, 32242, 8839, 39719, 1245, 2017, 35872, 23603, 9089, 38479, 31972, 1986, 29472, 14386, 8929, 14696, 31968, 24944, 33568, 17008, 33608, 33194, 33609, 6974, 32585, 26799, 16175, 1694, 26005, 26667, 36491, 13979, 30609, 21854, 32510, 27171, 11053, 30376, 27925, 25336, 36539, 25210, 22418, 31351, 23089, 10000, 32322, 250, 39721, 30727, 40930, 34561, 31744, 40801, 17178, 40957, 22958, 4096, 2622};
+
+static const FFTSHORT W_fwd_avx2_1024_40961[1040] = {1641, 39978, 23528, 33357, 3906, 14434, 6505, 15523, 38277, 4029, 11365, 36125, 36744, 17303, 17841, 40383, 18418, 22989, 11839, 1320, 33, 7169, 31924, 37663, 18350, 10699, 21772, 29217, 24283, 38496, 25539, 22143, 17962, 39362, 39897, 24550, 10854, 26896, 25249, 32376, 25386, 14971, 30071, 9968, 33018, 23354, 6728, 32937, 24376, 25186, 14966, 35191, 10096, 24829, 11885, 36138, 23432, 8778, 22748, 12857, 23874, 6741, 19625, 15851, 30093, 28401, 40647, 34809, 32615, 26416, 25237, 3703, 17501, 19894, 27122, 39591, 10206, 35072, 9069, 11491, 29984, 17134, 27053, 28325, 36549, 12178, 22833, 7739, 21698, 23071, 9793, 7413, 27834, 6840, 171, 29701, 20199, 1529, 31783, 18203, 38344, 17343, 17842, 39359, 2008, 32819, 22325, 36399, 1934, 26673, 7835, 5316, 4229, 11370, 31005, 36616, 25492, 29310, 10973, 27923, 38587, 14277, 3429, 11350, 10524, 37128, 33697, 24395, 5730, 30864, 17156, 4525, 35954, 7043, 38065, 16312, 8600, 215, 25606, 35457, 24439, 1635, 5161, 40066, 15338, 22912, 8765, 36060, 21382, 18967, 34267, 14169, 32099, 22307, 13870, 10587, 13577, 23892, 29270, 10972, 28947, 14036, 4447, 33904, 17232, 8623, 17624, 16825, 15781, 19851, 30193, 7923, 38087, 34745, 16229, 11670, 10532, 28936, 25300, 21113, 7696, 24769, 32364, 37674, 7086, 34994, 7019, 21680, 542, 18446, 35278, 2930, 30794, 6914, 6317, 3230, 10321, 40195, 6125, 35994, 7044, 37041, 40863, 18430, 10701, 19724, 37358, 2982, 18507, 13775, 25945, 16009, 32145, 16164, 37269, 12196, 4401, 40047, 34794, 7014, 26800, 670, 10257, 23809, 32340, 21289, 32277, 3879, 1121, 39965, 36840, 921, 39960, 999, 1049, 31771, 30491, 30459, 22266, 14893, 28021, 20157, 3576, 24666, 14953, 7542, 18621, 19922, 39411, 30682, 39680, 992, 8217, 23758, 2642, 38979, 22479, 1586, 14376, 24936, 25200, 630, 10256, 24833, 7789, 11459, 21791, 9761, 40181, 20461, 19968, 33268, 13120, 328, 32777, 24372, 29282, 39645, 36832, 9113, 7396, 4281, 40044, 37866, 15283, 38271, 10173, 27903, 18106, 14789, 11634, 6435, 5281, 40069, 12266, 14643, 38255, 26557, 3736, 24670, 10857, 23824, 16980, 20905, 15883, 38286, 35774, 27519, 1712, 8235, 5326, 34950, 11114, 6422, 18593, 7633, 7359, 1208, 32799, 1844, 36911, 10139, 21758, 2592, 8257, 23759, 1618, 22569, 32309, 12072, 8494, 26837, 3743, 17502, 18870, 10712, 8460, 20692, 29190, 10970, 30995, 5895, 25748, 12932, 28996, 4821, 19577, 24042, 39514, 7132, 28851, 30418, 23289, 32327, 34601, 40802, 39933, 28647, 34509, 12127, 34096, 25429, 11900, 20778, 23048, 33345, 16194, 6549, 11428, 12574, 26939, 22178, 23083, 38466, 15298, 22911, 9789, 11509, 11552, 8481, 40149, 12268, 12595, 5435, 5256, 24708, 12906, 14659, 21871, 9763, 38133, 28602, 39628, 13279, 1356, 4130, 30824, 17155, 5549, 11403, 38174, 27579, 22194, 6699, 21672, 8734, 26843, 38560, 964, 36889, 32667, 14129, 32098, 23331, 30280, 757, 3091, 29774, 27369, 32429, 12075, 5422, 18568, 33233, 7999, 1224, 16415, 26011, 30347, 14071, 9568, 33008, 33594, 6984, 16559, 1438, 2084, 36917, 3995, 5220, 20611, 30212, 29428, 13024, 16710, 10658, 22795, 5690, 30863, 18180, 20935, 26124, 37518, 2986, 14411, 30057, 24304, 16992, 8617, 23768, 33363, 38723, 38857, 24524, 37478, 2985, 15435, 5506, 14474, 6506, 14499, 21867, 13859, 21851, 30243, 38645, 36807, 34713, 8036, 4297, 23660, 21072, 8719, 1242, 38944, 17358, 2482, 38975, 26575, 26265, 16017, 23953, 7767, 33987, 14162, 39267, 14294, 26982, 19107, 13790, 10585, 15625, 15751, 9610, 30961, 40711, 10234, 6400, 160, 4, 36865, 16282, 1641, 23528, 3906, 6505, 38277, 11365, 36744, 17841, 18418, 11839, 33, 31924, 18350, 21772, 24283, 25539, 17962, 39897, 10854, 25249, 25386, 30071, 33018, 6728, 24376, 14966, 10096, 11885, 23432, 22748, 23874, 19625, 30093, 40647, 32615, 25237, 17501, 27122, 10206, 9069, 29984, 27053, 36549, 22833, 21698, 9793, 27834, 171, 20199, 31783, 38344, 17842, 2008, 22325, 1934, 7835, 4229, 31005, 25492, 10973, 38587, 3429, 10524, 33697, 5730, 17156, 35954, 38065, 8600, 25606, 24439, 5161, 15338, 8765, 21382, 34267, 32099, 13870, 13577, 29270, 28947, 4447, 17232, 17624, 15781, 30193, 38087, 16229, 10532, 25300, 7696, 32364, 7086, 7019, 542, 35278, 30794, 6317, 10321, 6125, 7044, 40863, 10701, 37358, 18507, 25945, 32145, 37269, 4401, 34794, 26800, 10257, 32340, 32277, 1121, 36840, 39960, 1049, 30491, 22266, 28021, 3576, 14953, 18621, 39411, 39680, 8217, 2642, 22479, 14376, 25200, 10256, 7789, 21791, 40181, 19968, 13120, 32777, 29282, 36832, 7396, 40044, 15283, 10173, 18106, 11634, 5281, 12266, 38255, 3736, 10857, 16980, 15883, 35774, 1712, 5326, 11114, 18593, 7359, 32799, 36911, 21758, 8257, 1618, 32309, 8494, 3743, 18870, 8460, 29190, 30995, 25748, 28996, 19577, 39514, 28851, 23289, 34601, 39933, 34509, 34096, 11900, 23048, 16194, 11428, 26939, 23083, 15298, 9789, 11552, 40149, 12595, 5256, 12906, 21871, 38133, 39628, 1356, 30824, 5549, 38174, 22194, 21672, 26843, 964, 32667, 32098, 30280, 3091, 27369, 12075, 18568, 7999, 16415, 30347, 9568, 33594, 16559, 2084, 3995, 20611, 29428, 16710, 22795, 30863, 20935, 37518, 14411, 24304, 8617, 33363, 38857, 37478, 15435, 14474, 14499, 13859, 30243, 36807, 8036, 23660, 8719, 38944, 2482, 26575, 16017, 7767, 14162, 14294, 19107, 10585, 15751, 30961, 10234, 160, 36865, 1641, 3906, 38277, 36744, 18418, 33, 18350, 24283, 17962, 10854, 25386, 33018, 24376, 10096, 23432, 23874, 30093, 32615, 17501, 10206, 29984, 36549, 21698, 27834, 20199, 38344, 2008, 1934, 4229, 25492, 38587, 10524, 5730, 35954, 8600, 24439, 15338, 21382, 32099, 13577, 28947, 17232, 15781, 38087, 10532, 7696, 7086, 542, 30794, 10321, 7044, 10701, 18507, 32145, 4401, 26800, 32340, 1121, 39960, 30491, 28021, 14953, 39411, 8217, 22479, 25200, 7789, 40181, 13120, 29282, 7396, 15283, 18106, 5281, 38255, 10857, 15883, 1712, 11114, 7359, 36911, 8257, 32309, 3743, 8460, 30995, 28996, 39514, 23289, 39933, 34096, 23048, 11428, 23083, 9789, 40149, 5256, 21871, 39628, 30824, 38174, 21672, 964, 32098, 3091, 12075, 7999, 30347, 33594, 2084, 20611, 16710, 30863, 37518, 24304, 33363, 37478, 14474, 13859, 36807, 23660, 38944, 26575, 7767, 14294, 10585, 30961, 160, 1641, 38277, 18418, 18350, 17962, 25386, 24376, 23432, 30093, 17501, 29984, 21698, 20199, 2008, 4229, 38587, 5730, 8600, 15338, 32099, 28947, 15781, 10532, 7086, 30794, 7044, 18507, 4401, 32340, 39960, 28021, 39411, 22479, 7789, 13120, 7396, 18106, 38255, 15883, 11114, 36911, 32309, 8460, 28996, 23289, 34096, 11428, 9789, 5256, 39628, 38174, 964, 3091, 7999, 33594, 20611, 30863, 24304, 37478, 13859, 23660, 26575, 14294, 30961, 1641, 18418, 17962, 24376, 30093, 29984, 20199, 4229, 5730, 15338, 28947, 10532, 30794, 18507, 32340, 28021, 22479, 13120, 18106, 15883, 36911, 8460, 23289, 11428, 5256, 38174, 3091, 33594, 30863, 37478, 23660, 14294, 1641, 17962, 30093, 20199, 5730, 28947, 30794, 32340, 22479, 18106, 36911, 23289, 5256, 3091, 30863, 23660, 1641, 30093, 5730, 30794, 22479, 36911, 5256, 30863, 1641, 5730, 22479, 5256, 1641, 5730, 22479, 5256, 1641, 22479, 1641, 22479, 1641, 22479, 1641, 22479, 1641, 1641, 1641, 1641, 1641, 1641, 1641, 1641};
+
+static const FFTSHORT W_bwd_avx2_1024_40961[1040] = {1641, 1641, 1641, 1641, 1641, 1641, 1641, 1641, 1641, 18482, 1641, 18482, 1641, 18482, 1641, 18482, 1641, 35705, 18482, 35231, 1641, 35705, 18482, 35231, 1641, 10098, 35705, 4050, 18482, 10167, 35231, 10868, 1641, 17301, 10098, 37870, 35705, 17672, 4050, 22855, 18482, 8621, 10167, 12014, 35231, 20762, 10868, 22999, 1641, 26667, 17301, 3483, 10098, 7367, 37870, 2787, 35705, 29533, 17672, 32501, 4050, 25078, 22855, 27841, 18482, 12940, 8621, 22454, 10167, 30429, 12014, 25623, 35231, 36732, 20762, 10977, 10868, 16585, 22999, 22543, 1641, 10000, 26667, 14386, 17301, 27102, 3483, 16657, 10098, 20350, 7367, 32962, 37870, 39997, 2787, 1333, 35705, 31172, 29533, 6865, 17672, 11965, 32501, 8652, 4050, 29847, 25078, 2706, 22855, 33565, 27841, 33172, 18482, 1550, 12940, 1001, 8621, 36560, 22454, 33917, 10167, 33875, 30429, 25180, 12014, 8862, 25623, 32361, 35231, 2374, 36732, 38953, 20762, 19263, 10977, 23460, 10868, 17529, 16585, 15575, 22999, 22611, 22543, 2684, 1641, 40801, 10000, 30376, 26667, 33194, 14386, 2017, 17301, 4154, 27102, 26487, 3483, 7598, 16657, 3443, 10098, 24251, 20350, 38877, 7367, 10614, 32962, 28886, 37870, 8863, 39997, 19289, 2787, 10137, 1333, 19090, 35705, 812, 31172, 17878, 29533, 17913, 6865, 1028, 17672, 1447, 11965, 9966, 32501, 37218, 8652, 32704, 4050, 33602, 29847, 39249, 25078, 30104, 2706, 35680, 22855, 25678, 33565, 11679, 27841, 780, 33172, 15761, 18482, 32744, 1550, 26008, 12940, 10470, 1001, 39840, 8621, 14161, 36560, 8816, 22454, 30260, 33917, 30640, 10167, 40419, 33875, 33265, 30429, 2874, 25180, 23729, 12014, 27384, 8862, 19579, 25623, 16522, 32361, 5007, 35231, 30437, 2374, 15469, 36732, 39027, 38953, 2617, 20762, 13127, 19263, 4412, 10977, 30755, 23460, 8346, 10868, 17087, 17529, 30865, 16585, 7943, 15575, 30107, 22999, 16678, 22611, 40928, 22543, 4217, 2684, 37055, 1641, 4096, 40801, 30727, 10000, 25210, 30376, 21854, 26667, 26799, 33194, 24944, 14386, 38479, 2017, 32242, 17301, 32925, 4154, 10718, 27102, 26462, 26487, 25526, 3483, 2104, 7598, 32344, 16657, 26550, 3443, 20026, 10098, 18166, 24251, 11533, 20350, 36966, 38877, 24402, 7367, 31393, 10614, 24546, 32962, 22393, 28886, 13592, 37870, 10681, 8863, 8294, 39997, 14118, 19289, 18767, 2787, 35412, 10137, 39605, 1333, 2828, 19090, 28055, 35705, 28366, 812, 29409, 31172, 25663, 17878, 14022, 29533, 24767, 17913, 29061, 6865, 6452, 1028, 6360, 17672, 12110, 1447, 21384, 11965, 15213, 9966, 11771, 32501, 22091, 37218, 32467, 8652, 39343, 32704, 19203, 4050, 8162, 33602, 22368, 29847, 35635, 39249, 5187, 25078, 23981, 30104, 37225, 2706, 28695, 35680, 29327, 22855, 30788, 25678, 917, 33565, 4129, 11679, 8184, 27841, 20993, 780, 19170, 33172, 30705, 15761, 26585, 18482, 38319, 32744, 1281, 1550, 22340, 26008, 37385, 12940, 18695, 10470, 39912, 1001, 4121, 39840, 8684, 8621, 30704, 14161, 6167, 36560, 3692, 8816, 15016, 22454, 3603, 30260, 98, 33917, 34836, 30640, 34644, 10167, 5683, 40419, 33942, 33875, 8597, 33265, 15661, 30429, 24732, 2874, 10768, 25180, 23337, 23729, 36514, 12014, 11691, 27384, 27091, 8862, 6694, 19579, 32196, 25623, 35800, 16522, 15355, 32361, 2896, 5007, 23805, 35231, 7264, 30437, 37532, 2374, 29988, 15469, 9956, 36732, 33126, 39027, 18636, 38953, 23119, 2617, 9178, 20762, 40790, 13127, 31168, 19263, 18128, 4412, 13908, 10977, 31892, 30755, 13839, 23460, 15724, 8346, 314, 10868, 21336, 17087, 18213, 17529, 29076, 30865, 25995, 16585, 34233, 7943, 10890, 15575, 15712, 30107, 1064, 22999, 15422, 16678, 19189, 22611, 9037, 40928, 29122, 22543, 23120, 4217, 29596, 2684, 34456, 37055, 17433, 1641, 24679, 4096, 40957, 40801, 34561, 30727, 250, 10000, 31351, 25210, 25336, 30376, 27171, 21854, 13979, 26667, 1694, 26799, 6974, 33194, 17008, 24944, 14696, 14386, 1986, 38479, 23603, 2017, 39719, 32242, 19889, 17301, 36664, 32925, 6248, 4154, 2316, 10718, 19110, 27102, 19094, 26462, 34455, 26487, 35455, 25526, 37976, 3483, 16437, 2104, 2238, 7598, 17193, 32344, 23969, 16657, 10904, 26550, 37975, 3443, 14837, 20026, 22781, 10098, 35271, 18166, 30303, 24251, 27937, 11533, 10749, 20350, 35741, 36966, 4044, 38877, 39523, 24402, 33977, 7367, 7953, 31393, 26890, 10614, 14950, 24546, 39737, 32962, 7728, 22393, 35539, 28886, 8532, 13592, 11187, 37870, 40204, 10681, 17630, 8863, 26832, 8294, 4072, 39997, 2401, 14118, 32227, 19289, 34262, 18767, 13382, 2787, 29558, 35412, 23806, 10137, 36831, 39605, 27682, 1333, 12359, 2828, 31198, 19090, 26302, 28055, 16253, 35705, 35526, 28366, 28693, 812, 32480, 29409, 29452, 31172, 18050, 25663, 2495, 17878, 18783, 14022, 28387, 29533, 34412, 24767, 7616, 17913, 20183, 29061, 15532, 6865, 28834, 6452, 12314, 1028, 159, 6360, 8634, 17672, 10543, 12110, 33829, 1447, 16919, 21384, 36140, 11965, 28029, 15213, 35066, 9966, 29991, 11771, 20269, 32501, 30249, 22091, 23459, 37218, 14124, 32467, 28889, 8652, 18392, 39343, 17202, 32704, 38369, 19203, 30822, 4050, 39117, 8162, 39753, 33602, 33328, 22368, 34539, 29847, 6011, 35635, 32726, 39249, 13442, 5187, 2675, 25078, 20056, 23981, 17137, 30104, 16291, 37225, 14404, 2706, 26318, 28695, 892, 35680, 34526, 29327, 26172, 22855, 13058, 30788, 2690, 25678, 3095, 917, 36680, 33565, 31848, 4129, 1316, 11679, 16589, 8184, 40633, 27841, 7693, 20993, 20500, 780, 31200, 19170, 29502, 33172, 16128, 30705, 40331, 15761, 16025, 26585, 39375, 18482, 1982, 38319, 17203, 32744, 39969, 1281, 10279, 1550, 21039, 22340, 33419, 26008, 16295, 37385, 20804, 12940, 26068, 18695, 10502, 10470, 9190, 39912, 39962, 1001, 40040, 4121, 996, 39840, 37082, 8684, 19672, 8621, 17152, 30704, 40291, 14161, 33947, 6167, 914, 36560, 28765, 3692, 24797, 8816, 24952, 15016, 27186, 22454, 37979, 3603, 21237, 30260, 22531, 98, 3920, 33917, 4967, 34836, 766, 30640, 37731, 34644, 34047, 10167, 38031, 5683, 22515, 40419, 19281, 33942, 5967, 33875, 3287, 8597, 16192, 33265, 19848, 15661, 12025, 30429, 29291, 24732, 6216, 2874, 33038, 10768, 21110, 25180, 24136, 23337, 32338, 23729, 7057, 36514, 26925, 12014, 29989, 11691, 17069, 27384, 30374, 27091, 18654, 8862, 26792, 6694, 21994, 19579, 4901, 32196, 18049, 25623, 895, 35800, 39326, 16522, 5504, 15355, 40746, 32361, 24649, 2896, 33918, 5007, 36436, 23805, 10097, 35231, 16566, 7264, 3833, 30437, 29611, 37532, 26684, 2374, 13038, 29988, 11651, 15469, 4345, 9956, 29591, 36732, 35645, 33126, 14288, 39027, 4562, 18636, 8142, 38953, 1602, 23119, 23618, 2617, 22758, 9178, 39432, 20762, 11260, 40790, 34121, 13127, 33548, 31168, 17890, 19263, 33222, 18128, 28783, 4412, 12636, 13908, 23827, 10977, 29470, 31892, 5889, 30755, 1370, 13839, 21067, 23460, 37258, 15724, 14545, 8346, 6152, 314, 12560, 10868, 25110, 21336, 34220, 17087, 28104, 18213, 32183, 17529, 4823, 29076, 16132, 30865, 5770, 25995, 15775, 16585, 8024, 34233, 17607, 7943, 30993, 10890, 25990, 15575, 8585, 15712, 14065, 30107, 16411, 1064, 1599, 22999, 18818, 15422, 2465, 16678, 11744, 19189, 30262, 22611, 3298, 9037, 33792, 40928, 39641, 29122, 17972, 22543, 578, 23120, 23658, 4217, 4836, 29596, 36932, 2684, 25438, 34456, 26527, 37055, 7604, 17433, 983};
+
+/* M = 512, Q = 25601 */
+
+static const FFTSHORT W_pre_avx2_512_25601[512] = {15531, 12368, 4065, 1897, 2592, 11450, 13877, 25250, 20317, 11188, 12048, 20983, 16619, 11169, 92, 18817, 10488, 20255, 17986, 4980, 2324, 4498, 8926, 752, 19125, 8925, 4165, 19011, 13992, 16770, 7826, 17306, 21730, 1607, 19524, 3991, 24050, 19757, 2393, 25011, 16792, 9543, 19814, 12660, 5908, 9584, 7886, 17334, 2969, 4799, 5653, 9465, 4417, 3768, 17119, 19936, 5890, 19816, 5834, 6136, 25051, 8277, 14103, 21942, 20480, 18091, 5029, 14294, 10084, 16653, 23132, 3968, 145, 17135, 16530, 7714, 15547, 8962, 5889, 23229, 5720, 11203, 12055, 22693, 17417, 1301, 14261, 20309, 12891, 11136, 10317, 15055, 24093, 1003, 7295, 11938, 12398, 4079, 5317, 4188, 17315, 16614, 2633, 25123, 18551, 22311, 15532, 8955, 4179, 22431, 15588, 22635, 10563, 20290, 935, 8970, 4186, 24141, 16386, 12767, 24732, 21782, 3338, 25452, 22118, 8615, 12554, 9272, 23101, 7367, 22212, 20606, 23270, 19393, 15877, 9116, 17908, 15184, 19033, 15709, 19278, 24357, 21607, 11790, 5502, 12808, 12804, 855, 399, 20667, 19885, 746, 14002, 8241, 8966, 17838, 23685, 11053, 11985, 5593, 9437, 23178, 576, 5389, 14462, 25523, 10204, 16709, 11211, 10352, 23605, 2482, 2865, 1337, 19398, 24413, 9686, 18174, 3361, 23756, 24740, 20079, 4250, 10517, 23682, 21292, 11643, 20794, 21651, 15224, 10518, 20269, 21406, 6576, 8189, 7235, 11910, 5558, 887, 19188, 24315, 11347, 7002, 13508, 4597, 3852, 12038, 3911, 15479, 10637, 23738, 9371, 18027, 18653, 6998, 1559, 4141, 24120, 11256, 10373, 3134, 4876, 24463, 18243, 23874, 6021, 7930, 20768, 7985, 12260, 14255, 15186, 12207, 15937, 9144, 24748, 18376, 5162, 21183, 25246, 8368, 10732, 6715, 20201, 23081, 24425, 19932, 19542, 19360, 501, 5354, 5912, 21533, 8342, 22667, 3751, 23938, 17998, 15226, 3692, 20497, 11272, 6967, 4958, 607, 1990, 17996, 22052, 3464, 5030, 10881, 10198, 11586, 10527, 15153, 22432, 12175, 22749, 5496, 7685, 12120, 5656, 24827, 4759, 14168, 4905, 2289, 21549, 4936, 24491, 25083, 1465, 17751, 13404, 1135, 17597, 1385, 9180, 4284, 22480, 1957, 2620, 18290, 17069, 11379, 190, 17156, 21660, 10108, 11544, 267, 10365, 4837, 3964, 13797, 16679, 11197, 6932, 22009, 22218, 128, 23954, 14592, 17050, 25024, 23625, 11025, 5145, 2401, 23308, 17704, 20209, 21378, 25337, 4997, 21106, 6436, 25191, 16876, 4462, 3789, 22249, 22330, 1887, 11121, 10310, 13345, 23295, 10871, 18727, 10446, 9995, 13198, 12986, 19714, 21147, 20109, 4264, 13937, 25278, 1556, 14380, 23778, 856, 22587, 20781, 14818, 13742, 25187, 4927, 4006, 24057, 21467, 3191, 15143, 5360, 11035, 22217, 3541, 23840, 19659, 4054, 13839, 1338, 15985, 24527, 4619, 5569, 14546, 20442, 19780, 697, 2032, 2655, 1239, 21059, 13241, 19833, 24616, 8074, 15715, 24401, 25041, 16806, 12963, 21410, 18525, 8645, 12568, 12692, 24697, 13232, 24949, 23590, 2475, 1155, 539, 3665, 10244, 8194, 15771, 12480, 5824, 14665, 23911, 7745, 12148, 12496, 2418, 16489, 19642, 10873, 11901, 10674, 25462, 13589, 9755, 13086, 11227, 6946, 25429, 23814, 5993, 1090, 17576, 21856, 6786, 8287, 5574, 23082, 21012, 20046, 14475, 6755, 11686, 2040, 952, 2151, 6124, 14805, 6909, 23705, 19596, 14265, 6657, 13347, 16469, 11099, 8593, 10837, 6764, 6570, 3066, 6551, 16711, 4385, 10580, 13471, 2873, 25235, 20310, 9478, 11250, 5250, 2450, 9677, 23290, 2335, 18157, 10180, 21818, 8475, 3955, 18913, 15653, 5598, 17973, 23748, 842, 19167, 19185, 8953, 11005, 22203, 121, 22244, 13794, 1317, 10855, 22133, 8622, 14264};
+
+static const FFTSHORT W_post_avx2_512_25601[512] = {17081, 21973, 21484, 5807, 5129, 14648, 24074, 11357, 6050, 9307, 12629, 12433, 12013, 11113, 16499, 9754, 2615, 23890, 14620, 24014, 18543, 14134, 15658, 22581, 11815, 14346, 12455, 23032, 20096, 6490, 24879, 13082, 17061, 7301, 15645, 7924, 16980, 14442, 16318, 20338, 25295, 21288, 5387, 4229, 20034, 17329, 4218, 1724, 37, 22023, 6962, 7604, 12637, 23422, 24589, 5146, 21999, 25197, 21078, 4937, 6922, 3861, 959, 2055, 22690, 4734, 6487, 17558, 8366, 3298, 18039, 13054, 17001, 14487, 23729, 14275, 1331, 13824, 18651, 21680, 6227, 6029, 9262, 5218, 18496, 10376, 18577, 3235, 17904, 16422, 9589, 9576, 20520, 84, 180, 4043, 1349, 6548, 21346, 1854, 18602, 21575, 6002, 20176, 13976, 22634, 4614, 20859, 8125, 21068, 23202, 16803, 17720, 19685, 1952, 18812, 22025, 3309, 10748, 4745, 24797, 9249, 16162, 23661, 10472, 22440, 541, 23103, 5619, 15698, 723, 23493, 10112, 14354, 23444, 10007, 14129, 11990, 14721, 5944, 23709, 25204, 21093, 15941, 4901, 21474, 24072, 15010, 2906, 17199, 11254, 2172, 997, 9451, 5623, 8392, 7011, 7709, 12862, 9275, 19875, 13331, 10280, 14714, 5929, 12705, 1624, 3480, 18429, 17547, 15657, 11607, 10243, 18292, 24568, 5101, 14588, 5659, 19441, 12401, 19259, 12011, 14766, 13355, 17646, 1240, 13629, 3604, 22352, 7667, 12772, 20054, 6400, 10057, 25208, 13787, 22229, 14718, 24224, 18993, 11441, 6230, 13350, 13978, 18981, 7758, 12967, 9500, 5728, 8617, 18465, 2995, 21047, 23157, 9392, 23783, 18048, 9416, 5548, 4574, 17116, 22048, 25302, 21303, 16391, 2208, 12046, 14841, 17173, 7541, 12502, 1189, 17177, 235, 18790, 11006, 19927, 20757, 15221, 14330, 16078, 23481, 6429, 21091, 19594, 1757, 3765, 22697, 4749, 17491, 15537, 378, 810, 5393, 18871, 3865, 19254, 8343, 6906, 7484, 1408, 13989, 11690, 25050, 20763, 4262, 23762, 18003, 2005, 11611, 2937, 24580, 8784, 7851, 9509, 2090, 22765, 8552, 21983, 3219, 21527, 16871, 21523, 24177, 15235, 14360, 12485, 19439, 16054, 16115, 19903, 13391, 3094, 6630, 25179, 2753, 2242, 1147, 17087, 11014, 5315, 7732, 9254, 19830, 5920, 16343, 13077, 13393, 25042, 9774, 17287, 4128, 12503, 12163, 18749, 21890, 6677, 3336, 25435, 21588, 20659, 15011, 13880, 18771, 7308, 15660, 18928, 14959, 6454, 13830, 7692, 5511, 8152, 10154, 14444, 12665, 23482, 17403, 22663, 15648, 15245, 21696, 2604, 5580, 22929, 16218, 23781, 21701, 6272, 13440, 3199, 6855, 11032, 23640, 10427, 15029, 6604, 21466, 13083, 2434, 8873, 11699, 21412, 9310, 19950, 17149, 175, 375, 19090, 677, 5108, 14603, 16663, 17420, 4413, 16771, 24966, 20583, 219, 22413, 11455, 6260, 9757, 9936, 3005, 2782, 13276, 21134, 5057, 18151, 13294, 13858, 7752, 23926, 68, 3803, 4492, 13283, 21149, 16061, 16130, 5306, 11370, 20707, 4142, 12533, 8570, 14707, 5914, 1701, 3645, 11468, 20917, 4592, 9840, 24743, 5476, 8077, 6336, 24549, 1403, 10321, 3830, 19179, 4525, 17011, 21823, 13848, 416, 8206, 13927, 22529, 4389, 9405, 12839, 12883, 9320, 1685, 7268, 11917, 7250, 19193, 4555, 13418, 17781, 23473, 21041, 8515, 25561, 21858, 13923, 4234, 23702, 25189, 10089, 17962, 12889, 23962, 11117, 9193, 16042, 12432, 1039, 9541, 20445, 21867, 10285, 18382, 13789, 18576, 17862, 16332, 20368, 21702, 17246, 15012, 24854, 20343, 3362, 3547, 11258, 20467, 7285, 19268, 8373, 3313, 3442, 11033, 9013, 11999, 11083, 20092, 13796, 18591, 3265, 14311, 12380, 19214, 4600, 20829, 11718, 25110, 13577, 21779, 17411, 8051, 2623, 9278, 1595, 18047, 24043, 3976};
+
+static const FFTSHORT W_fwd_avx2_512_25601[528] = {15531, 16979, 14746, 11807, 25480, 14596, 6416, 24759, 7628, 9948, 21646, 3783, 7444, 2311, 23151, 14351, 5291, 22728, 15021, 8890, 22535, 18837, 17008, 9132, 18944, 6005, 18692, 19477, 24649, 13915, 11126, 4589, 20027, 18815, 8025, 19608, 172, 14374, 15846, 139, 13700, 5959, 23183, 13453, 1690, 19777, 9830, 15357, 25062, 23126, 652, 904, 13033, 7076, 12638, 560, 9886, 985, 12360, 24362, 23569, 5821, 11055, 20982, 9616, 11762, 5942, 22060, 14566, 10458, 4134, 21595, 414, 10783, 3014, 1823, 24045, 11664, 5492, 5887, 12403, 15155, 14730, 12256, 14480, 3271, 21812, 8725, 19165, 20604, 4223, 7897, 23200, 14576, 577, 11009, 25473, 3592, 14404, 11804, 20764, 25334, 15493, 8445, 14222, 7311, 23644, 21317, 24216, 24466, 7850, 518, 20665, 23312, 11433, 774, 13481, 20105, 13426, 10448, 14015, 14720, 22137, 7605, 24994, 18634, 5104, 10375, 1663, 2934, 4068, 20247, 6241, 5669, 2520, 18886, 17233, 4418, 7225, 16457, 13394, 11346, 17616, 17671, 1727, 1138, 22467, 14345, 21460, 18603, 7574, 1863, 10122, 13563, 21004, 18599, 1286, 24714, 13691, 17412, 4195, 15083, 3950, 13958, 1919, 21351, 861, 22240, 15915, 6203, 22736, 1996, 14390, 15397, 11139, 25025, 16164, 13616, 1916, 16635, 11599, 5716, 25202, 12797, 20099, 3994, 6323, 6568, 7693, 9724, 2331, 3389, 2500, 13047, 3483, 22263, 869, 9215, 21415, 24666, 15038, 10013, 21422, 10069, 7050, 22968, 8286, 20284, 13203, 18306, 1508, 15284, 12710, 11340, 8184, 13546, 19881, 19712, 10054, 9071, 25456, 2469, 15517, 20572, 5121, 11498, 550, 19767, 19711, 8482, 21184, 19948, 22632, 17715, 19693, 5787, 8809, 23208, 1551, 6077, 3871, 17775, 11609, 21436, 6476, 16675, 23277, 7615, 15113, 25509, 8982, 13553, 5284, 11724, 23009, 21536, 15531, 14746, 25480, 6416, 7628, 21646, 7444, 23151, 5291, 15021, 22535, 17008, 18944, 18692, 24649, 11126, 20027, 8025, 172, 15846, 13700, 23183, 1690, 9830, 25062, 652, 13033, 12638, 9886, 12360, 23569, 11055, 9616, 5942, 14566, 4134, 414, 3014, 24045, 5492, 12403, 14730, 14480, 21812, 19165, 4223, 23200, 577, 25473, 14404, 20764, 15493, 14222, 23644, 24216, 7850, 20665, 11433, 13481, 13426, 14015, 22137, 24994, 5104, 1663, 4068, 6241, 2520, 17233, 7225, 13394, 17616, 1727, 22467, 21460, 7574, 10122, 21004, 1286, 13691, 4195, 3950, 1919, 861, 15915, 22736, 14390, 11139, 16164, 1916, 11599, 25202, 20099, 6323, 7693, 2331, 2500, 3483, 869, 21415, 15038, 21422, 7050, 8286, 13203, 1508, 12710, 8184, 19881, 10054, 25456, 15517, 5121, 550, 19711, 21184, 22632, 19693, 8809, 1551, 3871, 11609, 6476, 23277, 15113, 8982, 5284, 23009, 15531, 25480, 7628, 7444, 5291, 22535, 18944, 24649, 20027, 172, 13700, 1690, 25062, 13033, 9886, 23569, 9616, 14566, 414, 24045, 12403, 14480, 19165, 23200, 25473, 20764, 14222, 24216, 20665, 13481, 14015, 24994, 1663, 6241, 17233, 13394, 1727, 21460, 10122, 1286, 4195, 1919, 15915, 14390, 16164, 11599, 20099, 7693, 2500, 869, 15038, 7050, 13203, 12710, 19881, 25456, 5121, 19711, 22632, 8809, 3871, 6476, 15113, 5284, 15531, 7628, 5291, 18944, 20027, 13700, 25062, 9886, 9616, 414, 12403, 19165, 25473, 14222, 20665, 14015, 1663, 17233, 1727, 10122, 4195, 15915, 16164, 20099, 2500, 15038, 13203, 19881, 5121, 22632, 3871, 15113, 15531, 5291, 20027, 25062, 9616, 12403, 25473, 20665, 1663, 1727, 4195, 16164, 2500, 13203, 5121, 3871, 15531, 20027, 9616, 25473, 1663, 4195, 2500, 5121, 15531, 9616, 1663, 2500, 15531, 9616, 1663, 2500, 15531, 1663, 15531, 1663, 15531, 1663, 15531, 1663, 15531, 15531, 15531, 15531, 15531, 15531, 15531, 15531};
+
+static const FFTSHORT W_bwd_avx2_512_25601[528] = {15531, 15531, 15531, 15531, 15531, 15531, 15531, 15531, 15531, 23938, 15531, 23938, 15531, 23938, 15531, 23938, 15531, 23101, 23938, 15985, 15531, 23101, 23938, 15985, 15531, 20480, 23101, 21406, 23938, 128, 15985, 5574, 15531, 21730, 20480, 12398, 23101, 9437, 21406, 23874, 23938, 4936, 128, 13198, 15985, 539, 5574, 20310, 15531, 10488, 21730, 2969, 20480, 5720, 12398, 10563, 23101, 5502, 9437, 9686, 21406, 15479, 23874, 8368, 23938, 11586, 4936, 11379, 128, 6436, 13198, 25187, 15985, 15715, 539, 11901, 5574, 6657, 20310, 17973, 15531, 20317, 10488, 19125, 21730, 16792, 2969, 5890, 20480, 145, 5720, 12891, 12398, 18551, 10563, 24732, 23101, 17908, 5502, 14002, 9437, 11211, 9686, 23682, 21406, 24315, 15479, 4141, 23874, 12207, 8368, 19360, 23938, 607, 11586, 12120, 4936, 1385, 11379, 4837, 128, 2401, 6436, 11121, 13198, 1556, 25187, 11035, 15985, 2032, 15715, 12568, 539, 23911, 11901, 25429, 5574, 952, 6657, 3066, 20310, 18157, 17973, 121, 15531, 2592, 20317, 16619, 10488, 2324, 19125, 13992, 21730, 24050, 16792, 5908, 2969, 4417, 5890, 25051, 20480, 10084, 145, 15547, 5720, 17417, 12891, 24093, 12398, 17315, 18551, 4179, 10563, 4186, 24732, 22118, 23101, 23270, 17908, 19278, 5502, 399, 14002, 23685, 9437, 14462, 11211, 2865, 9686, 24740, 23682, 21651, 21406, 11910, 24315, 4597, 15479, 18027, 4141, 3134, 23874, 7985, 12207, 18376, 8368, 23081, 19360, 21533, 23938, 20497, 607, 3464, 11586, 12175, 12120, 14168, 4936, 17751, 1385, 1957, 11379, 10108, 4837, 11197, 128, 25024, 2401, 21378, 6436, 3789, 11121, 10871, 13198, 20109, 1556, 22587, 25187, 21467, 11035, 19659, 15985, 14546, 2032, 13241, 15715, 12963, 12568, 24949, 539, 15771, 23911, 2418, 11901, 9755, 25429, 17576, 5574, 14475, 952, 6909, 6657, 8593, 3066, 10580, 20310, 2450, 18157, 3955, 17973, 19185, 121, 10855, 15531, 4065, 2592, 13877, 20317, 12048, 16619, 92, 10488, 17986, 2324, 8926, 19125, 4165, 13992, 7826, 21730, 19524, 24050, 2393, 16792, 19814, 5908, 7886, 2969, 5653, 4417, 17119, 5890, 5834, 25051, 14103, 20480, 5029, 10084, 23132, 145, 16530, 15547, 5889, 5720, 12055, 17417, 14261, 12891, 10317, 24093, 7295, 12398, 5317, 17315, 2633, 18551, 15532, 4179, 15588, 10563, 935, 4186, 16386, 24732, 3338, 22118, 12554, 23101, 22212, 23270, 15877, 17908, 19033, 19278, 21607, 5502, 12804, 399, 19885, 14002, 8966, 23685, 11985, 9437, 576, 14462, 10204, 11211, 23605, 2865, 19398, 9686, 3361, 24740, 4250, 23682, 11643, 21651, 10518, 21406, 8189, 11910, 887, 24315, 7002, 4597, 12038, 15479, 23738, 18027, 6998, 4141, 11256, 3134, 24463, 23874, 7930, 7985, 14255, 12207, 9144, 18376, 21183, 8368, 6715, 23081, 19932, 19360, 5354, 21533, 22667, 23938, 15226, 20497, 6967, 607, 17996, 3464, 10881, 11586, 15153, 12175, 5496, 12120, 24827, 14168, 2289, 4936, 25083, 17751, 1135, 1385, 4284, 1957, 18290, 11379, 17156, 10108, 267, 4837, 13797, 11197, 22009, 128, 14592, 25024, 11025, 2401, 17704, 21378, 4997, 6436, 16876, 3789, 22330, 11121, 13345, 10871, 10446, 13198, 19714, 20109, 13937, 1556, 23778, 22587, 14818, 25187, 4006, 21467, 15143, 11035, 3541, 19659, 13839, 15985, 4619, 14546, 19780, 2032, 1239, 13241, 24616, 15715, 25041, 12963, 18525, 12568, 24697, 24949, 2475, 539, 10244, 15771, 5824, 23911, 12148, 2418, 19642, 11901, 25462, 9755, 11227, 25429, 5993, 17576, 6786, 5574, 21012, 14475, 11686, 952, 6124, 6909, 19596, 6657, 16469, 8593, 6764, 3066, 16711, 10580, 2873, 20310, 11250, 2450, 23290, 18157, 21818, 3955, 15653, 17973, 842, 19185, 11005, 121, 13794, 10855, 8622};
+
+/* M = 256, Q = 15361 */
+
+static const FFTSHORT W_pre_avx2_256_15361[256] = {974, 5297, 9740, 6887, 5234, 7426, 6257, 12816, 1126, 5272, 11260, 6637, 5073, 4926, 4647, 3177, 387, 1048, 3870, 10480, 7978, 12634, 2975, 3452, 14389, 3798, 5641, 7258, 10327, 11136, 11104, 3833, 3513, 7608, 4408, 14636, 13358, 8111, 10692, 4305, 14754, 12328, 9291, 392, 744, 3920, 7440, 8478, 12956, 7975, 6672, 2945, 5276, 14089, 6677, 2641, 5326, 11049, 7177, 2963, 10326, 14269, 11094, 4441, 3413, 13688, 3408, 13992, 3358, 1671, 2858, 1349, 13219, 13490, 9302, 12012, 854, 12593, 8540, 3042, 8595, 15059, 9145, 12341, 14645, 522, 8201, 5220, 5205, 6117, 5967, 15087, 13587, 12621, 12982, 3322, 6932, 2498, 7876, 9619, 1955, 4024, 4189, 9518, 11168, 3014, 4153, 14779, 10808, 9541, 553, 3244, 5530, 1718, 9217, 1819, 4, 2829, 40, 12929, 400, 6402, 4000, 2576, 9278, 10399, 614, 11824, 6140, 10713, 15317, 14964, 14921, 11391, 10961, 6383, 2083, 2386, 5469, 8499, 8607, 8185, 9265, 5045, 484, 4367, 4840, 12948, 2317, 6592, 7809, 4476, 1285, 14038, 12850, 2131, 5612, 5949, 10037, 13407, 8204, 11182, 5235, 4293, 6267, 12208, 1226, 14553, 12260, 7281, 15073, 11366, 12481, 6133, 1922, 15247, 3859, 14221, 7868, 3961, 1875, 8888, 3389, 12075, 3168, 13223, 958, 9342, 9580, 1254, 3634, 12540, 5618, 2512, 10097, 9759, 8804, 5424, 11235, 8157, 4823, 4765, 2147, 1567, 6109, 309, 15007, 3090, 11821, 178, 10683, 1780, 14664, 2439, 8391, 9029, 7105, 13485, 9606, 11962, 3894, 12093, 8218, 13403, 5375, 11142, 7667, 3893, 15226, 8208, 14011, 5275, 1861, 6667, 3249, 5226, 1768, 6177, 2319, 326, 7829, 3260, 1485, 1878, 14850, 3419, 10251, 3468, 10344, 3958, 11274, 8858, 5213, 11775, 6047, 10223};
+
+static const FFTSHORT W_post_avx2_256_15361[256] = {3004, 14301, 9517, 15255, 5560, 9206, 556, 7065, 6200, 8387, 620, 5447, 62, 5153, 12295, 11268, 8910, 4199, 891, 1956, 13914, 6340, 10608, 634, 4133, 9280, 11166, 928, 7261, 3165, 14551, 7997, 15280, 5408, 1528, 3613, 3225, 11114, 8003, 10328, 11553, 4105, 11908, 8091, 4263, 14634, 11179, 10680, 2654, 1068, 9482, 3179, 13237, 1854, 5932, 9402, 12882, 13229, 13577, 2859, 5966, 1822, 6741, 12471, 14499, 15072, 2986, 13796, 6443, 7524, 11397, 9969, 5748, 2533, 3647, 11006, 4973, 7245, 11250, 8405, 1125, 8521, 7793, 14677, 11532, 6076, 13442, 6752, 13633, 12964, 12116, 10513, 7356, 11804, 6880, 10397, 688, 5648, 3141, 3637, 14139, 4972, 2950, 12786, 295, 7423, 7710, 11495, 771, 8830, 13902, 883, 13679, 10841, 2904, 14909, 9507, 3027, 5559, 4911, 2092, 14316, 12498, 7576, 4322, 6902, 12721, 12979, 15097, 2834, 6118, 9500, 3684, 950, 9585, 95, 8639, 7690, 2400, 769, 240, 1613, 24, 10914, 9219, 10308, 2458, 4103, 3318, 11163, 3404, 11869, 9557, 2723, 5564, 11025, 9773, 8783, 11730, 11631, 1173, 14988, 10870, 4571, 1087, 14282, 4717, 13717, 5080, 5980, 508, 598, 3123, 3132, 11065, 12602, 8787, 13549, 5487, 2891, 5157, 14114, 5124, 10628, 9729, 4135, 2509, 8094, 1787, 10026, 4787, 7147, 5087, 5323, 5117, 11285, 5120, 8809, 512, 2417, 12340, 4850, 1234, 485, 9340, 7729, 934, 2309, 9310, 1767, 931, 4785, 13918, 8159, 4464, 2352, 9663, 12524, 11719, 10469, 2708, 2583, 3343, 11011, 11087, 14926, 5717, 7637, 5180, 5372, 518, 12826, 3124, 7427, 9529, 5351, 2489, 14360, 1785, 1436, 7859, 6288, 2322, 3701, 12521, 14195, 15077, 9100, 6116, 910, 6756, 91, 6820, 13834, 682, 10600};
+
+static const FFTSHORT W_fwd_avx2_256_15361[272] = {974, 9314, 10148, 4087, 5017, 5110, 511, 13876, 7532, 13042, 13593, 12112, 13500, 1350, 135, 7694, 9986, 7143, 11467, 5755, 8256, 6970, 697, 4678, 3540, 354, 9252, 13214, 10538, 4126, 6557, 5264, 9743, 11727, 5781, 14403, 12193, 11972, 13486, 7493, 11502, 13439, 2880, 288, 3101, 14135, 9094, 10126, 7157, 5324, 9749, 2511, 14076, 7552, 13044, 10521, 14877, 6096, 6754, 9892, 13278, 4400, 440, 44, 9221, 14747, 6083, 11361, 14961, 15321, 15357, 6144, 9831, 14808, 4553, 11208, 4193, 11172, 13406, 7485, 8429, 2379, 1774, 9394, 10156, 7160, 716, 6216, 6766, 6821, 14507, 6059, 2142, 12503, 12003, 11953, 11948, 4267, 5035, 8184, 10035, 8684, 10085, 8689, 2405, 7921, 14617, 6070, 607, 4669, 2003, 10953, 11848, 4257, 5034, 9720, 972, 12386, 7383, 11491, 14974, 10714, 10288, 4101, 14235, 9104, 10127, 5621, 974, 10148, 5017, 511, 7532, 13593, 13500, 135, 9986, 11467, 8256, 697, 3540, 9252, 10538, 6557, 9743, 5781, 12193, 13486, 11502, 2880, 3101, 9094, 7157, 9749, 14076, 13044, 14877, 6754, 13278, 440, 9221, 6083, 14961, 15357, 9831, 4553, 4193, 13406, 8429, 1774, 10156, 716, 6766, 14507, 2142, 12003, 11948, 5035, 10035, 10085, 2405, 14617, 607, 2003, 11848, 5034, 972, 7383, 14974, 10288, 14235, 10127, 974, 5017, 7532, 13500, 9986, 8256, 3540, 10538, 9743, 12193, 11502, 3101, 7157, 14076, 14877, 13278, 9221, 14961, 9831, 4193, 8429, 10156, 6766, 2142, 11948, 10035, 2405, 607, 11848, 972, 14974, 14235, 974, 7532, 9986, 3540, 9743, 11502, 7157, 14877, 9221, 9831, 8429, 6766, 11948, 2405, 11848, 14974, 974, 9986, 9743, 7157, 9221, 8429, 11948, 11848, 974, 9743, 9221, 11948, 974, 9743, 9221, 11948, 974, 9221, 974, 9221, 974, 9221, 974, 9221, 974, 974, 974, 974, 974, 974, 974, 974};
+
+static const FFTSHORT W_bwd_avx2_256_15361[272] = {974, 974, 974, 974, 974, 974, 974, 974, 974, 6140, 974, 6140, 974, 6140, 974, 6140, 974, 3413, 6140, 5618, 974, 3413, 6140, 5618, 974, 3513, 3413, 6932, 6140, 8204, 5618, 5375, 974, 387, 3513, 12956, 3413, 8595, 6932, 5530, 6140, 484, 8204, 3859, 5618, 11821, 5375, 7829, 974, 1126, 387, 14389, 3513, 14754, 12956, 5326, 3413, 13219, 8595, 5205, 6932, 11168, 5530, 400, 6140, 2083, 484, 1285, 8204, 12260, 3859, 3168, 5618, 4823, 11821, 7105, 5375, 1861, 7829, 10344, 974, 5234, 1126, 5073, 387, 7978, 14389, 10327, 3513, 13358, 14754, 744, 12956, 5276, 5326, 10326, 3413, 3358, 13219, 854, 8595, 14645, 5205, 13587, 6932, 1955, 11168, 10808, 5530, 4, 400, 9278, 6140, 14921, 2083, 8607, 484, 2317, 1285, 5612, 8204, 6267, 12260, 12481, 3859, 1875, 3168, 9580, 5618, 8804, 4823, 6109, 11821, 14664, 7105, 3894, 5375, 15226, 1861, 1768, 7829, 14850, 10344, 5213, 974, 9740, 5234, 6257, 1126, 11260, 5073, 4647, 387, 3870, 7978, 2975, 14389, 5641, 10327, 11104, 3513, 4408, 13358, 10692, 14754, 9291, 744, 7440, 12956, 6672, 5276, 6677, 5326, 7177, 10326, 11094, 3413, 3408, 3358, 2858, 13219, 9302, 854, 8540, 8595, 9145, 14645, 8201, 5205, 5967, 13587, 12982, 6932, 7876, 1955, 4189, 11168, 4153, 10808, 553, 5530, 9217, 4, 40, 400, 4000, 9278, 614, 6140, 15317, 14921, 10961, 2083, 5469, 8607, 9265, 484, 4840, 2317, 7809, 1285, 12850, 5612, 10037, 8204, 5235, 6267, 1226, 12260, 15073, 12481, 1922, 3859, 7868, 1875, 3389, 3168, 958, 9580, 3634, 5618, 10097, 8804, 11235, 4823, 2147, 6109, 15007, 11821, 10683, 14664, 8391, 7105, 9606, 3894, 8218, 5375, 7667, 15226, 14011, 1861, 3249, 1768, 2319, 7829, 1485, 14850, 10251, 10344, 11274, 5213, 6047};
+
+/* N = 2048, Q = 8816641 */
+
+static const FFTSHORT W_fwd_avx2_2048_8816641[2064] = {1263129, 8510572, 6903075, 7476818, 6465706, 1870218, 1332758, 2636363, 3937180, 8571546, 6282904, 3688445, 4381604, 6549041, 8505637, 2029606, 4532466, 1291536, 1586243, 3683044, 2905114, 8127130, 73725, 2674622, 7647796, 4111851, 1830515, 2245416, 487187, 4803185, 8314652, 8347770, 7551396, 8692801, 8372588, 3802043, 7553103, 2360466, 8437010, 8432391, 4623121, 5347509, 6355616, 3928095, 6629908, 6606321, 76641, 8700385, 7463441, 3685393, 6044854, 3815208, 8057017, 1416279, 3034590, 1882942, 1551241, 3379980, 8014557, 4622954, 5259413, 957062, 4539085, 1457159, 3323561, 7764342, 6832300, 2293225, 8179743, 1958999, 2816329, 1942760, 162873, 1236932, 7308933, 4643815, 4226937, 8004324, 2498076, 8437065, 331089, 1913576, 8683500, 8270393, 6751454, 4625973, 6693616, 5316622, 8276095, 2684948, 6654078, 8375297, 6814925, 4742285, 3324874, 1276958, 4666071, 498726, 3235082, 4117135, 4670730, 7232781, 8555244, 2329152, 4483252, 6584320, 1510834, 5716268, 5280993, 5108151, 3416640, 3912825, 7602481, 4650980, 6845151, 8491660, 8277364, 6205262, 6655485, 2148677, 5628427, 6405062, 6782423, 6497143, 7103129, 1930378, 705539, 3682692, 3616929, 7834936, 8699962, 6290003, 3684924, 8120394, 1271827, 7502758, 3202643, 7172289, 6948350, 4012904, 4223161, 5220491, 4974221, 7997575, 3847703, 279921, 7601029, 8689297, 7844011, 3297923, 47128, 7491697, 6659523, 8660730, 3069200, 8789677, 7738336, 7473628, 242608, 324290, 1811382, 6195630, 7698537, 1366802, 1219794, 8351982, 2540501, 1569123, 3838086, 7930168, 6881700, 8396531, 5504066, 8642649, 183170, 7456513, 8477809, 8309073, 4876788, 4272840, 1968009, 6988556, 1306613, 828624, 719194, 2544498, 1777031, 1695676, 3179179, 1921762, 5505002, 6549490, 559384, 1550712, 5476663, 5220992, 5238509, 6559955, 2014733, 6981527, 8632668, 3259476, 4631625, 1175289, 4197360, 2115980, 839519, 553578, 6829418, 5366010, 277004, 7012547, 6518378, 354989, 8186016, 5479315, 759815, 426688, 5990694, 2328127, 5579165, 8188104, 8270195, 7702890, 5563694, 8790674, 186753, 1638659, 1082473, 6339816, 3617991, 8342369, 6074906, 1454249, 8757317, 4447059, 1851792, 5180781, 8681282, 6994763, 2205194, 2023564, 5779902, 784602, 6533508, 2370630, 6618714, 1440371, 5712716, 1242674, 6167212, 3899829, 5128742, 6887628, 1017618, 2008994, 628046, 7625835, 8470829, 4890948, 8099733, 8111587, 4228323, 1344272, 4750670, 2574300, 973608, 4292423, 2267543, 1653586, 4786032, 2750506, 6181910, 777715, 8813428, 4218032, 5999257, 3572045, 1315819, 6107336, 3251419, 2915513, 6960744, 8755994, 3590766, 6915204, 7170249, 7667212, 4323289, 8730273, 6335825, 6052961, 6983141, 5418929, 4699441, 4903536, 7190588, 5937016, 7430622, 996692, 3799095, 8004153, 6525822, 2434056, 4546723, 6700632, 6958733, 1676604, 1670969, 2921929, 8814285, 8471304, 5458286, 7141476, 3258880, 727213, 8094545, 3474215, 4931237, 3747810, 6238690, 4280432, 1643819, 8080816, 1405717, 8813679, 6039856, 6458084, 6613300, 115406, 3122166, 4525855, 1710870, 1057835, 1209099, 5508241, 2028408, 2897405, 998404, 5546919, 2211663, 6650365, 6891760, 7790435, 429498, 6469937, 8167317, 3692722, 7429725, 2635276, 7112157, 5214598, 7197760, 5760827, 6771594, 467853, 8383396, 581260, 895287, 5000683, 5432232, 4273062, 2771444, 860924, 4031614, 7916150, 6825313, 1669503, 3732411, 3289232, 7077180, 1229124, 655925, 6177549, 4812507, 33638, 1959267, 370786, 7174681, 5517673, 3994713, 8723094, 489776, 7858353, 5003466, 2835165, 8236341, 7583066, 7818902, 2300667, 3500090, 2425799, 5839968, 8713260, 6600106, 7409744, 6296535, 795380, 7731617, 4404363, 1027197, 7009323, 13373, 6896155, 4037550, 1122194, 4539151, 4078894, 72107, 1187562, 5603376, 7444584, 5775021, 2063753, 7340978, 1433612, 8535307, 4799354, 4815480, 4716819, 3775915, 1477997, 3915574, 4723507, 7884712, 7029683, 7533250, 6564396, 3829511, 1400494, 515040, 3657949, 5135693, 470723, 24855, 6670634, 6655671, 4728126, 2877341, 6305295, 6525143, 175276, 1127698, 1424081, 7044720, 3850846, 6372637, 4248771, 6482035, 83639, 2413862, 2552223, 1259030, 7456943, 6856844, 7163178, 5309762, 4815684, 6408261, 8153197, 2790614, 7330697, 4615633, 4459499, 3345904, 7091298, 4189153, 4861046, 5999514, 8036747, 7089649, 3741625, 336260, 2001674, 3207492, 3553310, 1305240, 7337151, 2635239, 5508811, 6235870, 5274153, 7518453, 1345587, 5022006, 5118619, 6193428, 7592821, 8055003, 1832091, 2865612, 593150, 4052650, 7556727, 2846757, 624857, 4782097, 463534, 4468411, 2556568, 4870965, 5002272, 5900903, 8547664, 7939098, 5204357, 4487925, 7729569, 4538268, 128672, 1092441, 3415035, 2274240, 910059, 5085261, 7074374, 5450680, 4237831, 4459348, 4427722, 4110564, 8014849, 3932282, 5301423, 2317280, 437882, 2340003, 5508693, 4220235, 667692, 8055759, 8619002, 2491274, 7013432, 8410679, 4045203, 4156221, 8236869, 2107023, 8257193, 2586273, 2485339, 8370107, 4235474, 734651, 7530734, 3336560, 2742879, 2844833, 5417275, 4988395, 6235662, 7698553, 2536716, 3637614, 2750047, 6784486, 4153792, 8064200, 3146486, 1833653, 257973, 2991841, 7101728, 1983235, 7207040, 5429590, 7261275, 4686082, 1235216, 860310, 1015209, 7707038, 4689784, 812357, 426709, 6424126, 7705676, 4288066, 2186493, 2294892, 7739264, 4795512, 8226553, 1627777, 1096564, 6223535, 5947201, 6045758, 8198862, 3597591, 6714348, 362115, 2442164, 2277375, 6417818, 524093, 3259759, 8793277, 6469756, 4851386, 586896, 3023687, 1463601, 4874052, 7000289, 2902916, 3905572, 7366381, 8498916, 1018262, 606507, 962250, 359816, 754245, 920023, 6276322, 5126168, 1623014, 4391350, 2820825, 4472877, 688936, 5271936, 805542, 7971242, 1518436, 3919114, 3476070, 5012286, 8543785, 930184, 3136587, 8701608, 5416092, 1143888, 6005076, 6958455, 5595111, 8152872, 6578739, 97773, 6543805, 358523, 4295701, 6108527, 7680883, 4355009, 491554, 3411271, 4776163, 5199569, 2648480, 7161496, 7959687, 1916625, 5698811, 3938404, 1086916, 6096673, 2747506, 7239060, 5901797, 5587641, 6376855, 1880754, 4673360, 7775453, 4827241, 3952151, 2267407, 525958, 1867844, 1875428, 966281, 849631, 8158023, 796124, 416131, 2216660, 628129, 5980203, 1175828, 627713, 2012362, 28995, 5211767, 6285085, 3360729, 1132495, 7227843, 2360336, 1135619, 2012565, 7157718, 7233775, 8498863, 7061643, 8026600, 4640578, 6690098, 1560210, 1248062, 7795227, 6969742, 7642465, 1141254, 761605, 1265362, 7576756, 2695240, 5378453, 3092555, 7172245, 8139407, 6180540, 8607681, 162013, 4478862, 784082, 3777867, 3141249, 7940461, 168794, 5469063, 4960225, 2937339, 4853498, 5132647, 4776851, 2606025, 815048, 4327598, 5301581, 7257700, 2272252, 1022821, 4436920, 8804319, 521523, 2695944, 3954823, 3676943, 7553053, 908645, 5289643, 590595, 1279389, 2780819, 4169811, 7856300, 5873853, 7793552, 6825264, 3597042, 2940318, 3362916, 3447657, 477096, 6448813, 2092213, 3189909, 8426770, 285275, 130496, 2213022, 5730644, 7268443, 8625735, 8788374, 3936115, 6742674, 1842138, 2411041, 166584, 4778390, 1622875, 1942283, 1653456, 6301282, 5147321, 8716507, 2663981, 2140034, 7351580, 7395949, 1606302, 7929276, 7783802, 5852681, 7025347, 7885632, 3766610, 5491644, 6260530, 5401021, 4544385, 5467288, 1912105, 1413823, 8602252, 1046494, 1825766, 8768037, 3608390, 8345889, 7773397, 4376189, 1844716, 3559813, 6213948, 361915, 5451521, 7321189, 1500557, 4782447, 1809640, 50057, 4549294, 1827166, 5335820, 3568256, 7500152, 4414842, 5710381, 1330769, 8186406, 933565, 2386011, 1639538, 331896, 4715027, 4995162, 3998028, 5350783, 5495801, 534296, 986888, 5490533, 7680636, 7233984, 637182, 5582013, 4833412, 6626746, 6838893, 2761898, 1579783, 3020560, 5357440, 1827489, 3605616, 6090632, 7374302, 270759, 1131260, 3989436, 3088476, 3172688, 2298810, 5476962, 1735917, 4134155, 1612046, 4729634, 2933723, 4952164, 5337069, 1217857, 4479284, 7394801, 1423062, 1966870, 1952992, 7725032, 4520647, 19426, 7555115, 4002575, 3895440, 2707864, 2693294, 6358079, 4382671, 6319992, 23669, 1504688, 8175904, 6691511, 6793109, 5376567, 4051038, 8712545, 6117340, 7367265, 7011857, 2353202, 6294514, 4005595, 8709003, 606057, 5529143, 7300077, 711209, 6092999, 809394, 3087205, 1710295, 6403496, 4689263, 3493997, 7658695, 8647034, 6719890, 2229751, 6741992, 7078560, 742835, 6410157, 5721750, 7169772, 341154, 570998, 6568661, 1591876, 4490005, 1118851, 1455792, 3658325, 6178749, 4389647, 5037318, 5012910, 1270585, 7058754, 5077147, 6700844, 418491, 7262796, 4590939, 4050724, 5590425, 7159148, 8199307, 8583821, 5630999, 4910956, 7514784, 7487634, 3829880, 5237953, 5580328, 6161898, 5478506, 16285, 8221119, 3248740, 4300380, 1080013, 7206679, 2177088, 3404897, 3789486, 7422716, 7015403, 3748643, 8737091, 112731, 391191, 8066220, 5373552, 7317634, 4957440, 7592327, 4996312, 2123347, 7207096, 707648, 6907004, 7120912, 2864202, 5498331, 6989967, 8597433, 246581, 7593968, 4858883, 5439223, 780942, 7823231, 4742688, 7444240, 7071793, 2980469, 8757927, 2762665, 1456449, 2104313, 1864951, 3041817, 2422092, 6999309, 6187132, 5696994, 23420, 6441584, 3610984, 1847934, 7421940, 3174420, 1100706, 2706747, 1470522, 2876039, 5882434, 8149463, 873645, 2928658, 1593945, 4789532, 7394925, 6081575, 3071693, 4825361, 1263129, 6903075, 6465706, 1332758, 3937180, 6282904, 4381604, 8505637, 4532466, 1586243, 2905114, 73725, 7647796, 1830515, 487187, 8314652, 7551396, 8372588, 7553103, 8437010, 4623121, 6355616, 6629908, 76641, 7463441, 6044854, 8057017, 3034590, 1551241, 8014557, 5259413, 4539085, 3323561, 6832300, 8179743, 2816329, 162873, 7308933, 4226937, 2498076, 331089, 8683500, 6751454, 6693616, 8276095, 6654078, 6814925, 3324874, 4666071, 3235082, 4670730, 8555244, 4483252, 1510834, 5280993, 3416640, 7602481, 6845151, 8277364, 6655485, 5628427, 6782423, 7103129, 705539, 3616929, 8699962, 3684924, 1271827, 3202643, 6948350, 4223161, 4974221, 3847703, 7601029, 7844011, 47128, 6659523, 3069200, 7738336, 242608, 1811382, 7698537, 1219794, 2540501, 3838086, 6881700, 5504066, 183170, 8477809, 4876788, 1968009, 1306613, 719194, 1777031, 3179179, 5505002, 559384, 5476663, 5238509, 2014733, 8632668, 4631625, 4197360, 839519, 6829418, 277004, 6518378, 8186016, 759815, 5990694, 5579165, 8270195, 5563694, 186753, 1082473, 3617991, 6074906, 8757317, 1851792, 8681282, 2205194, 5779902, 6533508, 6618714, 5712716, 6167212, 5128742, 1017618, 628046, 8470829, 8099733, 4228323, 4750670, 973608, 2267543, 4786032, 6181910, 8813428, 5999257, 1315819, 3251419, 6960744, 3590766, 7170249, 4323289, 6335825, 6983141, 4699441, 7190588, 7430622, 3799095, 6525822, 4546723, 6958733, 1670969, 8814285, 5458286, 3258880, 8094545, 4931237, 6238690, 1643819, 1405717, 6039856, 6613300, 3122166, 1710870, 1209099, 2028408, 998404, 2211663, 6891760, 429498, 8167317, 7429725, 7112157, 7197760, 6771594, 8383396, 895287, 5432232, 2771444, 4031614, 6825313, 3732411, 7077180, 655925, 4812507, 1959267, 7174681, 3994713, 489776, 5003466, 8236341, 7818902, 3500090, 5839968, 6600106, 6296535, 7731617, 1027197, 13373, 4037550, 4539151, 72107, 5603376, 5775021, 7340978, 8535307, 4815480, 3775915, 3915574, 7884712, 7533250, 3829511, 515040, 5135693, 24855, 6655671, 2877341, 6525143, 1127698, 7044720, 6372637, 6482035, 2413862, 1259030, 6856844, 5309762, 6408261, 2790614, 4615633, 3345904, 4189153, 5999514, 7089649, 336260, 3207492, 1305240, 2635239, 6235870, 7518453, 5022006, 6193428, 8055003, 2865612, 4052650, 2846757, 4782097, 4468411, 4870965, 5900903, 7939098, 4487925, 4538268, 1092441, 2274240, 5085261, 5450680, 4459348, 4110564, 3932282, 2317280, 2340003, 4220235, 8055759, 2491274, 8410679, 4156221, 2107023, 2586273, 8370107, 734651, 3336560, 2844833, 4988395, 7698553, 3637614, 6784486, 8064200, 1833653, 2991841, 1983235, 5429590, 4686082, 860310, 7707038, 812357, 6424126, 4288066, 2294892, 4795512, 1627777, 6223535, 6045758, 3597591, 362115, 2277375, 524093, 8793277, 4851386, 3023687, 4874052, 2902916, 7366381, 1018262, 962250, 754245, 6276322, 1623014, 2820825, 688936, 805542, 1518436, 3476070, 8543785, 3136587, 5416092, 6005076, 5595111, 6578739, 6543805, 4295701, 7680883, 491554, 4776163, 2648480, 7959687, 5698811, 1086916, 2747506, 5901797, 6376855, 4673360, 4827241, 2267407, 1867844, 966281, 8158023, 416131, 628129, 1175828, 2012362, 5211767, 3360729, 7227843, 1135619, 7157718, 8498863, 8026600, 6690098, 1248062, 6969742, 1141254, 1265362, 2695240, 3092555, 8139407, 8607681, 4478862, 3777867, 7940461, 5469063, 2937339, 5132647, 2606025, 4327598, 7257700, 1022821, 8804319, 2695944, 3676943, 908645, 590595, 2780819, 7856300, 7793552, 3597042, 3362916, 477096, 2092213, 8426770, 130496, 5730644, 8625735, 3936115, 1842138, 166584, 1622875, 1653456, 5147321, 2663981, 7351580, 1606302, 7783802, 7025347, 3766610, 6260530, 4544385, 1912105, 8602252, 1825766, 3608390, 7773397, 1844716, 6213948, 5451521, 1500557, 1809640, 4549294, 5335820, 7500152, 5710381, 8186406, 2386011, 331896, 4995162, 5350783, 534296, 5490533, 7233984, 5582013, 6626746, 2761898, 3020560, 1827489, 6090632, 270759, 3989436, 3172688, 5476962, 4134155, 4729634, 4952164, 1217857, 7394801, 1966870, 7725032, 19426, 4002575, 2707864, 6358079, 6319992, 1504688, 6691511, 5376567, 8712545, 7367265, 2353202, 4005595, 606057, 7300077, 6092999, 3087205, 6403496, 3493997, 8647034, 2229751, 7078560, 6410157, 7169772, 570998, 1591876, 1118851, 3658325, 4389647, 5012910, 7058754, 6700844, 7262796, 4050724, 7159148, 8583821, 4910956, 7487634, 5237953, 6161898, 16285, 3248740, 1080013, 2177088, 3789486, 7015403, 8737091, 391191, 5373552, 4957440, 4996312, 7207096, 6907004, 2864202, 6989967, 246581, 4858883, 780942, 4742688, 7071793, 8757927, 1456449, 1864951, 2422092, 6187132, 23420, 3610984, 7421940, 1100706, 1470522, 5882434, 873645, 1593945, 7394925, 3071693, 1263129, 6465706, 3937180, 4381604, 4532466, 2905114, 7647796, 487187, 7551396, 7553103, 4623121, 6629908, 7463441, 8057017, 1551241, 5259413, 3323561, 8179743, 162873, 4226937, 331089, 6751454, 8276095, 6814925, 4666071, 4670730, 4483252, 5280993, 7602481, 8277364, 5628427, 7103129, 3616929, 3684924, 3202643, 4223161, 3847703, 7844011, 6659523, 7738336, 1811382, 1219794, 3838086, 5504066, 8477809, 1968009, 719194, 3179179, 559384, 5238509, 8632668, 4197360, 6829418, 6518378, 759815, 5579165, 5563694, 1082473, 6074906, 1851792, 2205194, 6533508, 5712716, 5128742, 628046, 8099733, 4750670, 2267543, 6181910, 5999257, 3251419, 3590766, 4323289, 6983141, 7190588, 3799095, 4546723, 1670969, 5458286, 8094545, 6238690, 1405717, 6613300, 1710870, 2028408, 2211663, 429498, 7429725, 7197760, 8383396, 5432232, 4031614, 3732411, 655925, 1959267, 3994713, 5003466, 7818902, 5839968, 6296535, 1027197, 4037550, 72107, 5775021, 8535307, 3775915, 7884712, 3829511, 5135693, 6655671, 6525143, 7044720, 6482035, 1259030, 5309762, 2790614, 3345904, 5999514, 336260, 1305240, 6235870, 5022006, 8055003, 4052650, 4782097, 4870965, 7939098, 4538268, 2274240, 5450680, 4110564, 2317280, 4220235, 2491274, 4156221, 2586273, 734651, 2844833, 7698553, 6784486, 1833653, 1983235, 4686082, 7707038, 6424126, 2294892, 1627777, 6045758, 362115, 524093, 4851386, 4874052, 7366381, 962250, 6276322, 2820825, 805542, 3476070, 3136587, 6005076, 6578739, 4295701, 491554, 2648480, 5698811, 2747506, 6376855, 4827241, 1867844, 8158023, 628129, 2012362, 3360729, 1135619, 8498863, 6690098, 6969742, 1265362, 3092555, 8607681, 3777867, 5469063, 5132647, 4327598, 1022821, 2695944, 908645, 2780819, 7793552, 3362916, 2092213, 130496, 8625735, 1842138, 1622875, 5147321, 7351580, 7783802, 3766610, 4544385, 8602252, 3608390, 1844716, 5451521, 1809640, 5335820, 5710381, 2386011, 4995162, 534296, 7233984, 6626746, 3020560, 6090632, 3989436, 5476962, 4729634, 1217857, 1966870, 19426, 2707864, 6319992, 6691511, 8712545, 2353202, 606057, 6092999, 6403496, 8647034, 7078560, 7169772, 1591876, 3658325, 5012910, 6700844, 4050724, 8583821, 7487634, 6161898, 3248740, 2177088, 7015403, 391191, 4957440, 7207096, 2864202, 246581, 780942, 7071793, 1456449, 2422092, 23420, 7421940, 1470522, 873645, 7394925, 1263129, 3937180, 4532466, 7647796, 7551396, 4623121, 7463441, 1551241, 3323561, 162873, 331089, 8276095, 4666071, 4483252, 7602481, 5628427, 3616929, 3202643, 3847703, 6659523, 1811382, 3838086, 8477809, 719194, 559384, 8632668, 6829418, 759815, 5563694, 6074906, 2205194, 5712716, 628046, 4750670, 6181910, 3251419, 4323289, 7190588, 4546723, 5458286, 6238690, 6613300, 2028408, 429498, 7197760, 5432232, 3732411, 1959267, 5003466, 5839968, 1027197, 72107, 8535307, 7884712, 5135693, 6525143, 6482035, 5309762, 3345904, 336260, 6235870, 8055003, 4782097, 7939098, 2274240, 4110564, 4220235, 4156221, 734651, 7698553, 1833653, 4686082, 6424126, 1627777, 362115, 4851386, 7366381, 6276322, 805542, 3136587, 6578739, 491554, 5698811, 6376855, 1867844, 628129, 3360729, 8498863, 6969742, 3092555, 3777867, 5132647, 1022821, 908645, 7793552, 2092213, 8625735, 1622875, 7351580, 3766610, 8602252, 1844716, 1809640, 5710381, 4995162, 7233984, 3020560, 3989436, 4729634, 1966870, 2707864, 6691511, 2353202, 6092999, 8647034, 7169772, 3658325, 6700844, 8583821, 6161898, 2177088, 391191, 7207096, 246581, 7071793, 2422092, 7421940, 873645, 1263129, 4532466, 7551396, 7463441, 3323561, 331089, 4666071, 7602481, 3616929, 3847703, 1811382, 8477809, 559384, 6829418, 5563694, 2205194, 628046, 6181910, 4323289, 4546723, 6238690, 2028408, 7197760, 3732411, 5003466, 1027197, 8535307, 5135693, 6482035, 3345904, 6235870, 4782097, 2274240, 4220235, 734651, 1833653, 6424126, 362115, 7366381, 805542, 6578739, 5698811, 1867844, 3360729, 6969742, 3777867, 1022821, 7793552, 8625735, 7351580, 8602252, 1809640, 4995162, 3020560, 4729634, 2707864, 2353202, 8647034, 3658325, 8583821, 2177088, 7207096, 7071793, 7421940, 1263129, 7551396, 3323561, 4666071, 3616929, 1811382, 559384, 5563694, 628046, 4323289, 6238690, 7197760, 5003466, 8535307, 6482035, 6235870, 2274240, 734651, 6424126, 7366381, 6578739, 1867844, 6969742, 1022821, 8625735, 8602252, 4995162, 4729634, 2353202, 3658325, 2177088, 7071793, 1263129, 3323561, 3616929, 559384, 628046, 6238690, 5003466, 6482035, 2274240, 6424126, 6578739, 6969742, 8625735, 4995162, 2353202, 2177088, 1263129, 3616929, 628046, 5003466, 2274240, 6578739, 8625735, 2353202, 1263129, 628046, 2274240, 8625735, 1263129, 628046, 2274240, 8625735, 1263129, 2274240, 1263129, 2274240, 1263129, 2274240, 1263129, 2274240, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129};
+
+static const FFTSHORT W_bwd_avx2_2048_8816641[2064] = {1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 6542401, 1263129, 6542401, 1263129, 6542401, 1263129, 6542401, 1263129, 190906, 6542401, 8188595, 1263129, 190906, 6542401, 8188595, 1263129, 6463439, 190906, 2237902, 6542401, 3813175, 8188595, 5199712, 1263129, 6639553, 6463439, 3821479, 190906, 1846899, 2237902, 2392515, 6542401, 2334606, 3813175, 2577951, 8188595, 8257257, 5199712, 5493080, 1263129, 1744848, 6639553, 5158316, 6463439, 4087007, 3821479, 214389, 190906, 7793820, 1846899, 6948797, 2237902, 1450260, 2392515, 8081990, 6542401, 2580771, 2334606, 281334, 3813175, 1618881, 2577951, 4493352, 8188595, 3252947, 8257257, 7005259, 5199712, 4150570, 5493080, 1265245, 1263129, 1394701, 1744848, 1609545, 6639553, 232820, 5158316, 169607, 6463439, 6108777, 4087007, 5796081, 3821479, 7007001, 214389, 1465061, 190906, 1023089, 7793820, 5038774, 1846899, 5455912, 6948797, 3117830, 2237902, 8011099, 1450260, 8454526, 2392515, 6982988, 8081990, 4596406, 6542401, 4034544, 2580771, 5470737, 2334606, 3680948, 281334, 7789444, 3813175, 5084230, 1618881, 6788233, 2577951, 4269918, 4493352, 2634731, 8188595, 6611447, 3252947, 1987223, 8257257, 338832, 7005259, 4968938, 5199712, 1214160, 4150570, 8485552, 5493080, 1353200, 1265245, 4284175, 1263129, 7942996, 1394701, 6394549, 1744848, 8570060, 1609545, 8425450, 6639553, 2654743, 232820, 2115797, 5158316, 1646869, 169607, 2723642, 6463439, 2125130, 6108777, 6849771, 4087007, 4827205, 5796081, 1582657, 3821479, 3106260, 7007001, 6971925, 214389, 5050031, 1465061, 7193766, 190906, 6724428, 1023089, 7907996, 7793820, 3683994, 5038774, 5724086, 1846899, 317778, 5455912, 8188512, 6948797, 2439786, 3117830, 8325087, 2237902, 5680054, 8011099, 2540319, 1450260, 3965255, 8454526, 7188864, 2392515, 4130559, 6982988, 1118088, 8081990, 4660420, 4596406, 4706077, 6542401, 877543, 4034544, 761638, 2580771, 8480381, 5470737, 3506879, 2334606, 2291498, 3680948, 931929, 281334, 8744534, 7789444, 2976673, 3813175, 6857374, 5084230, 3384409, 1618881, 8387143, 6788233, 2203341, 2577951, 3358355, 4269918, 1626053, 4493352, 5565222, 2634731, 4065971, 8188595, 3103925, 6611447, 2741735, 3252947, 8056826, 1987223, 183973, 8257257, 8097447, 338832, 4978555, 7005259, 2157118, 4968938, 5613998, 5199712, 3188214, 1214160, 4333389, 4150570, 540546, 8485552, 8653768, 5493080, 7265400, 1353200, 4193520, 1265245, 1168845, 4284175, 4879461, 1263129, 1421716, 7942996, 7346119, 1394701, 8793221, 6394549, 7360192, 1744848, 8035699, 8570060, 5952439, 1609545, 3859201, 8425450, 1801238, 6639553, 5567901, 2654743, 1329007, 232820, 4765917, 2115797, 3803731, 5158316, 7224765, 1646869, 1738081, 169607, 2413145, 2723642, 8210584, 6463439, 104096, 2125130, 2496649, 6108777, 8797215, 6849771, 7598784, 4087007, 3339679, 4827205, 2726009, 5796081, 2189895, 1582657, 8282345, 3821479, 6430630, 3106260, 3480821, 7007001, 3365120, 6971925, 5208251, 214389, 4272256, 5050031, 1032839, 1465061, 3669320, 7193766, 6974503, 190906, 8686145, 6724428, 5453725, 1023089, 6035822, 7907996, 6120697, 7793820, 4489043, 3683994, 3347578, 5038774, 208960, 5724086, 7551279, 1846899, 2126543, 317778, 7681022, 5455912, 6804279, 8188512, 658618, 6948797, 3989400, 2439786, 6069135, 3117830, 6168161, 8325087, 4520940, 2237902, 2811565, 5680054, 5340571, 8011099, 5995816, 2540319, 7854391, 1450260, 3942589, 3965255, 8292548, 8454526, 2770883, 7188864, 6521749, 2392515, 1109603, 4130559, 6833406, 6982988, 2032155, 1118088, 5971808, 8081990, 6230368, 4660420, 6325367, 4596406, 6499361, 4706077, 3365961, 6542401, 4278373, 877543, 3945676, 4034544, 4763991, 761638, 3794635, 2580771, 7511401, 8480381, 2817127, 5470737, 6026027, 3506879, 7557611, 2334606, 1771921, 2291498, 2160970, 3680948, 4987130, 931929, 5040726, 281334, 3041620, 8744534, 4779091, 7789444, 2520106, 2976673, 997739, 3813175, 4821928, 6857374, 8160716, 5084230, 4785027, 3384409, 433245, 1618881, 1386916, 8387143, 6604978, 6788233, 7105771, 2203341, 7410924, 2577951, 722096, 3358355, 7145672, 4269918, 5017546, 1626053, 1833500, 4493352, 5225875, 5565222, 2817384, 2634731, 6549098, 4065971, 716908, 8188595, 3687899, 3103925, 2283133, 6611447, 6964849, 2741735, 7734168, 3252947, 3237476, 8056826, 2298263, 1987223, 4619281, 183973, 3578132, 8257257, 5637462, 8097447, 6848632, 338832, 3312575, 4978555, 7596847, 7005259, 1078305, 2157118, 972630, 4968938, 4593480, 5613998, 5131717, 5199712, 1713512, 3188214, 539277, 1214160, 3535648, 4333389, 4145911, 4150570, 2001716, 540546, 2065187, 8485552, 4589704, 8653768, 636898, 5493080, 3557228, 7265400, 759624, 1353200, 2186733, 4193520, 1263538, 1265245, 8329454, 1168845, 5911527, 4284175, 4435037, 4879461, 2350935, 1263129, 5744948, 1421716, 7222696, 7942996, 2934207, 7346119, 7715935, 1394701, 5205657, 8793221, 2629509, 6394549, 6951690, 7360192, 58714, 1744848, 4073953, 8035699, 3957758, 8570060, 1826674, 5952439, 1909637, 1609545, 3820329, 3859201, 3443089, 8425450, 79550, 1801238, 5027155, 6639553, 7736628, 5567901, 8800356, 2654743, 3578688, 1329007, 3905685, 232820, 1657493, 4765917, 1553845, 2115797, 1757887, 3803731, 4426994, 5158316, 7697790, 7224765, 8245643, 1646869, 2406484, 1738081, 6586890, 169607, 5322644, 2413145, 5729436, 2723642, 1516564, 8210584, 4811046, 6463439, 1449376, 104096, 3440074, 2125130, 7311953, 2496649, 2458562, 6108777, 4814066, 8797215, 1091609, 6849771, 1421840, 7598784, 3864477, 4087007, 4682486, 3339679, 5643953, 4827205, 8545882, 2726009, 6989152, 5796081, 6054743, 2189895, 3234628, 1582657, 3326108, 8282345, 3465858, 3821479, 8484745, 6430630, 630235, 3106260, 1316489, 3480821, 4267347, 7007001, 7316084, 3365120, 2602693, 6971925, 1043244, 5208251, 6990875, 214389, 6904536, 4272256, 2556111, 5050031, 1791294, 1032839, 7210339, 1465061, 6152660, 3669320, 7163185, 7193766, 8650057, 6974503, 4880526, 190906, 3085997, 8686145, 389871, 6724428, 8339545, 5453725, 5219599, 1023089, 960341, 6035822, 8226046, 7907996, 5139698, 6120697, 12322, 7793820, 1558941, 4489043, 6210616, 3683994, 5879302, 3347578, 876180, 5038774, 4337779, 208960, 677234, 5724086, 6121401, 7551279, 7675387, 1846899, 7568579, 2126543, 790041, 317778, 1658923, 7681022, 1588798, 5455912, 3604874, 6804279, 7640813, 8188512, 8400510, 658618, 7850360, 6948797, 6549234, 3989400, 4143281, 2439786, 2914844, 6069135, 7729725, 3117830, 856954, 6168161, 4040478, 8325087, 1135758, 4520940, 2272836, 2237902, 3221530, 2811565, 3400549, 5680054, 272856, 5340571, 7298205, 8011099, 8127705, 5995816, 7193627, 2540319, 8062396, 7854391, 7798379, 1450260, 5913725, 3942589, 5792954, 3965255, 23364, 8292548, 6539266, 8454526, 5219050, 2770883, 2593106, 7188864, 4021129, 6521749, 4528575, 2392515, 8004284, 1109603, 7956331, 4130559, 3387051, 6833406, 5824800, 6982988, 752441, 2032155, 5179027, 1118088, 3828246, 5971808, 5480081, 8081990, 446534, 6230368, 6709618, 4660420, 405962, 6325367, 760882, 4596406, 6476638, 6499361, 4884359, 4706077, 4357293, 3365961, 3731380, 6542401, 7724200, 4278373, 4328716, 877543, 2915738, 3945676, 4348230, 4034544, 5969884, 4763991, 5951029, 761638, 2623213, 3794635, 1298188, 2580771, 6181402, 7511401, 5609149, 8480381, 1726992, 2817127, 4627488, 5470737, 4201008, 6026027, 2408380, 3506879, 1959797, 7557611, 6402779, 2334606, 2444004, 1771921, 7688943, 2291498, 5939300, 2160970, 8791786, 3680948, 8301601, 4987130, 1283391, 931929, 4901067, 5040726, 4001161, 281334, 1475663, 3041620, 3213265, 8744534, 4277490, 4779091, 8803268, 7789444, 1085024, 2520106, 2216535, 2976673, 5316551, 997739, 580300, 3813175, 8326865, 4821928, 1641960, 6857374, 4004134, 8160716, 1739461, 5084230, 1991328, 4785027, 6045197, 3384409, 7921354, 433245, 2045047, 1618881, 1704484, 1386916, 649324, 8387143, 1924881, 6604978, 7818237, 6788233, 7607542, 7105771, 5694475, 2203341, 2776785, 7410924, 7172822, 2577951, 3885404, 722096, 5557761, 3358355, 2356, 7145672, 1857908, 4269918, 2290819, 5017546, 1386019, 1626053, 4117200, 1833500, 2480816, 4493352, 1646392, 5225875, 1855897, 5565222, 7500822, 2817384, 3213, 2634731, 4030609, 6549098, 7843033, 4065971, 4588318, 716908, 345812, 8188595, 7799023, 3687899, 2649429, 3103925, 2197927, 2283133, 3036739, 6611447, 135359, 6964849, 59324, 2741735, 5198650, 7734168, 8629888, 3252947, 546446, 3237476, 2825947, 8056826, 630625, 2298263, 8539637, 1987223, 7977122, 4619281, 4185016, 183973, 6801908, 3578132, 3339978, 8257257, 3311639, 5637462, 7039610, 8097447, 7510028, 6848632, 3939853, 338832, 8633471, 3312575, 1934941, 4978555, 6276140, 7596847, 1118104, 7005259, 8574033, 1078305, 5747441, 2157118, 8769513, 972630, 1215612, 4968938, 3842420, 4593480, 1868291, 5613998, 7544814, 5131717, 116679, 5199712, 8111102, 1713512, 2034218, 3188214, 2161156, 539277, 1971490, 1214160, 5400001, 3535648, 7305807, 4333389, 261397, 4145911, 5581559, 4150570, 5491767, 2001716, 2162563, 540546, 2123025, 2065187, 133141, 8485552, 6318565, 4589704, 1507708, 8653768, 6000312, 636898, 1984341, 5493080, 4277556, 3557228, 802084, 7265400, 5782051, 759624, 2771787, 1353200, 8740000, 2186733, 2461025, 4193520, 379631, 1263538, 444053, 1265245, 501989, 8329454, 6986126, 1168845, 8742916, 5911527, 7230398, 4284175, 311004, 4435037, 2533737, 4879461, 7483883, 2350935, 1913566, 1263129, 3991280, 5744948, 2735066, 1421716, 4027109, 7222696, 5887983, 7942996, 667178, 2934207, 5940602, 7346119, 6109894, 7715935, 5642221, 1394701, 6968707, 5205657, 2375057, 8793221, 3119647, 2629509, 1817332, 6394549, 5774824, 6951690, 6712328, 7360192, 6053976, 58714, 5836172, 1744848, 1372401, 4073953, 993410, 8035699, 3377418, 3957758, 1222673, 8570060, 219208, 1826674, 3318310, 5952439, 1695729, 1909637, 8108993, 1609545, 6693294, 3820329, 1224314, 3859201, 1499007, 3443089, 750421, 8425450, 8703910, 79550, 5067998, 1801238, 1393925, 5027155, 5411744, 6639553, 1609962, 7736628, 4516261, 5567901, 595522, 8800356, 3338135, 2654743, 3236313, 3578688, 4986761, 1329007, 1301857, 3905685, 3185642, 232820, 617334, 1657493, 3226216, 4765917, 4225702, 1553845, 8398150, 2115797, 3739494, 1757887, 7546056, 3803731, 3779323, 4426994, 2637892, 5158316, 7360849, 7697790, 4326636, 7224765, 2247980, 8245643, 8475487, 1646869, 3094891, 2406484, 8073806, 1738081, 2074649, 6586890, 2096751, 169607, 1157946, 5322644, 4127378, 2413145, 7106346, 5729436, 8007247, 2723642, 8105432, 1516564, 3287498, 8210584, 107638, 4811046, 2522127, 6463439, 1804784, 1449376, 2699301, 104096, 4765603, 3440074, 2023532, 2125130, 640737, 7311953, 8792972, 2496649, 4433970, 2458562, 6123347, 6108777, 4921201, 4814066, 1261526, 8797215, 4295994, 1091609, 6863649, 6849771, 7393579, 1421840, 4337357, 7598784, 3479572, 3864477, 5882918, 4087007, 7204595, 4682486, 7080724, 3339679, 6517831, 5643953, 5728165, 4827205, 7685381, 8545882, 1442339, 2726009, 5211025, 6989152, 3459201, 5796081, 7236858, 6054743, 1977748, 2189895, 3983229, 3234628, 8179459, 1582657, 1136005, 3326108, 7829753, 8282345, 3320840, 3465858, 4818613, 3821479, 4101614, 8484745, 7177103, 6430630, 7883076, 630235, 7485872, 3106260, 4401799, 1316489, 5248385, 3480821, 6989475, 4267347, 8766584, 7007001, 4034194, 7316084, 1495452, 3365120, 8454726, 2602693, 5256828, 6971925, 4440452, 1043244, 470752, 5208251, 48604, 6990875, 7770147, 214389, 7402818, 6904536, 3349353, 4272256, 3415620, 2556111, 3324997, 5050031, 931009, 1791294, 2963960, 1032839, 887365, 7210339, 1420692, 1465061, 6676607, 6152660, 100134, 3669320, 2515359, 7163185, 6874358, 7193766, 4038251, 8650057, 6405600, 6974503, 2073967, 4880526, 28267, 190906, 1548198, 3085997, 6603619, 8686145, 8531366, 389871, 5626732, 6724428, 2367828, 8339545, 5368984, 5453725, 5876323, 5219599, 1991377, 1023089, 2942788, 960341, 4646830, 6035822, 7537252, 8226046, 3526998, 7907996, 1263588, 5139698, 4861818, 6120697, 8295118, 12322, 4379721, 7793820, 6544389, 1558941, 3515060, 4489043, 8001593, 6210616, 4039790, 3683994, 3963143, 5879302, 3856416, 3347578, 8647847, 876180, 5675392, 5038774, 8032559, 4337779, 8654628, 208960, 2636101, 677234, 1644396, 5724086, 3438188, 6121401, 1239885, 7551279, 8055036, 7675387, 1174176, 1846899, 1021414, 7568579, 7256431, 2126543, 4176063, 790041, 1754998, 317778, 1582866, 1658923, 6804076, 7681022, 6456305, 1588798, 7684146, 5455912, 2531556, 3604874, 8787646, 6804279, 8188928, 7640813, 2836438, 8188512, 6599981, 8400510, 8020517, 658618, 7967010, 7850360, 6941213, 6948797, 8290683, 6549234, 4864490, 3989400, 1041188, 4143281, 6935887, 2439786, 3229000, 2914844, 1577581, 6069135, 2719968, 7729725, 4878237, 3117830, 6900016, 856954, 1655145, 6168161, 3617072, 4040478, 5405370, 8325087, 4461632, 1135758, 2708114, 4520940, 8458118, 2272836, 8718868, 2237902, 663769, 3221530, 1858186, 2811565, 7672753, 3400549, 115033, 5680054, 7886457, 272856, 3804355, 5340571, 4897527, 7298205, 845399, 8011099, 3544705, 8127705, 4343764, 5995816, 4425291, 7193627, 3690473, 2540319, 7896618, 8062396, 8456825, 7854391, 8210134, 7798379, 317725, 1450260, 4911069, 5913725, 1816352, 3942589, 7353040, 5792954, 8229745, 3965255, 2346885, 23364, 5556882, 8292548, 2398823, 6539266, 6374477, 8454526, 2102293, 5219050, 617779, 2770883, 2869440, 2593106, 7720077, 7188864, 590088, 4021129, 1077377, 6521749, 6630148, 4528575, 1110965, 2392515, 8389932, 8004284, 4126857, 1109603, 7801432, 7956331, 7581425, 4130559, 1555366, 3387051, 1609601, 6833406, 1714913, 5824800, 8558668, 6982988, 5670155, 752441, 4662849, 2032155, 6066594, 5179027, 6279925, 1118088, 2580979, 3828246, 3399366, 5971808, 6073762, 5480081, 1285907, 8081990, 4581167, 446534, 6331302, 6230368, 559448, 6709618, 579772, 4660420, 4771438, 405962, 1803209, 6325367, 197639, 760882, 8148949, 4596406, 3307948, 6476638, 8378759, 6499361, 3515218, 4884359, 801792, 4706077, 4388919, 4357293, 4578810, 3365961, 1742267, 3731380, 7906582, 6542401, 5401606, 7724200, 8687969, 4278373, 1087072, 4328716, 3612284, 877543, 268977, 2915738, 3814369, 3945676, 6260073, 4348230, 8353107, 4034544, 8191784, 5969884, 1259914, 4763991, 8223491, 5951029, 6984550, 761638, 1223820, 2623213, 3698022, 3794635, 7471054, 1298188, 3542488, 2580771, 3307830, 6181402, 1479490, 7511401, 5263331, 5609149, 6814967, 8480381, 5075016, 1726992, 779894, 2817127, 3955595, 4627488, 1725343, 5470737, 4357142, 4201008, 1485944, 6026027, 663444, 2408380, 4000957, 3506879, 1653463, 1959797, 1359698, 7557611, 6264418, 6402779, 8733002, 2334606, 4567870, 2444004, 4965795, 1771921, 7392560, 7688943, 8641365, 2291498, 2511346, 5939300, 4088515, 2160970, 2146007, 8791786, 8345918, 3680948, 5158692, 8301601, 7416147, 4987130, 2252245, 1283391, 1786958, 931929, 4093134, 4901067, 7338644, 5040726, 4099822, 4001161, 4017287, 281334, 7383029, 1475663, 6752888, 3041620, 1372057, 3213265, 7629079, 8744534, 4737747, 4277490, 7694447, 4779091, 1920486, 8803268, 1807318, 7789444, 4412278, 1085024, 8021261, 2520106, 1406897, 2216535, 103381, 2976673, 6390842, 5316551, 6515974, 997739, 1233575, 580300, 5981476, 3813175, 958288, 8326865, 93547, 4821928, 3298968, 1641960, 8445855, 6857374, 8783003, 4004134, 2639092, 8160716, 7587517, 1739461, 5527409, 5084230, 7147138, 1991328, 900491, 4785027, 7955717, 6045197, 4543579, 3384409, 3815958, 7921354, 8235381, 433245, 8348788, 2045047, 3055814, 1618881, 3602043, 1704484, 6181365, 1386916, 5123919, 649324, 2346704, 8387143, 1026206, 1924881, 2166276, 6604978, 3269722, 7818237, 5919236, 6788233, 3308400, 7607542, 7758806, 7105771, 4290786, 5694475, 8701235, 2203341, 2358557, 2776785, 2962, 7410924, 735825, 7172822, 4536209, 2577951, 5068831, 3885404, 5342426, 722096, 8089428, 5557761, 1675165, 3358355, 345337, 2356, 5894712, 7145672, 7140037, 1857908, 2116009, 4269918, 6382585, 2290819, 812488, 5017546, 7819949, 1386019, 2879625, 1626053, 3913105, 4117200, 3397712, 1833500, 2763680, 2480816, 86368, 4493352, 1149429, 1646392, 1901437, 5225875, 60647, 1855897, 5901128, 5565222, 2709305, 7500822, 5244596, 2817384, 4598609, 3213, 8038926, 2634731, 6066135, 4030609, 7163055, 6549098, 4524218, 7843033, 6242341, 4065971, 7472369, 4588318, 705054, 716908, 3925693, 345812, 1190806, 8188595, 6807647, 7799023, 1929013, 3687899, 4916812, 2649429, 7573967, 3103925, 7376270, 2197927, 6446011, 2283133, 8032039, 3036739, 6793077, 6611447, 1821878, 135359, 3635860, 6964849, 4369582, 59324, 7362392, 2741735, 474272, 5198650, 2476825, 7734168, 7177982, 8629888, 25967, 3252947, 1113751, 546446, 628537, 3237476, 6488514, 2825947, 8389953, 8056826, 3337326, 630625, 8461652, 2298263, 1804094, 8539637, 3450631, 1987223, 8263063, 7977122, 6700661, 4619281, 7641352, 4185016, 5557165, 183973, 1835114, 6801908, 2256686, 3578132, 3595649, 3339978, 7265929, 8257257, 2267151, 3311639, 6894879, 5637462, 7120965, 7039610, 6272143, 8097447, 7988017, 7510028, 1828085, 6848632, 4543801, 3939853, 507568, 338832, 1360128, 8633471, 173992, 3312575, 420110, 1934941, 886473, 4978555, 7247518, 6276140, 464659, 7596847, 7449839, 1118104, 2621011, 7005259, 8492351, 8574033, 1343013, 1078305, 26964, 5747441, 155911, 2157118, 1324944, 8769513, 5518718, 972630, 127344, 1215612, 8536720, 4968938, 819066, 3842420, 3596150, 4593480, 4803737, 1868291, 1644352, 5613998, 1313883, 7544814, 696247, 5131717, 2526638, 116679, 981705, 5199712, 5133949, 8111102, 6886263, 1713512, 2319498, 2034218, 2411579, 3188214, 6667964, 2161156, 2611379, 539277, 324981, 1971490, 4165661, 1214160, 4903816, 5400001, 3708490, 3535648, 3100373, 7305807, 2232321, 4333389, 6487489, 261397, 1583860, 4145911, 4699506, 5581559, 8317915, 4150570, 7539683, 5491767, 4074356, 2001716, 441344, 2162563, 6131693, 540546, 3500019, 2123025, 4190668, 2065187, 546248, 133141, 6903065, 8485552, 379576, 6318565, 812317, 4589704, 4172826, 1507708, 7579709, 8653768, 6873881, 6000312, 6857642, 636898, 6523416, 1984341, 1052299, 5493080, 7359482, 4277556, 7859579, 3557228, 4193687, 802084, 5436661, 7265400, 6933699, 5782051, 7400362, 759624, 5001433, 2771787, 5131248, 1353200, 116256, 8740000, 2210320, 2186733, 4888546, 2461025, 3469132, 4193520, 384250, 379631, 6456175, 1263538, 5014598, 444053, 123840, 1265245, 468871, 501989, 4013456, 8329454, 6571225, 6986126, 4704790, 1168845, 6142019, 8742916, 689511, 5911527, 5133597, 7230398, 7525105, 4284175, 6787035, 311004, 2267600, 4435037, 5128196, 2533737, 245095, 4879461, 6180278, 7483883, 6946423, 2350935, 1339823, 1913566, 306069};
+
+/* N = 2048, Q = 17633281 */
+
+static const FFTSHORT W_fwd_avx2_2048_17633281[2064] = {10080013, 2530145, 7052666, 13180170, 7785169, 10468608, 5575327, 3949520, 15218449, 16706421, 4328095, 11977081, 13010576, 16402942, 8964884, 3495343, 1084636, 7761256, 3965462, 7798359, 3468879, 16404043, 11186685, 16690400, 2283645, 3671654, 9721291, 5539070, 10045132, 17232217, 14666586, 4743086, 15885627, 5795173, 9261777, 12922916, 8391927, 9375846, 810936, 6074517, 7907879, 13087380, 8592681, 9889797, 8979699, 559608, 5506981, 8584055, 15705421, 4833693, 8446673, 14405088, 4024612, 4081524, 6562940, 1573805, 11116619, 10566860, 13403708, 13020448, 17457996, 14286233, 9473453, 6809199, 16928694, 4880536, 1003189, 7291082, 10081432, 13609717, 17236143, 7134047, 832726, 17598601, 837702, 2383340, 9607278, 16771084, 1518395, 6445099, 9981777, 9564586, 7478611, 4920130, 2298235, 9939337, 13945547, 6164887, 7341867, 9968231, 12082224, 1352163, 3797647, 9243579, 5412262, 5066451, 17425204, 5608831, 3957823, 11329543, 17589994, 4465486, 15025271, 426287, 5258683, 14563436, 9644779, 11279977, 1697021, 12081870, 3136245, 7482864, 7993219, 17249487, 6531052, 3881639, 4359243, 1145048, 8144640, 98458, 812803, 10114361, 1871304, 14800263, 9473475, 5203978, 5741133, 12031479, 3355857, 2617401, 1259686, 6614138, 17012456, 2350826, 7897154, 10951613, 5028199, 6378082, 8217314, 13102487, 3587592, 6888944, 10136507, 244198, 3027818, 10288034, 15434561, 13938990, 14105712, 236821, 16296739, 14608435, 8505957, 7323100, 9509380, 7158621, 6395531, 5455912, 564740, 2954627, 8556777, 2251600, 16633416, 3452654, 10008063, 820774, 6404316, 12885814, 3204956, 9078277, 7043890, 7498125, 9384864, 6468831, 4844618, 2401624, 4430875, 11629929, 11804570, 7637946, 8255857, 10130528, 2881077, 1760810, 4113124, 1223525, 13720277, 5474338, 17087876, 13769256, 7290119, 17026824, 771265, 1581104, 332885, 10644886, 7803173, 9692035, 1755064, 4977996, 13719683, 13548743, 1752965, 14659886, 14301207, 2149963, 9725754, 14128927, 6372434, 16358886, 11029708, 12827901, 12044612, 2919648, 15982149, 6801176, 16417770, 2676071, 10123497, 6934505, 6464198, 10261767, 4357252, 14167941, 6705253, 14186154, 17129002, 1067107, 6741672, 4285406, 3267227, 6070094, 1208515, 14052339, 3231420, 11392151, 3618461, 12406468, 14899578, 6266056, 11527370, 8049239, 11076143, 14314638, 809638, 12616151, 15542581, 14380487, 10851517, 3504480, 464283, 7733306, 1071233, 8661598, 4469632, 9073803, 8073284, 7947963, 15499364, 8929375, 7913284, 10653512, 1987549, 13838041, 11501280, 13713170, 645845, 7539359, 23718, 3899473, 17589676, 13240996, 403570, 7671419, 8121524, 13189272, 12123115, 1789129, 8136366, 15497108, 11631912, 8983547, 13145537, 5995048, 15401171, 803647, 12922554, 2744598, 17129267, 11387463, 4232022, 15881077, 15575927, 13092991, 16776516, 4328098, 12559700, 2668359, 5355379, 14094779, 16483740, 12705875, 1196724, 4736472, 12756691, 1226159, 13894610, 6147527, 15632112, 3697130, 2369878, 10804967, 3195056, 8463206, 15961255, 16464198, 8681124, 11264842, 7142093, 11688156, 16923620, 12819097, 6802550, 1124776, 9293274, 11091290, 11200042, 12734327, 7538367, 13092647, 14624901, 2928060, 9750692, 13971953, 3092554, 15777636, 16863420, 6585373, 8661834, 3280244, 12494752, 3029097, 5934240, 8645203, 12080658, 14624103, 6650935, 9988578, 7865784, 13936402, 16987110, 11438021, 7056066, 15172546, 6860007, 9526718, 473597, 6220912, 8017315, 6392549, 8230899, 525615, 16331467, 5459356, 16979955, 14920905, 4283492, 1855206, 9557446, 13874590, 3336314, 4276204, 3019689, 12702280, 14233956, 7841061, 8825655, 7917053, 13774901, 16199209, 11808539, 2578519, 8928822, 12194628, 918977, 10594347, 2791289, 9555222, 11036209, 5767042, 12360524, 8846225, 5864303, 9940999, 1684134, 7392994, 5740472, 12971820, 13275514, 3371004, 17136086, 13184375, 1536354, 14562522, 2595240, 17606978, 17197825, 902588, 1737330, 5290436, 3671028, 5703333, 6476975, 5343467, 4790987, 8190832, 7292899, 16166480, 15366136, 9108985, 10682996, 14784037, 8761049, 4163233, 16770851, 3290402, 10315214, 3978401, 16708204, 9687888, 13390086, 6656165, 14712924, 10902850, 9894424, 2397312, 1655133, 231760, 3248941, 4980324, 7366721, 11131206, 16251924, 10336900, 7060547, 9624836, 11667131, 12901133, 9982808, 4069704, 3370610, 17029675, 1944050, 6520586, 10900990, 1336264, 13690849, 9431165, 11320721, 8852218, 11824073, 4088650, 9203593, 10276978, 7794101, 11180279, 12812059, 15374294, 571202, 5953002, 2255262, 10730248, 10360059, 14076126, 2897849, 2710208, 9631442, 7364656, 3905070, 17176862, 14798654, 2639022, 3473941, 6135006, 11489630, 14147115, 185504, 7136336, 4538998, 8563637, 255451, 1904843, 9850267, 14236098, 632283, 12827456, 2033678, 8797483, 14808861, 4097834, 5955417, 12798251, 8154195, 4245468, 17453847, 2021801, 12168673, 15167482, 10862871, 10240824, 10381924, 4899123, 1771462, 15582870, 15460447, 3923529, 4842245, 15301, 3282138, 4144886, 9712255, 14018742, 2795209, 857445, 10177002, 11941861, 14776544, 11257556, 14572749, 13815939, 9917944, 3110493, 14133172, 2014112, 111780, 1815029, 6717554, 16747565, 12754941, 2275175, 4516904, 14411712, 3217851, 3565283, 371459, 7815563, 149008, 13838717, 13474034, 4982271, 15187551, 17312434, 5495623, 6948646, 7821882, 4764679, 906584, 1921474, 1049853, 12106747, 14643726, 8773118, 2813097, 6941739, 12445854, 16944029, 8887929, 5491489, 15230590, 11705860, 10784990, 2856955, 1690623, 15634940, 12158690, 10188806, 271369, 7457082, 8817337, 8892864, 11702570, 766509, 744155, 3120666, 14866729, 4152174, 8547772, 10873908, 2435843, 13985979, 5627551, 7044497, 13703923, 9292303, 10605271, 2429794, 8906175, 4690766, 11780123, 3228304, 17532291, 1188629, 7875973, 11899500, 10988764, 13853520, 8207823, 15506922, 7300759, 8532813, 3477212, 708046, 14447774, 12151847, 3730942, 15171649, 8989736, 16025426, 6271387, 6477754, 3808432, 5398445, 13731776, 16859559, 14985803, 5967958, 9069339, 5166981, 3312546, 2421935, 10856288, 7254524, 16498541, 1173491, 12738426, 4214722, 557140, 14059858, 11662038, 5394253, 16627513, 14971454, 5359679, 14540045, 16350934, 12551913, 968047, 6571863, 537619, 14113440, 2234480, 1000057, 16201681, 15788008, 15099715, 4509906, 7240668, 17589819, 11623700, 7034188, 10069346, 5780585, 9260267, 7681609, 401068, 15499041, 10856093, 4650851, 1044687, 13933846, 14327590, 6366405, 3407688, 17555694, 14446231, 501731, 3704784, 1751789, 15505891, 12795641, 12640814, 9000948, 1062231, 233244, 15196404, 8559565, 8822667, 9526802, 16786929, 16404613, 16084609, 8963361, 1607114, 8521249, 8857381, 9414355, 14747003, 5024588, 4552492, 1825030, 15191944, 552327, 2153148, 16985851, 7920421, 3674914, 13913582, 5274354, 13291033, 1968040, 16222099, 13604697, 395284, 3106312, 7409658, 3348867, 2877768, 11563450, 2845668, 2088343, 15729293, 15129900, 623265, 7169561, 3263577, 14303738, 5832085, 1060586, 4040644, 14140004, 457946, 17255202, 5523544, 15966412, 12889242, 4757349, 11547682, 8791098, 15008853, 15326088, 13688429, 9672665, 7622761, 15746133, 17529808, 6828411, 9765198, 3926304, 14766390, 8336159, 11589343, 5945172, 15715119, 7363407, 14085054, 8710455, 11981042, 519738, 3510830, 5222590, 5486804, 16426770, 4838252, 413776, 14813785, 2294885, 5901757, 7077715, 16946818, 9775442, 6692990, 7249063, 2179094, 989489, 3411986, 11734787, 15330476, 7712811, 56177, 806009, 7294847, 670475, 12222198, 12303444, 9004707, 8119317, 1896878, 14725550, 170435, 7765745, 5849163, 8537279, 12649688, 4326412, 2526880, 13644864, 7170873, 5318592, 17182960, 5883527, 5107979, 12260877, 12232505, 9671848, 13533476, 16829363, 10858414, 2816205, 11003469, 1310609, 15668130, 15841568, 7277378, 11303271, 17297174, 16053705, 8404136, 5825795, 7954659, 11042178, 7065860, 1079506, 16579783, 2975689, 13887138, 12722367, 6545952, 11575682, 9640123, 6352620, 6532095, 717233, 11782217, 4330903, 10676754, 13366733, 8986640, 14294172, 11304326, 16463244, 17374373, 2666301, 11244208, 2643398, 12801128, 2620824, 13596568, 2809530, 1905707, 1311729, 15702091, 10558000, 9041612, 4436442, 5390925, 10984712, 14549342, 5659272, 1693007, 8402012, 16530287, 12432680, 3540018, 7556086, 9867112, 5851517, 13111442, 14643769, 11246230, 7396422, 7292865, 15441225, 15022722, 10881732, 5444029, 2770692, 6364401, 2150378, 13910498, 5873576, 12221666, 3029840, 15041058, 9926298, 9126110, 15531866, 8309023, 2201780, 16067398, 16801548, 16548759, 14378266, 8595755, 13226272, 15134321, 1056456, 7221653, 15989880, 9381454, 8412152, 10855035, 4902162, 10066236, 13085963, 3779282, 16322550, 7660780, 10931981, 1158159, 9313652, 7017486, 16836631, 17565325, 9841881, 13761399, 15506405, 940250, 15757922, 2946221, 15953472, 9662951, 7863506, 610879, 11611653, 6779103, 8710897, 3776076, 4984120, 15731681, 2796037, 2960760, 12316632, 13372086, 2331803, 16499085, 12777571, 599769, 11117332, 13847488, 12307287, 14741844, 2333371, 9493318, 8907232, 10123009, 12083740, 7758708, 8737353, 16291820, 5626895, 14833630, 12264312, 9266582, 17398215, 7136318, 1043284, 83815, 13640986, 6392035, 2453009, 15041788, 4752913, 8201396, 7550248, 4620522, 12232178, 16699501, 12305145, 4317341, 15964851, 15376693, 13884650, 11513357, 2161164, 4381810, 4867924, 2698972, 2300404, 7974130, 13033800, 6653131, 13266942, 2040489, 3162984, 16181397, 14606166, 14561572, 6187554, 6974335, 6569856, 16330971, 3177180, 4709388, 7590097, 2538340, 17456038, 16084654, 69365, 5173388, 1507333, 15272682, 10274219, 12732778, 12356294, 16117642, 5666886, 16817706, 15810675, 14732183, 1111531, 11489415, 1781555, 12535441, 5380706, 7195424, 536891, 7919717, 2142143, 1616633, 5676831, 8538781, 10459584, 16385475, 8230572, 10080013, 7052666, 7785169, 5575327, 15218449, 4328095, 13010576, 8964884, 1084636, 3965462, 3468879, 11186685, 2283645, 9721291, 10045132, 14666586, 15885627, 9261777, 8391927, 810936, 7907879, 8592681, 8979699, 5506981, 15705421, 8446673, 4024612, 6562940, 11116619, 13403708, 17457996, 9473453, 16928694, 1003189, 10081432, 17236143, 832726, 837702, 9607278, 1518395, 9981777, 7478611, 2298235, 13945547, 7341867, 12082224, 3797647, 5412262, 17425204, 3957823, 17589994, 15025271, 5258683, 9644779, 1697021, 3136245, 7993219, 6531052, 4359243, 8144640, 812803, 1871304, 9473475, 5741133, 3355857, 1259686, 17012456, 7897154, 5028199, 8217314, 3587592, 10136507, 3027818, 15434561, 14105712, 16296739, 8505957, 9509380, 6395531, 564740, 8556777, 16633416, 10008063, 6404316, 3204956, 7043890, 9384864, 4844618, 4430875, 11804570, 8255857, 2881077, 4113124, 13720277, 17087876, 7290119, 771265, 332885, 7803173, 1755064, 13719683, 1752965, 14301207, 9725754, 6372434, 11029708, 12044612, 15982149, 16417770, 10123497, 6464198, 4357252, 6705253, 17129002, 6741672, 3267227, 1208515, 3231420, 3618461, 14899578, 11527370, 11076143, 809638, 15542581, 10851517, 464283, 1071233, 4469632, 8073284, 15499364, 7913284, 1987549, 11501280, 645845, 23718, 17589676, 403570, 8121524, 12123115, 8136366, 11631912, 13145537, 15401171, 12922554, 17129267, 4232022, 15575927, 16776516, 12559700, 5355379, 16483740, 1196724, 12756691, 13894610, 15632112, 2369878, 3195056, 15961255, 8681124, 7142093, 16923620, 6802550, 9293274, 11200042, 7538367, 14624901, 9750692, 3092554, 16863420, 8661834, 12494752, 5934240, 12080658, 6650935, 7865784, 16987110, 7056066, 6860007, 473597, 8017315, 8230899, 16331467, 16979955, 4283492, 9557446, 3336314, 3019689, 14233956, 8825655, 13774901, 11808539, 8928822, 918977, 2791289, 11036209, 12360524, 5864303, 1684134, 5740472, 13275514, 17136086, 1536354, 2595240, 17197825, 1737330, 3671028, 6476975, 4790987, 7292899, 15366136, 10682996, 8761049, 16770851, 10315214, 16708204, 13390086, 14712924, 9894424, 1655133, 3248941, 7366721, 16251924, 7060547, 11667131, 9982808, 3370610, 1944050, 10900990, 13690849, 11320721, 11824073, 9203593, 7794101, 12812059, 571202, 2255262, 10360059, 2897849, 9631442, 3905070, 14798654, 3473941, 11489630, 185504, 4538998, 255451, 9850267, 632283, 2033678, 14808861, 5955417, 8154195, 17453847, 12168673, 10862871, 10381924, 1771462, 15460447, 4842245, 3282138, 9712255, 2795209, 10177002, 14776544, 14572749, 9917944, 14133172, 111780, 6717554, 12754941, 4516904, 3217851, 371459, 149008, 13474034, 15187551, 5495623, 7821882, 906584, 1049853, 14643726, 2813097, 12445854, 8887929, 15230590, 10784990, 1690623, 12158690, 271369, 8817337, 11702570, 744155, 14866729, 8547772, 2435843, 5627551, 13703923, 10605271, 8906175, 11780123, 17532291, 7875973, 10988764, 8207823, 7300759, 3477212, 14447774, 3730942, 8989736, 6271387, 3808432, 13731776, 14985803, 9069339, 3312546, 10856288, 16498541, 12738426, 557140, 11662038, 16627513, 5359679, 16350934, 968047, 537619, 2234480, 16201681, 15099715, 7240668, 11623700, 10069346, 9260267, 401068, 10856093, 1044687, 14327590, 3407688, 14446231, 3704784, 15505891, 12640814, 1062231, 15196404, 8822667, 16786929, 16084609, 1607114, 8857381, 14747003, 4552492, 15191944, 2153148, 7920421, 13913582, 13291033, 16222099, 395284, 7409658, 2877768, 2845668, 15729293, 623265, 3263577, 5832085, 4040644, 457946, 5523544, 12889242, 11547682, 15008853, 13688429, 7622761, 17529808, 9765198, 14766390, 11589343, 15715119, 14085054, 11981042, 3510830, 5486804, 4838252, 14813785, 5901757, 16946818, 6692990, 2179094, 3411986, 15330476, 56177, 7294847, 12222198, 9004707, 1896878, 170435, 5849163, 12649688, 2526880, 7170873, 17182960, 5107979, 12232505, 13533476, 10858414, 11003469, 15668130, 7277378, 17297174, 8404136, 7954659, 7065860, 16579783, 13887138, 6545952, 9640123, 6532095, 11782217, 10676754, 8986640, 11304326, 17374373, 11244208, 12801128, 13596568, 1905707, 15702091, 9041612, 5390925, 14549342, 1693007, 16530287, 3540018, 9867112, 13111442, 11246230, 7292865, 15022722, 5444029, 6364401, 13910498, 12221666, 15041058, 9126110, 8309023, 16067398, 16548759, 8595755, 15134321, 7221653, 9381454, 10855035, 10066236, 3779282, 7660780, 1158159, 7017486, 17565325, 13761399, 940250, 2946221, 9662951, 610879, 6779103, 3776076, 15731681, 2960760, 13372086, 16499085, 599769, 13847488, 14741844, 9493318, 10123009, 7758708, 16291820, 14833630, 9266582, 7136318, 83815, 6392035, 15041788, 8201396, 4620522, 16699501, 4317341, 15376693, 11513357, 4381810, 2698972, 7974130, 6653131, 2040489, 16181397, 14561572, 6974335, 16330971, 4709388, 2538340, 16084654, 5173388, 15272682, 12732778, 16117642, 16817706, 14732183, 11489415, 12535441, 7195424, 7919717, 1616633, 8538781, 16385475, 10080013, 7785169, 15218449, 13010576, 1084636, 3468879, 2283645, 10045132, 15885627, 8391927, 7907879, 8979699, 15705421, 4024612, 11116619, 17457996, 16928694, 10081432, 832726, 9607278, 9981777, 2298235, 7341867, 3797647, 17425204, 17589994, 5258683, 1697021, 7993219, 4359243, 812803, 9473475, 3355857, 17012456, 5028199, 3587592, 3027818, 14105712, 8505957, 6395531, 8556777, 10008063, 3204956, 9384864, 4430875, 8255857, 4113124, 17087876, 771265, 7803173, 13719683, 14301207, 6372434, 12044612, 16417770, 6464198, 6705253, 6741672, 1208515, 3618461, 11527370, 809638, 10851517, 1071233, 8073284, 7913284, 11501280, 23718, 403570, 12123115, 11631912, 15401171, 17129267, 15575927, 12559700, 16483740, 12756691, 15632112, 3195056, 8681124, 16923620, 9293274, 7538367, 9750692, 16863420, 12494752, 12080658, 7865784, 7056066, 473597, 8230899, 16979955, 9557446, 3019689, 8825655, 11808539, 918977, 11036209, 5864303, 5740472, 17136086, 2595240, 1737330, 6476975, 7292899, 10682996, 16770851, 16708204, 14712924, 1655133, 7366721, 7060547, 9982808, 1944050, 13690849, 11824073, 7794101, 571202, 10360059, 9631442, 14798654, 11489630, 4538998, 9850267, 2033678, 5955417, 17453847, 10862871, 1771462, 4842245, 9712255, 10177002, 14572749, 14133172, 6717554, 4516904, 371459, 13474034, 5495623, 906584, 14643726, 12445854, 15230590, 1690623, 271369, 11702570, 14866729, 2435843, 13703923, 8906175, 17532291, 10988764, 7300759, 14447774, 8989736, 3808432, 14985803, 3312546, 16498541, 557140, 16627513, 16350934, 537619, 16201681, 7240668, 10069346, 401068, 1044687, 3407688, 3704784, 12640814, 15196404, 16786929, 1607114, 14747003, 15191944, 7920421, 13291033, 395284, 2877768, 15729293, 3263577, 4040644, 5523544, 11547682, 13688429, 17529808, 14766390, 15715119, 11981042, 5486804, 14813785, 16946818, 2179094, 15330476, 7294847, 9004707, 170435, 12649688, 7170873, 5107979, 13533476, 11003469, 7277378, 8404136, 7065860, 13887138, 9640123, 11782217, 8986640, 17374373, 12801128, 1905707, 9041612, 14549342, 16530287, 9867112, 11246230, 15022722, 6364401, 12221666, 9126110, 16067398, 8595755, 7221653, 10855035, 3779282, 1158159, 17565325, 940250, 9662951, 6779103, 15731681, 13372086, 599769, 14741844, 10123009, 16291820, 9266582, 83815, 15041788, 4620522, 4317341, 11513357, 2698972, 6653131, 16181397, 6974335, 4709388, 16084654, 15272682, 16117642, 14732183, 12535441, 7919717, 8538781, 10080013, 15218449, 1084636, 2283645, 15885627, 7907879, 15705421, 11116619, 16928694, 832726, 9981777, 7341867, 17425204, 5258683, 7993219, 812803, 3355857, 5028199, 3027818, 8505957, 8556777, 3204956, 4430875, 4113124, 771265, 13719683, 6372434, 16417770, 6705253, 1208515, 11527370, 10851517, 8073284, 11501280, 403570, 11631912, 17129267, 12559700, 12756691, 3195056, 16923620, 7538367, 16863420, 12080658, 7056066, 8230899, 9557446, 8825655, 918977, 5864303, 17136086, 1737330, 7292899, 16770851, 14712924, 7366721, 9982808, 13690849, 7794101, 10360059, 14798654, 4538998, 2033678, 17453847, 1771462, 9712255, 14572749, 6717554, 371459, 5495623, 14643726, 15230590, 271369, 14866729, 13703923, 17532291, 7300759, 8989736, 14985803, 16498541, 16627513, 537619, 7240668, 401068, 3407688, 12640814, 16786929, 14747003, 7920421, 395284, 15729293, 4040644, 11547682, 17529808, 15715119, 5486804, 16946818, 15330476, 9004707, 12649688, 5107979, 11003469, 8404136, 13887138, 11782217, 17374373, 1905707, 14549342, 9867112, 15022722, 12221666, 16067398, 7221653, 3779282, 17565325, 9662951, 15731681, 599769, 10123009, 9266582, 15041788, 4317341, 2698972, 16181397, 4709388, 15272682, 14732183, 7919717, 10080013, 1084636, 15885627, 15705421, 16928694, 9981777, 17425204, 7993219, 3355857, 3027818, 8556777, 4430875, 771265, 6372434, 6705253, 11527370, 8073284, 403570, 17129267, 12756691, 16923620, 16863420, 7056066, 9557446, 918977, 17136086, 7292899, 14712924, 9982808, 7794101, 14798654, 2033678, 1771462, 14572749, 371459, 14643726, 271369, 13703923, 7300759, 14985803, 16627513, 7240668, 3407688, 16786929, 7920421, 15729293, 11547682, 15715119, 16946818, 9004707, 5107979, 8404136, 11782217, 1905707, 9867112, 12221666, 7221653, 17565325, 15731681, 10123009, 15041788, 2698972, 4709388, 14732183, 10080013, 15885627, 16928694, 17425204, 3355857, 8556777, 771265, 6705253, 8073284, 17129267, 16923620, 7056066, 918977, 7292899, 9982808, 14798654, 1771462, 371459, 271369, 7300759, 16627513, 3407688, 7920421, 11547682, 16946818, 5107979, 11782217, 9867112, 7221653, 15731681, 15041788, 4709388, 10080013, 16928694, 3355857, 771265, 8073284, 16923620, 918977, 9982808, 1771462, 271369, 16627513, 7920421, 16946818, 11782217, 7221653, 15041788, 10080013, 3355857, 8073284, 918977, 1771462, 16627513, 16946818, 7221653, 10080013, 8073284, 1771462, 16946818, 10080013, 8073284, 1771462, 16946818, 10080013, 1771462, 10080013, 1771462, 10080013, 1771462, 10080013, 1771462, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013};
+
+static const FFTSHORT W_bwd_avx2_2048_17633281[2064] = {10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 15861819, 10080013, 15861819, 10080013, 15861819, 10080013, 15861819, 10080013, 686463, 15861819, 9559997, 10080013, 686463, 15861819, 9559997, 10080013, 10411628, 686463, 1005768, 15861819, 16714304, 9559997, 14277424, 10080013, 2591493, 10411628, 5851064, 686463, 9712860, 1005768, 17361912, 15861819, 7650473, 16714304, 709661, 9559997, 16862016, 14277424, 704587, 10080013, 12923893, 2591493, 1901600, 10411628, 7766169, 5851064, 12525302, 686463, 6085599, 9712860, 14225593, 1005768, 10332522, 17361912, 17261822, 15861819, 2834627, 7650473, 10340382, 16714304, 10577215, 709661, 504014, 9559997, 10928028, 16862016, 9076504, 14277424, 208077, 704587, 1747654, 10080013, 2901098, 12923893, 14934309, 2591493, 7510272, 1901600, 67956, 10411628, 5411615, 7766169, 15727574, 5851064, 9229145, 12525302, 8628574, 686463, 1918162, 6085599, 1903988, 9712860, 846352, 14225593, 10392613, 1005768, 2647478, 10332522, 3929358, 17361912, 2989555, 17261822, 3060532, 15861819, 15599603, 2834627, 9839180, 7650473, 2920357, 10340382, 497195, 16714304, 8075835, 10577215, 769861, 709661, 4876590, 504014, 17229711, 9559997, 6105911, 10928028, 11260847, 16862016, 13202406, 9076504, 14605463, 14277424, 9640062, 208077, 7651504, 704587, 1927860, 1747654, 16548645, 10080013, 9713564, 2901098, 2360599, 12923893, 1451884, 14934309, 13315940, 2591493, 8366699, 7510272, 17033512, 1901600, 7970330, 67956, 13853999, 10411628, 1565883, 5411615, 2610559, 7766169, 3083939, 15727574, 258908, 5851064, 3746143, 9229145, 6629812, 12525302, 4983593, 8628574, 2302805, 686463, 12146477, 1918162, 103473, 6085599, 13592637, 1903988, 17237997, 9712860, 2886278, 846352, 4992467, 14225593, 17232213, 10392613, 17095662, 1005768, 1134740, 2647478, 8643545, 10332522, 100990, 3929358, 2766552, 17361912, 2402691, 2989555, 12137658, 17261822, 10915727, 3060532, 7921026, 15861819, 179434, 15599603, 13094283, 2834627, 7273222, 9839180, 3942432, 7650473, 10266560, 2920357, 862430, 10340382, 15895951, 497195, 11768978, 16714304, 8807626, 8075835, 9402382, 10577215, 5552623, 769861, 10094914, 709661, 14438225, 4876590, 5073581, 504014, 6001369, 17229711, 6132001, 9559997, 6781764, 6105911, 16424766, 10928028, 1215511, 11260847, 3913598, 16862016, 13520157, 13202406, 14428325, 9076504, 9127324, 14605463, 12605082, 14277424, 16820478, 9640062, 12374598, 208077, 10291414, 7651504, 16800555, 704587, 6516662, 1927860, 9725402, 1747654, 15349636, 16548645, 2414832, 10080013, 9094500, 9713564, 5097840, 2901098, 1515639, 2360599, 1548627, 12923893, 10658946, 1451884, 10980150, 14934309, 6119924, 13315940, 13012759, 2591493, 17549466, 8366699, 1341461, 7510272, 2891437, 17033512, 4261195, 1901600, 10854178, 7970330, 16693031, 67956, 16475122, 13853999, 6778246, 10411628, 9037526, 1565883, 8507171, 5411615, 11268880, 2610559, 6387051, 7766169, 1102994, 3083939, 8591669, 15727574, 4832153, 258908, 8646641, 5851064, 7993158, 3746143, 10567421, 9229145, 10355903, 6629812, 4099805, 12525302, 10462408, 4983593, 17462846, 8628574, 10338434, 2302805, 15454187, 686463, 2819496, 12146477, 5652239, 1918162, 2866891, 103473, 3944852, 6085599, 12109737, 13592637, 14369704, 1903988, 14755513, 17237997, 4342248, 9712860, 2441337, 2886278, 16026167, 846352, 2436877, 4992467, 13928497, 14225593, 16588594, 17232213, 7563935, 10392613, 1431600, 17095662, 1282347, 1005768, 17076141, 1134740, 14320735, 2647478, 13824849, 8643545, 3185507, 10332522, 6644517, 100990, 8727106, 3929358, 15197438, 2766552, 5930711, 17361912, 15942658, 2402691, 5187427, 2989555, 16726697, 12137658, 4159247, 17261822, 13116377, 10915727, 3500109, 3060532, 7456279, 7921026, 12791036, 15861819, 6770410, 179434, 11677864, 15599603, 7783014, 13094283, 6143651, 2834627, 8001839, 7273222, 17062079, 9839180, 5809208, 3942432, 15689231, 7650473, 10572734, 10266560, 15978148, 2920357, 925077, 862430, 6950285, 10340382, 11156306, 15895951, 15038041, 497195, 11892809, 11768978, 6597072, 16714304, 5824742, 8807626, 14613592, 8075835, 653326, 9402382, 17159684, 10577215, 9767497, 5552623, 5138529, 769861, 7882589, 10094914, 8340007, 709661, 8952157, 14438225, 2001169, 4876590, 1149541, 5073581, 2057354, 504014, 2232110, 6001369, 5510166, 17229711, 17609563, 6132001, 9719997, 9559997, 16562048, 6781764, 16823643, 6105911, 14014820, 16424766, 10891609, 10928028, 11169083, 1215511, 5588669, 11260847, 3332074, 3913598, 9830108, 16862016, 545405, 13520157, 9377424, 13202406, 8248417, 14428325, 7625218, 9076504, 11237750, 9127324, 3527569, 14605463, 14045689, 12605082, 620825, 14277424, 8159806, 16820478, 13274038, 9640062, 15936260, 12374598, 43287, 208077, 13835634, 10291414, 15335046, 7651504, 8026003, 16800555, 7551849, 704587, 175285, 6516662, 13608669, 1927860, 8653582, 9725402, 9241354, 1747654, 7588149, 15349636, 14164402, 16548645, 4622705, 2414832, 9848112, 10080013, 1247806, 9094500, 16016648, 9713564, 10437857, 5097840, 6143866, 2901098, 815575, 1515639, 4900503, 2360599, 12459893, 1548627, 15094941, 12923893, 1302310, 10658946, 3071709, 1451884, 15592792, 10980150, 9659151, 14934309, 13251471, 6119924, 2256588, 13315940, 933780, 13012759, 9431885, 2591493, 11241246, 17549466, 10496963, 8366699, 2799651, 1341461, 9874573, 7510272, 8139963, 2891437, 3785793, 17033512, 1134196, 4261195, 14672521, 1901600, 13857205, 10854178, 17022402, 7970330, 14687060, 16693031, 3871882, 67956, 10615795, 16475122, 9972501, 13853999, 7567045, 6778246, 8251827, 10411628, 2498960, 9037526, 1084522, 1565883, 9324258, 8507171, 2592223, 5411615, 3722783, 11268880, 12189252, 2610559, 10340416, 6387051, 4521839, 7766169, 14093263, 1102994, 15940274, 3083939, 12242356, 8591669, 1931190, 15727574, 4036713, 4832153, 6389073, 258908, 6328955, 8646641, 6956527, 5851064, 11101186, 7993158, 11087329, 3746143, 1053498, 10567421, 9678622, 9229145, 336107, 10355903, 1965151, 6629812, 6774867, 4099805, 5400776, 12525302, 450321, 10462408, 15106401, 4983593, 11784118, 17462846, 15736403, 8628574, 5411083, 10338434, 17577104, 2302805, 14221295, 15454187, 10940291, 686463, 11731524, 2819496, 12795029, 12146477, 14122451, 5652239, 3548227, 1918162, 6043938, 2866891, 7868083, 103473, 10010520, 3944852, 2624428, 6085599, 4744039, 12109737, 17175335, 13592637, 11801196, 14369704, 17010016, 1903988, 14787613, 14755513, 10223623, 17237997, 1411182, 4342248, 3719699, 9712860, 15480133, 2441337, 13080789, 2886278, 8775900, 16026167, 1548672, 846352, 8810614, 2436877, 16571050, 4992467, 2127390, 13928497, 3187050, 14225593, 3305691, 16588594, 6777188, 17232213, 8373014, 7563935, 6009581, 10392613, 2533566, 1431600, 15398801, 17095662, 16665234, 1282347, 12273602, 1005768, 5971243, 17076141, 4894855, 1134740, 6776993, 14320735, 8563942, 2647478, 3901505, 13824849, 11361894, 8643545, 13902339, 3185507, 14156069, 10332522, 9425458, 6644517, 9757308, 100990, 5853158, 8727106, 7028010, 3929358, 12005730, 15197438, 9085509, 2766552, 16889126, 5930711, 8815944, 17361912, 5474591, 15942658, 6848291, 2402691, 8745352, 5187427, 14820184, 2989555, 16583428, 16726697, 9811399, 12137658, 2445730, 4159247, 17484273, 17261822, 14415430, 13116377, 4878340, 10915727, 17521501, 3500109, 7715337, 3060532, 2856737, 7456279, 14838072, 7921026, 14351143, 12791036, 2172834, 15861819, 7251357, 6770410, 5464608, 179434, 9479086, 11677864, 2824420, 15599603, 17000998, 7783014, 17377830, 13094283, 17447777, 6143651, 14159340, 2834627, 13728211, 8001839, 14735432, 7273222, 15378019, 17062079, 4821222, 9839180, 8429688, 5809208, 6312560, 3942432, 6732291, 15689231, 14262671, 7650473, 5966150, 10572734, 1381357, 10266560, 14384340, 15978148, 7738857, 2920357, 4243195, 925077, 7318067, 862430, 8872232, 6950285, 2267145, 10340382, 12842294, 11156306, 13962253, 15895951, 435456, 15038041, 16096927, 497195, 4357767, 11892809, 15949147, 11768978, 5272757, 6597072, 14841992, 16714304, 8704459, 5824742, 3858380, 8807626, 3399325, 14613592, 14296967, 8075835, 13349789, 653326, 1301814, 9402382, 9615966, 17159684, 10773274, 10577215, 646171, 9767497, 10982346, 5552623, 11699041, 5138529, 8971447, 769861, 14540727, 7882589, 3008380, 10094914, 6433239, 8340007, 10830731, 709661, 10491188, 8952157, 1672026, 14438225, 15263403, 2001169, 3738671, 4876590, 16436557, 1149541, 12277902, 5073581, 856765, 2057354, 13401259, 504014, 4710727, 2232110, 4487744, 6001369, 9496915, 5510166, 9511757, 17229711, 43605, 17609563, 16987436, 6132001, 15645732, 9719997, 2133917, 9559997, 13163649, 16562048, 17168998, 6781764, 2090700, 16823643, 6557138, 6105911, 2733703, 14014820, 14401861, 16424766, 14366054, 10891609, 504279, 10928028, 13276029, 11169083, 7509784, 1215511, 1651132, 5588669, 6603573, 11260847, 7907527, 3332074, 15880316, 3913598, 15878217, 9830108, 17300396, 16862016, 10343162, 545405, 3913004, 13520157, 14752204, 9377424, 5828711, 13202406, 12788663, 8248417, 10589391, 14428325, 11228965, 7625218, 999865, 9076504, 17068541, 11237750, 8123901, 9127324, 1336542, 3527569, 2198720, 14605463, 7496774, 14045689, 9415967, 12605082, 9736127, 620825, 16373595, 14277424, 11892148, 8159806, 15761977, 16820478, 9488641, 13274038, 11102229, 9640062, 14497036, 15936260, 7988502, 12374598, 2608010, 43287, 13675458, 208077, 12221019, 13835634, 5551057, 10291414, 3687734, 15335046, 10154670, 7651504, 16114886, 8026003, 16795579, 16800555, 397138, 7551849, 16630092, 704587, 8159828, 175285, 4229573, 6516662, 11070341, 13608669, 9186608, 1927860, 12126300, 8653582, 9040600, 9725402, 16822345, 9241354, 8371504, 1747654, 2966695, 7588149, 7911990, 15349636, 6446596, 14164402, 13667819, 16548645, 8668397, 4622705, 13305186, 2414832, 12057954, 9848112, 10580615, 10080013, 9402709, 1247806, 7173697, 9094500, 11956450, 16016648, 15491138, 9713564, 17096390, 10437857, 12252575, 5097840, 15851726, 6143866, 16521750, 2901098, 1822606, 815575, 11966395, 1515639, 5276987, 4900503, 7359062, 2360599, 16125948, 12459893, 17563916, 1548627, 177243, 15094941, 10043184, 12923893, 14456101, 1302310, 11063425, 10658946, 11445727, 3071709, 3027115, 1451884, 14470297, 15592792, 4366339, 10980150, 4599481, 9659151, 15332877, 14934309, 12765357, 13251471, 15472117, 6119924, 3748631, 2256588, 1668430, 13315940, 5328136, 933780, 5401103, 13012759, 10083033, 9431885, 12880368, 2591493, 15180272, 11241246, 3992295, 17549466, 16589997, 10496963, 235066, 8366699, 5368969, 2799651, 12006386, 1341461, 8895928, 9874573, 5549541, 7510272, 8726049, 8139963, 15299910, 2891437, 5325994, 3785793, 6515949, 17033512, 4855710, 1134196, 15301478, 4261195, 5316649, 14672521, 14837244, 1901600, 12649161, 13857205, 8922384, 10854178, 6021628, 17022402, 9769775, 7970330, 1679809, 14687060, 1875359, 16693031, 2126876, 3871882, 7791400, 67956, 796650, 10615795, 8319629, 16475122, 6701300, 9972501, 1310731, 13853999, 4547318, 7567045, 12731119, 6778246, 9221129, 8251827, 1643401, 10411628, 16576825, 2498960, 4407009, 9037526, 3255015, 1084522, 831733, 1565883, 15431501, 9324258, 2101415, 8507171, 7706983, 2592223, 14603441, 5411615, 11759705, 3722783, 15482903, 11268880, 14862589, 12189252, 6751549, 2610559, 2192056, 10340416, 10236859, 6387051, 2989512, 4521839, 11781764, 7766169, 10077195, 14093263, 5200601, 1102994, 9231269, 15940274, 11974009, 3083939, 6648569, 12242356, 13196839, 8591669, 7075281, 1931190, 16321552, 15727574, 14823751, 4036713, 15012457, 4832153, 14989883, 6389073, 14966980, 258908, 1170037, 6328955, 3339109, 8646641, 4266548, 6956527, 13302378, 5851064, 16916048, 11101186, 11280661, 7993158, 6057599, 11087329, 4910914, 3746143, 14657592, 1053498, 16553775, 10567421, 6591103, 9678622, 11807486, 9229145, 1579576, 336107, 6330010, 10355903, 1791713, 1965151, 16322672, 6629812, 14817076, 6774867, 803918, 4099805, 7961433, 5400776, 5372404, 12525302, 11749754, 450321, 12314689, 10462408, 3988417, 15106401, 13306869, 4983593, 9096002, 11784118, 9867536, 17462846, 2907731, 15736403, 9513964, 8628574, 5329837, 5411083, 16962806, 10338434, 16827272, 17577104, 9920470, 2302805, 5898494, 14221295, 16643792, 15454187, 10384218, 10940291, 7857839, 686463, 10555566, 11731524, 15338396, 2819496, 17219505, 12795029, 1206511, 12146477, 12410691, 14122451, 17113543, 5652239, 8922826, 3548227, 10269874, 1918162, 11688109, 6043938, 9297122, 2866891, 13706977, 7868083, 10804870, 103473, 1887148, 10010520, 7960616, 3944852, 2307193, 2624428, 8842183, 6085599, 12875932, 4744039, 1666869, 12109737, 378079, 17175335, 3493277, 13592637, 16572695, 11801196, 3329543, 14369704, 10463720, 17010016, 2503381, 1903988, 15544938, 14787613, 6069831, 14755513, 14284414, 10223623, 14526969, 17237997, 4028584, 1411182, 15665241, 4342248, 12358927, 3719699, 13958367, 9712860, 647430, 15480133, 17080954, 2441337, 15808251, 13080789, 12608693, 2886278, 8218926, 8775900, 9112032, 16026167, 8669920, 1548672, 1228668, 846352, 8106479, 8810614, 9073716, 2436877, 17400037, 16571050, 8632333, 4992467, 4837640, 2127390, 15881492, 13928497, 17131550, 3187050, 77587, 14225593, 11266876, 3305691, 3699435, 16588594, 12982430, 6777188, 2134240, 17232213, 9951672, 8373014, 11852696, 7563935, 10599093, 6009581, 43462, 10392613, 13123375, 2533566, 1845273, 1431600, 16633224, 15398801, 3519841, 17095662, 11061418, 16665234, 5081368, 1282347, 3093236, 12273602, 2661827, 1005768, 12239028, 5971243, 3573423, 17076141, 13418559, 4894855, 16459790, 1134740, 10378757, 6776993, 15211346, 14320735, 12466300, 8563942, 11665323, 2647478, 773722, 3901505, 12234836, 13824849, 11155527, 11361894, 1607855, 8643545, 2461632, 13902339, 5481434, 3185507, 16925235, 14156069, 9100468, 10332522, 2126359, 9425458, 3779761, 6644517, 5733781, 9757308, 16444652, 100990, 14404977, 5853158, 12942515, 8727106, 15203487, 7028010, 8340978, 3929358, 10588784, 12005730, 3647302, 15197438, 6759373, 9085509, 13481107, 2766552, 14512615, 16889126, 16866772, 5930711, 8740417, 8815944, 10176199, 17361912, 7444475, 5474591, 1998341, 15942658, 14776326, 6848291, 5927421, 2402691, 12141792, 8745352, 689252, 5187427, 10691542, 14820184, 8860163, 2989555, 5526534, 16583428, 15711807, 16726697, 12868602, 9811399, 10684635, 12137658, 320847, 2445730, 12651010, 4159247, 3794564, 17484273, 9817718, 17261822, 14067998, 14415430, 3221569, 13116377, 15358106, 4878340, 885716, 10915727, 15818252, 17521501, 15619169, 3500109, 14522788, 7715337, 3817342, 3060532, 6375725, 2856737, 5691420, 7456279, 16775836, 14838072, 3614539, 7921026, 13488395, 14351143, 17617980, 12791036, 13709752, 2172834, 2050411, 15861819, 12734158, 7251357, 7392457, 6770410, 2465799, 5464608, 15611480, 179434, 13387813, 9479086, 4835030, 11677864, 13535447, 2824420, 8835798, 15599603, 4805825, 17000998, 3397183, 7783014, 15728438, 17377830, 9069644, 13094283, 10496945, 17447777, 3486166, 6143651, 11498275, 14159340, 14994259, 2834627, 456419, 13728211, 10268625, 8001839, 14923073, 14735432, 3557155, 7273222, 6903033, 15378019, 11680279, 17062079, 2258987, 4821222, 6453002, 9839180, 7356303, 8429688, 13544631, 5809208, 8781063, 6312560, 8202116, 3942432, 16297017, 6732291, 11112695, 15689231, 603606, 14262671, 13563577, 7650473, 4732148, 5966150, 8008445, 10572734, 7296381, 1381357, 6502075, 10266560, 12652957, 14384340, 17401521, 15978148, 15235969, 7738857, 6730431, 2920357, 10977116, 4243195, 7945393, 925077, 13654880, 7318067, 14342879, 862430, 13470048, 8872232, 2849244, 6950285, 8524296, 2267145, 1466801, 10340382, 9442449, 12842294, 12289814, 11156306, 11929948, 13962253, 12342845, 15895951, 16730693, 435456, 26303, 15038041, 3070759, 16096927, 4448906, 497195, 14262277, 4357767, 4661461, 11892809, 10240287, 15949147, 7692282, 11768978, 8787056, 5272757, 11866239, 6597072, 8078059, 14841992, 7038934, 16714304, 5438653, 8704459, 15054762, 5824742, 1434072, 3858380, 9716228, 8807626, 9792220, 3399325, 4931001, 14613592, 13357077, 14296967, 3758691, 8075835, 15778075, 13349789, 2712376, 653326, 12173925, 1301814, 17107666, 9402382, 11240732, 9615966, 11412369, 17159684, 8106563, 10773274, 2460735, 10577215, 6195260, 646171, 3696879, 9767497, 7644703, 10982346, 3009178, 5552623, 8988078, 11699041, 14604184, 5138529, 14353037, 8971447, 11047908, 769861, 1855645, 14540727, 3661328, 7882589, 14705221, 3008380, 4540634, 10094914, 4898954, 6433239, 6541991, 8340007, 16508505, 10830731, 4814184, 709661, 5945125, 10491188, 6368439, 8952157, 1169083, 1672026, 9170075, 14438225, 6828314, 15263403, 13936151, 2001169, 11485754, 3738671, 16407122, 4876590, 12896809, 16436557, 4927406, 1149541, 3538502, 12277902, 14964922, 5073581, 13305183, 856765, 4540290, 2057354, 1752204, 13401259, 6245818, 504014, 14888683, 4710727, 16829634, 2232110, 11638233, 4487744, 8649734, 6001369, 2136173, 9496915, 15844152, 5510166, 4444009, 9511757, 9961862, 17229711, 4392285, 43605, 13733808, 17609563, 10093922, 16987436, 3920111, 6132001, 3795240, 15645732, 6979769, 9719997, 8703906, 2133917, 9685318, 9559997, 8559478, 13163649, 8971683, 16562048, 9899975, 17168998, 14128801, 6781764, 3252794, 2090700, 5017130, 16823643, 3318643, 6557138, 9584042, 6105911, 11367225, 2733703, 5226813, 14014820, 6241130, 14401861, 3580942, 16424766, 11563187, 14366054, 13347875, 10891609, 16566174, 504279, 3447127, 10928028, 3465340, 13276029, 7371514, 11169083, 10698776, 7509784, 14957210, 1215511, 10832105, 1651132, 14713633, 5588669, 4805380, 6603573, 1274395, 11260847, 3504354, 7907527, 15483318, 3332074, 2973395, 15880316, 4084538, 3913598, 12655285, 15878217, 7941246, 9830108, 6988395, 17300396, 16052177, 16862016, 606457, 10343162, 3864025, 545405, 12158943, 3913004, 16409756, 13520157, 15872471, 14752204, 7502753, 9377424, 9995335, 5828711, 6003352, 13202406, 15231657, 12788663, 11164450, 8248417, 10135156, 10589391, 8555004, 14428325, 4747467, 11228965, 16812507, 7625218, 14180627, 999865, 15381681, 9076504, 14678654, 17068541, 12177369, 11237750, 10474660, 8123901, 10310181, 9127324, 3024846, 1336542, 17396460, 3527569, 3694291, 2198720, 7345247, 14605463, 17389083, 7496774, 10744337, 14045689, 4530794, 9415967, 11255199, 12605082, 6681668, 9736127, 15282455, 620825, 11019143, 16373595, 15015880, 14277424, 5601802, 11892148, 12429303, 8159806, 2833018, 15761977, 7518920, 16820478, 17534823, 9488641, 16488233, 13274038, 13751642, 11102229, 383794, 9640062, 10150417, 14497036, 5551411, 15936260, 6353304, 7988502, 3069845, 12374598, 17206994, 2608010, 13167795, 43287, 6303738, 13675458, 12024450, 208077, 12566830, 12221019, 8389702, 13835634, 16281118, 5551057, 7665050, 10291414, 11468394, 3687734, 7693944, 15335046, 12713151, 10154670, 8068695, 7651504, 11188182, 16114886, 862197, 8026003, 15249941, 16795579, 34680, 16800555, 10499234, 397138, 4023564, 7551849, 10342199, 16630092, 12752745, 704587, 10824082, 8159828, 3347048, 175285, 4612833, 4229573, 7066421, 6516662, 16059476, 11070341, 13551757, 13608669, 3228193, 9186608, 12799588, 1927860, 9049226, 12126300, 17073673, 8653582, 7743484, 9040600, 4545901, 9725402, 11558764, 16822345, 8257435, 9241354, 4710365, 8371504, 11838108, 1747654, 12890195, 2966695, 401064, 7588149, 12094211, 7911990, 13961627, 15349636, 942881, 6446596, 1229238, 14164402, 9834922, 13667819, 9872025, 16548645, 14137938, 8668397, 1230339, 4622705, 5656200, 13305186, 926860, 2414832, 13683761, 12057954, 7164673, 9848112, 4453111, 10580615, 15103136};
+
+/* N = 1024, Q = 8816641 */
+
+static const FFTSHORT W_fwd_avx2_1024_8816641[1040] = {1263129, 242608, 8094545, 3207492, 3136587, 7025347, 7487634, 133141, 6611447, 1085024, 2032155, 677234, 6849771, 1332758, 1219794, 1643819, 6235870, 5595111, 4544385, 16285, 540546, 2197927, 4779091, 5824800, 5038774, 4814066, 4381604, 6881700, 6613300, 6193428, 4295701, 1825766, 2177088, 5491767, 3687899, 3213265, 4130559, 5879302, 2496649, 1586243, 8477809, 1209099, 4052650, 4776163, 1844716, 8737091, 4145911, 345812, 281334, 8004284, 4489043, 3440074, 7647796, 1306613, 2211663, 4468411, 5698811, 1500557, 4957440, 7305807, 4065971, 4901067, 6521749, 12322, 6463439, 8314652, 3179179, 8167317, 7939098, 5901797, 5335820, 6907004, 1214160, 4030609, 4987130, 2593106, 7907996, 1516564, 7553103, 5476663, 7197760, 1092441, 4827241, 8186406, 246581, 2161156, 2817384, 8791786, 8454526, 960341, 2413145, 6355616, 8632668, 895287, 5450680, 966281, 4995162, 4742688, 1713512, 1855897, 2291498, 23364, 5453725, 6586890, 7463441, 839519, 4031614, 3932282, 628129, 5490533, 1456449, 116679, 4493352, 2444004, 3942589, 389871, 1646869, 3034590, 6518378, 7077180, 4220235, 5211767, 6626746, 6187132, 5613998, 4117200, 7557611, 7798379, 190906, 7697790, 5259413, 5990694, 1959267, 8410679, 1135619, 1827489, 7421940, 3842420, 5017546, 2408380, 2540319, 8650057, 3803731, 6832300, 5563694, 489776, 2586273, 8026600, 3989436, 5882434, 972630, 1857908, 5470737, 8127705, 3669320, 1553845, 162873, 3617991, 7818902, 3336560, 6969742, 4134155, 7394925, 5747441, 3358355, 1726992, 5340571, 7210339, 232820, 2498076, 1851792, 6600106, 7698553, 2695240, 1217857, 1913566, 7005259, 3885404, 7511401, 3400549, 5050031, 3578688, 6751454, 5779902, 1027197, 8064200, 8607681, 7725032, 4879461, 6276140, 7410924, 1298188, 2237902, 6904536, 5567901, 6654078, 5712716, 4539151, 1983235, 7940461, 2707864, 311004, 3312575, 5694475, 761638, 1135758, 5208251, 5027155, 4666071, 1017618, 5775021, 860310, 5132647, 1504688, 5911527, 3939853, 6788233, 5969884, 6168161, 2602693, 8425450, 8555244, 8099733, 4815480, 6424126, 7257700, 8712545, 6986126, 8097447, 1924881, 3945676, 7729725, 7007001, 3820329, 5280993, 973608, 7884712, 4795512, 2695944, 4005595, 1265245, 3311639, 1386916, 4328716, 2439786, 1316489, 5952439, 6845151, 6181910, 515040, 6045758, 590595, 6092999, 379631, 3578132, 2045047, 6542401, 6549234, 6430630, 3957758, 5628427, 1315819, 6655671, 2277375, 7793552, 3493997, 2186733, 4185016, 3384409, 4357293, 658618, 3465858, 1744848, 705539, 3590766, 1127698, 4851386, 477096, 7078560, 2771787, 1987223, 1991328, 6499361, 7640813, 1582657, 6951690, 3684924, 6335825, 6482035, 2902916, 130496, 570998, 7265400, 630625, 8160716, 760882, 5455912, 6054743, 8793221, 6948350, 7190588, 6856844, 962250, 3936115, 3658325, 4277556, 3237476, 1641960, 4660420, 1658923, 2726009, 7715935, 3847703, 6525822, 2790614, 1623014, 1622875, 7058754, 636898, 8629888, 3813175, 446534, 2126543, 5643953, 7942996, 47128, 1670969, 4189153, 805542, 2663981, 4050724, 1507708, 2741735, 5316551, 5971808, 7675387, 4087007, 5744948, 7738336, 3258880, 336260, 8543785, 7783802, 4910956, 8485552, 135359, 2520106, 5179027, 5724086, 1421840, 6465706, 7698537, 6238690, 2635239, 6005076, 6260530, 6161898, 2123025, 2283133, 8803268, 6982988, 4337779, 8797215, 6282904, 3838086, 6039856, 5022006, 6543805, 8602252, 1080013, 2001716, 2649429, 8744534, 3387051, 3347578, 2458562, 4532466, 183170, 1710870, 2865612, 491554, 7773397, 7015403, 5581559, 8188595, 1475663, 1109603, 6210616, 2125130, 73725, 1968009, 998404, 4782097, 7959687, 5451521, 5373552, 4333389, 4588318, 5040726, 4528575, 7793820, 1449376, 487187, 1777031, 429498, 5900903, 2747506, 4549294, 7207096, 5400001, 6549098, 1283391, 7188864, 5139698, 8210584, 8372588, 559384, 7112157, 4538268, 4673360, 5710381, 6989967, 539277, 3213, 3680948, 5219050, 6035822, 5729436, 4623121, 2014733, 8383396, 5085261, 1867844, 331896, 780942, 2034218, 5565222, 5939300, 8292548, 5219599, 169607, 76641, 4197360, 2771444, 4110564, 416131, 534296, 8757927, 5199712, 1646392, 1771921, 5792954, 6724428, 2406484, 8057017, 277004, 3732411, 2340003, 2012362, 5582013, 2422092, 7544814, 1833500, 6402779, 1450260, 3085997, 7224765, 8014557, 759815, 4812507, 2491274, 7227843, 3020560, 3610984, 4593480, 1386019, 3506879, 8062396, 6974503, 4426994, 3323561, 8270195, 3994713, 2107023, 8498863, 270759, 1470522, 1215612, 4269918, 4201008, 5995816, 7163185, 2115797, 2816329, 1082473, 8236341, 734651, 1248062, 5476962, 1593945, 2157118, 2356, 2817127, 7298205, 1465061, 1657493, 4226937, 8757317, 5839968, 4988395, 1265362, 4952164, 1263129, 8094545, 3136587, 7487634, 6611447, 2032155, 6849771, 1219794, 6235870, 4544385, 540546, 4779091, 5038774, 4381604, 6613300, 4295701, 2177088, 3687899, 4130559, 2496649, 8477809, 4052650, 1844716, 4145911, 281334, 4489043, 7647796, 2211663, 5698811, 4957440, 4065971, 6521749, 6463439, 3179179, 7939098, 5335820, 1214160, 4987130, 7907996, 7553103, 7197760, 4827241, 246581, 2817384, 8454526, 2413145, 8632668, 5450680, 4995162, 1713512, 2291498, 5453725, 7463441, 4031614, 628129, 1456449, 4493352, 3942589, 1646869, 6518378, 4220235, 6626746, 5613998, 7557611, 190906, 5259413, 1959267, 1135619, 7421940, 5017546, 2540319, 3803731, 5563694, 2586273, 3989436, 972630, 5470737, 3669320, 162873, 7818902, 6969742, 7394925, 3358355, 5340571, 232820, 1851792, 7698553, 1217857, 7005259, 7511401, 5050031, 6751454, 1027197, 8607681, 4879461, 7410924, 2237902, 5567901, 5712716, 1983235, 2707864, 3312575, 761638, 5208251, 4666071, 5775021, 5132647, 5911527, 6788233, 6168161, 8425450, 8099733, 6424126, 8712545, 8097447, 3945676, 7007001, 5280993, 7884712, 2695944, 1265245, 1386916, 2439786, 5952439, 6181910, 6045758, 6092999, 3578132, 6542401, 6430630, 5628427, 6655671, 7793552, 2186733, 3384409, 658618, 1744848, 3590766, 4851386, 7078560, 1987223, 6499361, 1582657, 3684924, 6482035, 130496, 7265400, 8160716, 5455912, 8793221, 7190588, 962250, 3658325, 3237476, 4660420, 2726009, 3847703, 2790614, 1622875, 636898, 3813175, 2126543, 7942996, 1670969, 805542, 4050724, 2741735, 5971808, 4087007, 7738336, 336260, 7783802, 8485552, 2520106, 5724086, 6465706, 6238690, 6005076, 6161898, 2283133, 6982988, 8797215, 3838086, 5022006, 8602252, 2001716, 8744534, 3347578, 4532466, 1710870, 491554, 7015403, 8188595, 1109603, 2125130, 1968009, 4782097, 5451521, 4333389, 5040726, 7793820, 487187, 429498, 2747506, 7207096, 6549098, 7188864, 8210584, 559384, 4538268, 5710381, 539277, 3680948, 6035822, 4623121, 8383396, 1867844, 780942, 5565222, 8292548, 169607, 4197360, 4110564, 534296, 5199712, 1771921, 6724428, 8057017, 3732411, 2012362, 2422092, 1833500, 1450260, 7224765, 759815, 2491274, 3020560, 4593480, 3506879, 6974503, 3323561, 3994713, 8498863, 1470522, 4269918, 5995816, 2115797, 1082473, 734651, 5476962, 2157118, 2817127, 1465061, 4226937, 5839968, 1265362, 1263129, 3136587, 6611447, 6849771, 6235870, 540546, 5038774, 6613300, 2177088, 4130559, 8477809, 1844716, 281334, 7647796, 5698811, 4065971, 6463439, 7939098, 1214160, 7907996, 7197760, 246581, 8454526, 8632668, 4995162, 2291498, 7463441, 628129, 4493352, 1646869, 4220235, 5613998, 190906, 1959267, 7421940, 2540319, 5563694, 3989436, 5470737, 162873, 6969742, 3358355, 232820, 7698553, 7005259, 5050031, 1027197, 4879461, 2237902, 5712716, 2707864, 761638, 4666071, 5132647, 6788233, 8425450, 6424126, 8097447, 7007001, 7884712, 1265245, 2439786, 6181910, 6092999, 6542401, 5628427, 7793552, 3384409, 1744848, 4851386, 1987223, 1582657, 6482035, 7265400, 5455912, 7190588, 3658325, 4660420, 3847703, 1622875, 3813175, 7942996, 805542, 2741735, 4087007, 336260, 8485552, 5724086, 6238690, 6161898, 6982988, 3838086, 8602252, 8744534, 4532466, 491554, 8188595, 2125130, 4782097, 4333389, 7793820, 429498, 7207096, 7188864, 559384, 5710381, 3680948, 4623121, 1867844, 5565222, 169607, 4110564, 5199712, 6724428, 3732411, 2422092, 1450260, 759815, 3020560, 3506879, 3323561, 8498863, 4269918, 2115797, 734651, 2157118, 1465061, 5839968, 1263129, 6611447, 6235870, 5038774, 2177088, 8477809, 281334, 5698811, 6463439, 1214160, 7197760, 8454526, 4995162, 7463441, 4493352, 4220235, 190906, 7421940, 5563694, 5470737, 6969742, 232820, 7005259, 1027197, 2237902, 2707864, 4666071, 6788233, 6424126, 7007001, 1265245, 6181910, 6542401, 7793552, 1744848, 1987223, 6482035, 5455912, 3658325, 3847703, 3813175, 805542, 4087007, 8485552, 6238690, 6982988, 8602252, 4532466, 8188595, 4782097, 7793820, 7207096, 559384, 3680948, 1867844, 169607, 5199712, 3732411, 1450260, 3020560, 3323561, 4269918, 734651, 1465061, 1263129, 6235870, 2177088, 281334, 6463439, 7197760, 4995162, 4493352, 190906, 5563694, 6969742, 7005259, 2237902, 4666071, 6424126, 1265245, 6542401, 1744848, 6482035, 3658325, 3813175, 4087007, 6238690, 8602252, 8188595, 7793820, 559384, 1867844, 5199712, 1450260, 3323561, 734651, 1263129, 2177088, 6463439, 4995162, 190906, 6969742, 2237902, 6424126, 6542401, 6482035, 3813175, 6238690, 8188595, 559384, 5199712, 3323561, 1263129, 6463439, 190906, 2237902, 6542401, 3813175, 8188595, 5199712, 1263129, 190906, 6542401, 8188595, 1263129, 190906, 6542401, 8188595, 1263129, 6542401, 1263129, 6542401, 1263129, 6542401, 1263129, 6542401, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129};
+
+static const FFTSHORT W_bwd_avx2_1024_8816641[1040] = {1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 1263129, 2274240, 1263129, 2274240, 1263129, 2274240, 1263129, 2274240, 1263129, 628046, 2274240, 8625735, 1263129, 628046, 2274240, 8625735, 1263129, 3616929, 628046, 5003466, 2274240, 6578739, 8625735, 2353202, 1263129, 5493080, 3616929, 8257257, 628046, 2577951, 5003466, 2334606, 2274240, 2392515, 6578739, 1846899, 8625735, 3821479, 2353202, 6639553, 1263129, 8081990, 5493080, 7366381, 3616929, 6948797, 8257257, 1022821, 628046, 214389, 2577951, 4729634, 5003466, 5158316, 2334606, 7071793, 2274240, 7551396, 2392515, 4150570, 6578739, 1811382, 1846899, 3252947, 8625735, 4323289, 3821479, 1618881, 2353202, 8535307, 6639553, 2580771, 1263129, 7351580, 8081990, 4546723, 5493080, 5796081, 7366381, 5084230, 3616929, 8647034, 6948797, 5135693, 8257257, 1609545, 1022821, 4034544, 628046, 4284175, 214389, 1833653, 2577951, 331089, 4729634, 8011099, 5003466, 4968938, 5158316, 3360729, 2334606, 6829418, 7071793, 1023089, 2274240, 2634731, 7551396, 1809640, 2392515, 2028408, 4150570, 6108777, 6578739, 7789444, 1811382, 8583821, 1846899, 3345904, 3252947, 1394701, 8625735, 4596406, 4323289, 1353200, 3821479, 362115, 1618881, 7602481, 2353202, 3117830, 8535307, 338832, 6639553, 3777867, 2580771, 2205194, 1263129, 2976673, 7351580, 6659523, 8081990, 6700844, 4546723, 317778, 5493080, 5309762, 5796081, 8056826, 7366381, 6394549, 5084230, 2092213, 3616929, 4706077, 8647034, 3251419, 6948797, 4193520, 5135693, 3106260, 8257257, 1627777, 1609545, 8387143, 1022821, 4483252, 4034544, 6691511, 628046, 8325087, 4284175, 72107, 214389, 4978555, 1833653, 2654743, 2577951, 3092555, 331089, 8480381, 4729634, 6074906, 8011099, 873645, 5003466, 7193766, 4968938, 4156221, 5158316, 1626053, 3360729, 1551241, 2334606, 7233984, 6829418, 3965255, 7071793, 5432232, 1023089, 3188214, 2274240, 2723642, 2634731, 6376855, 7551396, 931929, 1809640, 719194, 2392515, 391191, 2028408, 3683994, 4150570, 8055003, 6108777, 3103925, 6578739, 3937180, 7789444, 3766610, 1811382, 1118088, 8583821, 5458286, 1846899, 8653768, 3345904, 4827205, 3252947, 6276322, 1394701, 6857374, 8625735, 3202643, 4596406, 7169772, 4323289, 8188512, 1353200, 6525143, 3821479, 183973, 362115, 8570060, 1618881, 908645, 7602481, 877543, 2353202, 4750670, 3117830, 1168845, 8535307, 6971925, 338832, 4686082, 6639553, 2203341, 3777867, 8276095, 2580771, 1966870, 2205194, 5680054, 1263129, 7551279, 2976673, 4589704, 7351580, 5999514, 6659523, 3339679, 8081990, 7734168, 6700844, 2820825, 4546723, 7346119, 317778, 4821928, 5493080, 1842138, 5309762, 4223161, 5796081, 6325367, 8056826, 1591876, 7366381, 6983141, 6394549, 6804279, 5084230, 759624, 2092213, 7044720, 3616929, 8282345, 4706077, 4619281, 8647034, 524093, 3251419, 8035699, 6948797, 433245, 4193520, 2780819, 5135693, 8277364, 3106260, 4278373, 8257257, 606057, 1627777, 2267543, 1609545, 6069135, 8387143, 8329454, 1022821, 3775915, 4483252, 3365120, 4034544, 6848632, 6691511, 7707038, 628046, 1801238, 8325087, 7105771, 4284175, 5469063, 72107, 6814925, 214389, 3794635, 4978555, 19426, 1833653, 6533508, 2654743, 2811565, 2577951, 2350935, 3092555, 6296535, 331089, 1032839, 8480381, 1078305, 4729634, 2844833, 6074906, 4765917, 8011099, 7145672, 873645, 6690098, 5003466, 8179743, 7193766, 6026027, 4968938, 6090632, 4156221, 5579165, 5158316, 7854391, 1626053, 23420, 3360729, 655925, 1551241, 8686145, 2334606, 5131717, 7233984, 2317280, 6829418, 1738081, 3965255, 5225875, 7071793, 8158023, 5432232, 6629908, 1023089, 2160970, 3188214, 2386011, 2274240, 5238509, 2723642, 2770883, 2634731, 2864202, 6376855, 7429725, 7551396, 6120697, 931929, 3535648, 1809640, 4870965, 719194, 104096, 2392515, 716908, 391191, 2648480, 2028408, 2905114, 3683994, 3041620, 4150570, 3608390, 8055003, 5504066, 6108777, 6833406, 3103925, 3248740, 6578739, 1405717, 3937180, 208960, 7789444, 2065187, 3766610, 1305240, 1811382, 7598784, 1118088, 6964849, 8583821, 3476070, 5458286, 1421716, 1846899, 997739, 8653768, 5147321, 3345904, 7844011, 4827205, 6230368, 3252947, 5012910, 6276322, 3799095, 1394701, 7681022, 6857374, 3557228, 8625735, 1259030, 3202643, 2189895, 4596406, 2298263, 7169772, 4874052, 4323289, 7360192, 8188512, 4785027, 1353200, 3362916, 6525143, 7103129, 3821479, 3365961, 183973, 6403496, 362115, 5999257, 8570060, 3989400, 1618881, 1263538, 908645, 3829511, 7602481, 3480821, 877543, 5637462, 2353202, 2294892, 4750670, 3859201, 3117830, 6604978, 1168845, 4327598, 8535307, 4670730, 6971925, 4763991, 338832, 6319992, 4686082, 5128742, 6639553, 4520940, 2203341, 4435037, 3777867, 4037550, 8276095, 4272256, 2580771, 7596847, 1966870, 6784486, 2205194, 1329007, 5680054, 722096, 1263129, 3864477, 7551279, 3828246, 2976673, 59324, 4589704, 7159148, 7351580, 1518436, 5999514, 8814285, 6659523, 7222696, 3339679, 7568579, 8081990, 580300, 7734168, 6000312, 6700844, 1653456, 2820825, 4615633, 4546723, 7601029, 7346119, 8545882, 317778, 6709618, 4821928, 546446, 5493080, 4389647, 1842138, 754245, 5309762, 7430622, 4223161, 5205657, 5796081, 1588798, 6325367, 4004134, 8056826, 802084, 1591876, 5730644, 7366381, 2413862, 6983141, 1271827, 6394549, 3234628, 6804279, 6476638, 5084230, 8539637, 759624, 6410157, 2092213, 3023687, 7044720, 7170249, 3616929, 58714, 8282345, 8400510, 4706077, 6045197, 4619281, 8740000, 8647034, 3597042, 524093, 2877341, 3251419, 6782423, 8035699, 8484745, 6948797, 3731380, 433245, 6801908, 4193520, 3087205, 2780819, 3597591, 5135693, 8813428, 8277364, 1826674, 3106260, 4143281, 4278373, 1704484, 8257257, 444053, 606057, 3676943, 1627777, 7533250, 2267543, 3416640, 1609545, 4267347, 6069135, 2915738, 8387143, 7039610, 8329454, 7367265, 1022821, 4288066, 3775915, 4228323, 4483252, 3443089, 3365120, 856954, 4034544, 7818237, 6848632, 8742916, 6691511, 2606025, 7707038, 7340978, 628046, 3235082, 1801238, 1043244, 8325087, 5951029, 7105771, 8633471, 4284175, 6358079, 5469063, 5429590, 72107, 6167212, 6814925, 7736628, 214389, 2272836, 3794635, 2776785, 4978555, 2533737, 19426, 4478862, 1833653, 13373, 6533508, 6693616, 2654743, 2556111, 2811565, 6181402, 2577951, 1118104, 2350935, 7394801, 3092555, 3637614, 6296535, 8681282, 331089, 3905685, 1032839, 272856, 8480381, 5557761, 1078305, 3071693, 4729634, 1141254, 2844833, 3500090, 6074906, 7308933, 4765917, 6152660, 8011099, 4627488, 7145672, 8769513, 873645, 3172688, 6690098, 8370107, 5003466, 186753, 8179743, 1757887, 7193766, 7193627, 6026027, 2290819, 4968938, 1100706, 6090632, 7157718, 4156221, 7174681, 5579165, 4539085, 5158316, 4880526, 7854391, 1959797, 1626053, 1868291, 23420, 2761898, 3360729, 8055759, 655925, 8186016, 1551241, 8245643, 8686145, 5913725, 2334606, 2480816, 5131717, 1864951, 7233984, 1175828, 2317280, 6825313, 6829418, 6044854, 1738081, 8339545, 3965255, 7688943, 5225875, 8111102, 7071793, 5350783, 8158023, 4459348, 5432232, 4631625, 6629908, 5322644, 1023089, 6539266, 2160970, 7500822, 3188214, 4858883, 2386011, 2267407, 2274240, 6771594, 5238509, 8437010, 2723642, 8226046, 2770883, 8301601, 2634731, 1971490, 2864202, 7500152, 6376855, 4487925, 7429725, 5505002, 7551396, 4811046, 6120697, 4021129, 931929, 7843033, 3535648, 4996312, 1809640, 1086916, 4870965, 6891760, 719194, 1830515, 104096, 1558941, 2392515, 4001161, 716908, 261397, 391191, 6213948, 2648480, 2846757, 2028408, 4876788, 2905114, 7311953, 3683994, 7956331, 3041620, 7799023, 4150570, 3789486, 3608390, 7680883, 8055003, 3122166, 5504066, 8505637, 6108777, 876180, 6833406, 4277490, 3103925, 2162563, 3248740, 1912105, 6578739, 7518453, 1405717, 2540501, 3937180, 1091609, 208960, 752441, 7789444, 3036739, 2065187, 5237953, 3766610, 5416092, 1305240, 4931237, 1811382, 6903075, 7598784, 6121401, 1118088, 2216535, 6964849, 6318565, 8583821, 1606302, 3476070, 7089649, 5458286, 3069200, 1421716, 4682486, 1846899, 5480081, 997739, 5198650, 8653768, 7262796, 5147321, 688936, 3345904, 6958733, 7844011, 2934207, 4827205, 790041, 6230368, 8326865, 3252947, 1984341, 5012910, 166584, 6276322, 6408261, 3799095, 4974221, 1394701, 6989152, 7681022, 405962, 6857374, 2825947, 3557228, 1118851, 8625735, 1018262, 1259030, 4699441, 3202643, 2629509, 2189895, 3604874, 4596406, 1739461, 2298263, 5782051, 7169772, 8426770, 4874052, 6372637, 4323289, 8699962, 7360192, 3326108, 8188512, 4884359, 4785027, 7977122, 1353200, 2229751, 3362916, 8793277, 6525143, 6960744, 7103129, 4073953, 3821479, 7850360, 3365961, 7921354, 183973, 2461025, 6403496, 7856300, 362115, 24855, 5999257, 6655485, 8570060, 630235, 3989400, 7724200, 1618881, 3339978, 1263538, 7300077, 908645, 6223535, 3829511, 4786032, 7602481, 1909637, 3480821, 2914844, 877543, 649324, 5637462, 501989, 2353202, 8804319, 2294892, 3915574, 4750670, 1510834, 3859201, 7316084, 3117830, 4348230, 6604978, 7510028, 1168845, 5376567, 4327598, 812357, 8535307, 8470829, 4670730, 79550, 6971925, 4040478, 4763991, 7607542, 338832, 7230398, 6319992, 2937339, 4686082, 5603376, 5128742, 3324874, 6639553, 6990875, 4520940, 2623213, 2203341, 1934941, 4435037, 4002575, 3777867, 2991841, 4037550, 6618714, 8276095, 8800356, 4272256, 3221530, 2580771, 7172822, 7596847, 7483883, 1966870, 8139407, 6784486, 7731617, 2205194, 8683500, 1329007, 1791294, 5680054, 5609149, 722096, 8574033};
+
+/* N = 1024, Q = 17633281 */
+
+static const FFTSHORT W_fwd_avx2_1024_17633281[1040] = {10080013, 1693007, 16026167, 14776544, 9402382, 332885, 7588149, 9324258, 15729293, 9811399, 11036209, 13276029, 11116619, 13761399, 2866891, 744155, 10340382, 464283, 15335046, 8139963, 15330476, 14156069, 7060547, 9496915, 7993219, 15376693, 4099805, 11662038, 7273222, 13894610, 14045689, 12459893, 11782217, 6777188, 5955417, 14540727, 3204956, 10580615, 1102994, 8857381, 3060532, 16331467, 9830108, 14666586, 16067398, 17010016, 906584, 5272757, 6705253, 4229573, 16693031, 11589343, 2766552, 15366136, 16562048, 13945547, 10123009, 17577104, 14447774, 5966150, 11631912, 11102229, 6119924, 10858414, 1005768, 2897849, 2001169, 10136507, 15272682, 6956527, 1044687, 9479086, 16863420, 10589391, 7785169, 3540018, 2886278, 9917944, 653326, 1755064, 1747654, 1084522, 3263577, 16583428, 5864303, 504279, 17457996, 2946221, 1918162, 8547772, 6950285, 4469632, 10291414, 9874573, 7294847, 13902339, 9982808, 4487744, 4359243, 4381810, 6629812, 5359679, 8001839, 2369878, 14605463, 4900503, 8986640, 3305691, 17453847, 8971447, 9384864, 12057954, 7766169, 4552492, 3500109, 4283492, 3913598, 9261777, 8595755, 11801196, 14643726, 15949147, 6741672, 8159828, 7970330, 14085054, 15197438, 8761049, 9559997, 12082224, 16291820, 5411083, 8989736, 14262671, 15401171, 9488641, 14934309, 15668130, 1282347, 3905070, 14438225, 15434561, 16117642, 6328955, 3407688, 5464608, 12494752, 12788663, 15218449, 13111442, 2441337, 111780, 8075835, 1752965, 9241354, 2498960, 4040644, 14820184, 5740472, 14366054, 16928694, 610879, 5652239, 5627551, 862430, 15499364, 13835634, 2799651, 9004707, 11361894, 1944050, 4710727, 812803, 7974130, 10355903, 968047, 2834627, 15961255, 3527569, 815575, 17374373, 3187050, 10862871, 11699041, 4430875, 13305186, 6387051, 2153148, 10915727, 3336314, 3332074, 810936, 7221653, 17175335, 12445854, 4357767, 1208515, 16630092, 10854178, 3510830, 3929358, 10315214, 9719997, 5412262, 9266582, 15736403, 3808432, 6732291, 17129267, 15761977, 10980150, 17297174, 17095662, 3473941, 8952157, 16296739, 14732183, 6389073, 3704784, 7251357, 12080658, 5828711, 13010576, 7292865, 9712860, 12754941, 14613592, 9725754, 9725402, 8251827, 5523544, 8745352, 17136086, 14401861, 10081432, 3776076, 12146477, 10605271, 925077, 1987549, 208077, 10496963, 170435, 3901505, 13690849, 13401259, 9473475, 2040489, 9229145, 2234480, 6143651, 7142093, 9127324, 6143866, 12801128, 2127390, 1771462, 10982346, 8255857, 8668397, 2610559, 13913582, 13116377, 14233956, 11260847, 8592681, 10855035, 4744039, 15230590, 16096927, 3618461, 397138, 1901600, 4838252, 8727106, 13390086, 6132001, 3957823, 83815, 11784118, 14985803, 6312560, 15575927, 11892148, 1451884, 7954659, 1431600, 185504, 709661, 9509380, 12535441, 4036713, 12640814, 2172834, 7865784, 14752204, 1084636, 5444029, 4342248, 3217851, 8807626, 11029708, 8653582, 7567045, 11547682, 6848291, 2595240, 2733703, 832726, 2960760, 2819496, 11780123, 2920357, 645845, 43287, 11241246, 12649688, 8563942, 11824073, 856765, 3355857, 14561572, 10567421, 15099715, 13094283, 6802550, 11237750, 10437857, 1905707, 16571050, 4842245, 646171, 4113124, 13667819, 11268880, 16222099, 17261822, 13774901, 5588669, 5506981, 3779282, 2624428, 1690623, 435456, 11527370, 16795579, 4261195, 5901757, 100990, 9894424, 17609563, 15025271, 15041788, 15106401, 3312546, 8429688, 12559700, 16373595, 10658946, 16579783, 10392613, 255451, 8340007, 564740, 7919717, 1931190, 15196404, 14351143, 7056066, 3913004, 3468879, 13910498, 17237997, 149008, 5824742, 15982149, 1927860, 9972501, 13688429, 5474591, 1737330, 6557138, 9607278, 16499085, 686463, 7875973, 15978148, 17589676, 12374598, 9431885, 7170873, 6776993, 7794101, 12277902, 17012456, 16330971, 3746143, 11623700, 7783014, 11200042, 9076504, 16016648, 9041612, 8810614, 9712255, 10773274, 17087876, 6446596, 5411615, 7409658, 4159247, 8928822, 1215511, 8446673, 1158159, 10010520, 271369, 13962253, 809638, 16114886, 17033512, 6692990, 6644517, 3248941, 17229711, 9644779, 4620522, 450321, 16498541, 4821222, 16483740, 9736127, 12923893, 6545952, 7563935, 632283, 10094914, 16633416, 8538781, 12242356, 16786929, 14838072, 473597, 10343162, 2283645, 15041058, 14755513, 15187551, 16714304, 10123497, 13608669, 10615795, 17529808, 8815944, 6476975, 2090700, 9981777, 13847488, 15454187, 8207823, 10266560, 8121524, 15936260, 933780, 5107979, 4894855, 571202, 16436557, 5028199, 2538340, 7993158, 9260267, 15599603, 14624901, 7625218, 1247806, 14549342, 1548672, 10177002, 9615966, 771265, 7911990, 8507171, 2845668, 12137658, 2791289, 11169083, 6562940, 17565325, 7868083, 11702570, 12842294, 10851517, 10154670, 2891437, 3411986, 10332522, 16251924, 5510166, 3136245, 4317341, 5400776, 557140, 15378019, 12756691, 9415967, 1548627, 6532095, 17232213, 14808861, 7882589, 6404316, 10080013, 16026167, 9402382, 7588149, 15729293, 11036209, 11116619, 2866891, 10340382, 15335046, 15330476, 7060547, 7993219, 4099805, 7273222, 14045689, 11782217, 5955417, 3204956, 1102994, 3060532, 9830108, 16067398, 906584, 6705253, 16693031, 2766552, 16562048, 10123009, 14447774, 11631912, 6119924, 1005768, 2001169, 15272682, 1044687, 16863420, 7785169, 2886278, 653326, 1747654, 3263577, 5864303, 17457996, 1918162, 6950285, 10291414, 7294847, 9982808, 4359243, 6629812, 8001839, 14605463, 8986640, 17453847, 9384864, 7766169, 3500109, 3913598, 8595755, 14643726, 6741672, 7970330, 15197438, 9559997, 16291820, 8989736, 15401171, 14934309, 1282347, 14438225, 16117642, 3407688, 12494752, 15218449, 2441337, 8075835, 9241354, 4040644, 5740472, 16928694, 5652239, 862430, 13835634, 9004707, 1944050, 812803, 10355903, 2834627, 3527569, 17374373, 10862871, 4430875, 6387051, 10915727, 3332074, 7221653, 12445854, 1208515, 10854178, 3929358, 9719997, 9266582, 3808432, 17129267, 10980150, 17095662, 8952157, 14732183, 3704784, 12080658, 13010576, 9712860, 14613592, 9725402, 5523544, 17136086, 10081432, 12146477, 925077, 208077, 170435, 13690849, 9473475, 9229145, 6143651, 9127324, 12801128, 1771462, 8255857, 2610559, 13116377, 11260847, 10855035, 15230590, 3618461, 1901600, 8727106, 6132001, 83815, 14985803, 15575927, 1451884, 1431600, 709661, 12535441, 12640814, 7865784, 1084636, 4342248, 8807626, 8653582, 11547682, 2595240, 832726, 2819496, 2920357, 43287, 12649688, 11824073, 3355857, 10567421, 13094283, 11237750, 1905707, 4842245, 4113124, 11268880, 17261822, 5588669, 3779282, 1690623, 11527370, 4261195, 100990, 17609563, 15041788, 3312546, 12559700, 10658946, 10392613, 8340007, 7919717, 15196404, 7056066, 3468879, 17237997, 5824742, 1927860, 13688429, 1737330, 9607278, 686463, 15978148, 12374598, 7170873, 7794101, 17012456, 3746143, 7783014, 9076504, 9041612, 9712255, 17087876, 5411615, 4159247, 1215511, 1158159, 271369, 809638, 17033512, 6644517, 17229711, 4620522, 16498541, 16483740, 12923893, 7563935, 10094914, 8538781, 16786929, 473597, 2283645, 14755513, 16714304, 13608669, 17529808, 6476975, 9981777, 15454187, 10266560, 15936260, 5107979, 571202, 5028199, 7993158, 15599603, 7625218, 14549342, 10177002, 771265, 8507171, 12137658, 11169083, 17565325, 11702570, 10851517, 2891437, 10332522, 5510166, 4317341, 557140, 12756691, 1548627, 17232213, 7882589, 10080013, 9402382, 15729293, 11116619, 10340382, 15330476, 7993219, 7273222, 11782217, 3204956, 3060532, 16067398, 6705253, 2766552, 10123009, 11631912, 1005768, 15272682, 16863420, 2886278, 1747654, 5864303, 1918162, 10291414, 9982808, 6629812, 14605463, 17453847, 7766169, 3913598, 14643726, 7970330, 9559997, 8989736, 14934309, 14438225, 3407688, 15218449, 8075835, 4040644, 16928694, 862430, 9004707, 812803, 2834627, 17374373, 4430875, 10915727, 7221653, 1208515, 3929358, 9266582, 17129267, 17095662, 14732183, 12080658, 9712860, 9725402, 17136086, 12146477, 208077, 13690849, 9229145, 9127324, 1771462, 2610559, 11260847, 15230590, 1901600, 6132001, 14985803, 1451884, 709661, 12640814, 1084636, 8807626, 11547682, 832726, 2920357, 12649688, 3355857, 13094283, 1905707, 4113124, 17261822, 3779282, 11527370, 100990, 15041788, 12559700, 10392613, 7919717, 7056066, 17237997, 1927860, 1737330, 686463, 12374598, 7794101, 3746143, 9076504, 9712255, 5411615, 1215511, 271369, 17033512, 17229711, 16498541, 12923893, 10094914, 16786929, 2283645, 16714304, 17529808, 9981777, 10266560, 5107979, 5028199, 15599603, 14549342, 771265, 12137658, 17565325, 10851517, 10332522, 4317341, 12756691, 17232213, 10080013, 15729293, 10340382, 7993219, 11782217, 3060532, 6705253, 10123009, 1005768, 16863420, 1747654, 1918162, 9982808, 14605463, 7766169, 14643726, 9559997, 14934309, 3407688, 8075835, 16928694, 9004707, 2834627, 4430875, 7221653, 3929358, 17129267, 14732183, 9712860, 17136086, 208077, 9229145, 1771462, 11260847, 1901600, 14985803, 709661, 1084636, 11547682, 2920357, 3355857, 1905707, 17261822, 11527370, 15041788, 10392613, 7056066, 1927860, 686463, 7794101, 9076504, 5411615, 271369, 17229711, 12923893, 16786929, 16714304, 9981777, 5107979, 15599603, 771265, 17565325, 10332522, 12756691, 10080013, 10340382, 11782217, 6705253, 1005768, 1747654, 9982808, 7766169, 9559997, 3407688, 16928694, 2834627, 7221653, 17129267, 9712860, 208077, 1771462, 1901600, 709661, 11547682, 3355857, 17261822, 15041788, 7056066, 686463, 9076504, 271369, 12923893, 16714304, 5107979, 771265, 10332522, 10080013, 11782217, 1005768, 9982808, 9559997, 16928694, 7221653, 9712860, 1771462, 709661, 3355857, 15041788, 686463, 271369, 16714304, 771265, 10080013, 1005768, 9559997, 7221653, 1771462, 3355857, 686463, 16714304, 10080013, 9559997, 1771462, 686463, 10080013, 9559997, 1771462, 686463, 10080013, 1771462, 10080013, 1771462, 10080013, 1771462, 10080013, 1771462, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013};
+
+static const FFTSHORT W_bwd_avx2_1024_17633281[1040] = {10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 10080013, 15861819, 10080013, 15861819, 10080013, 15861819, 10080013, 15861819, 10080013, 16946818, 15861819, 8073284, 10080013, 16946818, 15861819, 8073284, 10080013, 918977, 16946818, 14277424, 15861819, 10411628, 8073284, 16627513, 10080013, 16862016, 918977, 17361912, 16946818, 2591493, 14277424, 16923620, 15861819, 7920421, 10411628, 704587, 8073284, 7650473, 16627513, 5851064, 10080013, 7300759, 16862016, 12525302, 918977, 4709388, 17361912, 8556777, 16946818, 10577215, 2591493, 371459, 14277424, 6085599, 16923620, 15731681, 15861819, 17425204, 7920421, 504014, 10411628, 14798654, 704587, 14225593, 8073284, 9867112, 7650473, 15885627, 16627513, 10928028, 5851064, 7292899, 10080013, 4876590, 7300759, 67956, 16862016, 2033678, 12525302, 7651504, 918977, 846352, 4709388, 403570, 17361912, 12221666, 8556777, 9839180, 16946818, 15705421, 10577215, 7240668, 2591493, 6105911, 371459, 15727574, 14277424, 14712924, 6085599, 16548645, 16923620, 2647478, 15731681, 6372434, 15861819, 8404136, 17425204, 497195, 7920421, 2901098, 504014, 13703923, 10411628, 13202406, 14798654, 8628574, 704587, 9557446, 14225593, 2698972, 8073284, 2989555, 9867112, 3027818, 7650473, 15715119, 15885627, 769861, 16627513, 7510272, 10928028, 14572749, 5851064, 9640062, 7292899, 1903988, 10080013, 401068, 4876590, 13315940, 7300759, 6781764, 67956, 5495623, 16862016, 3083939, 2033678, 12605082, 12525302, 7366721, 7651504, 103473, 918977, 15349636, 846352, 7538367, 4709388, 1134740, 403570, 599769, 17361912, 16417770, 12221666, 7921026, 8556777, 13887138, 9839180, 5258683, 16946818, 15895951, 15705421, 395284, 10577215, 9713564, 7240668, 5073581, 2591493, 17532291, 6105911, 13853999, 371459, 13520157, 15727574, 4538998, 14277424, 4983593, 14712924, 16800555, 6085599, 8825655, 16548645, 4992467, 16923620, 16181397, 2647478, 11501280, 15731681, 2402691, 6372434, 15022722, 15861819, 8505957, 8404136, 3942432, 17425204, 5486804, 497195, 7907879, 7920421, 5552623, 2901098, 537619, 504014, 8366699, 13703923, 16424766, 10411628, 6717554, 13202406, 258908, 14798654, 16820478, 8628574, 16770851, 704587, 13592637, 9557446, 2414832, 14225593, 3195056, 2698972, 8643545, 8073284, 9662951, 2989555, 13719683, 9867112, 179434, 3027818, 11003469, 7650473, 7341867, 15715119, 11768978, 15885627, 14747003, 769861, 2360599, 16627513, 6001369, 7510272, 14866729, 10928028, 1565883, 14572749, 14428325, 5851064, 10360059, 9640062, 2302805, 7292899, 6516662, 1903988, 8230899, 10080013, 9750692, 401068, 16084654, 4876590, 17076141, 13315940, 12123115, 7300759, 14741844, 6781764, 5930711, 67956, 6464198, 5495623, 9126110, 16862016, 7456279, 3083939, 10008063, 2033678, 9640123, 12605082, 17062079, 12525302, 1697021, 7366721, 2179094, 7651504, 11156306, 103473, 4024612, 918977, 2877768, 15349636, 17159684, 846352, 9094500, 7538367, 10069346, 4709388, 1149541, 1134740, 13012759, 403570, 10988764, 599769, 16823643, 17361912, 16475122, 16417770, 13474034, 12221666, 545405, 7921026, 8591669, 8556777, 9850267, 13887138, 620825, 9839180, 10462408, 5258683, 1655133, 16946818, 8026003, 15895951, 3944852, 15705421, 11808539, 395284, 14164402, 10577215, 2436877, 9713564, 9293274, 7240668, 6974335, 5073581, 14320735, 2591493, 23718, 17532291, 13372086, 6105911, 15942658, 13853999, 12044612, 371459, 6364401, 13520157, 12791036, 15727574, 6395531, 4538998, 7065860, 14277424, 5809208, 4983593, 17589994, 14712924, 14813785, 16800555, 15038041, 6085599, 8979699, 8825655, 13291033, 16548645, 9767497, 4992467, 5097840, 16923620, 16201681, 16181397, 2057354, 2647478, 17549466, 11501280, 8906175, 15731681, 14014820, 2402691, 6778246, 6372434, 4516904, 15022722, 9377424, 15861819, 4832153, 8505957, 11489630, 8404136, 8159806, 3942432, 17462846, 17425204, 16708204, 5486804, 7551849, 497195, 12109737, 7907879, 3019689, 7920421, 4622705, 5552623, 13928497, 2901098, 8681124, 537619, 6653131, 504014, 13824849, 8366699, 7913284, 13703923, 6779103, 16424766, 5187427, 10411628, 14301207, 6717554, 11246230, 13202406, 6770410, 258908, 14105712, 14798654, 7277378, 16820478, 15689231, 8628574, 3797647, 16770851, 11981042, 704587, 11892809, 13592637, 8391927, 9557446, 15191944, 2414832, 5138529, 14225593, 1515639, 3195056, 16350934, 2698972, 2232110, 8643545, 1341461, 8073284, 2435843, 9662951, 10891609, 2989555, 9037526, 13719683, 14133172, 9867112, 8248417, 179434, 8646641, 3027818, 9631442, 11003469, 13274038, 7650473, 10338434, 7341867, 10682996, 15715119, 175285, 11768978, 14369704, 15885627, 16979955, 14747003, 9848112, 769861, 16588594, 2360599, 15632112, 16627513, 11513357, 6001369, 3185507, 7510272, 1071233, 14866729, 940250, 10928028, 16726697, 1565883, 7803173, 14572749, 16530287, 14428325, 11677864, 5851064, 3587592, 10360059, 13533476, 9640062, 10572734, 2302805, 2298235, 7292899, 14766390, 6516662, 6597072, 1903988, 10045132, 8230899, 1607114, 10080013, 11228965, 9750692, 2824420, 401068, 11101186, 16084654, 8217314, 4876590, 2255262, 17076141, 12232505, 13315940, 14497036, 12123115, 1381357, 7300759, 14221295, 14741844, 7478611, 6781764, 4790987, 5930711, 9765198, 67956, 11070341, 6464198, 14841992, 5495623, 14787613, 9126110, 9721291, 16862016, 8017315, 7456279, 16084609, 3083939, 16385475, 10008063, 3008380, 2033678, 8373014, 9640123, 15094941, 12605082, 1196724, 17062079, 12738426, 12525302, 16699501, 1697021, 9511757, 7366721, 9425458, 2179094, 3785793, 7651504, 15542581, 11156306, 8817337, 103473, 7017486, 4024612, 7509784, 918977, 2445730, 2877768, 2592223, 15349636, 7290119, 17159684, 2795209, 846352, 5390925, 9094500, 999865, 7538367, 17000998, 10069346, 11087329, 4709388, 7897154, 1149541, 12812059, 1134740, 17182960, 13012759, 7988502, 403570, 14384340, 10988764, 10940291, 599769, 1518395, 16823643, 3671028, 17361912, 7622761, 16475122, 9186608, 16417770, 8704459, 13474034, 10223623, 12221666, 11186685, 545405, 6860007, 7921026, 8822667, 8591669, 1616633, 8556777, 6433239, 9850267, 6009581, 13887138, 1302310, 620825, 5355379, 9839180, 10856288, 10462408, 8201396, 5258683, 43605, 1655133, 9757308, 16946818, 1134196, 8026003, 11076143, 15895951, 12158690, 3944852, 7660780, 15705421, 1651132, 11808539, 17484273, 395284, 3722783, 14164402, 13720277, 10577215, 3282138, 2436877, 15702091, 9713564, 17068541, 9293274, 17377830, 7240668, 1053498, 6974335, 1259686, 5073581, 9203593, 14320735, 2526880, 2591493, 2608010, 23718, 7738857, 17532291, 11731524, 13372086, 837702, 6105911, 17197825, 15942658, 15008853, 13853999, 12126300, 12044612, 3858380, 371459, 1411182, 6364401, 3965462, 13520157, 16987110, 12791036, 1062231, 15727574, 7195424, 6395531, 10830731, 4538998, 2533566, 7065860, 3071709, 14277424, 16776516, 5809208, 9069339, 4983593, 6392035, 17589994, 16987436, 14712924, 5853158, 14813785, 14672521, 16800555, 14899578, 15038041, 10784990, 6085599, 10066236, 8979699, 6603573, 8825655, 14415430, 13291033, 12189252, 16548645, 2881077, 9767497, 15460447, 4992467, 13596568, 5097840, 8123901, 16923620, 17447777, 16201681, 9678622, 16181397, 5741133, 2057354, 11320721, 2647478, 5849163, 17549466, 13675458, 11501280, 4243195, 8906175, 12795029, 15731681, 17236143, 14014820, 1536354, 2402691, 12889242, 6778246, 9040600, 6372434, 3399325, 4516904, 3719699, 15022722, 8964884, 9377424, 6650935, 15861819, 15505891, 4832153, 11489415, 8505957, 10491188, 11489630, 15398801, 8404136, 15592792, 8159806, 4232022, 3942432, 13731776, 17462846, 7136318, 17425204, 15645732, 16708204, 7028010, 5486804, 13857205, 7551849, 3231420, 497195, 8887929, 12109737, 9381454, 7907879, 7907527, 3019689, 4878340, 7920421, 10340416, 4622705, 11804570, 5552623, 10381924, 13928497, 11244208, 2901098, 1336542, 8681124, 14159340, 537619, 336107, 6653131, 1871304, 504014, 10900990, 13824849, 1896878, 8366699, 12221019, 7913284, 7318067, 13703923, 14122451, 6779103, 1003189, 16424766, 13275514, 5187427, 457946, 10411628, 16822345, 14301207, 14296967, 6717554, 15480133, 11246230, 4328095, 13202406, 5934240, 6770410, 14446231, 258908, 16817706, 14105712, 1672026, 14798654, 16665234, 7277378, 9659151, 16820478, 12922554, 15689231, 6271387, 8628574, 14833630, 3797647, 2133917, 16770851, 12005730, 11981042, 17022402, 704587, 3267227, 11892809, 2813097, 13592637, 15134321, 8391927, 15880316, 9557446, 17521501, 15191944, 4521839, 2414832, 4844618, 5138529, 12168673, 14225593, 11304326, 1515639, 2198720, 3195056, 13728211, 16350934, 1965151, 2698972, 8144640, 2232110, 3370610, 8643545, 12222198, 1341461, 5551057, 8073284, 8872232, 2435843, 3548227, 9662951, 9473453, 10891609, 1684134, 2989555, 5832085, 9037526, 8371504, 13719683, 13349789, 14133172, 13080789, 9867112, 5575327, 8248417, 8661834, 179434, 14327590, 8646641, 12732778, 3027818, 15263403, 9631442, 12273602, 11003469, 13251471, 13274038, 13145537, 7650473, 3730942, 10338434, 7758708, 7341867, 13163649, 10682996, 9085509, 15715119, 14687060, 175285, 17129002, 11768978, 1049853, 14369704, 16548759, 15885627, 15878217, 16979955, 7715337, 14747003, 14093263, 9848112, 7043890, 769861, 8154195, 16588594, 10676754, 2360599, 7496774, 15632112, 14735432, 16627513, 6774867, 11513357, 6531052, 6001369, 11667131, 3185507, 56177, 7510272, 3687734, 1071233, 2267145, 14866729, 6043938, 940250, 13403708, 10928028, 12360524, 16726697, 623265, 1565883, 2966695, 7803173, 1301814, 14572749, 8775900, 16530287, 7052666, 14428325, 3092554, 11677864, 10856093, 5851064, 5173388, 3587592, 3738671, 10360059, 5971243, 13533476, 2256588, 9640062, 8136366, 10572734, 3477212, 2302805, 9493318, 2298235, 17168998, 7292899, 16889126, 14766390, 3871882, 6516662, 4357252, 6597072, 7821882, 1903988, 8309023, 10045132, 17300396, 8230899, 2856737, 1607114, 15940274};
+
+/* N = 2048, Q = 536856577 */
+
+static const FFTSHORT W_fwd_avx2_2048_536856577[2064] = {114680, 497318421, 387611442, 34989333, 514790428, 16596165, 98839989, 67841293, 175929383, 366460698, 330418969, 137229208, 375036682, 262970340, 375660926, 339454037, 503748703, 383312431, 34350342, 11977070, 267016799, 462173697, 393462172, 309073808, 435104051, 494973946, 488001804, 21482305, 82117768, 281320529, 350222834, 456658111, 284299004, 314938137, 217883618, 242660668, 453095016, 200189821, 322937697, 12898020, 368575362, 159513565, 338374036, 101674568, 267511323, 512973462, 109507002, 330955959, 184286165, 395296481, 63208146, 122111668, 44764762, 347366302, 255737151, 293711363, 317817601, 142451312, 258363471, 408956900, 503423075, 205972314, 341371547, 95255255, 440170955, 242120872, 313341143, 352063350, 331659471, 443464516, 43189001, 479674630, 228415150, 441686979, 159451095, 201682340, 339657941, 99537907, 383289330, 189177997, 27458441, 443706677, 33046600, 505209913, 411894407, 183106258, 284728863, 286634496, 403756367, 324419527, 399328461, 100353062, 93167013, 484071884, 158499945, 506015789, 94954425, 343526396, 434150478, 480107342, 386962145, 212239612, 381879404, 436678591, 75520957, 516374466, 416774002, 339322370, 107243270, 16473774, 225731545, 10913671, 500637888, 113123081, 430091601, 98157523, 517315563, 431223154, 79562880, 368473902, 524809531, 288497552, 108075839, 526624953, 403633674, 154730320, 465772781, 486004794, 353646329, 472238001, 337945923, 486506644, 516744329, 181978865, 321363658, 179516759, 32431096, 198199593, 442926913, 355851913, 158757419, 468329460, 285825497, 130032405, 262977935, 341490141, 529018544, 462552872, 91677906, 106348430, 430785617, 101413127, 194044558, 207680121, 325362511, 515910631, 82995540, 490905574, 400411566, 301145295, 505283617, 516774700, 461320543, 532220390, 469855674, 113131275, 385097010, 512325815, 428126774, 341721495, 378060876, 412528101, 434784733, 210783473, 254495470, 264212936, 342020247, 492536861, 52567811, 484701898, 394219824, 534606041, 225914178, 172108895, 333810521, 242449928, 344490066, 184110948, 481003928, 329178737, 234807208, 486369356, 350869882, 148862145, 48929683, 169156384, 535375709, 181440750, 202320982, 451736816, 215676003, 131269819, 448450584, 30326785, 320051657, 381926955, 522094339, 432079814, 304965469, 80244019, 356151673, 384975987, 215664544, 363426709, 205491528, 54876532, 309790120, 212933985, 346418922, 173777055, 51919395, 142337537, 100505011, 67613112, 515125391, 435739426, 230507041, 534402942, 163866412, 518791221, 92974704, 334601618, 143269407, 249418973, 32558570, 133615091, 311252229, 500421416, 355460487, 259778746, 37017087, 101207435, 214701954, 81293163, 396248068, 257362114, 401614027, 428991539, 400950808, 519025192, 181529898, 427860997, 34708710, 62868364, 500776732, 232059581, 19545303, 245025723, 173523079, 346360523, 470803403, 48969277, 260330248, 39635105, 422036186, 396459085, 326904052, 503632995, 42592984, 351121048, 244877674, 484417911, 410880441, 290781, 469130164, 322256353, 494080756, 506826563, 40840447, 38940940, 28913414, 485505678, 390304327, 506006057, 428550481, 394110560, 275517141, 39855033, 409428614, 321091420, 99492237, 319452094, 425895680, 141933616, 482876194, 207652209, 311691345, 203568918, 172825159, 4060984, 216608595, 310157617, 424206602, 359955095, 531517977, 470450093, 261597839, 47280046, 34781555, 445873242, 369063478, 75153242, 62571016, 446074956, 89569727, 372483595, 371355299, 95381635, 182942438, 379596012, 305367630, 227097041, 241809771, 292948352, 82467077, 37919916, 110761508, 214749744, 154323938, 18765373, 486582678, 229086409, 386519389, 493306977, 117408484, 264347164, 226196486, 161588583, 451868870, 439381303, 414674816, 13649876, 85801887, 138660157, 527396436, 31495769, 342986623, 66332301, 181722640, 485259099, 139702280, 255196035, 148233211, 354749882, 332219258, 12261553, 467249754, 86351868, 121260830, 139880830, 358420780, 387231902, 268083677, 230218138, 46574037, 73467308, 79484056, 241390345, 272545579, 11168572, 277315164, 92960501, 232745000, 25783615, 347733419, 196933581, 160279721, 386041872, 73352667, 105769924, 257377070, 412786185, 533957859, 340892666, 152556776, 381340649, 314860507, 15449445, 494568475, 461008863, 254309848, 237691248, 108667271, 299759978, 443439138, 228406518, 511624979, 126867440, 429033770, 463295977, 428604370, 211740403, 243655713, 3580166, 37346125, 427549417, 25660114, 67168944, 92155962, 246790451, 417777643, 410255638, 471660930, 103653289, 272099526, 49774204, 86910415, 221537091, 423429709, 37561408, 327691382, 294166695, 306029634, 467329810, 111406770, 87108457, 33490752, 176510749, 283843561, 447037474, 478762355, 97369303, 51851590, 318045574, 231838558, 362939686, 469070115, 477913208, 347454078, 314270412, 476276466, 470320600, 62419922, 139801268, 523407948, 344014146, 267674482, 133390134, 449686724, 290803124, 67143745, 533156600, 369162083, 33011715, 286821422, 221190318, 355713930, 325404413, 456036337, 84312503, 336856292, 176885436, 392082008, 175625799, 338401698, 516904023, 525547098, 359822604, 346181837, 152246253, 68183281, 424215867, 198812246, 53081522, 444229140, 460012808, 28374036, 52293376, 435414164, 135282597, 375481758, 528820406, 435440269, 47167671, 419850877, 193900076, 91136840, 95301251, 49093824, 89102690, 534833168, 231104195, 359194678, 226888042, 422604501, 109609749, 65191066, 131487735, 266060850, 222260760, 192899582, 396228963, 375833065, 267241441, 389480253, 234015299, 420971605, 329683225, 382502264, 185046522, 431237933, 398659996, 87108556, 288926947, 292502658, 109208125, 148830830, 517093486, 45290408, 23115206, 466029624, 29518239, 222770551, 135427450, 104412890, 358448185, 36326235, 165358412, 9825620, 466296757, 288725762, 158226610, 193069999, 289705956, 33530303, 227233897, 513182133, 356775137, 189648867, 324637636, 123825785, 458761947, 227494139, 58014182, 92387811, 299300604, 410855840, 417041862, 158775907, 119018797, 174504860, 54067973, 37974251, 10853950, 228231878, 291142098, 114459990, 174639842, 397842080, 351836175, 218889983, 379092424, 430003780, 509178621, 282026865, 406905042, 490363318, 518418007, 434030708, 363358187, 418354484, 240908427, 356941165, 211728191, 29640486, 309997159, 23639568, 82524708, 167048340, 466560951, 280181217, 348591406, 522040706, 293446188, 40258263, 413281876, 146911731, 529475098, 214478740, 535978840, 260316240, 408373624, 175114921, 297210072, 310611868, 394309383, 372707370, 469380432, 172792178, 116043278, 168922815, 475406647, 201274435, 382638263, 224538394, 326083373, 179257837, 493323326, 40671590, 152229004, 409445546, 18718704, 431834618, 369053437, 18188278, 466928597, 344464425, 59495414, 503067809, 463804193, 162980916, 222024813, 417889262, 75593523, 374734277, 495031036, 332934438, 160982088, 304719484, 288545988, 264436528, 130559255, 534490310, 113259035, 402281255, 477135945, 426098291, 94493818, 399546002, 251872473, 203642081, 530366239, 65975609, 84413788, 306336786, 81376448, 287670212, 9821629, 32925639, 504088627, 300534278, 311681410, 496020406, 462773174, 268592015, 528823152, 259448702, 162640601, 423900095, 278956043, 216198435, 142037746, 531801316, 343608060, 36693331, 361470648, 30741826, 522759765, 445566883, 127649266, 410441592, 123822757, 69831194, 497428783, 356190784, 433791042, 48784982, 333513096, 227678479, 52133552, 493924609, 4161774, 519477845, 171545661, 119258832, 74614414, 34386263, 181172595, 180266939, 332931756, 122508565, 383532684, 90259229, 436692386, 68236937, 334785189, 13261221, 346475422, 150365254, 514216689, 494666549, 268929056, 393278410, 22189861, 412518886, 193501978, 270595854, 78638040, 115831918, 326057477, 389071837, 395572361, 185869303, 523143112, 322931781, 40928500, 58411189, 297418612, 409676353, 39867317, 516384759, 99032179, 230216921, 349988957, 19553780, 241522626, 322756894, 262281161, 353117092, 364852609, 215163185, 350093526, 56961244, 116366937, 216931486, 247464483, 12257186, 354362030, 99782729, 129679681, 290247928, 397463194, 238809864, 342662889, 85105459, 500744338, 172109057, 361355875, 432254870, 205138419, 281798160, 153286450, 243958727, 431809751, 435694214, 410241416, 114715043, 381461539, 436466626, 162924919, 19453866, 425623135, 235056153, 290903649, 33328442, 143711982, 222573562, 502518590, 511350819, 11665192, 15090444, 534882030, 201412463, 283293487, 289555112, 399411480, 178521479, 11177346, 503264075, 53313466, 161615907, 87190526, 241753567, 532386410, 384528990, 464919080, 260012716, 112146530, 73993717, 335662587, 33324585, 435678344, 475634115, 489792927, 313093694, 231902627, 493144151, 136057702, 314322045, 69380365, 300580302, 296525307, 495109478, 163090306, 25332031, 214717896, 445697959, 105527936, 442748086, 291690180, 370675210, 246471412, 121375660, 503635593, 27016577, 352842663, 396119381, 142207963, 424410994, 65231863, 268142742, 285036724, 292976784, 98393262, 184052560, 388856960, 40862955, 512348174, 511666840, 53393932, 322662949, 56202839, 518375741, 438640831, 532073230, 368541874, 443775603, 412477855, 136360699, 514313863, 30255536, 427138872, 57191878, 499143512, 397042349, 494103194, 40431227, 143325738, 104481561, 535452397, 84518752, 278350125, 299715298, 249680967, 14473560, 490315525, 405109979, 450094112, 285845036, 469771618, 70730073, 87210952, 142432646, 365316764, 13472774, 96227818, 403174974, 44541387, 251075799, 50473478, 354553190, 391905829, 230318632, 133417030, 244209299, 68921264, 175230988, 89208358, 295156825, 439164167, 332018790, 377687163, 496413280, 475402523, 129704742, 143919960, 292358063, 86124712, 263580611, 217071273, 142326328, 467960189, 415816571, 66139800, 138791067, 424026748, 465818087, 494577859, 286960652, 153900934, 278117452, 458374438, 305237587, 159748152, 107486614, 320154073, 503947674, 320087500, 40770479, 165004722, 489234572, 106278740, 531212138, 231290900, 430677120, 476456858, 71519568, 491096986, 317827879, 160179801, 489587875, 336526498, 437807238, 232224029, 303201127, 186620148, 88349801, 370220285, 353974266, 511955711, 111598805, 315918988, 324200486, 509732476, 200898943, 203801801, 149290844, 15595615, 188946633, 44158599, 362713632, 374583342, 176025449, 58301733, 144868405, 177615395, 323043082, 268586760, 304713234, 127228250, 517357809, 158098011, 185668782, 177003919, 409300090, 246908374, 432567243, 123676018, 252192795, 9015556, 389275559, 232157768, 270862205, 39183244, 328083675, 22426791, 500484591, 293888252, 131989592, 523139107, 238456726, 180237738, 192878015, 208752149, 518382746, 536125611, 507578671, 457073339, 313339664, 359070970, 388332572, 75298345, 463657013, 330008673, 290633509, 203987514, 323842719, 474868878, 432688989, 463736876, 448176517, 90006226, 372974812, 45435821, 291331397, 116663021, 480894462, 42371020, 408585011, 380475536, 415179039, 361516956, 70502968, 377387457, 458328689, 254479176, 5652981, 101023241, 33315922, 89418063, 466380492, 316313509, 437922075, 153102472, 278252026, 156151330, 320024442, 62585850, 429875223, 528802369, 397485709, 269340778, 58158263, 193770711, 114680, 387611442, 514790428, 98839989, 175929383, 330418969, 375036682, 375660926, 503748703, 34350342, 267016799, 393462172, 435104051, 488001804, 82117768, 350222834, 284299004, 217883618, 453095016, 322937697, 368575362, 338374036, 267511323, 109507002, 184286165, 63208146, 44764762, 255737151, 317817601, 258363471, 503423075, 341371547, 440170955, 313341143, 331659471, 43189001, 228415150, 159451095, 339657941, 383289330, 27458441, 33046600, 411894407, 284728863, 403756367, 399328461, 93167013, 158499945, 94954425, 434150478, 386962145, 381879404, 75520957, 416774002, 107243270, 225731545, 500637888, 430091601, 517315563, 79562880, 524809531, 108075839, 403633674, 465772781, 353646329, 337945923, 516744329, 321363658, 32431096, 442926913, 158757419, 285825497, 262977935, 529018544, 91677906, 430785617, 194044558, 325362511, 82995540, 400411566, 505283617, 461320543, 469855674, 385097010, 428126774, 378060876, 434784733, 254495470, 342020247, 52567811, 394219824, 225914178, 333810521, 344490066, 481003928, 234807208, 350869882, 48929683, 535375709, 202320982, 215676003, 448450584, 320051657, 522094339, 304965469, 356151673, 215664544, 205491528, 309790120, 346418922, 51919395, 100505011, 515125391, 230507041, 163866412, 92974704, 143269407, 32558570, 311252229, 355460487, 37017087, 214701954, 396248068, 401614027, 400950808, 181529898, 34708710, 500776732, 19545303, 173523079, 470803403, 260330248, 422036186, 326904052, 42592984, 244877674, 410880441, 469130164, 494080756, 40840447, 28913414, 390304327, 428550481, 275517141, 409428614, 99492237, 425895680, 482876194, 311691345, 172825159, 216608595, 424206602, 531517977, 261597839, 34781555, 369063478, 62571016, 89569727, 371355299, 182942438, 305367630, 241809771, 82467077, 110761508, 154323938, 486582678, 386519389, 117408484, 226196486, 451868870, 414674816, 85801887, 527396436, 342986623, 181722640, 139702280, 148233211, 332219258, 467249754, 121260830, 358420780, 268083677, 46574037, 79484056, 272545579, 277315164, 232745000, 347733419, 160279721, 73352667, 257377070, 533957859, 152556776, 314860507, 494568475, 254309848, 108667271, 443439138, 511624979, 429033770, 428604370, 243655713, 37346125, 25660114, 92155962, 417777643, 471660930, 272099526, 86910415, 423429709, 327691382, 306029634, 111406770, 33490752, 283843561, 478762355, 51851590, 231838558, 469070115, 347454078, 476276466, 62419922, 523407948, 267674482, 449686724, 67143745, 369162083, 286821422, 355713930, 456036337, 336856292, 392082008, 338401698, 525547098, 346181837, 68183281, 198812246, 444229140, 28374036, 435414164, 375481758, 435440269, 419850877, 91136840, 49093824, 534833168, 359194678, 422604501, 65191066, 266060850, 192899582, 375833065, 389480253, 420971605, 382502264, 431237933, 87108556, 292502658, 148830830, 45290408, 466029624, 222770551, 104412890, 36326235, 9825620, 288725762, 193069999, 33530303, 513182133, 189648867, 123825785, 227494139, 92387811, 410855840, 158775907, 174504860, 37974251, 228231878, 114459990, 397842080, 218889983, 430003780, 282026865, 490363318, 434030708, 418354484, 356941165, 29640486, 23639568, 167048340, 280181217, 522040706, 40258263, 146911731, 214478740, 260316240, 175114921, 310611868, 372707370, 172792178, 168922815, 201274435, 224538394, 179257837, 40671590, 409445546, 431834618, 18188278, 344464425, 503067809, 162980916, 417889262, 374734277, 332934438, 304719484, 264436528, 534490310, 402281255, 426098291, 399546002, 203642081, 65975609, 306336786, 287670212, 32925639, 300534278, 496020406, 268592015, 259448702, 423900095, 216198435, 531801316, 36693331, 30741826, 445566883, 410441592, 69831194, 356190784, 48784982, 227678479, 493924609, 519477845, 119258832, 34386263, 180266939, 122508565, 90259229, 68236937, 13261221, 150365254, 494666549, 393278410, 412518886, 270595854, 115831918, 389071837, 185869303, 322931781, 58411189, 409676353, 516384759, 230216921, 19553780, 322756894, 353117092, 215163185, 56961244, 216931486, 12257186, 99782729, 290247928, 238809864, 85105459, 172109057, 432254870, 281798160, 243958727, 435694214, 114715043, 436466626, 19453866, 235056153, 33328442, 222573562, 511350819, 15090444, 201412463, 289555112, 178521479, 503264075, 161615907, 241753567, 384528990, 260012716, 73993717, 33324585, 475634115, 313093694, 493144151, 314322045, 300580302, 495109478, 25332031, 445697959, 442748086, 370675210, 121375660, 27016577, 396119381, 424410994, 268142742, 292976784, 184052560, 40862955, 511666840, 322662949, 518375741, 532073230, 443775603, 136360699, 30255536, 57191878, 397042349, 40431227, 104481561, 84518752, 299715298, 14473560, 405109979, 285845036, 70730073, 142432646, 13472774, 403174974, 251075799, 354553190, 230318632, 244209299, 175230988, 295156825, 332018790, 496413280, 129704742, 292358063, 263580611, 142326328, 415816571, 138791067, 465818087, 286960652, 278117452, 305237587, 107486614, 503947674, 40770479, 489234572, 531212138, 430677120, 71519568, 317827879, 489587875, 437807238, 303201127, 88349801, 353974266, 111598805, 324200486, 200898943, 149290844, 188946633, 362713632, 176025449, 144868405, 323043082, 304713234, 517357809, 185668782, 409300090, 432567243, 252192795, 389275559, 270862205, 328083675, 500484591, 131989592, 238456726, 192878015, 518382746, 507578671, 313339664, 388332572, 463657013, 290633509, 323842719, 432688989, 448176517, 372974812, 291331397, 480894462, 408585011, 415179039, 70502968, 458328689, 5652981, 33315922, 466380492, 437922075, 278252026, 320024442, 429875223, 397485709, 58158263, 114680, 514790428, 175929383, 375036682, 503748703, 267016799, 435104051, 82117768, 284299004, 453095016, 368575362, 267511323, 184286165, 44764762, 317817601, 503423075, 440170955, 331659471, 228415150, 339657941, 27458441, 411894407, 403756367, 93167013, 94954425, 386962145, 75520957, 107243270, 500637888, 517315563, 524809531, 403633674, 353646329, 516744329, 32431096, 158757419, 262977935, 91677906, 194044558, 82995540, 505283617, 469855674, 428126774, 434784733, 342020247, 394219824, 333810521, 481003928, 350869882, 535375709, 215676003, 320051657, 304965469, 215664544, 309790120, 51919395, 515125391, 163866412, 143269407, 311252229, 37017087, 396248068, 400950808, 34708710, 19545303, 470803403, 422036186, 42592984, 410880441, 494080756, 28913414, 428550481, 409428614, 425895680, 311691345, 216608595, 531517977, 34781555, 62571016, 371355299, 305367630, 82467077, 154323938, 386519389, 226196486, 414674816, 527396436, 181722640, 148233211, 467249754, 358420780, 46574037, 272545579, 232745000, 160279721, 257377070, 152556776, 494568475, 108667271, 511624979, 428604370, 37346125, 92155962, 471660930, 86910415, 327691382, 111406770, 283843561, 51851590, 469070115, 476276466, 523407948, 449686724, 369162083, 355713930, 336856292, 338401698, 346181837, 198812246, 28374036, 375481758, 419850877, 49093824, 359194678, 65191066, 192899582, 389480253, 382502264, 87108556, 148830830, 466029624, 104412890, 9825620, 193069999, 513182133, 123825785, 92387811, 158775907, 37974251, 114459990, 218889983, 282026865, 434030708, 356941165, 23639568, 280181217, 40258263, 214478740, 175114921, 372707370, 168922815, 224538394, 40671590, 431834618, 344464425, 162980916, 374734277, 304719484, 534490310, 426098291, 203642081, 306336786, 32925639, 496020406, 259448702, 216198435, 36693331, 445566883, 69831194, 48784982, 493924609, 119258832, 180266939, 90259229, 13261221, 494666549, 412518886, 115831918, 185869303, 58411189, 516384759, 19553780, 353117092, 56961244, 12257186, 290247928, 85105459, 432254870, 243958727, 114715043, 19453866, 33328442, 511350819, 201412463, 178521479, 161615907, 384528990, 73993717, 475634115, 493144151, 300580302, 25332031, 442748086, 121375660, 396119381, 268142742, 184052560, 511666840, 518375741, 443775603, 30255536, 397042349, 104481561, 299715298, 405109979, 70730073, 13472774, 251075799, 230318632, 175230988, 332018790, 129704742, 263580611, 415816571, 465818087, 278117452, 107486614, 40770479, 531212138, 71519568, 489587875, 303201127, 353974266, 324200486, 149290844, 362713632, 144868405, 304713234, 185668782, 432567243, 389275559, 328083675, 131989592, 192878015, 507578671, 388332572, 290633509, 432688989, 372974812, 480894462, 415179039, 458328689, 33315922, 437922075, 320024442, 397485709, 114680, 175929383, 503748703, 435104051, 284299004, 368575362, 184286165, 317817601, 440170955, 228415150, 27458441, 403756367, 94954425, 75520957, 500637888, 524809531, 353646329, 32431096, 262977935, 194044558, 505283617, 428126774, 342020247, 333810521, 350869882, 215676003, 304965469, 309790120, 515125391, 143269407, 37017087, 400950808, 19545303, 422036186, 410880441, 28913414, 409428614, 311691345, 531517977, 62571016, 305367630, 154323938, 226196486, 527396436, 148233211, 358420780, 272545579, 160279721, 152556776, 108667271, 428604370, 92155962, 86910415, 111406770, 51851590, 476276466, 449686724, 355713930, 338401698, 198812246, 375481758, 49093824, 65191066, 389480253, 87108556, 466029624, 9825620, 513182133, 92387811, 37974251, 218889983, 434030708, 23639568, 40258263, 175114921, 168922815, 40671590, 344464425, 374734277, 534490310, 203642081, 32925639, 259448702, 36693331, 69831194, 493924609, 180266939, 13261221, 412518886, 185869303, 516384759, 353117092, 12257186, 85105459, 243958727, 19453866, 511350819, 178521479, 384528990, 475634115, 300580302, 442748086, 396119381, 184052560, 518375741, 30255536, 104481561, 405109979, 13472774, 230318632, 332018790, 263580611, 465818087, 107486614, 531212138, 489587875, 353974266, 149290844, 144868405, 185668782, 389275559, 131989592, 507578671, 290633509, 372974812, 415179039, 33315922, 320024442, 114680, 503748703, 284299004, 184286165, 440170955, 27458441, 94954425, 500637888, 353646329, 262977935, 505283617, 342020247, 350869882, 304965469, 515125391, 37017087, 19545303, 410880441, 409428614, 531517977, 305367630, 226196486, 148233211, 272545579, 152556776, 428604370, 86910415, 51851590, 449686724, 338401698, 375481758, 65191066, 87108556, 9825620, 92387811, 218889983, 23639568, 175114921, 40671590, 374734277, 203642081, 259448702, 69831194, 180266939, 412518886, 516384759, 12257186, 243958727, 511350819, 384528990, 300580302, 396119381, 518375741, 104481561, 13472774, 332018790, 465818087, 531212138, 353974266, 144868405, 389275559, 507578671, 372974812, 33315922, 114680, 284299004, 440170955, 94954425, 353646329, 505283617, 350869882, 515125391, 19545303, 409428614, 305367630, 148233211, 152556776, 86910415, 449686724, 375481758, 87108556, 92387811, 23639568, 40671590, 203642081, 69831194, 412518886, 12257186, 511350819, 300580302, 518375741, 13472774, 465818087, 353974266, 389275559, 372974812, 114680, 440170955, 353646329, 350869882, 19545303, 305367630, 152556776, 449686724, 87108556, 23639568, 203642081, 412518886, 511350819, 518375741, 465818087, 389275559, 114680, 353646329, 19545303, 152556776, 87108556, 203642081, 511350819, 465818087, 114680, 19545303, 87108556, 511350819, 114680, 19545303, 87108556, 511350819, 114680, 87108556, 114680, 87108556, 114680, 87108556, 114680, 87108556, 114680, 114680, 114680, 114680, 114680, 114680, 114680, 114680};
+
+static const FFTSHORT W_bwd_avx2_2048_536856577[2064] = {114680, 114680, 114680, 114680, 114680, 114680, 114680, 114680, 114680, 449748021, 114680, 449748021, 114680, 449748021, 114680, 449748021, 114680, 25505758, 449748021, 517311274, 114680, 25505758, 449748021, 517311274, 114680, 71038490, 25505758, 333214496, 449748021, 384299801, 517311274, 183210248, 114680, 147581018, 71038490, 18480836, 25505758, 124337691, 333214496, 513217009, 449748021, 87169853, 384299801, 231488947, 517311274, 185986695, 183210248, 96685622, 114680, 163881765, 147581018, 182882311, 71038490, 523383803, 18480836, 236276275, 25505758, 524599391, 124337691, 467025383, 333214496, 496184987, 513217009, 444468766, 449748021, 161374819, 87169853, 449946162, 384299801, 388623366, 231488947, 127427963, 517311274, 21731186, 185986695, 31572960, 183210248, 441902152, 96685622, 252557573, 114680, 503540655, 163881765, 29277906, 147581018, 391988172, 182882311, 5644439, 71038490, 204837787, 523383803, 432375016, 18480836, 140737196, 236276275, 152327587, 25505758, 292897850, 524599391, 20471818, 124337691, 356589638, 467025383, 277407875, 333214496, 162122300, 496184987, 361741656, 513217009, 317966594, 444468766, 527030957, 449748021, 471665511, 161374819, 198454879, 87169853, 485004987, 449946162, 108252207, 384299801, 264310998, 388623366, 310660091, 231488947, 5338600, 127427963, 125976136, 517311274, 499839490, 21731186, 231891108, 185986695, 194836330, 31572960, 273878642, 183210248, 36218689, 441902152, 509398136, 96685622, 352570412, 252557573, 33107874, 114680, 216832135, 503540655, 121677538, 163881765, 246223068, 29277906, 404866985, 147581018, 351187795, 391988172, 387565733, 182882311, 47268702, 5644439, 429369963, 71038490, 273275966, 204837787, 306537945, 523383803, 131746598, 432375016, 506601041, 18480836, 352804017, 140737196, 94108491, 236276275, 61222462, 152327587, 358335098, 25505758, 517402711, 292897850, 451751118, 524599391, 183739485, 20471818, 350987274, 124337691, 523595356, 356589638, 42931968, 467025383, 500163246, 277407875, 503930938, 333214496, 2366267, 162122300, 192392152, 496184987, 367933762, 361741656, 496598314, 513217009, 102825869, 317966594, 498882326, 444468766, 23674444, 527030957, 70826953, 449748021, 147376324, 471665511, 487762753, 161374819, 338044331, 198454879, 181142647, 87169853, 60580111, 485004987, 425449807, 449946162, 444700615, 108252207, 428189306, 384299801, 376576856, 264310998, 178435797, 388623366, 9460141, 310660091, 382532639, 231488947, 474285561, 5338600, 225165232, 127427963, 507943163, 125976136, 114820391, 517311274, 135905769, 499839490, 393587170, 21731186, 227066457, 231891108, 321180574, 185986695, 203046056, 194836330, 108729803, 31572960, 342812019, 273878642, 504425481, 183210248, 12047046, 36218689, 461335620, 441902152, 133100210, 509398136, 308441427, 96685622, 219038976, 352570412, 168281215, 252557573, 101752526, 33107874, 360927194, 114680, 139370868, 216832135, 98934502, 503540655, 78527888, 121677538, 55962115, 163881765, 104167588, 246223068, 148524005, 29277906, 343978562, 404866985, 208772902, 147581018, 104289334, 351187795, 232143343, 391988172, 174142945, 387565733, 212656091, 182882311, 233655450, 47268702, 465337009, 5644439, 496086098, 429369963, 258739125, 71038490, 121040006, 273275966, 407151835, 204837787, 361625589, 306537945, 285780778, 523383803, 466126504, 131746598, 237141279, 432375016, 139814228, 506601041, 93080974, 18480836, 25189737, 352804017, 268713835, 140737196, 415480917, 94108491, 511524546, 236276275, 43712426, 61222462, 462862860, 152327587, 375240670, 358335098, 335444114, 25505758, 503528135, 517402711, 422141534, 292897850, 104601707, 451751118, 246608649, 524599391, 479895333, 183739485, 517302797, 20471818, 478445388, 350987274, 421024659, 124337691, 42190028, 523595356, 446597348, 356589638, 417597745, 42931968, 488071595, 467025383, 91289694, 500163246, 320658142, 277407875, 40836171, 503930938, 230519791, 333214496, 110758286, 2366267, 232137093, 162122300, 373875661, 192392152, 105021959, 496184987, 312318183, 367933762, 164149207, 361741656, 322377837, 496598314, 256675360, 513217009, 179915412, 102825869, 254829712, 317966594, 422396587, 498882326, 378080670, 444468766, 413030792, 23674444, 343786578, 527030957, 432443687, 70826953, 388025747, 449748021, 154354313, 147376324, 343956995, 471665511, 177661899, 487762753, 117005700, 161374819, 508482541, 338044331, 190674740, 198454879, 200000285, 181142647, 167694494, 87169853, 13448629, 60580111, 67786462, 485004987, 253013016, 425449807, 209165195, 449946162, 65195647, 444700615, 499510452, 108252207, 25231598, 428189306, 42288102, 384299801, 279479507, 376576856, 304111577, 264310998, 490282540, 178435797, 69606823, 388623366, 355133937, 9460141, 122181761, 310660091, 150337188, 382532639, 454389500, 231488947, 165501278, 474285561, 502075022, 5338600, 320247982, 225165232, 110960897, 127427963, 108306096, 507943163, 42775821, 125976136, 494263593, 114820391, 66053174, 517311274, 502147867, 135905769, 140608509, 499839490, 225604348, 393587170, 372990165, 21731186, 484937182, 227066457, 321192033, 231891108, 216804920, 321180574, 1480868, 185986695, 55852649, 203046056, 142636753, 194836330, 102071844, 108729803, 67000903, 31572960, 453861037, 342812019, 445178671, 273878642, 378099158, 504425481, 20112248, 183210248, 133222903, 12047046, 19541014, 36218689, 429613307, 461335620, 149894432, 441902152, 443689564, 133100210, 124962170, 509398136, 197198636, 308441427, 205197106, 96685622, 33433502, 219038976, 492091815, 352570412, 269345254, 168281215, 83761561, 252557573, 454738809, 101752526, 269839778, 33107874, 161819895, 360927194, 22066149, 114680, 478698314, 139370868, 106981354, 216832135, 258604551, 98934502, 70476085, 503540655, 531203596, 78527888, 466353609, 121677538, 128271566, 55962115, 245525180, 163881765, 88680060, 104167588, 213013858, 246223068, 73199564, 148524005, 223516913, 29277906, 18473831, 343978562, 298399851, 404866985, 36371986, 208772902, 265994372, 147581018, 284663782, 104289334, 127556487, 351187795, 19498768, 232143343, 213813495, 391988172, 360831128, 174142945, 347909944, 387565733, 335957634, 212656091, 425257772, 182882311, 448506776, 233655450, 99049339, 47268702, 219028698, 465337009, 106179457, 5644439, 47622005, 496086098, 32908903, 429369963, 231618990, 258739125, 249895925, 71038490, 398065510, 121040006, 394530249, 273275966, 244498514, 407151835, 40443297, 204837787, 241699752, 361625589, 292647278, 306537945, 182303387, 285780778, 133681603, 523383803, 394423931, 466126504, 251011541, 131746598, 522383017, 237141279, 452337825, 432375016, 496425350, 139814228, 479664699, 506601041, 400495878, 93080974, 4783347, 18480836, 214193628, 25189737, 495993622, 352804017, 243879793, 268713835, 112445583, 140737196, 509840000, 415480917, 166181367, 94108491, 91158618, 511524546, 41747099, 236276275, 222534532, 43712426, 223762883, 61222462, 503531992, 462862860, 276843861, 152327587, 295103010, 375240670, 33592502, 358335098, 247301465, 335444114, 521766133, 25505758, 314283015, 503528135, 301800424, 517402711, 100389951, 422141534, 101162363, 292897850, 255058417, 104601707, 364747520, 451751118, 298046713, 246608649, 437073848, 524599391, 319925091, 479895333, 321693392, 183739485, 214099683, 517302797, 306639656, 20471818, 127180224, 478445388, 213924796, 350987274, 147784740, 421024659, 266260723, 124337691, 143578167, 42190028, 386491323, 523595356, 468619640, 446597348, 414348012, 356589638, 502470314, 417597745, 17378732, 42931968, 309178098, 488071595, 180665793, 467025383, 126414985, 91289694, 506114751, 500163246, 5055261, 320658142, 112956482, 277407875, 268264562, 40836171, 236322299, 503930938, 249186365, 230519791, 470880968, 333214496, 137310575, 110758286, 134575322, 2366267, 272420049, 232137093, 203922139, 162122300, 118967315, 373875661, 33788768, 192392152, 518668299, 105021959, 127411031, 496184987, 357598740, 312318183, 335582142, 367933762, 364064399, 164149207, 226244709, 361741656, 276540337, 322377837, 389944846, 496598314, 14815871, 256675360, 369808237, 513217009, 507216091, 179915412, 118502093, 102825869, 46493259, 254829712, 106852797, 317966594, 139014497, 422396587, 308624699, 498882326, 362351717, 378080670, 126000737, 444468766, 309362438, 413030792, 347207710, 23674444, 503326274, 343786578, 248130815, 527030957, 500530342, 432443687, 314086026, 70826953, 491566169, 388025747, 244353919, 449748021, 105618644, 154354313, 115884972, 147376324, 161023512, 343956995, 270795727, 471665511, 114252076, 177661899, 2023409, 487762753, 445719737, 117005700, 101416308, 161374819, 101442413, 508482541, 92627437, 338044331, 468673296, 190674740, 11309479, 198454879, 144774569, 200000285, 80820240, 181142647, 250035155, 167694494, 469712832, 87169853, 269182095, 13448629, 474436655, 60580111, 189402499, 67786462, 305018019, 485004987, 58094222, 253013016, 503365825, 425449807, 230826943, 209165195, 113426868, 449946162, 264757051, 65195647, 119078934, 444700615, 511196463, 499510452, 293200864, 108252207, 107822807, 25231598, 93417439, 428189306, 282546729, 42288102, 221996070, 384299801, 2898718, 279479507, 463503910, 376576856, 189123158, 304111577, 259541413, 264310998, 457372521, 490282540, 268772900, 178435797, 415595747, 69606823, 204637319, 388623366, 397154297, 355133937, 193869954, 9460141, 451054690, 122181761, 84987707, 310660091, 419448093, 150337188, 50273899, 382532639, 426095069, 454389500, 295046806, 231488947, 353914139, 165501278, 447286850, 474285561, 167793099, 502075022, 275258738, 5338600, 112649975, 320247982, 364031418, 225165232, 53980383, 110960897, 437364340, 127427963, 261339436, 108306096, 146552250, 507943163, 496016130, 42775821, 67726413, 125976136, 291978903, 494263593, 209952525, 114820391, 276526329, 66053174, 363333498, 517311274, 36079845, 502147867, 355326679, 135905769, 135242550, 140608509, 322154623, 499839490, 181396090, 225604348, 504298007, 393587170, 443881873, 372990165, 306349536, 21731186, 436351566, 484937182, 190437655, 227066457, 331365049, 321192033, 180704904, 231891108, 14762238, 216804920, 88405993, 321180574, 334535595, 1480868, 487926894, 185986695, 302049369, 55852649, 192366511, 203046056, 310942399, 142636753, 484288766, 194836330, 282361107, 102071844, 158795701, 108729803, 151759567, 67000903, 75536034, 31572960, 136445011, 453861037, 211494066, 342812019, 106070960, 445178671, 7838033, 273878642, 251031080, 378099158, 93929664, 504425481, 215492919, 20112248, 198910654, 183210248, 71083796, 133222903, 428780738, 12047046, 457293697, 19541014, 106764976, 36218689, 311125032, 429613307, 120082575, 461335620, 154977173, 149894432, 102706099, 441902152, 378356632, 443689564, 137528116, 133100210, 252127714, 124962170, 503809977, 509398136, 153567247, 197198636, 377405482, 308441427, 493667576, 205197106, 223515434, 96685622, 195485030, 33433502, 278493106, 219038976, 281119426, 492091815, 473648431, 352570412, 427349575, 269345254, 198482541, 168281215, 213918880, 83761561, 318972959, 252557573, 186633743, 454738809, 48854773, 101752526, 143394405, 269839778, 502506235, 33107874, 161195651, 161819895, 206437608, 360927194, 438016588, 22066149, 149245135, 114680, 343085866, 478698314, 267515799, 139370868, 8054208, 106981354, 474270727, 216832135, 380705247, 258604551, 383754105, 98934502, 220543068, 70476085, 447438514, 503540655, 435833336, 531203596, 282377401, 78527888, 159469120, 466353609, 175339621, 121677538, 156381041, 128271566, 494485557, 55962115, 420193556, 245525180, 491420756, 163881765, 446850351, 88680060, 73119701, 104167588, 61987699, 213013858, 332869063, 246223068, 206847904, 73199564, 461558232, 148524005, 177785607, 223516913, 79783238, 29277906, 730966, 18473831, 328104428, 343978562, 356618839, 298399851, 13717470, 404866985, 242968325, 36371986, 514429786, 208772902, 497673333, 265994372, 304698809, 147581018, 527841021, 284663782, 413180559, 104289334, 289948203, 127556487, 359852658, 351187795, 378758566, 19498768, 409628327, 232143343, 268269817, 213813495, 359241182, 391988172, 478554844, 360831128, 162273235, 174142945, 492697978, 347909944, 521260962, 387565733, 333054776, 335957634, 27124101, 212656091, 220937589, 425257772, 24900866, 182882311, 166636292, 448506776, 350236429, 233655450, 304632548, 99049339, 200330079, 47268702, 376676776, 219028698, 45759591, 465337009, 60399719, 106179457, 305565677, 5644439, 430577837, 47622005, 371851855, 496086098, 216769077, 32908903, 216702504, 429369963, 377108425, 231618990, 78482139, 258739125, 382955643, 249895925, 42278718, 71038490, 112829829, 398065510, 470716777, 121040006, 68896388, 394530249, 319785304, 273275966, 450731865, 244498514, 392936617, 407151835, 61454054, 40443297, 159169414, 204837787, 97692410, 241699752, 447648219, 361625589, 467935313, 292647278, 403439547, 306537945, 144950748, 182303387, 486383099, 285780778, 492315190, 133681603, 440628759, 523383803, 171539813, 394423931, 449645625, 466126504, 67084959, 251011541, 86762465, 131746598, 46541052, 522383017, 287175610, 237141279, 258506452, 452337825, 1404180, 432375016, 393530839, 496425350, 42753383, 139814228, 37713065, 479664699, 109717705, 506601041, 22542714, 400495878, 124378722, 93080974, 168314703, 4783347, 98215746, 18480836, 480653738, 214193628, 483462645, 25189737, 24508403, 495993622, 147999617, 352804017, 438463315, 243879793, 251819853, 268713835, 471624714, 112445583, 394648614, 140737196, 184013914, 509840000, 33220984, 415480917, 290385165, 166181367, 245166397, 94108491, 431328641, 91158618, 322138681, 511524546, 373766271, 41747099, 240331270, 236276275, 467476212, 222534532, 400798875, 43712426, 304953950, 223762883, 47063650, 61222462, 101178233, 503531992, 201193990, 462862860, 424710047, 276843861, 71937497, 152327587, 4470167, 295103010, 449666051, 375240670, 483543111, 33592502, 525679231, 358335098, 137445097, 247301465, 253563090, 335444114, 1974547, 521766133, 525191385, 25505758, 34337987, 314283015, 393144595, 503528135, 245952928, 301800424, 111233442, 517402711, 373931658, 100389951, 155395038, 422141534, 126615161, 101162363, 105046826, 292897850, 383570127, 255058417, 331718158, 104601707, 175500702, 364747520, 36112239, 451751118, 194193688, 298046713, 139393383, 246608649, 407176896, 437073848, 182494547, 524599391, 289392094, 319925091, 420489640, 479895333, 186763051, 321693392, 172003968, 183739485, 274575416, 214099683, 295333951, 517302797, 186867620, 306639656, 437824398, 20471818, 496989260, 127180224, 239437965, 478445388, 495928077, 213924796, 13713465, 350987274, 141284216, 147784740, 210799100, 421024659, 458218537, 266260723, 343354599, 124337691, 514666716, 143578167, 267927521, 42190028, 22639888, 386491323, 190381155, 523595356, 202071388, 468619640, 100164191, 446597348, 153323893, 414348012, 203924821, 356589638, 355683982, 502470314, 462242163, 417597745, 365310916, 17378732, 532694803, 42931968, 484723025, 309178098, 203343481, 488071595, 103065535, 180665793, 39427794, 467025383, 413033820, 126414985, 409207311, 91289694, 14096812, 506114751, 175385929, 500163246, 193248517, 5055261, 394818831, 320658142, 257900534, 112956482, 374215976, 277407875, 8033425, 268264562, 74083403, 40836171, 225175167, 236322299, 32767950, 503930938, 527034948, 249186365, 455480129, 230519791, 452442789, 470880968, 6490338, 333214496, 284984104, 137310575, 442362759, 110758286, 59720632, 134575322, 423597542, 2366267, 406297322, 272420049, 248310589, 232137093, 375874489, 203922139, 41825541, 162122300, 461263054, 118967315, 314831764, 373875661, 73052384, 33788768, 477361163, 192392152, 69927980, 518668299, 167803140, 105021959, 518137873, 127411031, 384627573, 496184987, 43533251, 357598740, 210773204, 312318183, 154218314, 335582142, 61449930, 367933762, 420813299, 364064399, 67476145, 164149207, 142547194, 226244709, 239646505, 361741656, 128482953, 276540337, 877737, 322377837, 7381479, 389944846, 123574701, 496598314, 243410389, 14815871, 188265171, 256675360, 70295626, 369808237, 454331869, 513217009, 226859418, 507216091, 325128386, 179915412, 295948150, 118502093, 173498390, 102825869, 18438570, 46493259, 129951535, 254829712, 27677956, 106852797, 157764153, 317966594, 185020402, 139014497, 362216735, 422396587, 245714479, 308624699, 526002627, 498882326, 482788604, 362351717, 417837780, 378080670, 119814715, 126000737, 237555973, 444468766, 478842395, 309362438, 78094630, 413030792, 212218941, 347207710, 180081440, 23674444, 309622680, 503326274, 247150621, 343786578, 378629967, 248130815, 70559820, 527030957, 371498165, 500530342, 178408392, 432443687, 401429127, 314086026, 507338338, 70826953, 513741371, 491566169, 19763091, 388025747, 427648452, 244353919, 247929630, 449748021, 138196581, 105618644, 351810055, 154354313, 207173352, 115884972, 302841278, 147376324, 269615136, 161023512, 140627614, 343956995, 314595817, 270795727, 405368842, 471665511, 427246828, 114252076, 309968535, 177661899, 305752382, 2023409, 447753887, 487762753, 441555326, 445719737, 342956501, 117005700, 489688906, 101416308, 8036171, 161374819, 401573980, 101442413, 484563201, 508482541, 76843769, 92627437, 483775055, 338044331, 112640710, 468673296, 384610324, 190674740, 177033973, 11309479, 19952554, 198454879, 361230778, 144774569, 359971141, 200000285, 452544074, 80820240, 211452164, 181142647, 315666259, 250035155, 503844862, 167694494, 3699977, 469712832, 246053453, 87169853, 403466443, 269182095, 192842431, 13448629, 397055309, 474436655, 66535977, 60580111, 222586165, 189402499, 58943369, 67786462, 173916891, 305018019, 218811003, 485004987, 439487274, 58094222, 89819103, 253013016, 360345828, 503365825, 449748120, 425449807, 69526767, 230826943, 242689882, 209165195, 499295169, 113426868, 315319486, 449946162, 487082373, 264757051, 433203288, 65195647, 126600939, 119078934, 290066126, 444700615, 469687633, 511196463, 109307160, 499510452, 533276411, 293200864, 325116174, 108252207, 73560600, 107822807, 409989137, 25231598, 308450059, 93417439, 237096599, 428189306, 299165329, 282546729, 75847714, 42288102, 521407132, 221996070, 155515928, 384299801, 195963911, 2898718, 124070392, 279479507, 431086653, 463503910, 150814705, 376576856, 339922996, 189123158, 511072962, 304111577, 443896076, 259541413, 525688005, 264310998, 295466232, 457372521, 463389269, 490282540, 306638439, 268772900, 149624675, 178435797, 396975747, 415595747, 450504709, 69606823, 524595024, 204637319, 182106695, 388623366, 281660542, 397154297, 51597478, 355133937, 470524276, 193869954, 505360808, 9460141, 398196420, 451054690, 523206701, 122181761, 97475274, 84987707, 375267994, 310660091, 272509413, 419448093, 43549600, 150337188, 307770168, 50273899, 518091204, 382532639, 322106833, 426095069, 498936661, 454389500, 243908225, 295046806, 309759536, 231488947, 157260565, 353914139, 441474942, 165501278, 164372982, 447286850, 90781621, 474285561, 461703335, 167793099, 90983335, 502075022, 489576531, 275258738, 66406484, 5338600, 176901482, 112649975, 226698960, 320247982, 532795593, 364031418, 333287659, 225165232, 329204368, 53980383, 394922961, 110960897, 217404483, 437364340, 215765157, 127427963, 497001544, 261339436, 142746017, 108306096, 30850520, 146552250, 51350899, 507943163, 497915637, 496016130, 30030014, 42775821, 214600224, 67726413, 536565796, 125976136, 52438666, 291978903, 185735529, 494263593, 33223582, 209952525, 140397492, 114820391, 497221472, 276526329, 487887300, 66053174, 190496054, 363333498, 291830854, 517311274, 304796996, 36079845, 473988213, 502147867, 108995580, 355326679, 17831385, 135905769, 107865038, 135242550, 279494463, 140608509, 455563414, 322154623, 435649142, 499839490, 277077831, 181396090, 36435161, 225604348, 403241486, 504298007, 287437604, 393587170, 202254959, 443881873, 18065356, 372990165, 2453635, 306349536, 101117151, 21731186, 469243465, 436351566, 394519040, 484937182, 363079522, 190437655, 323922592, 227066457, 481980045, 331365049, 173429868, 321192033, 151880590, 180704904, 456612558, 231891108, 104776763, 14762238, 154929622, 216804920, 506529792, 88405993, 405586758, 321180574, 85119761, 334535595, 355415827, 1480868, 367700193, 487926894, 387994432, 185986695, 50487221, 302049369, 207677840, 55852649, 352745629, 192366511, 294406649, 203046056, 364747682, 310942399, 2250536, 142636753, 52154679, 484288766, 44319716, 194836330, 272643641, 282361107, 326073104, 102071844, 124328476, 158795701, 195135082, 108729803, 24530762, 151759567, 423725302, 67000903, 4636187, 75536034, 20081877, 31572960, 235711282, 136445011, 45951003, 453861037, 20945946, 211494066, 329176456, 342812019, 435443450, 106070960, 430508147, 445178671, 74303705, 7838033, 195366436, 273878642, 406824172, 251031080, 68527117, 378099158, 181004664, 93929664, 338656984, 504425481, 357339818, 215492919, 354877712, 20112248, 50349933, 198910654, 64618576, 183210248, 50851783, 71083796, 382126257, 133222903, 10231624, 428780738, 248359025, 12047046, 168382675, 457293697, 105633423, 19541014, 438699054, 106764976, 423733496, 36218689, 525942906, 311125032, 520382803, 429613307, 197534207, 120082575, 20482111, 461335620, 100177986, 154977173, 324616965, 149894432, 56749235, 102706099, 193330181, 441902152, 30840788, 378356632, 52784693, 443689564, 436503515, 137528116, 212437050, 133100210, 250222081, 252127714, 353750319, 124962170, 31646664, 503809977, 93149900, 509398136, 347678580, 153567247, 437318670, 197198636, 335174237, 377405482, 95169598, 308441427, 57181947, 493667576, 93392061, 205197106, 184793227, 223515434, 294735705, 96685622, 441601322, 195485030, 330884263, 33433502, 127899677, 278493106, 394405265, 219038976, 243145214, 281119426, 189490275, 492091815, 414744909, 473648431, 141560096, 352570412, 205900618, 427349575, 23883115, 269345254, 435182009, 198482541, 377343012, 168281215, 523958557, 213918880, 336666756, 83761561, 294195909, 318972959, 221918440, 252557573, 80198466, 186633743, 255536048, 454738809, 515374272, 48854773, 41882631, 101752526, 227782769, 143394405, 74682880, 269839778, 524879507, 502506235, 153544146, 33107874, 197402540, 161195651, 273886237, 161819895, 399627369, 206437608, 170395879, 360927194, 469015284, 438016588, 520260412, 22066149, 501867244, 149245135, 39538156};
+
+/* N = 1024, Q = 536856577 */
+
+static const FFTSHORT W_fwd_avx2_1024_536856577[1040] = {114680, 387611442, 514790428, 98839989, 175929383, 330418969, 375036682, 375660926, 503748703, 34350342, 267016799, 393462172, 435104051, 488001804, 82117768, 350222834, 284299004, 217883618, 453095016, 322937697, 368575362, 338374036, 267511323, 109507002, 184286165, 63208146, 44764762, 255737151, 317817601, 258363471, 503423075, 341371547, 440170955, 313341143, 331659471, 43189001, 228415150, 159451095, 339657941, 383289330, 27458441, 33046600, 411894407, 284728863, 403756367, 399328461, 93167013, 158499945, 94954425, 434150478, 386962145, 381879404, 75520957, 416774002, 107243270, 225731545, 500637888, 430091601, 517315563, 79562880, 524809531, 108075839, 403633674, 465772781, 353646329, 337945923, 516744329, 321363658, 32431096, 442926913, 158757419, 285825497, 262977935, 529018544, 91677906, 430785617, 194044558, 325362511, 82995540, 400411566, 505283617, 461320543, 469855674, 385097010, 428126774, 378060876, 434784733, 254495470, 342020247, 52567811, 394219824, 225914178, 333810521, 344490066, 481003928, 234807208, 350869882, 48929683, 535375709, 202320982, 215676003, 448450584, 320051657, 522094339, 304965469, 356151673, 215664544, 205491528, 309790120, 346418922, 51919395, 100505011, 515125391, 230507041, 163866412, 92974704, 143269407, 32558570, 311252229, 355460487, 37017087, 214701954, 396248068, 401614027, 400950808, 181529898, 34708710, 500776732, 19545303, 173523079, 470803403, 260330248, 422036186, 326904052, 42592984, 244877674, 410880441, 469130164, 494080756, 40840447, 28913414, 390304327, 428550481, 275517141, 409428614, 99492237, 425895680, 482876194, 311691345, 172825159, 216608595, 424206602, 531517977, 261597839, 34781555, 369063478, 62571016, 89569727, 371355299, 182942438, 305367630, 241809771, 82467077, 110761508, 154323938, 486582678, 386519389, 117408484, 226196486, 451868870, 414674816, 85801887, 527396436, 342986623, 181722640, 139702280, 148233211, 332219258, 467249754, 121260830, 358420780, 268083677, 46574037, 79484056, 272545579, 277315164, 232745000, 347733419, 160279721, 73352667, 257377070, 533957859, 152556776, 314860507, 494568475, 254309848, 108667271, 443439138, 511624979, 429033770, 428604370, 243655713, 37346125, 25660114, 92155962, 417777643, 471660930, 272099526, 86910415, 423429709, 327691382, 306029634, 111406770, 33490752, 283843561, 478762355, 51851590, 231838558, 469070115, 347454078, 476276466, 62419922, 523407948, 267674482, 449686724, 67143745, 369162083, 286821422, 355713930, 456036337, 336856292, 392082008, 338401698, 525547098, 346181837, 68183281, 198812246, 444229140, 28374036, 435414164, 375481758, 435440269, 419850877, 91136840, 49093824, 534833168, 359194678, 422604501, 65191066, 266060850, 192899582, 375833065, 389480253, 420971605, 382502264, 431237933, 87108556, 292502658, 148830830, 45290408, 466029624, 222770551, 104412890, 36326235, 9825620, 288725762, 193069999, 33530303, 513182133, 189648867, 123825785, 227494139, 92387811, 410855840, 158775907, 174504860, 37974251, 228231878, 114459990, 397842080, 218889983, 430003780, 282026865, 490363318, 434030708, 418354484, 356941165, 29640486, 23639568, 167048340, 280181217, 522040706, 40258263, 146911731, 214478740, 260316240, 175114921, 310611868, 372707370, 172792178, 168922815, 201274435, 224538394, 179257837, 40671590, 409445546, 431834618, 18188278, 344464425, 503067809, 162980916, 417889262, 374734277, 332934438, 304719484, 264436528, 534490310, 402281255, 426098291, 399546002, 203642081, 65975609, 306336786, 287670212, 32925639, 300534278, 496020406, 268592015, 259448702, 423900095, 216198435, 531801316, 36693331, 30741826, 445566883, 410441592, 69831194, 356190784, 48784982, 227678479, 493924609, 519477845, 119258832, 34386263, 180266939, 122508565, 90259229, 68236937, 13261221, 150365254, 494666549, 393278410, 412518886, 270595854, 115831918, 389071837, 185869303, 322931781, 58411189, 409676353, 516384759, 230216921, 19553780, 322756894, 353117092, 215163185, 56961244, 216931486, 12257186, 99782729, 290247928, 238809864, 85105459, 172109057, 432254870, 281798160, 243958727, 435694214, 114715043, 436466626, 19453866, 235056153, 33328442, 222573562, 511350819, 15090444, 201412463, 289555112, 178521479, 503264075, 161615907, 241753567, 384528990, 260012716, 73993717, 33324585, 475634115, 313093694, 493144151, 314322045, 300580302, 495109478, 25332031, 445697959, 442748086, 370675210, 121375660, 27016577, 396119381, 424410994, 268142742, 292976784, 184052560, 40862955, 511666840, 322662949, 518375741, 532073230, 443775603, 136360699, 30255536, 57191878, 397042349, 40431227, 104481561, 84518752, 299715298, 14473560, 405109979, 285845036, 70730073, 142432646, 13472774, 403174974, 251075799, 354553190, 230318632, 244209299, 175230988, 295156825, 332018790, 496413280, 129704742, 292358063, 263580611, 142326328, 415816571, 138791067, 465818087, 286960652, 278117452, 305237587, 107486614, 503947674, 40770479, 489234572, 531212138, 430677120, 71519568, 317827879, 489587875, 437807238, 303201127, 88349801, 353974266, 111598805, 324200486, 200898943, 149290844, 188946633, 362713632, 176025449, 144868405, 323043082, 304713234, 517357809, 185668782, 409300090, 432567243, 252192795, 389275559, 270862205, 328083675, 500484591, 131989592, 238456726, 192878015, 518382746, 507578671, 313339664, 388332572, 463657013, 290633509, 323842719, 432688989, 448176517, 372974812, 291331397, 480894462, 408585011, 415179039, 70502968, 458328689, 5652981, 33315922, 466380492, 437922075, 278252026, 320024442, 429875223, 397485709, 58158263, 114680, 514790428, 175929383, 375036682, 503748703, 267016799, 435104051, 82117768, 284299004, 453095016, 368575362, 267511323, 184286165, 44764762, 317817601, 503423075, 440170955, 331659471, 228415150, 339657941, 27458441, 411894407, 403756367, 93167013, 94954425, 386962145, 75520957, 107243270, 500637888, 517315563, 524809531, 403633674, 353646329, 516744329, 32431096, 158757419, 262977935, 91677906, 194044558, 82995540, 505283617, 469855674, 428126774, 434784733, 342020247, 394219824, 333810521, 481003928, 350869882, 535375709, 215676003, 320051657, 304965469, 215664544, 309790120, 51919395, 515125391, 163866412, 143269407, 311252229, 37017087, 396248068, 400950808, 34708710, 19545303, 470803403, 422036186, 42592984, 410880441, 494080756, 28913414, 428550481, 409428614, 425895680, 311691345, 216608595, 531517977, 34781555, 62571016, 371355299, 305367630, 82467077, 154323938, 386519389, 226196486, 414674816, 527396436, 181722640, 148233211, 467249754, 358420780, 46574037, 272545579, 232745000, 160279721, 257377070, 152556776, 494568475, 108667271, 511624979, 428604370, 37346125, 92155962, 471660930, 86910415, 327691382, 111406770, 283843561, 51851590, 469070115, 476276466, 523407948, 449686724, 369162083, 355713930, 336856292, 338401698, 346181837, 198812246, 28374036, 375481758, 419850877, 49093824, 359194678, 65191066, 192899582, 389480253, 382502264, 87108556, 148830830, 466029624, 104412890, 9825620, 193069999, 513182133, 123825785, 92387811, 158775907, 37974251, 114459990, 218889983, 282026865, 434030708, 356941165, 23639568, 280181217, 40258263, 214478740, 175114921, 372707370, 168922815, 224538394, 40671590, 431834618, 344464425, 162980916, 374734277, 304719484, 534490310, 426098291, 203642081, 306336786, 32925639, 496020406, 259448702, 216198435, 36693331, 445566883, 69831194, 48784982, 493924609, 119258832, 180266939, 90259229, 13261221, 494666549, 412518886, 115831918, 185869303, 58411189, 516384759, 19553780, 353117092, 56961244, 12257186, 290247928, 85105459, 432254870, 243958727, 114715043, 19453866, 33328442, 511350819, 201412463, 178521479, 161615907, 384528990, 73993717, 475634115, 493144151, 300580302, 25332031, 442748086, 121375660, 396119381, 268142742, 184052560, 511666840, 518375741, 443775603, 30255536, 397042349, 104481561, 299715298, 405109979, 70730073, 13472774, 251075799, 230318632, 175230988, 332018790, 129704742, 263580611, 415816571, 465818087, 278117452, 107486614, 40770479, 531212138, 71519568, 489587875, 303201127, 353974266, 324200486, 149290844, 362713632, 144868405, 304713234, 185668782, 432567243, 389275559, 328083675, 131989592, 192878015, 507578671, 388332572, 290633509, 432688989, 372974812, 480894462, 415179039, 458328689, 33315922, 437922075, 320024442, 397485709, 114680, 175929383, 503748703, 435104051, 284299004, 368575362, 184286165, 317817601, 440170955, 228415150, 27458441, 403756367, 94954425, 75520957, 500637888, 524809531, 353646329, 32431096, 262977935, 194044558, 505283617, 428126774, 342020247, 333810521, 350869882, 215676003, 304965469, 309790120, 515125391, 143269407, 37017087, 400950808, 19545303, 422036186, 410880441, 28913414, 409428614, 311691345, 531517977, 62571016, 305367630, 154323938, 226196486, 527396436, 148233211, 358420780, 272545579, 160279721, 152556776, 108667271, 428604370, 92155962, 86910415, 111406770, 51851590, 476276466, 449686724, 355713930, 338401698, 198812246, 375481758, 49093824, 65191066, 389480253, 87108556, 466029624, 9825620, 513182133, 92387811, 37974251, 218889983, 434030708, 23639568, 40258263, 175114921, 168922815, 40671590, 344464425, 374734277, 534490310, 203642081, 32925639, 259448702, 36693331, 69831194, 493924609, 180266939, 13261221, 412518886, 185869303, 516384759, 353117092, 12257186, 85105459, 243958727, 19453866, 511350819, 178521479, 384528990, 475634115, 300580302, 442748086, 396119381, 184052560, 518375741, 30255536, 104481561, 405109979, 13472774, 230318632, 332018790, 263580611, 465818087, 107486614, 531212138, 489587875, 353974266, 149290844, 144868405, 185668782, 389275559, 131989592, 507578671, 290633509, 372974812, 415179039, 33315922, 320024442, 114680, 503748703, 284299004, 184286165, 440170955, 27458441, 94954425, 500637888, 353646329, 262977935, 505283617, 342020247, 350869882, 304965469, 515125391, 37017087, 19545303, 410880441, 409428614, 531517977, 305367630, 226196486, 148233211, 272545579, 152556776, 428604370, 86910415, 51851590, 449686724, 338401698, 375481758, 65191066, 87108556, 9825620, 92387811, 218889983, 23639568, 175114921, 40671590, 374734277, 203642081, 259448702, 69831194, 180266939, 412518886, 516384759, 12257186, 243958727, 511350819, 384528990, 300580302, 396119381, 518375741, 104481561, 13472774, 332018790, 465818087, 531212138, 353974266, 144868405, 389275559, 507578671, 372974812, 33315922, 114680, 284299004, 440170955, 94954425, 353646329, 505283617, 350869882, 515125391, 19545303, 409428614, 305367630, 148233211, 152556776, 86910415, 449686724, 375481758, 87108556, 92387811, 23639568, 40671590, 203642081, 69831194, 412518886, 12257186, 511350819, 300580302, 518375741, 13472774, 465818087, 353974266, 389275559, 372974812, 114680, 440170955, 353646329, 350869882, 19545303, 305367630, 152556776, 449686724, 87108556, 23639568, 203642081, 412518886, 511350819, 518375741, 465818087, 389275559, 114680, 353646329, 19545303, 152556776, 87108556, 203642081, 511350819, 465818087, 114680, 19545303, 87108556, 511350819, 114680, 19545303, 87108556, 511350819, 114680, 87108556, 114680, 87108556, 114680, 87108556, 114680, 87108556, 114680, 114680, 114680, 114680, 114680, 114680, 114680, 114680};
+
+static const FFTSHORT W_bwd_avx2_1024_536856577[1040] = {114680, 114680, 114680, 114680, 114680, 114680, 114680, 114680, 114680, 449748021, 114680, 449748021, 114680, 449748021, 114680, 449748021, 114680, 25505758, 449748021, 517311274, 114680, 25505758, 449748021, 517311274, 114680, 71038490, 25505758, 333214496, 449748021, 384299801, 517311274, 183210248, 114680, 147581018, 71038490, 18480836, 25505758, 124337691, 333214496, 513217009, 449748021, 87169853, 384299801, 231488947, 517311274, 185986695, 183210248, 96685622, 114680, 163881765, 147581018, 182882311, 71038490, 523383803, 18480836, 236276275, 25505758, 524599391, 124337691, 467025383, 333214496, 496184987, 513217009, 444468766, 449748021, 161374819, 87169853, 449946162, 384299801, 388623366, 231488947, 127427963, 517311274, 21731186, 185986695, 31572960, 183210248, 441902152, 96685622, 252557573, 114680, 503540655, 163881765, 29277906, 147581018, 391988172, 182882311, 5644439, 71038490, 204837787, 523383803, 432375016, 18480836, 140737196, 236276275, 152327587, 25505758, 292897850, 524599391, 20471818, 124337691, 356589638, 467025383, 277407875, 333214496, 162122300, 496184987, 361741656, 513217009, 317966594, 444468766, 527030957, 449748021, 471665511, 161374819, 198454879, 87169853, 485004987, 449946162, 108252207, 384299801, 264310998, 388623366, 310660091, 231488947, 5338600, 127427963, 125976136, 517311274, 499839490, 21731186, 231891108, 185986695, 194836330, 31572960, 273878642, 183210248, 36218689, 441902152, 509398136, 96685622, 352570412, 252557573, 33107874, 114680, 216832135, 503540655, 121677538, 163881765, 246223068, 29277906, 404866985, 147581018, 351187795, 391988172, 387565733, 182882311, 47268702, 5644439, 429369963, 71038490, 273275966, 204837787, 306537945, 523383803, 131746598, 432375016, 506601041, 18480836, 352804017, 140737196, 94108491, 236276275, 61222462, 152327587, 358335098, 25505758, 517402711, 292897850, 451751118, 524599391, 183739485, 20471818, 350987274, 124337691, 523595356, 356589638, 42931968, 467025383, 500163246, 277407875, 503930938, 333214496, 2366267, 162122300, 192392152, 496184987, 367933762, 361741656, 496598314, 513217009, 102825869, 317966594, 498882326, 444468766, 23674444, 527030957, 70826953, 449748021, 147376324, 471665511, 487762753, 161374819, 338044331, 198454879, 181142647, 87169853, 60580111, 485004987, 425449807, 449946162, 444700615, 108252207, 428189306, 384299801, 376576856, 264310998, 178435797, 388623366, 9460141, 310660091, 382532639, 231488947, 474285561, 5338600, 225165232, 127427963, 507943163, 125976136, 114820391, 517311274, 135905769, 499839490, 393587170, 21731186, 227066457, 231891108, 321180574, 185986695, 203046056, 194836330, 108729803, 31572960, 342812019, 273878642, 504425481, 183210248, 12047046, 36218689, 461335620, 441902152, 133100210, 509398136, 308441427, 96685622, 219038976, 352570412, 168281215, 252557573, 101752526, 33107874, 360927194, 114680, 139370868, 216832135, 98934502, 503540655, 78527888, 121677538, 55962115, 163881765, 104167588, 246223068, 148524005, 29277906, 343978562, 404866985, 208772902, 147581018, 104289334, 351187795, 232143343, 391988172, 174142945, 387565733, 212656091, 182882311, 233655450, 47268702, 465337009, 5644439, 496086098, 429369963, 258739125, 71038490, 121040006, 273275966, 407151835, 204837787, 361625589, 306537945, 285780778, 523383803, 466126504, 131746598, 237141279, 432375016, 139814228, 506601041, 93080974, 18480836, 25189737, 352804017, 268713835, 140737196, 415480917, 94108491, 511524546, 236276275, 43712426, 61222462, 462862860, 152327587, 375240670, 358335098, 335444114, 25505758, 503528135, 517402711, 422141534, 292897850, 104601707, 451751118, 246608649, 524599391, 479895333, 183739485, 517302797, 20471818, 478445388, 350987274, 421024659, 124337691, 42190028, 523595356, 446597348, 356589638, 417597745, 42931968, 488071595, 467025383, 91289694, 500163246, 320658142, 277407875, 40836171, 503930938, 230519791, 333214496, 110758286, 2366267, 232137093, 162122300, 373875661, 192392152, 105021959, 496184987, 312318183, 367933762, 164149207, 361741656, 322377837, 496598314, 256675360, 513217009, 179915412, 102825869, 254829712, 317966594, 422396587, 498882326, 378080670, 444468766, 413030792, 23674444, 343786578, 527030957, 432443687, 70826953, 388025747, 449748021, 154354313, 147376324, 343956995, 471665511, 177661899, 487762753, 117005700, 161374819, 508482541, 338044331, 190674740, 198454879, 200000285, 181142647, 167694494, 87169853, 13448629, 60580111, 67786462, 485004987, 253013016, 425449807, 209165195, 449946162, 65195647, 444700615, 499510452, 108252207, 25231598, 428189306, 42288102, 384299801, 279479507, 376576856, 304111577, 264310998, 490282540, 178435797, 69606823, 388623366, 355133937, 9460141, 122181761, 310660091, 150337188, 382532639, 454389500, 231488947, 165501278, 474285561, 502075022, 5338600, 320247982, 225165232, 110960897, 127427963, 108306096, 507943163, 42775821, 125976136, 494263593, 114820391, 66053174, 517311274, 502147867, 135905769, 140608509, 499839490, 225604348, 393587170, 372990165, 21731186, 484937182, 227066457, 321192033, 231891108, 216804920, 321180574, 1480868, 185986695, 55852649, 203046056, 142636753, 194836330, 102071844, 108729803, 67000903, 31572960, 453861037, 342812019, 445178671, 273878642, 378099158, 504425481, 20112248, 183210248, 133222903, 12047046, 19541014, 36218689, 429613307, 461335620, 149894432, 441902152, 443689564, 133100210, 124962170, 509398136, 197198636, 308441427, 205197106, 96685622, 33433502, 219038976, 492091815, 352570412, 269345254, 168281215, 83761561, 252557573, 454738809, 101752526, 269839778, 33107874, 161819895, 360927194, 22066149, 114680, 478698314, 139370868, 106981354, 216832135, 258604551, 98934502, 70476085, 503540655, 531203596, 78527888, 466353609, 121677538, 128271566, 55962115, 245525180, 163881765, 88680060, 104167588, 213013858, 246223068, 73199564, 148524005, 223516913, 29277906, 18473831, 343978562, 298399851, 404866985, 36371986, 208772902, 265994372, 147581018, 284663782, 104289334, 127556487, 351187795, 19498768, 232143343, 213813495, 391988172, 360831128, 174142945, 347909944, 387565733, 335957634, 212656091, 425257772, 182882311, 448506776, 233655450, 99049339, 47268702, 219028698, 465337009, 106179457, 5644439, 47622005, 496086098, 32908903, 429369963, 231618990, 258739125, 249895925, 71038490, 398065510, 121040006, 394530249, 273275966, 244498514, 407151835, 40443297, 204837787, 241699752, 361625589, 292647278, 306537945, 182303387, 285780778, 133681603, 523383803, 394423931, 466126504, 251011541, 131746598, 522383017, 237141279, 452337825, 432375016, 496425350, 139814228, 479664699, 506601041, 400495878, 93080974, 4783347, 18480836, 214193628, 25189737, 495993622, 352804017, 243879793, 268713835, 112445583, 140737196, 509840000, 415480917, 166181367, 94108491, 91158618, 511524546, 41747099, 236276275, 222534532, 43712426, 223762883, 61222462, 503531992, 462862860, 276843861, 152327587, 295103010, 375240670, 33592502, 358335098, 247301465, 335444114, 521766133, 25505758, 314283015, 503528135, 301800424, 517402711, 100389951, 422141534, 101162363, 292897850, 255058417, 104601707, 364747520, 451751118, 298046713, 246608649, 437073848, 524599391, 319925091, 479895333, 321693392, 183739485, 214099683, 517302797, 306639656, 20471818, 127180224, 478445388, 213924796, 350987274, 147784740, 421024659, 266260723, 124337691, 143578167, 42190028, 386491323, 523595356, 468619640, 446597348, 414348012, 356589638, 502470314, 417597745, 17378732, 42931968, 309178098, 488071595, 180665793, 467025383, 126414985, 91289694, 506114751, 500163246, 5055261, 320658142, 112956482, 277407875, 268264562, 40836171, 236322299, 503930938, 249186365, 230519791, 470880968, 333214496, 137310575, 110758286, 134575322, 2366267, 272420049, 232137093, 203922139, 162122300, 118967315, 373875661, 33788768, 192392152, 518668299, 105021959, 127411031, 496184987, 357598740, 312318183, 335582142, 367933762, 364064399, 164149207, 226244709, 361741656, 276540337, 322377837, 389944846, 496598314, 14815871, 256675360, 369808237, 513217009, 507216091, 179915412, 118502093, 102825869, 46493259, 254829712, 106852797, 317966594, 139014497, 422396587, 308624699, 498882326, 362351717, 378080670, 126000737, 444468766, 309362438, 413030792, 347207710, 23674444, 503326274, 343786578, 248130815, 527030957, 500530342, 432443687, 314086026, 70826953, 491566169, 388025747, 244353919, 449748021, 105618644, 154354313, 115884972, 147376324, 161023512, 343956995, 270795727, 471665511, 114252076, 177661899, 2023409, 487762753, 445719737, 117005700, 101416308, 161374819, 101442413, 508482541, 92627437, 338044331, 468673296, 190674740, 11309479, 198454879, 144774569, 200000285, 80820240, 181142647, 250035155, 167694494, 469712832, 87169853, 269182095, 13448629, 474436655, 60580111, 189402499, 67786462, 305018019, 485004987, 58094222, 253013016, 503365825, 425449807, 230826943, 209165195, 113426868, 449946162, 264757051, 65195647, 119078934, 444700615, 511196463, 499510452, 293200864, 108252207, 107822807, 25231598, 93417439, 428189306, 282546729, 42288102, 221996070, 384299801, 2898718, 279479507, 463503910, 376576856, 189123158, 304111577, 259541413, 264310998, 457372521, 490282540, 268772900, 178435797, 415595747, 69606823, 204637319, 388623366, 397154297, 355133937, 193869954, 9460141, 451054690, 122181761, 84987707, 310660091, 419448093, 150337188, 50273899, 382532639, 426095069, 454389500, 295046806, 231488947, 353914139, 165501278, 447286850, 474285561, 167793099, 502075022, 275258738, 5338600, 112649975, 320247982, 364031418, 225165232, 53980383, 110960897, 437364340, 127427963, 261339436, 108306096, 146552250, 507943163, 496016130, 42775821, 67726413, 125976136, 291978903, 494263593, 209952525, 114820391, 276526329, 66053174, 363333498, 517311274, 36079845, 502147867, 355326679, 135905769, 135242550, 140608509, 322154623, 499839490, 181396090, 225604348, 504298007, 393587170, 443881873, 372990165, 306349536, 21731186, 436351566, 484937182, 190437655, 227066457, 331365049, 321192033, 180704904, 231891108, 14762238, 216804920, 88405993, 321180574, 334535595, 1480868, 487926894, 185986695, 302049369, 55852649, 192366511, 203046056, 310942399, 142636753, 484288766, 194836330, 282361107, 102071844, 158795701, 108729803, 151759567, 67000903, 75536034, 31572960, 136445011, 453861037, 211494066, 342812019, 106070960, 445178671, 7838033, 273878642, 251031080, 378099158, 93929664, 504425481, 215492919, 20112248, 198910654, 183210248, 71083796, 133222903, 428780738, 12047046, 457293697, 19541014, 106764976, 36218689, 311125032, 429613307, 120082575, 461335620, 154977173, 149894432, 102706099, 441902152, 378356632, 443689564, 137528116, 133100210, 252127714, 124962170, 503809977, 509398136, 153567247, 197198636, 377405482, 308441427, 493667576, 205197106, 223515434, 96685622, 195485030, 33433502, 278493106, 219038976, 281119426, 492091815, 473648431, 352570412, 427349575, 269345254, 198482541, 168281215, 213918880, 83761561, 318972959, 252557573, 186633743, 454738809, 48854773, 101752526, 143394405, 269839778, 502506235, 33107874, 161195651, 161819895, 206437608, 360927194, 438016588, 22066149, 149245135};
+
+/* Byte shuffles for FFT_sample_small_avx2: row k moves the 16-bit lanes
+   selected by the bits of k to the front, in order. */
+
+static const unsigned char sample_compress_avx2[256][16] = {
+    {128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {6, 7, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 128, 128, 128, 128, 128, 128, 128, 128},
+    {8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128},
+    {6, 7, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 8, 9, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 128, 128, 128, 128, 128, 128},
+    {10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128},
+    {6, 7, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 10, 11, 128, 128, 128, 128, 128, 128},
+    {8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128},
+    {6, 7, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 128, 128, 128, 128},
+    {12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {6, 7, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 128, 128, 128, 128, 128, 128},
+    {8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128},
+    {6, 7, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 128, 128, 128, 128},
+    {10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128},
+    {6, 7, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 128, 128, 128, 128},
+    {8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128},
+    {4, 5, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128},
+    {6, 7, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128},
+    {4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 128, 128},
+    {14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {6, 7, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 14, 15, 128, 128, 128, 128, 128, 128},
+    {8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128},
+    {6, 7, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 128, 128, 128, 128},
+    {10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128},
+    {6, 7, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 10, 11, 14, 15, 128, 128, 128, 128},
+    {8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128},
+    {4, 5, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128},
+    {6, 7, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128},
+    {4, 5, 6, 7, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 14, 15, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 14, 15, 128, 128},
+    {12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {4, 5, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {6, 7, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {4, 5, 6, 7, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15, 128, 128, 128, 128},
+    {8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {4, 5, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128},
+    {6, 7, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128},
+    {4, 5, 6, 7, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 14, 15, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 14, 15, 128, 128},
+    {10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {2, 3, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {4, 5, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {2, 3, 4, 5, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128},
+    {6, 7, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {2, 3, 6, 7, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128},
+    {4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128},
+    {2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 10, 11, 12, 13, 14, 15, 128, 128},
+    {8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128, 128, 128},
+    {0, 1, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {2, 3, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128},
+    {4, 5, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 4, 5, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128},
+    {2, 3, 4, 5, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128},
+    {0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128},
+    {6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128, 128, 128},
+    {0, 1, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128},
+    {2, 3, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128},
+    {0, 1, 2, 3, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128},
+    {4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128, 128, 128},
+    {0, 1, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128},
+    {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 128, 128},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}
+};
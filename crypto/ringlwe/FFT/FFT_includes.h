@@ -14,34 +14,137 @@
 #include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
+#include <openssl/opensslconf.h>
+
+/* Polynomials are stored as 16-bit coefficients (every q in the shipped
+   parameter sets is below 2^16).  Arithmetic widens to FFTSHORT/FFTLONG in
+   registers only, so all results must be fully reduced before they are
+   written back to a RINGELT array. */
+#ifndef RINGELT
+#define RINGELT uint16_t
+#endif
+
+/* Largest ring dimension m any parameter set may use, and so the size of
+   fixed per-polynomial buffers; a multiple of 64. */
+#define RINGLWE_MAX_M 4096
+
+/* AVX2 kernels (FFT_avx2.c) are built for x86_64 whenever the compiler
+   supports per-function target attributes, and are used when
+   OPENSSL_ia32cap_P reports AVX2 and OS support for the YMM state. */
+#if defined(OPENSSL_CPUID_OBJ) && !defined(OPENSSL_NO_ASM) && \
+    (defined(__x86_64) || defined(__x86_64__)) && \
+    (defined(__clang__) || (defined(__GNUC__) && \
+     (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+# define FFT_AVX2
+extern unsigned int OPENSSL_ia32cap_P[];
+# define FFT_AVX2_CAPABLE (OPENSSL_ia32cap_P[2]&(1<<5))
+#endif
 
-#define FFTLONG uint_fast64_t
-#define PRIuFFTLONG PRIuFAST64
-#define FFTSHORT uint_fast32_t
-#define PRIuFFTSHORT PRIuFAST32
+#define FFTLONG uint64_t
+#define PRIuFFTLONG PRIu64
+#define FFTSHORT uint32_t
+#define PRIuFFTSHORT PRIu32
 
 #define ADD(x, a, b) \
 do {\
         x = (a) + (b);\
 } while (0)
 
-#define MUL_MOD(x, a, b, q) \
+/* Constant-time conditional subtraction: maps x in [0, 2q) to [0, q).
+   Requires 2q < 2^31. */
+#define CSUB(x, q) \
 do {\
-        uint64_t x64 = (uint64_t) (a)*(b);\
-        x64 = x64 % (q);\
-        x = (FFTSHORT) x64;\
-} while(0)
+        FFTSHORT _d = (FFTSHORT) (x) - (q);\
+        x = _d + ((q) & (0 - (_d >> 31)));\
+} while (0)
 
 #define ADD_MOD(x, a, b, q) \
 do {\
-        x = (a) + (b);\
-        x -= (x >= (q)) ? (q) : 0;\
+        FFTSHORT _s = (FFTSHORT) (a) + (b);\
+        CSUB(_s, q);\
+        x = _s;\
 } while (0)
 
 #define SUB_MOD(x, a, b, q) \
 do {\
-        x = (a) + ((q) - (b));\
-        x -= (x >= (q)) ? (q) : 0;\
+        FFTSHORT _s = (FFTSHORT) (a) + ((q) - (b));\
+        CSUB(_s, q);\
+        x = _s;\
+} while (0)
+
+/* Montgomery arithmetic with R = 2^32, qinv = -q^-1 mod 2^32.
+   MONT_REDUCE returns t*R^-1 mod q in [0, 2q) for any t < q*2^32.
+   Twiddle factors, Bluestein chirps and scaling constants are stored
+   premultiplied by R mod q, so MUL_MONT of a residue by a table entry
+   yields the plain product, with no division anywhere. */
+#define MONT_REDUCE(x, t, q, qinv) \
+do {\
+        FFTLONG _t = (t);\
+        FFTSHORT _u = (FFTSHORT) _t * (qinv);\
+        x = (FFTSHORT) ((_t + (FFTLONG) _u * (q)) >> 32);\
+} while (0)
+
+/* x = a*b*R^-1 mod q in [0, 2q); x must not be a RINGELT for q > 2^15 */
+#define MUL_MONT(x, a, b, q, qinv) \
+        MONT_REDUCE(x, (FFTLONG) (a) * (b), q, qinv)
+
+/* As MUL_MONT, fully reduced to [0, q) */
+#define MUL_MONT_RED(x, a, b, q, qinv) \
+do {\
+        FFTSHORT _r;\
+        MUL_MONT(_r, a, b, q, qinv);\
+        CSUB(_r, q);\
+        x = _r;\
+} while (0)
+
+/* Barrett multiplication of two residues a, b < q < 2^16, for the
+   point-wise operations where neither operand is a fixed constant.
+   mu = BARRETT_MU(q) = floor(2^32 / q); the quotient estimate is off
+   by at most one, so a single CSUB completes the reduction. */
+#define BARRETT_MU(q) ((FFTSHORT) ((((FFTLONG) 1) << 32) / (q)))
+
+#define MUL_BARRETT(x, a, b, q, mu) \
+do {\
+        FFTSHORT _p = (FFTSHORT) (a) * (b);\
+        FFTSHORT _e = (FFTSHORT) (((FFTLONG) _p * (mu)) >> 32);\
+        _p -= _e * (q);\
+        CSUB(_p, q);\
+        x = _p;\
+} while (0)
+
+/* Butterflies of the transforms generated by util/ringlwe_fft.pl.  BFLY_GS
+   is the Gentleman-Sande butterfly (a, b) <- (a + b, (a - b)*w) of the
+   forward transforms and BFLY_CT the Cooley-Tukey butterfly
+   (a, b) <- (a + b*w, a - b*w) of the backward ones, with w in Montgomery
+   form; the _1 forms are for w = 1.  Values are kept in [0, r): r = q
+   with mul = MUL_MONT_RED, or lazily r = 2q with mul = MUL_MONT. */
+#define BFLY_GS(a, b, w, q, r, qinv, mul) \
+do {\
+        FFTSHORT _b = (a) + (r) - (b);\
+        ADD_MOD(a, a, b, r);\
+        mul(b, _b, w, q, qinv);\
+} while (0)
+
+#define BFLY_GS_1(a, b, r) \
+do {\
+        FFTSHORT _b = (a);\
+        ADD_MOD(a, a, b, r);\
+        SUB_MOD(b, _b, b, r);\
+} while (0)
+
+#define BFLY_CT(a, b, w, q, r, qinv, mul) \
+do {\
+        FFTSHORT _b;\
+        mul(_b, b, w, q, qinv);\
+        SUB_MOD(b, a, _b, r);\
+        ADD_MOD(a, a, _b, r);\
+} while (0)
+
+#define BFLY_CT_1(a, b, r) \
+do {\
+        FFTSHORT _b = (b);\
+        SUB_MOD(b, a, _b, r);\
+        ADD_MOD(a, a, _b, r);\
 } while (0)
 
 /*Needed for indexing in the FFT*/
@@ -54,8 +157,9 @@ do {\
 /*v = e0*b, multiply and add in the ring. All done in the FFT / CRT domain, so point-wise multiplication and addition*/
 #define POINTWISE_MUL(v, b, e0, m, q)		\
   do {   uint16_t _i;\
+	const FFTSHORT _mu = BARRETT_MU(q);\
 	for (_i = 0; _i < m; ++_i) {\
-		MUL_MOD((v)[_i], (e0)[_i], (b)[_i], (q));\
+		MUL_BARRETT((v)[_i], (e0)[_i], (b)[_i], (q), _mu);\
 	}\
 } while(0)
 
@@ -69,16 +173,48 @@ do {\
 
 
 /*v = e0*b+e1, multiply and add in the ring. All done in the FFT / CRT domain, so point-wise multiplication and addition*/
+#ifdef FFT_AVX2
+# define POINTWISE_MUL_ADD_AVX2(i, v, b, e0, e1, m, q, mu) \
+  do {\
+	if (FFT_AVX2_CAPABLE)\
+		i = FFT_pointwise_mul_add_avx2(v, b, e0, e1, m, q, mu);\
+} while(0)
+#else
+# define POINTWISE_MUL_ADD_AVX2(i, v, b, e0, e1, m, q, mu)
+#endif
+
 #define POINTWISE_MUL_ADD(v, b, e0, e1, m, q)	\
-    do {  uint16_t _i;\
-	for (_i = 0; _i < m; ++_i) {\
-		MUL_MOD((v)[_i], (e0)[_i], (b)[_i], (q));\
+    do {  uint16_t _i = 0;\
+	const FFTSHORT _mu = BARRETT_MU(q);\
+	POINTWISE_MUL_ADD_AVX2(_i, v, b, e0, e1, m, q, _mu);\
+	for (; _i < m; ++_i) {\
+		MUL_BARRETT((v)[_i], (e0)[_i], (b)[_i], (q), _mu);\
 		ADD_MOD((v)[_i], (v)[_i], (e1)[_i], (q));\
 	}\
 } while(0)
 
 
 
+/*x = x*w*R^-1, lazily reduced to [0, 2q). For the CRT-domain filters of Bluestein's and Rader's methods, where w is a table in Montgomery form*/
+#ifdef FFT_AVX2
+# define POINTWISE_MUL_MONT_AVX2(i, x, w, n, q, qinv) \
+  do {\
+	if (FFT_AVX2_CAPABLE)\
+		i = FFT_pointwise_mul_mont_avx2(x, w, n, q, qinv);\
+} while(0)
+#else
+# define POINTWISE_MUL_MONT_AVX2(i, x, w, n, q, qinv)
+#endif
+
+#define POINTWISE_MUL_MONT(x, w, n, q, qinv)	\
+    do {  FFTSHORT _i = 0;\
+	POINTWISE_MUL_MONT_AVX2(_i, x, w, n, q, qinv);\
+	for (; _i < n; ++_i) {\
+		MUL_MONT((x)[_i], (x)[_i], (w)[_i], (q), (qinv));\
+	}\
+} while(0)
+
+
 /*Map a length m object in the ring F_q[x]/<x^m-1> to a length m-1 object in the ring F_q[x]/<1+x+...+x^{m-1}>*/
 #define MAPTOCYCLOTOMIC(v, m, q)		\
     do {  uint16_t _i;\
@@ -88,34 +224,68 @@ do {\
 		v[m-1] = 0;\
 	} while(0)
 
+/* Transforms for any supported (n, q), with the tables computed on first
+   use (FFT_param.c): n a power of two with q = 1 mod 2n, or an odd prime
+   with q = 1 mod n, q prime.  For n prime the Bluestein convolution has
+   length the power of two N >= 2n-1, which bounds n as FFT_PARAM_MAX_N
+   bounds n and N. */
+#define FFT_PARAM_MAX_N RINGLWE_MAX_M
+
+typedef struct fft_param_st FFT_PARAM;
+
+const FFT_PARAM *FFT_PARAM_get(uint32_t n, RINGELT q, RINGELT root);
+void FFT_PARAM_cleanup(void);
+void FFT_PARAM_forward(const FFT_PARAM *fp, RINGELT *x);
+void FFT_PARAM_backward(const FFT_PARAM *fp, RINGELT *x);
+void FFT_PARAM_backward_mul(const FFT_PARAM *fp, RINGELT *x, const RINGELT *a, const RINGELT *b);
+
 #endif
 
-void _FFT_forward_1024_40961(FFTSHORT x[1024]);
-void _FFT_backward_1024_40961(FFTSHORT x[1024]);
+void _FFT_forward_1024_40961(RINGELT *x);
+void _FFT_backward_1024_40961(RINGELT *x);
+void _FFT_backward_mul_1024_40961(RINGELT *x, const RINGELT *a, const RINGELT *b);
+
+void _FFT_forward_821_49261(RINGELT *x);
+void _FFT_backward_821_49261(RINGELT *x);
+void _FFT_backward_mul_821_49261(RINGELT *x, const RINGELT *a, const RINGELT *b);
 
-void _FFT_forward_821_49261(FFTSHORT x[821]);
-void _FFT_backward_821_49261(FFTSHORT x[821]);
+void _FFT_forward_739_47297(RINGELT *x);
+void _FFT_backward_739_47297(RINGELT *x);
+void _FFT_backward_mul_739_47297(RINGELT *x, const RINGELT *a, const RINGELT *b);
 
-void _FFT_forward_739_47297(FFTSHORT x[739]);
-void _FFT_backward_739_47297(FFTSHORT x[739]);
+void _FFT_forward_631_44171(RINGELT *x);
+void _FFT_backward_631_44171(RINGELT *x);
+void _FFT_backward_mul_631_44171(RINGELT *x, const RINGELT *a, const RINGELT *b);
 
-void _FFT_forward_631_44171(FFTSHORT x[631]);
-void _FFT_backward_631_44171(FFTSHORT x[631]);
+void _FFT_forward_541_41117(RINGELT *x);
+void _FFT_backward_541_41117(RINGELT *x);
+void _FFT_backward_mul_541_41117(RINGELT *x, const RINGELT *a, const RINGELT *b);
 
-void _FFT_forward_541_41117(FFTSHORT x[541]);
-void _FFT_backward_541_41117(FFTSHORT x[541]);
+void _FFT_forward_512_25601(RINGELT *x);
+void _FFT_backward_512_25601(RINGELT *x);
+void _FFT_backward_mul_512_25601(RINGELT *x, const RINGELT *a, const RINGELT *b);
 
-void _FFT_forward_512_25601(FFTSHORT x[512]);
-void _FFT_backward_512_25601(FFTSHORT x[512]);
+void _FFT_forward_433_35507(RINGELT *x);
+void _FFT_backward_433_35507(RINGELT *x);
+void _FFT_backward_mul_433_35507(RINGELT *x, const RINGELT *a, const RINGELT *b);
 
-void _FFT_forward_433_35507(FFTSHORT x[433]);
-void _FFT_backward_433_35507(FFTSHORT x[433]);
+void _FFT_forward_337_32353(RINGELT *x);	
+void _FFT_backward_337_32353(RINGELT *x);
+void _FFT_backward_mul_337_32353(RINGELT *x, const RINGELT *a, const RINGELT *b);
 
-void _FFT_forward_337_32353(FFTSHORT x[337]);	
-void _FFT_backward_337_32353(FFTSHORT x[337]);
+void _FFT_forward_256_15361(RINGELT *x);
+void _FFT_backward_256_15361(RINGELT *x);
+void _FFT_backward_mul_256_15361(RINGELT *x, const RINGELT *a, const RINGELT *b);
 
-void _FFT_forward_256_15361(FFTSHORT x[256]);
-void _FFT_backward_256_15361(FFTSHORT x[256]);
+/* Forward transforms of sampled secrets for the prime-m sets, by Rader's
+   algorithm under the single prime 536856577.  Each input coefficient
+   must be in [-8, 8] mod q; arbitrary inputs need _FFT_forward_*. */
+void _FFT_forward_small_821_49261(RINGELT *x);
+void _FFT_forward_small_739_47297(RINGELT *x);
+void _FFT_forward_small_631_44171(RINGELT *x);
+void _FFT_forward_small_541_41117(RINGELT *x);
+void _FFT_forward_small_433_35507(RINGELT *x);
+void _FFT_forward_small_337_32353(RINGELT *x);
 
 
 void FFT_forward_2048_8816641(FFTSHORT x[2048]);
@@ -130,4 +300,56 @@ void FFT_backward_1024_8816641(FFTSHORT x[1024]);
 void FFT_forward_1024_17633281(FFTSHORT x[1024]);
 void FFT_backward_1024_17633281(FFTSHORT x[1024]);
 
-
+void FFT_forward_2048_536856577(FFTSHORT x[2048]);
+void FFT_backward_2048_536856577(FFTSHORT x[2048]);
+
+void FFT_forward_1024_536856577(FFTSHORT x[1024]);
+void FFT_backward_1024_536856577(FFTSHORT x[1024]);
+
+#ifdef FFT_AVX2
+void FFT_twisted_forward_1024_40961_avx2(RINGELT x[1024]);
+void FFT_twisted_backward_1024_40961_avx2(RINGELT x[1024]);
+void FFT_twisted_backward_mul_1024_40961_avx2(RINGELT x[1024], const RINGELT a[1024], const RINGELT b[1024]);
+
+void FFT_twisted_forward_512_25601_avx2(RINGELT x[512]);
+void FFT_twisted_backward_512_25601_avx2(RINGELT x[512]);
+void FFT_twisted_backward_mul_512_25601_avx2(RINGELT x[512], const RINGELT a[512], const RINGELT b[512]);
+
+void FFT_twisted_forward_256_15361_avx2(RINGELT x[256]);
+void FFT_twisted_backward_256_15361_avx2(RINGELT x[256]);
+void FFT_twisted_backward_mul_256_15361_avx2(RINGELT x[256], const RINGELT a[256], const RINGELT b[256]);
+
+void FFT_forward_2048_8816641_avx2(FFTSHORT x[2048]);
+void FFT_backward_2048_8816641_avx2(FFTSHORT x[2048]);
+
+void FFT_forward_2048_17633281_avx2(FFTSHORT x[2048]);
+void FFT_backward_2048_17633281_avx2(FFTSHORT x[2048]);
+
+void FFT_forward_1024_8816641_avx2(FFTSHORT x[1024]);
+void FFT_backward_1024_8816641_avx2(FFTSHORT x[1024]);
+
+void FFT_forward_1024_17633281_avx2(FFTSHORT x[1024]);
+void FFT_backward_1024_17633281_avx2(FFTSHORT x[1024]);
+
+void FFT_forward_2048_536856577_avx2(FFTSHORT x[2048]);
+void FFT_backward_2048_536856577_avx2(FFTSHORT x[2048]);
+
+void FFT_forward_1024_536856577_avx2(FFTSHORT x[1024]);
+void FFT_backward_1024_536856577_avx2(FFTSHORT x[1024]);
+
+int FFT_pointwise_mul_add_avx2(RINGELT *v, const RINGELT *b,
+                               const RINGELT *e0, const RINGELT *e1,
+                               int m, FFTSHORT q, FFTSHORT mu);
+int FFT_pointwise_mul_mont_avx2(FFTSHORT *x, const FFTSHORT *w, int n,
+                                FFTSHORT q, FFTSHORT qinv);
+int FFT_sample_small_avx2(RINGELT *s, int *i, int n,
+                          const uint64_t *r, int nwords,
+                          RINGELT q, RINGELT B, RINGELT BB);
+int FFT_round_avx2(uint64_t *modular_rnd, uint64_t *cross_rnd,
+                   const RINGELT *v, const RINGELT *e2,
+                   const uint64_t *rnd, int n, RINGELT q,
+                   RINGELT q_1_4, RINGELT q_2_4, RINGELT q_3_4,
+                   RINGELT hi);
+int FFT_rec_avx2(uint64_t *r, const RINGELT *w, const uint64_t *b, int n,
+                 RINGELT r0_l, RINGELT r0_u, RINGELT r1_l, RINGELT r1_u);
+#endif
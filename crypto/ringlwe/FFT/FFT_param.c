@@ -0,0 +1,561 @@
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/* Number Theoretic Transforms for any supported (n, q), with the roots of
+unity, twist factors and Bluestein tables computed at first use instead of
+generated into FFT_constants.h and FFT_<n>_<q>.c:
+	n a power of two:	the negacyclic transform, for multiplication in
+				F_q[x] / <x^n+1>
+	n an odd prime:		the cyclic transform of length n by Bluestein's
+				method, for F_q[x] / <x^n-1>
+Given the same root, the outputs are those of the generated transforms.
+Each (n, q, root) is set up once and interned; FFT_PARAM_get hands every
+caller the same read-only object, which lives until FFT_PARAM_cleanup.
+Ring-LWE parameter sets keep the object they were prepared with, so for
+the library the cache lasts the whole process and FFT_PARAM_cleanup is
+only for callers of FFT_PARAM_get that use no parameter set afterwards,
+such as leak checks at exit. */
+
+#include <openssl/crypto.h>
+#include "FFT_includes.h"
+
+#define GS(a, b, w) BFLY_GS(a, b, w, q, q2, qinv, MUL_MONT)
+#define CT(a, b, w) BFLY_CT(a, b, w, q, q2, qinv, MUL_MONT)
+
+/* Cyclic transform of power-of-two length N mod a prime p < 2^29, lazily
+reduced to [0, 2p) throughout.  fw[m+j] and bw[m+j] are the twiddle factors
+of the j'th pair of a block of layer m (pairs x[i], x[i+m]), w^-(j*N/2m)
+and w^(j*N/2m) in Montgomery form, so that each layer reads a contiguous
+run of the table. */
+typedef struct {
+	FFTSHORT N, logN, p, pinv;
+	FFTSHORT *fw, *bw;
+} FFT_NTT;
+
+struct fft_param_st {
+	uint32_t n;
+	RINGELT q, root;
+	FFTSHORT qinv, mu;
+	FFTSHORT ninv;			/* n^-1 in Montgomery form */
+	/* n a power of two: the transform mod q itself, and psi^k and
+	   psi^-k * n^-1 in Montgomery form, psi = root */
+	FFT_NTT ntt;
+	FFTSHORT *twist, *untwist;
+	/* n prime: with z^2 = w^(+-1), w = root, X_k = z^(k^2) * sum_j
+	   x_j z^(j^2) z^-((k-j)^2), a convolution that is exact over the
+	   integers.  It is computed mod p0 < p1 and recombined by the CRT.
+	   chirp[d][j] = z^(j^2) mod q and filter[d][i] = the transform of
+	   z^-(j^2) * N^-1 mod p_i, all in Montgomery form, with d = 0 for
+	   the forward and d = 1 for the backward transform */
+	FFT_NTT crt[2];
+	FFTSHORT *chirp[2];
+	FFTSHORT *filter[2][2];
+	FFTSHORT p0invp1;		/* p0^-1 mod p1 in Montgomery form */
+	FFTSHORT rq, p0q;		/* 2^32 mod q, p0 * 2^32 mod q */
+	struct fft_param_st *next;
+};
+
+static FFT_PARAM *fft_params = NULL;
+
+/* Modular arithmetic for setting up the tables, where speed does not
+matter.  Every modulus is below 2^30. */
+static FFTSHORT mulmod(FFTSHORT a, FFTSHORT b, FFTSHORT q) {
+	return (FFTSHORT) (((FFTLONG) a * b) % q);
+}
+
+static FFTSHORT powmod(FFTSHORT b, FFTLONG e, FFTSHORT q) {
+	FFTSHORT r = 1;
+
+	b %= q;
+	while (e) {
+		if (e & 1)
+			r = mulmod(r, b, q);
+		b = mulmod(b, b, q);
+		e >>= 1;
+	}
+	return r;
+}
+
+static FFTSHORT invmod(FFTSHORT a, FFTSHORT q) {
+	return powmod(a, q - 2, q);
+}
+
+static FFTSHORT to_mont(FFTSHORT a, FFTSHORT q) {
+	return (FFTSHORT) (((FFTLONG) a << 32) % q);
+}
+
+/* -q^-1 mod 2^32 by Newton's iteration: q is its own inverse mod 2^3, and
+each step doubles the number of correct bits */
+static FFTSHORT mont_qinv(FFTSHORT q) {
+	FFTSHORT x = q;
+	int i;
+
+	for (i = 0; i < 4; ++i)
+		x *= 2 - q*x;
+	return 0 - x;
+}
+
+static int is_prime(FFTSHORT q) {
+	FFTSHORT d;
+
+	if (q < 2)
+		return 0;
+	for (d = 2; d*d <= q; ++d) {
+		if (q % d == 0)
+			return 0;
+	}
+	return 1;
+}
+
+static void ntt_free(FFT_NTT *t) {
+	if (t->fw)
+		OPENSSL_free(t->fw);
+	if (t->bw)
+		OPENSSL_free(t->bw);
+}
+
+/* Set up the transform of length N = 2^logN mod p, with w a primitive
+N'th root of unity */
+static int ntt_init(FFT_NTT *t, FFTSHORT logN, FFTSHORT p, FFTSHORT w) {
+	const FFTSHORT N = (FFTSHORT) 1 << logN;
+	FFTSHORT m, j, winv = invmod(w, p);
+
+	t->N = N;
+	t->logN = logN;
+	t->p = p;
+	t->pinv = mont_qinv(p);
+	t->fw = (FFTSHORT *) OPENSSL_malloc(N * sizeof(FFTSHORT));
+	t->bw = (FFTSHORT *) OPENSSL_malloc(N * sizeof(FFTSHORT));
+	if (t->fw == NULL || t->bw == NULL)
+		return 0;
+	t->fw[0] = t->bw[0] = to_mont(1, p);
+	for (m = 1; m < N; m <<= 1) {
+		for (j = 0; j < m; ++j) {
+			t->fw[m+j] = to_mont(powmod(winv, (FFTLONG) j * (N / (2*m)), p), p);
+			t->bw[m+j] = to_mont(powmod(w, (FFTLONG) j * (N / (2*m)), p), p);
+		}
+	}
+	return 1;
+}
+
+/*
+Gentleman-Sande, decimation-in-frequency FFT, leaving the output in
+bit-reversed order for ntt_backward: a radix-2 layer first if log2(N) is
+odd, then radix-4 stages over pairs of layers.
+*/
+static void ntt_forward(FFTSHORT *x, const FFT_NTT *t) {
+	const FFTSHORT N = t->N, q = t->p, q2 = 2*t->p, qinv = t->pinv;
+	const FFTSHORT *w = t->fw;
+	FFTSHORT i, j, m, h;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	m = N >> 1;
+	if (t->logN & 1) {
+		for (j = 0; j < m; ++j) {
+			a0 = x[j]; a1 = x[j+m];
+			GS(a0, a1, w[m+j]);
+			x[j] = a0; x[j+m] = a1;
+		}
+		m >>= 1;
+	}
+
+	/* Layers m and h = m/2 on x[i], x[i+h], x[i+m], x[i+m+h] */
+	for (; m >= 2; m >>= 2) {
+		h = m >> 1;
+		for (j = 0; j < h; ++j) {
+			w1 = w[m+j]; w2 = w[m+h+j]; w3 = w[h+j];
+			for (i = j; i < N; i += 2*m) {
+				a0 = x[i]; a1 = x[i+h]; a2 = x[i+m]; a3 = x[i+m+h];
+				GS(a0, a2, w1);
+				GS(a1, a3, w2);
+				GS(a0, a1, w3);
+				GS(a2, a3, w3);
+				x[i] = a0; x[i+h] = a1; x[i+m] = a2; x[i+m+h] = a3;
+			}
+		}
+	}
+}
+
+/*
+Cooley-Tukey, decimation-in-time FFT, inverting ntt_forward up to the
+factor N: radix-4 stages, then a radix-2 layer last if log2(N) is odd.
+*/
+static void ntt_backward(FFTSHORT *x, const FFT_NTT *t) {
+	const FFTSHORT N = t->N, q = t->p, q2 = 2*t->p, qinv = t->pinv;
+	const FFTSHORT *w = t->bw;
+	FFTSHORT i, j, m;
+	FFTSHORT a0, a1, a2, a3, w1, w2, w3;
+
+	/* Layers m and 2m on x[i], x[i+m], x[i+2m], x[i+3m] */
+	for (m = 1; 4*m <= N; m <<= 2) {
+		for (j = 0; j < m; ++j) {
+			w1 = w[m+j]; w2 = w[2*m+j]; w3 = w[3*m+j];
+			for (i = j; i < N; i += 4*m) {
+				a0 = x[i]; a1 = x[i+m]; a2 = x[i+2*m]; a3 = x[i+3*m];
+				CT(a0, a1, w1);
+				CT(a2, a3, w1);
+				CT(a0, a2, w2);
+				CT(a1, a3, w3);
+				x[i] = a0; x[i+m] = a1; x[i+2*m] = a2; x[i+3*m] = a3;
+			}
+		}
+	}
+
+	if (t->logN & 1) {
+		for (j = 0; j < m; ++j) {
+			a0 = x[j]; a1 = x[j+m];
+			CT(a0, a1, w[m+j]);
+			x[j] = a0; x[j+m] = a1;
+		}
+	}
+}
+
+/* The first root of unity of order exactly 2n (n a power of two) or n (n
+an odd prime) found among 2, 3, ...: a fixed choice, so that both ends of a
+key exchange agree on the transform */
+static FFTSHORT default_root(uint32_t n, FFTSHORT q) {
+	FFTSHORT x;
+
+	for (x = 2; x < q; ++x) {
+		if (n & 1) {
+			if (powmod(x, n, q) == 1)
+				return x;
+		} else if (powmod(x, n, q) == q - 1) {
+			return x;
+		}
+	}
+	return 0;
+}
+
+/* The two largest primes p0 < p1 < 2^29 with p = 1 mod N, and a primitive
+N'th root of unity mod each */
+static int crt_init(FFT_PARAM *fp, FFTSHORT logN) {
+	const FFTSHORT N = (FFTSHORT) 1 << logN;
+	FFTSHORT p[2], w[2], k, g;
+	int i = 1;
+
+	for (k = ((1U << 29) - 1) / N; k > 0 && i >= 0; --k) {
+		if (is_prime(k*N + 1))
+			p[i--] = k*N + 1;
+	}
+	if (i >= 0)
+		return 0;
+	for (i = 0; i < 2; ++i) {
+		for (g = 2; ; ++g) {
+			w[i] = powmod(g, (p[i] - 1) / N, p[i]);
+			if (powmod(w[i], N / 2, p[i]) == p[i] - 1)
+				break;
+		}
+		if (!ntt_init(&fp->crt[i], logN, p[i], w[i]))
+			return 0;
+	}
+	fp->p0invp1 = to_mont(invmod(p[0] % p[1], p[1]), p[1]);
+	fp->rq = to_mont(1, fp->q);
+	fp->p0q = to_mont(p[0] % fp->q, fp->q);
+	return 1;
+}
+
+static int bluestein_init(FFT_PARAM *fp) {
+	const uint32_t n = fp->n;
+	const FFTSHORT q = fp->q;
+	FFTSHORT logN, N, j, d, z[2], h;
+	FFTSHORT *f;
+	int dir, i;
+
+	for (logN = 1; ((FFTSHORT) 1 << logN) < 2*n - 1; ++logN)
+		;
+	N = (FFTSHORT) 1 << logN;
+	if (!crt_init(fp, logN))
+		return 0;
+
+	/* z = w^((n+1)/2), so z^2 = w; z^-1 for the backward transform */
+	z[0] = powmod(fp->root, (n + 1) / 2, q);
+	z[1] = invmod(z[0], q);
+	for (dir = 0; dir < 2; ++dir) {
+		fp->chirp[dir] = (FFTSHORT *) OPENSSL_malloc(n * sizeof(FFTSHORT));
+		if (fp->chirp[dir] == NULL)
+			return 0;
+		for (j = 0; j < n; ++j)
+			fp->chirp[dir][j] = to_mont(powmod(z[dir], (FFTLONG) j*j % n, q), q);
+
+		/* z^-(d^2) for d in (-n, n), with the negative d wrapped to N+d */
+		for (i = 0; i < 2; ++i) {
+			const FFT_NTT *t = &fp->crt[i];
+			FFTSHORT Ninv = invmod(N % t->p, t->p);
+
+			f = fp->filter[dir][i] = (FFTSHORT *) OPENSSL_malloc(N * sizeof(FFTSHORT));
+			if (f == NULL)
+				return 0;
+			memset(f, 0, N * sizeof(FFTSHORT));
+			for (d = 0; d < n; ++d) {
+				h = powmod(z[1-dir], (FFTLONG) d*d % n, q);
+				f[d] = h;
+				if (d)
+					f[N-d] = h;
+			}
+			ntt_forward(f, t);
+			for (j = 0; j < N; ++j)
+				f[j] = to_mont(mulmod(f[j] % t->p, Ninv, t->p), t->p);
+		}
+	}
+	return 1;
+}
+
+static int twist_init(FFT_PARAM *fp) {
+	const uint32_t n = fp->n;
+	const FFTSHORT q = fp->q;
+	FFTSHORT logn, j, psiinv = invmod(fp->root, q), ninv = invmod(n, q);
+
+	for (logn = 0; ((FFTSHORT) 1 << logn) < n; ++logn)
+		;
+	if (!ntt_init(&fp->ntt, logn, q, mulmod(fp->root, fp->root, q)))
+		return 0;
+	fp->twist = (FFTSHORT *) OPENSSL_malloc(n * sizeof(FFTSHORT));
+	fp->untwist = (FFTSHORT *) OPENSSL_malloc(n * sizeof(FFTSHORT));
+	if (fp->twist == NULL || fp->untwist == NULL)
+		return 0;
+	for (j = 0; j < n; ++j) {
+		fp->twist[j] = to_mont(powmod(fp->root, j, q), q);
+		fp->untwist[j] = to_mont(mulmod(powmod(psiinv, j, q), ninv, q), q);
+	}
+	return 1;
+}
+
+static void fft_param_free(FFT_PARAM *fp) {
+	int i;
+
+	ntt_free(&fp->ntt);
+	if (fp->twist)
+		OPENSSL_free(fp->twist);
+	if (fp->untwist)
+		OPENSSL_free(fp->untwist);
+	for (i = 0; i < 2; ++i) {
+		ntt_free(&fp->crt[i]);
+		if (fp->chirp[i])
+			OPENSSL_free(fp->chirp[i]);
+		if (fp->filter[i][0])
+			OPENSSL_free(fp->filter[i][0]);
+		if (fp->filter[i][1])
+			OPENSSL_free(fp->filter[i][1]);
+	}
+	OPENSSL_free(fp);
+}
+
+static FFT_PARAM *fft_param_new(uint32_t n, FFTSHORT q, FFTSHORT root) {
+	FFT_PARAM *fp;
+	int ok;
+
+	fp = (FFT_PARAM *) OPENSSL_malloc(sizeof(FFT_PARAM));
+	if (fp == NULL)
+		return NULL;
+	memset(fp, 0, sizeof(FFT_PARAM));
+	fp->n = n;
+	fp->q = (RINGELT) q;
+	fp->root = (RINGELT) root;
+	fp->qinv = mont_qinv(q);
+	fp->mu = BARRETT_MU(q);
+	fp->ninv = to_mont(invmod(n % q, q), q);
+	ok = (n & 1) ? bluestein_init(fp) : twist_init(fp);
+	if (!ok) {
+		fft_param_free(fp);
+		return NULL;
+	}
+	return fp;
+}
+
+static FFT_PARAM *fft_param_find(uint32_t n, FFTSHORT q, FFTSHORT root) {
+	FFT_PARAM *fp;
+
+	for (fp = fft_params; fp != NULL; fp = fp->next) {
+		if (fp->n == n && fp->q == q && fp->root == root)
+			return fp;
+	}
+	return NULL;
+}
+
+/* The transforms for (n, q), set up on the first call.  root is a
+primitive 2n'th root of unity for n a power of two and a primitive n'th
+root for n an odd prime, or 0 to take the first one there is.  NULL if
+(n, q, root) is not supported or memory runs out. */
+const FFT_PARAM *FFT_PARAM_get(uint32_t n, RINGELT q, RINGELT root) {
+	FFT_PARAM *fp, *fresh;
+	FFTSHORT N;
+
+	/* q must be an odd prime that has the roots */
+	if (q < 3 || !is_prime(q) || root >= q || n > FFT_PARAM_MAX_N)
+		return NULL;
+	if ((n & (n - 1)) == 0) {
+		if (n < 2 || (q - 1) % (2*n) != 0)
+			return NULL;
+		if (root != 0 && powmod(root, n, q) != (FFTSHORT) q - 1)
+			return NULL;
+	} else {
+		for (N = 1; N < 2*n - 1; N <<= 1)
+			;
+		if (N > FFT_PARAM_MAX_N || !is_prime(n) || (q - 1) % n != 0)
+			return NULL;
+		if (root != 0 && (root == 1 || powmod(root, n, q) != 1))
+			return NULL;
+	}
+	if (root == 0)
+		root = (RINGELT) default_root(n, q);
+
+	CRYPTO_r_lock(CRYPTO_LOCK_RINGLWE);
+	fp = fft_param_find(n, q, root);
+	CRYPTO_r_unlock(CRYPTO_LOCK_RINGLWE);
+	if (fp != NULL)
+		return fp;
+
+	/* Build the tables unlocked; should another thread get there first,
+	   its object is the one every caller shares */
+	fresh = fft_param_new(n, q, root);
+	if (fresh == NULL)
+		return NULL;
+	CRYPTO_w_lock(CRYPTO_LOCK_RINGLWE);
+	fp = fft_param_find(n, q, root);
+	if (fp == NULL) {
+		fresh->next = fft_params;
+		fft_params = fp = fresh;
+		fresh = NULL;
+	}
+	CRYPTO_w_unlock(CRYPTO_LOCK_RINGLWE);
+	if (fresh != NULL)
+		fft_param_free(fresh);
+	return fp;
+}
+
+/* Free every object FFT_PARAM_get has handed out, which must no longer be
+in use */
+void FFT_PARAM_cleanup(void) {
+	FFT_PARAM *fp;
+
+	CRYPTO_w_lock(CRYPTO_LOCK_RINGLWE);
+	while ((fp = fft_params) != NULL) {
+		fft_params = fp->next;
+		fft_param_free(fp);
+	}
+	CRYPTO_w_unlock(CRYPTO_LOCK_RINGLWE);
+}
+
+/*
+Bluestein's method on x0, which holds the n chirped inputs in [0, q): the
+convolution with the filter of direction dir, computed mod p0 and p1 and
+recombined by the CRT (Garner).  Leaves the n outputs, still to be chirped,
+in x0, in [0, 2q).  x1 is scratch.
+*/
+static void bluestein(const FFT_PARAM *fp, int dir, FFTSHORT *x0, FFTSHORT *x1) {
+	const FFTSHORT n = fp->n, q = fp->q, qinv = fp->qinv;
+	const FFTSHORT N = fp->crt[0].N;
+	const FFTSHORT q0 = fp->crt[0].p, q0inv = fp->crt[0].pinv;
+	const FFTSHORT q1 = fp->crt[1].p, q1inv = fp->crt[1].pinv;
+	FFTSHORT i, t;
+
+	memset((void *) (x0+n), 0, (N-n)*sizeof(FFTSHORT)); /*Pad with 0's*/
+	memcpy((void *) x1, (void *) x0, N*sizeof(FFTSHORT)); /*Copy x0 into x1*/
+
+	/*Cyclic convolution; the N^-1 scaling is folded into the filters*/
+	ntt_forward(x0, &fp->crt[0]);
+	ntt_forward(x1, &fp->crt[1]);
+	POINTWISE_MUL_MONT(x0, fp->filter[dir][0], N, q0, q0inv);
+	POINTWISE_MUL_MONT(x1, fp->filter[dir][1], N, q1, q1inv);
+	ntt_backward(x0, &fp->crt[0]);
+	ntt_backward(x1, &fp->crt[1]);
+
+	/*The convolution is x0 + q0*t with t = (x1 - x0) * q0^-1 mod q1,
+	  reduced mod q straight away*/
+	for (i = 0; i < n; ++i) {
+		CSUB(x0[i], q0);
+		CSUB(x1[i], q1);
+		MUL_MONT(t, x1[i] + q1 - x0[i], fp->p0invp1, q1, q1inv);
+		CSUB(t, q1);
+		MONT_REDUCE(x0[i], (FFTLONG) x0[i]*fp->rq + (FFTLONG) t*fp->p0q, q, qinv);
+	}
+}
+
+/* The forward transform: for n a power of two, premultiplication by psi^k
+and the cyclic transform with w = psi^2, output in bit-reversed order; for n
+prime, X_k = sum_j x_j w^(jk) in natural order */
+void FFT_PARAM_forward(const FFT_PARAM *fp, RINGELT *x) {
+	const FFTSHORT n = fp->n, q = fp->q, qinv = fp->qinv;
+	FFTSHORT x0[FFT_PARAM_MAX_N], x1[FFT_PARAM_MAX_N];
+	FFTSHORT i, t;
+
+	if (n & 1) {
+		for (i = 0; i < n; ++i)
+			MUL_MONT_RED(x0[i], x[i], fp->chirp[0][i], q, qinv);
+		bluestein(fp, 0, x0, x1);
+		for (i = 0; i < n; ++i)
+			MUL_MONT_RED(x[i], x0[i], fp->chirp[0][i], q, qinv);
+		return;
+	}
+
+	for (i = 0; i < n; ++i)
+		MUL_MONT(x0[i], x[i], fp->twist[i], q, qinv);
+	ntt_forward(x0, &fp->ntt);
+	for (i = 0; i < n; ++i) {
+		t = x0[i];
+		CSUB(t, q);
+		x[i] = (RINGELT) t;
+	}
+}
+
+/* The inverse of FFT_PARAM_forward, scaling by n^-1 included */
+void FFT_PARAM_backward(const FFT_PARAM *fp, RINGELT *x) {
+	const FFTSHORT n = fp->n, q = fp->q, qinv = fp->qinv;
+	FFTSHORT x0[FFT_PARAM_MAX_N], x1[FFT_PARAM_MAX_N];
+	FFTSHORT i, t;
+
+	if (n & 1) {
+		for (i = 0; i < n; ++i) {
+			MUL_MONT_RED(t, x[i], fp->ninv, q, qinv);
+			MUL_MONT_RED(x0[i], t, fp->chirp[1][i], q, qinv);
+		}
+		bluestein(fp, 1, x0, x1);
+		for (i = 0; i < n; ++i)
+			MUL_MONT_RED(x[i], x0[i], fp->chirp[1][i], q, qinv);
+		return;
+	}
+
+	for (i = 0; i < n; ++i)
+		x0[i] = x[i];
+	ntt_backward(x0, &fp->ntt);
+	for (i = 0; i < n; ++i)
+		MUL_MONT_RED(x[i], x0[i], fp->untwist[i], q, qinv);
+}
+
+/* x = FFT_PARAM_backward of the point-wise product a*b, for n prime mapped
+to F_q[x]/<1+x+...+x^{n-1}> as by MAPTOCYCLOTOMIC.  x may alias a or b. */
+void FFT_PARAM_backward_mul(const FFT_PARAM *fp, RINGELT *x, const RINGELT *a, const RINGELT *b) {
+	const FFTSHORT n = fp->n, q = fp->q, qinv = fp->qinv, mu = fp->mu;
+	FFTSHORT x0[FFT_PARAM_MAX_N], x1[FFT_PARAM_MAX_N];
+	FFTSHORT i, t, last;
+
+	if (n & 1) {
+		for (i = 0; i < n; ++i) {
+			MUL_BARRETT(t, a[i], b[i], q, mu);
+			MUL_MONT_RED(t, t, fp->ninv, q, qinv);
+			MUL_MONT_RED(x0[i], t, fp->chirp[1][i], q, qinv);
+		}
+		bluestein(fp, 1, x0, x1);
+		MUL_MONT_RED(last, x0[n-1], fp->chirp[1][n-1], q, qinv);
+		for (i = 0; i < n-1; ++i) {
+			MUL_MONT_RED(t, x0[i], fp->chirp[1][i], q, qinv);
+			SUB_MOD(x[i], t, last, q);
+		}
+		x[n-1] = 0;
+		return;
+	}
+
+	for (i = 0; i < n; ++i)
+		MUL_BARRETT(x0[i], a[i], b[i], q, mu);
+	ntt_backward(x0, &fp->ntt);
+	for (i = 0; i < n; ++i)
+		MUL_MONT_RED(x[i], x0[i], fp->untwist[i], q, qinv);
+}
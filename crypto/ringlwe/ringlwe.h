@@ -18,8 +18,10 @@
 extern "C" {
 #endif
 
+/* Ring elements are stored as 16-bit coefficients; every q in the
+   supported parameter sets is below 2^16. */
 #ifndef RINGELT
-#define RINGELT uint_fast16_t
+#define RINGELT uint16_t
 #endif
 
 typedef struct ringlwe_param_data_st RINGLWE_PARAM_DATA;
@@ -28,6 +30,22 @@ typedef struct rlwe_pub_st RLWE_PUB;
 typedef struct rlwe_pair_st RLWE_PAIR;
 typedef struct rlwe_rec_st RLWE_REC;
 typedef struct rlwe_ctx_st RLWE_CTX;
+typedef struct rlwe_ticket_st RLWE_TICKET;
+typedef struct rlwe_workspace_st RLWE_WORKSPACE;
+
+/* Borrowed views of an encoded public key and of encoded reconciliation
+   data, set up by RLWE_PUB_VIEW_init and RLWE_REC_VIEW_init.  They point
+   into the caller's buffer, which must outlive them. */
+typedef struct rlwe_pub_view_st {
+  const unsigned char *data;
+  size_t len;
+  const RLWE_CTX *ctx;
+} RLWE_PUB_VIEW;
+
+typedef struct rlwe_rec_view_st {
+  const unsigned char *data;
+  uint32_t muwords;
+} RLWE_REC_VIEW;
 
 /* Allocate and deallocate parameters, public keys, private key / public key pairs, and reconciliation data structures */
 RLWE_PARAM *RLWE_PARAM_new(void);
@@ -41,6 +59,7 @@ void RLWE_PUB_free(RLWE_PUB *pub);
 
 RLWE_PAIR *RLWE_PAIR_new(RLWE_CTX *ctx);
 RLWE_PAIR *RLWE_PAIR_dup(const RLWE_PAIR *pair);
+int RLWE_PAIR_up_ref(RLWE_PAIR *pair);
 void RLWE_PAIR_free(RLWE_PAIR *pair);
 
 RLWE_REC *RLWE_REC_new(uint32_t muwords);
@@ -49,8 +68,30 @@ void RLWE_REC_free(RLWE_REC *rec);
 RLWE_CTX *RLWE_CTX_new(const int nid);
 void RLWE_CTX_free(RLWE_CTX *ctx);
 
+RLWE_TICKET *RLWE_TICKET_new(RLWE_CTX *ctx);
+void RLWE_TICKET_free(RLWE_TICKET *ticket);
+
+/* Scratch space for the _ex compute_key functions, which then make no
+   allocations of their own.  A workspace suits one parameter set and may
+   be reused for any number of exchanges, one at a time. */
+RLWE_WORKSPACE *RLWE_WORKSPACE_new(const RLWE_CTX *ctx);
+void RLWE_WORKSPACE_free(RLWE_WORKSPACE *ws);
+
 /* Generate key pair */
 int RLWE_PAIR_generate_key(RLWE_PAIR *keypair);
+/* Generate n key pairs of the same parameter set, optionally also writing
+   the serialised public keys back to back to pub_out */
+int RLWE_PAIR_generate_keys_batch(RLWE_PAIR **pairs, size_t n, unsigned char *pub_out);
+
+/* Precompute the responder's side of a key exchange before the peer's
+   public key is known: sample and transform the ephemeral secrets and
+   compute and encode the public key.  A ticket is good for one
+   RINGLWE_compute_key_bob_ticket call and can then be generated again. */
+int RLWE_TICKET_generate(RLWE_TICKET *ticket);
+
+/* Set how many bytes of sampler keystream each thread produces before
+   re-keying it from RAND_bytes */
+void RLWE_set_rand_reseed_interval(size_t nbytes);
 
 /* Convert public keys and reconciliation data structures from/to binary */
 RLWE_PUB *o2i_RLWE_PUB(RLWE_PUB **pub, const unsigned char *in, size_t len);
@@ -59,15 +100,50 @@ size_t i2o_RLWE_PUB(RLWE_PUB *pub, unsigned char **out);
 size_t i2o_RLWE_SEC(RLWE_PAIR *pair, unsigned char **out);
 RLWE_REC *o2i_RLWE_REC(RLWE_REC **rec, const unsigned char *in, size_t len);
 size_t i2o_RLWE_REC(RLWE_REC *rec, unsigned char **out);
+/* Encode into a caller buffer of outlen bytes, such as a handshake
+   message.  With out NULL, return the length the encoding needs. */
+size_t RLWE_PUB_encode(const RLWE_PUB *pub, unsigned char *out, size_t outlen);
+size_t RLWE_REC_encode(const RLWE_REC *rec, unsigned char *out, size_t outlen);
+/* Check an encoding and point a view at it, without copying or decoding */
+int RLWE_PUB_VIEW_init(RLWE_PUB_VIEW *view, const unsigned char *in, size_t len);
+int RLWE_REC_VIEW_init(RLWE_REC_VIEW *view, const unsigned char *in, size_t len);
+/* Compressed public keys, for the power-of-two parameter sets: each
+   coefficient is rounded to bits bits before it is sent.  o2i_RLWE_PUB
+   and RLWE_PUB_VIEW_init accept only the plain encoding; their
+   _compressed variants, for use once the peer has agreed to compressed
+   keys, accept either.  RLWE_get_compressed_bits
+   returns the width to use for a parameter set, or 0 if it has no
+   compressed encoding.  At that width, with both public keys of an
+   exchange compressed, the bound on the chance that the two sides derive
+   different keys stays below 2^-40:
+
+     parameter set   bits   key bytes         failure bound
+                            (uncompressed)    (uncompressed)
+     1024_40961      13     1697 (2080)       2^-65 (2^-81)
+     512_25601       12      801 (1056)       2^-43 (2^-62)
+     256_15361       13      449  (544)       2^-40 (2^-42) */
+size_t RLWE_PUB_encode_compressed(const RLWE_PUB *pub, int bits, unsigned char *out, size_t outlen);
+RLWE_PUB *o2i_RLWE_PUB_compressed(RLWE_PUB **pub, const unsigned char *in, size_t len);
+int RLWE_PUB_VIEW_init_compressed(RLWE_PUB_VIEW *view, const unsigned char *in, size_t len);
+int RLWE_get_compressed_bits(int nid);
 
 int RLWE_get_nid_from_descriptor(const unsigned char descriptor[]);
-uint32_t RLWE_CTX_get_m(RLWE_CTX *ctx);
-RINGELT RLWE_CTX_get_q(RLWE_CTX *ctx);
+uint32_t RLWE_CTX_get_m(const RLWE_CTX *ctx);
+RINGELT RLWE_CTX_get_q(const RLWE_CTX *ctx);
+uint32_t RLWE_CTX_get_muwords(const RLWE_CTX *ctx);
+int RLWE_CTX_get_nid(const RLWE_CTX *ctx);
 
 /* Get public key from a key pair */
 RLWE_PUB *RLWE_PAIR_get_publickey(RLWE_PAIR *pair);
 /* Does private key exist? */
 int RLWE_PAIR_has_privatekey(RLWE_PAIR *pair);
+int RLWE_PAIR_get_nid(const RLWE_PAIR *pair);
+int RLWE_PUB_get_nid(const RLWE_PUB *pub);
+/* Get the public key of a generated ticket, decoded or as encoded by
+   i2o_RLWE_PUB (the encoding stays owned by the ticket) */
+RLWE_PUB *RLWE_TICKET_get_publickey(RLWE_TICKET *ticket);
+size_t RLWE_TICKET_get_encoded_publickey(RLWE_TICKET *ticket, const unsigned char **out);
+int RLWE_TICKET_get_nid(const RLWE_TICKET *ticket);
 
 /* Compute shared secret values */
 size_t RINGLWE_compute_key_alice(void *out,
@@ -82,6 +158,148 @@ size_t RINGLWE_compute_key_bob(void *out,
 			    const RLWE_PUB *alice_pub,
 			    const RLWE_PUB *bob_pub,
                             void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen));
+/* As RINGLWE_compute_key_bob, using the precomputed ticket as Bob's key;
+   only one multiplication and inverse transform remain to be done */
+size_t RINGLWE_compute_key_bob_ticket(void *out,
+				   size_t outlen,
+				   RLWE_REC **reconciliation,
+				   const RLWE_PUB *alice_pub,
+				   RLWE_TICKET *ticket,
+				   void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen));
+/* As above, with caller-supplied workspace and reconciliation structure
+   (from RLWE_REC_new) of the same parameter set */
+size_t RINGLWE_compute_key_alice_ex(void *out,
+				 size_t outlen,
+				 const RLWE_PUB *bob_pub,
+				 const RLWE_REC *reconciliation,
+				 const RLWE_PAIR *alice_keypair,
+				 RLWE_WORKSPACE *ws,
+				 void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen));
+size_t RINGLWE_compute_key_bob_ex(void *out,
+			       size_t outlen,
+			       RLWE_REC *reconciliation,
+			       const RLWE_PUB *alice_pub,
+			       const RLWE_PUB *bob_pub,
+			       RLWE_WORKSPACE *ws,
+			       void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen));
+size_t RINGLWE_compute_key_bob_ticket_ex(void *out,
+				      size_t outlen,
+				      RLWE_REC *reconciliation,
+				      const RLWE_PUB *alice_pub,
+				      RLWE_TICKET *ticket,
+				      RLWE_WORKSPACE *ws,
+				      void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen));
+/* As RINGLWE_compute_key_alice_ex, taking Bob's public key and the
+   reconciliation data as views of their encodings.  out may overlap the
+   viewed buffers.  ws may be NULL. */
+size_t RINGLWE_compute_key_alice_view(void *out,
+				   size_t outlen,
+				   const RLWE_PUB_VIEW *bob_pub,
+				   const RLWE_REC_VIEW *reconciliation,
+				   const RLWE_PAIR *alice_keypair,
+				   RLWE_WORKSPACE *ws,
+				   void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen));
+
+/* Implementations of the key exchange.  The built-in one, RLWE_OpenSSL(),
+   is used unless another is made the default, directly or through an
+   ENGINE (ENGINE_set_RLWE and ENGINE_set_default_RLWE).  Ring elements
+   are in the Fourier domain of the parameter set ctx, and each function
+   returns 1 on success or 0 on failure:
+     generate        secret s [2*m], s_0 then s_1, and public key b [m]
+     encapsulate     Bob's public key u [m], reconciliation data cr_v and
+                     shared secret mu [muwords each] for Alice's key b;
+                     tmp is [3*m] scratch
+     decapsulate     Alice's shared secret mu from u, her s_1 and cr_v;
+                     tmp is [m] scratch
+     generate_batch  n key pairs at once; may be NULL, in which case
+                     generate is called for each pair
+   Encapsulation from an RLWE_TICKET always uses the built-in code. */
+struct rlwe_method_st {
+  const char *name;
+  int (*generate)(RINGELT *s, RINGELT *b, const RLWE_CTX *ctx);
+  int (*encapsulate)(RINGELT *u, uint64_t *cr_v, uint64_t *mu, const RINGELT *b,
+		     RINGELT *tmp, const RLWE_CTX *ctx);
+  int (*decapsulate)(uint64_t *mu, const RINGELT *u, const RINGELT *s_1,
+		     const uint64_t *cr_v, RINGELT *tmp, const RLWE_CTX *ctx);
+  int (*generate_batch)(RINGELT *const *s, RINGELT *const *b, size_t n,
+			const RLWE_CTX *ctx);
+  int flags;
+  char *app_data;
+};
+
+const RLWE_METHOD *RLWE_OpenSSL(void);
+void RLWE_set_default_method(const RLWE_METHOD *meth);
+const RLWE_METHOD *RLWE_get_default_method(void);
+#ifndef OPENSSL_NO_ENGINE
+int RLWE_set_default_engine(ENGINE *engine);
+#endif
+
+
+/* EVP_PKEY_RLWE keys hold an RLWE_PAIR.  EVP_PKEY_derive takes the side
+   of the exchange from the key it is given: a key with a private key
+   decapsulates (Alice), and needs the peer's reconciliation data set with
+   EVP_PKEY_CTX_set0_rlwe_rec; a key without one, such as the output of
+   EVP_PKEY_paramgen, encapsulates (Bob), writing its new public key into
+   that key and leaving the reconciliation data to be read back with
+   EVP_PKEY_CTX_get0_rlwe_rec.  The context owns the reconciliation
+   data in both cases. */
+
+# define EVP_PKEY_CTX_set_rlwe_paramgen_nid(ctx, nid) \
+        EVP_PKEY_CTX_ctrl(ctx, EVP_PKEY_RLWE, \
+                                EVP_PKEY_OP_PARAMGEN|EVP_PKEY_OP_KEYGEN, \
+                                EVP_PKEY_CTRL_RLWE_PARAMGEN_NID, nid, NULL)
+
+# define EVP_PKEY_CTX_set_rlwe_kdf_type(ctx, kdf) \
+        EVP_PKEY_CTX_ctrl(ctx, EVP_PKEY_RLWE, \
+                                EVP_PKEY_OP_DERIVE, \
+                                EVP_PKEY_CTRL_RLWE_KDF_TYPE, kdf, NULL)
+
+# define EVP_PKEY_CTX_get_rlwe_kdf_type(ctx) \
+        EVP_PKEY_CTX_ctrl(ctx, EVP_PKEY_RLWE, \
+                                EVP_PKEY_OP_DERIVE, \
+                                EVP_PKEY_CTRL_RLWE_KDF_TYPE, -2, NULL)
+
+# define EVP_PKEY_CTX_set_rlwe_kdf_md(ctx, md) \
+        EVP_PKEY_CTX_ctrl(ctx, EVP_PKEY_RLWE, \
+                                EVP_PKEY_OP_DERIVE, \
+                                EVP_PKEY_CTRL_RLWE_KDF_MD, 0, (void *)md)
+
+# define EVP_PKEY_CTX_get_rlwe_kdf_md(ctx, pmd) \
+        EVP_PKEY_CTX_ctrl(ctx, EVP_PKEY_RLWE, \
+                                EVP_PKEY_OP_DERIVE, \
+                                EVP_PKEY_CTRL_GET_RLWE_KDF_MD, 0, (void *)pmd)
+
+# define EVP_PKEY_CTX_set_rlwe_kdf_outlen(ctx, len) \
+        EVP_PKEY_CTX_ctrl(ctx, EVP_PKEY_RLWE, \
+                                EVP_PKEY_OP_DERIVE, \
+                                EVP_PKEY_CTRL_RLWE_KDF_OUTLEN, len, NULL)
+
+# define EVP_PKEY_CTX_get_rlwe_kdf_outlen(ctx, plen) \
+        EVP_PKEY_CTX_ctrl(ctx, EVP_PKEY_RLWE, \
+                                EVP_PKEY_OP_DERIVE, \
+                        EVP_PKEY_CTRL_GET_RLWE_KDF_OUTLEN, 0, (void *)plen)
+
+# define EVP_PKEY_CTX_set0_rlwe_rec(ctx, rec) \
+        EVP_PKEY_CTX_ctrl(ctx, EVP_PKEY_RLWE, \
+                                EVP_PKEY_OP_DERIVE, \
+                                EVP_PKEY_CTRL_RLWE_REC, 0, (void *)rec)
+
+# define EVP_PKEY_CTX_get0_rlwe_rec(ctx, prec) \
+        EVP_PKEY_CTX_ctrl(ctx, EVP_PKEY_RLWE, \
+                                EVP_PKEY_OP_DERIVE, \
+                                EVP_PKEY_CTRL_GET_RLWE_REC, 0, (void *)prec)
+
+# define EVP_PKEY_CTRL_RLWE_PARAMGEN_NID                 (EVP_PKEY_ALG_CTRL + 1)
+# define EVP_PKEY_CTRL_RLWE_KDF_TYPE                     (EVP_PKEY_ALG_CTRL + 2)
+# define EVP_PKEY_CTRL_RLWE_KDF_MD                       (EVP_PKEY_ALG_CTRL + 3)
+# define EVP_PKEY_CTRL_GET_RLWE_KDF_MD                   (EVP_PKEY_ALG_CTRL + 4)
+# define EVP_PKEY_CTRL_RLWE_KDF_OUTLEN                   (EVP_PKEY_ALG_CTRL + 5)
+# define EVP_PKEY_CTRL_GET_RLWE_KDF_OUTLEN               (EVP_PKEY_ALG_CTRL + 6)
+# define EVP_PKEY_CTRL_RLWE_REC                          (EVP_PKEY_ALG_CTRL + 7)
+# define EVP_PKEY_CTRL_GET_RLWE_REC                      (EVP_PKEY_ALG_CTRL + 8)
+/* KDF types: the raw shared bits, or the ECDH KDF of X9.62 over them */
+# define EVP_PKEY_RLWE_KDF_NONE                          1
+# define EVP_PKEY_RLWE_KDF_X9_62                         2
 
 
 /* BEGIN ERROR CODES */
@@ -105,6 +323,7 @@ void ERR_load_RINGLWE_strings(void);
 #define RINGLWE_F_RINGLWE_				 107
 #define RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE		 108
 #define RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB		 109
+#define RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB_TICKET	 129
 #define RINGLWE_F_RLWE_CTX_NEW				 114
 #define RINGLWE_F_RLWE_CTX_INIT                          120
 #define RINGLWE_F_RLWE_PAIR_DUP 			 115
@@ -114,7 +333,28 @@ void ERR_load_RINGLWE_strings(void);
 #define RINGLWE_F_RLWE_PUB_DUP				 116
 #define RINGLWE_F_RLWE_PUB_NEW				 103
 #define RINGLWE_F_RLWE_REC_NEW				 106
+#define RINGLWE_F_RLWE_TICKET_GENERATE			 128
+#define RINGLWE_F_RLWE_TICKET_NEW			 127
+#define RINGLWE_F_RLWE_WORKSPACE_NEW			 130
+#define RINGLWE_F_RLWE_PUB_ENCODE			 131
+#define RINGLWE_F_RLWE_REC_ENCODE			 132
+#define RINGLWE_F_RLWE_PUB_VIEW_INIT			 133
+#define RINGLWE_F_RLWE_REC_VIEW_INIT			 134
+#define RINGLWE_F_RLWE_PAIR_UP_REF			 135
+#define RINGLWE_F_RLWE_PUB_ENCODE_COMPRESSED		 136
 #define RINGLWE_F_RLWE_PAIR_GENERATE_KEY                 123
+#define RINGLWE_F_RLWE_PAIR_GENERATE_KEYS_BATCH          126
+#define RINGLWE_F_PKEY_RLWE_CTRL			 137
+#define RINGLWE_F_PKEY_RLWE_CTRL_STR			 138
+#define RINGLWE_F_PKEY_RLWE_DERIVE			 139
+#define RINGLWE_F_PKEY_RLWE_KEYGEN			 140
+#define RINGLWE_F_PKEY_RLWE_PARAMGEN			 141
+#define RINGLWE_F_RLWEKEY_PUB_DECODE			 142
+#define RINGLWE_F_RLWEKEY_PUB_ENCODE			 143
+#define RINGLWE_F_RLWEKEY_PRIV_DECODE			 144
+#define RINGLWE_F_RLWEKEY_PRIV_ENCODE			 145
+#define RINGLWE_F_RLWEKEY_PARAM_DECODE			 146
+#define RINGLWE_F_DO_RLWE_PRINT				 147
 
 /* Reason codes. */
 #define RINGLWE_R_INVALID_FORMAT			 102
@@ -122,6 +362,16 @@ void ERR_load_RINGLWE_strings(void);
 #define RINGLWE_R_RANDOM_FAILED				 101
 #define RINGLWE_R_PARAM_UNKNOWN                          103
 #define RINGLWE_R_PARAM_INVALID                          104
+#define RINGLWE_R_TICKET_NOT_READY                       105
+#define RINGLWE_R_BUFFER_TOO_SMALL                       106
+#define RINGLWE_R_COMPRESSION_UNSUPPORTED                107
+#define RINGLWE_R_NO_PARAMETERS_SET                      108
+#define RINGLWE_R_KEYS_NOT_SET                           109
+#define RINGLWE_R_NO_RECONCILIATION_DATA                 110
+#define RINGLWE_R_DECODE_ERROR                           111
+#define RINGLWE_R_INVALID_DIGEST                         112
+#define RINGLWE_R_INVALID_KDF                            113
+#define RINGLWE_R_METHOD_FAILED                          114
 
 #ifdef  __cplusplus
 }
@@ -8,23 +8,10 @@
  * See LICENSE for complete information.
  */
 
-#include "FFT/FFT_includes.h"
+/* The parameter sets.  These are static tables, for the registry in
+   ringlwe_key.c only; everything else reaches them through RLWE_CTX. */
 
-#ifndef RINGELT
-#define RINGELT uint32_t
-#endif
-
-typedef struct ringlwe_param_data_st {
-  const uint32_t m, muwords;
-  const RINGELT q, qmod4;
-  const uint32_t B, BB, LOG2B, BMASK;
-  const RINGELT small_coeff_table[11];
-  const RINGELT q_1_4, q_2_4, q_3_4;
-  const RINGELT r0_l, r0_u, r1_l, r1_u;
-  const RINGELT a[1024];
-  void (*fft_forward)(FFTSHORT *x);
-  void (*fft_backward)(FFTSHORT *x);
-} _ringlwe_param_data_st;
+#include "ringlwe_locl.h"
 
 
 static _ringlwe_param_data_st _ringlwe_param_1024 = 
@@ -166,7 +153,9 @@ static _ringlwe_param_data_st _ringlwe_param_1024 =
         0x48B5, 0x8FDB, 0x8FE7, 0x88D7, 0x63CB, 0x0B3A, 0x83FC, 0x7CC4
     },
     &_FFT_forward_1024_40961,
-    &_FFT_backward_1024_40961
+    &_FFT_backward_1024_40961,
+    &_FFT_backward_mul_1024_40961,
+    16186
   };
 
 static _ringlwe_param_data_st _ringlwe_param_821 = 
@@ -282,8 +271,10 @@ static _ringlwe_param_data_st _ringlwe_param_821 =
         0X2BA1, 0X3A50, 0XB36D, 0X6E6E, 0XB14B, 0X88D7, 0X0846, 0XAE5E, 
         0X554C, 0X9F0F, 0X5F58, 0X33E8, 0X88CA
     },
-    &_FFT_forward_821_49261,
-    &_FFT_backward_821_49261
+    &_FFT_forward_small_821_49261,
+    &_FFT_backward_821_49261,
+    &_FFT_backward_mul_821_49261,
+    75
   };
 
 static _ringlwe_param_data_st _ringlwe_param_739 = 
@@ -389,8 +380,10 @@ static _ringlwe_param_data_st _ringlwe_param_739 =
         0X8265, 0XA85E, 0XA6E8, 0X2353, 0X6420, 0X5032, 0X2DD9, 0X74E9, 
         0X68AE, 0X3981, 0X8256
     },
-    &_FFT_forward_739_47297,
-    &_FFT_backward_739_47297
+    &_FFT_forward_small_739_47297,
+    &_FFT_backward_739_47297,
+    &_FFT_backward_mul_739_47297,
+    52
   };
 
 static _ringlwe_param_data_st _ringlwe_param_631 = 
@@ -482,8 +475,10 @@ static _ringlwe_param_data_st _ringlwe_param_631 =
         0X9E98, 0X8442, 0X4B41, 0X4C43, 0X3DF0, 0X3590, 0XA020, 0X79A1, 
         0X1240, 0X8907, 0XA743, 0X55AB, 0X91D4, 0X2249, 0X9C15
     },
-    &_FFT_forward_631_44171,
-    &_FFT_backward_631_44171
+    &_FFT_forward_small_631_44171,
+    &_FFT_backward_631_44171,
+    &_FFT_backward_mul_631_44171,
+    5
   };
 
 static _ringlwe_param_data_st _ringlwe_param_541 = 
@@ -564,8 +559,10 @@ static _ringlwe_param_data_st _ringlwe_param_541 =
         0X48D0, 0X9186, 0X7822, 0X6457, 0X14B7, 0X92A8, 0X8A07, 0X920E, 
         0X59E8, 0X0C47, 0X5E99, 0X0979, 0X0C75
     },
-    &_FFT_forward_541_41117,
-    &_FFT_backward_541_41117
+    &_FFT_forward_small_541_41117,
+    &_FFT_backward_541_41117,
+    &_FFT_backward_mul_541_41117,
+    160
   };
 
 static _ringlwe_param_data_st _ringlwe_param_512 = 
@@ -643,7 +640,9 @@ static _ringlwe_param_data_st _ringlwe_param_512 =
         0x3F5B, 0x0CFA, 0x0A5B, 0x2FF6, 0x0CAC, 0x4EC5, 0x1BF9, 0x24B5
     },
     &_FFT_forward_512_25601,
-    &_FFT_backward_512_25601
+    &_FFT_backward_512_25601,
+    &_FFT_backward_mul_512_25601,
+    22188
   };
 
 static _ringlwe_param_data_st _ringlwe_param_433 = 
@@ -711,8 +710,10 @@ static _ringlwe_param_data_st _ringlwe_param_433 =
         0X25F1, 0X1A38, 0X21BA, 0X29DB, 0X0CEF, 0X1D69, 0X54B8, 0X28BD, 
         0X713D
     },
-    &_FFT_forward_433_35507,
-    &_FFT_backward_433_35507
+    &_FFT_forward_small_433_35507,
+    &_FFT_backward_433_35507,
+    &_FFT_backward_mul_433_35507,
+    33
   };
 
 static _ringlwe_param_data_st _ringlwe_param_337 = 
@@ -768,8 +769,10 @@ static _ringlwe_param_data_st _ringlwe_param_337 =
         0X3519, 0X3D1A, 0X1007, 0X60FB, 0X795E, 0X6179, 0X35E0, 0X59A7, 
         0X1876
     },
-    &_FFT_forward_337_32353,
-    &_FFT_backward_337_32353
+    &_FFT_forward_small_337_32353,
+    &_FFT_backward_337_32353,
+    &_FFT_backward_mul_337_32353,
+    16
   };
 
 static _ringlwe_param_data_st _ringlwe_param_256 = 
@@ -816,5 +819,7 @@ static _ringlwe_param_data_st _ringlwe_param_256 =
         0x19D0, 0x2D46, 0x30BF, 0x1C53, 0x04F3, 0x0E06, 0x0D48, 0x03B0
     },
     &_FFT_forward_256_15361,
-    &_FFT_backward_256_15361
+    &_FFT_backward_256_15361,
+    &_FFT_backward_mul_256_15361,
+    12228
   };
@@ -82,6 +82,7 @@ static ERR_STRING_DATA RINGLWE_str_functs[]=
 {ERR_FUNC(RINGLWE_F_RINGLWE_),	"RINGLWE_"},
 {ERR_FUNC(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE),	"RINGLWE_compute_key_alice"},
 {ERR_FUNC(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB),	"RINGLWE_compute_key_bob"},
+{ERR_FUNC(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB_TICKET),	"RINGLWE_compute_key_bob_ticket"},
 {ERR_FUNC(RINGLWE_F_RLWE_CTX_NEW),	"RLWE_CTX_new"},
 {ERR_FUNC(RINGLWE_F_RLWE_CTX_INIT),     "RLWE_CTX_init"},
 {ERR_FUNC(RINGLWE_F_RLWE_PAIR_DUP),	"RLWE_PAIR_dup"},
@@ -91,7 +92,28 @@ static ERR_STRING_DATA RINGLWE_str_functs[]=
 {ERR_FUNC(RINGLWE_F_RLWE_PUB_DUP),      "RLWR_PUB_dup"},
 {ERR_FUNC(RINGLWE_F_RLWE_PUB_NEW),	"RLWE_PUB_new"},
 {ERR_FUNC(RINGLWE_F_RLWE_REC_NEW),	"RLWE_REC_new"},
+{ERR_FUNC(RINGLWE_F_RLWE_TICKET_GENERATE),	"RLWE_TICKET_generate"},
+{ERR_FUNC(RINGLWE_F_RLWE_TICKET_NEW),	"RLWE_TICKET_new"},
+{ERR_FUNC(RINGLWE_F_RLWE_WORKSPACE_NEW),	"RLWE_WORKSPACE_new"},
+{ERR_FUNC(RINGLWE_F_RLWE_PUB_ENCODE),	"RLWE_PUB_encode"},
+{ERR_FUNC(RINGLWE_F_RLWE_REC_ENCODE),	"RLWE_REC_encode"},
+{ERR_FUNC(RINGLWE_F_RLWE_PUB_VIEW_INIT),	"RLWE_PUB_VIEW_init"},
+{ERR_FUNC(RINGLWE_F_RLWE_REC_VIEW_INIT),	"RLWE_REC_VIEW_init"},
+{ERR_FUNC(RINGLWE_F_RLWE_PAIR_UP_REF),	"RLWE_PAIR_up_ref"},
+{ERR_FUNC(RINGLWE_F_RLWE_PUB_ENCODE_COMPRESSED),	"RLWE_PUB_encode_compressed"},
 {ERR_FUNC(RINGLWE_F_RLWE_PAIR_GENERATE_KEY), "RLWE_PAIR_generate_key"},
+{ERR_FUNC(RINGLWE_F_RLWE_PAIR_GENERATE_KEYS_BATCH), "RLWE_PAIR_generate_keys_batch"},
+{ERR_FUNC(RINGLWE_F_PKEY_RLWE_CTRL),	"PKEY_RLWE_CTRL"},
+{ERR_FUNC(RINGLWE_F_PKEY_RLWE_CTRL_STR),	"PKEY_RLWE_CTRL_STR"},
+{ERR_FUNC(RINGLWE_F_PKEY_RLWE_DERIVE),	"PKEY_RLWE_DERIVE"},
+{ERR_FUNC(RINGLWE_F_PKEY_RLWE_KEYGEN),	"PKEY_RLWE_KEYGEN"},
+{ERR_FUNC(RINGLWE_F_PKEY_RLWE_PARAMGEN),	"PKEY_RLWE_PARAMGEN"},
+{ERR_FUNC(RINGLWE_F_RLWEKEY_PUB_DECODE),	"RLWEKEY_PUB_DECODE"},
+{ERR_FUNC(RINGLWE_F_RLWEKEY_PUB_ENCODE),	"RLWEKEY_PUB_ENCODE"},
+{ERR_FUNC(RINGLWE_F_RLWEKEY_PRIV_DECODE),	"RLWEKEY_PRIV_DECODE"},
+{ERR_FUNC(RINGLWE_F_RLWEKEY_PRIV_ENCODE),	"RLWEKEY_PRIV_ENCODE"},
+{ERR_FUNC(RINGLWE_F_RLWEKEY_PARAM_DECODE),	"RLWEKEY_PARAM_DECODE"},
+{ERR_FUNC(RINGLWE_F_DO_RLWE_PRINT),	"DO_RLWE_PRINT"},
 {0,NULL}
 	};
 
@@ -102,6 +124,16 @@ static ERR_STRING_DATA RINGLWE_str_reasons[]=
 {ERR_REASON(RINGLWE_R_RANDOM_FAILED)     ,"random failed"},
 {ERR_REASON(RINGLWE_R_PARAM_UNKNOWN)     ,"rlwe parameter id unknown"},
 {ERR_REASON(RINGLWE_R_PARAM_INVALID)     ,"rlwe parameter invalid"},
+{ERR_REASON(RINGLWE_R_TICKET_NOT_READY)  ,"rlwe ticket not generated or already used"},
+{ERR_REASON(RINGLWE_R_BUFFER_TOO_SMALL)  ,"buffer too small"},
+{ERR_REASON(RINGLWE_R_COMPRESSION_UNSUPPORTED)  ,"compression unsupported"},
+{ERR_REASON(RINGLWE_R_NO_PARAMETERS_SET)  ,"no parameters set"},
+{ERR_REASON(RINGLWE_R_KEYS_NOT_SET)      ,"keys not set"},
+{ERR_REASON(RINGLWE_R_NO_RECONCILIATION_DATA)  ,"no reconciliation data"},
+{ERR_REASON(RINGLWE_R_DECODE_ERROR)      ,"decode error"},
+{ERR_REASON(RINGLWE_R_INVALID_DIGEST)    ,"invalid digest"},
+{ERR_REASON(RINGLWE_R_INVALID_KDF)       ,"invalid kdf"},
+{ERR_REASON(RINGLWE_R_METHOD_FAILED)     ,"method failed"},
 {0,NULL}
 	};
 
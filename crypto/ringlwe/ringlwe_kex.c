@@ -18,158 +18,264 @@
 /* Ring-LWE Key Exchange primitive functions
    Do not call directly, use the interface functions in ringlwe_key.c instead */
 
+/* The transforms of a parameter set: its own kernels, or for a set that
+   has none those of the runtime engine, which ringlwe_fft_prepare has set
+   up before the set can be used */
+
+int ringlwe_fft_prepare(RINGLWE_PARAM_DATA *p) {
+  const FFT_PARAM *fp;
+
+  if (p->fft_forward || p->fft_param)
+    return 1;
+  fp = FFT_PARAM_get(p->m, p->q, p->root);
+  if (fp == NULL)
+    return 0;
+  /* FFT_PARAM_get interns its objects, so concurrent stores agree */
+  p->fft_param = fp;
+  return 1;
+}
+
+void ringlwe_fft_forward(RINGELT *x, const RINGLWE_PARAM_DATA *p) {
+  if (p->fft_forward) {
+    p->fft_forward(x);
+    return;
+  }
+  assert(p->fft_param);
+  FFT_PARAM_forward(p->fft_param, x);
+}
+
+void ringlwe_fft_backward(RINGELT *x, const RINGLWE_PARAM_DATA *p) {
+  if (p->fft_backward) {
+    p->fft_backward(x);
+    return;
+  }
+  assert(p->fft_param);
+  FFT_PARAM_backward(p->fft_param, x);
+}
+
+void ringlwe_fft_backward_mul(RINGELT *x, const RINGELT *a, const RINGELT *b,
+			      const RINGLWE_PARAM_DATA *p) {
+  if (p->fft_backward_mul) {
+    p->fft_backward_mul(x, a, b);
+    return;
+  }
+  assert(p->fft_param);
+  FFT_PARAM_backward_mul(p->fft_param, x, a, b);
+}
+
+/*
+  Rejection-sample the coefficients of one random word: every LOG2B-bit
+  chunk l below BB gives the coefficient l - B mod q.  Each chunk is
+  written to s[i] and i only advances when it is accepted, so there are no
+  data-dependent branches, but s must have room for 64/LOG2B entries past i.
+*/
+static int sample_small_word(RINGELT *s, int i, uint64_t r,
+			     const RINGLWE_PARAM_DATA *p) {
+  uint32_t j, l, c;
+
+  for (j = 0; j + p->LOG2B <= 64; j += p->LOG2B) {
+    l = (uint32_t)(r >> j) & p->BMASK;
+    c = l - p->B;
+    s[i] = (RINGELT)(c + (p->q & (0 - (c >> 31))));
+    i += (l - p->BB) >> 31;
+  }
+  return i;
+}
+
 /*
   Sample the secret key. Each coefficient uniform in [-B,B].
   Set the m'th coefficient to be 0 if m is prime.
+  Consumes the random stream a buffer at a time; only the number of
+  rejected chunks, not the coefficients, affects the running time.
+  Returns 0 if the random stream could not be seeded.
 */
-void sample_secret(RINGELT *s, /*[m]*/
+int sample_secret(RINGELT *s, /*[m]*/
 		   const RINGLWE_PARAM_DATA *p) {
   RANDOM_VARS;
-  uint16_t i = 0;
-  uint64_t r = RANDOM64;
-  uint64_t l, shifts = 0;
+  RINGELT t[64];
+  const uint64_t *r;
+  int i = 0, k, nwords, n, j;
+  const int per_word = 64 / p->LOG2B;
   
-  int loop_limit = p->m;
+  n = p->m;
   if ((p->m)&1) { // prime case
-    loop_limit = p->m-1;
+    n = p->m-1;
     s[p->m-1] = 0;
   }
   
-  while (i < loop_limit) {
-    l = r & p->BMASK;
-    if (l < p->BB) {
-      /*Take this sample*/
-      s[i] = p->small_coeff_table[l];
-      i++;
-    }
-    /*Shift r along and continue*/
-    shifts++;
-    if (shifts * p->LOG2B >= 64) {
-      /*Need a new random value*/
-      r = RANDOM64;
-      shifts = 0;
+  while (i < n) {
+    nwords = RANDOM_WORDS(r);
+    k = 0;
+#ifdef FFT_AVX2
+    if (FFT_AVX2_CAPABLE && (p->LOG2B == 4))
+      k = FFT_sample_small_avx2(s, &i, n, r, nwords, p->q, p->B, p->BB);
+#endif
+    for (; (k < nwords) && (n - i >= per_word); k++)
+      i = sample_small_word(s, i, r[k], p);
+    /* Near the end, sample into t and keep what fits */
+    for (; (k < nwords) && (i < n); k++) {
+      j = sample_small_word(t, 0, r[k], p);
+      if (j > n - i)
+	j = n - i;
+      memcpy(s + i, t, j * sizeof(RINGELT));
+      i += j;
     }
-    else r = (r >> p->LOG2B);
-  }		
+    RANDOM_CONSUME(k);
+  }
+  OPENSSL_cleanse(t, sizeof(t));
+  return RANDOM_OK;
 }
 
 
-/* Round and cross-round */
-void round_and_cross_round(uint64_t *modular_rnd, /*[muwords]*/
-			   uint64_t *cross_rnd, /*[muwords]*/
-			   const RINGELT *v /*[m]*/,
-			   const RINGLWE_PARAM_DATA *p) {
+/* Constant-time comparisons of values below 2^31, giving 1 or 0 */
+#define CT_LT(a, b) (((uint32_t) (a) - (uint32_t) (b)) >> 31)
+#define CT_EQ(a, b) (((uint32_t) ((a) ^ (b)) - 1) >> 31)
+
+/*
+  Round and cross-round v + e2, or v if e2 is NULL.  Bit i of the random
+  stream belongs to coefficient i and nudges it up from 0 to q-1 or from
+  hi-1 to hi, where hi is q_1_4 or q_3_4 as q is 1 or 3 mod 4, so the
+  same number of random words is drawn whatever v is, and the outputs are
+  built with masks rather than branches.  Returns 0 if the random stream
+  could not be seeded.
+*/
+static int round_and_cross_round_add(uint64_t *modular_rnd, /*[muwords]*/
+				      uint64_t *cross_rnd, /*[muwords]*/
+				      const RINGELT *v /*[m]*/,
+				      const RINGELT *e2 /*[m]*/,
+				      const RINGLWE_PARAM_DATA *p) {
   RANDOM_VARS;
-  uint16_t i = 0;
-  uint64_t r = RANDOM64;
-  RINGELT word = 0, pos = 0, rbit = 0, val;
-  
+  uint64_t rnd[RINGLWE_MAX_M/64];
+  const RINGELT hi = (p->qmod4 == 1) ? p->q_1_4 : p->q_3_4;
+  uint32_t val, rb, gt14;
+  int i = 0;
+
+  assert(p->muwords <= RINGLWE_MAX_M/64);
   memset((void *) modular_rnd, 0, p->muwords*sizeof(uint64_t));
   memset((void *) cross_rnd, 0, p->muwords*sizeof(uint64_t));
+  for (i = 0; i < (int) p->muwords; ++i)
+    rnd[i] = RANDOM64;
     
   int loop_limit = p->m;
   if ((p->m)&1) // prime case
     loop_limit = p->m-1;
-    
-  for (i = 0; i < loop_limit; ++i) {
-    
+
+  i = 0;
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE)
+    i = FFT_round_avx2(modular_rnd, cross_rnd, v, e2, rnd, loop_limit,
+		       p->q, p->q_1_4, p->q_2_4, p->q_3_4, hi);
+#endif
+  for (; i < loop_limit; ++i) {
     val = v[i];
+    if (e2 != NULL)
+      ADD_MOD(val, val, e2[i], p->q);
+
     /*Randomize rounding procedure - probabilistic nudge*/
-    if (p->qmod4 == 1) {
-      if (val == 0) {
-	if (r & 1) val = (p->q-1);
-	rbit++;
-	if (rbit >= 64) {
-	  r = RANDOM64; rbit = 0;
-	}
-	else r = (r >> 1);
-      }
-      else if (val == p->q_1_4-1) {
-	if (r & 1) val = p->q_1_4;
-	rbit++;
-	if (rbit >= 64) {
-	  r = RANDOM64; rbit = 0;
-	}
-	else r = (r >> 1);
-      }
-    }
-    else {
-      if (val == 0) {
-	if (r & 1) val = (p->q-1);
-	rbit++;
-	if (rbit >= 64) {
-	  r = RANDOM64; rbit = 0;
-	}
-	else r = (r >> 1);
-      }
-      else if (val == p->q_3_4-1) {
-	if (r & 1) val = p->q_3_4;
-	rbit++;
-	if (rbit >= 64) {
-	  r = RANDOM64; rbit = 0;
-	}
-	else r = (r >> 1);
-      }
-    }
-    
+    rb = (uint32_t) (rnd[i >> 6] >> (i & 63)) & 1;
+    val += ((0 - (rb & CT_EQ(val, 0))) & (p->q-1)) + (rb & CT_EQ(val, hi-1));
+
     /*Modular rounding process*/
-    if (val > p->q_1_4 && val < p->q_3_4) modular_rnd[word] |= (1UL << pos);
-    
+    gt14 = CT_LT(p->q_1_4, val);
+    modular_rnd[i >> 6] |= (uint64_t) (gt14 & CT_LT(val, p->q_3_4)) << (i & 63);
+
     /*Cross Rounding process*/
-    if ((val > p->q_1_4 && val <= p->q_2_4) || val >= p->q_3_4) cross_rnd[word] |= (1UL << pos);
-    
-    pos++;
-    if (pos == 64) {
-      word++; pos = 0;
-    }
-    
+    cross_rnd[i >> 6] |= (uint64_t) ((gt14 & CT_LT(val, p->q_2_4+1)) |
+				     (1 ^ CT_LT(val, p->q_3_4))) << (i & 63);
   }
-  
-  
+  OPENSSL_cleanse(rnd, sizeof(rnd));
+  return RANDOM_OK;
 }
 
+/* Round and cross-round */
+int round_and_cross_round(uint64_t *modular_rnd, /*[muwords]*/
+			  uint64_t *cross_rnd, /*[muwords]*/
+			  const RINGELT *v /*[m]*/,
+			  const RINGLWE_PARAM_DATA *p) {
+  return round_and_cross_round_add(modular_rnd, cross_rnd, v, NULL, p);
+}
 
-/* Encapsulation routine. Returns an element in R_q x R_2
- * input:  Alice's public key b in Fourier Domain
- * output: Bob's public key u in Fourier Domain
- *         reconciliation data cr_v
- *         shared secret mu
+
+/* Offline half of encapsulation: everything that does not depend on
+ * Alice's public key.
+ * output: Bob's public key u = a*e0+e1 in Fourier Domain
+ *         e0 in Fourier Domain followed by e2, for KEM1_Encapsulate_online
+ * scratch: e1, cleared on return
+ * Returns 0 if the random stream could not be seeded.
  */
-void KEM1_Encapsulate(RINGELT *u, /*[m]*/
-		      uint64_t *cr_v, /*[muwords]*/
-		      uint64_t *mu, /*[muwords]*/
-		      const RINGELT *b, /*[m]*/
-		      const RINGLWE_PARAM_DATA *p) {
+int KEM1_Encapsulate_offline(RINGELT *u, /*[m]*/
+			     RINGELT *e, /*[2*m]*/
+			     RINGELT *e1, /*[m]*/
+			     const RINGLWE_PARAM_DATA *p) {
   const RINGELT m=p->m, q=p->q;
-  RINGELT e[3*p->m];
-  RINGELT v[p->m];
-  
-  /*Sample Bob's ephemeral keys*/	
-  sample_secret(e, p);
-  sample_secret(e+m, p);
-  sample_secret(e+2*m, p);	
+  int ok;
+
+  /*Sample Bob's ephemeral keys*/
+  ok = sample_secret(e, p);
+  ok &= sample_secret(e1, p);
+  ok &= sample_secret(e+m, p);
 
   /*Fourer Transform e0 and e1*/
-  assert(p->fft_forward);
-  assert(p->fft_backward);
-  
-  p->fft_forward((FFTSHORT *)e);
-  p->fft_forward((FFTSHORT *)(e+m));
+  ringlwe_fft_forward(e, p);
+  ringlwe_fft_forward(e1, p);
 
-  POINTWISE_MUL_ADD(u, p->a, e, e+m, m, q);
+  POINTWISE_MUL_ADD(u, p->a, e, e1, m, q);
   /* Combine with a to produce e_0*a+e_1 in the Fourier domain. Bob's public key. */
-  
-  POINTWISE_MUL(v, b, e, m, q); /* Create v = e0*b */
-  p->fft_backward((FFTSHORT *)v); /* Undo the Fourier Transform */
-  if ((m)&1) /* prime case */
-    MAPTOCYCLOTOMIC(v, m, q);
-  
-  POINTWISE_ADD(v, v, e+2*m, m, q); /* Create v = e0*b+e2 */
-  
-  round_and_cross_round(mu, cr_v, v, p);
 
-  memset(e, 0, 3*p->m * sizeof(RINGELT));
+  memset(e1, 0, p->m * sizeof(RINGELT));
+  return ok;
+}
+
+/* Online half of encapsulation.
+ * input:  Alice's public key b in Fourier Domain
+ *         e0 and e2 from KEM1_Encapsulate_offline
+ * output: reconciliation data cr_v
+ *         shared secret mu
+ * scratch: v, cleared on return
+ * Returns 0 if the random stream could not be seeded.
+ */
+int KEM1_Encapsulate_online(uint64_t *cr_v, /*[muwords]*/
+			    uint64_t *mu, /*[muwords]*/
+			    const RINGELT *e, /*[2*m]*/
+			    const RINGELT *b, /*[m]*/
+			    RINGELT *v, /*[m]*/
+			    const RINGLWE_PARAM_DATA *p) {
+  const RINGELT m=p->m;
+  int ok;
+
+  /* Create v = e0*b, undoing the Fourier Transform (and mapping to the
+     cyclotomic ring in the prime case) in the same pass */
+  ringlwe_fft_backward_mul(v, b, e, p);
+
+  /* Round and cross-round v+e2, adding e2 as it goes */
+  ok = round_and_cross_round_add(mu, cr_v, v, e+m, p);
+
   memset(v, 0, p->m * sizeof(RINGELT));
+  return ok;
+}
+
+/* Encapsulation routine. Returns an element in R_q x R_2
+ * input:  Alice's public key b in Fourier Domain
+ * output: Bob's public key u in Fourier Domain
+ *         reconciliation data cr_v
+ *         shared secret mu
+ * scratch: tmp, cleared on return
+ * Returns 0 if the random stream could not be seeded.
+ */
+int KEM1_Encapsulate(RINGELT *u, /*[m]*/
+		     uint64_t *cr_v, /*[muwords]*/
+		     uint64_t *mu, /*[muwords]*/
+		     const RINGELT *b, /*[m]*/
+		     RINGELT *tmp, /*[3*m]*/
+		     const RINGLWE_PARAM_DATA *p) {
+  RINGELT *e = tmp; /* e0 followed by e2 */
+  int ok;
+
+  ok = KEM1_Encapsulate_offline(u, e, tmp+2*p->m, p);
+  ok &= KEM1_Encapsulate_online(cr_v, mu, e, b, tmp+2*p->m, p);
+
+  memset(e, 0, 2*p->m * sizeof(RINGELT));
+  return ok;
 }
 
 
@@ -178,55 +284,83 @@ void KEM1_Encapsulate(RINGELT *u, /*[m]*/
  *         Alice's private key s_1 in Fourier Domain
  *         reconciliation data cr_v
  * output: shared secret mu
+ * scratch: w, cleared on return
  */
 void KEM1_Decapsulate(uint64_t *mu,  /*[muwords]*/
 			const RINGELT *u,    /*[m]*/
 			const RINGELT *s_1,  /*[m]*/
 			const uint64_t *cr_v, /*[muwords]*/
+			RINGELT *w,  /*[m]*/
 			const RINGLWE_PARAM_DATA *p) {
-  RINGELT w[p->m];
 
-  POINTWISE_MUL(w, s_1, u, p->m, p->q); /* Create w = s1*u */
-  assert(p->fft_backward);
- 
-  p->fft_backward((FFTSHORT *)w); /* Undo the Fourier Transform */
-  if ((p->m)&1)  /* prime case */
-    MAPTOCYCLOTOMIC(w, p->m, p->q);
+  /* Create w = s1*u, undoing the Fourier Transform (and mapping to the
+     cyclotomic ring in the prime case) in the same pass */
+  ringlwe_fft_backward_mul(w, s_1, u, p);
 
   ringlwe_rec(mu, w, cr_v, p);
   memset(w, 0, p->m * sizeof(RINGELT));
 }
 
 
-void KEM1_Generate(RINGELT *s, /*[2*m]*/
-		   RINGELT *b, /*[m]*/
-		   const RINGLWE_PARAM_DATA *p)
+/* Returns 0 if the random stream could not be seeded */
+int KEM1_Generate(RINGELT *s, /*[2*m]*/
+		  RINGELT *b, /*[m]*/
+		  const RINGLWE_PARAM_DATA *p)
 {
   const RINGELT m=p->m, q=p->q;
+  int ok;
 
   /* Sample Alice's secret keys */
-  sample_secret(s, p);
-  sample_secret(s+m, p);
+  ok = sample_secret(s, p);
+  ok &= sample_secret(s+m, p);
 
   /* Fourier Transform secret keys */
-  p->fft_forward((FFTSHORT *)s);
-  p->fft_forward((FFTSHORT *)s+m);
+  ringlwe_fft_forward(s, p);
+  ringlwe_fft_forward(s+m, p);
     
   POINTWISE_MUL_ADD(b, p->a, s+m, s, m, q);
   /* Combine with a to produce s_1*a+s_0 in the Fourier domain. Alice's public key. */
 
-  return;
+  return ok;
 }
 
 
-/* Reconcile */ 
+/* Generate n key pairs.  All secrets are sampled first, then each stage
+   is run over every key before the next one starts, so that the transform
+   tables and a stay in cache across keys.  Returns 0 if the random stream
+   could not be seeded. */
+int KEM1_Generate_batch(RINGELT *const *s, /*[n][2*m]*/
+			RINGELT *const *b, /*[n][m]*/
+			size_t n,
+			const RINGLWE_PARAM_DATA *p)
+{
+  const RINGELT m=p->m, q=p->q;
+  size_t k;
+  int ok = 1;
+
+  for (k = 0; k < n; k++) {
+    ok &= sample_secret(s[k], p);
+    ok &= sample_secret(s[k]+m, p);
+  }
+  for (k = 0; k < n; k++) {
+    ringlwe_fft_forward(s[k], p);
+    ringlwe_fft_forward(s[k]+m, p);
+  }
+  for (k = 0; k < n; k++)
+    POINTWISE_MUL_ADD(b[k], p->a, s[k]+m, s[k], m, q);
+  return ok;
+}
+
+
+/* Reconcile: bit i is set when w[i] lies strictly between r0_l and r0_u,
+   or r1_l and r1_u if bit i of b is set, selected with masks */ 
 void ringlwe_rec(uint64_t *r, /*[muwords]*/
 		 const RINGELT *w,  /*[m]*/
 		 const uint64_t *b, /*[muwords]*/
 		 const RINGLWE_PARAM_DATA *p) {
   
-  RINGELT i = 0;
-  RINGELT word = 0, pos = 0;
+  int i = 0;
+  uint32_t bm, lo, up;
   
   memset((void *) r, 0, p->muwords*sizeof(uint64_t));
   
@@ -234,17 +368,15 @@ void ringlwe_rec(uint64_t *r, /*[muwords]*/
   if ((p->m)&1) /* prime case */
     loop_limit = p->m-1;
   
-  for (i = 0; i < loop_limit; ++i) {
-    if ((b[word] >> pos) & 1UL) {
-      if (w[i] > p->r1_l && w[i] < p->r1_u) r[word] |= (1UL << pos);
-    }
-    else {
-      if (w[i] > p->r0_l && w[i] < p->r0_u) r[word] |= (1UL << pos);
-    }
-    pos++;
-    if (pos == 64) {
-      word++; pos = 0;
-    }
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE)
+    i = FFT_rec_avx2(r, w, b, loop_limit, p->r0_l, p->r0_u, p->r1_l, p->r1_u);
+#endif
+  for (; i < loop_limit; ++i) {
+    bm = 0 - ((uint32_t) (b[i >> 6] >> (i & 63)) & 1);
+    lo = p->r0_l ^ ((p->r0_l ^ p->r1_l) & bm);
+    up = p->r0_u ^ ((p->r0_u ^ p->r1_u) & bm);
+    r[i >> 6] |= (uint64_t) (CT_LT(lo, w[i]) & CT_LT(w[i], up)) << (i & 63);
   }
 }
 
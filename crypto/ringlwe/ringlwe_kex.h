@@ -11,37 +11,74 @@
 #include "ringlwe_locl.h"
 #include "FFT/FFT_includes.h"
 
+/* The routines that sample return 0 if the random stream could not be
+ * seeded, in which case their outputs must be discarded.
+ */
+
 /* Encapsulation routine. Returns an element in R_q x R_2
  * input:  Alice's public key b in Fourier Domain
  * output: Bob's public key u in Fourier Domain
  *         reconciliation data cr_v
  *         shared secret mu
  */
-void KEM1_Encapsulate(RINGELT *u,
-		      uint64_t *cr_v,
-		      uint64_t *mu,
-		      const RINGELT *b,
-		      const RINGLWE_PARAM_DATA *p);
+int KEM1_Encapsulate(RINGELT *u,
+		     uint64_t *cr_v,
+		     uint64_t *mu,
+		     const RINGELT *b,
+		     RINGELT *tmp, /*[3*m] scratch*/
+		     const RINGLWE_PARAM_DATA *p);
+
+/* Split encapsulation: the offline half samples e0, e1 and e2 and computes
+ * u = a*e0+e1, keeping e0 (Fourier Domain) and e2 in e; the online half
+ * needs only Alice's public key b.  Running both is KEM1_Encapsulate.
+ */
+int KEM1_Encapsulate_offline(RINGELT *u,  /*[m]*/
+			     RINGELT *e,  /*[2*m]*/
+			     RINGELT *tmp, /*[m] scratch*/
+			     const RINGLWE_PARAM_DATA *p);
+
+int KEM1_Encapsulate_online(uint64_t *cr_v, /*[muwords]*/
+			    uint64_t *mu,   /*[muwords]*/
+			    const RINGELT *e, /*[2*m]*/
+			    const RINGELT *b, /*[m]*/
+			    RINGELT *tmp, /*[m] scratch*/
+			    const RINGLWE_PARAM_DATA *p);
 
 void KEM1_Decapsulate(uint64_t *mu,  /*[muwords]*/
 		      const RINGELT *u,    /*[m]*/
 		      const RINGELT *s_1,  /*[m]*/
 		      const uint64_t *cr_v, /*[muwords]*/
+		      RINGELT *tmp, /*[m] scratch*/
 		      const RINGLWE_PARAM_DATA *p);
 
-void KEM1_Generate(RINGELT *s, /*[2*m]*/
-		   RINGELT *b, /*[m]*/
-		   const RINGLWE_PARAM_DATA *p);
+int KEM1_Generate(RINGELT *s, /*[2*m]*/
+		  RINGELT *b, /*[m]*/
+		  const RINGLWE_PARAM_DATA *p);
+
+int KEM1_Generate_batch(RINGELT *const *s, /*[n][2*m]*/
+			RINGELT *const *b, /*[n][m]*/
+			size_t n,
+			const RINGLWE_PARAM_DATA *p);
+
+/* The forward and backward transforms of p, which run on FFT_PARAM_get's
+   tables when p has no kernels of its own; ringlwe_fft_prepare sets those
+   up and must have succeeded before the others, or any KEM1_ routine, are
+   called on such a p. */
+int ringlwe_fft_prepare(RINGLWE_PARAM_DATA *p);
+void ringlwe_fft_forward(RINGELT *x, const RINGLWE_PARAM_DATA *p);
+void ringlwe_fft_backward(RINGELT *x, const RINGLWE_PARAM_DATA *p);
+void ringlwe_fft_backward_mul(RINGELT *x, const RINGELT *a, const RINGELT *b,
+			      const RINGLWE_PARAM_DATA *p);
 
 /* Sample secret. Only needed externally for benchmarking. */
-void sample_secret(RINGELT *s, /*[m]*/
-		   const RINGLWE_PARAM_DATA *p);
+int sample_secret(RINGELT *s, /*[m]*/
+		  const RINGLWE_PARAM_DATA *p);
 
 /* Round and cross-round. Only needed externally for benchmarking. */
-void round_and_cross_round(uint64_t *modular_rnd, /*[muwords]*/
-			   uint64_t *cross_rnd, /*[muwords]*/
-			   const RINGELT *v /*[m]*/,
-			   const RINGLWE_PARAM_DATA *p);
+int round_and_cross_round(uint64_t *modular_rnd, /*[muwords]*/
+			  uint64_t *cross_rnd, /*[muwords]*/
+			  const RINGELT *v /*[m]*/,
+			  const RINGLWE_PARAM_DATA *p);
 
 /* Reconcile. Only needed externally for benchmarking. */
 void ringlwe_rec(uint64_t *r,
@@ -15,157 +15,219 @@
 #include <openssl/rand.h>
 #include <openssl/objects.h>
 #include <openssl/err.h>
-#include <openssl/sha.h>
 #include "ringlwe_locl.h"
+#include "ringlwe_consts.h"
 #include "rlwe_rand_openssl_aes.h"
 #include "ringlwe_kex.h"
 
 
-/* Allocate auxiliary variables (context) data structure */
+/* Registry of supported parameter sets.
 
-RLWE_CTX *RLWE_CTX_new(const int nid) {
-  RLWE_CTX *ctx;
-  ctx = (RLWE_CTX *)OPENSSL_malloc(sizeof(RLWE_CTX));
-  if (ctx == NULL) {
-    RINGLWEerr(RINGLWE_F_RLWE_CTX_NEW, ERR_R_MALLOC_FAILURE);
-    return (NULL);
-  }
-  
-  ctx->nid = nid;
-  ctx->param_data = RINGLWE_PARAM_DATA_set(nid);
-  if (ctx->param_data == NULL) {
-    RINGLWEerr(RINGLWE_F_RLWE_CTX_NEW, RINGLWE_R_PARAM_UNKNOWN);
-    goto err;
-  }
-  
-  /* Make 32-byte descriptor for parameter set
+   Each entry is the one and only RLWE_CTX for its parameter set; contexts
+   handed out by RLWE_CTX_new point into this table, so creating and freeing
+   a context is free of allocation and hashing.
+
+   32-byte descriptor for parameter set
      0-3:   "RLWE"
      4-7:   m
      8-11:  q
-     12-31: truncated hash of a */
-  
-  memcpy(ctx->descriptor, (const unsigned char *)"RLWE", 4);
-  ctx->descriptor[4] = (ctx->param_data->m>>24) & 0xff;
-  ctx->descriptor[5] = (ctx->param_data->m>>16) & 0xff;
-  ctx->descriptor[6] = (ctx->param_data->m>>8) & 0xff;
-  ctx->descriptor[7] = (ctx->param_data->m) & 0xff;
-  ctx->descriptor[8] = (ctx->param_data->q>>24) & 0xff;
-  ctx->descriptor[9] = (ctx->param_data->q>>16) & 0xff;
-  ctx->descriptor[10]= (ctx->param_data->q>>8) & 0xff;
-  ctx->descriptor[11]= (ctx->param_data->q) & 0xff;
-  
-#ifndef OPENSSL_NO_SHA
-  unsigned char sha_outbuf[SHA_DIGEST_LENGTH];
-  SHA1((void *)ctx->param_data->a, ctx->param_data->m * sizeof(RINGELT), sha_outbuf);
-  memcpy(ctx->descriptor+12, sha_outbuf, _RLWE_DESCRIPTOR_LEN - 12);
-#else
-  memset(ctx->descriptor+12, 0, 20);
-#endif
-  
-  
-  return (ctx);
- err:
-  OPENSSL_free(ctx);
-  return (NULL);
-}
-
-/* Deallocate auxiliary variables (context) data structure */
-
-void RLWE_CTX_free(RLWE_CTX *r) {
-  if (r == NULL) return;
-  
-  OPENSSL_cleanse((void *)r, sizeof(RLWE_CTX));
-  OPENSSL_free(r);
+     12-31: SHA-1 of a, truncated to 20 bytes.  Coefficients are hashed as
+            64-bit little-endian words (the layout LP64 builds hashed when a
+            was stored as uint_fast16_t).
+   The descriptors are fixed by the wire format and must be regenerated if
+   a ever changes.
+
+   The last field is the number of bits per coefficient that
+   RLWE_get_compressed_bits recommends for compressed public keys; see
+   RLWE_PUB_encode_compressed. */
+
+static const RLWE_CTX rlwe_ctx_registry[] = {
+  { /* m = 1024 */
+      {0x52, 0x4c, 0x57, 0x45, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xa0, 0x01,
+       0xa6, 0xd7, 0x4c, 0x74, 0x00, 0xde, 0x70, 0xdb, 0x56, 0xfa,
+       0x7e, 0xaf, 0x5f, 0x6a, 0x67, 0xba, 0x03, 0xf3, 0x12, 0xb0},
+      NID_ringLearningWithErrors_1024_40961,
+      &_ringlwe_param_1024, 13 },
+  { /* m = 821 */
+      {0x52, 0x4c, 0x57, 0x45, 0x00, 0x00, 0x03, 0x35, 0x00, 0x00, 0xc0, 0x6d,
+       0x67, 0x86, 0xd9, 0xbc, 0x11, 0x96, 0x5f, 0x41, 0x44, 0xcf,
+       0x71, 0xec, 0x3e, 0xa5, 0xe5, 0x3e, 0xfd, 0x97, 0x5f, 0xa1},
+      NID_ringLearningWithErrors_821_49261,
+      &_ringlwe_param_821, 0 },
+  { /* m = 739 */
+      {0x52, 0x4c, 0x57, 0x45, 0x00, 0x00, 0x02, 0xe3, 0x00, 0x00, 0xb8, 0xc1,
+       0x79, 0xe4, 0x23, 0xaf, 0x5f, 0xcf, 0xe6, 0x1a, 0x2a, 0xa2,
+       0x7e, 0x51, 0xf7, 0xfa, 0x7d, 0x4a, 0x98, 0xf1, 0x90, 0x64},
+      NID_ringLearningWithErrors_739_47297,
+      &_ringlwe_param_739, 0 },
+  { /* m = 631 */
+      {0x52, 0x4c, 0x57, 0x45, 0x00, 0x00, 0x02, 0x77, 0x00, 0x00, 0xac, 0x8b,
+       0xb1, 0x24, 0xf6, 0x47, 0x13, 0x9d, 0xc3, 0x67, 0x9a, 0xa0,
+       0x7c, 0x84, 0x02, 0xa1, 0x7f, 0x43, 0x3e, 0x86, 0x28, 0xc6},
+      NID_ringLearningWithErrors_631_44171,
+      &_ringlwe_param_631, 0 },
+  { /* m = 541 */
+      {0x52, 0x4c, 0x57, 0x45, 0x00, 0x00, 0x02, 0x1d, 0x00, 0x00, 0xa0, 0x9d,
+       0xd7, 0x80, 0x2c, 0x38, 0x7c, 0xaa, 0x3b, 0xf7, 0x4c, 0x6e,
+       0x3b, 0xa3, 0xaa, 0x7b, 0xfe, 0xd2, 0x08, 0xaa, 0x3b, 0xcb},
+      NID_ringLearningWithErrors_541_41117,
+      &_ringlwe_param_541, 0 },
+  { /* m = 512 */
+      {0x52, 0x4c, 0x57, 0x45, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x64, 0x01,
+       0x8d, 0x6a, 0x90, 0x8f, 0x6c, 0xe2, 0xc0, 0xa9, 0xe4, 0xc8,
+       0xbb, 0xa4, 0xac, 0x9d, 0x49, 0x7d, 0x79, 0xc5, 0xe3, 0x16},
+      NID_ringLearningWithErrors_512_25601,
+      &_ringlwe_param_512, 12 },
+  { /* m = 433 */
+      {0x52, 0x4c, 0x57, 0x45, 0x00, 0x00, 0x01, 0xb1, 0x00, 0x00, 0x8a, 0xb3,
+       0x31, 0x1f, 0x0c, 0x06, 0xde, 0xcd, 0x3e, 0x89, 0x44, 0x4c,
+       0x9f, 0xe0, 0x05, 0xcd, 0x6e, 0x25, 0x87, 0x85, 0x85, 0xc6},
+      NID_ringLearningWithErrors_433_35507,
+      &_ringlwe_param_433, 0 },
+  { /* m = 337 */
+      {0x52, 0x4c, 0x57, 0x45, 0x00, 0x00, 0x01, 0x51, 0x00, 0x00, 0x7e, 0x61,
+       0x65, 0x99, 0x65, 0x5b, 0xc9, 0x4d, 0xbf, 0xa5, 0x21, 0xe2,
+       0xef, 0x93, 0xec, 0x4c, 0x78, 0xc9, 0x02, 0x1d, 0xa5, 0x6b},
+      NID_ringLearningWithErrors_337_32353,
+      &_ringlwe_param_337, 0 },
+  { /* m = 256 */
+      {0x52, 0x4c, 0x57, 0x45, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x01,
+       0x2e, 0xc7, 0x72, 0x5f, 0xc0, 0xbd, 0x37, 0x3d, 0x62, 0x18,
+       0x42, 0x87, 0xb6, 0xe7, 0x7c, 0xb3, 0x10, 0x6b, 0x0a, 0x9f},
+      NID_ringLearningWithErrors_256_15361,
+      &_ringlwe_param_256, 13 }
+};
+
+/* Look up the registry entry for a nid; NULL if the nid is not a
+   ring-LWE parameter set */
+
+/* A set without compiled transforms is usable once the runtime engine has
+   its tables, which are built on first use and can fail to be; this is
+   done as the set is looked up, so that the KEM itself cannot fail */
+
+static const RLWE_CTX *rlwe_ctx_ready(const RLWE_CTX *ctx) {
+  if (!ringlwe_fft_prepare(ctx->param_data))
+    return NULL;
+  return ctx;
 }
 
+static const RLWE_CTX *rlwe_ctx_from_nid(const int nid) {
+  const RLWE_CTX *ctx;
 
-RINGLWE_PARAM_DATA *RINGLWE_PARAM_DATA_set(const int nid)
-{
-  /* Select ring-LWE parameter set based on supplied nid */
-  RINGLWE_PARAM_DATA *ret = NULL;
   switch (nid)
     {
     case NID_ringLearningWithErrors_1024_40961:
-      ret = &_ringlwe_param_1024;
-      break;
+      ctx = &rlwe_ctx_registry[0]; break;
     case NID_ringLearningWithErrors_821_49261:
-      ret = &_ringlwe_param_821;
-      break;
+      ctx = &rlwe_ctx_registry[1]; break;
     case NID_ringLearningWithErrors_739_47297:
-      ret = &_ringlwe_param_739;
-      break;
+      ctx = &rlwe_ctx_registry[2]; break;
     case NID_ringLearningWithErrors_631_44171:
-      ret = &_ringlwe_param_631;
-      break;
+      ctx = &rlwe_ctx_registry[3]; break;
     case NID_ringLearningWithErrors_541_41117:
-      ret = &_ringlwe_param_541;
-      break;
+      ctx = &rlwe_ctx_registry[4]; break;
     case NID_ringLearningWithErrors_512_25601:
-      ret = &_ringlwe_param_512;
-      break;
+      ctx = &rlwe_ctx_registry[5]; break;
     case NID_ringLearningWithErrors_433_35507:
-      ret = &_ringlwe_param_433;
-      break;
+      ctx = &rlwe_ctx_registry[6]; break;
     case NID_ringLearningWithErrors_337_32353:
-      ret = &_ringlwe_param_337;
-      break;
+      ctx = &rlwe_ctx_registry[7]; break;
     case NID_ringLearningWithErrors_256_15361:
-      ret = &_ringlwe_param_256;
-      break;
+      ctx = &rlwe_ctx_registry[8]; break;
+    default:
+      return NULL;
+    }
+  return rlwe_ctx_ready(ctx);
+}
+
+/* Look up the registry entry for a 32-byte descriptor; NULL if there is no
+   exact match.  Every parameter set has a distinct m, so m selects the only
+   candidate and a single comparison settles it. */
+
+static const RLWE_CTX *rlwe_ctx_from_descriptor(const unsigned char descriptor[_RLWE_DESCRIPTOR_LEN]) {
+  const RLWE_CTX *ctx;
+  uint32_t m;
+
+  m = ((uint32_t)descriptor[4] << 24) | ((uint32_t)descriptor[5] << 16) |
+    ((uint32_t)descriptor[6] << 8) | descriptor[7];
+
+  switch (m)
+    {
+    case 1024: ctx = &rlwe_ctx_registry[0]; break;
+    case 821:  ctx = &rlwe_ctx_registry[1]; break;
+    case 739:  ctx = &rlwe_ctx_registry[2]; break;
+    case 631:  ctx = &rlwe_ctx_registry[3]; break;
+    case 541:  ctx = &rlwe_ctx_registry[4]; break;
+    case 512:  ctx = &rlwe_ctx_registry[5]; break;
+    case 433:  ctx = &rlwe_ctx_registry[6]; break;
+    case 337:  ctx = &rlwe_ctx_registry[7]; break;
+    case 256:  ctx = &rlwe_ctx_registry[8]; break;
+    default:   return NULL;
     }
-  return ret;
+  if (memcmp(descriptor, ctx->descriptor, _RLWE_DESCRIPTOR_LEN))
+    return NULL;
+  return rlwe_ctx_ready(ctx);
+}
+
+/* Look up the registry entry that owns a parameter set, for handing to
+   the RLWE_METHOD; the table is short enough to scan */
+
+static const RLWE_CTX *rlwe_ctx_from_param_data(const RINGLWE_PARAM_DATA *p) {
+  size_t i;
+
+  for (i = 0; i < sizeof(rlwe_ctx_registry) / sizeof(rlwe_ctx_registry[0]); i++) {
+    if (rlwe_ctx_registry[i].param_data == p)
+      return &rlwe_ctx_registry[i];
+  }
+  return NULL;
+}
+
+/* Return the shared context for a parameter set.  The context is immutable
+   and lives for the lifetime of the process; RLWE_CTX_free on it is a
+   no-op, so callers may keep using the usual new/free pairing. */
+
+RLWE_CTX *RLWE_CTX_new(const int nid) {
+  const RLWE_CTX *ctx;
+  ctx = rlwe_ctx_from_nid(nid);
+  if (ctx == NULL) {
+    RINGLWEerr(RINGLWE_F_RLWE_CTX_NEW, RINGLWE_R_PARAM_UNKNOWN);
+    return (NULL);
+  }
+  return ((RLWE_CTX *)ctx);
+}
+
+/* Release a context obtained from RLWE_CTX_new.  Contexts are shared
+   registry entries, so there is nothing to do. */
+
+void RLWE_CTX_free(RLWE_CTX *r) {
+  (void)r;
+}
+
+
+RINGLWE_PARAM_DATA *RINGLWE_PARAM_DATA_set(const int nid)
+{
+  /* Select ring-LWE parameter set based on supplied nid */
+  const RLWE_CTX *ctx = rlwe_ctx_from_nid(nid);
+  if (ctx == NULL)
+    return NULL;
+  return ctx->param_data;
 }
 
 int RLWE_get_nid_from_descriptor(const unsigned char descriptor[_RLWE_DESCRIPTOR_LEN]) {
- /* Parse 32-byte descriptor for parameter set
-     0-3:   "RLWE"
-     4-7:   m
-     8-11:  q
-     12-31: truncated hash of a */
+  const RLWE_CTX *ctx = rlwe_ctx_from_descriptor(descriptor);
+  if (ctx == NULL)
+    return 0;
+  return ctx->nid;
+}
 
-  if (memcmp(descriptor, (const char *)"RLWE", 4)) {
+/* Return the number of bits per coefficient to use for compressed public
+   keys of a parameter set, or 0 if it has no compressed encoding */
+
+int RLWE_get_compressed_bits(const int nid) {
+  const RLWE_CTX *ctx = rlwe_ctx_from_nid(nid);
+  if (ctx == NULL)
     return 0;
-  }
-  
-  int i;
-  uint32_t m;
-  RINGELT  q;
-  m = (descriptor[4] << 24) | (descriptor[5] << 16) |
-    (descriptor[6] << 8) | descriptor[7];
-  q = (descriptor[8] << 24) | (descriptor[9] << 16) |
-    (descriptor[10] << 8) | descriptor[11];
-  
-  int rlwe_nid_list[9] = {
-    NID_ringLearningWithErrors_1024_40961,
-    NID_ringLearningWithErrors_821_49261,
-    NID_ringLearningWithErrors_739_47297,
-    NID_ringLearningWithErrors_631_44171,
-    NID_ringLearningWithErrors_541_41117,
-    NID_ringLearningWithErrors_512_25601,
-    NID_ringLearningWithErrors_433_35507,
-    NID_ringLearningWithErrors_337_32353,
-    NID_ringLearningWithErrors_256_15361
-  };
-  
-  /* Loop through list of valid parameter sets looking for match with 32-byte
-     descriptor */
-  int nid = 0;
-  for (i = 0; i < 9; i++) {
-    RINGLWE_PARAM_DATA *p = RINGLWE_PARAM_DATA_set(rlwe_nid_list[i]);
-    if (p == NULL)
-      continue;
-    if ((p->m != m) || (p->q != q))
-      continue;
-#ifndef OPENSSL_NO_SHA
-    unsigned char sha_outbuf[SHA_DIGEST_LENGTH];
-    SHA1((void *)p->a, p->m * sizeof(RINGELT), sha_outbuf);
-    if (memcmp(descriptor+12, sha_outbuf, _RLWE_DESCRIPTOR_LEN -12))
-      continue;
-#endif
-    /* Found a match */
-    nid = rlwe_nid_list[i];
-  }
-  return nid;
+  return ctx->compressed_bits;
 }
 
 
@@ -278,6 +340,8 @@ RLWE_PAIR *RLWE_PAIR_new(RLWE_CTX *ctx) {
   pair->param_data = ctx->param_data;
   memcpy(pair->descriptor, ctx->descriptor, _RLWE_DESCRIPTOR_LEN);
   pair->keys_set = 0;
+  pair->pub_set = 0;
+  pair->references = 1;
   
   pair->pub = (RLWE_PUB *)RLWE_PUB_new(ctx);
   pair->s = (RINGELT *) OPENSSL_malloc(2 * ctx->param_data->m * sizeof(RINGELT));
@@ -309,6 +373,8 @@ RLWE_PAIR *RLWE_PAIR_dup(const RLWE_PAIR *src) {
   /* copy the parameters */
   dest->param_data = src->param_data;
   memcpy(dest->descriptor, src->descriptor, _RLWE_DESCRIPTOR_LEN);
+  dest->s = NULL;
+  dest->references = 1;
   
   /* copy the public key */
   dest->pub = (RLWE_PUB *)RLWE_PUB_dup(src->pub);
@@ -328,15 +394,30 @@ RLWE_PAIR *RLWE_PAIR_dup(const RLWE_PAIR *src) {
     memcpy(dest->s, src->s, 2 * src->param_data->m * sizeof(RINGELT));
   }
   dest->keys_set = src->keys_set;
+  dest->pub_set = src->pub_set;
   
   return dest;
 }
 
+/* Take another reference to a key pair; each reference is released with
+   RLWE_PAIR_free.  A shared pair must not be regenerated. */
+
+int RLWE_PAIR_up_ref(RLWE_PAIR *r) {
+  if (r == NULL) {
+    RINGLWEerr(RINGLWE_F_RLWE_PAIR_UP_REF, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+  return (CRYPTO_add(&r->references, 1, CRYPTO_LOCK_RINGLWE) > 1);
+}
+
 /* Deallocate public key / private key pair data structure */
 
 void RLWE_PAIR_free(RLWE_PAIR *r) {
   if (r == NULL) return;
   
+  if (CRYPTO_add(&r->references, -1, CRYPTO_LOCK_RINGLWE) > 0)
+    return;
+  
   RLWE_PUB_free(r->pub);
   
   if (r->s && r->param_data) {
@@ -387,10 +468,64 @@ void RLWE_REC_free(RLWE_REC *r) {
   OPENSSL_free(r);
 }
 
+/* Allocate and deallocate encapsulation ticket */
+
+RLWE_TICKET *RLWE_TICKET_new(RLWE_CTX *ctx) {
+  RLWE_TICKET *ticket;
+
+  if ((ctx == NULL) || (ctx->param_data == NULL)) {
+    RINGLWEerr(RINGLWE_F_RLWE_TICKET_NEW, ERR_R_PASSED_NULL_PARAMETER);
+    return (NULL);
+  }
+
+  ticket = (RLWE_TICKET *)OPENSSL_malloc(sizeof(RLWE_TICKET));
+  if (ticket == NULL) {
+    RINGLWEerr(RINGLWE_F_RLWE_TICKET_NEW, ERR_R_MALLOC_FAILURE);
+    return (NULL);
+  }
+
+  ticket->param_data = ctx->param_data;
+  memcpy(ticket->descriptor, ctx->descriptor, _RLWE_DESCRIPTOR_LEN);
+  ticket->pub_set = 0;
+  ticket->e_set = 0;
+  ticket->pub_enc = NULL;
+
+  ticket->pub = RLWE_PUB_new(ctx);
+  ticket->pub_enc_len = i2o_RLWE_PUB(ticket->pub, NULL);
+  if (ticket->pub_enc_len != 0)
+    ticket->pub_enc = (unsigned char *) OPENSSL_malloc(ticket->pub_enc_len);
+  ticket->e = (RINGELT *) OPENSSL_malloc(3 * ctx->param_data->m * sizeof(RINGELT));
+  if ((ticket->pub == NULL) || (ticket->pub_enc == NULL) || (ticket->e == NULL)) {
+    RINGLWEerr(RINGLWE_F_RLWE_TICKET_NEW, ERR_R_MALLOC_FAILURE);
+    RLWE_TICKET_free(ticket);
+    return (NULL);
+  }
+
+  return (ticket);
+}
+
+void RLWE_TICKET_free(RLWE_TICKET *r) {
+  if (r == NULL) return;
+
+  RLWE_PUB_free(r->pub);
+  if (r->pub_enc) {
+    OPENSSL_free(r->pub_enc);
+  }
+  if (r->e && r->param_data) {
+    OPENSSL_cleanse(r->e, 3 * r->param_data->m * sizeof(RINGELT));
+  }
+  if (r->e) {
+    OPENSSL_free(r->e);
+  }
+
+  OPENSSL_cleanse((void *)r, sizeof(RLWE_TICKET));
+  OPENSSL_free(r);
+}
+
 /* Generate key pair */
 
 int RLWE_PAIR_generate_key(RLWE_PAIR *keypair) {
-  // wrapper for KEM1_Generate
+  // wrapper for the method's generate, normally KEM1_Generate
   RINGLWE_PARAM_DATA *p;
   
   if (keypair == NULL) {
@@ -408,16 +543,252 @@ int RLWE_PAIR_generate_key(RLWE_PAIR *keypair) {
     return 0;
   }
   
-  KEM1_Generate(keypair->s, keypair->pub->b, p);
+  if (!RLWE_get_default_method()->generate(keypair->s, keypair->pub->b,
+					   rlwe_ctx_from_param_data(p))) {
+    RINGLWEerr(RINGLWE_F_RLWE_PAIR_GENERATE_KEY, RINGLWE_R_METHOD_FAILED);
+    return 0;
+  }
   keypair->keys_set = 1;
+  keypair->pub_set = 1;
   return 1;
 }
 
-/* Convert public key data structure from binary */
+/* Precompute an encapsulation: everything RINGLWE_compute_key_bob does
+   before it looks at Alice's public key */
 
-RLWE_PUB *o2i_RLWE_PUB(RLWE_PUB **pub, const unsigned char *in, size_t len) {
-  size_t i;
+int RLWE_TICKET_generate(RLWE_TICKET *ticket) {
+  unsigned char *ptr;
+
+  if ((ticket == NULL) || (ticket->pub == NULL) || (ticket->param_data == NULL)) {
+    RINGLWEerr(RINGLWE_F_RLWE_TICKET_GENERATE, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+
+  if (!KEM1_Encapsulate_offline(ticket->pub->b, ticket->e, ticket->e + 2 * ticket->param_data->m,
+				ticket->param_data)) {
+    OPENSSL_cleanse(ticket->e, 2 * ticket->param_data->m * sizeof(RINGELT));
+    RINGLWEerr(RINGLWE_F_RLWE_TICKET_GENERATE, RINGLWE_R_RANDOM_FAILED);
+    return 0;
+  }
+  ptr = ticket->pub_enc;
+  if (i2o_RLWE_PUB(ticket->pub, &ptr) != ticket->pub_enc_len) {
+    RINGLWEerr(RINGLWE_F_RLWE_TICKET_GENERATE, ERR_R_INTERNAL_ERROR);
+    return 0;
+  }
+  ticket->pub_set = 1;
+  ticket->e_set = 1;
+  return 1;
+}
+
+/* Generate n key pairs in one pass.  All pairs must use the same parameter
+   set.  If pub_out is not NULL the public keys are also serialised there,
+   one after another, each taking i2o_RLWE_PUB(pub, NULL) bytes. */
+
+#define RLWE_BATCH_CHUNK 16
+
+int RLWE_PAIR_generate_keys_batch(RLWE_PAIR **pairs, size_t n, unsigned char *pub_out) {
+  const RLWE_METHOD *meth;
+  const RLWE_CTX *ctx;
+  RINGLWE_PARAM_DATA *p;
+  RINGELT *s[RLWE_BATCH_CHUNK], *b[RLWE_BATCH_CHUNK];
+  size_t i, k, chunk;
+  
+  if ((pairs == NULL) || (n == 0)) {
+    RINGLWEerr(RINGLWE_F_RLWE_PAIR_GENERATE_KEYS_BATCH, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+  for (i = 0; i < n; i++) {
+    if ((pairs[i] == NULL) || (pairs[i]->pub == NULL)) {
+      RINGLWEerr(RINGLWE_F_RLWE_PAIR_GENERATE_KEYS_BATCH, ERR_R_PASSED_NULL_PARAMETER);
+      return 0;
+    }
+    if ((pairs[i]->param_data != pairs[0]->param_data) ||
+	(pairs[i]->pub->param_data != pairs[0]->param_data)) {
+      RINGLWEerr(RINGLWE_F_RLWE_PAIR_GENERATE_KEYS_BATCH, RINGLWE_R_PARAM_INVALID);
+      return 0;
+    }
+  }
+  p = pairs[0]->param_data;
+  if (p == NULL) {
+    RINGLWEerr(RINGLWE_F_RLWE_PAIR_GENERATE_KEYS_BATCH, RINGLWE_R_PARAM_UNKNOWN);
+    return 0;
+  }
+  
+  meth = RLWE_get_default_method();
+  ctx = rlwe_ctx_from_param_data(p);
+  for (i = 0; i < n; i += chunk) {
+    chunk = n - i;
+    if (chunk > RLWE_BATCH_CHUNK)
+      chunk = RLWE_BATCH_CHUNK;
+    for (k = 0; k < chunk; k++) {
+      s[k] = pairs[i+k]->s;
+      b[k] = pairs[i+k]->pub->b;
+    }
+    if (meth->generate_batch != NULL) {
+      if (!meth->generate_batch(s, b, chunk, ctx)) {
+	RINGLWEerr(RINGLWE_F_RLWE_PAIR_GENERATE_KEYS_BATCH, RINGLWE_R_METHOD_FAILED);
+	return 0;
+      }
+    } else {
+      for (k = 0; k < chunk; k++) {
+	if (!meth->generate(s[k], b[k], ctx)) {
+	  RINGLWEerr(RINGLWE_F_RLWE_PAIR_GENERATE_KEYS_BATCH, RINGLWE_R_METHOD_FAILED);
+	  return 0;
+	}
+      }
+    }
+    for (k = 0; k < chunk; k++) {
+      pairs[i+k]->keys_set = 1;
+      pairs[i+k]->pub_set = 1;
+    }
+  }
   
+  if (pub_out != NULL) {
+    for (i = 0; i < n; i++) {
+      if (i2o_RLWE_PUB(pairs[i]->pub, &pub_out) == 0)
+	return 0;
+    }
+  }
+  return 1;
+}
+
+/* Convert public key data structure from binary */
+
+/* Ring elements go on the wire big-endian, in 2 bytes, or 4 if q needs
+   them.  These loops have no dependencies between iterations and
+   vectorise. */
+
+static size_t rlwe_ringelt_bytes(const RINGLWE_PARAM_DATA *p) {
+  return (p->q >= 0x00010000) ? 4 : 2;
+}
+
+static void rlwe_encode_ringelts(unsigned char *out, const RINGELT *b, uint32_t m, size_t nbytes) {
+  uint32_t i;
+
+  if (nbytes == 4) {
+    for (i = 0; i < m; i++) {
+      out[4*i] = (unsigned char) (((uint32_t)b[i] >> 24) & 0xff);
+      out[4*i+1] = (unsigned char) (((uint32_t)b[i] >> 16) & 0xff);
+      out[4*i+2] = (unsigned char) ((b[i] >> 8) & 0xff);
+      out[4*i+3] = (unsigned char) (b[i] & 0xff);
+    }
+    return;
+  }
+  for (i = 0; i < m; i++) {
+    out[2*i] = (unsigned char) (b[i] >> 8);
+    out[2*i+1] = (unsigned char) b[i];
+  }
+}
+
+static void rlwe_decode_ringelts(RINGELT *b, const unsigned char *in, uint32_t m, size_t nbytes) {
+  uint32_t i;
+
+  if (nbytes == 4) {
+    for (i = 0; i < m; i++)
+      b[i] = (RINGELT) (((uint32_t)in[4*i] << 24) | ((uint32_t)in[4*i+1] << 16) |
+			((uint32_t)in[4*i+2] << 8) | in[4*i+3]);
+    return;
+  }
+  for (i = 0; i < m; i++)
+    b[i] = (RINGELT) ((in[2*i] << 8) | in[2*i+1]);
+}
+
+/* Reconciliation words go on the wire little-endian */
+
+static void rlwe_decode_words(uint64_t *c, const unsigned char *in, uint32_t muwords) {
+  uint32_t i;
+  int k;
+
+  for (i = 0; i < muwords; i++) {
+    c[i] = 0;
+    for (k = 0; k < 8; k++)
+      c[i] |= ((uint64_t)in[8*i + k]) << (8*k);
+  }
+}
+
+/* Compressed public keys go on the wire as the descriptor, a byte giving
+   the number of bits d kept per coefficient, then the coefficients of the
+   key taken back out of the Fourier domain, each scaled to round(x 2^d / q)
+   and packed little-endian d bits at a time.  The receiver scales them
+   back and transforms again, which leaves an error of about q / 2^(d+1)
+   in each coefficient.  That error is multiplied by the receiver's small
+   secret and adds to the noise that reconciliation must absorb; the widths
+   in the registry keep a Chernoff bound on the chance of a coefficient
+   landing outside the q/8 tolerance, summed over all m coefficients,
+   below 2^-40 even with both keys compressed (see ringlwe.h).  Only the
+   power-of-two sets have a forward transform that takes arbitrary
+   input, so only they have compressed widths. */
+
+#define RLWE_COMPRESSED_BITS_MAX 15
+
+static size_t rlwe_compressed_len(const RINGLWE_PARAM_DATA *p, int bits) {
+  return _RLWE_DESCRIPTOR_LEN + 1 + ((size_t)p->m * bits + 7) / 8;
+}
+
+/* Work out which encoding of a public key for ctx in holds: 0 for the
+   plain one, the number of bits per coefficient for a compressed one, or
+   -1 if neither matches len.  The lengths of the two can never agree.  A
+   compressed encoding is only recognised if compressed is set. */
+static int rlwe_pub_format(const RLWE_CTX *ctx, const unsigned char *in, size_t len, int compressed) {
+  const RINGLWE_PARAM_DATA *p = ctx->param_data;
+  int bits;
+
+  if (len == _RLWE_DESCRIPTOR_LEN + p->m * rlwe_ringelt_bytes(p))
+    return 0;
+  if (!compressed || (ctx->compressed_bits == 0) || (len <= _RLWE_DESCRIPTOR_LEN))
+    return -1;
+  bits = in[_RLWE_DESCRIPTOR_LEN];
+  if ((bits < 1) || (bits > RLWE_COMPRESSED_BITS_MAX) || (len != rlwe_compressed_len(p, bits)))
+    return -1;
+  return bits;
+}
+
+/* Compress the key in t, which is overwritten */
+static void rlwe_compress_ringelts(unsigned char *out, RINGELT *t, int bits, const RINGLWE_PARAM_DATA *p) {
+  uint32_t acc = 0, mask = (1U << bits) - 1;
+  int nacc = 0;
+  uint32_t i;
+
+  ringlwe_fft_backward(t, p);
+  for (i = 0; i < p->m; i++) {
+    acc |= (((((uint32_t)t[i] << bits) + p->q / 2) / p->q) & mask) << nacc;
+    nacc += bits;
+    while (nacc >= 8) {
+      *out++ = (unsigned char) acc;
+      acc >>= 8;
+      nacc -= 8;
+    }
+  }
+  if (nacc > 0)
+    *out = (unsigned char) acc;
+}
+
+static void rlwe_decompress_ringelts(RINGELT *b, const unsigned char *in, int bits, const RINGLWE_PARAM_DATA *p) {
+  uint32_t acc = 0, mask = (1U << bits) - 1;
+  int nacc = 0;
+  uint32_t i;
+
+  for (i = 0; i < p->m; i++) {
+    while (nacc < bits) {
+      acc |= (uint32_t)*in++ << nacc;
+      nacc += 8;
+    }
+    b[i] = (RINGELT) (((acc & mask) * p->q + (1U << (bits - 1))) >> bits);
+    acc >>= bits;
+    nacc -= bits;
+  }
+  ringlwe_fft_forward(b, p);
+}
+
+/* Decode either encoding of a public key, as classified by rlwe_pub_format */
+static void rlwe_decode_pub(RINGELT *b, const unsigned char *in, int format, const RINGLWE_PARAM_DATA *p) {
+  if (format == 0)
+    rlwe_decode_ringelts(b, in + _RLWE_DESCRIPTOR_LEN, p->m, rlwe_ringelt_bytes(p));
+  else
+    rlwe_decompress_ringelts(b, in + _RLWE_DESCRIPTOR_LEN + 1, format, p);
+}
+
+static RLWE_PUB *rlwe_o2i_pub(RLWE_PUB **pub, const unsigned char *in, size_t len, int compressed) {
   if ((pub == NULL) || (in == NULL)) {
     RINGLWEerr(RINGLWE_F_O2I_RLWE_PUB, ERR_R_PASSED_NULL_PARAMETER);
     return 0;
@@ -430,29 +801,16 @@ RLWE_PUB *o2i_RLWE_PUB(RLWE_PUB **pub, const unsigned char *in, size_t len) {
   /* Read 32-byte descriptor and get parameters */
   const unsigned char *descriptor = in;
   
-  int nid;
-  nid  = RLWE_get_nid_from_descriptor(descriptor);
-	
-  if (nid == 0) {
-    RINGLWEerr(RINGLWE_F_O2I_RLWE_PUB, RINGLWE_R_PARAM_UNKNOWN);
-    return 0;
-  }
-  
-  RLWE_CTX *ctx;
-  ctx = RLWE_CTX_new(nid);
+  const RLWE_CTX *ctx;
+  ctx = rlwe_ctx_from_descriptor(descriptor);
   if (ctx == NULL) {
-    RINGLWEerr(RINGLWE_F_O2I_RLWE_PUB, ERR_R_MALLOC_FAILURE);
+    RINGLWEerr(RINGLWE_F_O2I_RLWE_PUB, RINGLWE_R_PARAM_UNKNOWN);
     return 0;
   }
   
-  uint32_t m = ctx->param_data->m;
-  RINGELT  q = ctx->param_data->q;
-  uint32_t n_ringelt_bytes = 2;
-  if (q >= 0x00010000)
-    n_ringelt_bytes = 4;
+  int format = rlwe_pub_format(ctx, in, len, compressed);
   
-  if (len != _RLWE_DESCRIPTOR_LEN + m * n_ringelt_bytes) {
-    RLWE_CTX_free(ctx);
+  if (format < 0) {
     RINGLWEerr(RINGLWE_F_O2I_RLWE_PUB, RINGLWE_R_INVALID_FORMAT);
     return 0;
   }
@@ -460,17 +818,14 @@ RLWE_PUB *o2i_RLWE_PUB(RLWE_PUB **pub, const unsigned char *in, size_t len) {
  
   RLWE_PUB *pub_key;
   if (*pub != NULL) {
-    if (memcmp(ctx->param_data, (*pub)->param_data, sizeof(RINGLWE_PARAM_DATA))) {
-      RLWE_CTX_free(ctx);
+    if (ctx->param_data != (*pub)->param_data) {
       RINGLWEerr(RINGLWE_F_O2I_RLWE_PUB, RINGLWE_R_PARAM_INVALID);
       return  0;
     }
-    RLWE_CTX_free(ctx);
     pub_key = *pub;
   }
   else {
     pub_key = RLWE_PUB_new(ctx);
-    RLWE_CTX_free(ctx);
     if (pub_key == NULL) {
       RINGLWEerr(RINGLWE_F_O2I_RLWE_PUB, ERR_R_MALLOC_FAILURE);
       return 0;
@@ -478,19 +833,19 @@ RLWE_PUB *o2i_RLWE_PUB(RLWE_PUB **pub, const unsigned char *in, size_t len) {
   }
   
   /* Get public key data from binary into structure */
-  const unsigned char *ptr = (const unsigned char *)in + _RLWE_DESCRIPTOR_LEN;
-  for (i = 0; i < m; i++) {
-    pub_key->b[i] = 0;
-    if (n_ringelt_bytes == 4) {
-      pub_key->b[i] |= ((RINGELT)*ptr++) << 24;
-      pub_key->b[i] |= ((RINGELT)*ptr++) << 16; }
-    pub_key->b[i] |= ((RINGELT)*ptr++) << 8;
-    pub_key->b[i] |= (RINGELT)*ptr++;
-  }
+  rlwe_decode_pub(pub_key->b, in, format, ctx->param_data);
   *pub = pub_key;
   return *pub;
 }
 
+RLWE_PUB *o2i_RLWE_PUB(RLWE_PUB **pub, const unsigned char *in, size_t len) {
+  return rlwe_o2i_pub(pub, in, len, 0);
+}
+
+RLWE_PUB *o2i_RLWE_PUB_compressed(RLWE_PUB **pub, const unsigned char *in, size_t len) {
+  return rlwe_o2i_pub(pub, in, len, 1);
+}
+
 /* Convert private key data structure from binary */
 
 RLWE_PAIR *o2i_RLWE_SEC(RLWE_PAIR **pair, const unsigned char *in, size_t len) {
@@ -508,46 +863,34 @@ RLWE_PAIR *o2i_RLWE_SEC(RLWE_PAIR **pair, const unsigned char *in, size_t len) {
   /* Read 32-byte descriptor and get parameters */
   const unsigned char *descriptor = in;
   
-  int nid;
-  nid  = RLWE_get_nid_from_descriptor(descriptor);
-  
-  if (nid == 0) {
-    RINGLWEerr(RINGLWE_F_O2I_RLWE_SEC, RINGLWE_R_PARAM_UNKNOWN);
-    return 0;
-  }
-  
-  RLWE_CTX *ctx;
-  ctx = RLWE_CTX_new(nid);
+  const RLWE_CTX *ctx;
+  ctx = rlwe_ctx_from_descriptor(descriptor);
   if (ctx == NULL) {
-    RINGLWEerr(RINGLWE_F_O2I_RLWE_SEC, ERR_R_MALLOC_FAILURE);
+    RINGLWEerr(RINGLWE_F_O2I_RLWE_SEC, RINGLWE_R_PARAM_UNKNOWN);
     return 0;
   }
   
   uint32_t m = ctx->param_data->m;
-  RINGELT  q = ctx->param_data->q;
+  uint32_t q = ctx->param_data->q;
   uint32_t n_ringelt_bytes = 2;
   if (q >= 0x00010000)
     n_ringelt_bytes = 4;
   
   if (len != _RLWE_DESCRIPTOR_LEN + m * n_ringelt_bytes) {
-    RLWE_CTX_free(ctx);
     RINGLWEerr(RINGLWE_F_O2I_RLWE_SEC, RINGLWE_R_INVALID_FORMAT);
     return 0;
   }
   
   RLWE_PAIR *key_pair;
   if (*pair != NULL) {
-    if (memcmp(ctx->param_data, (*pair)->param_data, sizeof(RINGLWE_PARAM_DATA))) {
-      RLWE_CTX_free(ctx);
+    if (ctx->param_data != (*pair)->param_data) {
       RINGLWEerr(RINGLWE_F_O2I_RLWE_SEC, RINGLWE_R_PARAM_INVALID);
       return  0;
     }
-    RLWE_CTX_free(ctx);
     key_pair = *pair;
   }
   else {
-    key_pair = RLWE_PAIR_new(ctx);
-    RLWE_CTX_free(ctx);
+    key_pair = RLWE_PAIR_new((RLWE_CTX *)ctx);
     if (key_pair == NULL) {
       RINGLWEerr(RINGLWE_F_O2I_RLWE_SEC, ERR_R_MALLOC_FAILURE);
       return 0;
@@ -568,30 +911,73 @@ RLWE_PAIR *o2i_RLWE_SEC(RLWE_PAIR **pair, const unsigned char *in, size_t len) {
   return *pair;
 }
 
-/* Convert public key data structure into binary */
+/* Write the encoding of pub to out, which has room for outlen bytes.
+   With out NULL, just return the length of the encoding. */
 
-size_t i2o_RLWE_PUB(RLWE_PUB *pub, unsigned char **out) {
-  size_t buf_len = 0;
-  int new_buffer = 0, i;
-  
-  if (pub == NULL) {
-    RINGLWEerr(RINGLWE_F_I2O_RLWE_PUB, ERR_R_PASSED_NULL_PARAMETER);
+size_t RLWE_PUB_encode(const RLWE_PUB *pub, unsigned char *out, size_t outlen) {
+  size_t buf_len, n_ringelt_bytes;
+
+  if ((pub == NULL) || (pub->param_data == NULL)) {
+    RINGLWEerr(RINGLWE_F_RLWE_PUB_ENCODE, ERR_R_PASSED_NULL_PARAMETER);
     return 0;
   }
-  if (pub->param_data == NULL) {
-    RINGLWEerr(RINGLWE_F_I2O_RLWE_PUB, ERR_R_PASSED_NULL_PARAMETER);
+
+  n_ringelt_bytes = rlwe_ringelt_bytes(pub->param_data);
+  buf_len = _RLWE_DESCRIPTOR_LEN + pub->param_data->m * n_ringelt_bytes;
+  if (out == NULL)
+    return buf_len;
+  if (outlen < buf_len) {
+    RINGLWEerr(RINGLWE_F_RLWE_PUB_ENCODE, RINGLWE_R_BUFFER_TOO_SMALL);
     return 0;
   }
+
+  /* Copy 32-byte descriptor, then public key data */
+  memcpy(out, pub->descriptor, _RLWE_DESCRIPTOR_LEN);
+  rlwe_encode_ringelts(out + _RLWE_DESCRIPTOR_LEN, pub->b, pub->param_data->m, n_ringelt_bytes);
+  return buf_len;
+}
+
+/* As RLWE_PUB_encode, but writing the compressed encoding with bits bits
+   per coefficient */
+
+size_t RLWE_PUB_encode_compressed(const RLWE_PUB *pub, int bits, unsigned char *out, size_t outlen) {
+  const RLWE_CTX *ctx;
+  size_t buf_len;
+
+  if ((pub == NULL) || (pub->param_data == NULL)) {
+    RINGLWEerr(RINGLWE_F_RLWE_PUB_ENCODE_COMPRESSED, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+  ctx = rlwe_ctx_from_descriptor(pub->descriptor);
+  if ((ctx == NULL) || (ctx->compressed_bits == 0)
+      || (bits < 1) || (bits > RLWE_COMPRESSED_BITS_MAX)) {
+    RINGLWEerr(RINGLWE_F_RLWE_PUB_ENCODE_COMPRESSED, RINGLWE_R_COMPRESSION_UNSUPPORTED);
+    return 0;
+  }
+
+  buf_len = rlwe_compressed_len(pub->param_data, bits);
+  if (out == NULL)
+    return buf_len;
+  if (outlen < buf_len) {
+    RINGLWEerr(RINGLWE_F_RLWE_PUB_ENCODE_COMPRESSED, RINGLWE_R_BUFFER_TOO_SMALL);
+    return 0;
+  }
+
+  RINGELT t[pub->param_data->m];
+  memcpy(t, pub->b, pub->param_data->m * sizeof(RINGELT));
+  memcpy(out, pub->descriptor, _RLWE_DESCRIPTOR_LEN);
+  out[_RLWE_DESCRIPTOR_LEN] = (unsigned char) bits;
+  rlwe_compress_ringelts(out + _RLWE_DESCRIPTOR_LEN + 1, t, bits, pub->param_data);
+  return buf_len;
+}
+
+/* Convert public key data structure into binary */
+
+size_t i2o_RLWE_PUB(RLWE_PUB *pub, unsigned char **out) {
+  size_t buf_len;
+  int new_buffer = 0;
   
-  
-  uint32_t m = pub->param_data->m;
-  RINGELT  q = pub->param_data->q;
-  uint32_t n_ringelt_bytes = 2;
-  if (q >= 0x00010000)
-    n_ringelt_bytes = 4;
-  
-  buf_len = _RLWE_DESCRIPTOR_LEN + m * n_ringelt_bytes; 
-  
+  buf_len = RLWE_PUB_encode(pub, NULL, 0);
   if (out == NULL || buf_len == 0)
     /* out == NULL => just return the length of the octet string */
     return buf_len;
@@ -603,22 +989,9 @@ size_t i2o_RLWE_PUB(RLWE_PUB *pub, unsigned char **out) {
     }
     new_buffer = 1;
   }
-  unsigned char *ptr = *out;
-  /* Copy 32-byte descriptor */
-  memcpy (ptr, pub->descriptor, _RLWE_DESCRIPTOR_LEN);
-  ptr += _RLWE_DESCRIPTOR_LEN;
-
-  /* Copy public key data */
-  for (i = 0; i < m; i++) {
-    if (n_ringelt_bytes == 4) {
-      *ptr++ = (unsigned char) ((pub->b[i] >> 24) & 0xff);
-      *ptr++ = (unsigned char) ((pub->b[i] >> 16) & 0xff);
-    }
-    *ptr++ = (unsigned char) ((pub->b[i] >> 8) & 0xff);
-    *ptr++ = (unsigned char) ((pub->b[i]) & 0xff);
-  }
+  RLWE_PUB_encode(pub, *out, buf_len);
   if (!new_buffer)
-    *out = ptr;
+    *out += buf_len;
   return buf_len;
 }
 
@@ -638,7 +1011,7 @@ size_t i2o_RLWE_SEC(RLWE_PAIR *pair, unsigned char **out) {
   }
     
   uint32_t m = pair->param_data->m;
-  RINGELT  q = pair->param_data->q;
+  uint32_t q = pair->param_data->q;
   uint32_t n_ringelt_bytes = 2;
   if (q >= 0x00010000)
     n_ringelt_bytes = 4;
@@ -679,19 +1052,16 @@ size_t i2o_RLWE_SEC(RLWE_PAIR *pair, unsigned char **out) {
 /* Convert reconciliation data structure from binary */
 
 RLWE_REC *o2i_RLWE_REC(RLWE_REC **rec, const unsigned char *in, size_t len) {
-  size_t buf_len;
-  size_t i;
-  
   if (len < 4) {
     RINGLWEerr(RINGLWE_F_O2I_RLWE_REC, RINGLWE_R_INVALID_FORMAT);
     return 0;
   }
   uint32_t muwords;
   muwords = (in[0]<<24) | (in[1]<<16) | (in[2]<<8) | (in[3]);
-  buf_len = 4 + muwords * 8;
   
-  if (buf_len != len) {
-    RINGLWEerr(RINGLWE_F_I2O_RLWE_REC, RINGLWE_R_INVALID_FORMAT);
+  if ((muwords == 0) || ((len - 4) % 8 != 0) || ((len - 4) / 8 != muwords)) {
+    RINGLWEerr(RINGLWE_F_O2I_RLWE_REC, RINGLWE_R_INVALID_FORMAT);
+    return 0;
   }
   
   if (*rec == NULL) {
@@ -699,34 +1069,56 @@ RLWE_REC *o2i_RLWE_REC(RLWE_REC **rec, const unsigned char *in, size_t len) {
       RINGLWEerr(RINGLWE_F_O2I_RLWE_REC, ERR_R_MALLOC_FAILURE);
       return 0;
     }
+  } else if ((*rec)->muwords != muwords) {
+    RINGLWEerr(RINGLWE_F_O2I_RLWE_REC, RINGLWE_R_PARAM_INVALID);
+    return 0;
   }
   
-  for (i = 0; i < muwords; i++) {
-    int k = 0;
-    (*rec)->c[i] = 0;
-    for (k = 0; k < 8; k++) {
-      (*rec)->c[i] |= ((uint64_t)in[4 + 8*i +k]) << (8*k);
-    }
-  }
+  rlwe_decode_words((*rec)->c, in + 4, muwords);
   
   return *rec;
 }
 
-/* Convert reconciliation data structure into binary */
+/* Write the encoding of rec to out, which has room for outlen bytes.
+   With out NULL, just return the length of the encoding. */
+
+size_t RLWE_REC_encode(const RLWE_REC *rec, unsigned char *out, size_t outlen) {
+  size_t buf_len;
+  uint32_t i;
+  int k;
 
-size_t i2o_RLWE_REC(RLWE_REC *rec, unsigned char **out) {
-  size_t buf_len = 0;
-  int new_buffer = 0, i;
-  
   if (rec == NULL) {
-    RINGLWEerr(RINGLWE_F_I2O_RLWE_REC, ERR_R_PASSED_NULL_PARAMETER);
+    RINGLWEerr(RINGLWE_F_RLWE_REC_ENCODE, ERR_R_PASSED_NULL_PARAMETER);
     return 0;
   }
+
+  buf_len = 4 + (size_t)rec->muwords * 8;
+  if (out == NULL)
+    return buf_len;
+  if (outlen < buf_len) {
+    RINGLWEerr(RINGLWE_F_RLWE_REC_ENCODE, RINGLWE_R_BUFFER_TOO_SMALL);
+    return 0;
+  }
+
+  out[0] = (rec->muwords >> 24) & 0xff;
+  out[1] = (rec->muwords >> 16) & 0xff;
+  out[2] = (rec->muwords >> 8) & 0xff;
+  out[3] = (rec->muwords) & 0xff;
+  for (i = 0; i < rec->muwords; i++) {
+    for (k = 0; k < 8; k++) {
+      out[4 + 8*i + k] = (rec->c[i] >> (8*k)) & 0xff;
+    }
+  }
+  return buf_len;
+}
+
+/* Convert reconciliation data structure into binary */
+
+size_t i2o_RLWE_REC(RLWE_REC *rec, unsigned char **out) {
+  size_t buf_len;
+  int new_buffer = 0;
   
-  uint32_t muwords = rec->muwords;
-  
-  buf_len = 4 + muwords * 8;
-  
+  buf_len = RLWE_REC_encode(rec, NULL, 0);
   if (out == NULL || buf_len == 0)
     /* out == NULL => just return the length of the octet string */
     return buf_len;
@@ -738,28 +1130,75 @@ size_t i2o_RLWE_REC(RLWE_REC *rec, unsigned char **out) {
     }
     new_buffer = 1;
   }
-  (*out)[0] = (muwords >> 24) & 0xff;
-  (*out)[1] = (muwords >> 16) & 0xff;
-  (*out)[2] = (muwords >> 8) & 0xff;
-  (*out)[3] = (muwords) & 0xff;
-  
-  for (i = 0; i < muwords; i++) {
-    int k = 0;
-    for (k = 0; k < 8; k++) {
-      (*out)[4 + 8*i + k] = (rec->c[i] >> (8*k)) & 0xff;
-    }
-  }
-  
+  RLWE_REC_encode(rec, *out, buf_len);
   if (!new_buffer)
     *out += buf_len;
   return buf_len;
 }
 
+/* Set up views of an encoded public key or reconciliation data, checking
+   the format but decoding nothing.  The view borrows in. */
+
+static int rlwe_pub_view_init(RLWE_PUB_VIEW *view, const unsigned char *in, size_t len, int compressed) {
+  const RLWE_CTX *ctx;
+
+  if ((view == NULL) || (in == NULL)) {
+    RINGLWEerr(RINGLWE_F_RLWE_PUB_VIEW_INIT, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+  if (len < _RLWE_DESCRIPTOR_LEN) {
+    RINGLWEerr(RINGLWE_F_RLWE_PUB_VIEW_INIT, RINGLWE_R_INVALID_FORMAT);
+    return 0;
+  }
+  ctx = rlwe_ctx_from_descriptor(in);
+  if (ctx == NULL) {
+    RINGLWEerr(RINGLWE_F_RLWE_PUB_VIEW_INIT, RINGLWE_R_PARAM_UNKNOWN);
+    return 0;
+  }
+  if (rlwe_pub_format(ctx, in, len, compressed) < 0) {
+    RINGLWEerr(RINGLWE_F_RLWE_PUB_VIEW_INIT, RINGLWE_R_INVALID_FORMAT);
+    return 0;
+  }
+  view->data = in;
+  view->len = len;
+  view->ctx = ctx;
+  return 1;
+}
+
+int RLWE_PUB_VIEW_init(RLWE_PUB_VIEW *view, const unsigned char *in, size_t len) {
+  return rlwe_pub_view_init(view, in, len, 0);
+}
+
+int RLWE_PUB_VIEW_init_compressed(RLWE_PUB_VIEW *view, const unsigned char *in, size_t len) {
+  return rlwe_pub_view_init(view, in, len, 1);
+}
+
+int RLWE_REC_VIEW_init(RLWE_REC_VIEW *view, const unsigned char *in, size_t len) {
+  uint32_t muwords;
+
+  if ((view == NULL) || (in == NULL)) {
+    RINGLWEerr(RINGLWE_F_RLWE_REC_VIEW_INIT, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+  if (len < 4) {
+    RINGLWEerr(RINGLWE_F_RLWE_REC_VIEW_INIT, RINGLWE_R_INVALID_FORMAT);
+    return 0;
+  }
+  muwords = (in[0]<<24) | (in[1]<<16) | (in[2]<<8) | (in[3]);
+  if ((muwords == 0) || ((len - 4) % 8 != 0) || ((len - 4) / 8 != muwords)) {
+    RINGLWEerr(RINGLWE_F_RLWE_REC_VIEW_INIT, RINGLWE_R_INVALID_FORMAT);
+    return 0;
+  }
+  view->data = in + 4;
+  view->muwords = muwords;
+  return 1;
+}
+
 /* Get public key from a key pair */
 RLWE_PUB *RLWE_PAIR_get_publickey(RLWE_PAIR *pair) {
   if (pair == NULL)
     return NULL;
-  if (pair->keys_set == 0)
+  if (pair->pub_set == 0)
     return NULL;
   return pair->pub;
 }
@@ -769,74 +1208,145 @@ int RLWE_PAIR_has_privatekey(RLWE_PAIR *pair) {
   return pair->keys_set;
 }
 
+/* Get public key from a ticket */
+RLWE_PUB *RLWE_TICKET_get_publickey(RLWE_TICKET *ticket) {
+  if (ticket == NULL)
+    return NULL;
+  if (ticket->pub_set == 0)
+    return NULL;
+  return ticket->pub;
+}
+
+size_t RLWE_TICKET_get_encoded_publickey(RLWE_TICKET *ticket, const unsigned char **out) {
+  if ((ticket == NULL) || (ticket->pub_set == 0))
+    return 0;
+  if (out != NULL)
+    *out = ticket->pub_enc;
+  return ticket->pub_enc_len;
+}
+
+int RLWE_TICKET_get_nid(const RLWE_TICKET *ticket) {
+  if (ticket == NULL)
+    return NID_undef;
+  return RLWE_get_nid_from_descriptor(ticket->descriptor);
+}
+
+int RLWE_PUB_get_nid(const RLWE_PUB *pub) {
+  if (pub == NULL)
+    return NID_undef;
+  return RLWE_get_nid_from_descriptor(pub->descriptor);
+}
+
+int RLWE_PAIR_get_nid(const RLWE_PAIR *pair) {
+  if (pair == NULL)
+    return NID_undef;
+  return RLWE_get_nid_from_descriptor(pair->descriptor);
+}
+
 /* Return value of m from context */
-uint32_t RLWE_CTX_get_m(RLWE_CTX *ctx) {
+uint32_t RLWE_CTX_get_m(const RLWE_CTX *ctx) {
   if (ctx == NULL) return 0;
   if (ctx->param_data == NULL) return 0;
   return ctx->param_data->m;
 }
 
 /* Return value of q from context */
-RINGELT RLWE_CTX_get_q(RLWE_CTX *ctx) {
+RINGELT RLWE_CTX_get_q(const RLWE_CTX *ctx) {
   if (ctx == NULL) return 0;
   if (ctx->param_data == NULL) return 0;
   return ctx->param_data->q;
 }
 
+/* Return the number of 64-bit words in a shared secret or reconciliation
+   vector */
+uint32_t RLWE_CTX_get_muwords(const RLWE_CTX *ctx) {
+  if (ctx == NULL) return 0;
+  if (ctx->param_data == NULL) return 0;
+  return ctx->param_data->muwords;
+}
+
+int RLWE_CTX_get_nid(const RLWE_CTX *ctx) {
+  if (ctx == NULL) return NID_undef;
+  return ctx->nid;
+}
 
-/* Compute shared secret values */
-size_t RINGLWE_compute_key_alice(void *out,
-			      size_t outlen,
-			      const RLWE_PUB *bob_pub,
-			      const RLWE_REC *reconciliation,
-			      const RLWE_PAIR *alice_keypair,
-			      void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen)) {
 
-  size_t ret = 0;
-  
-  if ((bob_pub == NULL) || (alice_keypair == NULL) || (reconciliation==NULL)) {
-    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, ERR_R_PASSED_NULL_PARAMETER);
-    return 0;
+/* Allocate and deallocate workspace for the compute_key functions */
+
+RLWE_WORKSPACE *RLWE_WORKSPACE_new(const RLWE_CTX *ctx) {
+  RLWE_WORKSPACE *ws;
+  RINGLWE_PARAM_DATA *p;
+
+  if ((ctx == NULL) || (ctx->param_data == NULL)) {
+    RINGLWEerr(RINGLWE_F_RLWE_WORKSPACE_NEW, ERR_R_PASSED_NULL_PARAMETER);
+    return (NULL);
   }
-  
-  /* Check sender and recipient are using same parameters */
-  if (bob_pub->param_data != alice_keypair->param_data) {
-    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, RINGLWE_R_PARAM_INVALID);
-    return 0;
+  p = ctx->param_data;
+
+  /* One block: the structure, then the shared secret and reconciliation
+     words, the scratch ring elements and the shared secret bytes */
+  ws = (RLWE_WORKSPACE *)OPENSSL_malloc(sizeof(RLWE_WORKSPACE)
+					+ 2 * p->muwords * sizeof(uint64_t)
+					+ 3 * p->m * sizeof(RINGELT)
+					+ (p->m + 7) / 8);
+  if (ws == NULL) {
+    RINGLWEerr(RINGLWE_F_RLWE_WORKSPACE_NEW, ERR_R_MALLOC_FAILURE);
+    return (NULL);
   }
-  
-  RINGLWE_PARAM_DATA *p = alice_keypair->param_data;
-  uint64_t *ka = (uint64_t *)OPENSSL_malloc(p->muwords * sizeof(uint64_t));
-  if (ka == NULL) {
-      RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, ERR_R_MALLOC_FAILURE);
-      return 0;
-    }
-  
-  memset(ka, 0, p->muwords * sizeof(uint64_t));
-  RINGELT *alice_s1 = &(alice_keypair->s[p->m]);
-  
-  /* Compute shared key from Bob's public key, Alice's private key and
-     reconciliation data */
-  KEM1_Decapsulate(ka, bob_pub->b, alice_s1, reconciliation->c, p);
+  ws->param_data = p;
+  ws->k = (uint64_t *)(ws + 1);
+  ws->c = ws->k + p->muwords;
+  ws->tmp = (RINGELT *)(ws->c + p->muwords);
+  ws->k_buf = (unsigned char *)(ws->tmp + 3 * p->m);
 
+  return (ws);
+}
+
+void RLWE_WORKSPACE_free(RLWE_WORKSPACE *r) {
+  if (r == NULL) return;
+
+  OPENSSL_cleanse((void *)r, sizeof(RLWE_WORKSPACE)
+		  + 2 * r->param_data->muwords * sizeof(uint64_t)
+		  + 3 * r->param_data->m * sizeof(RINGELT)
+		  + (r->param_data->m + 7) / 8);
+  OPENSSL_free(r);
+}
+
+/* Declare a workspace for p in automatic storage, for the compute_key
+   functions that are not given one */
+#define RLWE_WORKSPACE_AUTO(ws, p)				\
+  RINGELT ws##_tmp[3 * (p)->m];					\
+  uint64_t ws##_k[(p)->muwords];				\
+  uint64_t ws##_c[(p)->muwords];				\
+  unsigned char ws##_k_buf[((p)->m + 7) / 8];			\
+  RLWE_WORKSPACE ws = { (p), ws##_tmp, ws##_k, ws##_c, ws##_k_buf }
+
+/* Serialise the shared secret in ws->k little-endian, one bit per
+   coefficient, and pass it through KDF into out (or copy it if KDF is
+   NULL).  Both copies of the secret are wiped.  Returns the number of
+   bytes written to out, 0 on error. */
+static size_t ringlwe_output_key(void *out,
+				 size_t outlen,
+				 RLWE_WORKSPACE *ws,
+				 void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen),
+				 int func) {
+  const RINGLWE_PARAM_DATA *p = ws->param_data;
+  size_t ret = 0;
   size_t nchars = (p->m + 7) / 8;
-  unsigned char *ka_buf = (unsigned char *)OPENSSL_malloc(nchars * sizeof(unsigned char));
-  if (ka_buf == NULL) {
-    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, ERR_R_MALLOC_FAILURE);
-    return 0;
-    }
   size_t i;
+
   for (i = 0; i < p->muwords * sizeof(uint64_t); i+= sizeof(uint64_t)) {
-    size_t k;
-    for (k = i; (k < i + sizeof(uint64_t)) && (k < nchars); k++) {
-      ka_buf[k] = (unsigned char)(ka[i/sizeof(uint64_t)] >> (8*(k&7)));
+    size_t j;
+    for (j = i; (j < i + sizeof(uint64_t)) && (j < nchars); j++) {
+      ws->k_buf[j] = (unsigned char)(ws->k[i/sizeof(uint64_t)] >> (8*(j&7)));
     }
   }
+  OPENSSL_cleanse(ws->k, p->muwords * sizeof(uint64_t));
 
   /* Apply KDF if specified */
   if (KDF != NULL) {
-    if (KDF(ka_buf, nchars * sizeof(unsigned char), out, &outlen) == NULL) {
-      RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, RINGLWE_R_KDF_FAILED);
+    if (KDF(ws->k_buf, nchars * sizeof(unsigned char), out, &outlen) == NULL) {
+      RINGLWEerr(func, RINGLWE_R_KDF_FAILED);
     }
     else {
       ret = outlen;
@@ -845,109 +1355,268 @@ size_t RINGLWE_compute_key_alice(void *out,
     /* no KDF, just copy as much as we can */
     if (outlen > nchars * sizeof(unsigned char))
       outlen = nchars * sizeof(unsigned char);
-    memcpy(out, ka_buf, outlen);
+    memcpy(out, ws->k_buf, outlen);
     ret = outlen;
   }
-  
-  /* Cleanse memory */
-  if (ka) {
-      OPENSSL_cleanse(ka, p->muwords * sizeof(uint64_t));
-      OPENSSL_free(ka);
-    }
-  if (ka_buf) {
-    OPENSSL_cleanse(ka_buf, nchars);
-    OPENSSL_free(ka_buf);
-  }
-  
+
+  OPENSSL_cleanse(ws->k_buf, nchars * sizeof(unsigned char));
   return (ret);
+}
 
+/* Check that a workspace and reconciliation structure suit parameters p.
+   The reconciliation structure may be longer than p needs, but not
+   shorter. */
+static int ringlwe_check_ex(const RINGLWE_PARAM_DATA *p,
+			    const RLWE_REC *reconciliation,
+			    const RLWE_WORKSPACE *ws,
+			    int func) {
+  if ((reconciliation == NULL) || (ws == NULL)) {
+    RINGLWEerr(func, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+  if ((ws->param_data != p) || (reconciliation->muwords < p->muwords)) {
+    RINGLWEerr(func, RINGLWE_R_PARAM_INVALID);
+    return 0;
+  }
+  return 1;
 }
 
-/* Compute shared secret values */
-size_t RINGLWE_compute_key_bob(void *out,
-			    size_t outlen,
-			    RLWE_REC **reconciliation,
-			    const RLWE_PUB *alice_pub,
-			    const RLWE_PUB *bob_pub,
-                            void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen)) {
-  
-  size_t ret = 0;
-  
+/* Compute shared secret values, using ws for all intermediate values */
+size_t RINGLWE_compute_key_alice_ex(void *out,
+				 size_t outlen,
+				 const RLWE_PUB *bob_pub,
+				 const RLWE_REC *reconciliation,
+				 const RLWE_PAIR *alice_keypair,
+				 RLWE_WORKSPACE *ws,
+				 void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen)) {
+  RINGLWE_PARAM_DATA *p;
+
+  if ((bob_pub == NULL) || (alice_keypair == NULL)) {
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+
+  /* Check sender and recipient are using same parameters */
+  if (bob_pub->param_data != alice_keypair->param_data) {
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, RINGLWE_R_PARAM_INVALID);
+    return 0;
+  }
+  p = alice_keypair->param_data;
+  if (!ringlwe_check_ex(p, reconciliation, ws, RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE))
+    return 0;
+
+  /* Compute shared key from Bob's public key, Alice's private key and
+     reconciliation data */
+  if (!RLWE_get_default_method()->decapsulate(ws->k, bob_pub->b, &(alice_keypair->s[p->m]),
+					      reconciliation->c, ws->tmp,
+					      rlwe_ctx_from_param_data(p))) {
+    OPENSSL_cleanse(ws->k, p->muwords * sizeof(uint64_t));
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, RINGLWE_R_METHOD_FAILED);
+    return 0;
+  }
+
+  return ringlwe_output_key(out, outlen, ws, KDF, RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE);
+}
+
+size_t RINGLWE_compute_key_alice(void *out,
+			      size_t outlen,
+			      const RLWE_PUB *bob_pub,
+			      const RLWE_REC *reconciliation,
+			      const RLWE_PAIR *alice_keypair,
+			      void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen)) {
+
+  if ((alice_keypair == NULL) || (alice_keypair->param_data == NULL)) {
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+  RLWE_WORKSPACE_AUTO(ws, alice_keypair->param_data);
+
+  return RINGLWE_compute_key_alice_ex(out, outlen, bob_pub, reconciliation, alice_keypair,
+				      &ws, KDF);
+}
+
+/* As RINGLWE_compute_key_alice_ex, but reading Bob's public key and the
+   reconciliation data straight from their encodings.  Both are decoded
+   into ws before anything is written to out, so out may overlap them.
+   With ws NULL a workspace in automatic storage is used. */
+size_t RINGLWE_compute_key_alice_view(void *out,
+				   size_t outlen,
+				   const RLWE_PUB_VIEW *bob_pub,
+				   const RLWE_REC_VIEW *reconciliation,
+				   const RLWE_PAIR *alice_keypair,
+				   RLWE_WORKSPACE *ws,
+				   void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen)) {
+  RINGLWE_PARAM_DATA *p;
+  RINGELT *b;
+
+  if ((bob_pub == NULL) || (reconciliation == NULL) || (alice_keypair == NULL)
+      || (alice_keypair->param_data == NULL)) {
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+  p = alice_keypair->param_data;
+  if (ws == NULL) {
+    RLWE_WORKSPACE_AUTO(auto_ws, p);
+    return RINGLWE_compute_key_alice_view(out, outlen, bob_pub, reconciliation,
+					  alice_keypair, &auto_ws, KDF);
+  }
+
+  if ((bob_pub->ctx == NULL) || (bob_pub->ctx->param_data != p)
+      || (ws->param_data != p) || (reconciliation->muwords < p->muwords)) {
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, RINGLWE_R_PARAM_INVALID);
+    return 0;
+  }
+
+  /* Decapsulate only needs the first m scratch elements */
+  b = ws->tmp + p->m;
+  rlwe_decode_pub(b, bob_pub->data, rlwe_pub_format(bob_pub->ctx, bob_pub->data, bob_pub->len, 1), p);
+  rlwe_decode_words(ws->c, reconciliation->data, p->muwords);
+
+  if (!RLWE_get_default_method()->decapsulate(ws->k, b, &(alice_keypair->s[p->m]), ws->c,
+					      ws->tmp, rlwe_ctx_from_param_data(p))) {
+    OPENSSL_cleanse(ws->c, p->muwords * sizeof(uint64_t));
+    OPENSSL_cleanse(ws->k, p->muwords * sizeof(uint64_t));
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, RINGLWE_R_METHOD_FAILED);
+    return 0;
+  }
+  OPENSSL_cleanse(ws->c, p->muwords * sizeof(uint64_t));
+
+  return ringlwe_output_key(out, outlen, ws, KDF, RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE);
+}
+
+/* Bob's side of the exchange.  Bob's public key is written to bob_pub and
+   the reconciliation data to reconciliation; ws holds everything else. */
+size_t RINGLWE_compute_key_bob_ex(void *out,
+			       size_t outlen,
+			       RLWE_REC *reconciliation,
+			       const RLWE_PUB *alice_pub,
+			       const RLWE_PUB *bob_pub,
+			       RLWE_WORKSPACE *ws,
+			       void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen)) {
+  RINGLWE_PARAM_DATA *p;
+
   if ((alice_pub == NULL) || (bob_pub == NULL)) {
     RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB, ERR_R_PASSED_NULL_PARAMETER);
     return 0;
   }
-  
+
   /* Check sender and recipient are using same parameters */
   if (alice_pub->param_data != bob_pub->param_data) {
     RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB, RINGLWE_R_PARAM_INVALID);
     return 0;
   }
+  p = bob_pub->param_data;
+  if (!ringlwe_check_ex(p, reconciliation, ws, RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB))
+    return 0;
+
+  /* Bob generates shared key, public key and reconciliation data */
+  if (!RLWE_get_default_method()->encapsulate(bob_pub->b, reconciliation->c, ws->k,
+					      alice_pub->b, ws->tmp,
+					      rlwe_ctx_from_param_data(p))) {
+    OPENSSL_cleanse(ws->k, p->muwords * sizeof(uint64_t));
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB, RINGLWE_R_METHOD_FAILED);
+    return 0;
+  }
 
-  RINGLWE_PARAM_DATA *p = bob_pub->param_data;
+  return ringlwe_output_key(out, outlen, ws, KDF, RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB);
+}
 
+/* Allocate *reconciliation for p if the caller has not */
+static int ringlwe_rec_alloc(RLWE_REC **reconciliation,
+			     const RINGLWE_PARAM_DATA *p,
+			     int func) {
   if (reconciliation == NULL) {
-    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB, ERR_R_PASSED_NULL_PARAMETER);
+    RINGLWEerr(func, ERR_R_PASSED_NULL_PARAMETER);
     return 0;
   }
   if (*reconciliation == NULL) {
     *reconciliation = RLWE_REC_new(p->muwords);
   }
   if (*reconciliation == NULL) {
-  RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB, ERR_R_PASSED_NULL_PARAMETER);
+    RINGLWEerr(func, ERR_R_MALLOC_FAILURE);
     return 0;
   }
-  
-  uint64_t *kb = (uint64_t *)OPENSSL_malloc(p->muwords * sizeof(uint64_t));
-  if (kb == NULL) {
-      RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB, ERR_R_MALLOC_FAILURE);
-      return 0;
-    }
-  memset(kb, 0, p->muwords * sizeof(uint64_t));
-  
-  /* Bob generates shared key, public key and reconciliation data */
-  KEM1_Encapsulate(bob_pub->b, (*reconciliation)->c, kb, alice_pub->b, p);
+  return 1;
+}
 
-  size_t nchars = (p->m + 7) / 8;
-  unsigned char *kb_buf = (unsigned char *)OPENSSL_malloc(nchars * sizeof(unsigned char));
-  if (kb_buf == NULL) {
-    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_ALICE, ERR_R_MALLOC_FAILURE);
+size_t RINGLWE_compute_key_bob(void *out,
+			    size_t outlen,
+			    RLWE_REC **reconciliation,
+			    const RLWE_PUB *alice_pub,
+			    const RLWE_PUB *bob_pub,
+                            void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen)) {
+
+  if ((bob_pub == NULL) || (bob_pub->param_data == NULL)) {
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+  if (!ringlwe_rec_alloc(reconciliation, bob_pub->param_data, RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB))
+    return 0;
+  RLWE_WORKSPACE_AUTO(ws, bob_pub->param_data);
+
+  return RINGLWE_compute_key_bob_ex(out, outlen, *reconciliation, alice_pub, bob_pub,
+				    &ws, KDF);
+}
+
+/* Compute shared secret values from a ticket made by RLWE_TICKET_generate.
+   The ticket's secrets are erased afterwards; its public key is kept so
+   that it can still be sent. */
+size_t RINGLWE_compute_key_bob_ticket_ex(void *out,
+				      size_t outlen,
+				      RLWE_REC *reconciliation,
+				      const RLWE_PUB *alice_pub,
+				      RLWE_TICKET *ticket,
+				      RLWE_WORKSPACE *ws,
+				      void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen)) {
+  RINGLWE_PARAM_DATA *p;
+  int ok;
+
+  if ((alice_pub == NULL) || (ticket == NULL)) {
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB_TICKET, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
+  }
+  if (!ticket->e_set) {
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB_TICKET, RINGLWE_R_TICKET_NOT_READY);
     return 0;
-    }
-  size_t i;
-  for (i = 0; i < p->muwords * sizeof(uint64_t); i+= sizeof(uint64_t)) {
-    size_t k;
-    for (k = i; (k < i + sizeof(uint64_t)) && (k < nchars); k++) {
-      kb_buf[k] = (unsigned char)(kb[i/sizeof(uint64_t)] >> (8*(k&7)));
-    }
   }
 
-  /* Apply KDF if specified */
-  if (KDF != NULL) {
-    if (KDF(kb_buf, nchars * sizeof(unsigned char), out, &outlen) == NULL) {
-      RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB, RINGLWE_R_KDF_FAILED);
-    }
-    else {
-      ret = outlen;
-    }
-  } else {
-    /* no KDF, just copy as much as we can */
-    if (outlen > nchars * sizeof(unsigned char))
-      outlen = nchars * sizeof(unsigned char);
-    memcpy(out, kb_buf, outlen);
-    ret = outlen;
+  /* Check sender and recipient are using same parameters */
+  if (alice_pub->param_data != ticket->param_data) {
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB_TICKET, RINGLWE_R_PARAM_INVALID);
+    return 0;
   }
+  p = ticket->param_data;
+  if (!ringlwe_check_ex(p, reconciliation, ws, RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB_TICKET))
+    return 0;
 
-   /* Cleanse memory */
-  if (kb) {
-    OPENSSL_cleanse(kb, p->muwords * sizeof(uint64_t));
-    OPENSSL_free(kb);
+  /* Only the part that needs Alice's public key is left to do */
+  ok = KEM1_Encapsulate_online(reconciliation->c, ws->k, ticket->e, alice_pub->b, ws->tmp, p);
+  OPENSSL_cleanse(ticket->e, 2 * p->m * sizeof(RINGELT));
+  ticket->e_set = 0;
+  if (!ok) {
+    OPENSSL_cleanse(ws->k, p->muwords * sizeof(uint64_t));
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB_TICKET, RINGLWE_R_RANDOM_FAILED);
+    return 0;
   }
-  if (kb_buf) {
-    OPENSSL_cleanse(kb_buf, nchars * sizeof(unsigned char));
-    OPENSSL_free(kb_buf);
+
+  return ringlwe_output_key(out, outlen, ws, KDF, RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB_TICKET);
+}
+
+size_t RINGLWE_compute_key_bob_ticket(void *out,
+				   size_t outlen,
+				   RLWE_REC **reconciliation,
+				   const RLWE_PUB *alice_pub,
+				   RLWE_TICKET *ticket,
+				   void *(*KDF)(const void *in, size_t inlen, void *out, size_t *outlen)) {
+
+  if ((ticket == NULL) || (ticket->param_data == NULL)) {
+    RINGLWEerr(RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB_TICKET, ERR_R_PASSED_NULL_PARAMETER);
+    return 0;
   }
+  if (!ringlwe_rec_alloc(reconciliation, ticket->param_data, RINGLWE_F_RINGLWE_COMPUTE_KEY_BOB_TICKET))
+    return 0;
+  RLWE_WORKSPACE_AUTO(ws, ticket->param_data);
 
-  return (ret);
-  
+  return RINGLWE_compute_key_bob_ticket_ex(out, outlen, *reconciliation, alice_pub, ticket,
+					   &ws, KDF);
 }
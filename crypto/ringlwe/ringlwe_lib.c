@@ -0,0 +1,117 @@
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/* ringlwe_lib.c
+   Selects the RLWE_METHOD that ringlwe_key.c runs the key exchange with */
+
+#include <openssl/err.h>
+#ifndef OPENSSL_NO_ENGINE
+#include <openssl/engine.h>
+#endif
+#include "ringlwe_locl.h"
+#include "ringlwe_kex.h"
+
+/* The built-in implementation, over the routines in ringlwe_kex.c */
+
+static int rlwe_openssl_generate(RINGELT *s, RINGELT *b, const RLWE_CTX *ctx) {
+  return KEM1_Generate(s, b, ctx->param_data);
+}
+
+static int rlwe_openssl_encapsulate(RINGELT *u, uint64_t *cr_v, uint64_t *mu,
+				    const RINGELT *b, RINGELT *tmp,
+				    const RLWE_CTX *ctx) {
+  return KEM1_Encapsulate(u, cr_v, mu, b, tmp, ctx->param_data);
+}
+
+static int rlwe_openssl_decapsulate(uint64_t *mu, const RINGELT *u,
+				    const RINGELT *s_1, const uint64_t *cr_v,
+				    RINGELT *tmp, const RLWE_CTX *ctx) {
+  KEM1_Decapsulate(mu, u, s_1, cr_v, tmp, ctx->param_data);
+  return 1;
+}
+
+static int rlwe_openssl_generate_batch(RINGELT *const *s, RINGELT *const *b,
+				       size_t n, const RLWE_CTX *ctx) {
+  return KEM1_Generate_batch(s, b, n, ctx->param_data);
+}
+
+static const RLWE_METHOD rlwe_openssl_meth = {
+  "OpenSSL Ring-LWE method",
+  rlwe_openssl_generate,
+  rlwe_openssl_encapsulate,
+  rlwe_openssl_decapsulate,
+  rlwe_openssl_generate_batch,
+  0,
+  NULL
+};
+
+const RLWE_METHOD *RLWE_OpenSSL(void) {
+  return &rlwe_openssl_meth;
+}
+
+static const RLWE_METHOD *default_RLWE_meth = NULL;
+#ifndef OPENSSL_NO_ENGINE
+/* The ENGINE default_RLWE_meth came from, if any; we hold a functional
+   reference to it */
+static ENGINE *funct_ref = NULL;
+#endif
+
+void RLWE_set_default_method(const RLWE_METHOD *meth) {
+#ifndef OPENSSL_NO_ENGINE
+  /* Release any ENGINE that provided the previous method */
+  if (funct_ref) {
+    ENGINE_finish(funct_ref);
+    funct_ref = NULL;
+  }
+#endif
+  default_RLWE_meth = meth;
+}
+
+/* The method in use.  Until one is set, the first call takes it from the
+   default RLWE ENGINE, if there is one, and otherwise uses RLWE_OpenSSL */
+
+const RLWE_METHOD *RLWE_get_default_method(void) {
+  if (!default_RLWE_meth) {
+#ifndef OPENSSL_NO_ENGINE
+    ENGINE *e = ENGINE_get_default_RLWE();
+    if (e) {
+      default_RLWE_meth = ENGINE_get_RLWE(e);
+      if (!default_RLWE_meth) {
+	ENGINE_finish(e);
+	e = NULL;
+      }
+    }
+    if (e)
+      funct_ref = e;
+    else
+#endif
+      default_RLWE_meth = RLWE_OpenSSL();
+  }
+  return default_RLWE_meth;
+}
+
+#ifndef OPENSSL_NO_ENGINE
+int RLWE_set_default_engine(ENGINE *engine) {
+  const RLWE_METHOD *tmp_meth = NULL;
+  if (engine) {
+    if (!ENGINE_init(engine))
+      return 0;
+    tmp_meth = ENGINE_get_RLWE(engine);
+    if (!tmp_meth) {
+      ENGINE_finish(engine);
+      return 0;
+    }
+  }
+  /* This function releases any prior ENGINE so call it first */
+  RLWE_set_default_method(tmp_meth);
+  funct_ref = engine;
+  return 1;
+}
+#endif
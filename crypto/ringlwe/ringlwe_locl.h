@@ -12,7 +12,7 @@
 #define HEADER_RINGLWE_LOCL_H
 
 #include <openssl/ringlwe.h>
-#include "ringlwe_consts.h"
+#include "FFT/FFT_includes.h"
 
 #define CONSTANT_TIME 1
 
@@ -21,11 +21,37 @@ extern "C" {
 #endif
 
 #ifndef RINGELT
-#define RINGELT uint_fast16_t
+#define RINGELT uint16_t
 #endif
 
 #define _RLWE_DESCRIPTOR_LEN 32
 
+typedef struct ringlwe_param_data_st {
+  const uint32_t m, muwords;
+  const RINGELT q, qmod4;
+  const uint32_t B, BB, LOG2B, BMASK;
+  const RINGELT small_coeff_table[11];
+  const RINGELT q_1_4, q_2_4, q_3_4;
+  const RINGELT r0_l, r0_u, r1_l, r1_u;
+  const RINGELT a[1024];
+  /* Applied to sampled secrets, with coefficients in [-B, B], and for the
+     power-of-two sets to decompressed public keys; the prime-m sets use a
+     transform that relies on the former. */
+  void (*fft_forward)(RINGELT *x);
+  void (*fft_backward)(RINGELT *x);
+  /* x = fft_backward(a*b), and for the prime-m sets mapped to the
+     cyclotomic ring as by MAPTOCYCLOTOMIC, in one pass.  x may alias a
+     or b. */
+  void (*fft_backward_mul)(RINGELT *x, const RINGELT *a, const RINGELT *b);
+  /* The root of unity a and the transforms above are defined by: psi, a
+     primitive 2m'th root, for the power-of-two sets and w, a primitive
+     m'th root, for the prime-m sets.  A set may leave the transforms NULL
+     to run on those FFT_PARAM_get computes from (m, q, root). */
+  const RINGELT root;
+  /* Those transforms, once ringlwe_fft_prepare has looked them up */
+  const FFT_PARAM *fft_param;
+} _ringlwe_param_data_st;
+
 
 struct rlwe_pub_st {
   unsigned char descriptor[_RLWE_DESCRIPTOR_LEN];
@@ -38,7 +64,9 @@ struct rlwe_pair_st {
   RINGLWE_PARAM_DATA *param_data;
   RLWE_PUB *pub;  /* public key structure */
   RINGELT *s;  /* ephemeral s_0 followed by secret s_1 */
-  int keys_set;
+  int keys_set;  /* s and pub hold a generated key pair */
+  int pub_set;  /* pub holds a key, with or without s */
+  int references;
 };
 
 struct rlwe_rec_st {
@@ -46,10 +74,30 @@ struct rlwe_rec_st {
   uint64_t *c;  /* reconciliation vector */
 };
 
+struct rlwe_ticket_st {
+  unsigned char descriptor[_RLWE_DESCRIPTOR_LEN];
+  RINGLWE_PARAM_DATA *param_data;
+  RLWE_PUB *pub;  /* Bob's public key u */
+  unsigned char *pub_enc;  /* u as encoded by i2o_RLWE_PUB */
+  size_t pub_enc_len;
+  RINGELT *e;  /* e0 in Fourier domain, e2, then scratch for e1 */
+  int pub_set;  /* u and pub_enc hold a generated key */
+  int e_set;  /* e not yet used by RINGLWE_compute_key_bob_ticket */
+};
+
+struct rlwe_workspace_st {
+  RINGLWE_PARAM_DATA *param_data;
+  RINGELT *tmp;  /* [3*m] scratch ring elements */
+  uint64_t *k;  /* [muwords] shared secret */
+  uint64_t *c;  /* [muwords] decoded reconciliation data */
+  unsigned char *k_buf;  /* [(m+7)/8] shared secret as bytes */
+};
+
 struct rlwe_ctx_st {
   unsigned char descriptor[_RLWE_DESCRIPTOR_LEN];
   int nid;
   RINGLWE_PARAM_DATA *param_data;
+  int compressed_bits;  /* width for compressed public keys, 0 if none */
 };
 
 #ifdef  __cplusplus
@@ -0,0 +1,452 @@
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/* ringlwebench.c
+   Cycle counts for the individual Ring-LWE kernels, one CSV row per kernel
+   and parameter set.  Build with "make bench" in this directory.
+
+   usage: ringlwebench [-n samples] [-w warmup] [-o file] [set ...]
+
+   where set is the m of a parameter set (1024, 821, ..., 256) or "shared"
+   for the cyclic transforms the prime-m sets use for Bluestein's and
+   Rader's methods.  Each sample times a single call, on inputs restored
+   before the call outside the timed region.  The "impl" column says
+   whether the AVX2 kernels were in use; run with OPENSSL_ia32cap=":~0x20"
+   to compare against the portable C. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openssl/crypto.h>
+#include <openssl/bio.h>
+#include <openssl/objects.h>
+#include <openssl/rand.h>
+#include <openssl/err.h>
+#include <openssl/ringlwe.h>
+
+#include "ringlwe_locl.h"
+#include "ringlwe_kex.h"
+
+/* The time stamp counter where libcrypto has one, nanoseconds otherwise */
+#if defined(OPENSSL_CPUID_OBJ) && !defined(OPENSSL_NO_ASM) && \
+    (defined(__i386) || defined(__i386__) || defined(_M_IX86) || \
+     defined(__x86_64) || defined(__x86_64__) || defined(_M_AMD64) || \
+     defined(_M_X64))
+unsigned long OPENSSL_rdtsc(void);
+# define BENCH_UNIT "cycles"
+# define bench_clock() ((uint64_t)OPENSSL_rdtsc())
+#else
+# include <time.h>
+# define BENCH_UNIT "ns"
+static uint64_t bench_clock(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#endif
+
+/* Cyclic transforms and Montgomery point-wise products are at most this
+   long */
+#define BENCH_MAX_N 2048
+
+typedef struct {
+  const RINGLWE_PARAM_DATA *p;
+  int nid;
+  RINGELT in[2 * RINGLWE_MAX_M];  /* random input, restored before each sample */
+  RINGELT x[3 * RINGLWE_MAX_M];
+  RINGELT s[2 * RINGLWE_MAX_M];
+  RINGELT b[RINGLWE_MAX_M];
+  RINGELT u[RINGLWE_MAX_M];
+  RINGELT tmp[3 * RINGLWE_MAX_M];
+  uint64_t mu[RINGLWE_MAX_M / 64], cr_v[RINGLWE_MAX_M / 64], r[RINGLWE_MAX_M / 64];
+  FFTSHORT w_in[BENCH_MAX_N], w[BENCH_MAX_N], filter[BENCH_MAX_N];
+  RLWE_PUB *pub;
+  RLWE_REC *rec;
+  unsigned char enc[_RLWE_DESCRIPTOR_LEN + 2 * RINGLWE_MAX_M];
+  size_t enc_len;
+  int compressed_bits;
+} BENCH_STATE;
+
+typedef struct {
+  const char *name;
+  /* Set up the inputs of one sample; not timed */
+  void (*prep)(BENCH_STATE *st);
+  void (*run)(BENCH_STATE *st);
+} BENCH_KERNEL;
+
+/* Inputs */
+
+static void random_ringelts(RINGELT *x, size_t n, RINGELT q) {
+  size_t i;
+  uint32_t r;
+  for (i = 0; i < n; ++i) {
+    RAND_bytes((unsigned char *)&r, sizeof(r));
+    x[i] = (RINGELT)(r % q);
+  }
+}
+
+static void random_fftshorts(FFTSHORT *x, size_t n, FFTSHORT q) {
+  size_t i;
+  uint32_t r;
+  for (i = 0; i < n; ++i) {
+    RAND_bytes((unsigned char *)&r, sizeof(r));
+    x[i] = r % q;
+  }
+}
+
+static void prep_none(BENCH_STATE *st) {
+}
+
+static void prep_x(BENCH_STATE *st) {
+  memcpy(st->x, st->in, st->p->m * sizeof(RINGELT));
+}
+
+static void prep_w(BENCH_STATE *st) {
+  memcpy(st->w, st->w_in, sizeof(st->w));
+}
+
+/* Per parameter set kernels */
+
+static void run_fft_forward(BENCH_STATE *st) {
+  st->p->fft_forward(st->x);
+}
+
+static void run_fft_backward(BENCH_STATE *st) {
+  st->p->fft_backward(st->x);
+}
+
+static void run_fft_backward_mul(BENCH_STATE *st) {
+  st->p->fft_backward_mul(st->x, st->b, st->s);
+}
+
+static void run_sample_secret(BENCH_STATE *st) {
+  sample_secret(st->x, st->p);
+}
+
+static void run_pointwise_mul(BENCH_STATE *st) {
+  POINTWISE_MUL(st->x, st->b, st->s, st->p->m, st->p->q);
+}
+
+static void run_pointwise_mul_add(BENCH_STATE *st) {
+  POINTWISE_MUL_ADD(st->x, st->b, st->s, st->u, st->p->m, st->p->q);
+}
+
+static void run_maptocyclotomic(BENCH_STATE *st) {
+  MAPTOCYCLOTOMIC(st->x, st->p->m, st->p->q);
+}
+
+static void run_round(BENCH_STATE *st) {
+  round_and_cross_round(st->mu, st->cr_v, st->x, st->p);
+}
+
+static void run_rec(BENCH_STATE *st) {
+  ringlwe_rec(st->mu, st->x, st->cr_v, st->p);
+}
+
+static void run_generate(BENCH_STATE *st) {
+  KEM1_Generate(st->s, st->b, st->p);
+}
+
+static void run_encapsulate(BENCH_STATE *st) {
+  KEM1_Encapsulate(st->u, st->cr_v, st->mu, st->b, st->tmp, st->p);
+}
+
+static void run_decapsulate(BENCH_STATE *st) {
+  KEM1_Decapsulate(st->r, st->u, st->s + st->p->m, st->cr_v, st->tmp, st->p);
+}
+
+static void run_pub_encode(BENCH_STATE *st) {
+  st->enc_len = RLWE_PUB_encode(st->pub, st->enc, sizeof(st->enc));
+}
+
+static void run_pub_encode_compressed(BENCH_STATE *st) {
+  st->enc_len = RLWE_PUB_encode_compressed(st->pub, st->compressed_bits,
+					   st->enc, sizeof(st->enc));
+}
+
+static void prep_pub_decode(BENCH_STATE *st) {
+  st->enc_len = RLWE_PUB_encode(st->pub, st->enc, sizeof(st->enc));
+}
+
+static void prep_pub_decode_compressed(BENCH_STATE *st) {
+  st->enc_len = RLWE_PUB_encode_compressed(st->pub, st->compressed_bits,
+					   st->enc, sizeof(st->enc));
+}
+
+static void run_pub_decode(BENCH_STATE *st) {
+  o2i_RLWE_PUB(&st->pub, st->enc, st->enc_len);
+}
+
+static void run_rec_encode(BENCH_STATE *st) {
+  st->enc_len = RLWE_REC_encode(st->rec, st->enc, sizeof(st->enc));
+}
+
+static void prep_rec_decode(BENCH_STATE *st) {
+  st->enc_len = RLWE_REC_encode(st->rec, st->enc, sizeof(st->enc));
+}
+
+static void run_rec_decode(BENCH_STATE *st) {
+  o2i_RLWE_REC(&st->rec, st->enc, st->enc_len);
+}
+
+static const BENCH_KERNEL set_kernels[] = {
+  { "fft_forward", prep_x, run_fft_forward },
+  { "fft_backward", prep_x, run_fft_backward },
+  { "fft_backward_mul", prep_none, run_fft_backward_mul },
+  { "sample_secret", prep_none, run_sample_secret },
+  { "pointwise_mul", prep_none, run_pointwise_mul },
+  { "pointwise_mul_add", prep_none, run_pointwise_mul_add },
+  { "maptocyclotomic", prep_x, run_maptocyclotomic },
+  { "round_and_cross_round", prep_x, run_round },
+  { "rec", prep_x, run_rec },
+  { "kem_generate", prep_none, run_generate },
+  { "kem_encapsulate", prep_none, run_encapsulate },
+  { "kem_decapsulate", prep_none, run_decapsulate },
+  { "pub_encode", prep_none, run_pub_encode },
+  { "pub_decode", prep_pub_decode, run_pub_decode },
+  { "pub_encode_compressed", prep_none, run_pub_encode_compressed },
+  { "pub_decode_compressed", prep_pub_decode_compressed, run_pub_decode },
+  { "rec_encode", prep_none, run_rec_encode },
+  { "rec_decode", prep_rec_decode, run_rec_decode },
+};
+
+/* Kernels shared by the prime-m sets: the cyclic transforms that carry
+   Bluestein's method (mod 8816641 and 17633281) and Rader's (mod
+   536856577), and the Montgomery point-wise product with their filters */
+
+#define SHARED_KERNEL(n, q) \
+static void run_cyclic_forward_##n##_##q(BENCH_STATE *st) { \
+  FFT_forward_##n##_##q(st->w); \
+} \
+static void run_cyclic_backward_##n##_##q(BENCH_STATE *st) { \
+  FFT_backward_##n##_##q(st->w); \
+}
+
+SHARED_KERNEL(2048, 8816641)
+SHARED_KERNEL(2048, 17633281)
+SHARED_KERNEL(2048, 536856577)
+SHARED_KERNEL(1024, 8816641)
+SHARED_KERNEL(1024, 17633281)
+SHARED_KERNEL(1024, 536856577)
+
+static void run_pointwise_mul_mont_2048(BENCH_STATE *st) {
+  POINTWISE_MUL_MONT(st->w, st->filter, 2048, 8816641, 1481017343U);
+}
+
+static void run_pointwise_mul_mont_1024(BENCH_STATE *st) {
+  POINTWISE_MUL_MONT(st->w, st->filter, 1024, 8816641, 1481017343U);
+}
+
+#define SHARED_ENTRY(n, q) \
+  { "cyclic_forward_" #n "_" #q, prep_w, run_cyclic_forward_##n##_##q }, \
+  { "cyclic_backward_" #n "_" #q, prep_w, run_cyclic_backward_##n##_##q }
+
+static const BENCH_KERNEL shared_kernels[] = {
+  SHARED_ENTRY(2048, 8816641),
+  SHARED_ENTRY(2048, 17633281),
+  SHARED_ENTRY(2048, 536856577),
+  SHARED_ENTRY(1024, 8816641),
+  SHARED_ENTRY(1024, 17633281),
+  SHARED_ENTRY(1024, 536856577),
+  { "pointwise_mul_mont_2048", prep_w, run_pointwise_mul_mont_2048 },
+  { "pointwise_mul_mont_1024", prep_w, run_pointwise_mul_mont_1024 },
+};
+
+static const int bench_nids[] = {
+  NID_ringLearningWithErrors_1024_40961,
+  NID_ringLearningWithErrors_821_49261,
+  NID_ringLearningWithErrors_739_47297,
+  NID_ringLearningWithErrors_631_44171,
+  NID_ringLearningWithErrors_541_41117,
+  NID_ringLearningWithErrors_512_25601,
+  NID_ringLearningWithErrors_433_35507,
+  NID_ringLearningWithErrors_337_32353,
+  NID_ringLearningWithErrors_256_15361,
+};
+
+#define NUM_SETS (sizeof(bench_nids) / sizeof(bench_nids[0]))
+#define NUM_SET_KERNELS (sizeof(set_kernels) / sizeof(set_kernels[0]))
+#define NUM_SHARED_KERNELS (sizeof(shared_kernels) / sizeof(shared_kernels[0]))
+
+static int cmp_uint64(const void *a, const void *b) {
+  uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+/* Time samples calls of k after warmup untimed ones and write a CSV row */
+
+static void bench_kernel(FILE *out, const BENCH_KERNEL *k, BENCH_STATE *st,
+			 const char *set, uint64_t *t, int samples,
+			 int warmup) {
+  uint64_t t0, t1;
+  int i;
+
+  for (i = 0; i < warmup; ++i) {
+    k->prep(st);
+    k->run(st);
+  }
+  for (i = 0; i < samples; ++i) {
+    k->prep(st);
+    t0 = bench_clock();
+    k->run(st);
+    t1 = bench_clock();
+    t[i] = t1 - t0;
+  }
+  qsort(t, samples, sizeof(t[0]), cmp_uint64);
+  fprintf(out, "%s,%s,%s,%d,%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n",
+	  set, k->name,
+#ifdef FFT_AVX2
+	  FFT_AVX2_CAPABLE ? "avx2" : "c",
+#else
+	  "c",
+#endif
+	  samples, t[samples / 2], t[(samples * 99) / 100], t[0]);
+}
+
+/* Set up st for the parameter set nid: random inputs, a key pair, a public
+   key and reconciliation data to serialise */
+
+static int bench_state_init(BENCH_STATE *st, int nid) {
+  RLWE_CTX *ctx = NULL;
+  RLWE_PAIR *pair = NULL;
+  int ok = 0;
+
+  st->nid = nid;
+  st->p = RINGLWE_PARAM_DATA_set(nid);
+  st->compressed_bits = RLWE_get_compressed_bits(nid);
+  if (st->p == NULL)
+    return 0;
+
+  random_ringelts(st->in, sizeof(st->in) / sizeof(st->in[0]), st->p->q);
+  random_ringelts(st->u, st->p->m, st->p->q);
+  KEM1_Generate(st->s, st->b, st->p);
+  KEM1_Encapsulate(st->u, st->cr_v, st->mu, st->b, st->tmp, st->p);
+
+  if ((ctx = RLWE_CTX_new(nid)) == NULL ||
+      (pair = RLWE_PAIR_new(ctx)) == NULL ||
+      !RLWE_PAIR_generate_key(pair) ||
+      (st->pub = RLWE_PUB_dup(RLWE_PAIR_get_publickey(pair))) == NULL ||
+      (st->rec = RLWE_REC_new(st->p->muwords)) == NULL)
+    goto err;
+  memcpy(st->rec->c, st->cr_v, st->p->muwords * sizeof(uint64_t));
+  ok = 1;
+
+ err:
+  RLWE_PAIR_free(pair);
+  RLWE_CTX_free(ctx);
+  return ok;
+}
+
+static void bench_state_cleanup(BENCH_STATE *st) {
+  RLWE_PUB_free(st->pub);
+  RLWE_REC_free(st->rec);
+  st->pub = NULL;
+  st->rec = NULL;
+}
+
+static int set_selected(const char *set, char **sets, int nsets) {
+  int i;
+  if (nsets == 0)
+    return 1;
+  for (i = 0; i < nsets; ++i)
+    if (strcmp(sets[i], set) == 0)
+      return 1;
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  BENCH_STATE *st = NULL;
+  FILE *out = stdout;
+  uint64_t *t = NULL;
+  char set[16];
+  char **sets = NULL;
+  int samples = 10000, warmup = 1000, nsets = 0;
+  size_t i, j;
+  int ret = 1;
+
+  for (argc--, argv++; argc > 0; argc--, argv++) {
+    if (strcmp(*argv, "-n") == 0 && argc > 1) {
+      samples = atoi(*++argv);
+      argc--;
+    } else if (strcmp(*argv, "-w") == 0 && argc > 1) {
+      warmup = atoi(*++argv);
+      argc--;
+    } else if (strcmp(*argv, "-o") == 0 && argc > 1) {
+      if ((out = fopen(*++argv, "w")) == NULL) {
+	perror(*argv);
+	return 1;
+      }
+      argc--;
+    } else if (**argv != '-') {
+      sets = argv;
+      nsets = argc;
+      break;
+    } else {
+      fprintf(stderr,
+	      "usage: ringlwebench [-n samples] [-w warmup] [-o file] [set ...]\n");
+      return 1;
+    }
+  }
+  if (samples < 1 || warmup < 0) {
+    fprintf(stderr, "ringlwebench: bad sample count\n");
+    goto end;
+  }
+
+  st = OPENSSL_malloc(sizeof(*st));
+  t = OPENSSL_malloc(samples * sizeof(*t));
+  if (st == NULL || t == NULL)
+    goto end;
+  memset(st, 0, sizeof(*st));
+
+  fprintf(out, "set,kernel,impl,samples,median_" BENCH_UNIT ",p99_" BENCH_UNIT
+	  ",min_" BENCH_UNIT "\n");
+
+  for (i = 0; i < NUM_SETS; ++i) {
+    const RINGLWE_PARAM_DATA *p = RINGLWE_PARAM_DATA_set(bench_nids[i]);
+    if (p == NULL)
+      goto end;
+    BIO_snprintf(set, sizeof(set), "%u", (unsigned)p->m);
+    if (!set_selected(set, sets, nsets))
+      continue;
+    if (!bench_state_init(st, bench_nids[i])) {
+      fprintf(stderr, "ringlwebench: cannot set up %s\n",
+	      OBJ_nid2sn(bench_nids[i]));
+      bench_state_cleanup(st);
+      goto end;
+    }
+    for (j = 0; j < NUM_SET_KERNELS; ++j) {
+      if (st->compressed_bits == 0 &&
+	  strstr(set_kernels[j].name, "_compressed") != NULL)
+	continue;
+      bench_kernel(out, &set_kernels[j], st, set, t, samples, warmup);
+    }
+    bench_state_cleanup(st);
+  }
+
+  if (set_selected("shared", sets, nsets)) {
+    random_fftshorts(st->w_in, BENCH_MAX_N, 8816641);
+    random_fftshorts(st->filter, BENCH_MAX_N, 8816641);
+    for (j = 0; j < NUM_SHARED_KERNELS; ++j)
+      bench_kernel(out, &shared_kernels[j], st, "shared", t, samples, warmup);
+  }
+  ret = 0;
+
+ end:
+  if (ret)
+    ERR_print_errors_fp(stderr);
+  if (out != stdout)
+    fclose(out);
+  if (t)
+    OPENSSL_free(t);
+  if (st)
+    OPENSSL_free(st);
+  return ret;
+}
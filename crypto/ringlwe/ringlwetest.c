@@ -26,6 +26,11 @@
 #include <openssl/rand.h>
 #include <openssl/sha.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+#ifndef OPENSSL_NO_ENGINE
+#include <openssl/engine.h>
+#endif
 
 #define VERBOSE
 
@@ -36,6 +41,7 @@ int main(int argc, char *argv[]) {
 }
 #else
 #include <openssl/ringlwe.h>
+#include "../crypto/ringlwe/FFT/FFT_includes.h"
 
 #ifdef OPENSSL_SYS_WIN16
 #define MS_CALLBACK	_far _loadds
@@ -281,8 +287,10 @@ static int ringlwe_test_kex(BIO *out, int nid) {
   RINGELT u[p->m]; /* Bob's Ring Element from Encapsulation */
   uint64_t cr_v[p->muwords]; /* Cross Rounding of v */
   
+  RINGELT tmp[3*p->m]; /* scratch */
+
   /* Bob produces a shared key mu and Cross Rounding reconciliation vector */
-  KEM1_Encapsulate(u, cr_v, mu_bob, pub_alice, p);
+  KEM1_Encapsulate(u, cr_v, mu_bob, pub_alice, tmp, p);
 
 #ifdef VERBOSE
   printf("Alice's private key (FFT / CRT basis) s1_alice:\n");
@@ -315,7 +323,7 @@ static int ringlwe_test_kex(BIO *out, int nid) {
   uint64_t mu_alice[p->muwords];
 
   /* Alice uses reconciliation to derive shared key */
-  KEM1_Decapsulate(mu_alice, u, sec_alice+p->m, cr_v, p);
+  KEM1_Decapsulate(mu_alice, u, sec_alice+p->m, cr_v, tmp, p);
 
   /* Check shared key agreement */
   for (i = 0; i < p->muwords; i++)
@@ -485,6 +493,1006 @@ static int test_ringlwe(BIO *out, int nid) {
   return (ret);
 }
 
+/* Generate a batch of key pairs, check the serialised public keys against
+   i2o_RLWE_PUB and run a key exchange with each pair */
+
+#define RLWE_TEST_BATCH 5
+
+static int test_ringlwe_batch(BIO *out, int nid) {
+
+  RLWE_PAIR *pairs[RLWE_TEST_BATCH];
+  RLWE_REC *rec = NULL;
+  RLWE_PUB *bob = NULL;
+  RLWE_CTX *ctx = NULL;
+  
+  unsigned char *pubs = NULL, *pubbuf = NULL;
+  size_t publen;
+  
+  unsigned char assbuf[20], bssbuf[20];
+  size_t asslen, bsslen;
+  
+  int i, ret = 0;
+  
+  ctx = RLWE_CTX_new (nid);
+  if (ctx == NULL) {
+    return ret;
+  }
+  
+  for (i = 0; i < RLWE_TEST_BATCH; i++)
+    pairs[i] = RLWE_PAIR_new(ctx);
+  bob = RLWE_PUB_new(ctx);
+  for (i = 0; i < RLWE_TEST_BATCH; i++)
+    if (pairs[i] == NULL)
+      goto err;
+  if (bob == NULL)
+    goto err;
+  
+  BIO_puts(out, "Testing batch key generation\n");
+  
+  publen = i2o_RLWE_PUB(bob, NULL);
+  pubs = (unsigned char *)OPENSSL_malloc(RLWE_TEST_BATCH * publen);
+  if (pubs == NULL)
+    goto err;
+  
+  if (!RLWE_PAIR_generate_keys_batch(pairs, RLWE_TEST_BATCH, pubs)) {
+    fprintf(stderr,"Error generating RLWE key batch\n");
+    goto err;
+  }
+  
+  for (i = 0; i < RLWE_TEST_BATCH; i++) {
+    if (!RLWE_PAIR_has_privatekey(pairs[i]) ||
+	(i2o_RLWE_PUB(RLWE_PAIR_get_publickey(pairs[i]), &pubbuf) != publen) ||
+	memcmp(pubbuf, pubs + i * publen, publen)) {
+      fprintf(stderr, "Error in RINGLWE routines (batch public key %d)\n", i);
+      goto err;
+    }
+    OPENSSL_free(pubbuf);
+    pubbuf = NULL;
+    
+    bsslen = RINGLWE_compute_key_bob(bssbuf, sizeof(bssbuf), &rec,
+				     RLWE_PAIR_get_publickey(pairs[i]), bob, KDF1_SHA1);
+    asslen = RINGLWE_compute_key_alice(assbuf, sizeof(assbuf), bob, rec, pairs[i], KDF1_SHA1);
+    RLWE_REC_free(rec);
+    rec = NULL;
+    if ((asslen == 0) || (bsslen != asslen) || memcmp(assbuf, bssbuf, asslen)) {
+      fprintf(stderr, "Error in RINGLWE routines (batch key %d: mismatched shared secrets)\n", i);
+      goto err;
+    }
+  }
+  BIO_printf(out, "ok!\n");
+  ret = 1;
+  
+ err:
+  
+  ERR_print_errors_fp(stderr);
+  
+  OPENSSL_free(pubs);
+  OPENSSL_free(pubbuf);
+  RLWE_REC_free(rec);
+  RLWE_PUB_free(bob);
+  for (i = 0; i < RLWE_TEST_BATCH; i++)
+    RLWE_PAIR_free(pairs[i]);
+  RLWE_CTX_free(ctx);
+  printf("-------------------------------------------------------------------\n");
+  return (ret);
+}
+
+static int test_ringlwe_ticket(BIO *out, int nid) {
+
+  RLWE_PAIR *alice = NULL;
+  RLWE_TICKET *ticket = NULL;
+  RLWE_REC *rec = NULL;
+  RLWE_CTX *ctx = NULL;
+  
+  const unsigned char *enc;
+  unsigned char *pubbuf = NULL;
+  size_t enclen;
+  
+  unsigned char assbuf[20], bssbuf[20];
+  size_t asslen, bsslen;
+  
+  int i, ret = 0;
+  
+  ctx = RLWE_CTX_new (nid);
+  if (ctx == NULL) {
+    return ret;
+  }
+  
+  alice = RLWE_PAIR_new(ctx);
+  ticket = RLWE_TICKET_new(ctx);
+  if ((alice == NULL) || (ticket == NULL))
+    goto err;
+  
+  BIO_puts(out, "Testing precomputed encapsulation\n");
+  
+  if (!RLWE_PAIR_generate_key(alice))
+    goto err;
+  
+  /* Each ticket is good for one exchange and can then be regenerated */
+  for (i = 0; i < 2; i++) {
+    if (!RLWE_TICKET_generate(ticket)) {
+      fprintf(stderr, "Error generating RLWE ticket\n");
+      goto err;
+    }
+    enclen = RLWE_TICKET_get_encoded_publickey(ticket, &enc);
+    if ((RLWE_TICKET_get_nid(ticket) != nid) ||
+	(i2o_RLWE_PUB(RLWE_TICKET_get_publickey(ticket), &pubbuf) != enclen) ||
+	memcmp(pubbuf, enc, enclen)) {
+      fprintf(stderr, "Error in RINGLWE routines (ticket public key)\n");
+      goto err;
+    }
+    OPENSSL_free(pubbuf);
+    pubbuf = NULL;
+    
+    bsslen = RINGLWE_compute_key_bob_ticket(bssbuf, sizeof(bssbuf), &rec,
+					    RLWE_PAIR_get_publickey(alice), ticket, KDF1_SHA1);
+    asslen = RINGLWE_compute_key_alice(assbuf, sizeof(assbuf),
+				       RLWE_TICKET_get_publickey(ticket), rec, alice, KDF1_SHA1);
+    if ((asslen == 0) || (bsslen != asslen) || memcmp(assbuf, bssbuf, asslen)) {
+      fprintf(stderr, "Error in RINGLWE routines (ticket: mismatched shared secrets)\n");
+      goto err;
+    }
+    
+    if (RINGLWE_compute_key_bob_ticket(bssbuf, sizeof(bssbuf), &rec,
+				       RLWE_PAIR_get_publickey(alice), ticket, KDF1_SHA1) != 0) {
+      fprintf(stderr, "Error in RINGLWE routines (ticket used twice)\n");
+      goto err;
+    }
+    ERR_clear_error();
+  }
+  BIO_printf(out, "ok!\n");
+  ret = 1;
+  
+ err:
+  
+  ERR_print_errors_fp(stderr);
+  
+  OPENSSL_free(pubbuf);
+  RLWE_REC_free(rec);
+  RLWE_TICKET_free(ticket);
+  RLWE_PAIR_free(alice);
+  RLWE_CTX_free(ctx);
+  printf("-------------------------------------------------------------------\n");
+  return (ret);
+}
+
+/* The _ex functions with one workspace and reconciliation structure
+   reused across several exchanges */
+
+static int test_ringlwe_ex(BIO *out, int nid) {
+
+  RLWE_PAIR *alice = NULL;
+  RLWE_PUB *bob = NULL;
+  RLWE_TICKET *ticket = NULL;
+  RLWE_WORKSPACE *ws = NULL;
+  RLWE_REC *rec = NULL;
+  RLWE_CTX *ctx = NULL;
+  
+  unsigned char assbuf[20], bssbuf[20];
+  size_t asslen, bsslen;
+  
+  int i, ret = 0;
+  
+  ctx = RLWE_CTX_new (nid);
+  if (ctx == NULL) {
+    return ret;
+  }
+  
+  alice = RLWE_PAIR_new(ctx);
+  bob = RLWE_PUB_new(ctx);
+  ticket = RLWE_TICKET_new(ctx);
+  ws = RLWE_WORKSPACE_new(ctx);
+  rec = RLWE_REC_new(RLWE_CTX_get_m(ctx) / 64 - 1);  /* too small for ctx */
+  if ((alice == NULL) || (bob == NULL) || (ticket == NULL) || (ws == NULL) || (rec == NULL))
+    goto err;
+  
+  BIO_puts(out, "Testing key exchange with reused workspace\n");
+  
+  if (!RLWE_PAIR_generate_key(alice))
+    goto err;
+  
+  /* A reconciliation structure of the wrong size is refused */
+  if (RINGLWE_compute_key_bob_ex(bssbuf, sizeof(bssbuf), rec,
+				 RLWE_PAIR_get_publickey(alice), bob, ws, KDF1_SHA1) != 0) {
+    fprintf(stderr, "Error in RINGLWE routines (mismatched reconciliation accepted)\n");
+    goto err;
+  }
+  ERR_clear_error();
+  RLWE_REC_free(rec);
+  rec = NULL;
+  if (RINGLWE_compute_key_bob(bssbuf, sizeof(bssbuf), &rec,
+			      RLWE_PAIR_get_publickey(alice), bob, KDF1_SHA1) == 0)
+    goto err;
+  
+  for (i = 0; i < 4; i++) {
+    if (!RLWE_PAIR_generate_key(alice))
+      goto err;
+    if (i & 1) {
+      if (!RLWE_TICKET_generate(ticket))
+	goto err;
+      bsslen = RINGLWE_compute_key_bob_ticket_ex(bssbuf, sizeof(bssbuf), rec,
+						 RLWE_PAIR_get_publickey(alice), ticket, ws, KDF1_SHA1);
+      asslen = RINGLWE_compute_key_alice_ex(assbuf, sizeof(assbuf),
+					    RLWE_TICKET_get_publickey(ticket), rec, alice, ws, KDF1_SHA1);
+    } else {
+      bsslen = RINGLWE_compute_key_bob_ex(bssbuf, sizeof(bssbuf), rec,
+					  RLWE_PAIR_get_publickey(alice), bob, ws, KDF1_SHA1);
+      asslen = RINGLWE_compute_key_alice_ex(assbuf, sizeof(assbuf), bob, rec, alice, ws, KDF1_SHA1);
+    }
+    if ((asslen == 0) || (bsslen != asslen) || memcmp(assbuf, bssbuf, asslen)) {
+      fprintf(stderr, "Error in RINGLWE routines (workspace exchange %d: mismatched shared secrets)\n", i);
+      goto err;
+    }
+  }
+  BIO_printf(out, "ok!\n");
+  ret = 1;
+  
+ err:
+  
+  ERR_print_errors_fp(stderr);
+  
+  RLWE_REC_free(rec);
+  RLWE_WORKSPACE_free(ws);
+  RLWE_TICKET_free(ticket);
+  RLWE_PUB_free(bob);
+  RLWE_PAIR_free(alice);
+  RLWE_CTX_free(ctx);
+  printf("-------------------------------------------------------------------\n");
+  return (ret);
+}
+
+/* Encoding into a caller buffer, and Alice's side computed from views of
+   that buffer, writing the shared key over the encodings it reads */
+
+static int test_ringlwe_view(BIO *out, int nid) {
+
+  RLWE_PAIR *alice = NULL;
+  RLWE_PUB *bob = NULL;
+  RLWE_REC *rec = NULL;
+  RLWE_WORKSPACE *ws = NULL;
+  RLWE_CTX *ctx = NULL;
+  RLWE_PUB_VIEW pub_view;
+  RLWE_REC_VIEW rec_view;
+  
+  unsigned char *msg = NULL, *ref = NULL;
+  unsigned char assbuf[20], bssbuf[20];
+  size_t publen, reclen, asslen, bsslen;
+  
+  int i, ret = 0;
+  
+  ctx = RLWE_CTX_new (nid);
+  if (ctx == NULL) {
+    return ret;
+  }
+  
+  alice = RLWE_PAIR_new(ctx);
+  bob = RLWE_PUB_new(ctx);
+  ws = RLWE_WORKSPACE_new(ctx);
+  if ((alice == NULL) || (bob == NULL) || (ws == NULL))
+    goto err;
+  
+  BIO_puts(out, "Testing encoding in place and decoding from views\n");
+  
+  if (!RLWE_PAIR_generate_key(alice))
+    goto err;
+  bsslen = RINGLWE_compute_key_bob(bssbuf, sizeof(bssbuf), &rec,
+				   RLWE_PAIR_get_publickey(alice), bob, KDF1_SHA1);
+  if (bsslen == 0)
+    goto err;
+  
+  publen = RLWE_PUB_encode(bob, NULL, 0);
+  reclen = RLWE_REC_encode(rec, NULL, 0);
+  msg = OPENSSL_malloc(publen + reclen);
+  if ((publen == 0) || (reclen == 0) || (msg == NULL))
+    goto err;
+  
+  /* Too small a buffer is refused */
+  if ((RLWE_PUB_encode(bob, msg, publen - 1) != 0) ||
+      (RLWE_REC_encode(rec, msg, reclen - 1) != 0)) {
+    fprintf(stderr, "Error in RINGLWE routines (encoded into short buffer)\n");
+    goto err;
+  }
+  ERR_clear_error();
+  
+  /* The encodings match i2o */
+  if ((RLWE_PUB_encode(bob, msg, publen) != publen) ||
+      (RLWE_REC_encode(rec, msg + publen, reclen) != reclen))
+    goto err;
+  if ((i2o_RLWE_PUB(bob, &ref) != publen) || memcmp(msg, ref, publen)) {
+    fprintf(stderr, "Error in RINGLWE routines (public key encodings differ)\n");
+    goto err;
+  }
+  OPENSSL_free(ref);
+  ref = NULL;
+  if ((i2o_RLWE_REC(rec, &ref) != reclen) || memcmp(msg + publen, ref, reclen)) {
+    fprintf(stderr, "Error in RINGLWE routines (reconciliation encodings differ)\n");
+    goto err;
+  }
+  
+  /* Truncated encodings are refused */
+  if (RLWE_PUB_VIEW_init(&pub_view, msg, publen - 1) ||
+      RLWE_REC_VIEW_init(&rec_view, msg + publen, reclen - 1)) {
+    fprintf(stderr, "Error in RINGLWE routines (truncated encoding accepted)\n");
+    goto err;
+  }
+  ERR_clear_error();
+  
+  /* Once with an automatic workspace, writing into a separate buffer, then
+     with ws, writing the shared key over the public key as the TLS server
+     does */
+  for (i = 0; i < 2; i++) {
+    if (!RLWE_PUB_VIEW_init(&pub_view, msg, publen) ||
+	!RLWE_REC_VIEW_init(&rec_view, msg + publen, reclen))
+      goto err;
+    if (i == 0) {
+      asslen = RINGLWE_compute_key_alice_view(assbuf, sizeof(assbuf), &pub_view, &rec_view,
+					      alice, NULL, KDF1_SHA1);
+    } else {
+      asslen = RINGLWE_compute_key_alice_view(msg, sizeof(assbuf), &pub_view, &rec_view,
+					      alice, ws, KDF1_SHA1);
+      memcpy(assbuf, msg, asslen);
+    }
+    if ((asslen == 0) || (bsslen != asslen) || memcmp(assbuf, bssbuf, asslen)) {
+      fprintf(stderr, "Error in RINGLWE routines (view exchange %d: mismatched shared secrets)\n", i);
+      goto err;
+    }
+  }
+  BIO_printf(out, "ok!\n");
+  ret = 1;
+  
+ err:
+  
+  ERR_print_errors_fp(stderr);
+  
+  OPENSSL_free(ref);
+  OPENSSL_free(msg);
+  RLWE_REC_free(rec);
+  RLWE_WORKSPACE_free(ws);
+  RLWE_PUB_free(bob);
+  RLWE_PAIR_free(alice);
+  RLWE_CTX_free(ctx);
+  printf("-------------------------------------------------------------------\n");
+  return (ret);
+}
+
+/* Exchange keys with both public keys sent compressed, decoding Bob's
+   both ways */
+
+static int test_ringlwe_compressed(BIO *out, int nid) {
+
+  RLWE_PAIR *alice = NULL;
+  RLWE_PUB *alice_pub = NULL, *bob = NULL, *bob_pub = NULL;
+  RLWE_REC *rec = NULL;
+  RLWE_CTX *ctx = NULL;
+  RLWE_PUB_VIEW pub_view;
+  RLWE_REC_VIEW rec_view;
+  
+  unsigned char *apub = NULL, *bpub = NULL, *again = NULL, *recbuf = NULL;
+  unsigned char assbuf[20], bssbuf[20];
+  size_t apublen, bpublen, reclen, asslen, bsslen;
+  
+  int bits, i, ret = 0;
+  
+  ctx = RLWE_CTX_new (nid);
+  if (ctx == NULL) {
+    return ret;
+  }
+  
+  alice = RLWE_PAIR_new(ctx);
+  bob = RLWE_PUB_new(ctx);
+  if ((alice == NULL) || (bob == NULL))
+    goto err;
+  if (!RLWE_PAIR_generate_key(alice))
+    goto err;
+  
+  bits = RLWE_get_compressed_bits(nid);
+  if (bits == 0) {
+    BIO_puts(out, "Testing that compression is refused\n");
+    if (RLWE_PUB_encode_compressed(RLWE_PAIR_get_publickey(alice), 12, NULL, 0) != 0) {
+      fprintf(stderr, "Error in RINGLWE routines (compressed a key without a compressed encoding)\n");
+      goto err;
+    }
+    ERR_clear_error();
+    BIO_printf(out, "ok!\n");
+    ret = 1;
+    goto err;
+  }
+  
+  BIO_printf(out, "Testing key exchange with public keys compressed to %d bits\n", bits);
+  
+  apublen = RLWE_PUB_encode_compressed(RLWE_PAIR_get_publickey(alice), bits, NULL, 0);
+  if ((apublen == 0) || (apublen >= RLWE_PUB_encode(RLWE_PAIR_get_publickey(alice), NULL, 0)))
+    goto err;
+  apub = OPENSSL_malloc(apublen);
+  again = OPENSSL_malloc(apublen);
+  if ((apub == NULL) || (again == NULL))
+    goto err;
+  if (RLWE_PUB_encode_compressed(RLWE_PAIR_get_publickey(alice), bits, apub, apublen) != apublen)
+    goto err;
+  
+  /* Only the _compressed decoders take the compressed encoding */
+  if (RLWE_PUB_VIEW_init(&pub_view, apub, apublen) ||
+      (o2i_RLWE_PUB(&alice_pub, apub, apublen) != NULL)) {
+    fprintf(stderr, "Error in RINGLWE routines (compressed key accepted as plain)\n");
+    goto err;
+  }
+  ERR_clear_error();
+  
+  /* A decoded key compresses to the same encoding again */
+  if (o2i_RLWE_PUB_compressed(&alice_pub, apub, apublen) == NULL)
+    goto err;
+  if ((RLWE_PUB_encode_compressed(alice_pub, bits, again, apublen) != apublen) ||
+      memcmp(apub, again, apublen)) {
+    fprintf(stderr, "Error in RINGLWE routines (compressed encoding not stable)\n");
+    goto err;
+  }
+  
+  /* The width must agree with the length */
+  apub[32]++;
+  if (RLWE_PUB_VIEW_init_compressed(&pub_view, apub, apublen) ||
+      (o2i_RLWE_PUB_compressed(&alice_pub, apub, apublen) != NULL)) {
+    fprintf(stderr, "Error in RINGLWE routines (bad compressed width accepted)\n");
+    goto err;
+  }
+  apub[32]--;
+  ERR_clear_error();
+  
+  bsslen = RINGLWE_compute_key_bob(bssbuf, sizeof(bssbuf), &rec, alice_pub, bob, KDF1_SHA1);
+  if (bsslen == 0)
+    goto err;
+  bpublen = RLWE_PUB_encode_compressed(bob, bits, NULL, 0);
+  reclen = i2o_RLWE_REC(rec, &recbuf);
+  bpub = OPENSSL_malloc(bpublen);
+  if ((bpublen == 0) || (reclen == 0) || (bpub == NULL))
+    goto err;
+  if (RLWE_PUB_encode_compressed(bob, bits, bpub, bpublen) != bpublen)
+    goto err;
+  
+  for (i = 0; i < 2; i++) {
+    if (i == 0) {
+      if (o2i_RLWE_PUB_compressed(&bob_pub, bpub, bpublen) == NULL)
+	goto err;
+      RLWE_REC_free(rec);
+      rec = NULL;
+      if (o2i_RLWE_REC(&rec, recbuf, reclen) == NULL)
+	goto err;
+      asslen = RINGLWE_compute_key_alice(assbuf, sizeof(assbuf), bob_pub, rec, alice, KDF1_SHA1);
+    } else {
+      if (!RLWE_PUB_VIEW_init_compressed(&pub_view, bpub, bpublen) ||
+	  !RLWE_REC_VIEW_init(&rec_view, recbuf, reclen))
+	goto err;
+      asslen = RINGLWE_compute_key_alice_view(assbuf, sizeof(assbuf), &pub_view, &rec_view,
+					      alice, NULL, KDF1_SHA1);
+    }
+    if ((asslen == 0) || (bsslen != asslen) || memcmp(assbuf, bssbuf, asslen)) {
+      fprintf(stderr, "Error in RINGLWE routines (compressed exchange %d: mismatched shared secrets)\n", i);
+      goto err;
+    }
+  }
+  BIO_printf(out, "ok!\n");
+  ret = 1;
+  
+ err:
+  
+  ERR_print_errors_fp(stderr);
+  
+  OPENSSL_free(recbuf);
+  OPENSSL_free(again);
+  OPENSSL_free(bpub);
+  OPENSSL_free(apub);
+  RLWE_REC_free(rec);
+  RLWE_PUB_free(bob_pub);
+  RLWE_PUB_free(bob);
+  RLWE_PUB_free(alice_pub);
+  RLWE_PAIR_free(alice);
+  RLWE_CTX_free(ctx);
+  printf("-------------------------------------------------------------------\n");
+  return (ret);
+}
+
+/* Exchange keys through the EVP_PKEY interface, passing both public keys
+   and Alice's private key through their DER encodings */
+
+static int test_ringlwe_evp(BIO *out, int nid) {
+
+  EVP_PKEY_CTX *pctx = NULL, *actx = NULL, *bctx = NULL;
+  EVP_PKEY *params = NULL, *alice = NULL, *bob = NULL;
+  EVP_PKEY *alice_priv = NULL, *alice_pub = NULL, *bob_pub = NULL;
+  RLWE_REC *rec = NULL, *rec_copy = NULL;
+  
+  unsigned char *der = NULL, *recbuf = NULL;
+  const unsigned char *p;
+  unsigned char assbuf[32], bssbuf[32];
+  size_t asslen, bsslen, reclen;
+  int derlen, ret = 0;
+  
+  BIO_puts(out, "Testing key exchange through EVP_PKEY\n");
+  
+  /* Parameters by name, then Alice's key from them and Bob's key as
+     parameters alone */
+  pctx = EVP_PKEY_CTX_new_id(EVP_PKEY_RLWE, NULL);
+  if ((pctx == NULL) || (EVP_PKEY_paramgen_init(pctx) <= 0) ||
+      (EVP_PKEY_CTX_ctrl_str(pctx, "rlwe_paramset", OBJ_nid2sn(nid)) <= 0) ||
+      (EVP_PKEY_paramgen(pctx, &params) <= 0))
+    goto err;
+  EVP_PKEY_CTX_free(pctx);
+  pctx = EVP_PKEY_CTX_new(params, NULL);
+  if ((pctx == NULL) || (EVP_PKEY_keygen_init(pctx) <= 0) ||
+      (EVP_PKEY_keygen(pctx, &alice) <= 0))
+    goto err;
+  bob = EVP_PKEY_new();
+  if ((bob == NULL) || !EVP_PKEY_set_type(bob, EVP_PKEY_RLWE) ||
+      !EVP_PKEY_copy_parameters(bob, params))
+    goto err;
+  if ((EVP_PKEY_bits(alice) != (int)RLWE_CTX_get_m(RLWE_CTX_new(nid))) ||
+      (RLWE_PAIR_get_nid(alice->pkey.rlwe) != nid)) {
+    fprintf(stderr, "Error in RINGLWE routines (EVP key has wrong parameters)\n");
+    goto err;
+  }
+  
+  /* A key without a public key cannot be encoded */
+  if (i2d_PUBKEY(bob, NULL) > 0) {
+    fprintf(stderr, "Error in RINGLWE routines (encoded a missing public key)\n");
+    goto err;
+  }
+  ERR_clear_error();
+  
+  derlen = i2d_PUBKEY(alice, &der);
+  p = der;
+  if ((derlen <= 0) || ((alice_pub = d2i_PUBKEY(NULL, &p, derlen)) == NULL))
+    goto err;
+  OPENSSL_free(der);
+  der = NULL;
+  if (EVP_PKEY_cmp(alice, alice_pub) != 1) {
+    fprintf(stderr, "Error in RINGLWE routines (decoded public key differs)\n");
+    goto err;
+  }
+  
+  /* Bob encapsulates, which gives his key a public key */
+  bctx = EVP_PKEY_CTX_new(bob, NULL);
+  if ((bctx == NULL) || (EVP_PKEY_derive_init(bctx) <= 0) ||
+      (EVP_PKEY_derive_set_peer(bctx, alice_pub) <= 0) ||
+      (EVP_PKEY_CTX_set_rlwe_kdf_type(bctx, EVP_PKEY_RLWE_KDF_X9_62) <= 0) ||
+      (EVP_PKEY_CTX_set_rlwe_kdf_md(bctx, EVP_sha256()) <= 0) ||
+      (EVP_PKEY_CTX_set_rlwe_kdf_outlen(bctx, sizeof(bssbuf)) <= 0))
+    goto err;
+  bsslen = sizeof(bssbuf);
+  if ((EVP_PKEY_derive(bctx, bssbuf, &bsslen) <= 0) ||
+      (EVP_PKEY_CTX_get0_rlwe_rec(bctx, &rec) <= 0))
+    goto err;
+  reclen = i2o_RLWE_REC(rec, &recbuf);
+  
+  derlen = i2d_PUBKEY(bob, &der);
+  p = der;
+  if ((derlen <= 0) || ((bob_pub = d2i_PUBKEY(NULL, &p, derlen)) == NULL))
+    goto err;
+  OPENSSL_free(der);
+  der = NULL;
+  
+  derlen = i2d_PrivateKey(alice, &der);
+  p = der;
+  if ((derlen <= 0) || ((alice_priv = d2i_AutoPrivateKey(NULL, &p, derlen)) == NULL))
+    goto err;
+  
+  /* Alice needs the reconciliation data before she can decapsulate */
+  actx = EVP_PKEY_CTX_new(alice_priv, NULL);
+  if ((actx == NULL) || (EVP_PKEY_derive_init(actx) <= 0) ||
+      (EVP_PKEY_derive_set_peer(actx, bob_pub) <= 0) ||
+      (EVP_PKEY_CTX_ctrl_str(actx, "rlwe_kdf_md", "SHA256") <= 0) ||
+      (EVP_PKEY_CTX_ctrl_str(actx, "rlwe_kdf_outlen", "32") <= 0))
+    goto err;
+  asslen = sizeof(assbuf);
+  if (EVP_PKEY_derive(actx, assbuf, &asslen) > 0) {
+    fprintf(stderr, "Error in RINGLWE routines (derived without reconciliation data)\n");
+    goto err;
+  }
+  ERR_clear_error();
+  if ((o2i_RLWE_REC(&rec_copy, recbuf, reclen) == NULL) ||
+      (EVP_PKEY_CTX_set0_rlwe_rec(actx, rec_copy) <= 0))
+    goto err;
+  rec_copy = NULL;
+  asslen = sizeof(assbuf);
+  if (EVP_PKEY_derive(actx, assbuf, &asslen) <= 0)
+    goto err;
+  
+  if ((bsslen != sizeof(bssbuf)) || (bsslen != asslen) || memcmp(assbuf, bssbuf, asslen)) {
+    fprintf(stderr, "Error in RINGLWE routines (EVP exchange: mismatched shared secrets)\n");
+    goto err;
+  }
+  BIO_printf(out, "ok!\n");
+  ret = 1;
+  
+ err:
+  
+  ERR_print_errors_fp(stderr);
+  
+  OPENSSL_free(recbuf);
+  OPENSSL_free(der);
+  RLWE_REC_free(rec_copy);
+  EVP_PKEY_CTX_free(actx);
+  EVP_PKEY_CTX_free(bctx);
+  EVP_PKEY_CTX_free(pctx);
+  EVP_PKEY_free(bob_pub);
+  EVP_PKEY_free(alice_pub);
+  EVP_PKEY_free(alice_priv);
+  EVP_PKEY_free(bob);
+  EVP_PKEY_free(alice);
+  EVP_PKEY_free(params);
+  printf("-------------------------------------------------------------------\n");
+  return (ret);
+}
+
+/* An RLWE_METHOD that counts its calls and otherwise defers to the
+   built-in one; it has no batch entry point, so batches fall back to
+   generate */
+
+static int rlwe_counted_generate_calls = 0;
+static int rlwe_counted_encapsulate_calls = 0;
+static int rlwe_counted_decapsulate_calls = 0;
+
+static int rlwe_counted_generate(RINGELT *s, RINGELT *b, const RLWE_CTX *ctx) {
+  rlwe_counted_generate_calls++;
+  return RLWE_OpenSSL()->generate(s, b, ctx);
+}
+
+static int rlwe_counted_encapsulate(RINGELT *u, uint64_t *cr_v, uint64_t *mu, const RINGELT *b,
+				    RINGELT *tmp, const RLWE_CTX *ctx) {
+  rlwe_counted_encapsulate_calls++;
+  return RLWE_OpenSSL()->encapsulate(u, cr_v, mu, b, tmp, ctx);
+}
+
+static int rlwe_counted_decapsulate(uint64_t *mu, const RINGELT *u, const RINGELT *s_1,
+				    const uint64_t *cr_v, RINGELT *tmp, const RLWE_CTX *ctx) {
+  rlwe_counted_decapsulate_calls++;
+  return RLWE_OpenSSL()->decapsulate(mu, u, s_1, cr_v, tmp, ctx);
+}
+
+static const RLWE_METHOD rlwe_counted_meth = {
+  "counting Ring-LWE method",
+  rlwe_counted_generate,
+  rlwe_counted_encapsulate,
+  rlwe_counted_decapsulate,
+  NULL,
+  0,
+  NULL
+};
+
+/* Run one exchange and a batch of two key pairs, and check that the
+   default method did the work */
+
+static int ringlwe_method_exchange(int nid, const char *how) {
+
+  RLWE_PAIR *alice = NULL, *batch[2] = {NULL, NULL};
+  RLWE_PUB *bob = NULL;
+  RLWE_REC *rec = NULL;
+  RLWE_CTX *ctx = NULL;
+  
+  unsigned char *assbuf = NULL, *bssbuf = NULL;
+  size_t asslen, bsslen;
+  int ret = 0;
+  
+  rlwe_counted_generate_calls = 0;
+  rlwe_counted_encapsulate_calls = 0;
+  rlwe_counted_decapsulate_calls = 0;
+  
+  ctx = RLWE_CTX_new(nid);
+  alice = RLWE_PAIR_new(ctx);
+  bob = RLWE_PUB_new(ctx);
+  batch[0] = RLWE_PAIR_new(ctx);
+  batch[1] = RLWE_PAIR_new(ctx);
+  assbuf = OPENSSL_malloc(KDF1_SHA1_len);
+  bssbuf = OPENSSL_malloc(KDF1_SHA1_len);
+  if ((alice == NULL) || (bob == NULL) || (batch[0] == NULL) || (batch[1] == NULL) ||
+      (assbuf == NULL) || (bssbuf == NULL))
+    goto err;
+  
+  if (!RLWE_PAIR_generate_key(alice) || !RLWE_PAIR_generate_keys_batch(batch, 2, NULL))
+    goto err;
+  bsslen = RINGLWE_compute_key_bob(bssbuf, KDF1_SHA1_len, &rec,
+				   RLWE_PAIR_get_publickey(alice), bob, KDF1_SHA1);
+  asslen = RINGLWE_compute_key_alice(assbuf, KDF1_SHA1_len, bob, rec, alice, KDF1_SHA1);
+  if ((bsslen != KDF1_SHA1_len) || (asslen != bsslen) || memcmp(assbuf, bssbuf, asslen)) {
+    fprintf(stderr, "Error in RINGLWE routines (%s: mismatched shared secrets)\n", how);
+    goto err;
+  }
+  if ((rlwe_counted_generate_calls != 3) || (rlwe_counted_encapsulate_calls != 1) ||
+      (rlwe_counted_decapsulate_calls != 1)) {
+    fprintf(stderr, "Error in RINGLWE routines (%s: method not used)\n", how);
+    goto err;
+  }
+  ret = 1;
+  
+ err:
+  
+  OPENSSL_free(assbuf);
+  OPENSSL_free(bssbuf);
+  RLWE_REC_free(rec);
+  RLWE_PAIR_free(batch[0]);
+  RLWE_PAIR_free(batch[1]);
+  RLWE_PUB_free(bob);
+  RLWE_PAIR_free(alice);
+  RLWE_CTX_free(ctx);
+  return (ret);
+}
+
+static int test_ringlwe_method(BIO *out, int nid) {
+
+#ifndef OPENSSL_NO_ENGINE
+  ENGINE *e = NULL;
+#endif
+  RLWE_CTX *ctx;
+  int ret = 0;
+  
+  BIO_puts(out, "Testing a replacement RLWE_METHOD\n");
+  
+  ctx = RLWE_CTX_new(nid);
+  if ((RLWE_CTX_get_nid(ctx) != nid) ||
+      (RLWE_CTX_get_muwords(ctx) * 64 < RLWE_CTX_get_m(ctx))) {
+    fprintf(stderr, "Error in RINGLWE routines (context accessors)\n");
+    goto err;
+  }
+  if (RLWE_get_default_method() != RLWE_OpenSSL()) {
+    fprintf(stderr, "Error in RINGLWE routines (unexpected default method)\n");
+    goto err;
+  }
+  
+  RLWE_set_default_method(&rlwe_counted_meth);
+  if (!ringlwe_method_exchange(nid, "default method"))
+    goto err;
+  RLWE_set_default_method(NULL);
+  
+#ifndef OPENSSL_NO_ENGINE
+  /* Once the ENGINE is the default, the next lookup picks it up */
+  e = ENGINE_new();
+  if ((e == NULL) || !ENGINE_set_id(e, "rlwetest") ||
+      !ENGINE_set_name(e, "Ring-LWE test engine") ||
+      !ENGINE_set_RLWE(e, &rlwe_counted_meth) || !ENGINE_set_default_RLWE(e))
+    goto err;
+  if ((ENGINE_get_RLWE(e) != &rlwe_counted_meth) ||
+      (RLWE_get_default_method() != &rlwe_counted_meth)) {
+    fprintf(stderr, "Error in RINGLWE routines (engine method not selected)\n");
+    goto err;
+  }
+  if (!ringlwe_method_exchange(nid, "engine method"))
+    goto err;
+  RLWE_set_default_method(NULL);
+  ENGINE_unregister_RLWE(e);
+  
+  if (!RLWE_set_default_engine(e) || (RLWE_get_default_method() != &rlwe_counted_meth))
+    goto err;
+  RLWE_set_default_method(NULL);
+#endif
+  
+  if (RLWE_get_default_method() != RLWE_OpenSSL()) {
+    fprintf(stderr, "Error in RINGLWE routines (default method not restored)\n");
+    goto err;
+  }
+  BIO_printf(out, "ok!\n");
+  ret = 1;
+  
+ err:
+  
+  ERR_print_errors_fp(stderr);
+  
+  RLWE_set_default_method(NULL);
+#ifndef OPENSSL_NO_ENGINE
+  if (e != NULL) {
+    ENGINE_unregister_RLWE(e);
+    ENGINE_free(e);
+  }
+#endif
+  RLWE_CTX_free(ctx);
+  printf("-------------------------------------------------------------------\n");
+  return (ret);
+}
+
+/* A RAND_METHOD whose RAND_bytes always fails */
+static int rand_fail_bytes(unsigned char *buf, int num) {
+  return 0;
+}
+
+static int rand_fail_status(void) {
+  return 0;
+}
+
+static RAND_METHOD rand_fail_meth = {
+  NULL,
+  rand_fail_bytes,
+  NULL,
+  NULL,
+  rand_fail_bytes,
+  rand_fail_status
+};
+
+/* Key generation must fail, not carry on with a weaker key, while the
+   sampler stream cannot be seeded.  Run before anything else samples in
+   this thread, so that the stream has no key of its own to keep. */
+static int test_ringlwe_rand_failure(BIO *out) {
+
+  const RAND_METHOD *rand_meth = RAND_get_rand_method();
+  RLWE_CTX *ctx;
+  RLWE_PAIR *alice = NULL;
+  RLWE_TICKET *ticket = NULL;
+  int ret = 0;
+  
+  BIO_puts(out, "Testing Ring-LWE key generation when RAND_bytes fails\n");
+  
+  ctx = RLWE_CTX_new(NID_ringLearningWithErrors_1024_40961);
+  alice = RLWE_PAIR_new(ctx);
+  ticket = RLWE_TICKET_new(ctx);
+  if ((alice == NULL) || (ticket == NULL))
+    goto err;
+  
+  RAND_set_rand_method(&rand_fail_meth);
+  if (RLWE_PAIR_generate_key(alice) || RLWE_TICKET_generate(ticket)) {
+    RAND_set_rand_method(rand_meth);
+    fprintf(stderr, "Error in RINGLWE routines (key generated without RAND_bytes)\n");
+    goto err;
+  }
+  RAND_set_rand_method(rand_meth);
+  ERR_clear_error();
+  
+  /* and recover once RAND_bytes works again */
+  if (!RLWE_PAIR_generate_key(alice) || !RLWE_TICKET_generate(ticket)) {
+    fprintf(stderr, "Error in RINGLWE routines (no recovery from RAND_bytes failure)\n");
+    goto err;
+  }
+  BIO_printf(out, "ok!\n");
+  ret = 1;
+  
+ err:
+  
+  ERR_print_errors_fp(stderr);
+  
+  RLWE_TICKET_free(ticket);
+  RLWE_PAIR_free(alice);
+  RLWE_CTX_free(ctx);
+  printf("-------------------------------------------------------------------\n");
+  return (ret);
+}
+
+/* The runtime transforms (FFT_PARAM_get), against the compiled transforms
+   of the parameter sets and against schoolbook multiplication in the ring */
+
+typedef struct {
+  uint32_t n;
+  RINGELT q, root;
+  void (*fft_forward)(RINGELT *x);
+  void (*fft_backward)(RINGELT *x);
+  void (*fft_backward_mul)(RINGELT *x, const RINGELT *a, const RINGELT *b);
+} RINGLWE_FFT_TEST;
+
+static const RINGLWE_FFT_TEST ringlwe_fft_tests[] = {
+  { 1024, 40961, 16186, _FFT_forward_1024_40961, _FFT_backward_1024_40961, _FFT_backward_mul_1024_40961 },
+  { 821, 49261, 75, _FFT_forward_821_49261, _FFT_backward_821_49261, _FFT_backward_mul_821_49261 },
+  { 739, 47297, 52, _FFT_forward_739_47297, _FFT_backward_739_47297, _FFT_backward_mul_739_47297 },
+  { 631, 44171, 5, _FFT_forward_631_44171, _FFT_backward_631_44171, _FFT_backward_mul_631_44171 },
+  { 541, 41117, 160, _FFT_forward_541_41117, _FFT_backward_541_41117, _FFT_backward_mul_541_41117 },
+  { 512, 25601, 22188, _FFT_forward_512_25601, _FFT_backward_512_25601, _FFT_backward_mul_512_25601 },
+  { 433, 35507, 33, _FFT_forward_433_35507, _FFT_backward_433_35507, _FFT_backward_mul_433_35507 },
+  { 337, 32353, 16, _FFT_forward_337_32353, _FFT_backward_337_32353, _FFT_backward_mul_337_32353 },
+  { 256, 15361, 12228, _FFT_forward_256_15361, _FFT_backward_256_15361, _FFT_backward_mul_256_15361 },
+  /* No compiled transforms; the second has the longest Bluestein
+     convolution supported */
+  { 2048, 12289, 0, NULL, NULL, NULL },
+  { 2039, 24469, 0, NULL, NULL, NULL }
+};
+
+static void ringlwe_fft_random(RINGELT *x, uint32_t n, RINGELT q) {
+  uint32_t i;
+
+  RAND_pseudo_bytes((unsigned char *)x, n * sizeof(RINGELT));
+  for (i = 0; i < n; i++)
+    x[i] %= q;
+}
+
+/* c = a*b in F_q[x]/<x^n+1> for n a power of two, and for n prime in
+   F_q[x]/<x^n-1> mapped as by MAPTOCYCLOTOMIC */
+static void ringlwe_fft_schoolbook(RINGELT *c, const RINGELT *a, const RINGELT *b,
+				   uint32_t n, RINGELT q) {
+  uint64_t acc[FFT_PARAM_MAX_N];
+  uint32_t i, j;
+
+  memset(acc, 0, sizeof(acc));
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < n; j++) {
+      if (i + j < n)
+	acc[i + j] += (uint64_t)a[i] * b[j];
+      else if (n & 1)
+	acc[i + j - n] += (uint64_t)a[i] * b[j];
+      else
+	acc[i + j - n] += (uint64_t)a[i] * (q - b[j]);
+    }
+  }
+  for (i = 0; i < n; i++)
+    c[i] = (RINGELT)(acc[i] % q);
+  if (n & 1) {
+    for (i = 0; i < n - 1; i++)
+      c[i] = (RINGELT)((c[i] + q - c[n - 1]) % q);
+    c[n - 1] = 0;
+  }
+}
+
+static int test_ringlwe_fft_param(BIO *out) {
+  RINGELT a[FFT_PARAM_MAX_N], b[FFT_PARAM_MAX_N];
+  RINGELT x[FFT_PARAM_MAX_N], y[FFT_PARAM_MAX_N];
+  const RINGLWE_FFT_TEST *t;
+  const FFT_PARAM *fp;
+  size_t k, len;
+  int ret = 0;
+
+  BIO_puts(out, "Testing the runtime transforms\n");
+
+  for (k = 0; k < sizeof(ringlwe_fft_tests) / sizeof(ringlwe_fft_tests[0]); k++) {
+    t = &ringlwe_fft_tests[k];
+    len = t->n * sizeof(RINGELT);
+    fp = FFT_PARAM_get(t->n, t->q, t->root);
+    if ((fp == NULL) || (FFT_PARAM_get(t->n, t->q, t->root) != fp)) {
+      fprintf(stderr, "Error in RINGLWE routines (no transforms for n=%u)\n", t->n);
+      goto err;
+    }
+    ringlwe_fft_random(a, t->n, t->q);
+    ringlwe_fft_random(b, t->n, t->q);
+
+    memcpy(x, a, len);
+    FFT_PARAM_forward(fp, x);
+    memcpy(y, x, len);
+    FFT_PARAM_backward(fp, y);
+    if (memcmp(y, a, len)) {
+      fprintf(stderr, "Error in RINGLWE routines (transform of n=%u not inverted)\n", t->n);
+      goto err;
+    }
+    memcpy(y, b, len);
+    FFT_PARAM_forward(fp, y);
+    FFT_PARAM_backward_mul(fp, y, x, y);
+    ringlwe_fft_schoolbook(x, a, b, t->n, t->q);
+    if (memcmp(x, y, len)) {
+      fprintf(stderr, "Error in RINGLWE routines (wrong product for n=%u)\n", t->n);
+      goto err;
+    }
+
+    if (t->fft_forward == NULL)
+      continue;
+    memcpy(x, a, len);
+    memcpy(y, a, len);
+    FFT_PARAM_forward(fp, x);
+    t->fft_forward(y);
+    if (memcmp(x, y, len)) {
+      fprintf(stderr, "Error in RINGLWE routines (forward transforms of n=%u differ)\n", t->n);
+      goto err;
+    }
+    FFT_PARAM_backward(fp, x);
+    t->fft_backward(y);
+    if (memcmp(x, y, len)) {
+      fprintf(stderr, "Error in RINGLWE routines (backward transforms of n=%u differ)\n", t->n);
+      goto err;
+    }
+    FFT_PARAM_backward_mul(fp, x, a, b);
+    t->fft_backward_mul(y, a, b);
+    if (memcmp(x, y, len)) {
+      fprintf(stderr, "Error in RINGLWE routines (fused backward transforms of n=%u differ)\n", t->n);
+      goto err;
+    }
+  }
+
+  /* q != 1 mod 2n, n neither a power of two nor prime, and a root of the
+     wrong order */
+  if ((FFT_PARAM_get(1024, 15361, 0) != NULL) ||
+      (FFT_PARAM_get(1000, 40961, 0) != NULL) ||
+      (FFT_PARAM_get(1024, 40961, 16186 * 16186 % 40961) != NULL)) {
+    fprintf(stderr, "Error in RINGLWE routines (unsupported transform accepted)\n");
+    goto err;
+  }
+  BIO_printf(out, "ok!\n");
+  ret = 1;
+
+ err:
+
+  FFT_PARAM_cleanup();
+  printf("-------------------------------------------------------------------\n");
+  return (ret);
+}
+
 /* Test vectors for Alice's shared key computation */
 
 const RINGLWE_TEST_VECTOR ringlwe_test_vectors[RINGLWE_N_TEST_VECTORS] = 
@@ -1985,6 +2993,10 @@ int main(int argc, char *argv[]) {
   out = BIO_new(BIO_s_file());
   if (out == NULL) EXIT(1);
   BIO_set_fp(out, stdout, BIO_NOCLOSE);
+  OpenSSL_add_all_digests();
+  
+  RAND_seed(rnd_seed, sizeof rnd_seed);
+  ret &= test_ringlwe_rand_failure(out);
   
 #if DOTESTVECTORS
   BIO_printf(out, "Running Ring-LWE test vectors\n");
@@ -2022,12 +3034,20 @@ int main(int argc, char *argv[]) {
   while(rlwe_test_nids[i] != 0) {
     //	  test_ret &= ringlwe_test_kex(out, rlwe_test_nids[i]);
     test_ret &= test_ringlwe(out, rlwe_test_nids[i]);
+    test_ret &= test_ringlwe_batch(out, rlwe_test_nids[i]);
+    test_ret &= test_ringlwe_ticket(out, rlwe_test_nids[i]);
+    test_ret &= test_ringlwe_ex(out, rlwe_test_nids[i]);
+    test_ret &= test_ringlwe_view(out, rlwe_test_nids[i]);
+    test_ret &= test_ringlwe_compressed(out, rlwe_test_nids[i]);
+    test_ret &= test_ringlwe_evp(out, rlwe_test_nids[i]);
+    test_ret &= test_ringlwe_method(out, rlwe_test_nids[i]);
     if (test_ret==0) {
       BIO_printf(out, "Ring-LWE random key exchange test FAILED: NID=%d\n", rlwe_test_nids[i]);
     }
     i++;
     ret &= test_ret;
   }
+  ret &= test_ringlwe_fft_param(out);
   
   if (ret==1) {
     BIO_printf(out, "RingLWE: all tests PASSED\n");
@@ -2038,6 +3058,10 @@ int main(int argc, char *argv[]) {
   
   ERR_print_errors_fp(stderr);
   BIO_free(out);
+  EVP_cleanup();
+#ifndef OPENSSL_NO_ENGINE
+  ENGINE_cleanup();
+#endif
   CRYPTO_cleanup_all_ex_data();
   ERR_remove_thread_state(NULL);
   CRYPTO_mem_leaks_fp(stderr);
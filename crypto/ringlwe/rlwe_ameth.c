@@ -0,0 +1,407 @@
+/* crypto/ringlwe/rlwe_ameth.c */
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/*
+ * ASN.1 method for Ring-LWE keys.
+ *
+ * The algorithm identifier is ringLearningWithErrors with the OID of the
+ * parameter set as its parameters, as for a named curve.  The public key
+ * is the i2o_RLWE_PUB encoding; the private key is the i2o_RLWE_SEC
+ * encoding followed by the i2o_RLWE_PUB one.  Both encodings start with
+ * the parameter set descriptor, which must agree with the OID.
+ */
+
+#include <stdio.h>
+#include "cryptlib.h"
+#include <openssl/x509.h>
+#include <openssl/asn1t.h>
+#include "ringlwe_locl.h"
+#include "asn1_locl.h"
+
+static int rlwekey_param2type(int *pptype, void **ppval, const RLWE_PAIR *pair)
+{
+    int nid = RLWE_PAIR_get_nid(pair);
+    if (nid == NID_undef) {
+        RINGLWEerr(RINGLWE_F_RLWEKEY_PUB_ENCODE, RINGLWE_R_NO_PARAMETERS_SET);
+        return 0;
+    }
+    *ppval = OBJ_nid2obj(nid);
+    *pptype = V_ASN1_OBJECT;
+    return 1;
+}
+
+static RLWE_PAIR *rlwekey_type2param(int ptype, void *pval)
+{
+    RLWE_PAIR *pair = NULL;
+    RLWE_CTX *ctx;
+    if (ptype != V_ASN1_OBJECT) {
+        RINGLWEerr(RINGLWE_F_RLWEKEY_PARAM_DECODE, RINGLWE_R_DECODE_ERROR);
+        return NULL;
+    }
+    ctx = RLWE_CTX_new(OBJ_obj2nid(pval));
+    if (ctx != NULL) {
+        pair = RLWE_PAIR_new(ctx);
+        RLWE_CTX_free(ctx);
+    }
+    if (pair == NULL)
+        RINGLWEerr(RINGLWE_F_RLWEKEY_PARAM_DECODE, RINGLWE_R_PARAM_UNKNOWN);
+    return pair;
+}
+
+static int rlwekey_pub_encode(X509_PUBKEY *pk, const EVP_PKEY *pkey)
+{
+    RLWE_PAIR *pair = pkey->pkey.rlwe;
+    void *pval = NULL;
+    int ptype;
+    unsigned char *penc = NULL;
+    int penclen;
+
+    if (!pair->pub_set) {
+        RINGLWEerr(RINGLWE_F_RLWEKEY_PUB_ENCODE, RINGLWE_R_KEYS_NOT_SET);
+        return 0;
+    }
+    if (!rlwekey_param2type(&ptype, &pval, pair))
+        return 0;
+    penclen = i2o_RLWE_PUB(pair->pub, &penc);
+    if (penclen <= 0)
+        goto err;
+    if (X509_PUBKEY_set0_param(pk, OBJ_nid2obj(EVP_PKEY_RLWE),
+                               ptype, pval, penc, penclen))
+        return 1;
+ err:
+    ASN1_OBJECT_free(pval);
+    if (penc)
+        OPENSSL_free(penc);
+    return 0;
+}
+
+static int rlwekey_pub_decode(EVP_PKEY *pkey, X509_PUBKEY *pubkey)
+{
+    const unsigned char *p = NULL;
+    void *pval;
+    int ptype, pklen;
+    RLWE_PAIR *pair;
+    X509_ALGOR *palg;
+
+    if (!X509_PUBKEY_get0_param(NULL, &p, &pklen, &palg, pubkey))
+        return 0;
+    X509_ALGOR_get0(NULL, &ptype, &pval, palg);
+
+    pair = rlwekey_type2param(ptype, pval);
+    if (!pair) {
+        RINGLWEerr(RINGLWE_F_RLWEKEY_PUB_DECODE, RINGLWE_R_DECODE_ERROR);
+        return 0;
+    }
+
+    /* We have parameters now set public key; o2i checks they agree */
+    if (!o2i_RLWE_PUB(&pair->pub, p, pklen)) {
+        RINGLWEerr(RINGLWE_F_RLWEKEY_PUB_DECODE, RINGLWE_R_DECODE_ERROR);
+        RLWE_PAIR_free(pair);
+        return 0;
+    }
+    pair->pub_set = 1;
+
+    EVP_PKEY_assign_RLWE(pkey, pair);
+    return 1;
+}
+
+static int rlwekey_pub_cmp(const EVP_PKEY *a, const EVP_PKEY *b)
+{
+    const RLWE_PAIR *pa = a->pkey.rlwe, *pb = b->pkey.rlwe;
+    if (!pa->pub_set || !pb->pub_set)
+        return -2;
+    if (pa->param_data != pb->param_data)
+        return 0;
+    if (memcmp(pa->pub->b, pb->pub->b, pa->param_data->m * sizeof(RINGELT)))
+        return 0;
+    return 1;
+}
+
+static int rlwekey_priv_decode(EVP_PKEY *pkey, PKCS8_PRIV_KEY_INFO *p8)
+{
+    const unsigned char *p = NULL;
+    void *pval;
+    int ptype, pklen;
+    size_t seclen;
+    RLWE_PAIR *pair;
+    X509_ALGOR *palg;
+
+    if (!PKCS8_pkey_get0(NULL, &p, &pklen, &palg, p8))
+        return 0;
+    X509_ALGOR_get0(NULL, &ptype, &pval, palg);
+
+    pair = rlwekey_type2param(ptype, pval);
+    if (!pair)
+        goto err;
+
+    /* We have parameters now set private key, then public key */
+    seclen = i2o_RLWE_SEC(pair, NULL);
+    if ((size_t)pklen <= seclen
+        || !o2i_RLWE_SEC(&pair, p, seclen)
+        || !o2i_RLWE_PUB(&pair->pub, p + seclen, pklen - seclen))
+        goto err;
+    /* Only s_1 is kept; s_0 is not needed once the key is generated */
+    memset(pair->s, 0, pair->param_data->m * sizeof(RINGELT));
+    pair->keys_set = 1;
+    pair->pub_set = 1;
+
+    EVP_PKEY_assign_RLWE(pkey, pair);
+    return 1;
+
+ err:
+    RINGLWEerr(RINGLWE_F_RLWEKEY_PRIV_DECODE, RINGLWE_R_DECODE_ERROR);
+    if (pair)
+        RLWE_PAIR_free(pair);
+    return 0;
+}
+
+static int rlwekey_priv_encode(PKCS8_PRIV_KEY_INFO *p8, const EVP_PKEY *pkey)
+{
+    RLWE_PAIR *pair = pkey->pkey.rlwe;
+    unsigned char *ep, *p;
+    size_t seclen, publen;
+    int ptype;
+    void *pval;
+
+    if (!pair->keys_set) {
+        RINGLWEerr(RINGLWE_F_RLWEKEY_PRIV_ENCODE, RINGLWE_R_KEYS_NOT_SET);
+        return 0;
+    }
+    if (!rlwekey_param2type(&ptype, &pval, pair))
+        return 0;
+
+    seclen = i2o_RLWE_SEC(pair, NULL);
+    publen = i2o_RLWE_PUB(pair->pub, NULL);
+    ep = (unsigned char *)OPENSSL_malloc(seclen + publen);
+    if (!ep) {
+        RINGLWEerr(RINGLWE_F_RLWEKEY_PRIV_ENCODE, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    p = ep;
+    if (i2o_RLWE_SEC(pair, &p) != seclen || i2o_RLWE_PUB(pair->pub, &p) != publen) {
+        OPENSSL_cleanse(ep, seclen + publen);
+        OPENSSL_free(ep);
+        RINGLWEerr(RINGLWE_F_RLWEKEY_PRIV_ENCODE, ERR_R_INTERNAL_ERROR);
+        return 0;
+    }
+    if (!PKCS8_pkey_set0(p8, OBJ_nid2obj(EVP_PKEY_RLWE), 0,
+                         ptype, pval, ep, seclen + publen)) {
+        OPENSSL_cleanse(ep, seclen + publen);
+        OPENSSL_free(ep);
+        return 0;
+    }
+    return 1;
+}
+
+/* EVP_PKEY_size: the length of the raw shared secret */
+static int int_rlwe_size(const EVP_PKEY *pkey)
+{
+    return (pkey->pkey.rlwe->param_data->m + 7) / 8;
+}
+
+/* EVP_PKEY_bits: the ring dimension */
+static int rlwe_bits(const EVP_PKEY *pkey)
+{
+    return pkey->pkey.rlwe->param_data->m;
+}
+
+static int rlwe_missing_parameters(const EVP_PKEY *pkey)
+{
+    if (pkey->pkey.rlwe == NULL)
+        return 1;
+    return 0;
+}
+
+static int rlwe_copy_parameters(EVP_PKEY *to, const EVP_PKEY *from)
+{
+    RLWE_PAIR *pair;
+    RLWE_CTX *ctx;
+    if (to->pkey.rlwe != NULL
+        && to->pkey.rlwe->param_data == from->pkey.rlwe->param_data)
+        return 1;
+    /* The parameter set is fixed when a pair is made, so start again */
+    ctx = RLWE_CTX_new(RLWE_PAIR_get_nid(from->pkey.rlwe));
+    if (ctx == NULL)
+        return 0;
+    pair = RLWE_PAIR_new(ctx);
+    RLWE_CTX_free(ctx);
+    if (pair == NULL)
+        return 0;
+    if (to->pkey.rlwe != NULL)
+        RLWE_PAIR_free(to->pkey.rlwe);
+    to->pkey.rlwe = pair;
+    return 1;
+}
+
+static int rlwe_cmp_parameters(const EVP_PKEY *a, const EVP_PKEY *b)
+{
+    if (a->pkey.rlwe->param_data != b->pkey.rlwe->param_data)
+        return 0;
+    else
+        return 1;
+}
+
+static void int_rlwe_free(EVP_PKEY *pkey)
+{
+    RLWE_PAIR_free(pkey->pkey.rlwe);
+}
+
+static int do_rlwe_print(BIO *bp, const RLWE_PAIR *x, int off, int ktype)
+{
+    unsigned char *buffer = NULL, *p;
+    size_t buf_len = 0, i;
+    const char *rlwestr;
+    int ret = 0, reason = ERR_R_BIO_LIB;
+
+    if (x == NULL || x->param_data == NULL) {
+        reason = ERR_R_PASSED_NULL_PARAMETER;
+        goto err;
+    }
+    if (ktype == 2 && !x->keys_set)
+        ktype = 1;
+    if (ktype == 1 && !x->pub_set)
+        ktype = 0;
+
+    if (ktype == 2)
+        rlwestr = "Private-Key";
+    else if (ktype == 1)
+        rlwestr = "Public-Key";
+    else
+        rlwestr = "RLWE-Parameters";
+    if (!BIO_indent(bp, off, 128))
+        goto err;
+    if (BIO_printf(bp, "%s: (m = %u, q = %u)\n", rlwestr,
+                   (unsigned)x->param_data->m,
+                   (unsigned)x->param_data->q) <= 0)
+        goto err;
+
+    if (ktype > 0) {
+        /* Both encodings have the same length */
+        buf_len = i2o_RLWE_PUB(x->pub, NULL);
+        if ((buffer = OPENSSL_malloc(buf_len)) == NULL) {
+            reason = ERR_R_MALLOC_FAILURE;
+            goto err;
+        }
+    }
+    for (; ktype > 0; ktype--) {
+        p = buffer;
+        if (ktype == 2)
+            buf_len = i2o_RLWE_SEC((RLWE_PAIR *)x, &p);
+        else
+            buf_len = i2o_RLWE_PUB(x->pub, &p);
+        if (!BIO_indent(bp, off, 128)
+            || BIO_puts(bp, ktype == 2 ? "priv:" : "pub: ") <= 0)
+            goto err;
+        /* Skip the descriptor, which the parameter set line stands for */
+        for (i = _RLWE_DESCRIPTOR_LEN; i < buf_len; i++) {
+            if ((i - _RLWE_DESCRIPTOR_LEN) % 15 == 0) {
+                if (BIO_puts(bp, "\n") <= 0
+                    || !BIO_indent(bp, off + 4, 128))
+                    goto err;
+            }
+            if (BIO_printf(bp, "%02x%s", buffer[i],
+                           (i + 1 == buf_len) ? "" : ":") <= 0)
+                goto err;
+        }
+        if (BIO_puts(bp, "\n") <= 0)
+            goto err;
+    }
+
+    if (!BIO_indent(bp, off, 128))
+        goto err;
+    if (BIO_printf(bp, "Parameter set: %s\n",
+                   OBJ_nid2sn(RLWE_PAIR_get_nid(x))) <= 0)
+        goto err;
+    ret = 1;
+ err:
+    if (!ret)
+        RINGLWEerr(RINGLWE_F_DO_RLWE_PRINT, reason);
+    if (buffer != NULL) {
+        OPENSSL_cleanse(buffer, buf_len);
+        OPENSSL_free(buffer);
+    }
+    return (ret);
+}
+
+static int rlwekey_param_decode(EVP_PKEY *pkey,
+                                const unsigned char **pder, int derlen)
+{
+    ASN1_OBJECT *obj;
+    RLWE_PAIR *pair;
+    if (!(obj = d2i_ASN1_OBJECT(NULL, pder, derlen))) {
+        RINGLWEerr(RINGLWE_F_RLWEKEY_PARAM_DECODE, RINGLWE_R_DECODE_ERROR);
+        return 0;
+    }
+    pair = rlwekey_type2param(V_ASN1_OBJECT, obj);
+    ASN1_OBJECT_free(obj);
+    if (!pair)
+        return 0;
+    EVP_PKEY_assign_RLWE(pkey, pair);
+    return 1;
+}
+
+static int rlwekey_param_encode(const EVP_PKEY *pkey, unsigned char **pder)
+{
+    int nid = RLWE_PAIR_get_nid(pkey->pkey.rlwe);
+    if (nid == NID_undef)
+        return 0;
+    return i2d_ASN1_OBJECT(OBJ_nid2obj(nid), pder);
+}
+
+static int rlwekey_param_print(BIO *bp, const EVP_PKEY *pkey, int indent,
+                               ASN1_PCTX *ctx)
+{
+    return do_rlwe_print(bp, pkey->pkey.rlwe, indent, 0);
+}
+
+static int rlwekey_pub_print(BIO *bp, const EVP_PKEY *pkey, int indent,
+                             ASN1_PCTX *ctx)
+{
+    return do_rlwe_print(bp, pkey->pkey.rlwe, indent, 1);
+}
+
+static int rlwekey_priv_print(BIO *bp, const EVP_PKEY *pkey, int indent,
+                              ASN1_PCTX *ctx)
+{
+    return do_rlwe_print(bp, pkey->pkey.rlwe, indent, 2);
+}
+
+const EVP_PKEY_ASN1_METHOD rlwe_asn1_meth = {
+    EVP_PKEY_RLWE,
+    EVP_PKEY_RLWE,
+    0,
+    "RLWE",
+    "OpenSSL Ring-LWE method",
+
+    rlwekey_pub_decode,
+    rlwekey_pub_encode,
+    rlwekey_pub_cmp,
+    rlwekey_pub_print,
+
+    rlwekey_priv_decode,
+    rlwekey_priv_encode,
+    rlwekey_priv_print,
+
+    int_rlwe_size,
+    rlwe_bits,
+
+    rlwekey_param_decode,
+    rlwekey_param_encode,
+    rlwe_missing_parameters,
+    rlwe_copy_parameters,
+    rlwe_cmp_parameters,
+    rlwekey_param_print,
+    0,
+
+    int_rlwe_free,
+    0,
+    0, 0
+};
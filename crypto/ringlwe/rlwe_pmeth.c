@@ -0,0 +1,352 @@
+/* crypto/ringlwe/rlwe_pmeth.c */
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/*
+ * EVP_PKEY_METHOD for Ring-LWE key exchange.
+ *
+ * Ring-LWE is not symmetric like ECDH: the initiator (Alice) generates a
+ * key pair, the responder (Bob) encapsulates against her public key,
+ * producing his own public key and the reconciliation data, and Alice
+ * decapsulates with both.  EVP_PKEY_derive does whichever half suits the
+ * key it is given; see ringlwe.h.
+ */
+
+#include <stdio.h>
+#include "cryptlib.h"
+#include <openssl/objects.h>
+#include <openssl/evp.h>
+#ifndef OPENSSL_NO_ECDH
+# include <openssl/ecdh.h>
+#endif
+#include "ringlwe_locl.h"
+#include "evp_locl.h"
+
+/* RLWE pkey context structure */
+
+typedef struct {
+    /* Parameter set for paramgen and keygen */
+    int gen_nid;
+    /* Reconciliation data: read by Alice, written by Bob */
+    RLWE_REC *rec;
+    /* KDF (if any) to apply to the shared bits */
+    char kdf_type;
+    /* Message digest to use for key derivation */
+    const EVP_MD *kdf_md;
+    /* KDF output length */
+    size_t kdf_outlen;
+} RLWE_PKEY_CTX;
+
+static int pkey_rlwe_init(EVP_PKEY_CTX *ctx)
+{
+    RLWE_PKEY_CTX *dctx;
+    dctx = OPENSSL_malloc(sizeof(RLWE_PKEY_CTX));
+    if (!dctx)
+        return 0;
+    dctx->gen_nid = NID_undef;
+    dctx->rec = NULL;
+    dctx->kdf_type = EVP_PKEY_RLWE_KDF_NONE;
+    dctx->kdf_md = NULL;
+    dctx->kdf_outlen = 0;
+
+    ctx->data = dctx;
+
+    return 1;
+}
+
+static int pkey_rlwe_copy(EVP_PKEY_CTX *dst, EVP_PKEY_CTX *src)
+{
+    RLWE_PKEY_CTX *dctx, *sctx;
+    if (!pkey_rlwe_init(dst))
+        return 0;
+    sctx = src->data;
+    dctx = dst->data;
+    dctx->gen_nid = sctx->gen_nid;
+    if (sctx->rec) {
+        dctx->rec = RLWE_REC_new(sctx->rec->muwords);
+        if (!dctx->rec)
+            return 0;
+        memcpy(dctx->rec->c, sctx->rec->c,
+               sctx->rec->muwords * sizeof(uint64_t));
+    }
+    dctx->kdf_type = sctx->kdf_type;
+    dctx->kdf_md = sctx->kdf_md;
+    dctx->kdf_outlen = sctx->kdf_outlen;
+    return 1;
+}
+
+static void pkey_rlwe_cleanup(EVP_PKEY_CTX *ctx)
+{
+    RLWE_PKEY_CTX *dctx = ctx->data;
+    if (dctx) {
+        if (dctx->rec)
+            RLWE_REC_free(dctx->rec);
+        OPENSSL_free(dctx);
+    }
+}
+
+static int pkey_rlwe_derive(EVP_PKEY_CTX *ctx, unsigned char *key,
+                            size_t *keylen)
+{
+    size_t ret;
+    RLWE_PAIR *own, *peer;
+    RLWE_PKEY_CTX *dctx = ctx->data;
+    if (!ctx->pkey || !ctx->peerkey) {
+        RINGLWEerr(RINGLWE_F_PKEY_RLWE_DERIVE, RINGLWE_R_KEYS_NOT_SET);
+        return 0;
+    }
+    own = ctx->pkey->pkey.rlwe;
+    peer = ctx->peerkey->pkey.rlwe;
+
+    if (!key) {
+        *keylen = (own->param_data->m + 7) / 8;
+        return 1;
+    }
+    if (!peer->pub_set) {
+        RINGLWEerr(RINGLWE_F_PKEY_RLWE_DERIVE, RINGLWE_R_KEYS_NOT_SET);
+        return 0;
+    }
+
+    /*
+     * NB: as with ECDH, if *keylen is less than the maximum size the
+     * result is truncated.
+     */
+    if (own->keys_set) {
+        if (dctx->rec == NULL) {
+            RINGLWEerr(RINGLWE_F_PKEY_RLWE_DERIVE,
+                       RINGLWE_R_NO_RECONCILIATION_DATA);
+            return 0;
+        }
+        ret = RINGLWE_compute_key_alice(key, *keylen, peer->pub, dctx->rec,
+                                        own, NULL);
+    } else {
+        ret = RINGLWE_compute_key_bob(key, *keylen, &dctx->rec, peer->pub,
+                                      own->pub, NULL);
+        if (ret)
+            own->pub_set = 1;
+    }
+    if (ret == 0)
+        return 0;
+    *keylen = ret;
+    return 1;
+}
+
+static int pkey_rlwe_kdf_derive(EVP_PKEY_CTX *ctx,
+                                unsigned char *key, size_t *keylen)
+{
+    RLWE_PKEY_CTX *dctx = ctx->data;
+    unsigned char *ktmp = NULL;
+    size_t ktmplen;
+    int rv = 0;
+    if (dctx->kdf_type == EVP_PKEY_RLWE_KDF_NONE)
+        return pkey_rlwe_derive(ctx, key, keylen);
+    if (!key) {
+        *keylen = dctx->kdf_outlen;
+        return 1;
+    }
+    if (*keylen != dctx->kdf_outlen)
+        return 0;
+    if (!pkey_rlwe_derive(ctx, NULL, &ktmplen))
+        return 0;
+    ktmp = OPENSSL_malloc(ktmplen);
+    if (!ktmp)
+        return 0;
+    if (!pkey_rlwe_derive(ctx, ktmp, &ktmplen))
+        goto err;
+#ifndef OPENSSL_NO_ECDH
+    if (!ECDH_KDF_X9_62(key, *keylen, ktmp, ktmplen, NULL, 0, dctx->kdf_md))
+        goto err;
+    rv = 1;
+#endif
+
+ err:
+    if (ktmp) {
+        OPENSSL_cleanse(ktmp, ktmplen);
+        OPENSSL_free(ktmp);
+    }
+    return rv;
+}
+
+static int pkey_rlwe_ctrl(EVP_PKEY_CTX *ctx, int type, int p1, void *p2)
+{
+    RLWE_PKEY_CTX *dctx = ctx->data;
+    switch (type) {
+    case EVP_PKEY_CTRL_RLWE_PARAMGEN_NID:
+        if (RINGLWE_PARAM_DATA_set(p1) == NULL) {
+            RINGLWEerr(RINGLWE_F_PKEY_RLWE_CTRL, RINGLWE_R_PARAM_UNKNOWN);
+            return 0;
+        }
+        dctx->gen_nid = p1;
+        return 1;
+
+    case EVP_PKEY_CTRL_RLWE_KDF_TYPE:
+        if (p1 == -2)
+            return dctx->kdf_type;
+        if (p1 != EVP_PKEY_RLWE_KDF_NONE && p1 != EVP_PKEY_RLWE_KDF_X9_62)
+            return -2;
+#ifdef OPENSSL_NO_ECDH
+        if (p1 == EVP_PKEY_RLWE_KDF_X9_62) {
+            RINGLWEerr(RINGLWE_F_PKEY_RLWE_CTRL, RINGLWE_R_INVALID_KDF);
+            return 0;
+        }
+#endif
+        dctx->kdf_type = p1;
+        return 1;
+
+    case EVP_PKEY_CTRL_RLWE_KDF_MD:
+        dctx->kdf_md = p2;
+        return 1;
+
+    case EVP_PKEY_CTRL_GET_RLWE_KDF_MD:
+        *(const EVP_MD **)p2 = dctx->kdf_md;
+        return 1;
+
+    case EVP_PKEY_CTRL_RLWE_KDF_OUTLEN:
+        if (p1 <= 0)
+            return -2;
+        dctx->kdf_outlen = (size_t)p1;
+        return 1;
+
+    case EVP_PKEY_CTRL_GET_RLWE_KDF_OUTLEN:
+        *(int *)p2 = dctx->kdf_outlen;
+        return 1;
+
+    case EVP_PKEY_CTRL_RLWE_REC:
+        if (dctx->rec)
+            RLWE_REC_free(dctx->rec);
+        dctx->rec = p2;
+        return 1;
+
+    case EVP_PKEY_CTRL_GET_RLWE_REC:
+        *(RLWE_REC **)p2 = dctx->rec;
+        return dctx->rec != NULL;
+
+    case EVP_PKEY_CTRL_PEER_KEY:
+        /* Default behaviour is OK */
+        return 1;
+
+    default:
+        return -2;
+
+    }
+}
+
+static int pkey_rlwe_ctrl_str(EVP_PKEY_CTX *ctx,
+                              const char *type, const char *value)
+{
+    if (!strcmp(type, "rlwe_paramset")) {
+        char sn[32];
+        int nid;
+        /* Accept "ringlwe_1024", its long name, or just "1024" */
+        nid = OBJ_sn2nid(value);
+        if (nid == NID_undef)
+            nid = OBJ_ln2nid(value);
+        if (nid == NID_undef && strlen(value) < sizeof(sn) - 8) {
+            BIO_snprintf(sn, sizeof(sn), "ringlwe_%s", value);
+            nid = OBJ_sn2nid(sn);
+        }
+        if (nid == NID_undef || RINGLWE_PARAM_DATA_set(nid) == NULL) {
+            RINGLWEerr(RINGLWE_F_PKEY_RLWE_CTRL_STR, RINGLWE_R_PARAM_UNKNOWN);
+            return 0;
+        }
+        return EVP_PKEY_CTX_set_rlwe_paramgen_nid(ctx, nid);
+    } else if (!strcmp(type, "rlwe_kdf_md")) {
+        const EVP_MD *md;
+        if (!(md = EVP_get_digestbyname(value))) {
+            RINGLWEerr(RINGLWE_F_PKEY_RLWE_CTRL_STR, RINGLWE_R_INVALID_DIGEST);
+            return 0;
+        }
+        if (EVP_PKEY_CTX_set_rlwe_kdf_type(ctx, EVP_PKEY_RLWE_KDF_X9_62) <= 0)
+            return 0;
+        return EVP_PKEY_CTX_set_rlwe_kdf_md(ctx, md);
+    } else if (!strcmp(type, "rlwe_kdf_outlen")) {
+        return EVP_PKEY_CTX_set_rlwe_kdf_outlen(ctx, atoi(value));
+    }
+
+    return -2;
+}
+
+static int pkey_rlwe_paramgen(EVP_PKEY_CTX *ctx, EVP_PKEY *pkey)
+{
+    RLWE_PAIR *pair;
+    RLWE_CTX *rctx;
+    RLWE_PKEY_CTX *dctx = ctx->data;
+    if (dctx->gen_nid == NID_undef) {
+        RINGLWEerr(RINGLWE_F_PKEY_RLWE_PARAMGEN, RINGLWE_R_NO_PARAMETERS_SET);
+        return 0;
+    }
+    rctx = RLWE_CTX_new(dctx->gen_nid);
+    if (!rctx)
+        return 0;
+    pair = RLWE_PAIR_new(rctx);
+    RLWE_CTX_free(rctx);
+    if (!pair)
+        return 0;
+    EVP_PKEY_assign_RLWE(pkey, pair);
+    return 1;
+}
+
+static int pkey_rlwe_keygen(EVP_PKEY_CTX *ctx, EVP_PKEY *pkey)
+{
+    RLWE_PAIR *pair;
+    RLWE_CTX *rctx;
+    RLWE_PKEY_CTX *dctx = ctx->data;
+    int nid;
+    if (ctx->pkey)
+        nid = RLWE_PAIR_get_nid(ctx->pkey->pkey.rlwe);
+    else
+        nid = dctx->gen_nid;
+    if (nid == NID_undef) {
+        RINGLWEerr(RINGLWE_F_PKEY_RLWE_KEYGEN, RINGLWE_R_NO_PARAMETERS_SET);
+        return 0;
+    }
+    rctx = RLWE_CTX_new(nid);
+    if (!rctx)
+        return 0;
+    pair = RLWE_PAIR_new(rctx);
+    RLWE_CTX_free(rctx);
+    if (!pair)
+        return 0;
+    /* Note: if error return, pkey is freed by parent routine */
+    EVP_PKEY_assign_RLWE(pkey, pair);
+    return RLWE_PAIR_generate_key(pair);
+}
+
+const EVP_PKEY_METHOD rlwe_pkey_meth = {
+    EVP_PKEY_RLWE,
+    0,
+    pkey_rlwe_init,
+    pkey_rlwe_copy,
+    pkey_rlwe_cleanup,
+
+    0,
+    pkey_rlwe_paramgen,
+
+    0,
+    pkey_rlwe_keygen,
+
+    0, 0,
+
+    0, 0,
+
+    0, 0,
+
+    0, 0, 0, 0,
+
+    0, 0,
+
+    0, 0,
+
+    0,
+    pkey_rlwe_kdf_derive,
+
+    pkey_rlwe_ctrl,
+    pkey_rlwe_ctrl_str
+};
@@ -1,10 +1,132 @@
+#include <string.h>
+#include "e_os.h"
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/ringlwe.h>
 #include "rlwe_rand_openssl_aes.h"
 
-uint64_t randomplease(AES_KEY *aes_key, unsigned char aes_ivec[AES_BLOCK_SIZE],
-                      unsigned char aes_ecount_buf[AES_BLOCK_SIZE],
-                      unsigned int *aes_num, unsigned char aes_in[AES_BLOCK_SIZE]) {
-	uint64_t out;
-	AES_ctr128_encrypt(aes_in, (unsigned char *) &out, 8, aes_key, aes_ivec, aes_ecount_buf, aes_num);
-	return out;
+#if     defined(AES_ASM) && !defined(I386_ONLY) &&      (  \
+        ((defined(__i386)       || defined(__i386__)    || \
+          defined(_M_IX86)) && defined(OPENSSL_IA32_SSE2))|| \
+        defined(__x86_64)       || defined(__x86_64__)  || \
+        defined(_M_AMD64)       || defined(_M_X64)      || \
+        defined(__INTEL__)                              )
+
+extern unsigned int OPENSSL_ia32cap_P[];
+
+# define AESNI_CAPABLE   (OPENSSL_ia32cap_P[1]&(1<<(57-32)))
+int aesni_set_encrypt_key(const unsigned char *userKey, int bits,
+                          AES_KEY *key);
+void aesni_ctr32_encrypt_blocks(const unsigned char *in,
+                                unsigned char *out,
+                                size_t blocks,
+                                const void *key, const unsigned char *ivec);
+
+# ifdef BSAES_ASM
+#  define BSAES_CAPABLE   (OPENSSL_ia32cap_P[1]&(1<<(41-32)))
+void bsaes_ctr32_encrypt_blocks(const unsigned char *in, unsigned char *out,
+                                size_t len, const AES_KEY *key,
+                                const unsigned char ivec[16]);
+# endif
+#endif
+
+static size_t rlwe_rand_reseed_interval = RLWE_RAND_RESEED_INTERVAL;
+
+/* Set the number of keystream bytes each sampler stream produces before it
+   is re-keyed from RAND_bytes.  0 re-keys on every refill.  Streams pick up
+   the new interval at their next reseed. */
+void RLWE_set_rand_reseed_interval(size_t nbytes) {
+	rlwe_rand_reseed_interval = nbytes;
+}
+
+static long rlwe_rand_pid(void) {
+#ifndef GETPID_IS_MEANINGLESS
+	return (long)getpid();
+#else
+	return 1;
+#endif
+}
+
+#ifdef RLWE_RAND_TLS
+static RLWE_RAND_TLS RLWE_RAND rlwe_rand_state;
+
+/* Return this thread's stream, for a new RANDOM_VARS scope.  Anything still
+   buffered is discarded if the stream is new or was inherited across fork(),
+   so parent and child never share keystream. */
+RLWE_RAND *rlwe_rand_get(void) {
+	if (rlwe_rand_state.pid != rlwe_rand_pid())
+		rlwe_rand_state.pos = RLWE_RAND_WORDS;
+	rlwe_rand_state.failed = 0;
+	return &rlwe_rand_state;
 }
+#endif
+
+/* Re-key the stream from RAND_bytes.  Returns 0 if that fails and the
+   stream has no key of this process's to carry on with. */
+static int rlwe_rand_reseed(RLWE_RAND *r) {
+	unsigned char key_bytes[16];
+
+	if (RAND_bytes(key_bytes, 16) <= 0) {
+		RINGLWEerr(RINGLWE_F_RANDOM64, RINGLWE_R_RANDOM_FAILED);
+		/* Keep the current key if there is one; never fall back to
+		   something weaker than RAND_bytes */
+		if (r->pid == rlwe_rand_pid()) {
+			r->remaining = rlwe_rand_reseed_interval;
+			return 1;
+		}
+		OPENSSL_cleanse(key_bytes, sizeof(key_bytes));
+		return 0;
+	}
 
+#ifdef AESNI_CAPABLE
+	if (AESNI_CAPABLE) {
+		aesni_set_encrypt_key(key_bytes, 128, &r->key);
+		r->stream = (ctr128_f) aesni_ctr32_encrypt_blocks;
+	}
+	else
+#endif
+	{
+		AES_set_encrypt_key(key_bytes, 128, &r->key);
+		r->stream = NULL;
+#ifdef BSAES_CAPABLE
+		if (BSAES_CAPABLE)
+			r->stream = (ctr128_f) bsaes_ctr32_encrypt_blocks;
+#endif
+	}
+	OPENSSL_cleanse(key_bytes, sizeof(key_bytes));
+
+	memset(r->ivec, 0, AES_BLOCK_SIZE);
+	memset(r->ecount_buf, 0, AES_BLOCK_SIZE);
+	r->remaining = rlwe_rand_reseed_interval;
+	r->pid = rlwe_rand_pid();
+	return 1;
+}
+
+/* Generate the next RLWE_RAND_WORDS words of keystream, or zeros, marking
+   the scope failed, if the stream cannot be seeded */
+void rlwe_rand_refill(RLWE_RAND *r) {
+	unsigned int num = 0;
+
+	if ((r->pid != rlwe_rand_pid()) || (r->remaining < sizeof(r->buf))) {
+		if (!rlwe_rand_reseed(r)) {
+			memset(r->buf, 0, sizeof(r->buf));
+			r->failed = 1;
+			r->pos = 0;
+			return;
+		}
+	}
+	r->remaining -= (r->remaining < sizeof(r->buf)) ? r->remaining : sizeof(r->buf);
+
+	/* Encrypt zeros in place; the buffer is a whole number of blocks, so
+	   the partial-block state in ecount_buf is never used */
+	memset(r->buf, 0, sizeof(r->buf));
+	if (r->stream != NULL)
+		CRYPTO_ctr128_encrypt_ctr32((unsigned char *)r->buf, (unsigned char *)r->buf,
+		                            sizeof(r->buf), &r->key, r->ivec, r->ecount_buf,
+		                            &num, r->stream);
+	else
+		CRYPTO_ctr128_encrypt((unsigned char *)r->buf, (unsigned char *)r->buf,
+		                      sizeof(r->buf), &r->key, r->ivec, r->ecount_buf,
+		                      &num, (block128_f) AES_encrypt);
+	r->pos = 0;
+}
@@ -1,23 +1,91 @@
 #include <openssl/rand.h>
 #include <openssl/aes.h>
+#include <openssl/modes.h>
 #include <inttypes.h>
+#include <string.h>
 
-#define RANDOM_VARS \
-	AES_KEY aes_key; \
-	unsigned char aes_key_bytes[16]; \
-	RAND_bytes(aes_key_bytes, 16); \
-	AES_set_encrypt_key(aes_key_bytes, 128, &aes_key); \
-	unsigned char aes_ivec[AES_BLOCK_SIZE]; \
-	memset(aes_ivec, 0, AES_BLOCK_SIZE); \
-	unsigned char aes_ecount_buf[AES_BLOCK_SIZE]; \
-	memset(aes_ecount_buf, 0, AES_BLOCK_SIZE); \
-	unsigned int aes_num = 0; \
-	unsigned char aes_in[AES_BLOCK_SIZE]; \
-	memset(aes_in, 0, AES_BLOCK_SIZE);
-#define RANDOM8   ((uint8_t) randomplease(&aes_key, aes_ivec, aes_ecount_buf, &aes_num, aes_in))
-#define RANDOM32 ((uint32_t) randomplease(&aes_key, aes_ivec, aes_ecount_buf, &aes_num, aes_in))
-#define RANDOM64 ((uint64_t) randomplease(&aes_key, aes_ivec, aes_ecount_buf, &aes_num, aes_in))
-
-uint64_t randomplease(AES_KEY *aes_key, unsigned char aes_ivec[AES_BLOCK_SIZE],
-                      unsigned char aes_ecount_buf[AES_BLOCK_SIZE],
-                      unsigned int *aes_num, unsigned char aes_in[AES_BLOCK_SIZE]);
+/* Buffered AES-128-CTR stream used by the samplers.
+
+   Keystream is produced RLWE_RAND_WORDS 64-bit words at a time and handed
+   out from the buffer; each word is zeroed as it is consumed.  The key is
+   drawn from RAND_bytes when the stream is first used, after every
+   reseed interval (see RLWE_set_rand_reseed_interval) and after fork().
+   If RAND_bytes fails where there is no key of this process's to keep,
+   the stream hands out zeros instead and RANDOM_OK is false for the rest
+   of the RANDOM_VARS scope; whatever was sampled must then be discarded. */
+
+#define RLWE_RAND_WORDS 128
+
+/* Default number of keystream bytes between reseeds */
+#define RLWE_RAND_RESEED_INTERVAL (64 * 1024)
+
+typedef struct rlwe_rand_st {
+  AES_KEY key;
+  ctr128_f stream;   /* bulk CTR routine for key, NULL for AES_encrypt */
+  unsigned char ivec[AES_BLOCK_SIZE];
+  unsigned char ecount_buf[AES_BLOCK_SIZE];
+  size_t remaining;  /* keystream bytes left before the next reseed */
+  long pid;          /* process that seeded the stream, 0 if unseeded */
+  int failed;        /* unseeded output handed out in this scope */
+  unsigned int pos;
+  uint64_t buf[RLWE_RAND_WORDS];
+} RLWE_RAND;
+
+/* One stream per thread where the compiler supports thread-local storage;
+   otherwise each RANDOM_VARS scope gets a fresh stream of its own. */
+#if !defined(OPENSSL_THREADS)
+# define RLWE_RAND_TLS
+#elif defined(_MSC_VER)
+# define RLWE_RAND_TLS __declspec(thread)
+#elif defined(__GNUC__)
+# define RLWE_RAND_TLS __thread
+#endif
+
+#ifdef RLWE_RAND_TLS
+RLWE_RAND *rlwe_rand_get(void);
+# define RANDOM_VARS \
+	RLWE_RAND *rlwe_rand = rlwe_rand_get();
+#else
+# define RANDOM_VARS \
+	RLWE_RAND rlwe_rand_local; \
+	RLWE_RAND *rlwe_rand = &rlwe_rand_local; \
+	rlwe_rand_local.pid = 0; \
+	rlwe_rand_local.failed = 0; \
+	rlwe_rand_local.pos = RLWE_RAND_WORDS;
+#endif
+
+/* Whether everything drawn in this scope came from a seeded stream */
+#define RANDOM_OK (!rlwe_rand->failed)
+
+/* Batch access: RANDOM_WORDS(w) points w at the buffered words and returns
+   how many there are (at least one); RANDOM_CONSUME(n) then discards the
+   first n of them once they have been used. */
+#define RANDOM_WORDS(w) rlwe_rand_words(rlwe_rand, &(w))
+#define RANDOM_CONSUME(n) rlwe_rand_consume(rlwe_rand, (n))
+
+#define RANDOM8   ((uint8_t) randomplease(rlwe_rand))
+#define RANDOM32 ((uint32_t) randomplease(rlwe_rand))
+#define RANDOM64 ((uint64_t) randomplease(rlwe_rand))
+
+void rlwe_rand_refill(RLWE_RAND *r);
+
+static inline uint64_t randomplease(RLWE_RAND *r) {
+	uint64_t out;
+	if (r->pos == RLWE_RAND_WORDS)
+		rlwe_rand_refill(r);
+	out = r->buf[r->pos];
+	r->buf[r->pos++] = 0;
+	return out;
+}
+
+static inline unsigned int rlwe_rand_words(RLWE_RAND *r, const uint64_t **w) {
+	if (r->pos == RLWE_RAND_WORDS)
+		rlwe_rand_refill(r);
+	*w = r->buf + r->pos;
+	return RLWE_RAND_WORDS - r->pos;
+}
+
+static inline void rlwe_rand_consume(RLWE_RAND *r, unsigned int n) {
+	memset(r->buf + r->pos, 0, n * sizeof(uint64_t));
+	r->pos += n;
+}
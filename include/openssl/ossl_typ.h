@@ -151,6 +151,8 @@ typedef struct rand_meth_st RAND_METHOD;
 typedef struct ecdh_method ECDH_METHOD;
 typedef struct ecdsa_method ECDSA_METHOD;
 
+typedef struct rlwe_method_st RLWE_METHOD;
+
 typedef struct x509_st X509;
 typedef struct X509_algor_st X509_ALGOR;
 typedef struct X509_crl_st X509_CRL;
@@ -890,6 +890,9 @@ int SRP_generate_client_master_secret(SSL *s, unsigned char *master_key);
 
 # define SSL_SESSION_CACHE_MAX_SIZE_DEFAULT      (1024*20)
 
+/* Number of RLWE parameter sets an SSL_CTX can keep key pools for */
+# define SSL_RLWE_MAX_POOLS                      4
+
 /*
  * This callback type is used inside SSL_CTX, SSL, and in the functions that
  * set them. It is used to override the generation of SSL/TLS session IDs in
@@ -1184,6 +1187,13 @@ struct ssl_ctx_st {
     unsigned char *tlsext_ellipticcurvelist;
 #   endif                       /* OPENSSL_NO_EC */
 #  endif
+#  ifndef OPENSSL_NO_RINGLWE
+    /* Pre-generated ephemeral RLWE key pairs, one pool per parameter set */
+    struct ssl_rlwe_pool_st *rlwe_pool[SSL_RLWE_MAX_POOLS];
+    /* RLWE parameter sets in order of preference, as TLS identifiers */
+    size_t tlsext_rlweparamslist_length;
+    unsigned char *tlsext_rlweparamslist;
+#  endif
 };
 
 # endif
@@ -1688,6 +1698,25 @@ struct ssl_st {
     unsigned char *alpn_client_proto_list;
     unsigned alpn_client_proto_list_len;
 #  endif                        /* OPENSSL_NO_TLSEXT */
+#  ifndef OPENSSL_NO_RINGLWE
+    /*
+     * A precomputed RLWE encapsulation to use in the next ClientKeyExchange
+     * (or ServerKeyExchange, see SSL_CTX_set_rlwe_client_key) if its
+     * parameter set is negotiated.
+     */
+    struct rlwe_ticket_st *rlwe_ticket;
+    /*
+     * RLWE parameter sets in order of preference, as TLS identifiers: our
+     * own, and for a server those the client offered.
+     */
+    size_t tlsext_rlweparamslist_length;
+    unsigned char *tlsext_rlweparamslist;
+    size_t tlsext_peer_rlweparamslist_length;
+    unsigned char *tlsext_peer_rlweparamslist;
+    /* For a server, the encoded RLWE key from the client's ClientHello */
+    size_t tlsext_peer_rlwepub_length;
+    unsigned char *tlsext_peer_rlwepub;
+#  endif
 };
 
 # endif
@@ -1981,6 +2010,10 @@ DECLARE_PEM_rw(SSL_SESSION, SSL_SESSION)
 # define SSL_CTRL_CHECK_PROTO_VERSION            119
 # define DTLS_CTRL_SET_LINK_MTU                  120
 # define DTLS_CTRL_GET_LINK_MIN_MTU              121
+# define SSL_CTRL_SET_RLWE_CLIENT_KEY            122
+# define SSL_CTRL_SET_RLWE_COMPRESSION           123
+# define SSL_CTRL_SET_TMP_RLWE                   124
+# define SSL_CTRL_SET_RLWE_PARAMS                125
 # define SSL_CERT_SET_FIRST                      1
 # define SSL_CERT_SET_NEXT                       2
 # define SSL_CERT_SET_SERVER                     3
@@ -2014,6 +2047,10 @@ DECLARE_PEM_rw(SSL_SESSION, SSL_SESSION)
         SSL_ctrl(ssl,SSL_CTRL_SET_TMP_DH,0,(char *)dh)
 # define SSL_set_tmp_ecdh(ssl,ecdh) \
         SSL_ctrl(ssl,SSL_CTRL_SET_TMP_ECDH,0,(char *)ecdh)
+# define SSL_CTX_set_tmp_rlwe(ctx,rlwe) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_SET_TMP_RLWE,0,(char *)rlwe)
+# define SSL_set_tmp_rlwe(ssl,rlwe) \
+        SSL_ctrl(ssl,SSL_CTRL_SET_TMP_RLWE,0,(char *)rlwe)
 # define SSL_CTX_add_extra_chain_cert(ctx,x509) \
         SSL_CTX_ctrl(ctx,SSL_CTRL_EXTRA_CHAIN_CERT,0,(char *)x509)
 # define SSL_CTX_get_extra_chain_certs(ctx,px509) \
@@ -2086,6 +2123,18 @@ DECLARE_PEM_rw(SSL_SESSION, SSL_SESSION)
         SSL_ctrl(ctx,SSL_CTRL_SET_CURVES_LIST,0,(char *)s)
 # define SSL_get_shared_curve(s, n) \
         SSL_ctrl(s,SSL_CTRL_GET_SHARED_CURVE,n,NULL)
+# define SSL_CTX_set1_rlwe_params(ctx, plist, plistlen) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_SET_RLWE_PARAMS,plistlen,(char *)plist)
+# define SSL_set1_rlwe_params(ctx, plist, plistlen) \
+        SSL_ctrl(ctx,SSL_CTRL_SET_RLWE_PARAMS,plistlen,(char *)plist)
+# define SSL_CTX_set_rlwe_client_key(ctx, onoff) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_SET_RLWE_CLIENT_KEY,onoff,NULL)
+# define SSL_set_rlwe_client_key(s, onoff) \
+        SSL_ctrl(s,SSL_CTRL_SET_RLWE_CLIENT_KEY,onoff,NULL)
+# define SSL_CTX_set_rlwe_compression(ctx, onoff) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_SET_RLWE_COMPRESSION,onoff,NULL)
+# define SSL_set_rlwe_compression(s, onoff) \
+        SSL_ctrl(s,SSL_CTRL_SET_RLWE_COMPRESSION,onoff,NULL)
 # define SSL_CTX_set_ecdh_auto(ctx, onoff) \
         SSL_CTX_ctrl(ctx,SSL_CTRL_SET_ECDH_AUTO,onoff,NULL)
 # define SSL_set_ecdh_auto(s, onoff) \
@@ -2535,6 +2584,20 @@ void SSL_set_tmp_ecdh_callback(SSL *ssl,
                                                 int keylength));
 # endif
 
+# ifndef OPENSSL_NO_RINGLWE
+int SSL_CTX_set_rlwe_pool(SSL_CTX *ctx, int nid, unsigned int depth,
+                          unsigned int low_water);
+int SSL_CTX_rlwe_pool_needs_refill(SSL_CTX *ctx);
+int SSL_CTX_rlwe_pool_refill(SSL_CTX *ctx);
+int SSL_CTX_get_rlwe_pool_stats(SSL_CTX *ctx, int nid, unsigned long *hits,
+                                unsigned long *misses,
+                                unsigned int *available);
+void SSL_set0_rlwe_ticket(SSL *s, RLWE_TICKET *ticket);
+int SSL_CTX_set_tmp_rlwe_lifetime(SSL_CTX *ctx, long seconds,
+                                  unsigned long uses);
+int SSL_set_tmp_rlwe_lifetime(SSL *s, long seconds, unsigned long uses);
+# endif
+
 # ifndef OPENSSL_NO_COMP
 const COMP_METHOD *SSL_get_current_compression(SSL *s);
 const COMP_METHOD *SSL_get_current_expansion(SSL *s);
@@ -2748,9 +2811,11 @@ void ERR_load_SSL_strings(void);
 # define SSL_F_SSL_CTX_CHECK_PRIVATE_KEY                  168
 # define SSL_F_SSL_CTX_MAKE_PROFILES                      309
 # define SSL_F_SSL_CTX_NEW                                169
+# define SSL_F_SSL_CTX_RLWE_POOL_REFILL                   390
 # define SSL_F_SSL_CTX_SET_CIPHER_LIST                    269
 # define SSL_F_SSL_CTX_SET_CLIENT_CERT_ENGINE             290
 # define SSL_F_SSL_CTX_SET_PURPOSE                        226
+# define SSL_F_SSL_CTX_SET_RLWE_POOL                      389
 # define SSL_F_SSL_CTX_SET_SESSION_ID_CONTEXT             219
 # define SSL_F_SSL_CTX_SET_SSL_VERSION                    170
 # define SSL_F_SSL_CTX_SET_TRUST                          229
@@ -2871,6 +2936,7 @@ void ERR_load_SSL_strings(void);
 # define SSL_R_BAD_PSK_IDENTITY_HINT_LENGTH               316
 # define SSL_R_BAD_RESPONSE_ARGUMENT                      117
 # define SSL_R_BAD_RLWE_PUB                               372
+# define SSL_R_BAD_RLWE_REC                               397
 # define SSL_R_BAD_RSA_DECRYPT                            118
 # define SSL_R_BAD_RSA_ENCRYPT                            119
 # define SSL_R_BAD_RSA_E_LENGTH                           120
@@ -3157,6 +3223,7 @@ void ERR_load_SSL_strings(void);
 # define SSL_R_WRONG_CIPHER_RETURNED                      261
 # define SSL_R_WRONG_CURVE                                378
 # define SSL_R_WRONG_MESSAGE_TYPE                         262
+# define SSL_R_WRONG_RLWE_PARAMETERS                      396
 # define SSL_R_WRONG_NUMBER_OF_KEY_BITS                   263
 # define SSL_R_WRONG_SIGNATURE_LENGTH                     264
 # define SSL_R_WRONG_SIGNATURE_SIZE                       265
@@ -1387,7 +1387,9 @@ int ssl3_get_key_exchange(SSL *s)
 #endif
 #ifndef OPENSSL_NO_RINGLWE
     RLWE_PUB *srvr_rlwepub = NULL;
+    RLWE_REC *srvr_rlwerec = NULL;
     int encoded_rlwepub_len = 0;
+    int encoded_rlwerec_len = 0;
 #endif
 
     EVP_MD_CTX_init(&md_ctx);
@@ -1810,9 +1812,11 @@ int ssl3_get_key_exchange(SSL *s)
 	p += 2;
 	n -= 2;
 
-	/* Decode public key */
+	/* Decode public key, compressed only if we agreed to that */
 	if ((encoded_rlwepub_len >= n) ||
-	    (o2i_RLWE_PUB(&srvr_rlwepub, p, encoded_rlwepub_len) == NULL)) {
+	    ((s->s3->tmp.rlwe_compressed
+	      ? o2i_RLWE_PUB_compressed(&srvr_rlwepub, p, encoded_rlwepub_len)
+	      : o2i_RLWE_PUB(&srvr_rlwepub, p, encoded_rlwepub_len)) == NULL)) {
 	  al=SSL_AD_DECODE_ERROR;
 	  SSLerr(SSL_F_SSL3_GET_KEY_EXCHANGE,SSL_R_BAD_RLWE_PUB);
 	  goto f_err;
@@ -1821,10 +1825,42 @@ int ssl3_get_key_exchange(SSL *s)
 	  SSLerr(SSL_F_SSL3_GET_KEY_EXCHANGE,SSL_R_BAD_RLWE_PUB);
 	  goto err;
 	}
+	/* The server must pick a parameter set we offered, or that of
+	 * our ClientHello key if it encapsulated against it */
+	if (s->s3->tmp.rlwe_client_key
+	    ? RLWE_PUB_get_nid(srvr_rlwepub) != RLWE_PAIR_get_nid(s->s3->tmp.rlwe)
+	    : !tls1_check_rlwe_nid(s, RLWE_PUB_get_nid(srvr_rlwepub), alg_k)) {
+	  al=SSL_AD_ILLEGAL_PARAMETER;
+	  SSLerr(SSL_F_SSL3_GET_KEY_EXCHANGE,SSL_R_WRONG_RLWE_PARAMETERS);
+	  goto f_err;
+	}
 	
 	n-=encoded_rlwepub_len;
 	p+=encoded_rlwepub_len;
 	param_len = 2 + encoded_rlwepub_len;
+
+	/* In that case the reconciliation data follows */
+	if (s->s3->tmp.rlwe_client_key) {
+	  if (n < 2) {
+	    al=SSL_AD_DECODE_ERROR;
+	    SSLerr(SSL_F_SSL3_GET_KEY_EXCHANGE,SSL_R_LENGTH_TOO_SHORT);
+	    goto f_err;
+	  }
+	  encoded_rlwerec_len = (p[0] << 8) | p[1];
+	  p += 2;
+	  n -= 2;
+	  if ((encoded_rlwerec_len > n) ||
+	      (o2i_RLWE_REC(&srvr_rlwerec, p, encoded_rlwerec_len) == NULL)) {
+	    al=SSL_AD_DECODE_ERROR;
+	    SSLerr(SSL_F_SSL3_GET_KEY_EXCHANGE,SSL_R_BAD_RLWE_REC);
+	    goto f_err;
+	  }
+	  n-=encoded_rlwerec_len;
+	  p+=encoded_rlwerec_len;
+	  param_len += 2 + encoded_rlwerec_len;
+	  s->session->sess_cert->peer_rlwerec_tmp=srvr_rlwerec;
+	  srvr_rlwerec = NULL;
+	}
 	
 	if (0) ;
 #ifndef OPENSSL_NO_RSA
@@ -1946,6 +1982,12 @@ int ssl3_get_key_exchange(SSL *s)
 		SSLerr(SSL_F_SSL3_GET_KEY_EXCHANGE,SSL_R_BAD_RLWE_PUB);
 		goto err;
 	      }
+	    if (!tls1_check_rlwe_nid(s, RLWE_PUB_get_nid(srvr_rlwepub), alg_k))
+	      {
+		al=SSL_AD_ILLEGAL_PARAMETER;
+		SSLerr(SSL_F_SSL3_GET_KEY_EXCHANGE,SSL_R_WRONG_RLWE_PARAMETERS);
+		goto f_err;
+	      }
 	    n-=encoded_rlwepub_len;
 	    p+=encoded_rlwepub_len;
 	    param_len += 2 + encoded_rlwepub_len;
@@ -2122,6 +2164,7 @@ int ssl3_get_key_exchange(SSL *s)
 #endif
 #ifndef OPENSSL_NO_RINGLWE
     RLWE_PUB_free(srvr_rlwepub);
+    RLWE_REC_free(srvr_rlwerec);
 #endif
     EVP_MD_CTX_cleanup(&md_ctx);
     s->state = SSL_ST_ERR;
@@ -2553,14 +2596,12 @@ int ssl3_send_client_key_exchange(SSL *s)
     BN_CTX *bn_ctx = NULL;
 #endif
 #ifndef OPENSSL_NO_RINGLWE
-    RLWE_PAIR *clnt_rlwe = NULL;
+    RLWE_TICKET *clnt_rlwe = NULL;
     RLWE_REC *clnt_rlwerec = NULL;
     const RLWE_PUB *srvr_rlwepub = NULL;
-    unsigned char *encoded_rlwepub = NULL;
+    const unsigned char *encoded_rlwepub = NULL;
     int encoded_rlwepub_len = 0;
-    unsigned char *encoded_rlwerec = NULL;
     int encoded_rlwerec_len = 0;
-    RLWE_CTX * rlwe_ctx = NULL;
 #endif
 
     if (s->state == SSL3_ST_CW_KEY_EXCH_A) {
@@ -2568,6 +2609,21 @@ int ssl3_send_client_key_exchange(SSL *s)
 
         alg_k = s->s3->tmp.new_cipher->algorithm_mkey;
 
+#ifndef OPENSSL_NO_RINGLWE
+        /*
+         * RLWE keys and reconciliation data are encoded straight into
+         * init_buf, bounded by its length, which is only that of the last
+         * message read (short with an ECDSA certificate)
+         */
+        if (alg_k & (SSL_kRLWE | SSL_kRLWE_PRIME)) {
+            if (!BUF_MEM_grow_clean(s->init_buf, SSL3_RT_MAX_PLAIN_LENGTH)) {
+                SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, ERR_R_BUF_LIB);
+                goto err;
+            }
+            p = ssl_handshake_start(s);
+        }
+#endif
+
         /* Fool emacs indentation */
         if (0) {
         }
@@ -2987,21 +3043,12 @@ int ssl3_send_client_key_exchange(SSL *s)
 		goto err;
 	      }
 	    
-	      if ((rlwe_ctx = RLWE_CTX_new(rlwe_nid(alg_k))) == NULL) {
-		SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE,ERR_R_MALLOC_FAILURE);
-		goto err;
-	      }
-	      if ((clnt_rlwe=RLWE_PAIR_new(rlwe_ctx)) == NULL) {
-		SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE,ERR_R_MALLOC_FAILURE);
-		goto err;
-	      }
-	      clnt_rlwerec = NULL;
-	      	      
-	      /* Generate a new RLWE key pair */
-	      if (!(RLWE_PAIR_generate_key(clnt_rlwe))) {
+	      /* Use the precomputed encapsulation, or make one now */
+	      if ((clnt_rlwe = ssl_rlwe_ticket_get(s, RLWE_PUB_get_nid(srvr_rlwepub))) == NULL) {
 		SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
 		goto err;
 	      }
+	      clnt_rlwerec = NULL;
 	      
 	      /* use the 'pprime' buffer for the RLWE shared key, but
 	       * make sure to clear it out afterwards
@@ -3013,7 +3060,7 @@ int ssl3_send_client_key_exchange(SSL *s)
 	      }
 	      
 	      /* Compute RLWE shared key */
-	      nprime = RINGLWE_compute_key_bob(pprime, 1024, &clnt_rlwerec, srvr_rlwepub, RLWE_PAIR_get_publickey(clnt_rlwe), NULL);
+	      nprime = RINGLWE_compute_key_bob_ticket(pprime, 1024, &clnt_rlwerec, srvr_rlwepub, clnt_rlwe, NULL);
 	      if (nprime <= 0) {
 		SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
 		goto err;
@@ -3087,9 +3134,9 @@ int ssl3_send_client_key_exchange(SSL *s)
 #ifdef OPENSSL_HYBRID_RLWE_ECDHE
 	    if (alg_k & (SSL_kRLWE | SSL_kRLWE_PRIME)) {
 
-	      /* Encode the public key and reconciliation data */
-	      encoded_rlwepub_len = i2o_RLWE_PUB(RLWE_PAIR_get_publickey(clnt_rlwe), &encoded_rlwepub);
-	      encoded_rlwerec_len = i2o_RLWE_REC(clnt_rlwerec, &encoded_rlwerec);
+	      /* Write the public key, pre-encoded by the ticket, and encode
+	       * the reconciliation data straight into the message */
+	      encoded_rlwepub_len = RLWE_TICKET_get_encoded_publickey(clnt_rlwe, &encoded_rlwepub);
 	      
 	      p[0] = (encoded_rlwepub_len >> 8) & 0xFF;
 	      p[1] =  encoded_rlwepub_len       & 0xFF;
@@ -3097,19 +3144,21 @@ int ssl3_send_client_key_exchange(SSL *s)
 	      memcpy((unsigned char *)p, encoded_rlwepub, encoded_rlwepub_len);
 	      p += encoded_rlwepub_len;
 	      
+	      encoded_rlwerec_len = RLWE_REC_encode(clnt_rlwerec, p + 2,
+	      					(unsigned char *)s->init_buf->data
+	      					+ s->init_buf->length - (p + 2));
+	      if (encoded_rlwerec_len == 0) {
+	          SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
+	          goto err;
+	      }
 	      p[0] = (encoded_rlwerec_len >> 8) & 0xFF;
 	      p[1] =  encoded_rlwerec_len       & 0xFF;
-	      p += 2;
-	      memcpy((unsigned char *)p, encoded_rlwerec, encoded_rlwerec_len);
-	      p += encoded_rlwerec_len;
+	      p += 2 + encoded_rlwerec_len;
 	      
 	      n += 4 + encoded_rlwepub_len + encoded_rlwerec_len;
 	      
 	      /* Free allocated memory */
-	      RLWE_CTX_free(rlwe_ctx);
-	      OPENSSL_free(encoded_rlwepub);
-	      OPENSSL_free(encoded_rlwerec);
-	      RLWE_PAIR_free(clnt_rlwe);
+	      RLWE_TICKET_free(clnt_rlwe);
 	      RLWE_REC_free(clnt_rlwerec);
 	    }
 #endif
@@ -3124,36 +3173,54 @@ int ssl3_send_client_key_exchange(SSL *s)
         }
 #endif                          /* !OPENSSL_NO_ECDH */
 #ifndef OPENSSL_NO_RINGLWE
-	else if ((alg_k & (SSL_kRLWE | SSL_kRLWE_PRIME)) && !(alg_k & SSL_kEECDH)) {
-	  srvr_rlwepub = s->session->sess_cert->peer_rlwepub_tmp;
-	  
-	  if (srvr_rlwepub == NULL) {
+	else if (s->s3->tmp.rlwe_client_key) {
+	  /* The server encapsulated against our ClientHello key: finish
+	   * the exchange as Alice and send an empty message */
+	  if (s->s3->tmp.rlwe == NULL ||
+	      s->session->sess_cert->peer_rlwepub_tmp == NULL ||
+	      s->session->sess_cert->peer_rlwerec_tmp == NULL) {
 	    SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE,
 		   ERR_R_INTERNAL_ERROR);
 	    goto err;
 	  }
-	  if ((rlwe_ctx = RLWE_CTX_new(rlwe_nid(alg_k))) == NULL) {
-	    SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE,ERR_R_MALLOC_FAILURE);
+	  n = RINGLWE_compute_key_alice(p, 1024,
+					s->session->sess_cert->peer_rlwepub_tmp,
+					s->session->sess_cert->peer_rlwerec_tmp,
+					s->s3->tmp.rlwe, NULL);
+	  if (n <= 0) {
+	    SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
 	    goto err;
 	  }
-	  if ((clnt_rlwe=RLWE_PAIR_new(rlwe_ctx)) == NULL) {
-	    SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE,ERR_R_MALLOC_FAILURE);
+	  s->session->master_key_length = s->method->ssl3_enc \
+	    -> generate_master_secret(s,
+				      s->session->master_key,
+				      p, n);
+	  OPENSSL_cleanse(p, n);
+	  RLWE_PAIR_free(s->s3->tmp.rlwe);
+	  s->s3->tmp.rlwe = NULL;
+	  n = 0;
+	}
+	else if ((alg_k & (SSL_kRLWE | SSL_kRLWE_PRIME)) && !(alg_k & SSL_kEECDH)) {
+	  srvr_rlwepub = s->session->sess_cert->peer_rlwepub_tmp;
+	  
+	  if (srvr_rlwepub == NULL) {
+	    SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE,
+		   ERR_R_INTERNAL_ERROR);
 	    goto err;
 	  }
-	  clnt_rlwerec = NULL;
-	  	    
-	    /* Generate a new RLWE key pair */
-	  if (!(RLWE_PAIR_generate_key(clnt_rlwe))) {
+	  /* Use the precomputed encapsulation, or make one now */
+	  if ((clnt_rlwe = ssl_rlwe_ticket_get(s, RLWE_PUB_get_nid(srvr_rlwepub))) == NULL) {
 	    SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
 	    goto err;
 	  }
+	  clnt_rlwerec = NULL;
 	  
 	   /* use the 'p' output buffer for the RLWE shared key, but
 	    * make sure to clear it out afterwards
 	    */
 	  
 	  /* Compute RLWE shared key */
-	    n = RINGLWE_compute_key_bob(p, 1024, &clnt_rlwerec, srvr_rlwepub, RLWE_PAIR_get_publickey(clnt_rlwe), NULL);
+	    n = RINGLWE_compute_key_bob_ticket(p, 1024, &clnt_rlwerec, srvr_rlwepub, clnt_rlwe, NULL);
 	    if (n <= 0) {
 	      SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
 	      goto err;
@@ -3175,29 +3242,41 @@ int ssl3_send_client_key_exchange(SSL *s)
 
 	    memset(p, 0, n); /* clean up */
 	    
-	    /* Encode the public key and reconciliation data */
-	    encoded_rlwepub_len = i2o_RLWE_PUB(RLWE_PAIR_get_publickey(clnt_rlwe), &encoded_rlwepub);
-	    encoded_rlwerec_len = i2o_RLWE_REC(clnt_rlwerec, &encoded_rlwerec);
+	    /* Write the public key, pre-encoded by the ticket unless it is
+	     * to be compressed, and encode the reconciliation data straight
+	     * into the message */
+	    if (ssl_rlwe_compressed_bits(s, RLWE_TICKET_get_nid(clnt_rlwe)) == 0) {
+	        encoded_rlwepub_len = RLWE_TICKET_get_encoded_publickey(clnt_rlwe, &encoded_rlwepub);
+	        memcpy((unsigned char *)p + 2, encoded_rlwepub, encoded_rlwepub_len);
+	    } else {
+	        encoded_rlwepub_len = ssl_rlwe_pub_encode(s, RLWE_TICKET_get_publickey(clnt_rlwe), p + 2,
+	    					  (unsigned char *)s->init_buf->data
+	    					  + s->init_buf->length - (p + 2));
+	        if (encoded_rlwepub_len == 0) {
+	            SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
+	            goto err;
+	        }
+	    }
 	    
 	    p[0] = (encoded_rlwepub_len >> 8) & 0xFF;
 	    p[1] =  encoded_rlwepub_len       & 0xFF;
-	    p += 2;
-	    memcpy((unsigned char *)p, encoded_rlwepub, encoded_rlwepub_len);
-	    p += encoded_rlwepub_len;
+	    p += 2 + encoded_rlwepub_len;
 	    
+	    encoded_rlwerec_len = RLWE_REC_encode(clnt_rlwerec, p + 2,
+	    					(unsigned char *)s->init_buf->data
+	    					+ s->init_buf->length - (p + 2));
+	    if (encoded_rlwerec_len == 0) {
+	        SSLerr(SSL_F_SSL3_SEND_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
+	        goto err;
+	    }
 	    p[0] = (encoded_rlwerec_len >> 8) & 0xFF;
 	    p[1] =  encoded_rlwerec_len       & 0xFF;
-	    p += 2;
-	    memcpy((unsigned char *)p, encoded_rlwerec, encoded_rlwerec_len);
-	    p += encoded_rlwerec_len;
+	    p += 2 + encoded_rlwerec_len;
 	    
 	    n = 4 + encoded_rlwepub_len + encoded_rlwerec_len;
 	    
 	    /* Free allocated memory */
-	    RLWE_CTX_free(rlwe_ctx);
-	    OPENSSL_free(encoded_rlwepub);
-	    OPENSSL_free(encoded_rlwerec);
-	    RLWE_PAIR_free(clnt_rlwe);
+	    RLWE_TICKET_free(clnt_rlwe);
 	    RLWE_REC_free(clnt_rlwerec);
 	  }
 #endif /* !OPENSSL_NO_RINGLWE */
@@ -3472,10 +3551,7 @@ int ssl3_send_client_key_exchange(SSL *s)
     EVP_PKEY_free(srvr_pub_pkey);
 #endif
 #ifndef OPENSSL_NO_RINGLWE
-    RLWE_CTX_free(rlwe_ctx);
-    OPENSSL_free(encoded_rlwepub);
-    OPENSSL_free(encoded_rlwerec);
-    RLWE_PAIR_free(clnt_rlwe);
+    RLWE_TICKET_free(clnt_rlwe);
     RLWE_REC_free(clnt_rlwerec);
 #endif
     s->state = SSL_ST_ERR;
@@ -3406,6 +3406,38 @@ long ssl3_ctrl(SSL *s, int cmd, long larg, void *parg)
         }
         break;
 #endif                          /* !OPENSSL_NO_ECDH */
+#ifndef OPENSSL_NO_RINGLWE
+    case SSL_CTRL_SET_TMP_RLWE:
+        {
+            SSL_RLWE_TMP *rlwe;
+
+            if (parg == NULL) {
+                SSLerr(SSL_F_SSL3_CTRL, ERR_R_PASSED_NULL_PARAMETER);
+                return (ret);
+            }
+            if ((rlwe = ssl_rlwe_tmp_new((RLWE_PAIR *)parg)) == NULL) {
+                SSLerr(SSL_F_SSL3_CTRL, ERR_R_RLWE_LIB);
+                return (ret);
+            }
+            if (s->cert->rlwe_tmp != NULL)
+                ssl_rlwe_tmp_free(s->cert->rlwe_tmp);
+            s->cert->rlwe_tmp = rlwe;
+            ret = 1;
+        }
+        break;
+# ifndef OPENSSL_NO_TLSEXT
+    case SSL_CTRL_SET_RLWE_PARAMS:
+        return tls1_set_rlwe_params(&s->tlsext_rlweparamslist,
+                                    &s->tlsext_rlweparamslist_length,
+                                    parg, larg);
+    case SSL_CTRL_SET_RLWE_CLIENT_KEY:
+        s->cert->rlwe_client_key = larg;
+        return 1;
+    case SSL_CTRL_SET_RLWE_COMPRESSION:
+        s->cert->rlwe_compressed = larg;
+        return 1;
+# endif
+#endif
 #ifndef OPENSSL_NO_TLSEXT
     case SSL_CTRL_SET_TLSEXT_HOSTNAME:
         if (larg == TLSEXT_NAMETYPE_host_name) {
@@ -3914,6 +3946,39 @@ long ssl3_ctx_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
         }
         break;
 #endif                          /* !OPENSSL_NO_ECDH */
+#ifndef OPENSSL_NO_RINGLWE
+    case SSL_CTRL_SET_TMP_RLWE:
+        {
+            SSL_RLWE_TMP *rlwe;
+
+            if (parg == NULL) {
+                SSLerr(SSL_F_SSL3_CTX_CTRL, ERR_R_PASSED_NULL_PARAMETER);
+                return 0;
+            }
+            /* The pair is shared, not copied: see ssl_rlwe.c */
+            if ((rlwe = ssl_rlwe_tmp_new((RLWE_PAIR *)parg)) == NULL) {
+                SSLerr(SSL_F_SSL3_CTX_CTRL, ERR_R_RLWE_LIB);
+                return 0;
+            }
+            if (cert->rlwe_tmp != NULL)
+                ssl_rlwe_tmp_free(cert->rlwe_tmp);
+            cert->rlwe_tmp = rlwe;
+            return 1;
+        }
+        /* break; */
+# ifndef OPENSSL_NO_TLSEXT
+    case SSL_CTRL_SET_RLWE_PARAMS:
+        return tls1_set_rlwe_params(&ctx->tlsext_rlweparamslist,
+                                    &ctx->tlsext_rlweparamslist_length,
+                                    parg, larg);
+    case SSL_CTRL_SET_RLWE_CLIENT_KEY:
+        ctx->cert->rlwe_client_key = larg;
+        return 1;
+    case SSL_CTRL_SET_RLWE_COMPRESSION:
+        ctx->cert->rlwe_compressed = larg;
+        return 1;
+# endif
+#endif
 #ifndef OPENSSL_NO_TLSEXT
     case SSL_CTRL_SET_TLSEXT_SERVERNAME_ARG:
         ctx->tlsext_servername_arg = parg;
@@ -4301,6 +4366,11 @@ SSL_CIPHER *ssl3_choose_cipher(SSL *s, STACK_OF(SSL_CIPHER) *clnt,
             ok = ok && tls1_check_ec_tmp_key(s, c->id);
 #  endif                        /* OPENSSL_NO_ECDH */
 # endif                         /* OPENSSL_NO_EC */
+# ifndef OPENSSL_NO_RINGLWE
+        /* and that there is an RLWE parameter set in common */
+        if (alg_k & (SSL_kRLWE | SSL_kRLWE_PRIME))
+            ok = ok && tls1_rlwe_nid(s, alg_k) != NID_undef;
+# endif
 #endif                          /* OPENSSL_NO_TLSEXT */
 
         if (!ok)
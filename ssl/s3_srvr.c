@@ -1606,10 +1606,11 @@ int ssl3_send_server_key_exchange(SSL *s)
     BN_CTX *bn_ctx = NULL;
 #endif
 #ifndef OPENSSL_NO_RINGLWE
-    RLWE_PAIR *rlwe=NULL, *rlwep=NULL;
+    RLWE_PAIR *rlwe=NULL;
     unsigned char *encoded_rlwepub = NULL;
     int encoded_rlwepub_len = 0;
     RLWE_CTX *rlwe_ctx = NULL; 
+    int rlwe_param_nid;
 #endif
     EVP_PKEY *pkey;
     const EVP_MD *md = NULL;
@@ -1840,52 +1841,47 @@ int ssl3_send_server_key_exchange(SSL *s)
 
 #ifdef OPENSSL_HYBRID_RLWE_ECDHE
 	    if (type & (SSL_kRLWE | SSL_kRLWE_PRIME)) {
-		rlwep=cert->rlwe_tmp;
-		if ((rlwe_ctx = RLWE_CTX_new(rlwe_nid(type))) == NULL) {
-		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_MALLOC_FAILURE);
-		    goto err;
-		    }
-		if (rlwep == NULL) {
-		    rlwep=RLWE_PAIR_new(rlwe_ctx);
-		}
-		if (rlwep == NULL) {
-		    al=SSL_AD_HANDSHAKE_FAILURE;
-		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,SSL_R_MISSING_TMP_ECDH_KEY);
-		    goto f_err;
-		}
-		
 		if (s->s3->tmp.rlwe != NULL) {
 		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE, ERR_R_INTERNAL_ERROR);
 		    goto err;
 		}
-		
-		/* Duplicate the RLWE_PAIR structure. */
-		if (rlwep == NULL) {
-		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
+		/* The parameter set agreed with the client */
+		if ((rlwe_param_nid = tls1_rlwe_nid(s, type)) == NID_undef) {
+		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE, ERR_R_INTERNAL_ERROR);
 		    goto err;
 		}
-		if ((rlwe = RLWE_PAIR_dup(rlwep)) == NULL) {
-		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
-		    goto err;
+		/* Use the server's shared key if it has one for this
+		 * parameter set, else a pre-generated key pair if it keeps
+		 * a pool, else generate a key pair now */
+		if ((rlwe = ssl_rlwe_tmp_get(s, rlwe_param_nid)) == NULL &&
+		    !ssl_rlwe_pool_get(s->ctx, rlwe_param_nid, &rlwe,
+				       &encoded_rlwepub, &encoded_rlwepub_len)) {
+		    if ((rlwe_ctx = RLWE_CTX_new(rlwe_param_nid)) == NULL) {
+			SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_MALLOC_FAILURE);
+			goto err;
+		    }
+		    if ((rlwe = RLWE_PAIR_new(rlwe_ctx)) == NULL) {
+			SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
+			goto err;
+		    }
+		    RLWE_CTX_free(rlwe_ctx); rlwe_ctx = NULL;
+		    if (!RLWE_PAIR_generate_key(rlwe)) {
+			RLWE_PAIR_free(rlwe);
+			SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
+			goto err;
+		    }
 		}
-		
 		s->s3->tmp.rlwe=rlwe;
-		if ((RLWE_PAIR_get_publickey(rlwe) == NULL) ||
-		    !RLWE_PAIR_has_privatekey(rlwe)) {
-		    if(!RLWE_PAIR_generate_key(rlwe)) {
+
+		/* Pooled keys come encoded; others are encoded straight
+		 * into the message below */
+		if (encoded_rlwepub == NULL) {
+		    encoded_rlwepub_len = RLWE_PUB_encode(RLWE_PAIR_get_publickey(rlwe), NULL, 0);
+		    if (encoded_rlwepub_len == 0) {
 			SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
 			goto err;
 		    }
 		}
-		RLWE_CTX_free(rlwe_ctx); rlwe_ctx = NULL;
-		if (rlwep != NULL)
-		    RLWE_PAIR_free(rlwep);
-		encoded_rlwepub_len = i2o_RLWE_PUB(RLWE_PAIR_get_publickey(rlwe), &encoded_rlwepub);
-		
-		if (encoded_rlwepub_len == 0) {
-		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
-		    goto err;
-		}
 		
 		n += 2 + encoded_rlwepub_len;
 	    }
@@ -1895,53 +1891,66 @@ int ssl3_send_server_key_exchange(SSL *s)
 #endif          /*  OPENSSL_ECDH */
 
 #ifndef OPENSSL_NO_RINGLWE
-	    if ((type & (SSL_kRLWE | SSL_kRLWE_PRIME)) && !(type & SSL_kEECDH)) {
-		rlwep=cert->rlwe_tmp;
-		if ((rlwe_ctx = RLWE_CTX_new(rlwe_nid(type))) == NULL) {
-		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_MALLOC_FAILURE);
+	    if (s->s3->tmp.rlwe_client_key) {
+		/* Encapsulate against the client's ClientHello key; this
+		 * fixes the master secret, and ClientKeyExchange is empty */
+		if (!ssl_rlwe_encapsulate(s, &encoded_rlwepub, &encoded_rlwepub_len)) {
+		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
 		    goto err;
 		}
-		if (rlwep == NULL) {
-		    rlwep=RLWE_PAIR_new(rlwe_ctx);
-		}
-		if (rlwep == NULL) {
-		    al=SSL_AD_HANDSHAKE_FAILURE;
-		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,SSL_R_MISSING_TMP_ECDH_KEY);
-		    goto f_err;
-		}
-		    
+		n = encoded_rlwepub_len;
+		r[0]=NULL;
+		r[1]=NULL;
+		r[2]=NULL;
+		r[3]=NULL;
+	    }
+	    else
+	    if ((type & (SSL_kRLWE | SSL_kRLWE_PRIME)) && !(type & SSL_kEECDH)) {
 		if (s->s3->tmp.rlwe != NULL) {
 		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE, ERR_R_INTERNAL_ERROR);
 		    goto err;
 		}
-		    
-		/* Duplicate the RLWE_PAIR structure. */
-		if (rlwep == NULL) {
-		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
-		    goto err;
-		}
-		if ((rlwe = RLWE_PAIR_dup(rlwep)) == NULL) {
-		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
+		/* The parameter set agreed with the client */
+		if ((rlwe_param_nid = tls1_rlwe_nid(s, type)) == NID_undef) {
+		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE, ERR_R_INTERNAL_ERROR);
 		    goto err;
 		}
-		
-		s->s3->tmp.rlwe=rlwe;
-		if ((RLWE_PAIR_get_publickey(rlwe) == NULL) ||
-		    !RLWE_PAIR_has_privatekey(rlwe)) {
-		    if(!RLWE_PAIR_generate_key(rlwe)) {
+		/* Use the server's shared key if it has one for this
+		 * parameter set, else a pre-generated key pair if it keeps
+		 * a pool, else generate a key pair now */
+		if ((rlwe = ssl_rlwe_tmp_get(s, rlwe_param_nid)) == NULL &&
+		    !ssl_rlwe_pool_get(s->ctx, rlwe_param_nid, &rlwe,
+				       &encoded_rlwepub, &encoded_rlwepub_len)) {
+		    if ((rlwe_ctx = RLWE_CTX_new(rlwe_param_nid)) == NULL) {
+			SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_MALLOC_FAILURE);
+			goto err;
+		    }
+		    if ((rlwe = RLWE_PAIR_new(rlwe_ctx)) == NULL) {
+			SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
+			goto err;
+		    }
+		    RLWE_CTX_free(rlwe_ctx); rlwe_ctx = NULL;
+		    if (!RLWE_PAIR_generate_key(rlwe)) {
+			RLWE_PAIR_free(rlwe);
 			SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
 			goto err;
 		    }
 		}
-		RLWE_CTX_free(rlwe_ctx); rlwe_ctx = NULL;
-		if (rlwep != NULL)
-		    RLWE_PAIR_free(rlwep);
+		s->s3->tmp.rlwe=rlwe;
 
-		encoded_rlwepub_len = i2o_RLWE_PUB(RLWE_PAIR_get_publickey(rlwe), &encoded_rlwepub);
-		    
-		if (encoded_rlwepub_len == 0) {
-		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
-		    goto err;
+		/* Pooled keys come encoded, but not compressed; others
+		 * are encoded straight into the message below */
+		if (encoded_rlwepub != NULL &&
+		    ssl_rlwe_compressed_bits(s, rlwe_param_nid) != 0) {
+		    OPENSSL_free(encoded_rlwepub);
+		    encoded_rlwepub = NULL;
+		}
+		if (encoded_rlwepub == NULL) {
+		    encoded_rlwepub_len = ssl_rlwe_pub_encode(s, RLWE_PAIR_get_publickey(rlwe), NULL, 0);
+		    if (encoded_rlwepub_len == 0) {
+			SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
+			goto err;
+		    }
 		}
 		
 		n = 2 + encoded_rlwepub_len;
@@ -2050,14 +2059,28 @@ int ssl3_send_server_key_exchange(SSL *s)
         }
 #endif
 #ifndef OPENSSL_NO_RINGLWE
+	if (s->s3->tmp.rlwe_client_key) {
+		/* Public key and reconciliation data, both length-prefixed */
+		memcpy(p, encoded_rlwepub, encoded_rlwepub_len);
+		OPENSSL_free(encoded_rlwepub);
+		encoded_rlwepub = NULL;
+		p += encoded_rlwepub_len;
+	} else
 	if (type & (SSL_kRLWE | SSL_kRLWE_PRIME)) {
 		p[0] = (encoded_rlwepub_len >> 8) & 0xFF;
 		p[1] =  encoded_rlwepub_len       & 0xFF;
 		p += 2;
-		/* Write encoded public key */
-		memcpy((unsigned char*)p, (unsigned char *)encoded_rlwepub, encoded_rlwepub_len);
-		OPENSSL_free(encoded_rlwepub);
-		encoded_rlwepub = NULL;
+		/* Write encoded public key: pooled keys come ready encoded,
+		 * others are encoded in place */
+		if (encoded_rlwepub != NULL) {
+		    memcpy((unsigned char*)p, (unsigned char *)encoded_rlwepub, encoded_rlwepub_len);
+		    OPENSSL_free(encoded_rlwepub);
+		    encoded_rlwepub = NULL;
+		} else if (ssl_rlwe_pub_encode(s, RLWE_PAIR_get_publickey(s->s3->tmp.rlwe), p,
+					       encoded_rlwepub_len) == 0) {
+		    SSLerr(SSL_F_SSL3_SEND_SERVER_KEY_EXCHANGE,ERR_R_RLWE_LIB);
+		    goto err;
+		}
 		p += encoded_rlwepub_len;
 	}
 #endif
@@ -2168,8 +2191,6 @@ int ssl3_send_server_key_exchange(SSL *s)
     BN_CTX_free(bn_ctx);
 #endif
 #ifndef OPENSSL_NO_RINGLWE
-    if (rlwep != NULL)
-	RLWE_PAIR_free(rlwep);
     if (encoded_rlwepub != NULL) 
 	OPENSSL_free(encoded_rlwepub);
     RLWE_CTX_free(rlwe_ctx);
@@ -2307,10 +2328,10 @@ int ssl3_get_client_key_exchange(SSL *s)
     unsigned int clnt_rlwe_pub_len;
     RLWE_REC *clnt_rlwe_rec = NULL;
     unsigned int clnt_rlwe_rec_len;
+    RLWE_PUB_VIEW clnt_rlwe_pub_view;
+    RLWE_REC_VIEW clnt_rlwe_rec_view;
     RLWE_CTX *rlwe_ctx = NULL; 
 #endif
-	
-	printf("in ssl3_get_client_key_exchange\n");
 
     n = s->method->ssl_get_message(s,
                                    SSL3_ST_SR_KEY_EXCH_A,
@@ -2859,7 +2880,7 @@ int ssl3_get_client_key_exchange(SSL *s)
             }
 #ifdef OPENSSL_HYBRID_RLWE_ECDHE
 	    if (alg_k & (SSL_kRLWE | SSL_kRLWE_PRIME)) {
-		if ((rlwe_ctx = RLWE_CTX_new(rlwe_nid(alg_k))) == NULL) {
+		if ((rlwe_ctx = RLWE_CTX_new(RLWE_PAIR_get_nid(s->s3->tmp.rlwe))) == NULL) {
 		    SSLerr(SSL_F_SSL3_GET_CLIENT_KEY_EXCHANGE, ERR_R_MALLOC_FAILURE);
 		    goto err;
 		}
@@ -2984,9 +3005,19 @@ int ssl3_get_client_key_exchange(SSL *s)
     } else
 #endif
 #ifndef OPENSSL_NO_RINGLWE
+	if (s->s3->tmp.rlwe_client_key) {
+	    /* The master secret was fixed in ServerKeyExchange */
+	    if (n != 0) {
+		al = SSL_AD_DECODE_ERROR;
+		SSLerr(SSL_F_SSL3_GET_CLIENT_KEY_EXCHANGE, SSL_R_LENGTH_MISMATCH);
+		goto f_err;
+	    }
+	    return (1);
+	}
+	else
 	if ((alg_k & (SSL_kRLWE | SSL_kRLWE_PRIME)) && !(alg_k & SSL_kEECDH)) {
 	    int ret = 1;
-	    if ((rlwe_ctx = RLWE_CTX_new(rlwe_nid(alg_k))) == NULL) {
+	    if ((rlwe_ctx = RLWE_CTX_new(RLWE_PAIR_get_nid(s->s3->tmp.rlwe))) == NULL) {
 		SSLerr(SSL_F_SSL3_GET_CLIENT_KEY_EXCHANGE, ERR_R_MALLOC_FAILURE);
 		goto err;
 	    }
@@ -3005,7 +3036,12 @@ int ssl3_get_client_key_exchange(SSL *s)
 		goto err;
 	    }
 
-	    if (o2i_RLWE_PUB(&clnt_rlwe_pub, p, clnt_rlwe_pub_len) == 0) {
+	    /* The client's public key and reconciliation data are read in
+	     * place from init_buf rather than copied out.  The key may only
+	     * be compressed if we agreed to that. */
+	    if (!(s->s3->tmp.rlwe_compressed
+		  ? RLWE_PUB_VIEW_init_compressed(&clnt_rlwe_pub_view, p, clnt_rlwe_pub_len)
+		  : RLWE_PUB_VIEW_init(&clnt_rlwe_pub_view, p, clnt_rlwe_pub_len))) {
 		SSLerr(SSL_F_SSL3_GET_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
 		goto err;
 	    }
@@ -3023,19 +3059,21 @@ int ssl3_get_client_key_exchange(SSL *s)
 		goto err;
 	    }
 	    
-	    if (o2i_RLWE_REC(&clnt_rlwe_rec, p, clnt_rlwe_rec_len) == 0) {
+	    if (!RLWE_REC_VIEW_init(&clnt_rlwe_rec_view, p, clnt_rlwe_rec_len)) {
 		SSLerr(SSL_F_SSL3_GET_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
 		goto err;
 	    }
 	    p += clnt_rlwe_rec_len;
 	    
 	    /* p is pointing to somewhere in the buffer
-	     * currently, so set it to the start 
+	     * currently, so set it to the start; the views are fully
+	     * decoded before the shared key overwrites them
 	     */ 
 	    p = (unsigned char *)s->init_buf->data;
 	    
 	    /* Compute Ring-LWE shared key */
-	    n = RINGLWE_compute_key_alice(p, 1024, clnt_rlwe_pub, clnt_rlwe_rec, srvr_rlwe, NULL);
+	    n = RINGLWE_compute_key_alice_view(p, 1024, &clnt_rlwe_pub_view,
+					       &clnt_rlwe_rec_view, srvr_rlwe, NULL, NULL);
 	    if (n <= 0) {
 		SSLerr(SSL_F_SSL3_GET_CLIENT_KEY_EXCHANGE, ERR_R_RLWE_LIB);
 		goto err;
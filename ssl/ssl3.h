@@ -574,6 +574,10 @@ typedef struct ssl3_state_st {
 #  endif
 #ifndef OPENSSL_NO_RINGLWE
         RLWE_PAIR *rlwe; /* holds short lived RLWE key */
+        /* the RLWE key exchange runs with the client as Alice */
+        int rlwe_client_key;
+        /* the peer accepts compressed RLWE public keys */
+        int rlwe_compressed;
 #endif
         /* used when SSL_ST_FLUSH_DATA is entered */
         int next_state;
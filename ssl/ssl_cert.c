@@ -288,13 +288,15 @@ CERT *ssl_cert_dup(CERT *cert)
 #endif
 
 #ifndef OPENSSL_NO_RINGLWE
+    /* Shared rather than copied, so rotation is common to all users */
     if (cert->rlwe_tmp) {
-      ret->rlwe_tmp = RLWE_PAIR_dup(cert->rlwe_tmp);
-      if (ret->rlwe_tmp == NULL) {
-	SSLerr(SSL_F_SSL_CERT_DUP, ERR_R_RLWE_LIB);
-	goto err;
-      }
+        ssl_rlwe_tmp_up_ref(cert->rlwe_tmp);
+        ret->rlwe_tmp = cert->rlwe_tmp;
     }
+    ret->rlwe_tmp_lifetime = cert->rlwe_tmp_lifetime;
+    ret->rlwe_tmp_max_uses = cert->rlwe_tmp_max_uses;
+    ret->rlwe_client_key = cert->rlwe_client_key;
+    ret->rlwe_compressed = cert->rlwe_compressed;
 #endif
 
     for (i = 0; i < SSL_PKEY_NUM; i++) {
@@ -419,7 +421,7 @@ CERT *ssl_cert_dup(CERT *cert)
 #endif
 #ifndef OPENSSL_NO_RINGLWE
     if (ret->rlwe_tmp != NULL)
-        RLWE_PAIR_free(ret->rlwe_tmp);
+        ssl_rlwe_tmp_free(ret->rlwe_tmp);
 #endif
 
 #ifndef OPENSSL_NO_TLSEXT
@@ -499,7 +501,7 @@ void ssl_cert_free(CERT *c)
 #endif
 #ifndef OPENSSL_NO_RINGLWE
     if (c->rlwe_tmp)
-        RLWE_PAIR_free(c->rlwe_tmp);
+        ssl_rlwe_tmp_free(c->rlwe_tmp);
 #endif
 
     ssl_cert_clear_certs(c);
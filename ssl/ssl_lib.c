@@ -384,6 +384,17 @@ SSL *SSL_new(SSL_CTX *ctx)
             ctx->tlsext_ellipticcurvelist_length;
     }
 # endif
+# ifndef OPENSSL_NO_RINGLWE
+    if (ctx->tlsext_rlweparamslist) {
+        s->tlsext_rlweparamslist =
+            BUF_memdup(ctx->tlsext_rlweparamslist,
+                       ctx->tlsext_rlweparamslist_length);
+        if (!s->tlsext_rlweparamslist)
+            goto err;
+        s->tlsext_rlweparamslist_length =
+            ctx->tlsext_rlweparamslist_length;
+    }
+# endif
 # ifndef OPENSSL_NO_NEXTPROTONEG
     s->next_proto_negotiated = NULL;
 # endif
@@ -658,6 +669,18 @@ void SSL_free(SSL *s)
         sk_SRTP_PROTECTION_PROFILE_free(s->srtp_profiles);
 #endif
 
+#ifndef OPENSSL_NO_RINGLWE
+    RLWE_TICKET_free(s->rlwe_ticket);
+# ifndef OPENSSL_NO_TLSEXT
+    if (s->tlsext_rlweparamslist)
+        OPENSSL_free(s->tlsext_rlweparamslist);
+    if (s->tlsext_peer_rlweparamslist)
+        OPENSSL_free(s->tlsext_peer_rlweparamslist);
+    if (s->tlsext_peer_rlwepub)
+        OPENSSL_free(s->tlsext_peer_rlwepub);
+# endif
+#endif
+
     OPENSSL_free(s);
 }
 
@@ -2172,6 +2195,13 @@ void SSL_CTX_free(SSL_CTX *a)
 # endif                         /* OPENSSL_NO_EC */
     if (a->alpn_client_proto_list != NULL)
         OPENSSL_free(a->alpn_client_proto_list);
+#endif
+#ifndef OPENSSL_NO_RINGLWE
+    ssl_rlwe_pools_free(a);
+# ifndef OPENSSL_NO_TLSEXT
+    if (a->tlsext_rlweparamslist)
+        OPENSSL_free(a->tlsext_rlweparamslist);
+# endif
 #endif
 
     OPENSSL_free(a);
@@ -626,11 +626,18 @@ typedef struct cert_st {
     EC_KEY *ecdh_tmp;
     /* Callback for generating ephemeral ECDH keys */
     EC_KEY *(*ecdh_tmp_cb) (SSL *ssl, int is_export, int keysize);
-#ifndef OPENSSL_NO_RINGLWE
-    RLWE_PAIR *rlwe_tmp;
-#endif
     /* Select ECDH parameters automatically */
     int ecdh_tmp_auto;
+# endif
+# ifndef OPENSSL_NO_RINGLWE
+    /* Server key shared across handshakes, and its rotation policy */
+    struct ssl_rlwe_tmp_st *rlwe_tmp;
+    long rlwe_tmp_lifetime;
+    unsigned long rlwe_tmp_max_uses;
+    /* Send (client) or accept (server) an RLWE key in the ClientHello */
+    int rlwe_client_key;
+    /* Accept compressed RLWE public keys, and send them if the peer does */
+    int rlwe_compressed;
 # endif
     /* Flags related to certificates */
     unsigned int cert_flags;
@@ -1425,6 +1432,29 @@ int ssl_parse_clienthello_renegotiate_ext(SSL *s, unsigned char *d, int len,
                                           int *al);
 long ssl_get_algorithm2(SSL *s);
 int rlwe_nid(unsigned long type);
+#ifndef OPENSSL_NO_RINGLWE
+typedef struct ssl_rlwe_pool_st SSL_RLWE_POOL;
+int ssl_rlwe_pool_get(SSL_CTX *ctx, int nid, RLWE_PAIR **pair,
+                      unsigned char **pub, int *publen);
+void ssl_rlwe_pools_free(SSL_CTX *ctx);
+RLWE_TICKET *ssl_rlwe_ticket_get(SSL *s, int nid);
+typedef struct ssl_rlwe_tmp_st SSL_RLWE_TMP;
+SSL_RLWE_TMP *ssl_rlwe_tmp_new(RLWE_PAIR *pair);
+void ssl_rlwe_tmp_up_ref(SSL_RLWE_TMP *tmp);
+void ssl_rlwe_tmp_free(SSL_RLWE_TMP *tmp);
+RLWE_PAIR *ssl_rlwe_tmp_get(SSL *s, int nid);
+# ifndef OPENSSL_NO_TLSEXT
+int tls1_set_rlwe_params(unsigned char **pext, size_t *pextlen,
+                         const int *nids, size_t nnids);
+int tls1_rlwe_nid(SSL *s, unsigned long alg_k);
+int tls1_check_rlwe_nid(SSL *s, int nid, unsigned long alg_k);
+int ssl_rlwe_client_key(SSL *s, int nid);
+int ssl_rlwe_encapsulate(SSL *s, unsigned char **out, int *outlen);
+# endif
+int ssl_rlwe_compressed_bits(SSL *s, int nid);
+size_t ssl_rlwe_pub_encode(SSL *s, const RLWE_PUB *pub, unsigned char *out,
+                           size_t outlen);
+#endif
 int tls1_save_sigalgs(SSL *s, const unsigned char *data, int dsize);
 int tls1_process_sigalgs(SSL *s);
 size_t tls12_get_psigalgs(SSL *s, const unsigned char **psigs);
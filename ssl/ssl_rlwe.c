@@ -0,0 +1,682 @@
+/* ssl/ssl_rlwe.c */
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/*
+ * Pools of pre-generated ephemeral RLWE key pairs.
+ *
+ * A server can keep, per parameter set, a stock of fresh key pairs with
+ * their public keys already encoded, so that ServerKeyExchange only has to
+ * take one instead of generating it.  Every pair is handed out exactly
+ * once.  The library never creates threads: the application calls
+ * SSL_CTX_rlwe_pool_refill() from its own worker thread or idle loop,
+ * typically whenever SSL_CTX_rlwe_pool_needs_refill() reports a pool at
+ * or below its low-water mark.  Handshakes that find their pool empty
+ * fall back to generating a key inline and are counted as misses.
+ *
+ * Pools are protected by CRYPTO_LOCK_SSL_CTX, which is only held to move
+ * pointers in and out; keys are generated outside the lock.
+ */
+
+#include <stdio.h>
+#include "ssl_locl.h"
+
+#ifndef OPENSSL_NO_RINGLWE
+
+/* Keys generated per RLWE_PAIR_generate_keys_batch call while refilling */
+# define SSL_RLWE_POOL_BATCH 16
+
+struct ssl_rlwe_pool_st {
+    int nid;
+    unsigned int depth, low_water;
+    unsigned int count;         /* keys available */
+    unsigned int pending;       /* keys being generated by refills */
+    RLWE_PAIR **pairs;          /* [depth] */
+    unsigned char **pubs;       /* [depth], encoded public keys */
+    int publen;
+    unsigned long hits, misses;
+};
+
+static void ssl_rlwe_pool_free(SSL_RLWE_POOL *pool)
+{
+    unsigned int i;
+
+    if (pool == NULL)
+        return;
+    for (i = 0; i < pool->count; i++) {
+        RLWE_PAIR_free(pool->pairs[i]);
+        OPENSSL_free(pool->pubs[i]);
+    }
+    OPENSSL_free(pool->pairs);
+    OPENSSL_free(pool->pubs);
+    OPENSSL_free(pool);
+}
+
+void ssl_rlwe_pools_free(SSL_CTX *ctx)
+{
+    int i;
+
+    for (i = 0; i < SSL_RLWE_MAX_POOLS; i++) {
+        ssl_rlwe_pool_free(ctx->rlwe_pool[i]);
+        ctx->rlwe_pool[i] = NULL;
+    }
+}
+
+/* Must be called with CRYPTO_LOCK_SSL_CTX held */
+static SSL_RLWE_POOL *ssl_rlwe_pool_find(SSL_CTX *ctx, int nid)
+{
+    int i;
+
+    for (i = 0; i < SSL_RLWE_MAX_POOLS; i++)
+        if (ctx->rlwe_pool[i] != NULL && ctx->rlwe_pool[i]->nid == nid)
+            return ctx->rlwe_pool[i];
+    return NULL;
+}
+
+/*
+ * Keep up to |depth| pre-generated key pairs for parameter set |nid| and
+ * report the pool as needing a refill once |low_water| or fewer are left.
+ * A depth of 0 removes the pool.  Keys already in a pool are kept when it
+ * is resized, up to the new depth.
+ */
+int SSL_CTX_set_rlwe_pool(SSL_CTX *ctx, int nid, unsigned int depth,
+                          unsigned int low_water)
+{
+    SSL_RLWE_POOL *pool = NULL, *old;
+    RLWE_CTX *rlwe_ctx;
+    RLWE_PUB *pub;
+    unsigned int i;
+    int slot = -1;
+
+    if (ctx == NULL) {
+        SSLerr(SSL_F_SSL_CTX_SET_RLWE_POOL, ERR_R_PASSED_NULL_PARAMETER);
+        return 0;
+    }
+    if ((rlwe_ctx = RLWE_CTX_new(nid)) == NULL) {
+        SSLerr(SSL_F_SSL_CTX_SET_RLWE_POOL, ERR_R_RLWE_LIB);
+        return 0;
+    }
+
+    if (depth > 0) {
+        if (low_water >= depth)
+            low_water = depth - 1;
+        pool = OPENSSL_malloc(sizeof(*pool));
+        if (pool == NULL)
+            goto merr;
+        memset(pool, 0, sizeof(*pool));
+        pool->nid = nid;
+        pool->depth = depth;
+        pool->low_water = low_water;
+        pool->pairs = OPENSSL_malloc(depth * sizeof(*pool->pairs));
+        pool->pubs = OPENSSL_malloc(depth * sizeof(*pool->pubs));
+        pub = RLWE_PUB_new(rlwe_ctx);
+        if (pub != NULL) {
+            pool->publen = i2o_RLWE_PUB(pub, NULL);
+            RLWE_PUB_free(pub);
+        }
+        if (pool->pairs == NULL || pool->pubs == NULL || pool->publen == 0)
+            goto merr;
+    }
+    RLWE_CTX_free(rlwe_ctx);
+
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+    for (i = 0; i < SSL_RLWE_MAX_POOLS; i++) {
+        if (ctx->rlwe_pool[i] != NULL && ctx->rlwe_pool[i]->nid == nid) {
+            slot = i;
+            break;
+        }
+        if (ctx->rlwe_pool[i] == NULL && slot < 0)
+            slot = i;
+    }
+    if (slot < 0) {
+        CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+        ssl_rlwe_pool_free(pool);
+        SSLerr(SSL_F_SSL_CTX_SET_RLWE_POOL, ERR_R_INTERNAL_ERROR);
+        return 0;
+    }
+    old = ctx->rlwe_pool[slot];
+    if (old != NULL && pool != NULL) {
+        /* Carry over keys and statistics */
+        while (old->count > 0 && pool->count < pool->depth) {
+            old->count--;
+            pool->pairs[pool->count] = old->pairs[old->count];
+            pool->pubs[pool->count] = old->pubs[old->count];
+            pool->count++;
+        }
+        pool->hits = old->hits;
+        pool->misses = old->misses;
+    }
+    ctx->rlwe_pool[slot] = pool;
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+
+    ssl_rlwe_pool_free(old);
+    return 1;
+
+ merr:
+    RLWE_CTX_free(rlwe_ctx);
+    ssl_rlwe_pool_free(pool);
+    SSLerr(SSL_F_SSL_CTX_SET_RLWE_POOL, ERR_R_MALLOC_FAILURE);
+    return 0;
+}
+
+/* Returns 1 if any pool is at or below its low-water mark */
+int SSL_CTX_rlwe_pool_needs_refill(SSL_CTX *ctx)
+{
+    SSL_RLWE_POOL *pool;
+    int i, ret = 0;
+
+    CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
+    for (i = 0; i < SSL_RLWE_MAX_POOLS; i++) {
+        pool = ctx->rlwe_pool[i];
+        if (pool != NULL && pool->count + pool->pending <= pool->low_water)
+            ret = 1;
+    }
+    CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+    return ret;
+}
+
+/*
+ * Generate up to |n| keys for the pool of |nid| and add them.  Returns the
+ * number added, or -1 on error.
+ */
+static int ssl_rlwe_pool_fill(SSL_CTX *ctx, int nid, unsigned int n)
+{
+    SSL_RLWE_POOL *pool;
+    RLWE_CTX *rlwe_ctx = NULL;
+    RLWE_PAIR *pairs[SSL_RLWE_POOL_BATCH];
+    unsigned char *pubs[SSL_RLWE_POOL_BATCH];
+    unsigned int i, added = 0;
+    int ok = 0;
+
+    if (n > SSL_RLWE_POOL_BATCH)
+        n = SSL_RLWE_POOL_BATCH;
+    memset(pairs, 0, sizeof(pairs));
+    memset(pubs, 0, sizeof(pubs));
+
+    if ((rlwe_ctx = RLWE_CTX_new(nid)) == NULL)
+        goto end;
+    for (i = 0; i < n; i++)
+        if ((pairs[i] = RLWE_PAIR_new(rlwe_ctx)) == NULL)
+            goto end;
+    if (!RLWE_PAIR_generate_keys_batch(pairs, n, NULL))
+        goto end;
+    for (i = 0; i < n; i++)
+        if (i2o_RLWE_PUB(RLWE_PAIR_get_publickey(pairs[i]), &pubs[i]) == 0)
+            goto end;
+    ok = 1;
+
+ end:
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+    pool = ssl_rlwe_pool_find(ctx, nid);
+    if (pool != NULL) {
+        pool->pending -= (pool->pending < n) ? pool->pending : n;
+        while (ok && added < n && pool->count < pool->depth) {
+            pool->pairs[pool->count] = pairs[added];
+            pool->pubs[pool->count] = pubs[added];
+            pairs[added] = NULL;
+            pubs[added] = NULL;
+            pool->count++;
+            added++;
+        }
+    }
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+
+    /* Whatever did not fit (the pool was resized meanwhile) is dropped */
+    for (i = 0; i < n; i++) {
+        RLWE_PAIR_free(pairs[i]);
+        OPENSSL_free(pubs[i]);
+    }
+    RLWE_CTX_free(rlwe_ctx);
+    if (!ok) {
+        SSLerr(SSL_F_SSL_CTX_RLWE_POOL_REFILL, ERR_R_RLWE_LIB);
+        return -1;
+    }
+    return added;
+}
+
+/*
+ * Top up every pool to its depth.  Several threads may refill at once;
+ * each reserves the keys it is going to generate so that they do not
+ * overshoot.  Returns the number of keys added, or -1 on error.
+ */
+int SSL_CTX_rlwe_pool_refill(SSL_CTX *ctx)
+{
+    SSL_RLWE_POOL *pool;
+    unsigned int want;
+    int i, nid, r, total = 0;
+
+    if (ctx == NULL) {
+        SSLerr(SSL_F_SSL_CTX_RLWE_POOL_REFILL, ERR_R_PASSED_NULL_PARAMETER);
+        return -1;
+    }
+    for (i = 0; i < SSL_RLWE_MAX_POOLS; i++) {
+        for (;;) {
+            CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+            pool = ctx->rlwe_pool[i];
+            want = 0;
+            nid = NID_undef;
+            if (pool != NULL && pool->count + pool->pending < pool->depth) {
+                want = pool->depth - pool->count - pool->pending;
+                if (want > SSL_RLWE_POOL_BATCH)
+                    want = SSL_RLWE_POOL_BATCH;
+                pool->pending += want;
+                nid = pool->nid;
+            }
+            CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+            if (want == 0)
+                break;
+            if ((r = ssl_rlwe_pool_fill(ctx, nid, want)) < 0)
+                return -1;
+            total += r;
+            if (r < (int)want)
+                break;
+        }
+    }
+    return total;
+}
+
+/*
+ * Statistics for the pool of |nid|: handshakes served from the pool,
+ * handshakes that found it empty, and keys currently available.  Any of
+ * the pointers may be NULL.  Returns 0 if there is no pool for |nid|.
+ */
+int SSL_CTX_get_rlwe_pool_stats(SSL_CTX *ctx, int nid, unsigned long *hits,
+                                unsigned long *misses,
+                                unsigned int *available)
+{
+    SSL_RLWE_POOL *pool;
+
+    CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
+    pool = ssl_rlwe_pool_find(ctx, nid);
+    if (pool != NULL) {
+        if (hits != NULL)
+            *hits = pool->hits;
+        if (misses != NULL)
+            *misses = pool->misses;
+        if (available != NULL)
+            *available = pool->count;
+    }
+    CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+    return pool != NULL;
+}
+
+/*
+ * Take a key pair for |nid| from the pool, along with its encoded public
+ * key, both of which the caller then owns.  Returns 0, and counts a miss,
+ * if the pool is empty, or just 0 if there is no pool for |nid|.
+ */
+int ssl_rlwe_pool_get(SSL_CTX *ctx, int nid, RLWE_PAIR **pair,
+                      unsigned char **pub, int *publen)
+{
+    SSL_RLWE_POOL *pool;
+    int i, ret = 0;
+
+    /*
+     * Most contexts have no pools: don't make their handshakes contend for
+     * the global lock.  Only the slots are read here, never a pool itself.
+     */
+    for (i = 0; i < SSL_RLWE_MAX_POOLS; i++) {
+        if (ctx->rlwe_pool[i] != NULL)
+            break;
+    }
+    if (i == SSL_RLWE_MAX_POOLS)
+        return 0;
+
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+    pool = ssl_rlwe_pool_find(ctx, nid);
+    if (pool != NULL) {
+        if (pool->count > 0) {
+            pool->count--;
+            *pair = pool->pairs[pool->count];
+            *pub = pool->pubs[pool->count];
+            *publen = pool->publen;
+            pool->hits++;
+            ret = 1;
+        } else
+            pool->misses++;
+    }
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+    return ret;
+}
+
+/*
+ * Give |s| a precomputed encapsulation (see RLWE_TICKET_generate) for its
+ * next ClientKeyExchange or, for a server that takes up the client's
+ * ClientHello key, ServerKeyExchange, replacing any it already has.  |s| takes
+ * ownership of |ticket|.  A ticket whose parameter set is not the one
+ * negotiated is simply not used.
+ */
+void SSL_set0_rlwe_ticket(SSL *s, RLWE_TICKET *ticket)
+{
+    RLWE_TICKET_free(s->rlwe_ticket);
+    s->rlwe_ticket = ticket;
+}
+
+/*
+ * Return a generated ticket for |nid|, which the caller then owns: the one
+ * set with SSL_set0_rlwe_ticket if it matches, otherwise a new one.
+ */
+RLWE_TICKET *ssl_rlwe_ticket_get(SSL *s, int nid)
+{
+    RLWE_TICKET *ticket = s->rlwe_ticket;
+    RLWE_CTX *rlwe_ctx;
+
+    if (ticket != NULL && RLWE_TICKET_get_nid(ticket) == nid
+        && RLWE_TICKET_get_publickey(ticket) != NULL) {
+        s->rlwe_ticket = NULL;
+        return ticket;
+    }
+
+    if ((rlwe_ctx = RLWE_CTX_new(nid)) == NULL)
+        return NULL;
+    ticket = RLWE_TICKET_new(rlwe_ctx);
+    RLWE_CTX_free(rlwe_ctx);
+    if (ticket == NULL || !RLWE_TICKET_generate(ticket)) {
+        RLWE_TICKET_free(ticket);
+        return NULL;
+    }
+    return ticket;
+}
+
+/*
+ * A server RLWE key shared across handshakes (SSL_CTX_set_tmp_rlwe).  The
+ * holder is shared, behind a reference count, by the CERT of the SSL_CTX
+ * and those of the SSLs created from it, so that uses are counted and the
+ * key rotated once for all of them.  Handshakes take their own reference
+ * to the current pair, which therefore outlives a rotation that happens
+ * while they are in progress.
+ *
+ * The holder is protected by CRYPTO_LOCK_SSL_CERT; a replacement key is
+ * generated outside the lock and installed only if no other thread has
+ * rotated the key meanwhile.
+ */
+struct ssl_rlwe_tmp_st {
+    int references;
+    int nid;
+    RLWE_PAIR *pair;
+    time_t created;
+    unsigned long uses;
+    unsigned long generation;   /* bumped on every rotation */
+};
+
+/* Take a reference to |pair|, generating its key if it has none */
+SSL_RLWE_TMP *ssl_rlwe_tmp_new(RLWE_PAIR *pair)
+{
+    SSL_RLWE_TMP *tmp;
+
+    if (!RLWE_PAIR_has_privatekey(pair) && !RLWE_PAIR_generate_key(pair))
+        return NULL;
+    tmp = OPENSSL_malloc(sizeof(*tmp));
+    if (tmp == NULL)
+        return NULL;
+    memset(tmp, 0, sizeof(*tmp));
+    tmp->references = 1;
+    tmp->nid = RLWE_PAIR_get_nid(pair);
+    tmp->created = time(NULL);
+    RLWE_PAIR_up_ref(pair);
+    tmp->pair = pair;
+    return tmp;
+}
+
+void ssl_rlwe_tmp_up_ref(SSL_RLWE_TMP *tmp)
+{
+    CRYPTO_add(&tmp->references, 1, CRYPTO_LOCK_SSL_CERT);
+}
+
+void ssl_rlwe_tmp_free(SSL_RLWE_TMP *tmp)
+{
+    if (tmp == NULL)
+        return;
+    if (CRYPTO_add(&tmp->references, -1, CRYPTO_LOCK_SSL_CERT) > 0)
+        return;
+    RLWE_PAIR_free(tmp->pair);
+    OPENSSL_free(tmp);
+}
+
+/*
+ * Limit how long the key set with SSL_CTX_set_tmp_rlwe is used: it is
+ * replaced by a fresh one once it is |seconds| old or has served |uses|
+ * handshakes, whichever comes first.  0 means no limit; uses of 1 gives a
+ * new key for every handshake.  Applies to SSLs created afterwards.
+ */
+int SSL_CTX_set_tmp_rlwe_lifetime(SSL_CTX *ctx, long seconds,
+                                  unsigned long uses)
+{
+    ctx->cert->rlwe_tmp_lifetime = seconds;
+    ctx->cert->rlwe_tmp_max_uses = uses;
+    return 1;
+}
+
+int SSL_set_tmp_rlwe_lifetime(SSL *s, long seconds, unsigned long uses)
+{
+    s->cert->rlwe_tmp_lifetime = seconds;
+    s->cert->rlwe_tmp_max_uses = uses;
+    return 1;
+}
+
+/* Must be called with CRYPTO_LOCK_SSL_CERT held */
+static int ssl_rlwe_tmp_expired(const SSL_RLWE_TMP *tmp, const CERT *c,
+                                time_t now)
+{
+    if (c->rlwe_tmp_max_uses > 0 && tmp->uses >= c->rlwe_tmp_max_uses)
+        return 1;
+    if (c->rlwe_tmp_lifetime > 0 && now - tmp->created >= c->rlwe_tmp_lifetime)
+        return 1;
+    return 0;
+}
+
+/*
+ * Return a reference to the shared server key for |nid|, rotating it first
+ * if it is past its lifetime.  Returns NULL if there is no shared key for
+ * |nid| or a replacement could not be generated.
+ */
+RLWE_PAIR *ssl_rlwe_tmp_get(SSL *s, int nid)
+{
+    SSL_RLWE_TMP *tmp = s->cert->rlwe_tmp;
+    RLWE_CTX *rlwe_ctx;
+    RLWE_PAIR *pair = NULL, *fresh = NULL, *old = NULL;
+    unsigned long generation;
+    time_t now;
+
+    if (tmp == NULL || tmp->nid != nid)
+        return NULL;
+
+    now = time(NULL);
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CERT);
+    if (!ssl_rlwe_tmp_expired(tmp, s->cert, now)) {
+        tmp->uses++;
+        pair = tmp->pair;
+        RLWE_PAIR_up_ref(pair);
+    }
+    generation = tmp->generation;
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CERT);
+    if (pair != NULL)
+        return pair;
+
+    if ((rlwe_ctx = RLWE_CTX_new(nid)) == NULL)
+        return NULL;
+    fresh = RLWE_PAIR_new(rlwe_ctx);
+    RLWE_CTX_free(rlwe_ctx);
+    if (fresh == NULL || !RLWE_PAIR_generate_key(fresh)) {
+        RLWE_PAIR_free(fresh);
+        return NULL;
+    }
+
+    CRYPTO_w_lock(CRYPTO_LOCK_SSL_CERT);
+    if (tmp->generation == generation) {
+        old = tmp->pair;
+        tmp->pair = fresh;
+        tmp->created = now;
+        tmp->uses = 0;
+        tmp->generation++;
+        fresh = NULL;
+    }
+    /* Otherwise another handshake has just rotated it: use theirs */
+    tmp->uses++;
+    pair = tmp->pair;
+    RLWE_PAIR_up_ref(pair);
+    CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CERT);
+
+    RLWE_PAIR_free(old);
+    RLWE_PAIR_free(fresh);
+    return pair;
+}
+
+/*
+ * Compressed public keys (SSL_CTX_set_rlwe_compression): when both hellos
+ * carry the rlwe_compressed extension, each side sends its RLWE public key
+ * with the low-order bits of every coefficient dropped, for the parameter
+ * sets that have such an encoding (see RLWE_PUB_encode_compressed).  Keys
+ * from the peer are accepted in compressed form only once this is agreed.
+ */
+
+/*
+ * Return the number of bits per coefficient to send keys for |nid| with,
+ * or 0 to send them uncompressed.
+ */
+int ssl_rlwe_compressed_bits(SSL *s, int nid)
+{
+    if (!s->s3->tmp.rlwe_compressed)
+        return 0;
+    return RLWE_get_compressed_bits(nid);
+}
+
+/*
+ * As RLWE_PUB_encode, but compressing the key if the peer accepts that.
+ */
+size_t ssl_rlwe_pub_encode(SSL *s, const RLWE_PUB *pub, unsigned char *out,
+                           size_t outlen)
+{
+    int bits = ssl_rlwe_compressed_bits(s, RLWE_PUB_get_nid(pub));
+
+    if (bits != 0)
+        return RLWE_PUB_encode_compressed(pub, bits, out, outlen);
+    return RLWE_PUB_encode(pub, out, outlen);
+}
+
+# ifndef OPENSSL_NO_TLSEXT
+
+/*
+ * Key exchange with the roles reversed (SSL_CTX_set_rlwe_client_key): the
+ * client sends a public key in its ClientHello, the server encapsulates
+ * against it in ServerKeyExchange, and the ClientKeyExchange is empty.  The
+ * server then does a single encapsulation per handshake, which can itself
+ * be precomputed (SSL_set0_rlwe_ticket), and no key generation at all.
+ */
+
+/*
+ * Client side: make sure s->s3->tmp.rlwe holds a key pair for |nid| to
+ * send in the ClientHello.  A pair already there is kept, as the
+ * ClientHello may be sent again (DTLS HelloVerifyRequest); otherwise it
+ * comes from the SSL_CTX's pool if it keeps one, or is generated now.
+ */
+int ssl_rlwe_client_key(SSL *s, int nid)
+{
+    RLWE_CTX *rlwe_ctx;
+    RLWE_PAIR *pair = NULL;
+    unsigned char *pub = NULL;
+    int publen;
+
+    if (s->s3->tmp.rlwe != NULL) {
+        if (RLWE_PAIR_get_nid(s->s3->tmp.rlwe) == nid)
+            return 1;
+        RLWE_PAIR_free(s->s3->tmp.rlwe);
+        s->s3->tmp.rlwe = NULL;
+    }
+
+    if (ssl_rlwe_pool_get(s->ctx, nid, &pair, &pub, &publen)) {
+        OPENSSL_free(pub);
+    } else {
+        if ((rlwe_ctx = RLWE_CTX_new(nid)) == NULL)
+            return 0;
+        pair = RLWE_PAIR_new(rlwe_ctx);
+        RLWE_CTX_free(rlwe_ctx);
+        if (pair == NULL || !RLWE_PAIR_generate_key(pair)) {
+            RLWE_PAIR_free(pair);
+            return 0;
+        }
+    }
+    s->s3->tmp.rlwe = pair;
+    return 1;
+}
+
+/*
+ * Server side: encapsulate against the client's ClientHello key and derive
+ * the master secret from the result straight away.  |*out| is set to the
+ * ServerKeyExchange parameters, our public key and the reconciliation data
+ * each with a two byte length, which the caller frees.
+ */
+int ssl_rlwe_encapsulate(SSL *s, unsigned char **out, int *outlen)
+{
+    RLWE_PUB *peer = NULL;
+    RLWE_TICKET *ticket = NULL;
+    RLWE_REC *rec = NULL;
+    const unsigned char *pub;
+    unsigned char key[1024], *buf = NULL, *p;
+    size_t keylen = 0, publen;
+    int reclen, ret = 0;
+
+    if (o2i_RLWE_PUB(&peer, s->tlsext_peer_rlwepub,
+                     s->tlsext_peer_rlwepub_length) == NULL)
+        goto end;
+    /* Use the precomputed encapsulation, or make one now */
+    if ((ticket = ssl_rlwe_ticket_get(s, RLWE_PUB_get_nid(peer))) == NULL)
+        goto end;
+    keylen = RINGLWE_compute_key_bob_ticket(key, sizeof(key), &rec, peer,
+                                            ticket, NULL);
+    if (keylen == 0 || rec == NULL)
+        goto end;
+
+    /* The ticket's encoding will do unless we are to compress */
+    if (ssl_rlwe_compressed_bits(s, RLWE_TICKET_get_nid(ticket)) == 0)
+        publen = RLWE_TICKET_get_encoded_publickey(ticket, &pub);
+    else {
+        pub = NULL;
+        publen = ssl_rlwe_pub_encode(s, RLWE_TICKET_get_publickey(ticket),
+                                     NULL, 0);
+    }
+    reclen = RLWE_REC_encode(rec, NULL, 0);
+    if (publen == 0 || reclen == 0)
+        goto end;
+    if ((buf = OPENSSL_malloc(4 + publen + reclen)) == NULL)
+        goto end;
+    p = buf;
+    s2n(publen, p);
+    if (pub != NULL)
+        memcpy(p, pub, publen);
+    else if (ssl_rlwe_pub_encode(s, RLWE_TICKET_get_publickey(ticket), p,
+                                 publen) == 0)
+        goto end;
+    p += publen;
+    s2n(reclen, p);
+    if (RLWE_REC_encode(rec, p, reclen) == 0)
+        goto end;
+
+    s->session->master_key_length =
+        s->method->ssl3_enc->generate_master_secret(s,
+                                                    s->session->master_key,
+                                                    key, keylen);
+    *out = buf;
+    *outlen = 4 + publen + reclen;
+    buf = NULL;
+    ret = 1;
+
+ end:
+    OPENSSL_cleanse(key, keylen);
+    OPENSSL_free(buf);
+    RLWE_PUB_free(peer);
+    RLWE_TICKET_free(ticket);
+    RLWE_REC_free(rec);
+    return ret;
+}
+
+# endif                         /* OPENSSL_NO_TLSEXT */
+
+#endif                          /* OPENSSL_NO_RINGLWE */
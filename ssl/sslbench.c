@@ -0,0 +1,551 @@
+/* ssl/sslbench.c */
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+
+/*
+ * Handshake throughput of the RLWE cipher suites against plain ECDHE.
+ *
+ * Client and server run in the same thread and talk over a memory BIO
+ * pair, so there is no network or scheduler noise in the numbers.  Each
+ * of the -threads threads does back to back handshakes, with its own
+ * connections on SSL_CTXs shared by all threads, first full handshakes and
+ * then handshakes resuming a session from the server's cache.  Build with
+ * "make bench" in this directory.
+ *
+ * usage: sslbench [-threads n] [-time secs] [-rlwe_client_key]
+ *                 [-rlwe_compress] [-cipher suite]...
+ *
+ * One CSV row is printed per suite and handshake type, with the
+ * handshake rate summed over threads, the bytes each side sent per
+ * handshake, and the mean time in microseconds of the key exchange
+ * steps: the server building ServerKeyExchange (ske_build) and
+ * processing ClientKeyExchange (cke_proc), and the client processing
+ * ServerKeyExchange (ske_proc) and building ClientKeyExchange
+ * (cke_build).  Each step includes the record layer work for its
+ * message, and resumed handshakes have none of them.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <openssl/crypto.h>
+#include <openssl/bio.h>
+#include <openssl/bn.h>
+#include <openssl/rsa.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+
+#if defined(OPENSSL_THREADS) && !defined(OPENSSL_SYS_WINDOWS)
+# define SSLBENCH_PTHREADS
+# include <pthread.h>
+#endif
+
+#define MAX_THREADS 256
+
+/* Give up on a handshake that has not finished after this many rounds */
+#define MAX_ROUNDS 32
+
+enum {
+    PHASE_SKE_BUILD,            /* server */
+    PHASE_SKE_PROC,             /* client */
+    PHASE_CKE_BUILD,            /* client */
+    PHASE_CKE_PROC,             /* server */
+    PHASE_NUM
+};
+
+static const char *phase_names[PHASE_NUM] = {
+    "ske_build", "ske_proc", "cke_build", "cke_proc"
+};
+
+static const char *default_suites[] = {
+#ifndef OPENSSL_NO_RINGLWE
+    TLS1_TXT_RLWE_RSA_WITH_AES_128_GCM_SHA256,
+    TLS1_TXT_RLWE_ECDSA_WITH_AES_128_GCM_SHA256,
+    TLS1_TXT_RLWEP_RSA_WITH_AES_128_GCM_SHA256,
+    TLS1_TXT_RLWEP_ECDSA_WITH_AES_128_GCM_SHA256,
+# ifdef OPENSSL_HYBRID_RLWE_ECDHE
+    TLS1_TXT_RLWE_ECDHE_RSA_WITH_AES_128_GCM_SHA256,
+    TLS1_TXT_RLWE_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256,
+    TLS1_TXT_RLWEP_ECDHE_RSA_WITH_AES_128_GCM_SHA256,
+    TLS1_TXT_RLWEP_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256,
+# endif
+#endif
+    TLS1_TXT_ECDHE_RSA_WITH_AES_128_GCM_SHA256,
+    TLS1_TXT_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256,
+    NULL
+};
+
+/* Key exchange timing of one side of a connection, kept as app data */
+typedef struct {
+    double last;                /* time of the last state change */
+    double phase[PHASE_NUM];
+} HS_TIMER;
+
+/* What one thread measured for one suite and handshake type */
+typedef struct {
+    SSL_CTX *s_ctx, *c_ctx;
+    int resume;
+    double seconds;
+    long handshakes, reused, failed;
+    double elapsed;
+    double c_bytes, s_bytes;
+    double phase[PHASE_NUM];
+} BENCH_JOB;
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*
+ * The handshake functions report each state they leave, with the state
+ * still set, so the time since the previous report (or since the call
+ * was entered, see do_handshake) is the time spent in that state.
+ */
+static void info_cb(const SSL *s, int where, int ret)
+{
+    HS_TIMER *t = SSL_get_app_data(s);
+    double tm;
+    int phase;
+
+    if (t == NULL || !(where & SSL_CB_LOOP))
+        return;
+    tm = now();
+    switch (SSL_state(s)) {
+    case SSL3_ST_SW_KEY_EXCH_A:
+    case SSL3_ST_SW_KEY_EXCH_B:
+        phase = PHASE_SKE_BUILD;
+        break;
+    case SSL3_ST_CR_KEY_EXCH_A:
+    case SSL3_ST_CR_KEY_EXCH_B:
+        phase = PHASE_SKE_PROC;
+        break;
+    case SSL3_ST_CW_KEY_EXCH_A:
+    case SSL3_ST_CW_KEY_EXCH_B:
+        phase = PHASE_CKE_BUILD;
+        break;
+    case SSL3_ST_SR_KEY_EXCH_A:
+    case SSL3_ST_SR_KEY_EXCH_B:
+        phase = PHASE_CKE_PROC;
+        break;
+    default:
+        phase = -1;
+    }
+    if (phase >= 0)
+        t->phase[phase] += tm - t->last;
+    t->last = tm;
+}
+
+/*
+ * Advance one side as far as it goes.  Returns 1 once its handshake is
+ * complete, 0 if it is waiting for its peer and -1 on error.
+ */
+static int do_handshake(SSL *s, HS_TIMER *t)
+{
+    int ret;
+
+    t->last = now();
+    ret = SSL_do_handshake(s);
+    if (ret == 1)
+        return 1;
+    if (SSL_get_error(s, ret) == SSL_ERROR_WANT_READ)
+        return 0;
+    return -1;
+}
+
+/*
+ * One handshake on a fresh pair of connections, resuming sess if it is
+ * not NULL.  Returns the client's session, or NULL on failure.
+ */
+static SSL_SESSION *handshake(BENCH_JOB *job, SSL_SESSION *sess)
+{
+    SSL *c = NULL, *s = NULL;
+    BIO *c_bio = NULL, *s_bio = NULL;
+    HS_TIMER c_timer, s_timer;
+    SSL_SESSION *ret = NULL;
+    int i, rc = 0, rs = 0;
+
+    memset(&c_timer, 0, sizeof(c_timer));
+    memset(&s_timer, 0, sizeof(s_timer));
+    if ((c = SSL_new(job->c_ctx)) == NULL
+        || (s = SSL_new(job->s_ctx)) == NULL
+        || !BIO_new_bio_pair(&c_bio, 0, &s_bio, 0))
+        goto end;
+    SSL_set_bio(c, c_bio, c_bio);
+    SSL_set_bio(s, s_bio, s_bio);
+    SSL_set_connect_state(c);
+    SSL_set_accept_state(s);
+    SSL_set_app_data(c, &c_timer);
+    SSL_set_app_data(s, &s_timer);
+    if (sess != NULL && !SSL_set_session(c, sess))
+        goto end;
+
+    for (i = 0; i < MAX_ROUNDS && (rc != 1 || rs != 1); i++) {
+        if ((rc = do_handshake(c, &c_timer)) < 0
+            || (rs = do_handshake(s, &s_timer)) < 0)
+            goto end;
+    }
+    if (rc != 1 || rs != 1)
+        goto end;
+
+    job->handshakes++;
+    if (SSL_session_reused(c))
+        job->reused++;
+    /* The SSLs own the BIO pair and keep it until they are freed */
+    job->c_bytes += BIO_number_written(c_bio);
+    job->s_bytes += BIO_number_written(s_bio);
+    for (i = 0; i < PHASE_NUM; i++)
+        job->phase[i] += c_timer.phase[i] + s_timer.phase[i];
+    ret = SSL_get1_session(c);
+
+ end:
+    if (ret == NULL) {
+        job->failed++;
+        ERR_clear_error();
+    }
+    if (c != NULL)
+        SSL_free(c);
+    else
+        BIO_free(c_bio);
+    if (s != NULL)
+        SSL_free(s);
+    else
+        BIO_free(s_bio);
+    return ret;
+}
+
+static void *run_job(void *arg)
+{
+    BENCH_JOB *job = arg;
+    SSL_SESSION *sess = NULL, *next;
+    double start, end;
+
+    /* The session to resume comes from a full handshake we do not count */
+    if (job->resume) {
+        sess = handshake(job, NULL);
+        job->handshakes = job->reused = job->failed = 0;
+        job->c_bytes = job->s_bytes = 0;
+        memset(job->phase, 0, sizeof(job->phase));
+        if (sess == NULL) {
+            job->failed = 1;
+            return NULL;
+        }
+    }
+
+    start = now();
+    end = start + job->seconds;
+    do {
+        next = handshake(job, sess);
+        if (next == NULL)
+            break;
+        SSL_SESSION_free(next);
+    } while (now() < end);
+    job->elapsed = now() - start;
+
+    if (sess != NULL)
+        SSL_SESSION_free(sess);
+    return NULL;
+}
+
+#ifdef SSLBENCH_PTHREADS
+static pthread_mutex_t *lock_cs;
+
+static void locking_cb(int mode, int type, const char *file, int line)
+{
+    if (mode & CRYPTO_LOCK)
+        pthread_mutex_lock(&lock_cs[type]);
+    else
+        pthread_mutex_unlock(&lock_cs[type]);
+}
+
+static void threadid_cb(CRYPTO_THREADID *tid)
+{
+    CRYPTO_THREADID_set_numeric(tid, (unsigned long)pthread_self());
+}
+
+static int thread_setup(void)
+{
+    int i;
+
+    lock_cs = OPENSSL_malloc(CRYPTO_num_locks() * sizeof(pthread_mutex_t));
+    if (lock_cs == NULL)
+        return 0;
+    for (i = 0; i < CRYPTO_num_locks(); i++)
+        pthread_mutex_init(&lock_cs[i], NULL);
+    CRYPTO_THREADID_set_callback(threadid_cb);
+    CRYPTO_set_locking_callback(locking_cb);
+    return 1;
+}
+
+static void thread_cleanup(void)
+{
+    int i;
+
+    if (lock_cs == NULL)
+        return;
+    CRYPTO_set_locking_callback(NULL);
+    for (i = 0; i < CRYPTO_num_locks(); i++)
+        pthread_mutex_destroy(&lock_cs[i]);
+    OPENSSL_free(lock_cs);
+}
+#endif
+
+/* A self-signed certificate for key, so that no files are needed */
+static X509 *make_cert(EVP_PKEY *key)
+{
+    X509 *x = X509_new();
+    X509_NAME *name;
+
+    if (x == NULL
+        || !X509_set_version(x, 2)
+        || !ASN1_INTEGER_set(X509_get_serialNumber(x), 1)
+        || X509_gmtime_adj(X509_get_notBefore(x), 0) == NULL
+        || X509_gmtime_adj(X509_get_notAfter(x), 60 * 60 * 24) == NULL
+        || !X509_set_pubkey(x, key)
+        || (name = X509_get_subject_name(x)) == NULL
+        || !X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                                       (unsigned char *)"sslbench", -1, -1,
+                                       0)
+        || !X509_set_issuer_name(x, name)
+        || !X509_sign(x, key, EVP_sha256())) {
+        X509_free(x);
+        return NULL;
+    }
+    return x;
+}
+
+static int use_key(SSL_CTX *ctx, EVP_PKEY *key)
+{
+    X509 *x;
+    int ret;
+
+    if ((x = make_cert(key)) == NULL)
+        return 0;
+    ret = SSL_CTX_use_certificate(ctx, x) && SSL_CTX_use_PrivateKey(ctx, key);
+    X509_free(x);
+    return ret;
+}
+
+/* A server context with an RSA and an ECDSA certificate */
+static SSL_CTX *server_ctx(void)
+{
+    SSL_CTX *ctx = SSL_CTX_new(TLSv1_2_server_method());
+    EVP_PKEY *rsa_key = EVP_PKEY_new(), *ec_key = EVP_PKEY_new();
+    RSA *rsa = RSA_new();
+    EC_KEY *ec = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1);
+    BIGNUM *e = BN_new();
+    int ok = 0;
+
+    if (ctx == NULL || rsa_key == NULL || ec_key == NULL || rsa == NULL
+        || ec == NULL || e == NULL
+        || !BN_set_word(e, RSA_F4)
+        || !RSA_generate_key_ex(rsa, 2048, e, NULL)
+        || !EVP_PKEY_assign_RSA(rsa_key, rsa))
+        goto end;
+    rsa = NULL;
+    EC_KEY_set_asn1_flag(ec, OPENSSL_EC_NAMED_CURVE);
+    if (!EC_KEY_generate_key(ec) || !EVP_PKEY_assign_EC_KEY(ec_key, ec))
+        goto end;
+    ec = NULL;
+    if (!use_key(ctx, rsa_key) || !use_key(ctx, ec_key))
+        goto end;
+    SSL_CTX_set_ecdh_auto(ctx, 1);
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+    ok = 1;
+
+ end:
+    if (!ok) {
+        SSL_CTX_free(ctx);
+        ctx = NULL;
+    }
+    EVP_PKEY_free(rsa_key);
+    EVP_PKEY_free(ec_key);
+    RSA_free(rsa);
+    EC_KEY_free(ec);
+    BN_free(e);
+    return ctx;
+}
+
+/* Run one suite and handshake type on nthreads threads and print its row */
+static int bench_suite(SSL_CTX *s_ctx, SSL_CTX *c_ctx, const char *suite,
+                       int resume, int nthreads, double seconds)
+{
+    BENCH_JOB *jobs;
+    double rate = 0, c_bytes = 0, s_bytes = 0, phase[PHASE_NUM];
+    long handshakes = 0, reused = 0, failed = 0;
+    int i;
+#ifdef SSLBENCH_PTHREADS
+    pthread_t threads[MAX_THREADS];
+#endif
+
+    if (!SSL_CTX_set_cipher_list(c_ctx, suite)) {
+        fprintf(stderr, "sslbench: unknown suite %s\n", suite);
+        return 0;
+    }
+    SSL_CTX_flush_sessions(s_ctx, 0);
+
+    jobs = OPENSSL_malloc(nthreads * sizeof(*jobs));
+    if (jobs == NULL)
+        return 0;
+    memset(jobs, 0, nthreads * sizeof(*jobs));
+    for (i = 0; i < nthreads; i++) {
+        jobs[i].s_ctx = s_ctx;
+        jobs[i].c_ctx = c_ctx;
+        jobs[i].resume = resume;
+        jobs[i].seconds = seconds;
+    }
+#ifdef SSLBENCH_PTHREADS
+    for (i = 0; i < nthreads; i++)
+        pthread_create(&threads[i], NULL, run_job, &jobs[i]);
+    for (i = 0; i < nthreads; i++)
+        pthread_join(threads[i], NULL);
+#else
+    run_job(&jobs[0]);
+#endif
+
+    memset(phase, 0, sizeof(phase));
+    for (i = 0; i < nthreads; i++) {
+        int j;
+
+        if (jobs[i].elapsed > 0)
+            rate += jobs[i].handshakes / jobs[i].elapsed;
+        handshakes += jobs[i].handshakes;
+        reused += jobs[i].reused;
+        failed += jobs[i].failed;
+        c_bytes += jobs[i].c_bytes;
+        s_bytes += jobs[i].s_bytes;
+        for (j = 0; j < PHASE_NUM; j++)
+            phase[j] += jobs[i].phase[j];
+    }
+    OPENSSL_free(jobs);
+
+    printf("%s,%s,%d,%ld,%ld,%ld,%.1f", suite, resume ? "resumed" : "full",
+           nthreads, handshakes, reused, failed, rate);
+    if (handshakes == 0) {
+        printf(",,");
+        for (i = 0; i < PHASE_NUM; i++)
+            printf(",");
+        printf("\n");
+        return failed == 0;
+    }
+    printf(",%.0f,%.0f", c_bytes / handshakes, s_bytes / handshakes);
+    for (i = 0; i < PHASE_NUM; i++)
+        printf(",%.1f", phase[i] * 1e6 / handshakes);
+    printf("\n");
+    fflush(stdout);
+    return failed == 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+    const char **suites = default_suites;
+    const char *user_suites[64];
+    int nsuites = 0, nthreads = 1, client_key = 0, compress = 0;
+    double seconds = 3;
+    int i, ret = 1;
+
+    for (argc--, argv++; argc > 0; argc--, argv++) {
+        if (strcmp(*argv, "-threads") == 0 && argc > 1) {
+            nthreads = atoi(*++argv);
+            argc--;
+        } else if (strcmp(*argv, "-time") == 0 && argc > 1) {
+            seconds = atof(*++argv);
+            argc--;
+        } else if (strcmp(*argv, "-cipher") == 0 && argc > 1
+                   && nsuites < (int)(sizeof(user_suites) /
+                                      sizeof(user_suites[0])) - 1) {
+            user_suites[nsuites++] = *++argv;
+            argc--;
+        } else if (strcmp(*argv, "-rlwe_client_key") == 0) {
+            client_key = 1;
+        } else if (strcmp(*argv, "-rlwe_compress") == 0) {
+            compress = 1;
+        } else {
+            fprintf(stderr, "usage: sslbench [-threads n] [-time secs] "
+                    "[-rlwe_client_key] [-rlwe_compress] [-cipher suite]...\n");
+            return 1;
+        }
+    }
+    if (nthreads < 1 || nthreads > MAX_THREADS || seconds <= 0) {
+        fprintf(stderr, "sslbench: bad -threads or -time\n");
+        return 1;
+    }
+#ifndef SSLBENCH_PTHREADS
+    if (nthreads > 1) {
+        fprintf(stderr, "sslbench: no thread support, using one thread\n");
+        nthreads = 1;
+    }
+#endif
+    if (nsuites > 0) {
+        user_suites[nsuites] = NULL;
+        suites = user_suites;
+    }
+
+    SSL_library_init();
+    SSL_load_error_strings();
+#ifdef SSLBENCH_PTHREADS
+    if (!thread_setup())
+        goto end;
+#endif
+
+    if ((s_ctx = server_ctx()) == NULL
+        || (c_ctx = SSL_CTX_new(TLSv1_2_client_method())) == NULL)
+        goto end;
+    SSL_CTX_set_session_cache_mode(c_ctx, SSL_SESS_CACHE_OFF);
+    SSL_CTX_set_info_callback(s_ctx, info_cb);
+    SSL_CTX_set_info_callback(c_ctx, info_cb);
+#ifndef OPENSSL_NO_RINGLWE
+    if (client_key) {
+        SSL_CTX_set_rlwe_client_key(c_ctx, 1);
+        SSL_CTX_set_rlwe_client_key(s_ctx, 1);
+    }
+    if (compress) {
+        SSL_CTX_set_rlwe_compression(c_ctx, 1);
+        SSL_CTX_set_rlwe_compression(s_ctx, 1);
+    }
+#endif
+
+    printf("suite,handshake,threads,handshakes,reused,failed,"
+           "handshakes_per_sec,client_bytes,server_bytes");
+    for (i = 0; i < PHASE_NUM; i++)
+        printf(",%s_us", phase_names[i]);
+    printf("\n");
+
+    ret = 0;
+    for (i = 0; suites[i] != NULL; i++) {
+        if (!bench_suite(s_ctx, c_ctx, suites[i], 0, nthreads, seconds))
+            ret = 1;
+        if (!bench_suite(s_ctx, c_ctx, suites[i], 1, nthreads, seconds))
+            ret = 1;
+    }
+
+ end:
+    if (ret)
+        ERR_print_errors_fp(stderr);
+    SSL_CTX_free(s_ctx);
+    SSL_CTX_free(c_ctx);
+#ifdef SSLBENCH_PTHREADS
+    thread_cleanup();
+#endif
+    ERR_remove_thread_state(NULL);
+    ERR_free_strings();
+    EVP_cleanup();
+    CRYPTO_cleanup_all_ex_data();
+    return ret;
+}
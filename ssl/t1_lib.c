@@ -981,6 +981,174 @@ static int tls1_check_cert_param(SSL *s, X509 *x, int set_ee_md)
 
 #endif                          /* OPENSSL_NO_EC */
 
+#if !defined(OPENSSL_NO_TLSEXT) && !defined(OPENSSL_NO_RINGLWE)
+
+/*
+ * RLWE parameter sets by TLS identifier (the index plus one), and the key
+ * exchange each is used with: sets with m a power of two go with kRLWE,
+ * those with m prime with kRLWE_PRIME.
+ */
+typedef struct {
+    int nid;
+    unsigned long alg_k;
+} tls_rlwe_param_info;
+
+static const tls_rlwe_param_info rlwe_param_list[] = {
+    {NID_ringLearningWithErrors_1024_40961, SSL_kRLWE}, /* 1 */
+    {NID_ringLearningWithErrors_512_25601, SSL_kRLWE}, /* 2 */
+    {NID_ringLearningWithErrors_256_15361, SSL_kRLWE}, /* 3 */
+    {NID_ringLearningWithErrors_821_49261, SSL_kRLWE_PRIME}, /* 4 */
+    {NID_ringLearningWithErrors_739_47297, SSL_kRLWE_PRIME}, /* 5 */
+    {NID_ringLearningWithErrors_631_44171, SSL_kRLWE_PRIME}, /* 6 */
+    {NID_ringLearningWithErrors_541_41117, SSL_kRLWE_PRIME}, /* 7 */
+    {NID_ringLearningWithErrors_433_35507, SSL_kRLWE_PRIME}, /* 8 */
+    {NID_ringLearningWithErrors_337_32353, SSL_kRLWE_PRIME}, /* 9 */
+};
+
+static int tls1_rlwe_nid2id(int nid)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(rlwe_param_list) / sizeof(rlwe_param_list[0]); i++)
+        if (rlwe_param_list[i].nid == nid)
+            return i + 1;
+    return 0;
+}
+
+/* NID for identifier |id| if it is usable with key exchange |alg_k| */
+static int tls1_rlwe_id2nid(int id, unsigned long alg_k)
+{
+    if (id < 1 || id > (int)(sizeof(rlwe_param_list) /
+                             sizeof(rlwe_param_list[0])))
+        return NID_undef;
+    if (!(rlwe_param_list[id - 1].alg_k & alg_k))
+        return NID_undef;
+    return rlwe_param_list[id - 1].nid;
+}
+
+static int tls1_rlwe_list_has(const unsigned char *list, size_t len, int id)
+{
+    size_t i;
+
+    for (i = 0; i + 1 < len; i += 2)
+        if (((list[i] << 8) | list[i + 1]) == id)
+            return 1;
+    return 0;
+}
+
+int tls1_set_rlwe_params(unsigned char **pext, size_t *pextlen,
+                         const int *nids, size_t nnids)
+{
+    unsigned char *plist, *p;
+    unsigned long dup_list = 0;
+    size_t i;
+    int id;
+
+    plist = OPENSSL_malloc(nnids * 2);
+    if (plist == NULL)
+        return 0;
+    for (i = 0, p = plist; i < nnids; i++) {
+        id = tls1_rlwe_nid2id(nids[i]);
+        if (!id || (dup_list & (1L << id))) {
+            OPENSSL_free(plist);
+            return 0;
+        }
+        dup_list |= 1L << id;
+        s2n(id, p);
+    }
+    if (*pext)
+        OPENSSL_free(*pext);
+    *pext = plist;
+    *pextlen = nnids * 2;
+    return 1;
+}
+
+/*
+ * Server side: the parameter set to use with key exchange |alg_k|, or
+ * NID_undef if there is none in common.  If the client sent no list, the
+ * fixed set for |alg_k| is used.  Otherwise the server's own list, if it
+ * has one, gives the order of preference, failing which the client's
+ * does.
+ */
+int tls1_rlwe_nid(SSL *s, unsigned long alg_k)
+{
+    const unsigned char *pref, *supp = NULL;
+    size_t preflen, supplen = 0, i;
+    int nid;
+
+    if (s->tlsext_peer_rlweparamslist == NULL) {
+        nid = rlwe_nid(alg_k);
+        if (s->tlsext_rlweparamslist != NULL &&
+            !tls1_rlwe_list_has(s->tlsext_rlweparamslist,
+                                s->tlsext_rlweparamslist_length,
+                                tls1_rlwe_nid2id(nid)))
+            return NID_undef;
+        return nid;
+    }
+    pref = s->tlsext_peer_rlweparamslist;
+    preflen = s->tlsext_peer_rlweparamslist_length;
+    if (s->tlsext_rlweparamslist != NULL) {
+        supp = pref;
+        supplen = preflen;
+        pref = s->tlsext_rlweparamslist;
+        preflen = s->tlsext_rlweparamslist_length;
+    }
+    for (i = 0; i + 1 < preflen; i += 2) {
+        int id = (pref[i] << 8) | pref[i + 1];
+
+        nid = tls1_rlwe_id2nid(id, alg_k);
+        if (nid != NID_undef &&
+            (supp == NULL || tls1_rlwe_list_has(supp, supplen, id)))
+            return nid;
+    }
+    return NID_undef;
+}
+
+/*
+ * Whether the peer's choice of |nid| for key exchange |alg_k| is acceptable:
+ * it must be in our own list or, for a server without one, in the list the
+ * client sent; if there is neither it must be the fixed set for |alg_k|.
+ */
+int tls1_check_rlwe_nid(SSL *s, int nid, unsigned long alg_k)
+{
+    const unsigned char *list = s->tlsext_rlweparamslist;
+    size_t len = s->tlsext_rlweparamslist_length;
+    int id = tls1_rlwe_nid2id(nid);
+
+    if (list == NULL) {
+        list = s->tlsext_peer_rlweparamslist;
+        len = s->tlsext_peer_rlweparamslist_length;
+    }
+    if (list == NULL)
+        return nid == rlwe_nid(alg_k);
+    return tls1_rlwe_id2nid(id, alg_k) != NID_undef &&
+        tls1_rlwe_list_has(list, len, id);
+}
+
+/*
+ * Client side: the parameter set of the key to send in the ClientHello,
+ * given the plain RLWE key exchanges |alg_k| we offer.  This is our most
+ * preferred set usable with one of them or, if we have no list, the fixed
+ * set for kRLWE if offered, else that for kRLWE_PRIME.
+ */
+static int tls1_rlwe_client_key_nid(SSL *s, unsigned long alg_k)
+{
+    const unsigned char *list = s->tlsext_rlweparamslist;
+    size_t i;
+    int nid;
+
+    if (list == NULL)
+        return rlwe_nid(alg_k & SSL_kRLWE ? SSL_kRLWE : SSL_kRLWE_PRIME);
+    for (i = 0; i + 1 < s->tlsext_rlweparamslist_length; i += 2) {
+        nid = tls1_rlwe_id2nid((list[i] << 8) | list[i + 1], alg_k);
+        if (nid != NID_undef)
+            return nid;
+    }
+    return NID_undef;
+}
+
+#endif                          /* !OPENSSL_NO_TLSEXT && !OPENSSL_NO_RINGLWE */
+
 #ifndef OPENSSL_NO_TLSEXT
 
 /*
@@ -1230,6 +1398,10 @@ unsigned char *ssl_add_clienthello_tlsext(SSL *s, unsigned char *buf,
     int extdatalen = 0;
     unsigned char *orig = buf;
     unsigned char *ret = buf;
+# ifndef OPENSSL_NO_RINGLWE
+    int using_rlwe = 0;
+    unsigned long rlwe_mkey = 0; /* RLWE key exchanges without ECDHE */
+# endif
 # ifndef OPENSSL_NO_EC
     /* See if we support any ECC ciphersuites */
     int using_ecc = 0;
@@ -1251,6 +1423,23 @@ unsigned char *ssl_add_clienthello_tlsext(SSL *s, unsigned char *buf,
         }
     }
 # endif
+# ifndef OPENSSL_NO_RINGLWE
+    /* See if we offer any RLWE ciphersuites */
+    {
+        int i;
+        STACK_OF(SSL_CIPHER) *cipher_stack = SSL_get_ciphers(s);
+
+        for (i = 0; i < sk_SSL_CIPHER_num(cipher_stack); i++) {
+            SSL_CIPHER *c = sk_SSL_CIPHER_value(cipher_stack, i);
+
+            if (c->algorithm_mkey & (SSL_kRLWE | SSL_kRLWE_PRIME)) {
+                using_rlwe = 1;
+                if (!(c->algorithm_mkey & SSL_kEECDH))
+                    rlwe_mkey |= c->algorithm_mkey;
+            }
+        }
+    }
+# endif
 
     /* don't add extensions for SSLv3 unless doing secure renegotiation */
     if (s->client_version == SSL3_VERSION && !s->s3->send_connection_binding)
@@ -1396,6 +1585,64 @@ unsigned char *ssl_add_clienthello_tlsext(SSL *s, unsigned char *buf,
     }
 # endif                         /* OPENSSL_NO_EC */
 
+# ifndef OPENSSL_NO_RINGLWE
+    /* Add the RLWE parameter sets we support if any is configured */
+    if (using_rlwe && s->tlsext_rlweparamslist != NULL) {
+        long lenmax;
+        size_t plist_len = s->tlsext_rlweparamslist_length;
+
+        if ((lenmax = limit - ret - 6) < 0)
+            return NULL;
+        if (plist_len > (size_t)lenmax)
+            return NULL;
+        if (plist_len > 65532) {
+            SSLerr(SSL_F_SSL_ADD_CLIENTHELLO_TLSEXT, ERR_R_INTERNAL_ERROR);
+            return NULL;
+        }
+        s2n(TLSEXT_TYPE_rlwe_params, ret);
+        s2n(plist_len + 2, ret);
+        s2n(plist_len, ret);
+        memcpy(ret, s->tlsext_rlweparamslist, plist_len);
+        ret += plist_len;
+    }
+
+    /*
+     * Send a public key for the server to encapsulate against, which saves
+     * it generating one of its own (see ssl_rlwe_encapsulate).  Not when
+     * offering a session to resume, as then there is usually no key exchange
+     */
+    if (rlwe_mkey && s->cert->rlwe_client_key
+        && s->session->session_id_length == 0
+        && s->session->tlsext_tick == NULL) {
+        RLWE_PUB *pub;
+        int nid = tls1_rlwe_client_key_nid(s, rlwe_mkey), publen;
+
+        if (nid != NID_undef) {
+            if (!ssl_rlwe_client_key(s, nid)) {
+                SSLerr(SSL_F_SSL_ADD_CLIENTHELLO_TLSEXT, ERR_R_RLWE_LIB);
+                return NULL;
+            }
+            pub = RLWE_PAIR_get_publickey(s->s3->tmp.rlwe);
+            publen = RLWE_PUB_encode(pub, NULL, 0);
+            if (publen == 0 || limit - ret - 4 - publen < 0)
+                return NULL;
+            s2n(TLSEXT_TYPE_rlwe_client_key, ret);
+            s2n(publen, ret);
+            if (RLWE_PUB_encode(pub, ret, publen) == 0)
+                return NULL;
+            ret += publen;
+        }
+    }
+
+    /* Offer compressed public keys if a parameter set might use them */
+    if ((rlwe_mkey & SSL_kRLWE) && s->cert->rlwe_compressed) {
+        if ((long)(limit - ret - 4) < 0)
+            return NULL;
+        s2n(TLSEXT_TYPE_rlwe_compressed, ret);
+        s2n(0, ret);
+    }
+# endif
+
     if (!(SSL_get_options(s) & SSL_OP_NO_TICKET)) {
         int ticklen;
         if (!s->new_session && s->session && s->session->tlsext_tick)
@@ -1688,6 +1935,22 @@ unsigned char *ssl_add_serverhello_tlsext(SSL *s, unsigned char *buf,
      * extension
      */
 # endif                         /* OPENSSL_NO_EC */
+# ifndef OPENSSL_NO_RINGLWE
+    /* Tell the client we are encapsulating against its key */
+    if (s->s3->tmp.rlwe_client_key) {
+        if ((long)(limit - ret - 4) < 0)
+            return NULL;
+        s2n(TLSEXT_TYPE_rlwe_client_key, ret);
+        s2n(0, ret);
+    }
+    /* Tell the client we accept compressed keys, and will send them */
+    if (s->s3->tmp.rlwe_compressed) {
+        if ((long)(limit - ret - 4) < 0)
+            return NULL;
+        s2n(TLSEXT_TYPE_rlwe_compressed, ret);
+        s2n(0, ret);
+    }
+# endif
 
     if (s->tlsext_ticket_expected && !(SSL_get_options(s) & SSL_OP_NO_TICKET)) {
         if ((long)(limit - ret - 4) < 0)
@@ -2016,6 +2279,20 @@ static int ssl_scan_clienthello_tlsext(SSL *s, unsigned char **p,
 
     s->srtp_profile = NULL;
 
+# ifndef OPENSSL_NO_RINGLWE
+    if (s->tlsext_peer_rlweparamslist) {
+        OPENSSL_free(s->tlsext_peer_rlweparamslist);
+        s->tlsext_peer_rlweparamslist = NULL;
+        s->tlsext_peer_rlweparamslist_length = 0;
+    }
+    if (s->tlsext_peer_rlwepub) {
+        OPENSSL_free(s->tlsext_peer_rlwepub);
+        s->tlsext_peer_rlwepub = NULL;
+        s->tlsext_peer_rlwepub_length = 0;
+    }
+    s->s3->tmp.rlwe_compressed = 0;
+# endif
+
     if (data == limit)
         goto ri_check;
 
@@ -2214,6 +2491,43 @@ static int ssl_scan_clienthello_tlsext(SSL *s, unsigned char **p,
 #  endif
         }
 # endif                         /* OPENSSL_NO_EC */
+# ifndef OPENSSL_NO_RINGLWE
+        else if (type == TLSEXT_TYPE_rlwe_params) {
+            unsigned char *sdata = data;
+            int plist_length;
+
+            if (size < 2)
+                goto err;
+            n2s(sdata, plist_length);
+            /* Each parameter set is 2 bytes; a second list is an error */
+            if (plist_length != size - 2 || plist_length < 2 ||
+                plist_length & 1 || s->tlsext_peer_rlweparamslist != NULL)
+                goto err;
+            s->tlsext_peer_rlweparamslist = BUF_memdup(sdata, plist_length);
+            if (s->tlsext_peer_rlweparamslist == NULL) {
+                *al = TLS1_AD_INTERNAL_ERROR;
+                return 0;
+            }
+            s->tlsext_peer_rlweparamslist_length = plist_length;
+        }
+        else if (type == TLSEXT_TYPE_rlwe_client_key) {
+            /* Checked once the cipher is chosen, if we accept such keys */
+            if (size == 0 || s->tlsext_peer_rlwepub != NULL)
+                goto err;
+            s->tlsext_peer_rlwepub = BUF_memdup(data, size);
+            if (s->tlsext_peer_rlwepub == NULL) {
+                *al = TLS1_AD_INTERNAL_ERROR;
+                return 0;
+            }
+            s->tlsext_peer_rlwepub_length = size;
+        }
+        else if (type == TLSEXT_TYPE_rlwe_compressed) {
+            /* Taken up once the cipher is chosen, if we accept such keys */
+            if (size != 0)
+                goto err;
+            s->s3->tmp.rlwe_compressed = 1;
+        }
+# endif
 # ifdef TLSEXT_TYPE_opaque_prf_input
         else if (type == TLSEXT_TYPE_opaque_prf_input) {
             unsigned char *sdata = data;
@@ -2530,6 +2844,10 @@ static int ssl_scan_serverhello_tlsext(SSL *s, unsigned char **p,
     s->s3->next_proto_neg_seen = 0;
 # endif
     s->tlsext_ticket_expected = 0;
+# ifndef OPENSSL_NO_RINGLWE
+    s->s3->tmp.rlwe_client_key = 0;
+    s->s3->tmp.rlwe_compressed = 0;
+# endif
 
     if (s->s3->alpn_selected) {
         OPENSSL_free(s->s3->alpn_selected);
@@ -2599,6 +2917,37 @@ static int ssl_scan_serverhello_tlsext(SSL *s, unsigned char **p,
 #  endif
         }
 # endif                         /* OPENSSL_NO_EC */
+# ifndef OPENSSL_NO_RINGLWE
+        else if (type == TLSEXT_TYPE_rlwe_client_key) {
+            unsigned long alg_k = s->s3->tmp.new_cipher->algorithm_mkey;
+
+            /*
+             * Only valid for a full handshake with a plain RLWE key exchange
+             * that our key can be used with
+             */
+            if (size != 0 || s->hit || s->s3->tmp.rlwe == NULL
+                || !(alg_k & (SSL_kRLWE | SSL_kRLWE_PRIME))
+                || (alg_k & SSL_kEECDH)
+                || tls1_rlwe_id2nid(tls1_rlwe_nid2id
+                                    (RLWE_PAIR_get_nid(s->s3->tmp.rlwe)),
+                                    alg_k) == NID_undef) {
+                *al = TLS1_AD_UNSUPPORTED_EXTENSION;
+                return 0;
+            }
+            s->s3->tmp.rlwe_client_key = 1;
+        }
+        else if (type == TLSEXT_TYPE_rlwe_compressed) {
+            unsigned long alg_k = s->s3->tmp.new_cipher->algorithm_mkey;
+
+            /* Only if we offered it, for a plain RLWE key exchange */
+            if (size != 0 || s->hit || !s->cert->rlwe_compressed
+                || !(alg_k & SSL_kRLWE) || (alg_k & SSL_kEECDH)) {
+                *al = TLS1_AD_UNSUPPORTED_EXTENSION;
+                return 0;
+            }
+            s->s3->tmp.rlwe_compressed = 1;
+        }
+# endif
 
         else if (type == TLSEXT_TYPE_session_ticket) {
             if (s->tls_session_ticket_ext_cb &&
@@ -3024,6 +3373,46 @@ int ssl_check_clienthello_tlsext_late(SSL *s)
     int ret = SSL_TLSEXT_ERR_OK;
     int al;
 
+# ifndef OPENSSL_NO_RINGLWE
+    /*
+     * Take up the RLWE key from the ClientHello if we accept such keys, this
+     * is a full handshake with a plain RLWE key exchange, and the key's
+     * parameter set is one we would have chosen ourselves.
+     */
+    s->s3->tmp.rlwe_client_key = 0;
+    if (s->tlsext_peer_rlwepub != NULL && s->cert->rlwe_client_key
+        && !s->hit) {
+        unsigned long alg_k = s->s3->tmp.new_cipher->algorithm_mkey;
+        RLWE_PUB_VIEW view;
+
+        if ((alg_k & (SSL_kRLWE | SSL_kRLWE_PRIME))
+            && !(alg_k & SSL_kEECDH)) {
+            if (!RLWE_PUB_VIEW_init(&view, s->tlsext_peer_rlwepub,
+                                    s->tlsext_peer_rlwepub_length)) {
+                ret = SSL_TLSEXT_ERR_ALERT_FATAL;
+                al = SSL_AD_DECODE_ERROR;
+                goto err;
+            }
+            if (tls1_check_rlwe_nid(s, RLWE_get_nid_from_descriptor
+                                    (s->tlsext_peer_rlwepub), alg_k))
+                s->s3->tmp.rlwe_client_key = 1;
+        }
+    }
+
+    /*
+     * Agree to compressed keys if the client offered them, we accept them
+     * and this is a full handshake with a plain RLWE key exchange whose
+     * parameter sets can be compressed.
+     */
+    if (s->s3->tmp.rlwe_compressed) {
+        unsigned long alg_k = s->s3->tmp.new_cipher->algorithm_mkey;
+
+        if (!s->cert->rlwe_compressed || s->hit || !(alg_k & SSL_kRLWE)
+            || (alg_k & SSL_kEECDH))
+            s->s3->tmp.rlwe_compressed = 0;
+    }
+# endif
+
     /*
      * If status request then ask callback what to do. Note: this must be
      * called after servername callbacks in case the certificate has changed,
@@ -3086,6 +3475,14 @@ int ssl_check_serverhello_tlsext(SSL *s)
     int ret = SSL_TLSEXT_ERR_NOACK;
     int al = SSL_AD_UNRECOGNIZED_NAME;
 
+# ifndef OPENSSL_NO_RINGLWE
+    /* Drop the key we sent in the ClientHello if the server did not use it */
+    if (!s->s3->tmp.rlwe_client_key && s->s3->tmp.rlwe != NULL) {
+        RLWE_PAIR_free(s->s3->tmp.rlwe);
+        s->s3->tmp.rlwe = NULL;
+    }
+# endif
+
 # ifndef OPENSSL_NO_EC
     /*
      * If we are client and using an elliptic curve cryptography cipher
@@ -261,6 +261,14 @@ extern "C" {
 #  define TLSEXT_TYPE_next_proto_neg              13172
 # endif
 
+/*
+ * RLWE parameter sets supported by the client: not an IANA defined
+ * extension number either
+ */
+# define TLSEXT_TYPE_rlwe_params                 0xfe10
+# define TLSEXT_TYPE_rlwe_client_key             0xfe11
+# define TLSEXT_TYPE_rlwe_compressed             0xfe12
+
 /* NameType value from RFC3546 */
 # define TLSEXT_NAMETYPE_host_name 0
 /* status request value from RFC3546 */
@@ -422,6 +422,42 @@ static int verify_alpn(SSL *client, SSL *server)
     return -1;
 }
 
+#ifndef OPENSSL_NO_RINGLWE
+static const char *rlwe_params_client;
+static const char *rlwe_params_server;
+static int rlwe_client_key = 0;
+static int rlwe_compress = 0;
+
+/*
+ * Sets the RLWE parameter sets of |ctx| from |list|, a colon separated
+ * list of short names such as "ringlwe_512:ringlwe_256"
+ */
+static int set_rlwe_params(SSL_CTX *ctx, const char *list)
+{
+    int nids[16];
+    size_t nnids = 0;
+    char name[32];
+    const char *p = list, *q;
+
+    for (;;) {
+        q = strchr(p, ':');
+        if (q == NULL)
+            q = p + strlen(p);
+        if (q - p == 0 || (size_t)(q - p) >= sizeof(name)
+            || nnids == sizeof(nids) / sizeof(nids[0]))
+            return 0;
+        memcpy(name, p, q - p);
+        name[q - p] = '\0';
+        if ((nids[nnids++] = OBJ_sn2nid(name)) == NID_undef)
+            return 0;
+        if (*q == '\0')
+            break;
+        p = q + 1;
+    }
+    return SSL_CTX_set1_rlwe_params(ctx, nids, nnids);
+}
+#endif
+
 #define SCT_EXT_TYPE 18
 
 /*
@@ -758,6 +794,13 @@ static void sv_usage(void)
     fprintf(stderr, " -alpn_server <string> - have server side offer ALPN\n");
     fprintf(stderr,
             " -alpn_expected <string> - the ALPN protocol that should be negotiated\n");
+#ifndef OPENSSL_NO_RINGLWE
+    fprintf(stderr,
+            " -rlwe_params_client <list> - RLWE parameter sets the client offers\n"
+            " -rlwe_params_server <list> - RLWE parameter sets the server accepts\n"
+            " -rlwe_client_key - client sends an RLWE key in its ClientHello\n"
+            " -rlwe_compress - both sides offer compressed RLWE keys\n");
+#endif
 }
 
 static void print_details(SSL *c_ssl, const char *prefix)
@@ -1159,7 +1202,23 @@ int main(int argc, char *argv[])
             if (--argc < 1)
                 goto bad;
             alpn_expected = *(++argv);
-        } else {
+        }
+#ifndef OPENSSL_NO_RINGLWE
+        else if (strcmp(*argv, "-rlwe_params_client") == 0) {
+            if (--argc < 1)
+                goto bad;
+            rlwe_params_client = *(++argv);
+        } else if (strcmp(*argv, "-rlwe_params_server") == 0) {
+            if (--argc < 1)
+                goto bad;
+            rlwe_params_server = *(++argv);
+        } else if (strcmp(*argv, "-rlwe_client_key") == 0) {
+            rlwe_client_key = 1;
+        } else if (strcmp(*argv, "-rlwe_compress") == 0) {
+            rlwe_compress = 1;
+        }
+#endif
+        else {
             fprintf(stderr, "unknown option %s\n", *argv);
             badop = 1;
             break;
@@ -1532,6 +1591,25 @@ int main(int argc, char *argv[])
         OPENSSL_free(alpn);
     }
 
+#ifndef OPENSSL_NO_RINGLWE
+    if (rlwe_params_client && !set_rlwe_params(c_ctx, rlwe_params_client)) {
+        BIO_printf(bio_err, "Error parsing -rlwe_params_client argument\n");
+        goto end;
+    }
+    if (rlwe_params_server && !set_rlwe_params(s_ctx, rlwe_params_server)) {
+        BIO_printf(bio_err, "Error parsing -rlwe_params_server argument\n");
+        goto end;
+    }
+    if (rlwe_client_key) {
+        SSL_CTX_set_rlwe_client_key(c_ctx, 1);
+        SSL_CTX_set_rlwe_client_key(s_ctx, 1);
+    }
+    if (rlwe_compress) {
+        SSL_CTX_set_rlwe_compression(c_ctx, 1);
+        SSL_CTX_set_rlwe_compression(s_ctx, 1);
+    }
+#endif
+
     c_ssl = SSL_new(c_ctx);
     s_ssl = SSL_new(s_ctx);
 
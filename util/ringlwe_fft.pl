@@ -0,0 +1,477 @@
+#!/usr/local/bin/perl -w
+#
+# Generates the power-of-two Number Theoretic Transforms of the Ring-LWE
+# code, crypto/ringlwe/FFT/FFT_<n>_<q>.c, one file per (n, q):
+#
+#  - the negacyclic transforms of the power-of-two parameter sets, for
+#    multiplication in F_q[x]/<x^n+1>, with the 2n'th root twist folded
+#    into the first forward stage and the inverse twist and the n^-1
+#    scaling into the last backward stage;
+#  - the cyclic transforms mod the CRT primes that the Bluestein and Rader
+#    convolutions of the prime-m parameter sets run on, lazily reduced to
+#    [0, 2q).
+#
+# Pairs of layers are merged into radix-4 stages, every loop has constant
+# bounds, and the twiddle factors of each transform are stored once, in
+# the order the stages read them.  The transforms are the same as the
+# radix-2 loops they replace, butterfly for butterfly, so the outputs do
+# not change: the roots below are those that a in ringlwe_consts.h, the
+# Bluestein and Rader tables in FFT_constants.h and the AVX2 tables in
+# FFT_avx2_constants.h were computed with.
+#
+# usage: perl util/ringlwe_fft.pl [outdir]
+#
+# run from the top of the tree, or through "make fft" in crypto/ringlwe.
+
+use strict;
+
+my $outdir = shift || "crypto/ringlwe/FFT";
+
+# n, q, root, twisted: root is a primitive 2n'th root of unity psi for the
+# negacyclic (twisted) transforms and a primitive n'th root w otherwise
+my @sets = (
+	[1024, 40961, 16186, 1],
+	[512, 25601, 22188, 1],
+	[256, 15361, 12228, 1],
+	[2048, 8816641, 2502, 0],
+	[2048, 17633281, 23365, 0],
+	[2048, 536856577, 127625803, 0],
+	[1024, 8816641, 8400, 0],
+	[1024, 17633281, 114075, 0],
+	[1024, 536856577, 10481023, 0],
+);
+
+# All the moduli are below 2^30, so products of two residues fit the
+# 64-bit integers Perl works in.
+sub mulmod { my ($a, $b, $q) = @_; return ($a * $b) % $q; }
+
+sub powmod {
+	my ($b, $e, $q) = @_;
+	my $r = 1;
+	$b %= $q;
+	while ($e) {
+		$r = mulmod($r, $b, $q) if ($e & 1);
+		$b = mulmod($b, $b, $q);
+		$e >>= 1;
+	}
+	return $r;
+}
+
+sub invmod { my ($a, $q) = @_; return powmod($a, $q - 2, $q); }
+
+# -q^-1 mod 2^32, built up a bit at a time so that q*x + 1 = 0 mod 2^32
+sub mont_qinv {
+	my ($q) = @_;
+	my ($x, $t) = (0, 0);
+	foreach my $bit (0 .. 31) {
+		if ((($t + 1) >> $bit) & 1) {
+			$x |= 1 << $bit;
+			$t = ($t + ($q << $bit)) % 2**32;
+		}
+	}
+	return $x;
+}
+
+my ($n, $q, $twisted, $logn, $w, $psi, $R);
+
+sub mont { my ($a) = @_; return mulmod($a, $R, $q); }
+
+# Twiddle factors of the radix-2 loops: layer m (pairs x[i], x[i+m]) uses
+# w^-(j*n/2m) forwards and w^(j*n/2m) backwards for the j'th pair of a block
+sub fw_exp { my ($m, $j) = @_; return (-$j * ($n / (2 * $m))) % $n; }
+sub bw_exp { my ($m, $j) = @_; return ($j * ($n / (2 * $m))) % $n; }
+
+# Butterfly on a and b with the twiddle w^e, which is free when e = 0
+sub bfly {
+	my ($kind, $a, $b, $e) = @_;
+	return "$kind" . "1($a, $b);" if ($e == 0);
+	return "$kind($a, $b, " . mont(powmod($w, $e, $q)) . ");";
+}
+
+# The stages, as [radix, m] with m the smallest half-width they cover
+sub stages_fwd {
+	my @s;
+	my $m = $n >> 1;
+	if ($logn & 1) {
+		push @s, [2, $m];
+		$m >>= 1;
+	}
+	for (; $m >= 2; $m >>= 2) {
+		push @s, [4, $m >> 1];
+	}
+	return @s;
+}
+
+sub stages_bwd {
+	my @s;
+	my $m;
+	for ($m = 1; 4 * $m <= $n; $m <<= 2) {
+		push @s, [4, $m];
+	}
+	push @s, [2, $m] if ($logn & 1);
+	return @s;
+}
+
+sub fmt_table {
+	my ($type, $name, @v) = @_;
+	my $s = "static const $type $name\[" . scalar(@v) . "] = {\n";
+	while (@v) {
+		my @line = splice(@v, 0, 8);
+		$s .= "\t" . join(", ", @line) . (@v ? ",\n" : "\n");
+	}
+	return $s . "};\n";
+}
+
+# Forward transform, Gentleman-Sande (decimation in frequency), in place;
+# appends the twiddle factors it reads to @$tab
+sub gen_fwd {
+	my ($tab) = @_;
+	my $c = "";
+	my $first = 1;
+
+	foreach my $st (stages_fwd()) {
+		my ($radix, $m) = @$st;
+		if ($radix == 2) {
+			# The first stage of an odd number of layers: a single block
+			$c .= "\t/* Layer m = $m */\n";
+			$c .= "\tfor (j = 0; j < $m; ++j, w += " . ($twisted ? 3 : 1) . ") {\n";
+			if ($twisted) {
+				$c .= "\t\tMUL_MONT_RED(a0, x[j], w[0], q, qinv);\n";
+				$c .= "\t\tMUL_MONT_RED(a1, x[j+$m], w[1], q, qinv);\n";
+				$c .= "\t\tGS(a0, a1, w[2]);\n";
+			} else {
+				$c .= "\t\ta0 = x[j]; a1 = x[j+$m];\n";
+				$c .= "\t\tGS(a0, a1, w[0]);\n";
+			}
+			$c .= "\t\tx[j] = a0; x[j+$m] = a1;\n";
+			$c .= "\t}\n\n";
+			for (my $j = 0; $j < $m; $j++) {
+				push @$tab, mont(powmod($psi, $j, $q)), mont(powmod($psi, $j + $m, $q)) if ($twisted);
+				push @$tab, mont(powmod($w, fw_exp($m, $j), $q));
+			}
+			$first = 0;
+			next;
+		}
+
+		# Radix 4: layers 2m and m on x[i], x[i+m], x[i+2m], x[i+3m]
+		my ($m2, $m3, $m4) = (2 * $m, 3 * $m, 4 * $m);
+		$c .= "\t/* Layers m = $m2, $m */\n";
+		if ($m == 1) {
+			# The last stage: the twiddles are constants
+			$c .= "\tfor (i = 0; i < $n; i += 4) {\n";
+			$c .= "\t\ta0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];\n";
+			$c .= "\t\t" . bfly("GS", "a0", "a2", fw_exp(2, 0)) . "\n";
+			$c .= "\t\t" . bfly("GS", "a1", "a3", fw_exp(2, 1)) . "\n";
+			$c .= "\t\t" . bfly("GS", "a0", "a1", fw_exp(1, 0)) . "\n";
+			$c .= "\t\t" . bfly("GS", "a2", "a3", fw_exp(1, 0)) . "\n";
+			$c .= "\t\tx[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;\n";
+			$c .= "\t}\n";
+		} elsif ($m4 == $n) {
+			# The first stage: a single block, twisted as it is loaded
+			my $pre = ($first && $twisted);
+			my $k = $pre ? 4 : 0;
+			$c .= "\tfor (j = 0; j < $m; ++j, w += " . ($k + 3) . ") {\n";
+			if ($pre) {
+				for (my $l = 0; $l < 4; $l++) {
+					my $at = $l ? "j+" . ($l * $m) : "j";
+					$c .= "\t\tMUL_MONT_RED(a$l, x[$at], w[$l], q, qinv);\n";
+				}
+			} else {
+				$c .= "\t\ta0 = x[j]; a1 = x[j+$m]; a2 = x[j+$m2]; a3 = x[j+$m3];\n";
+			}
+			$c .= "\t\tGS(a0, a2, w[$k]);\n";
+			$c .= "\t\tGS(a1, a3, w[" . ($k + 1) . "]);\n";
+			$c .= "\t\tGS(a0, a1, w[" . ($k + 2) . "]);\n";
+			$c .= "\t\tGS(a2, a3, w[" . ($k + 2) . "]);\n";
+			$c .= "\t\tx[j] = a0; x[j+$m] = a1; x[j+$m2] = a2; x[j+$m3] = a3;\n";
+			$c .= "\t}\n\n";
+			for (my $j = 0; $j < $m; $j++) {
+				if ($pre) {
+					push @$tab, mont(powmod($psi, $j + $_ * $m, $q)) foreach (0 .. 3);
+				}
+				push @$tab, mont(powmod($w, fw_exp($m2, $j), $q)),
+				    mont(powmod($w, fw_exp($m2, $j + $m), $q)),
+				    mont(powmod($w, fw_exp($m, $j), $q));
+			}
+		} else {
+			$c .= "\tfor (j = 0; j < $m; ++j, w += 3) {\n";
+			$c .= "\t\tw1 = w[0]; w2 = w[1]; w3 = w[2];\n";
+			$c .= "\t\tfor (i = j; i < $n; i += $m4) {\n";
+			$c .= "\t\t\ta0 = x[i]; a1 = x[i+$m]; a2 = x[i+$m2]; a3 = x[i+$m3];\n";
+			$c .= "\t\t\tGS(a0, a2, w1);\n";
+			$c .= "\t\t\tGS(a1, a3, w2);\n";
+			$c .= "\t\t\tGS(a0, a1, w3);\n";
+			$c .= "\t\t\tGS(a2, a3, w3);\n";
+			$c .= "\t\t\tx[i] = a0; x[i+$m] = a1; x[i+$m2] = a2; x[i+$m3] = a3;\n";
+			$c .= "\t\t}\n";
+			$c .= "\t}\n\n";
+			for (my $j = 0; $j < $m; $j++) {
+				push @$tab, mont(powmod($w, fw_exp($m2, $j), $q)),
+				    mont(powmod($w, fw_exp($m2, $j + $m), $q)),
+				    mont(powmod($w, fw_exp($m, $j), $q));
+			}
+		}
+		$first = 0;
+	}
+	$c =~ s/\n\n$/\n/;
+	return $c;
+}
+
+# Backward transform, Cooley-Tukey (decimation in time); $mul loads the
+# point-wise product a*b instead of x.  Appends the twiddle factors (and
+# for the twisted transforms the post-multipliers) it reads to @$tab
+sub gen_bwd {
+	my ($mul, $tab) = @_;
+	my $c = "";
+	my @st = stages_bwd();
+	my $ninv = invmod($n, $q);
+
+	for (my $s = 0; $s < @st; $s++) {
+		my ($radix, $m) = @{$st[$s]};
+		my $last = ($s == $#st);
+		my $post = ($last && $twisted);
+
+		if ($radix == 2) {
+			# The last stage of an odd number of layers: a single block
+			$c .= "\t/* Layer m = $m */\n";
+			$c .= "\tfor (j = 0; j < $m; ++j, w += " . ($post ? 3 : 1) . ") {\n";
+			$c .= "\t\ta0 = x[j]; a1 = x[j+$m];\n";
+			$c .= "\t\tCT(a0, a1, w[0]);\n";
+			if ($post) {
+				$c .= "\t\tMUL_MONT_RED(x[j], a0, w[1], q, qinv);\n";
+				$c .= "\t\tMUL_MONT_RED(x[j+$m], a1, w[2], q, qinv);\n";
+			} else {
+				$c .= "\t\tx[j] = a0; x[j+$m] = a1;\n";
+			}
+			$c .= "\t}\n";
+			for (my $j = 0; $j < $m; $j++) {
+				push @$tab, mont(powmod($w, bw_exp($m, $j), $q));
+				push @$tab, mont(mulmod(invmod(powmod($psi, $j + $_ * $m, $q), $q), $ninv, $q)) foreach ($post ? (0, 1) : ());
+			}
+			next;
+		}
+
+		# Radix 4: layers m and 2m on x[i], x[i+m], x[i+2m], x[i+3m]
+		my ($m2, $m3, $m4) = (2 * $m, 3 * $m, 4 * $m);
+		$c .= "\t/* Layers m = $m, $m2 */\n";
+		if ($m == 1) {
+			# The first stage: the twiddles are constants
+			$c .= "\tfor (i = 0; i < $n; i += 4) {\n";
+			if ($mul) {
+				for (my $l = 0; $l < 4; $l++) {
+					my $at = $l ? "i+$l" : "i";
+					$c .= "\t\tMUL_BARRETT(a$l, a[$at], b[$at], q, mu);\n";
+				}
+			} else {
+				$c .= "\t\ta0 = x[i]; a1 = x[i+1]; a2 = x[i+2]; a3 = x[i+3];\n";
+			}
+			$c .= "\t\t" . bfly("CT", "a0", "a1", bw_exp(1, 0)) . "\n";
+			$c .= "\t\t" . bfly("CT", "a2", "a3", bw_exp(1, 0)) . "\n";
+			$c .= "\t\t" . bfly("CT", "a0", "a2", bw_exp(2, 0)) . "\n";
+			$c .= "\t\t" . bfly("CT", "a1", "a3", bw_exp(2, 1)) . "\n";
+			$c .= "\t\tx[i] = a0; x[i+1] = a1; x[i+2] = a2; x[i+3] = a3;\n";
+			$c .= "\t}\n\n";
+		} elsif ($m4 == $n) {
+			# The last stage: a single block, untwisted and scaled as it
+			# is stored
+			$c .= "\tfor (j = 0; j < $m; ++j, w += " . ($post ? 7 : 3) . ") {\n";
+			$c .= "\t\ta0 = x[j]; a1 = x[j+$m]; a2 = x[j+$m2]; a3 = x[j+$m3];\n";
+			$c .= "\t\tCT(a0, a1, w[0]);\n";
+			$c .= "\t\tCT(a2, a3, w[0]);\n";
+			$c .= "\t\tCT(a0, a2, w[1]);\n";
+			$c .= "\t\tCT(a1, a3, w[2]);\n";
+			if ($post) {
+				for (my $l = 0; $l < 4; $l++) {
+					my $at = $l ? "j+" . ($l * $m) : "j";
+					$c .= "\t\tMUL_MONT_RED(x[$at], a$l, w[" . ($l + 3) . "], q, qinv);\n";
+				}
+			} else {
+				$c .= "\t\tx[j] = a0; x[j+$m] = a1; x[j+$m2] = a2; x[j+$m3] = a3;\n";
+			}
+			$c .= "\t}\n\n";
+			for (my $j = 0; $j < $m; $j++) {
+				push @$tab, mont(powmod($w, bw_exp($m, $j), $q)),
+				    mont(powmod($w, bw_exp($m2, $j), $q)),
+				    mont(powmod($w, bw_exp($m2, $j + $m), $q));
+				push @$tab, mont(mulmod(invmod(powmod($psi, $j + $_ * $m, $q), $q), $ninv, $q)) foreach ($post ? (0 .. 3) : ());
+			}
+		} else {
+			$c .= "\tfor (j = 0; j < $m; ++j, w += 3) {\n";
+			$c .= "\t\tw1 = w[0]; w2 = w[1]; w3 = w[2];\n";
+			$c .= "\t\tfor (i = j; i < $n; i += $m4) {\n";
+			$c .= "\t\t\ta0 = x[i]; a1 = x[i+$m]; a2 = x[i+$m2]; a3 = x[i+$m3];\n";
+			$c .= "\t\t\tCT(a0, a1, w1);\n";
+			$c .= "\t\t\tCT(a2, a3, w1);\n";
+			$c .= "\t\t\tCT(a0, a2, w2);\n";
+			$c .= "\t\t\tCT(a1, a3, w3);\n";
+			$c .= "\t\t\tx[i] = a0; x[i+$m] = a1; x[i+$m2] = a2; x[i+$m3] = a3;\n";
+			$c .= "\t\t}\n";
+			$c .= "\t}\n\n";
+			for (my $j = 0; $j < $m; $j++) {
+				push @$tab, mont(powmod($w, bw_exp($m, $j), $q)),
+				    mont(powmod($w, bw_exp($m2, $j), $q)),
+				    mont(powmod($w, bw_exp($m2, $j + $m), $q));
+			}
+		}
+	}
+	$c =~ s/\n\n$/\n/;
+	return $c;
+}
+
+my $license = <<'EOF';
+/* This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * See LICENSE for complete information.
+ */
+EOF
+
+foreach my $set (@sets) {
+	my $root;
+	($n, $q, $root, $twisted) = @$set;
+	$logn = 0;
+	$logn++ while ((1 << $logn) < $n);
+	die "n = $n is not a power of two" if ((1 << $logn) != $n);
+	$R = (2**32) % $q;
+	if ($twisted) {
+		$psi = $root;
+		$w = mulmod($psi, $psi, $q);
+		die "$root is not a primitive 2n'th root mod $q" if (powmod($psi, $n, $q) != $q - 1);
+	} else {
+		$psi = 1;
+		$w = $root;
+		die "$root is not a primitive n'th root mod $q" if (powmod($w, $n / 2, $q) != $q - 1);
+	}
+
+	my $tag = "${n}_${q}";
+	my $qinv = mont_qinv($q) . "U";
+	my $type = $twisted ? "RINGELT" : "FFTSHORT";
+	my (@tf, @tb, @tm);
+	my $fwd = gen_fwd(\@tf);
+	my $bwd = gen_bwd(0, \@tb);
+	my $bwdmul = $twisted ? gen_bwd(1, \@tm) : "";
+	my $vars = "\tFFTSHORT i, j;\n\tFFTSHORT a0, a1, a2, a3, w1, w2, w3;\n";
+	my $out = $license . "\n";
+
+	$out .= "/* Generated by util/ringlwe_fft.pl: do not edit. */\n\n";
+	if ($twisted) {
+		$out .= "/* Code to compute a Number Theoretic Transform for multiplication in the ring\n";
+		$out .= "F_q[x] / <x^n+1>.\n\tn = $n, q = $q\t*/\n\n";
+	} else {
+		$out .= "/* Cyclic Number Theoretic Transform mod q, for the Bluestein and Rader\n";
+		$out .= "convolutions of the prime-m parameter sets.\n\tn = $n, q = $q\t*/\n\n";
+	}
+	$out .= "#include \"FFT_includes.h\"\n\n";
+
+	if ($twisted) {
+		$out .= "#define GS(a, b, w) BFLY_GS(a, b, w, q, q, qinv, MUL_MONT_RED)\n";
+		$out .= "#define GS1(a, b) BFLY_GS_1(a, b, q)\n";
+		$out .= "#define CT(a, b, w) BFLY_CT(a, b, w, q, q, qinv, MUL_MONT_RED)\n";
+		$out .= "#define CT1(a, b) BFLY_CT_1(a, b, q)\n\n";
+		$out .= "/* The twiddle factors w^k in Montgomery form, in the order the stages\n";
+		$out .= "read them, with the twist psi^k by the 2n'th root interleaved into the\n";
+		$out .= "first forward stage and psi^-k * n^-1 into the last backward stage */\n";
+	} else {
+		$out .= "#define GS(a, b, w) BFLY_GS(a, b, w, q, q2, qinv, MUL_MONT)\n";
+		$out .= "#define GS1(a, b) BFLY_GS_1(a, b, q2)\n";
+		$out .= "#define CT(a, b, w) BFLY_CT(a, b, w, q, q2, qinv, MUL_MONT)\n";
+		$out .= "#define CT1(a, b) BFLY_CT_1(a, b, q2)\n\n";
+		$out .= "/* The twiddle factors w^k in Montgomery form, in the order the stages\n";
+		$out .= "read them */\n";
+	}
+	$out .= fmt_table($type, "W_fwd_$tag", @tf) . "\n";
+	$out .= fmt_table($type, "W_bwd_$tag", @tb) . "\n";
+
+	my $consts = "\tconst FFTSHORT q = $q, qinv = $qinv;\n";
+	if ($twisted) {
+		die "backward tables differ" if ("@tb" ne "@tm");
+
+		$out .= "/*\n";
+		$out .= "Gentleman-Sande, decimation-in-frequency FFT, premultiplying x by the\n";
+		$out .= "powers of the 2n'th root of unity so that point-wise multiplication gives\n";
+		$out .= "the negacyclic convolution, i.e. multiplication modulo x^n+1.  The output\n";
+		$out .= "is left in bit-reversed order for FFT_twisted_backward_$tag.\n";
+		$out .= "*/\n";
+		$out .= "void FFT_twisted_forward_$tag(RINGELT x[$n]) {\n";
+		$out .= $consts . "\tconst RINGELT *w = W_fwd_$tag;\n" . $vars . "\n" . $fwd . "}\n\n";
+
+		$out .= "/*\n";
+		$out .= "Cooley-Tukey, decimation-in-time FFT, inverting FFT_twisted_forward_$tag:\n";
+		$out .= "postmultiplies x by the inverse powers of the 2n'th root of unity and by\n";
+		$out .= "n^-1.\n";
+		$out .= "*/\n";
+		$out .= "void FFT_twisted_backward_$tag(RINGELT x[$n]) {\n";
+		$out .= $consts . "\tconst RINGELT *w = W_bwd_$tag;\n" . $vars . "\n" . $bwd . "}\n\n";
+
+		$out .= "/*\n";
+		$out .= "x = FFT_twisted_backward_$tag of the point-wise product a*b, formed as the\n";
+		$out .= "first stage loads it.  x may alias a or b.\n";
+		$out .= "*/\n";
+		$out .= "void FFT_twisted_backward_mul_$tag(RINGELT x[$n], const RINGELT a[$n], const RINGELT b[$n]) {\n";
+		$out .= $consts . "\tconst FFTSHORT mu = BARRETT_MU($q);\n";
+		$out .= "\tconst RINGELT *w = W_bwd_$tag;\n" . $vars . "\n" . $bwdmul . "}\n\n";
+
+		$out .= <<EOF;
+void _FFT_forward_$tag(RINGELT *x) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_forward_${tag}_avx2(x);
+    return;
+  }
+#endif
+  FFT_twisted_forward_$tag(x);
+}
+
+void _FFT_backward_$tag(RINGELT *x) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_backward_${tag}_avx2(x);
+    return;
+  }
+#endif
+  FFT_twisted_backward_$tag(x);
+}
+
+void _FFT_backward_mul_$tag(RINGELT *x, const RINGELT *a, const RINGELT *b) {
+#ifdef FFT_AVX2
+  if (FFT_AVX2_CAPABLE) {
+    FFT_twisted_backward_mul_${tag}_avx2(x, a, b);
+    return;
+  }
+#endif
+  FFT_twisted_backward_mul_$tag(x, a, b);
+}
+EOF
+	} else {
+		$consts = "\tconst FFTSHORT q = $q, q2 = 2*$q, qinv = $qinv;\n";
+
+		$out .= "/*\n";
+		$out .= "Gentleman-Sande, decimation-in-frequency FFT, leaving the output in\n";
+		$out .= "bit-reversed order for FFT_backward_$tag.\n";
+		$out .= "Coefficients are kept lazily reduced in [0, 2q), both on input and on output.\n";
+		$out .= "*/\n";
+		$out .= "void FFT_forward_$tag(FFTSHORT x[$n]) {\n";
+		$out .= $consts . "\tconst FFTSHORT *w = W_fwd_$tag;\n" . $vars . "\n";
+		$out .= "#ifdef FFT_AVX2\n\tif (FFT_AVX2_CAPABLE) {\n\t\tFFT_forward_${tag}_avx2(x);\n\t\treturn;\n\t}\n#endif\n\n";
+		$out .= $fwd . "}\n\n";
+
+		$out .= "/*\n";
+		$out .= "Cooley-Tukey, decimation-in-time FFT, inverting FFT_forward_$tag up to\n";
+		$out .= "the factor n.\n";
+		$out .= "The output is lazily reduced to [0, 2q); callers finish the reduction.\n";
+		$out .= "*/\n";
+		$out .= "void FFT_backward_$tag(FFTSHORT x[$n]) {\n";
+		$out .= $consts . "\tconst FFTSHORT *w = W_bwd_$tag;\n" . $vars . "\n";
+		$out .= "#ifdef FFT_AVX2\n\tif (FFT_AVX2_CAPABLE) {\n\t\tFFT_backward_${tag}_avx2(x);\n\t\treturn;\n\t}\n#endif\n\n";
+		$out .= $bwd . "}\n";
+	}
+
+	my $file = "$outdir/FFT_$tag.c";
+	open(OUT, ">$file") || die "can't open $file: $!";
+	print OUT $out;
+	close(OUT);
+}